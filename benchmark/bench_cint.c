@@ -0,0 +1,361 @@
+/*
+ * Copyright (C) 2013-  Qiming Sun <osirpt.sun@gmail.com>
+ *
+ * Throughput of the integrals of each family, angular momentum class and
+ * contraction pattern. The results are written in JSON
+ *
+ *      bench_cint [-l lmax] [-t seconds] [-f family] [-o output.json]
+ *
+ * -l   highest angular momentum of the shells (default 2)
+ * -t   minimal time to measure each entry (default 0.05 s)
+ * -f   only run the family int1e, int2e, int3c2e, int2c2e, int1e_grids,
+ *      f12 or spinor
+ * -o   output file (default stdout)
+ *
+ * The contraction pattern of a shell is '1' for a segmented shell (NPRIM_1
+ * primitives, one contraction) and 'n' for a generally contracted shell
+ * (NPRIM_N primitives, NCTR_N contractions). For int2e, the patterns
+ * 1111, n111, 1n11, 11n1 and 111n select the loops CINT2e_xxxx_loop, nnnn
+ * selects the general CINT2e_loop.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "cint.h"
+#include "cint_funcs.h"
+
+#define NPRIM_1         3
+#define NPRIM_N         4
+#define NCTR_N          2
+#define NGRIDS_BENCH    64
+#define ENV_SIZE        4096
+
+extern CINTOptimizerFunction int3c2e_optimizer;
+extern CINTIntegralFunction int3c2e_sph;
+extern CINTOptimizerFunction int2c2e_optimizer;
+extern CINTIntegralFunction int2c2e_sph;
+extern CINTOptimizerFunction int1e_grids_optimizer;
+extern CINTIntegralFunction int1e_grids_sph;
+#ifdef WITH_F12
+extern CINTOptimizerFunction int2e_stg_optimizer;
+extern CINTIntegralFunction int2e_stg_sph;
+extern CINTOptimizerFunction int2e_yp_optimizer;
+extern CINTIntegralFunction int2e_yp_sph;
+#endif
+
+typedef struct {
+        const char *family;
+        const char *name;
+        CINTIntegralFunction *intor;
+        CINTOptimizerFunction *optimizer;
+        int nshl;
+        int ncomp;
+        int spinor;
+        int ngrids;
+        // highest l of the shells, -1 to use the -l argument
+        int lmax;
+        // patterns to measure, separated by space
+        const char *patterns;
+} Family;
+
+static Family families[] = {
+        {"int1e", "int1e_ovlp_sph", &int1e_ovlp_sph, &int1e_ovlp_optimizer,
+                2, 1, 0, 0, -1, "11 nn"},
+        {"int1e", "int1e_kin_sph", &int1e_kin_sph, &int1e_kin_optimizer,
+                2, 1, 0, 0, -1, "11 nn"},
+        {"int1e", "int1e_nuc_sph", &int1e_nuc_sph, &int1e_nuc_optimizer,
+                2, 1, 0, 0, -1, "11 nn"},
+        {"int2e", "int2e_sph", &int2e_sph, &int2e_optimizer,
+                4, 1, 0, 0, -1, "1111 n111 1n11 11n1 111n nnnn"},
+        {"int2e", "int2e_ip1_sph", &int2e_ip1_sph, &int2e_ip1_optimizer,
+                4, 3, 0, 0, -1, "1111 nnnn"},
+        {"int3c2e", "int3c2e_sph", &int3c2e_sph, &int3c2e_optimizer,
+                3, 1, 0, 0, -1, "111 nn1 nnn"},
+        {"int2c2e", "int2c2e_sph", &int2c2e_sph, &int2c2e_optimizer,
+                2, 1, 0, 0, -1, "11 nn"},
+        {"int1e_grids", "int1e_grids_sph", &int1e_grids_sph, &int1e_grids_optimizer,
+                2, 1, 0, NGRIDS_BENCH, -1, "11 nn"},
+#ifdef WITH_F12
+        {"f12", "int2e_stg_sph", &int2e_stg_sph, &int2e_stg_optimizer,
+                4, 1, 0, 0, -1, "1111 nnnn"},
+        {"f12", "int2e_yp_sph", &int2e_yp_sph, &int2e_yp_optimizer,
+                4, 1, 0, 0, -1, "1111 nnnn"},
+#endif
+        {"spinor", "int1e_nuc_spinor", &int1e_nuc_spinor, &int1e_nuc_optimizer,
+                2, 1, 1, 0, -1, "11"},
+        {"spinor", "int2e_spinor", &int2e_spinor, &int2e_optimizer,
+                4, 1, 1, 0, 2, "1111"},
+};
+
+static double coords[4][3] = {
+        { 0.0,  0.0,  0.0},
+        { 0.0,  0.0,  1.4},
+        { 1.2,  0.5,  0.0},
+        {-0.4,  1.1,  0.9},
+};
+
+static double wall_time()
+{
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/*
+ * One atom per shell. Returns the number of shells.
+ */
+static int make_basis(int *atm, int *bas, double *env, int *ls, const char *pattern,
+                      int nshl, int ngrids)
+{
+        int i, j, p, c, nprim, nctr, off;
+        memset(atm, 0, sizeof(int) * ATM_SLOTS * 4);
+        memset(bas, 0, sizeof(int) * BAS_SLOTS * 4);
+        memset(env, 0, sizeof(double) * ENV_SIZE);
+        off = PTR_ENV_START;
+        for (i = 0; i < 4; i++) {
+                atm(CHARGE_OF, i) = 1 + i;
+                atm(PTR_COORD, i) = off;
+                env[off+0] = coords[i][0];
+                env[off+1] = coords[i][1];
+                env[off+2] = coords[i][2];
+                off += 3;
+        }
+        env[PTR_F12_ZETA] = 1.2;
+        env[NGRIDS] = ngrids;
+        env[PTR_GRIDS] = off;
+        for (i = 0; i < ngrids; i++) {
+                env[off+0] = sin(i * 0.7) * 2;
+                env[off+1] = cos(i * 1.3) * 2;
+                env[off+2] = sin(i * 2.1 + .4) * 2;
+                off += 3;
+        }
+
+        for (i = 0; i < nshl; i++) {
+                if (pattern[i] == 'n') {
+                        nprim = NPRIM_N;
+                        nctr = NCTR_N;
+                } else {
+                        nprim = NPRIM_1;
+                        nctr = 1;
+                }
+                bas(ATOM_OF, i) = i;
+                bas(ANG_OF, i) = ls[i];
+                bas(NPRIM_OF, i) = nprim;
+                bas(NCTR_OF, i) = nctr;
+                bas(PTR_EXP, i) = off;
+                for (p = 0; p < nprim; p++) {
+                        env[off+p] = 0.2 * pow(3.5, nprim - 1 - p);
+                }
+                off += nprim;
+                bas(PTR_COEFF, i) = off;
+                for (c = 0; c < nctr; c++) {
+                for (p = 0; p < nprim; p++) {
+                        j = bas(PTR_EXP, i) + p;
+                        env[off+c*nprim+p] = (0.3 + 0.7 * cos(p + 0.5 * c))
+                                * CINTgto_norm(ls[i], env[j]);
+                } }
+                off += nprim * nctr;
+        }
+        return nshl;
+}
+
+/*
+ * The number of doubles written by one call. out has one element more than
+ * the ndouble expected doubles to detect overruns.
+ */
+static size_t count_outputs(Family *fam, double *out, size_t ndouble, int *shls,
+                            int *atm, int natm, int *bas, int nbas, double *env,
+                            CINTOpt *opt, double *cache)
+{
+        size_t i, n;
+        for (i = 0; i <= ndouble; i++) {
+                out[i] = NAN;
+        }
+        (*fam->intor)(out, NULL, shls, atm, natm, bas, nbas, env, opt, cache);
+        for (n = 0, i = 0; i <= ndouble; i++) {
+                n += !isnan(out[i]);
+        }
+        return n;
+}
+
+static int bench_one(FILE *fout, Family *fam, int *ls, const char *pattern,
+                     double min_time, int *first)
+{
+        int atm[ATM_SLOTS * 4];
+        int bas[BAS_SLOTS * 4];
+        double *env = malloc(sizeof(double) * ENV_SIZE);
+        int nshl = fam->nshl;
+        int natm = 4;
+        int nbas = make_basis(atm, bas, env, ls, pattern, nshl, fam->ngrids);
+        int shls[4] = {0, 1, 2, 3};
+        int i;
+        if (fam->ngrids > 0) {
+                // shls[2]:shls[3] is the range of grids for int1e_grids
+                shls[2] = 0;
+                shls[3] = fam->ngrids;
+        }
+        size_t nao = 1;
+        size_t nprim = 1;
+        for (i = 0; i < nshl; i++) {
+                if (fam->spinor) {
+                        nao *= CINTcgto_spinor(i, bas);
+                } else {
+                        nao *= CINTcgto_spheric(i, bas);
+                }
+                nprim *= bas(NPRIM_OF, i);
+        }
+        size_t nout = nao * fam->ncomp * (fam->ngrids > 0 ? fam->ngrids : 1);
+        // spinor integrals are complex
+        size_t ndouble = nout * (fam->spinor + 1);
+        double *out = malloc(sizeof(double) * (ndouble + 1));
+
+        CINTOpt *opt = NULL;
+        (*fam->optimizer)(&opt, atm, natm, bas, nbas, env);
+        size_t cache_size = (*fam->intor)(NULL, NULL, shls, atm, natm, bas, nbas,
+                                          env, opt, NULL);
+        double *cache = malloc(sizeof(double) * (cache_size + 1));
+
+        // warm up, and check that one call computes the nout integrals
+        size_t ncomputed = count_outputs(fam, out, ndouble, shls, atm, natm,
+                                         bas, nbas, env, opt, cache);
+        if (ncomputed != ndouble) {
+                fprintf(stderr, "%s pattern %s: %zu doubles computed, "
+                        "%zu expected\n", fam->name, pattern, ncomputed, ndouble);
+                CINTdel_optimizer(&opt);
+                free(cache);
+                free(out);
+                free(env);
+                return 1;
+        }
+
+        long ncalls = 0;
+        long nrep = 1;
+        double t0 = wall_time();
+        double elapsed = 0;
+        long n;
+        while (elapsed < min_time) {
+                for (n = 0; n < nrep; n++) {
+                        (*fam->intor)(out, NULL, shls, atm, natm, bas, nbas,
+                                      env, opt, cache);
+                }
+                ncalls += nrep;
+                nrep *= 2;
+                elapsed = wall_time() - t0;
+        }
+
+        fprintf(fout, "%s\n    {\"family\": \"%s\", \"intor\": \"%s\", \"l\": [",
+                *first ? "" : ",", fam->family, fam->name);
+        for (i = 0; i < nshl; i++) {
+                fprintf(fout, "%s%d", i ? ", " : "", ls[i]);
+        }
+        fprintf(fout, "], \"nprim\": [");
+        for (i = 0; i < nshl; i++) {
+                fprintf(fout, "%s%d", i ? ", " : "", bas(NPRIM_OF, i));
+        }
+        fprintf(fout, "], \"nctr\": [");
+        for (i = 0; i < nshl; i++) {
+                fprintf(fout, "%s%d", i ? ", " : "", bas(NCTR_OF, i));
+        }
+        fprintf(fout, "], \"pattern\": \"%s\", \"calls\": %ld, \"seconds\": %.6f, "
+                "\"ns_per_call\": %.1f, \"integrals_per_second\": %.6e, "
+                "\"primitives_per_second\": %.6e}",
+                pattern, ncalls, elapsed, elapsed / ncalls * 1e9,
+                nout * ncalls / elapsed, nprim * ncalls / elapsed);
+        *first = 0;
+
+        CINTdel_optimizer(&opt);
+        free(cache);
+        free(out);
+        free(env);
+        return 0;
+}
+
+static int bench_family(FILE *fout, Family *fam, int lmax, double min_time, int *first)
+{
+        int ls[4] = {0, 0, 0, 0};
+        int nshl = fam->nshl;
+        int i, nclass;
+        char patterns[64];
+        char *pattern;
+        if (fam->lmax >= 0 && fam->lmax < lmax) {
+                lmax = fam->lmax;
+        }
+        for (nclass = 1, i = 0; i < nshl; i++) {
+                nclass *= lmax + 1;
+        }
+
+        strncpy(patterns, fam->patterns, sizeof(patterns) - 1);
+        patterns[sizeof(patterns) - 1] = '\0';
+        for (pattern = strtok(patterns, " "); pattern != NULL;
+             pattern = strtok(NULL, " ")) {
+                int n, k;
+                for (n = 0; n < nclass; n++) {
+                        // ls[0] varies slowest
+                        for (k = n, i = nshl - 1; i >= 0; i--) {
+                                ls[i] = k % (lmax + 1);
+                                k /= lmax + 1;
+                        }
+                        if (bench_one(fout, fam, ls, pattern, min_time, first)) {
+                                return 1;
+                        }
+                }
+        }
+        return 0;
+}
+
+int main(int argc, char **argv)
+{
+        int lmax = 2;
+        double min_time = 0.05;
+        const char *family = NULL;
+        const char *output = NULL;
+        int i;
+        for (i = 1; i < argc; i++) {
+                if (strcmp(argv[i], "-l") == 0 && i + 1 < argc) {
+                        lmax = atoi(argv[++i]);
+                } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+                        min_time = atof(argv[++i]);
+                } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+                        family = argv[++i];
+                } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+                        output = argv[++i];
+                } else {
+                        fprintf(stderr, "Usage: %s [-l lmax] [-t seconds] "
+                                "[-f family] [-o output.json]\n", argv[0]);
+                        return 1;
+                }
+        }
+        if (lmax < 0 || lmax > ANG_MAX) {
+                fprintf(stderr, "lmax %d out of range\n", lmax);
+                return 1;
+        }
+
+        FILE *fout = stdout;
+        if (output != NULL) {
+                fout = fopen(output, "w");
+                if (fout == NULL) {
+                        fprintf(stderr, "Cannot open %s\n", output);
+                        return 1;
+                }
+        }
+
+        fprintf(fout, "{\n  \"version\": \"%s\",\n  \"lmax\": %d,\n"
+                "  \"min_time\": %g,\n  \"results\": [", CINT_VERSION, lmax, min_time);
+        int first = 1;
+        int err = 0;
+        int nfamilies = sizeof(families) / sizeof(Family);
+        for (i = 0; i < nfamilies && !err; i++) {
+                if (family == NULL || strcmp(family, families[i].family) == 0) {
+                        err = bench_family(fout, families + i, lmax, min_time, &first);
+                }
+        }
+        fprintf(fout, "\n  ]\n}\n");
+
+        if (fout != stdout) {
+                fclose(fout);
+        }
+        return err;
+}
@@ -27,7 +27,9 @@ pub fn build(b: *std.Build) !void {
     const user_config = b.addConfigHeader(.{
         .style = .{ .cmake = .{ .path = "src/config.h.in" } },
         .include_path = "config.h",
-    }, .{});
+    }, .{
+        .CINT_JIT_DATADIR = "../share/libcint",
+    });
 
     lib.addIncludePath(.{ .path = "include" });
     lib.addIncludePath(.{ .path = "src" });
@@ -51,6 +53,7 @@ pub fn build(b: *std.Build) !void {
         "src/breit.c",
         "src/c2f.c",
         "src/cart2sph.c",
+        "src/cholesky.c",
         "src/cint1e_a.c",
         "src/cint1e.c",
         "src/cint1e_grids.c",
@@ -63,17 +66,23 @@ pub fn build(b: *std.Build) !void {
         "src/eigh.c",
         "src/fblas.c",
         "src/find_roots.c",
+        "src/fmm.c",
         "src/fmt.c",
         "src/g1e.c",
         "src/g1e_grids.c",
         "src/g2c2e.c",
         "src/g2e.c",
+        "src/g2e_f32.c",
+        "src/g2e_hrr.c",
+        "src/g2e_kernels.c",
         "src/g3c1e.c",
         "src/g3c2e.c",
         "src/gout2e_simd.c",
         "src/misc.c",
+        "src/multipole.c",
         "src/optimizer.c",
         "src/polyfits.c",
+        "src/rys_polyfits.c",
         "src/rys_roots.c",
         "src/rys_wheeler.c",
         "src/sr_rys_polyfits.c",
@@ -21,6 +21,9 @@ extern CINTOptimizerFunction int2e_optimizer;
 extern CINTIntegralFunction int2e_cart;
 extern CINTIntegralFunction int2e_sph;
 extern CINTIntegralFunction int2e_spinor;
+/* Kramers unique part of int2e_spinor, see CINTc2s_kramers_2e */
+extern CINTOptimizerFunction int2e_kr_optimizer;
+extern CINTIntegralFunction int2e_kr_spinor;
 
 /* <i|OVLP |j> */
 extern CINTOptimizerFunction int1e_ovlp_optimizer;
@@ -465,6 +468,8 @@ extern CINTOptimizerFunction int2e_spsp1_optimizer;
 extern CINTIntegralFunction int2e_spsp1_cart;
 extern CINTIntegralFunction int2e_spsp1_sph;
 extern CINTIntegralFunction int2e_spsp1_spinor;
+extern CINTOptimizerFunction int2e_spsp1_kr_optimizer;
+extern CINTIntegralFunction int2e_spsp1_kr_spinor;
 
 /* (SIGMA DOT P i SIGMA DOT P j|R12 |SIGMA DOT P k SIGMA DOT P l) */
 extern CINTOptimizerFunction int2e_spsp1spsp2_optimizer;
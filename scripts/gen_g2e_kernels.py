@@ -0,0 +1,286 @@
+#!/usr/bin/env python
+'''
+Generate src/g2e_kernels.c, the straight-line g0_2d4d and gout kernels of
+the plain two-electron integrals (ij|kl) for each angular momentum class up
+to LMAX.
+
+    python gen_g2e_kernels.py > ../src/g2e_kernels.c
+
+The g array follows the layout of CINTinit_int2e_EnvVars.  The 2D integrals
+are built along i (or j) and k (or l), whichever is the larger, then
+transferred to the 4D integrals as in CINTg0_ik2d_4d, CINTg0_lj2d_4d etc.
+Only the elements required by gout are computed.
+'''
+
+
+LMAX = 2
+
+# The classes with li+lj+lk+ll <= 3 use CINTg0_2e_2d4d_unrolled of g2e.c
+LTOT_2D4D = 4
+
+
+def cart_comp(l):
+    '''Cartesian components in the order of CINTcart_comp'''
+    return [(ix, iy, l - ix - iy)
+            for ix in reversed(range(l + 1))
+            for iy in reversed(range(l - ix + 1))]
+
+
+class Layout:
+    def __init__(self, li, lj, lk, ll):
+        self.li, self.lj, self.lk, self.ll = li, lj, lk, ll
+        self.nroots = (li + lj + lk + ll) // 2 + 1
+        self.ibase = li > lj
+        self.kbase = lk > ll
+        if self.ibase:
+            dli, dlj = li + lj + 1, lj + 1
+        else:
+            dli, dlj = li + 1, li + lj + 1
+        if self.kbase:
+            dlk, dll = lk + ll + 1, ll + 1
+        else:
+            dlk, dll = lk + 1, lk + ll + 1
+        self.di = self.nroots
+        self.dk = self.di * dli
+        self.dl = self.dk * dlk
+        self.dj = self.dl * dll
+        self.g_size = self.dj * dlj
+
+    def pos(self, e):
+        i, k, l, j = e
+        return i * self.di + k * self.dk + l * self.dl + j * self.dj
+
+
+def g0_2d4d_statements(lay, ax):
+    '''Statements of one Cartesian axis for one Rys root n'''
+    li, lj, lk, ll = lay.li, lay.lj, lay.lk, lay.ll
+    origin = (0, 0, 0, 0)
+    done = {origin}
+    stmts = []
+
+    def ref(e):
+        if e == origin and ax != 'z':
+            return None  # gx(0,0) = gy(0,0) = 1
+        return 'g%s[n+%d]' % (ax, lay.pos(e))
+
+    def term(coef, e):
+        r = ref(e)
+        if r is None:
+            return coef
+        if coef == '1':
+            return r
+        return '%s * %s' % (coef, r)
+
+    def mul(n, c):
+        return c if n == 1 else '%d * %s' % (n, c)
+
+    def build(e):
+        if e in done:
+            return
+        i, k, l, j = e
+        terms = []
+        if lay.ibase and j > 0:
+            a, b = (i, k, l, j-1), (i+1, k, l, j-1)
+            terms = [('r'+ax, a), ('1', b)]
+        elif not lay.ibase and i > 0:
+            a, b = (i-1, k, l, j), (i-1, k, l, j+1)
+            terms = [('r'+ax, a), ('1', b)]
+        elif lay.kbase and l > 0:
+            a, b = (i, k, l-1, j), (i, k+1, l-1, j)
+            terms = [('s'+ax, a), ('1', b)]
+        elif not lay.kbase and k > 0:
+            a, b = (i, k-1, l, j), (i, k-1, l+1, j)
+            terms = [('s'+ax, a), ('1', b)]
+        else:
+            # 2D recursion, n along i or j, m along k or l
+            n = i if lay.ibase else j
+            m = k if lay.kbase else l
+
+            def e2d(n, m):
+                ii, jj = (n, 0) if lay.ibase else (0, n)
+                kk, ll_ = (m, 0) if lay.kbase else (0, m)
+                return (ii, kk, ll_, jj)
+            if n > 0:
+                terms = [('c00'+ax, e2d(n-1, m))]
+                if n > 1:
+                    terms.append((mul(n-1, 'b10'), e2d(n-2, m)))
+                if m > 0:
+                    terms.append((mul(m, 'b00'), e2d(n-1, m-1)))
+            else:
+                terms = [('c0p'+ax, e2d(n, m-1))]
+                if m > 1:
+                    terms.append((mul(m-1, 'b01'), e2d(n, m-2)))
+        for c, d in terms:
+            build(d)
+        stmts.append('g%s[n+%d] = %s;' % (ax, lay.pos(e),
+                                          ' + '.join(term(c, d) for c, d in terms)))
+        done.add(e)
+
+    for j in range(lj + 1):
+        for l in range(ll + 1):
+            for k in range(lk + 1):
+                for i in range(li + 1):
+                    build((i, k, l, j))
+    return stmts
+
+
+def gen_g0_2d4d(lay, name):
+    out = []
+    out.append('static void _g0_2d4d_%s(double *g, Rys2eT *bc, CINTEnvVars *envs)' % name)
+    out.append('{')
+    out.append('        double *gx = g;')
+    out.append('        double *gy = g + %d;' % lay.g_size)
+    out.append('        double *gz = g + %d;' % (lay.g_size * 2))
+    use_rirj = lay.lj > 0 if lay.ibase else lay.li > 0
+    use_rkrl = lay.ll > 0 if lay.kbase else lay.lk > 0
+    if use_rirj:
+        out.append('        double rx = envs->rirj[0];')
+        out.append('        double ry = envs->rirj[1];')
+        out.append('        double rz = envs->rirj[2];')
+    if use_rkrl:
+        out.append('        double sx = envs->rkrl[0];')
+        out.append('        double sy = envs->rkrl[1];')
+        out.append('        double sz = envs->rkrl[2];')
+    out.append('        FINT n;')
+    out.append('        for (n = 0; n < %d; n++) {' % lay.nroots)
+    body = []
+    for ax in 'xyz':
+        body.extend(g0_2d4d_statements(lay, ax))
+    text = '\n'.join(body)
+    # declare only the recursion coefficients of this class
+    for v in ('c00x', 'c00y', 'c00z', 'c0px', 'c0py', 'c0pz',
+              'b10', 'b01', 'b00'):
+        if v in text:
+            out.append('                double %s = bc->%s[n];' % (v, v))
+    out.append('                gx[n] = 1;')
+    out.append('                gy[n] = 1;')
+    out.extend('                ' + s for s in body)
+    out.append('        }')
+    out.append('}')
+    return out
+
+
+def gen_gout(lay, name):
+    li, lj, lk, ll = lay.li, lay.lj, lay.lk, lay.ll
+    nr = lay.nroots
+    out = []
+    out.append('static void _gout_%s(double *gout, double *g, FINT *idx,'
+               % name)
+    out.append('                       CINTEnvVars *envs, FINT empty)')
+    out.append('{')
+    decl = len(out)
+    n = 0
+    for cj in cart_comp(lj):
+        for cl in cart_comp(ll):
+            for ck in cart_comp(lk):
+                for ci in cart_comp(li):
+                    args = []
+                    for ax, d in zip('xyz', range(3)):
+                        e = (ci[d], ck[d], cl[d], cj[d])
+                        if ax == 'z' or e != (0, 0, 0, 0):
+                            args.append('g%s+%d' % (ax, lay.pos(e)))
+                    out.append('        GOUT(%d, _g%d_%d(%s));' %
+                               (n, len(args), nr, ', '.join(args)))
+                    n += 1
+    text = '\n'.join(out[decl:])
+    head = []
+    # gx = gy = 1 are not referenced by the gout of the s functions
+    if 'gx+' in text:
+        head.append('        double *gx = g;')
+    if 'gy+' in text:
+        head.append('        double *gy = g + %d;' % lay.g_size)
+    head.append('        double *gz = g + %d;' % (lay.g_size * 2))
+    out[decl:decl] = head
+    out.append('}')
+    return out
+
+
+def gen_sum_helpers(nroots):
+    out = []
+    for nr in nroots:
+        for nargs in (1, 2, 3):
+            names = 'xyz'[3-nargs:]
+            params = ', '.join('const double *%s' % c for c in names)
+            terms = ['*'.join('%s[%d]' % (c, r) for c in names)
+                     for r in range(nr)]
+            out.append('static inline double _g%d_%d(%s)' % (nargs, nr, params))
+            out.append('{')
+            out.append('        return ' + '\n             + '.join(terms) + ';')
+            out.append('}')
+    return out
+
+
+def main():
+    classes = [(li, lj, lk, ll)
+               for li in range(LMAX + 1) for lj in range(LMAX + 1)
+               for lk in range(LMAX + 1) for ll in range(LMAX + 1)]
+    nroots = sorted(set(sum(c) // 2 + 1 for c in classes))
+    out = []
+    out.append('''/*
+ * Copyright (C) 2013-  Qiming Sun <osirpt.sun@gmail.com>
+ *
+ * Straight-line g0_2d4d and gout kernels of (ij|kl) for each angular
+ * momentum class up to l = %d.
+ * This file is generated by scripts/gen_g2e_kernels.py. Do not edit.
+ */
+
+#include <stdlib.h>
+#include "config.h"
+#include "cint_bas.h"
+#include "g2e.h"
+
+#define GOUT(n, v)      gout[n] = empty ? (v) : gout[n] + (v)
+''' % LMAX)
+    out.extend(gen_sum_helpers(nroots))
+    for c in classes:
+        name = '%d%d%d%d' % c
+        lay = Layout(*c)
+        out.append('')
+        if sum(c) >= LTOT_2D4D:
+            out.extend(gen_g0_2d4d(lay, name))
+        out.extend(gen_gout(lay, name))
+
+    nclass = LMAX + 1
+    out.append('')
+    out.append('static void (*_f_g0_2d4d[])(double *, Rys2eT *, CINTEnvVars *) = {')
+    for c in classes:
+        if sum(c) >= LTOT_2D4D:
+            out.append('        &_g0_2d4d_%d%d%d%d,' % c)
+        else:
+            out.append('        &CINTg0_2e_2d4d_unrolled,')
+    out.append('};')
+    out.append('')
+    out.append('static void (*_f_gout[])(double *, double *, FINT *, CINTEnvVars *, FINT) = {')
+    for c in classes:
+        out.append('        &_gout_%d%d%d%d,' % c)
+    out.append('};')
+    out.append('''
+/*
+ * Replace the generic f_g0_2d4d and f_gout of the plain (ij|kl) by the
+ * kernels of its angular momentum class. The caller ensures that f_gout
+ * is CINTgout2e. The kernels are unrolled for the number of roots of the
+ * Coulomb ERIs. The SR ERIs and the F12 integrals of odd li+lj+lk+ll
+ * take more roots and keep the generic functions.
+ */
+void CINTg2e_class_kernels(CINTEnvVars *envs)
+{
+        FINT li = envs->i_l;
+        FINT lj = envs->j_l;
+        FINT lk = envs->k_l;
+        FINT ll = envs->l_l;
+        if (li > G2E_KERNEL_LMAX || lj > G2E_KERNEL_LMAX ||
+            lk > G2E_KERNEL_LMAX || ll > G2E_KERNEL_LMAX ||
+            envs->li_ceil != li || envs->lj_ceil != lj ||
+            envs->lk_ceil != lk || envs->ll_ceil != ll ||
+            envs->nrys_roots != (li + lj + lk + ll) / 2 + 1) {
+                return;
+        }
+        FINT n = ((li * %d + lj) * %d + lk) * %d + ll;
+        envs->f_g0_2d4d = _f_g0_2d4d[n];
+        envs->f_gout = _f_gout[n];
+}''' % (nclass, nclass, nclass))
+    print('\n'.join(out))
+
+
+if __name__ == '__main__':
+    main()
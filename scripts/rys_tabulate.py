@@ -20,8 +20,12 @@ def clenshaw_points(n):
 ngrids = 14
 chebrt = np.array(chebyshev_roots(ngrids))
 cs = np.array(clenshaw_points(ngrids))
-TBASE = np.append(np.arange(0, 39, 2.5), np.arange(40, 104, 4))
-print(TBASE)
+MXRYSROOTS = 32
+TBASE = np.append(np.arange(0, 39, 2.5), np.arange(40, 197, 4))
+
+def ntbase(nroots):
+    '''Number of intervals below the large-x limit x = 35+5*nroots of CINTrys_roots'''
+    return np.count_nonzero(TBASE[:-1] < 35 + 5 * nroots)
 
 def get_cheb_t_points(tbase):
     if tbase < 1000:
@@ -94,16 +98,16 @@ def pkl2table(prefix, pklfile):
     with open(pklfile, 'rb') as f:
         TBASE, rys_tab = pickle.load(f)
     TBASE = TBASE.round(6)
-    nt = len(TBASE) - 1
-    #nt = find_tbase(81)
-    #TBASE = TBASE[:nt+1]
+    offsets = [0] * 6
+    off = 0
     with open(f'{prefix}_x.dat', 'w') as fx, open(f'{prefix}_w.dat', 'w') as fw:
-        fw.write(f'// DATA_TBASE[{len(TBASE)}] = ''{' + (', '.join([str(x) for x in TBASE])) + '};\n')
+        fx.write(f'static double DATA_TBASE[{len(TBASE)}] = ''{' + (', '.join([str(x) for x in TBASE])) + '};\n')
         fx.write(f'static double DATA_X[] = ''{\n')
         fw.write(f'static double DATA_W[] = ''{\n')
         for i, tab in enumerate(rys_tab):
             nroots = i + 6
-            for it in range(nt):
+            offsets.append(off)
+            for it in range(ntbase(nroots)):
                 ttab = tab[it]
                 tbase = TBASE[it]
                 print(f'root {nroots}  tbase[{it}] {tbase}')
@@ -116,14 +120,17 @@ def pkl2table(prefix, pklfile):
                 fx.write(',\n')
                 fw.write(',\n'.join(fmt_w))
                 fw.write(',\n')
+                off += nroots * ngrids
         fx.write('};\n')
         fw.write('};\n')
+        fx.write(f'// offsets of the tables of nroots = 0..{MXRYSROOTS}\n')
+        fx.write(f'static int DATA_OFFSETS[{len(offsets)}] = ''{' + (', '.join([str(x) for x in offsets])) + '};\n')
 
 def generate_table(path):
-    with ProcessPoolExecutor(8) as pe:
+    with ProcessPoolExecutor(os.cpu_count()) as pe:
         tab = []
-        nt = len(TBASE) - 1
-        for nroots in range(6, 15):
+        for nroots in range(6, MXRYSROOTS+1):
+            nt = ntbase(nroots)
             res = []
             for tbase in range(nt):
                 print(f'root {nroots}  tbase {tbase}')
@@ -166,5 +173,5 @@ def polyfit_small_x_limits(nroots, x, low=None):
     return pr0, pr1, pw0, pw1
 
 if __name__ == '__main__':
-    #generate_table('rys_rw.pkl')
-    pkl2table('./rys', 'rys_rw.pkl')
+    generate_table('rys_rw.pkl')
+    pkl2table('../src/rys_roots', 'rys_rw.pkl')
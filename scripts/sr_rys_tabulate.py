@@ -20,6 +20,7 @@ TBASE = np.append(np.arange(0, 12, 4), 12*1.5**np.arange(20)).astype(int)
 print(TBASE)
 UBASE = np.sort(np.append([0, .2, .3, .4, .5, .6], .1 / 2**np.arange(4)))
 print(UBASE)
+MAX_NROOTS = 8
 
 def get_cheb_t_points(tbase):
     if tbase < 1000:
@@ -109,14 +110,20 @@ def polyfit_erfc(nroots, x, low):
     #    ww = [w * factor for w in ww]
     return rr, ww
 
-def pkl2table(prefix, pklfile):
+# (ubase, tbase) ranges of the tables sr_roots_part{0,1,2}. The linear
+# intervals of part1 (lower < 0.1, x > 12) are not accurate. This region is
+# handled by the large-x tables of sr_rys_tabulate1.py
+PARTS_UBASE = [(0, 5), (0, 5),          (4, len(UBASE)),]
+PARTS_TBASE = [(0, 4), (3, len(TBASE)), (0, 11),        ]
+
+def pkl2table(prefix, pklfile, parts=(0, 2)):
     with open(pklfile, 'rb') as f:
         TBASE, UBASE, rys_tab = pickle.load(f)
     UBASE = UBASE.round(6)
     TBASE = TBASE.round(6)
-    us = [(0, 5), (0, 5),          (4, len(UBASE)),]
-    ts = [(0, 4), (3, len(TBASE)), (0, 11),        ]
-    for j in range(3):
+    us = PARTS_UBASE
+    ts = PARTS_TBASE
+    for j in parts:
         u0, u1 = us[j]
         t0, t1 = ts[j]
         with open(f'{prefix}_part{j}_x.dat', 'w') as fx, open(f'{prefix}_part{j}_w.dat', 'w') as fw:
@@ -151,19 +158,28 @@ def pkl2table(prefix, pklfile):
             fx.write('};\n')
             fw.write('};\n')
 
-def generate_table(path):
-    with ProcessPoolExecutor(8) as pe:
+def generate_table(path, parts=(0, 2)):
+    cells = set()
+    for j in parts:
+        u0, u1 = PARTS_UBASE[j]
+        t0, t1 = PARTS_TBASE[j]
+        cells.update((iu, it) for iu in range(u0, u1-1) for it in range(t0, t1-1))
+    with ProcessPoolExecutor(os.cpu_count()) as pe:
         tab = []
         nt = len(TBASE) - 1
         nu = len(UBASE) - 1
-        for nroots in range(1, 6):
+        for nroots in range(1, MAX_NROOTS+1):
             res = []
             for ubase in range(nu):
                 for tbase in range(nt):
-                    print(f'root {nroots}  ubase {ubase}  tbase {tbase}')
-                    fut = pe.submit(tabulate_erfc, nroots, tbase, ubase)
+                    if (ubase, tbase) in cells:
+                        print(f'root {nroots}  ubase {ubase}  tbase {tbase}')
+                        fut = pe.submit(tabulate_erfc, nroots, tbase, ubase)
+                    else:
+                        fut = None
                     res.append(fut)
-            res = [fut.result() for fut in res]
+            zeros = np.zeros((2, nroots, ngrids_u, ngrids))
+            res = [zeros if fut is None else fut.result() for fut in res]
             res = np.array(res, dtype=float)
             res = res.reshape(nu,nt,2,nroots,ngrids_u,ngrids)
             tab.append(res)
@@ -185,5 +201,5 @@ def polyfit_small_x_limits(nroots, x, low=None):
     return pr0, pr1, pw0, pw1
 
 if __name__ == '__main__':
-    #generate_table('sr_rys_rw.pkl')
-    pkl2table('./sr_roots', 'sr_rys_rw.pkl')
+    generate_table('sr_rys_rw.pkl')
+    pkl2table('../src/sr_roots', 'sr_rys_rw.pkl')
@@ -8,6 +8,7 @@ import mpmath
 import numpy as np
 from rys_roots import DECIMALS, rys_roots_weights_partial, rys_roots_weights
 from rys_tabulate import clenshaw_d1, chebyshev_roots, clenshaw_points
+from sr_rys_tabulate import MAX_NROOTS
 mpmath.mp.dps = DECIMALS
 
 ngrids = 14
@@ -150,11 +151,11 @@ def pkl2table(prefix, pklfile):
         fw.write('};\n')
 
 def generate_table(path):
-    with ProcessPoolExecutor(8) as pe:
+    with ProcessPoolExecutor(os.cpu_count()) as pe:
         tab = []
         nt = len(TBASE) - 1
         nu = len(UBASE) - 1
-        for nroots in range(1, 6):
+        for nroots in range(1, MAX_NROOTS+1):
             res = []
             for ubase in range(nu):
                 for tbase in range(nt):
@@ -169,5 +170,5 @@ def generate_table(path):
         pickle.dump((TBASE, UBASE, tab), f)
 
 if __name__ == '__main__':
-    #generate_table('sr_rys_rw_xlarge.pkl')
-    pkl2table('./sr_roots_part3', 'sr_rys_rw_xlarge.pkl')
+    generate_table('sr_rys_rw_xlarge.pkl')
+    pkl2table('../src/sr_roots_part3', 'sr_rys_rw_xlarge.pkl')
@@ -30,7 +30,7 @@ DECLARE(int2e_gauge_r2_##X##_spinor); \
 void int2e_breit_##X##_optimizer(CINTOpt **opt, FINT *atm, FINT natm, \
                                  FINT *bas, FINT nbas, double *env) \
 { \
-        *opt = NULL; \
+        _breit_optimizer(opt, atm, natm, bas, nbas, env); \
 } \
 CACHE_SIZE_T int2e_breit_##X##_spinor(double complex *out, FINT *dims, FINT *shls, \
                              FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env, \
@@ -79,27 +79,65 @@ static void _copy_to_out(double complex *out, double complex *in, FINT *dims, FI
         }
 }
 
+/*
+ * One optimizer is shared by the Gaunt term and the two gauge terms. The
+ * pairdata only depends on the largest of the increments i+j and k+l. It is
+ * 4 for all gauge terms (ng = {2, 2, 0, 1}, {1, 3, 0, 1}, {2, 1, 0, 2}, ...)
+ * and ng = {2, 2, 0, 1} is used, which is conservative for the Gaunt term.
+ * index_xyz differs between the three terms. It is left unassigned and
+ * generated in CINT2e_loop for each call.
+ */
+static void _breit_optimizer(CINTOpt **opt, FINT *atm, FINT natm,
+                             FINT *bas, FINT nbas, double *env)
+{
+        FINT ng[] = {2, 2, 0, 1, 4, 4, 4, 1};
+        FINT i;
+        FINT max_l = 0;
+        for (i = 0; i < nbas; i++) {
+                max_l = MAX(max_l, bas(ANG_OF,i));
+        }
+        CINTinit_2e_optimizer(opt, atm, natm, bas, nbas, env);
+        CINTOpt_setij(*opt, ng, atm, natm, bas, nbas, env);
+        CINTOpt_set_non0coeff(*opt, atm, natm, bas, nbas, env);
+        size_t nidx = (max_l+1) * LMAX1*LMAX1*LMAX1;
+        (*opt)->index_xyz_array = calloc(nidx, sizeof(FINT *));
+}
+
 static CACHE_SIZE_T _int2e_breit_drv(double complex *out, FINT *dims, FINT *shls,
                             FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env,
                             CINTOpt *opt, double *cache, FINT ncomp_tensor,
                             FINT (*f_gaunt)(), FINT (*f_gauge_r1)(), FINT (*f_gauge_r2)())
 {
-        if (out == NULL) {
-                CACHE_SIZE_T cache_size1 = (*f_gauge_r1)(NULL, NULL, shls,
-                                atm, natm, bas, nbas, env, NULL, cache);
-                CACHE_SIZE_T cache_size2 = (*f_gauge_r2)(NULL, NULL, shls,
-                                atm, natm, bas, nbas, env, NULL, cache);
-                return MAX(cache_size1, cache_size2);
-        }
-
         FINT counts[4];
         counts[0] = CINTcgto_spinor(shls[0], bas);
         counts[1] = CINTcgto_spinor(shls[1], bas);
         counts[2] = CINTcgto_spinor(shls[2], bas);
         counts[3] = CINTcgto_spinor(shls[3], bas);
         FINT nop = counts[0] * counts[1] * counts[2] * counts[3] * ncomp_tensor;
-        double complex *buf = malloc(sizeof(double complex) * nop*2);
-        double complex *buf1;
+
+        if (out == NULL || cache == NULL) {
+                CACHE_SIZE_T cache_size0 = (*f_gaunt)(NULL, NULL, shls,
+                                atm, natm, bas, nbas, env, opt, NULL);
+                CACHE_SIZE_T cache_size1 = (*f_gauge_r1)(NULL, NULL, shls,
+                                atm, natm, bas, nbas, env, opt, NULL);
+                CACHE_SIZE_T cache_size2 = (*f_gauge_r2)(NULL, NULL, shls,
+                                atm, natm, bas, nbas, env, opt, NULL);
+                CACHE_SIZE_T cache_size = MAX(cache_size0, MAX(cache_size1, cache_size2))
+                        + nop * 2 * OF_CMPLX;
+                if (out == NULL) {
+                        return cache_size;
+                }
+                // one allocation for the buffers of all three terms
+                double *stack = malloc(sizeof(double) * cache_size);
+                FINT has_value = _int2e_breit_drv(out, dims, shls, atm, natm, bas, nbas,
+                                                  env, opt, stack, ncomp_tensor,
+                                                  f_gaunt, f_gauge_r1, f_gauge_r2);
+                free(stack);
+                return has_value;
+        }
+
+        double complex *buf, *buf1;
+        MALLOC_INSTACK(buf, nop * 2);
         if (dims == NULL) {
                 dims = counts;
                 buf1 = out;
@@ -107,10 +145,10 @@ static CACHE_SIZE_T _int2e_breit_drv(double complex *out, FINT *dims, FINT *shls
                 buf1 = buf + nop;
         }
 
-        FINT has_value = (*f_gaunt)(buf1, NULL, shls, atm, natm, bas, nbas, env, NULL, cache);
+        FINT has_value = (*f_gaunt)(buf1, NULL, shls, atm, natm, bas, nbas, env, opt, cache);
 
         FINT i;
-        has_value = ((*f_gauge_r1)(buf, NULL, shls, atm, natm, bas, nbas, env, NULL, cache) ||
+        has_value = ((*f_gauge_r1)(buf, NULL, shls, atm, natm, bas, nbas, env, opt, cache) ||
                      has_value);
         /* [1/2 gaunt] - [1/2 xxx*\sigma1\dot r1] */
         if (has_value) {
@@ -119,7 +157,7 @@ static CACHE_SIZE_T _int2e_breit_drv(double complex *out, FINT *dims, FINT *shls
                 }
         }
         /* ... [- 1/2 xxx*\sigma1\dot(-r2)] */
-        has_value = ((*f_gauge_r2)(buf, NULL, shls, atm, natm, bas, nbas, env, NULL, cache) ||
+        has_value = ((*f_gauge_r2)(buf, NULL, shls, atm, natm, bas, nbas, env, opt, cache) ||
                      has_value);
         if (has_value) {
                 for (i = 0; i < nop; i++) {
@@ -127,7 +165,6 @@ static CACHE_SIZE_T _int2e_breit_drv(double complex *out, FINT *dims, FINT *shls
                 }
         }
         _copy_to_out(out, buf1, dims, counts);
-        free(buf);
         return has_value;
 }
 
@@ -56,9 +56,23 @@ FINT c##NAME##_(double *out, FINT *shls, FINT *atm, FINT *natm, \
                              atm, *natm, bas, *nbas, env, NULL, NULL); \
 }
 
+#define ALL_CINT_SPINOR_FORTRAN_(NAME) \
+FINT c##NAME##_(double *out, FINT *shls, FINT *atm, FINT *natm, \
+                FINT *bas, FINT *nbas, double *env, size_t optptr_as_integer8) { \
+        CINTOpt **opt = (CINTOpt **)optptr_as_integer8; \
+        return NAME##_spinor((double complex *)out, NULL, shls, \
+                             atm, *natm, bas, *nbas, env, *opt, NULL); \
+} \
+void c##NAME##_optimizer_(size_t optptr_as_integer8, FINT *atm, FINT *natm, \
+                         FINT *bas, FINT *nbas, double *env) { \
+        CINTOpt **opt = (CINTOpt **)optptr_as_integer8; \
+        NAME##_optimizer(opt, atm, *natm, bas, *nbas, env); \
+}
+
 #else
 
 #define ALL_CINT_FORTRAN_(NAME)
 #define ALL_CINT1E_FORTRAN_(NAME)
+#define ALL_CINT_SPINOR_FORTRAN_(NAME)
 
 #endif
@@ -5847,6 +5847,285 @@ void c2s_si_2e2i(double complex *fijkl, double *opij, FINT *dims,
         } } } }
 }
 
+/*
+ * Identify the pair of spinor transformations for electron 1 and electron 2.
+ * Returns -1 if they cannot be handled by c2s_2e_spinor
+ */
+FINT c2s_2e_spinor_type(void (*f_e1_c2s)(), void (*f_e2_c2s)())
+{
+        FINT c2s_type;
+        if (f_e1_c2s == &c2s_sf_2e1) {
+                c2s_type = 0;
+        } else if (f_e1_c2s == &c2s_sf_2e1i) {
+                c2s_type = C2S_E1_I;
+        } else if (f_e1_c2s == &c2s_si_2e1) {
+                c2s_type = C2S_E1_SI;
+        } else if (f_e1_c2s == &c2s_si_2e1i) {
+                c2s_type = C2S_E1_SI | C2S_E1_I;
+        } else {
+                return -1;
+        }
+        if (f_e2_c2s == &c2s_sf_2e2) {
+        } else if (f_e2_c2s == &c2s_sf_2e2i) {
+                c2s_type |= C2S_E2_I;
+        } else if (f_e2_c2s == &c2s_si_2e2) {
+                c2s_type |= C2S_E2_SI;
+        } else if (f_e2_c2s == &c2s_si_2e2i) {
+                c2s_type |= C2S_E2_SI | C2S_E2_I;
+        } else {
+                return -1;
+        }
+        return c2s_type;
+}
+
+/*
+ * Time reversal partner within a spinor shell.  For the spinor r of a shell,
+ * T|r> = phase * |partner>.  Spinors of each j block are ordered by m = -j..j
+ * and T|j,m> = (-1)^(l+j-m) |j,-m>.  Returns the index of r in the Kramers
+ * unique (m > 0) half, or -1 if r belongs to the barred (m < 0) half.
+ */
+static FINT _kramers_partner(FINT *partner, double *phase, FINT r, FINT kappa, FINT l)
+{
+        FINT b0 = 0;
+        FINT nu0 = 0;
+        FINT n;
+        if (kappa < 0) {
+                n = l * 2 + 2;
+        } else if (kappa > 0 || r < l * 2) {
+                n = l * 2;
+        } else { // kappa == 0, j = l + 1/2
+                b0 = l * 2;
+                nu0 = l;
+                n = l * 2 + 2;
+        }
+        FINT m = r - b0;
+        *partner = b0 + n - 1 - m;
+        *phase = ((l + n - 1 - m) & 1) ? -1 : 1;
+        if (m * 2 >= n) {
+                return nu0 + m - n / 2;
+        } else {
+                return -1;
+        }
+}
+
+/* Drop the rows of the barred spinors, gsp[a/b][nket][nd] -> gsp[a/b][nket][nd/2] */
+static void _kramers_compact(double *gspR, double *gspI, FINT nket, FINT kappa, FINT l)
+{
+        FINT nd = _len_spinor(kappa, l);
+        FINT nu = nd / 2;
+        FINT rows[ANG_MAX*2+1];
+        FINT i, j, partner;
+        double phase;
+        for (i = 0; i < nd; i++) {
+                j = _kramers_partner(&partner, &phase, i, kappa, l);
+                if (j >= 0) {
+                        rows[j] = i;
+                }
+        }
+        for (j = 0; j < nket * 2; j++) {
+                for (i = 0; i < nu; i++) {
+                        gspR[j*nu+i] = gspR[j*nd+rows[i]];
+                        gspI[j*nu+i] = gspI[j*nd+rows[i]];
+                }
+        }
+}
+
+/*
+ * 2e integrals, cartesian to spinor for both electrons.
+ *
+ * Equivalent to calling f_e1_c2s for all ncomp_e2 components then f_e2_c2s.
+ * The two electrons are transformed for one contraction block (ic,jc,kc,lc)
+ * at a time. Only the partially transformed integrals of one block, of size
+ * ncomp_e2 * di*nfk*nfl*dj, are held in cache.
+ *
+ * gctr: Cartesian GTO integrals of one tensor component, ordered as
+ *       gctr[ncomp_e2][ncomp_e1][lc,kc,jc,ic][nf]
+ *
+ * With C2S_KRAMERS, only the Kramers unique half of the spinors of shell i
+ * are generated.  The other half follows from time reversal symmetry, see
+ * CINTc2s_kramers_2e.
+ */
+void c2s_2e_spinor(double complex *fijkl, double *gctr, FINT *dims,
+                   CINTEnvVars *envs, double *cache, FINT c2s_type)
+{
+        FINT *shls = envs->shls;
+        FINT *bas = envs->bas;
+        FINT i_sh = shls[0];
+        FINT j_sh = shls[1];
+        FINT k_sh = shls[2];
+        FINT l_sh = shls[3];
+        FINT i_l = envs->i_l;
+        FINT j_l = envs->j_l;
+        FINT k_l = envs->k_l;
+        FINT l_l = envs->l_l;
+        FINT i_kp = bas(KAPPA_OF, i_sh);
+        FINT j_kp = bas(KAPPA_OF, j_sh);
+        FINT k_kp = bas(KAPPA_OF, k_sh);
+        FINT l_kp = bas(KAPPA_OF, l_sh);
+        FINT i_ctr = envs->x_ctr[0];
+        FINT j_ctr = envs->x_ctr[1];
+        FINT k_ctr = envs->x_ctr[2];
+        FINT l_ctr = envs->x_ctr[3];
+        FINT di = _len_spinor(i_kp, i_l);
+        FINT dj = _len_spinor(j_kp, j_l);
+        FINT dk = _len_spinor(k_kp, k_l);
+        FINT dl = _len_spinor(l_kp, l_l);
+        FINT di_full = di;
+        if (c2s_type & C2S_KRAMERS) {
+                di /= 2;
+        }
+        FINT ni = dims[0];
+        FINT nj = dims[1];
+        FINT nk = dims[2];
+        FINT nl = dims[3];
+        FINT nfj = envs->nfj;
+        FINT nfk = envs->nfk;
+        FINT nfl = envs->nfl;
+        FINT nf = envs->nf;
+        FINT nop = di * nfk * nfl * dj;
+        FINT d_i = di * nfk * nfl;
+        FINT d_j = nfk * nfl * nfj;
+        FINT ofj = ni * dj;
+        FINT ofk = ni * nj * dk;
+        FINT ofl = ni * nj * nk * dl;
+        size_t nc = (size_t)nf * i_ctr * j_ctr * k_ctr * l_ctr;
+        FINT ncomp_e1 = envs->ncomp_e1;
+        FINT ncomp_e2 = envs->ncomp_e2;
+        FINT ic, jc, kc, lc, m;
+        FINT len1 = MAX(di_full * nfk * nfl * nfj * 2, di * dk * nfl * 2 * dj);
+        FINT len2 = di * dk * dl * dj;
+        double *opij, *tmp1R, *tmp1I, *tmp2R, *tmp2I;
+        MALLOC_INSTACK(opij, nop * OF_CMPLX * ncomp_e2);
+        MALLOC_INSTACK(tmp1R, len1);
+        MALLOC_INSTACK(tmp1I, len1);
+        MALLOC_INSTACK(tmp2R, len2);
+        MALLOC_INSTACK(tmp2I, len2);
+        double *ox = opij;
+        double *oy = ox + nop * OF_CMPLX;
+        double *oz = oy + nop * OF_CMPLX;
+        double *o1 = oz + nop * OF_CMPLX;
+        double *pgctr, *gc;
+        double complex *pfijkl;
+
+        pgctr = gctr;
+        for (lc = 0; lc < l_ctr; lc++) {
+        for (kc = 0; kc < k_ctr; kc++) {
+        for (jc = 0; jc < j_ctr; jc++) {
+        for (ic = 0; ic < i_ctr; ic++) {
+                for (m = 0; m < ncomp_e2; m++) {
+                        gc = pgctr + nc * ncomp_e1 * m;
+                        if (c2s_type & C2S_E1_SI) {
+                                a_bra_cart2spinor_si(tmp1R, tmp1I, gc, gc+nc, gc+nc*2,
+                                                     gc+nc*3, d_j, i_kp, i_l);
+                        } else {
+                                a_bra_cart2spinor_sf(tmp1R, tmp1I, NULL, NULL, NULL,
+                                                     gc, d_j, i_kp, i_l);
+                        }
+                        if (c2s_type & C2S_KRAMERS) {
+                                _kramers_compact(tmp1R, tmp1I, d_j, i_kp, i_l);
+                        }
+                        gc = opij + nop * OF_CMPLX * m;
+                        if (c2s_type & C2S_E1_I) {
+                                a_iket_cart2spinor(gc, gc+nop, tmp1R, tmp1I, d_i, j_kp, j_l);
+                        } else {
+                                a_ket_cart2spinor(gc, gc+nop, tmp1R, tmp1I, d_i, j_kp, j_l);
+                        }
+                }
+
+                if (c2s_type & C2S_E2_SI) {
+                        a_bra1_cart2spinor_zi(tmp1R, tmp1I, ox, oy, oz, o1,
+                                              di, nfl*dj, k_kp, k_l);
+                } else {
+                        a_bra1_cart2spinor_zf(tmp1R, tmp1I, NULL, NULL, NULL, ox,
+                                              di, nfl*dj, k_kp, k_l);
+                }
+                if (c2s_type & C2S_E2_I) {
+                        a_iket1_cart2spinor(tmp2R, tmp2I, tmp1R, tmp1I, di*dk, dj, l_kp, l_l);
+                } else {
+                        a_ket1_cart2spinor(tmp2R, tmp2I, tmp1R, tmp1I, di*dk, dj, l_kp, l_l);
+                }
+                pfijkl = fijkl + (ofl * lc + ofk * kc + ofj * jc + di * ic);
+                zcopy_iklj(pfijkl, tmp2R, tmp2I, ni, nj, nk, nl, di, dj, dk, dl);
+                pgctr += nf;
+        } } } }
+}
+
+static void _kramers_shell_map(FINT *partner, FINT *unique, double *phase,
+                               FINT sh, FINT *bas)
+{
+        FINT l = bas(ANG_OF, sh);
+        FINT kappa = bas(KAPPA_OF, sh);
+        FINT nctr = bas(NCTR_OF, sh);
+        FINT d = _len_spinor(kappa, l);
+        FINT ic, r, p, u;
+        for (ic = 0; ic < nctr; ic++) {
+                for (r = 0; r < d; r++) {
+                        u = _kramers_partner(&p, phase+ic*d+r, r, kappa, l);
+                        partner[ic*d+r] = ic * d + p;
+                        if (u >= 0) {
+                                unique[ic*d+r] = ic * d / 2 + u;
+                        } else {
+                                unique[ic*d+r] = -1;
+                        }
+                }
+        }
+}
+
+/*
+ * Reconstruct the full spinor integrals out[l,k,j,i] of the shell quartet
+ * shls from the Kramers unique integrals kr[l,k,j,i/2] generated by the
+ * *_kr_spinor functions.  For the time-reversal symmetric operators
+ *      (ib j|k l) = phase(i) phase(jb) phase(kb) phase(lb) (i jb|kb lb)^*
+ * where ib is the Kramers partner of i and T|i> = phase(i) |ib>.
+ */
+void CINTc2s_kramers_2e(double complex *out, double complex *kr, FINT *shls, FINT *bas)
+{
+        FINT ni = CINTcgto_spinor(shls[0], bas);
+        FINT nj = CINTcgto_spinor(shls[1], bas);
+        FINT nk = CINTcgto_spinor(shls[2], bas);
+        FINT nl = CINTcgto_spinor(shls[3], bas);
+        FINT niu = ni / 2;
+        FINT ntot = ni + nj + nk + nl;
+        FINT *partner = malloc(sizeof(FINT) * ntot * 2);
+        FINT *unique = partner + ntot;
+        double *phase = malloc(sizeof(double) * ntot);
+        FINT *ipart = partner;
+        FINT *jpart = ipart + ni;
+        FINT *kpart = jpart + nj;
+        FINT *lpart = kpart + nk;
+        double *iph = phase;
+        double *jph = iph + ni;
+        double *kph = jph + nj;
+        double *lph = kph + nk;
+        _kramers_shell_map(ipart, unique        , iph, shls[0], bas);
+        _kramers_shell_map(jpart, unique+ni     , jph, shls[1], bas);
+        _kramers_shell_map(kpart, unique+ni+nj  , kph, shls[2], bas);
+        _kramers_shell_map(lpart, unique+ni+nj+nk, lph, shls[3], bas);
+
+        FINT i, j, k, l, ip, jp, kp, lp;
+        double fac;
+        for (l = 0; l < nl; l++) {
+        for (k = 0; k < nk; k++) {
+        for (j = 0; j < nj; j++) {
+                jp = jpart[j];
+                kp = kpart[k];
+                lp = lpart[l];
+                fac = jph[jp] * kph[kp] * lph[lp];
+                for (i = 0; i < ni; i++) {
+                        if (unique[i] >= 0) {
+                                out[i] = kr[unique[i] + niu*(j+nj*(k+nk*l))];
+                        } else {
+                                ip = ipart[i];
+                                out[i] = iph[ip] * fac
+                                       * conj(kr[unique[ip] + niu*(jp+nj*(kp+nk*lp))]);
+                        }
+                }
+                out += ni;
+        } } }
+        free(partner);
+        free(phase);
+}
+
 /*
  * 1e integrals, reorder cartesian integrals.
  */
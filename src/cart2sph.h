@@ -46,6 +46,16 @@ void c2s_si_2e1i(double *opij, double *gctr, FINT *dims, CINTEnvVars *envs, doub
 void c2s_si_2e2(double complex *fijkl, double *opij, FINT *dims, CINTEnvVars *envs, double *cache);
 void c2s_si_2e2i(double complex *fijkl, double *opij, FINT *dims, CINTEnvVars *envs, double *cache);
 
+// flags of c2s_2e_spinor
+#define C2S_E1_SI       1
+#define C2S_E1_I        2
+#define C2S_E2_SI       4
+#define C2S_E2_I        8
+#define C2S_KRAMERS     16
+FINT c2s_2e_spinor_type(void (*f_e1_c2s)(), void (*f_e2_c2s)());
+void c2s_2e_spinor(double complex *fijkl, double *gctr, FINT *dims,
+                   CINTEnvVars *envs, double *cache, FINT c2s_type);
+
 void c2s_sph_3c2e1(double *fijkl, double *gctr, FINT *dims, CINTEnvVars *envs, double *cache);
 void c2s_cart_3c2e1(double *fijkl, double *gctr, FINT *dims, CINTEnvVars *envs, double *cache);
 void c2s_sph_3c2e1_ssc(double *fijkl, double *gctr, FINT *dims, CINTEnvVars *envs, double *cache);
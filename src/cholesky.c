@@ -0,0 +1,354 @@
+/*
+ * Pivoted Cholesky decomposition of the ERI matrix
+ *
+ *      (ij|kl) ~= sum_n L[n,ij] L[n,kl]
+ *
+ * over the AO pairs i >= j. The diagonals (ij|ij) are taken from one quartet
+ * (IJ|IJ) per shell pair. The pivots are selected shell pair by shell pair:
+ * the shell pair KL holding the largest residual diagonal provides all its
+ * AO pairs above a fraction of that diagonal as candidates, and the columns
+ * (ij|kl) of the candidates are evaluated in one loop over the shell pairs
+ * IJ with KL fixed, so that the pair data of KL in the optimizer are reused
+ * by every quartet of the batch. The Cholesky vectors of the candidates are
+ * then generated from these columns until none of them is qualified.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include "cint_bas.h"
+#include "optimizer.h"
+#include "misc.h"
+
+// the AO pairs of a batch are qualified down to CHOLESKY_SPAN * the largest
+// residual diagonal
+#define CHOLESKY_SPAN   1e-2
+
+CACHE_SIZE_T int2e_sph(double *out, FINT *dims, FINT *shls, FINT *atm, FINT natm,
+                       FINT *bas, FINT nbas, double *env, CINTOpt *opt, double *cache);
+CACHE_SIZE_T int2e_cart(double *out, FINT *dims, FINT *shls, FINT *atm, FINT natm,
+                        FINT *bas, FINT nbas, double *env, CINTOpt *opt, double *cache);
+void int2e_optimizer(CINTOpt **opt, FINT *atm, FINT natm,
+                     FINT *bas, FINT nbas, double *env);
+
+typedef struct {
+        CACHE_SIZE_T (*intor)();
+        FINT *atm;
+        FINT natm;
+        FINT *bas;
+        FINT nbas;
+        double *env;
+        CINTOpt *opt;
+        FINT *ao_loc;
+        double *buf;
+        double *cache;
+        size_t cache_size;
+} CholeskyEnvs;
+
+// index of the AO pair i >= j in the packed lower triangle
+#define PAIR_INDEX(i, j)        ((size_t)(i)*((i)+1)/2 + (j))
+
+static FINT _quartet(CholeskyEnvs *cenvs, FINT *shls)
+{
+        size_t cache_size = (*cenvs->intor)(NULL, NULL, shls, cenvs->atm, cenvs->natm,
+                                            cenvs->bas, cenvs->nbas, cenvs->env,
+                                            cenvs->opt, NULL);
+        if (cache_size > cenvs->cache_size) {
+                free(cenvs->cache);
+                cenvs->cache = malloc(sizeof(double) * cache_size);
+                cenvs->cache_size = cache_size;
+        }
+        return (*cenvs->intor)(cenvs->buf, NULL, shls, cenvs->atm, cenvs->natm,
+                               cenvs->bas, cenvs->nbas, cenvs->env,
+                               cenvs->opt, cenvs->cache);
+}
+
+/*
+ * diag[ij] = (ij|ij) for the AO pairs i >= j, and its max over each shell
+ * pair in qmax[I*nbas+J]
+ */
+static void _diagonal(double *diag, double *qmax, CholeskyEnvs *cenvs)
+{
+        FINT nbas = cenvs->nbas;
+        FINT *ao_loc = cenvs->ao_loc;
+        double *buf = cenvs->buf;
+        FINT shls[4];
+        FINT ish, jsh, i, j, i0, j0, di, dj, nij;
+        double v;
+        for (ish = 0; ish < nbas; ish++) {
+        for (jsh = 0; jsh <= ish; jsh++) {
+                i0 = ao_loc[ish];
+                j0 = ao_loc[jsh];
+                di = ao_loc[ish+1] - i0;
+                dj = ao_loc[jsh+1] - j0;
+                nij = di * dj;
+                shls[0] = ish;
+                shls[1] = jsh;
+                shls[2] = ish;
+                shls[3] = jsh;
+                qmax[ish*nbas+jsh] = 0;
+                if (!_quartet(cenvs, shls)) {
+                        CINTdset0(nij, buf);
+                }
+                for (j = 0; j < dj; j++) {
+                for (i = 0; i < di; i++) {
+                        if (i0+i < j0+j) {
+                                continue;
+                        }
+                        v = buf[(i+di*j) * (nij+1)];
+                        diag[PAIR_INDEX(i0+i, j0+j)] = v;
+                        qmax[ish*nbas+jsh] = MAX(qmax[ish*nbas+jsh], v);
+                } }
+        } }
+}
+
+/*
+ * cols[n,ij] = (ij|kl) of the AO pairs kl = pivots[n] of the shell pair
+ * (ksh,lsh), skipping the shell pairs IJ screened out by qmax
+ */
+static void _columns(double *cols, FINT *pivots, FINT npiv, FINT ksh, FINT lsh,
+                     double *qmax, size_t npair, CholeskyEnvs *cenvs)
+{
+        FINT nbas = cenvs->nbas;
+        FINT *ao_loc = cenvs->ao_loc;
+        double *buf = cenvs->buf;
+        FINT dk = ao_loc[ksh+1] - ao_loc[ksh];
+        FINT shls[4];
+        FINT ish, jsh, i, j, n, i0, j0, di, dj, k, l;
+        double *col, *pbuf;
+        CINTdset0(npair * npiv, cols);
+        shls[2] = ksh;
+        shls[3] = lsh;
+        for (ish = 0; ish < nbas; ish++) {
+        for (jsh = 0; jsh <= ish; jsh++) {
+                if (qmax[ish*nbas+jsh] == 0) {
+                        continue;
+                }
+                shls[0] = ish;
+                shls[1] = jsh;
+                if (!_quartet(cenvs, shls)) {
+                        continue;
+                }
+                i0 = ao_loc[ish];
+                j0 = ao_loc[jsh];
+                di = ao_loc[ish+1] - i0;
+                dj = ao_loc[jsh+1] - j0;
+                for (n = 0; n < npiv; n++) {
+                        k = pivots[n] % dk;
+                        l = pivots[n] / dk;
+                        col = cols + n * npair;
+                        pbuf = buf + (size_t)di * dj * (k + dk * l);
+                        for (j = 0; j < dj; j++) {
+                        for (i = 0; i < di; i++) {
+                                if (i0+i >= j0+j) {
+                                        col[PAIR_INDEX(i0+i, j0+j)] = pbuf[i+di*j];
+                                }
+                        } }
+                }
+        } }
+}
+
+static FINT _cholesky_eri(double *cderi, FINT max_vec, double threshold,
+                          FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env,
+                          CINTOpt *opt, CACHE_SIZE_T (*intor)(), FINT *ao_loc)
+{
+        FINT nao = ao_loc[nbas];
+        size_t npair = PAIR_INDEX(nao, 0);
+        CINTOpt *opt0 = NULL;
+        if (opt == NULL) {
+                int2e_optimizer(&opt0, atm, natm, bas, nbas, env);
+                opt = opt0;
+        }
+
+        FINT ish, jsh, i, j, n, m, i0, j0, di, dj;
+        FINT dmax = 0;
+        for (ish = 0; ish < nbas; ish++) {
+                dmax = MAX(dmax, ao_loc[ish+1] - ao_loc[ish]);
+        }
+        CholeskyEnvs cenvs;
+        cenvs.intor = intor;
+        cenvs.atm = atm;
+        cenvs.natm = natm;
+        cenvs.bas = bas;
+        cenvs.nbas = nbas;
+        cenvs.env = env;
+        cenvs.opt = opt;
+        cenvs.ao_loc = ao_loc;
+        cenvs.buf = malloc(sizeof(double) * dmax*dmax*dmax*dmax);
+        cenvs.cache = NULL;
+        cenvs.cache_size = 0;
+
+        double *diag = malloc(sizeof(double) * npair);
+        double *qmax = malloc(sizeof(double) * nbas * nbas);
+        _diagonal(diag, qmax, &cenvs);
+
+        // The shell pairs with (ij|ij) * max(kl|kl) < threshold^2 do not
+        // contribute to the decomposition
+        double vmax = 0;
+        for (ish = 0; ish < nbas; ish++) {
+                for (jsh = 0; jsh <= ish; jsh++) {
+                        vmax = MAX(vmax, qmax[ish*nbas+jsh]);
+                }
+        }
+        for (ish = 0; ish < nbas; ish++) {
+        for (jsh = 0; jsh <= ish; jsh++) {
+                if (qmax[ish*nbas+jsh] * vmax >= threshold * threshold) {
+                        continue;
+                }
+                qmax[ish*nbas+jsh] = 0;
+                i0 = ao_loc[ish];
+                j0 = ao_loc[jsh];
+                di = ao_loc[ish+1] - i0;
+                dj = ao_loc[jsh+1] - j0;
+                for (i = i0; i < i0+di; i++) {
+                for (j = j0; j < MIN(j0+dj, i+1); j++) {
+                        diag[PAIR_INDEX(i, j)] = 0;
+                } }
+        } }
+
+        FINT *pivots = malloc(sizeof(FINT) * dmax * dmax * 2);
+        size_t *pivot_idx = (size_t *)malloc(sizeof(size_t) * dmax * dmax);
+        FINT *done = pivots + dmax * dmax;
+        double *cols = malloc(sizeof(double) * npair * dmax * dmax);
+        FINT nvec = 0;
+        FINT npiv, ksh, lsh, k0, l0, dk, dl, k, l, ipiv;
+        size_t kl, p, pmax;
+        double qual, fac, *col, *vec;
+
+        while (nvec < max_vec) {
+                pmax = 0;
+                for (p = 1; p < npair; p++) {
+                        if (diag[p] > diag[pmax]) {
+                                pmax = p;
+                        }
+                }
+                if (diag[pmax] <= threshold) {
+                        break;
+                }
+                qual = MAX(threshold, diag[pmax] * CHOLESKY_SPAN);
+
+                // the shell pair of the largest diagonal
+                for (k = 0; PAIR_INDEX(k+1, 0) <= pmax; k++);
+                l = pmax - PAIR_INDEX(k, 0);
+                for (ksh = 0; ao_loc[ksh+1] <= k; ksh++);
+                for (lsh = 0; ao_loc[lsh+1] <= l; lsh++);
+                k0 = ao_loc[ksh];
+                l0 = ao_loc[lsh];
+                dk = ao_loc[ksh+1] - k0;
+                dl = ao_loc[lsh+1] - l0;
+                npiv = 0;
+                for (l = 0; l < dl; l++) {
+                for (k = 0; k < dk; k++) {
+                        if (k0+k < l0+l) {
+                                continue;
+                        }
+                        kl = PAIR_INDEX(k0+k, l0+l);
+                        if (diag[kl] > qual) {
+                                pivots[npiv] = k + dk * l;
+                                pivot_idx[npiv] = kl;
+                                done[npiv] = 0;
+                                npiv++;
+                        }
+                } }
+
+                // the columns of the batch with the previous vectors
+                // subtracted
+                _columns(cols, pivots, npiv, ksh, lsh, qmax, npair, &cenvs);
+                for (n = 0; n < npiv; n++) {
+                        col = cols + n * npair;
+                        for (m = 0; m < nvec; m++) {
+                                vec = cderi + m * npair;
+                                fac = vec[pivot_idx[n]];
+                                if (fac != 0) {
+                                        for (p = 0; p < npair; p++) {
+                                                col[p] -= vec[p] * fac;
+                                        }
+                                }
+                        }
+                }
+
+                while (nvec < max_vec) {
+                        ipiv = -1;
+                        for (n = 0; n < npiv; n++) {
+                                if (!done[n] && diag[pivot_idx[n]] > qual &&
+                                    (ipiv < 0 || diag[pivot_idx[n]] > diag[pivot_idx[ipiv]])) {
+                                        ipiv = n;
+                                }
+                        }
+                        if (ipiv < 0) {
+                                break;
+                        }
+                        done[ipiv] = 1;
+                        vec = cderi + nvec * npair;
+                        col = cols + ipiv * npair;
+                        fac = 1. / sqrt(diag[pivot_idx[ipiv]]);
+                        for (p = 0; p < npair; p++) {
+                                vec[p] = col[p] * fac;
+                                diag[p] -= vec[p] * vec[p];
+                        }
+                        diag[pivot_idx[ipiv]] = 0;
+                        nvec++;
+                        for (n = 0; n < npiv; n++) {
+                                if (done[n]) {
+                                        continue;
+                                }
+                                col = cols + n * npair;
+                                fac = vec[pivot_idx[n]];
+                                for (p = 0; p < npair; p++) {
+                                        col[p] -= vec[p] * fac;
+                                }
+                        }
+                }
+        }
+
+        if (nvec == max_vec) {
+                pmax = 0;
+                for (p = 1; p < npair; p++) {
+                        if (diag[p] > diag[pmax]) {
+                                pmax = p;
+                        }
+                }
+                if (diag[pmax] > threshold) {
+                        fprintf(stderr, "CINTcholesky_eri: not converged with max_vec = %d. "
+                                "Residual diagonal %g\n", (int)max_vec, diag[pmax]);
+                }
+        }
+
+        free(cols);
+        free(pivot_idx);
+        free(pivots);
+        free(qmax);
+        free(diag);
+        free(cenvs.cache);
+        free(cenvs.buf);
+        if (opt0 != NULL) {
+                CINTdel_optimizer(&opt0);
+        }
+        return nvec;
+}
+
+FINT CINTcholesky_eri_sph(double *cderi, FINT max_vec, double threshold,
+                          FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env,
+                          CINTOpt *opt)
+{
+        FINT *ao_loc = malloc(sizeof(FINT) * (nbas+1));
+        CINTshells_spheric_offset(ao_loc, bas, nbas);
+        ao_loc[nbas] = CINTtot_cgto_spheric(bas, nbas);
+        FINT nvec = _cholesky_eri(cderi, max_vec, threshold, atm, natm, bas, nbas,
+                                  env, opt, &int2e_sph, ao_loc);
+        free(ao_loc);
+        return nvec;
+}
+
+FINT CINTcholesky_eri_cart(double *cderi, FINT max_vec, double threshold,
+                           FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env,
+                           CINTOpt *opt)
+{
+        FINT *ao_loc = malloc(sizeof(FINT) * (nbas+1));
+        CINTshells_cart_offset(ao_loc, bas, nbas);
+        ao_loc[nbas] = CINTtot_cgto_cart(bas, nbas);
+        FINT nvec = _cholesky_eri(cderi, max_vec, threshold, atm, natm, bas, nbas,
+                                  env, opt, &int2e_cart, ao_loc);
+        free(ao_loc);
+        return nvec;
+}
@@ -281,6 +281,214 @@ CACHE_SIZE_T CINT1e_spinor_drv(double complex *out, FINT *dims, CINTEnvVars *env
         return has_value;
 }
 
+/*
+ * Upper bound of |rj+L-ri| for which CINTset_pairdata keeps any primitive
+ * pair. For the most diffuse pair a2 = ai*aj/(ai+aj), the pairs are dropped
+ * when a2*d^2 - lij*log(d+1) > expcutoff + log_rr0 + log(max(ci*cj)), and
+ * log(d+1) < d
+ */
+static double _1e_lattice_rmax(CINTEnvVars *envs, double rcut)
+{
+        FINT *shls = envs->shls;
+        FINT *bas = envs->bas;
+        double *env = envs->env;
+        FINT i_prim = bas(NPRIM_OF, shls[0]);
+        FINT j_prim = bas(NPRIM_OF, shls[1]);
+        FINT i_ctr = envs->x_ctr[0];
+        FINT j_ctr = envs->x_ctr[1];
+        double *ai = env + bas(PTR_EXP, shls[0]);
+        double *aj = env + bas(PTR_EXP, shls[1]);
+        double *ci = env + bas(PTR_COEFF, shls[0]);
+        double *cj = env + bas(PTR_COEFF, shls[1]);
+        double ai_min = ai[0];
+        double aj_min = aj[0];
+        double ci_max = 0;
+        double cj_max = 0;
+        FINT n;
+        for (n = 0; n < i_prim; n++) {
+                ai_min = MIN(ai_min, ai[n]);
+        }
+        for (n = 0; n < j_prim; n++) {
+                aj_min = MIN(aj_min, aj[n]);
+        }
+        for (n = 0; n < i_prim*i_ctr; n++) {
+                ci_max = MAX(ci_max, fabs(ci[n]));
+        }
+        for (n = 0; n < j_prim*j_ctr; n++) {
+                cj_max = MAX(cj_max, fabs(cj[n]));
+        }
+        if (ci_max == 0 || cj_max == 0) {
+                return 0;
+        }
+        double a2 = ai_min * aj_min / (ai_min + aj_min);
+        double lij = envs->li_ceil + envs->lj_ceil;
+        double c = envs->expcutoff + 1.7 - 1.5 * log(ai[i_prim-1] + aj[j_prim-1])
+                 + log(ci_max * cj_max);
+        if (env[PTR_RANGE_OMEGA] < 0) {
+                c += lij * 8.;
+        }
+        if (c <= 0) {
+                return MIN(rcut, lij / a2);
+        }
+        return MIN(rcut, (lij + sqrt(lij * lij + 4 * a2 * c)) / (2 * a2));
+}
+
+static void _1e_shift_rj(CINTEnvVars *envs, double *rj)
+{
+        envs->rj = rj;
+        if (envs->li_ceil > envs->lj_ceil) {
+                envs->rirj[0] = envs->ri[0] - rj[0];
+                envs->rirj[1] = envs->ri[1] - rj[1];
+                envs->rirj[2] = envs->ri[2] - rj[2];
+        } else {
+                envs->rirj[0] = rj[0] - envs->ri[0];
+                envs->rirj[1] = rj[1] - envs->ri[1];
+                envs->rirj[2] = rj[2] - envs->ri[2];
+        }
+}
+
+/*
+ * 1e integrals summed over the lattice images of shell j
+ *      out[i,j] = \sum_L exp(i k.L) <i|O|j(r-L)>
+ * lattice[3][3] holds the lattice vectors (one vector per row), rcut is the
+ * largest distance between ri and the images of rj. When kpts is NULL, the
+ * real-space sum (k = 0) is written in out. Otherwise out is a double complex
+ * array [nkpts,comp,dims[1],dims[0]] for the k-points kpts[nkpts,3]. The
+ * EnvVars are initialized once, only rj is moved to the images. The nuclei
+ * of INT1E_TYPE_NUC are the atoms in atm, they are not translated.
+ */
+CACHE_SIZE_T CINT1e_lattice_drv(double *out, FINT *dims, CINTEnvVars *envs,
+                                double *cache, void (*f_c2s)(), FINT int1e_type,
+                                double *lattice, double rcut, double *kpts, FINT nkpts)
+{
+        FINT *x_ctr = envs->x_ctr;
+        FINT nc = envs->nf * x_ctr[0] * x_ctr[1];
+        FINT n_comp = envs->ncomp_e1 * envs->ncomp_tensor;
+        FINT nkpts_or_1 = (kpts == NULL) ? 1 : nkpts;
+        double rmax = _1e_lattice_rmax(envs, rcut);
+        size_t nimgs_max = CINTlattice_translations(NULL, lattice, NULL, rmax);
+        FINT counts[4];
+        if (f_c2s == &c2s_sph_1e) {
+                counts[0] = (envs->i_l*2+1) * x_ctr[0];
+                counts[1] = (envs->j_l*2+1) * x_ctr[1];
+        } else {
+                counts[0] = envs->nfi * x_ctr[0];
+                counts[1] = envs->nfj * x_ctr[1];
+        }
+        counts[2] = 1;
+        counts[3] = 1;
+        size_t nout0 = counts[0] * counts[1];
+        // Ls, the integrals of one image, the sum over images (real and
+        // imaginary parts) and the real and imaginary parts of c2s
+        size_t cache_size = int1e_cache_size(envs) + nimgs_max * 3
+                + nc*n_comp * (1 + nkpts_or_1 * 2) + nout0 * 2 + 8;
+        if (out == NULL) {
+                return cache_size;
+        }
+        double *stack = NULL;
+        if (cache == NULL) {
+                stack = malloc(sizeof(double)*cache_size);
+                cache = stack;
+        }
+        double *Ls, *gctr, *gsum;
+        MALLOC_INSTACK(Ls, nimgs_max * 3);
+        MALLOC_INSTACK(gctr, nc*n_comp);
+        MALLOC_INSTACK(gsum, nc*n_comp * nkpts_or_1 * 2);
+
+        double *ri = envs->ri;
+        double *rj0 = envs->rj;
+        double r0[3];
+        r0[0] = rj0[0] - ri[0];
+        r0[1] = rj0[1] - ri[1];
+        r0[2] = rj0[2] - ri[2];
+        FINT nimgs = CINTlattice_translations(Ls, lattice, r0, rmax);
+
+        double rj[3];
+        double kL, cos_kL, sin_kL;
+        double *gre, *gim;
+        size_t ngsum = nc * n_comp;
+        size_t i;
+        FINT n, k;
+        FINT has_value = 0;
+        for (n = 0; n < nimgs; n++) {
+                rj[0] = rj0[0] + Ls[n*3+0];
+                rj[1] = rj0[1] + Ls[n*3+1];
+                rj[2] = rj0[2] + Ls[n*3+2];
+                _1e_shift_rj(envs, rj);
+                if (!CINT1e_loop(gctr, envs, cache, int1e_type)) {
+                        continue;
+                }
+                if (!has_value) {
+                        for (i = 0; i < ngsum * nkpts_or_1 * 2; i++) {
+                                gsum[i] = 0;
+                        }
+                        has_value = 1;
+                }
+                if (kpts == NULL) {
+                        for (i = 0; i < ngsum; i++) {
+                                gsum[i] += gctr[i];
+                        }
+                        continue;
+                }
+                for (k = 0; k < nkpts; k++) {
+                        kL = kpts[k*3+0] * Ls[n*3+0] + kpts[k*3+1] * Ls[n*3+1]
+                           + kpts[k*3+2] * Ls[n*3+2];
+                        cos_kL = cos(kL);
+                        sin_kL = sin(kL);
+                        gre = gsum + ngsum * k * 2;
+                        gim = gre + ngsum;
+                        for (i = 0; i < ngsum; i++) {
+                                gre[i] += cos_kL * gctr[i];
+                                gim[i] += sin_kL * gctr[i];
+                        }
+                }
+        }
+        _1e_shift_rj(envs, rj0);
+
+        if (dims == NULL) {
+                dims = counts;
+        }
+        FINT nout = dims[0] * dims[1];
+        if (kpts == NULL) {
+                for (n = 0; n < n_comp; n++) {
+                        if (has_value) {
+                                (*f_c2s)(out+nout*n, gsum+nc*n, dims, envs, cache);
+                        } else {
+                                c2s_dset0(out+nout*n, dims, counts);
+                        }
+                }
+        } else {
+                double complex *zout = (double complex *)out;
+                double complex *pout;
+                double *bufre, *bufim;
+                FINT ic, jc;
+                MALLOC_INSTACK(bufre, nout0 * 2);
+                bufim = bufre + nout0;
+                for (k = 0; k < nkpts; k++) {
+                gre = gsum + ngsum * k * 2;
+                gim = gre + ngsum;
+                for (n = 0; n < n_comp; n++) {
+                        pout = zout + nout * (k * n_comp + n);
+                        if (!has_value) {
+                                c2s_zset0(pout, dims, counts);
+                                continue;
+                        }
+                        (*f_c2s)(bufre, gre+nc*n, counts, envs, cache);
+                        (*f_c2s)(bufim, gim+nc*n, counts, envs, cache);
+                        for (jc = 0; jc < counts[1]; jc++) {
+                        for (ic = 0; ic < counts[0]; ic++) {
+                                pout[jc*dims[0]+ic] = bufre[jc*counts[0]+ic]
+                                        + bufim[jc*counts[0]+ic] * _Complex_I;
+                        } }
+                } }
+        }
+
+        if (stack != NULL) {
+                free(stack);
+        }
+        return has_value;
+}
+
 static void make_g1e_gout(double *gout, double *g, FINT *idx,
                           CINTEnvVars *envs, FINT empty, FINT int1e_type)
 {
@@ -430,6 +638,64 @@ void int1e_nuc_optimizer(CINTOpt **opt, FINT *atm, FINT natm,
 }
 
 
+void CINTgout1e_int1e_kin(double *gout, double *g, FINT *idx, CINTEnvVars *envs, FINT empty);
+
+#define INT1E_LATTICE(NAME, NG, GOUT, FAC, TYPE) \
+CACHE_SIZE_T NAME##_sph_lattice(double *out, FINT *dims, FINT *shls, \
+                FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env, \
+                CINTOpt *opt, double *cache, double *lattice, double rcut) { \
+        FINT ng[] = NG; \
+        CINTEnvVars envs; \
+        CINTinit_int1e_EnvVars(&envs, ng, shls, atm, natm, bas, nbas, env); \
+        envs.f_gout = &GOUT; \
+        envs.common_factor *= FAC; \
+        return CINT1e_lattice_drv(out, dims, &envs, cache, &c2s_sph_1e, TYPE, \
+                                  lattice, rcut, NULL, 0); \
+} \
+CACHE_SIZE_T NAME##_cart_lattice(double *out, FINT *dims, FINT *shls, \
+                FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env, \
+                CINTOpt *opt, double *cache, double *lattice, double rcut) { \
+        FINT ng[] = NG; \
+        CINTEnvVars envs; \
+        CINTinit_int1e_EnvVars(&envs, ng, shls, atm, natm, bas, nbas, env); \
+        envs.f_gout = &GOUT; \
+        envs.common_factor *= FAC; \
+        return CINT1e_lattice_drv(out, dims, &envs, cache, &c2s_cart_1e, TYPE, \
+                                  lattice, rcut, NULL, 0); \
+} \
+CACHE_SIZE_T NAME##_sph_kpts(double complex *out, FINT *dims, FINT *shls, \
+                FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env, \
+                CINTOpt *opt, double *cache, double *lattice, double rcut, \
+                double *kpts, FINT nkpts) { \
+        FINT ng[] = NG; \
+        CINTEnvVars envs; \
+        CINTinit_int1e_EnvVars(&envs, ng, shls, atm, natm, bas, nbas, env); \
+        envs.f_gout = &GOUT; \
+        envs.common_factor *= FAC; \
+        return CINT1e_lattice_drv((double *)out, dims, &envs, cache, &c2s_sph_1e, \
+                                  TYPE, lattice, rcut, kpts, nkpts); \
+} \
+CACHE_SIZE_T NAME##_cart_kpts(double complex *out, FINT *dims, FINT *shls, \
+                FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env, \
+                CINTOpt *opt, double *cache, double *lattice, double rcut, \
+                double *kpts, FINT nkpts) { \
+        FINT ng[] = NG; \
+        CINTEnvVars envs; \
+        CINTinit_int1e_EnvVars(&envs, ng, shls, atm, natm, bas, nbas, env); \
+        envs.f_gout = &GOUT; \
+        envs.common_factor *= FAC; \
+        return CINT1e_lattice_drv((double *)out, dims, &envs, cache, &c2s_cart_1e, \
+                                  TYPE, lattice, rcut, kpts, nkpts); \
+}
+
+#define NG_OVLP {0, 0, 0, 0, 0, 1, 1, 1}
+#define NG_KIN  {0, 2, 0, 0, 2, 1, 1, 1}
+#define NG_NUC  {0, 0, 0, 0, 0, 1, 0, 1}
+INT1E_LATTICE(int1e_ovlp, NG_OVLP, CINTgout1e, 1., INT1E_TYPE_OVLP)
+INT1E_LATTICE(int1e_kin, NG_KIN, CINTgout1e_int1e_kin, .5, INT1E_TYPE_OVLP)
+INT1E_LATTICE(int1e_nuc, NG_NUC, CINTgout1e_nuc, 1., INT1E_TYPE_NUC)
+
+
 ALL_CINT(int1e_ovlp);
 ALL_CINT(int1e_nuc);
 ALL_CINT_FORTRAN_(int1e_ovlp);
@@ -14,6 +14,10 @@ CACHE_SIZE_T CINT1e_drv(double *out, FINT *dims, CINTEnvVars *envs,
 CACHE_SIZE_T CINT1e_spinor_drv(double complex *out, FINT *dims, CINTEnvVars *envs,
                        double *cache, void (*f_c2s)(), FINT int1e_type);
 
+CACHE_SIZE_T CINT1e_lattice_drv(double *out, FINT *dims, CINTEnvVars *envs,
+                                double *cache, void (*f_c2s)(), FINT int1e_type,
+                                double *lattice, double rcut, double *kpts, FINT nkpts);
+
 double CINTnuc_mod(double aij, FINT nuc_id, FINT *atm, double *env);
 
 CACHE_SIZE_T int1e_cache_size(CINTEnvVars *envs);
@@ -2,10 +2,19 @@
  * Copyright (C) 2021  Qiming Sun <osirpt.sun@gmail.com>
  *
  * <i|1/r|j> integrals for multiple grids
+ *
+ * CINT1e_grids_omp_drv and CINT1e_grids_spinor_omp_drv split the grids over
+ * the OpenMP threads. Each thread takes its own slice of the cache, so a
+ * cache provided by the caller must hold omp_get_max_threads() times the
+ * cache of one chunk, which is the size these drivers return for out = NULL.
+ * Pass cache = NULL to let every thread allocate its own buffer.
  */
 
 #include <stdlib.h>
 #include <math.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "cint_bas.h"
 #include "optimizer.h"
 #include "g1e.h"
@@ -328,6 +337,95 @@ CACHE_SIZE_T CINT1e_grids_spinor_drv(double complex *out, FINT *dims, CINTEnvVar
         return has_value;
 }
 
+/*
+ * Split the grids shls[2]:shls[3] into chunks and evaluate the chunks in
+ * multiple threads. Each chunk is a regular call to intor which writes to
+ * the grids_offset slice of out. dims[2] is the leading dimension of the
+ * grids in out. When dims is NULL, the shape of out is unknown to this
+ * function and intor is called for all grids in one thread.
+ */
+static CACHE_SIZE_T _grids_omp_drv(CACHE_SIZE_T (*intor)(), double *out, FINT *dims,
+                                   FINT *shls, FINT *atm, FINT natm, FINT *bas, FINT nbas,
+                                   double *env, CINTOpt *opt, double *cache, FINT comp_size)
+{
+        FINT ngrids = shls[3] - shls[2];
+        FINT nthreads = 1;
+#ifdef _OPENMP
+        nthreads = omp_get_max_threads();
+#endif
+        if (dims == NULL || nthreads == 1 || ngrids <= GRID_BLKSIZE) {
+                return (*intor)(out, dims, shls, atm, natm, bas, nbas, env, opt, cache);
+        }
+
+        // a few chunks for each thread to balance the load
+        FINT blksize = (ngrids + nthreads * 4 - 1) / (nthreads * 4);
+        blksize = (blksize + GRID_BLKSIZE - 1) / GRID_BLKSIZE * GRID_BLKSIZE;
+        FINT nblk = (ngrids + blksize - 1) / blksize;
+        FINT shls_blk[4] = {shls[0], shls[1], shls[2], shls[2] + blksize};
+        CACHE_SIZE_T cache_size = (*intor)(NULL, NULL, shls_blk, atm, natm,
+                                           bas, nbas, env, opt, NULL);
+        if (out == NULL) {
+                return cache_size * nthreads;
+        }
+
+        FINT has_value = 0;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads) reduction(|:has_value)
+#endif
+{
+        FINT thread_id = 0;
+#ifdef _OPENMP
+        thread_id = omp_get_thread_num();
+#endif
+        double *buf;
+        if (cache == NULL) {
+                buf = malloc(sizeof(double) * cache_size);
+        } else {
+                buf = cache + (size_t)cache_size * thread_id;
+        }
+        FINT iblk, g0, g1;
+        FINT shls1[4];
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (iblk = 0; iblk < nblk; iblk++) {
+                g0 = iblk * blksize;
+                g1 = MIN(g0 + blksize, ngrids);
+                shls1[0] = shls[0];
+                shls1[1] = shls[1];
+                shls1[2] = shls[2] + g0;
+                shls1[3] = shls[2] + g1;
+                has_value |= (*intor)(out + (size_t)g0 * comp_size, dims, shls1,
+                                      atm, natm, bas, nbas, env, opt, buf) != 0;
+        }
+        if (cache == NULL) {
+                free(buf);
+        }
+}
+        return has_value;
+}
+
+/*
+ * Multithreaded evaluation for one shell pair over many grids. intor can be
+ * any int1e_grids function with real (cart or sph) output.
+ */
+CACHE_SIZE_T CINT1e_grids_omp_drv(CACHE_SIZE_T (*intor)(), double *out, FINT *dims,
+                                  FINT *shls, FINT *atm, FINT natm, FINT *bas, FINT nbas,
+                                  double *env, CINTOpt *opt, double *cache)
+{
+        return _grids_omp_drv(intor, out, dims, shls, atm, natm, bas, nbas,
+                              env, opt, cache, 1);
+}
+
+CACHE_SIZE_T CINT1e_grids_spinor_omp_drv(CACHE_SIZE_T (*intor)(), double complex *out,
+                                         FINT *dims, FINT *shls, FINT *atm, FINT natm,
+                                         FINT *bas, FINT nbas, double *env, CINTOpt *opt,
+                                         double *cache)
+{
+        return _grids_omp_drv(intor, (double *)out, dims, shls, atm, natm, bas, nbas,
+                              env, opt, cache, OF_CMPLX);
+}
+
 CACHE_SIZE_T int1e_grids_sph(double *out, FINT *dims, FINT *shls, FINT *atm, FINT natm,
                      FINT *bas, FINT nbas, double *env, CINTOpt *opt, double *cache)
 {
@@ -255,6 +255,9 @@ CACHE_SIZE_T CINT2c2e_drv(double *out, FINT *dims, CINTEnvVars *envs, CINTOpt *o
 
         FINT n;
         FINT empty = 1;
+        if (opt != NULL && opt->mixed_precision) {
+                CINTg2e_f32_kernels(envs);
+        }
         if (opt != NULL) {
                 envs->opt = opt;
                 CINT2c2e_loop(gctr, envs, cache, &empty);
@@ -357,6 +360,40 @@ CACHE_SIZE_T int2c2e_sph(double *out, FINT *dims, FINT *shls, FINT *atm, FINT na
         envs.f_gout = &CINTgout2e;
         return CINT2c2e_drv(out, dims, &envs, opt, cache, &c2s_sph_1e);
 }
+/*
+ * int2c2e_sph with the mixed precision kernels and float output
+ */
+CACHE_SIZE_T int2c2e_sph_f32(float *out, FINT *dims, FINT *shls, FINT *atm, FINT natm,
+                             FINT *bas, FINT nbas, double *env, CINTOpt *opt, double *cache)
+{
+        FINT ng[] = {0, 0, 0, 0, 0, 1, 1, 1};
+        CINTEnvVars envs;
+        CINTinit_int2c2e_EnvVars(&envs, ng, shls, atm, natm, bas, nbas, env);
+        envs.f_gout = &CINTgout2e;
+        CINTg2e_f32_kernels(&envs);
+        FINT counts[2];
+        counts[0] = CINTcgto_spheric(shls[0], bas);
+        counts[1] = CINTcgto_spheric(shls[1], bas);
+        size_t nout = counts[0] * counts[1];
+        if (out == NULL) {
+                return CINT2c2e_drv(NULL, NULL, &envs, opt, cache, &c2s_sph_1e) + nout;
+        }
+        double *stack = NULL;
+        if (cache == NULL) {
+                size_t cache_size = CINT2c2e_drv(NULL, NULL, &envs, opt, NULL,
+                                                 &c2s_sph_1e) + nout;
+                stack = malloc(sizeof(double)*cache_size);
+                cache = stack;
+        }
+        double *buf;
+        MALLOC_INSTACK(buf, nout);
+        CACHE_SIZE_T has_value = CINT2c2e_drv(buf, NULL, &envs, opt, cache, &c2s_sph_1e);
+        CINTdcopy_f32(out, buf, dims, counts, 2);
+        if (stack != NULL) {
+                free(stack);
+        }
+        return has_value;
+}
 void int2c2e_optimizer(CINTOpt **opt, FINT *atm, FINT natm,
                        FINT *bas, FINT nbas, double *env)
 {
@@ -16,6 +16,8 @@
 #include "misc.h"
 #include "cart2sph.h"
 #include "c2f.h"
+#include "perf_counters.h"
+#include "multipole.h"
 
 #define gctrg   gout
 #define gctrm   gctr
@@ -232,6 +234,7 @@ FINT CINT2e_loop_nopt(double *gctr, CINTEnvVars *envs, double *cache, FINT *empt
                                         if (pdata_ij->cceij > eijcutoff) {
                                                 goto i_contracted;
                                         }
+                                        PERF_COUNT(CINT_PERF_PRIM_QUARTETS_EVAL, 1);
                                         envs->ai[0] = ai[ip];
                                         rij = pdata_ij->rij;
                                         cutoff = eijcutoff - pdata_ij->cceij;
@@ -278,10 +281,16 @@ k_contracted: ;
         FINT k_sh = shls[2]; \
         FINT l_sh = shls[3]; \
         CINTOpt *opt = envs->opt; \
-        if (opt->pairdata != NULL && \
-            ((opt->pairdata[i_sh*opt->nbas+j_sh] == NOVALUE) || \
-             (opt->pairdata[k_sh*opt->nbas+l_sh] == NOVALUE))) { \
-                return 0; \
+        PairData *_pdata_ij, *_pdata_kl, *pdata_kl; \
+        if (opt->pairdata != NULL) { \
+                _pdata_ij = CINTOpt_pairdata(opt, i_sh, j_sh, envs->atm, bas, env); \
+                if (_pdata_ij == NOVALUE) { \
+                        return 0; \
+                } \
+                _pdata_kl = CINTOpt_pairdata(opt, k_sh, l_sh, envs->atm, bas, env); \
+                if (_pdata_kl == NOVALUE) { \
+                        return 0; \
+                } \
         } \
         FINT i_ctr = envs->x_ctr[0]; \
         FINT j_ctr = envs->x_ctr[1]; \
@@ -302,11 +311,7 @@ k_contracted: ;
         double expcutoff = envs->expcutoff; \
         double rr_ij = SQUARE(envs->rirj); \
         double rr_kl = SQUARE(envs->rkrl); \
-        PairData *_pdata_ij, *_pdata_kl, *pdata_ij, *pdata_kl; \
-        if (opt->pairdata != NULL) { \
-                _pdata_ij = opt->pairdata[i_sh*opt->nbas+j_sh]; \
-                _pdata_kl = opt->pairdata[k_sh*opt->nbas+l_sh]; \
-        } else { \
+        if (opt->pairdata == NULL) { \
                 double *log_maxci = opt->log_max_coeff[i_sh]; \
                 double *log_maxcj = opt->log_max_coeff[j_sh]; \
                 MALLOC_INSTACK(_pdata_ij, i_prim*j_prim + k_prim*l_prim); \
@@ -375,6 +380,10 @@ k_contracted: ;
                         expcutoff += lkl * approx_log( \
                                 (dist_kl+theta*r_guess+1.)/(dist_kl+1.)); \
                 } \
+        } \
+        if (omega < 0 && envs->f_g0_2e == &CINTg0_2e && \
+            CINTOpt_sr_screened(opt, shls, omega, expcutoff)) { \
+                return 0; \
         }
 
 #define SET_RIJ(I,J)    \
@@ -384,11 +393,91 @@ k_contracted: ;
         exp##I##J = pdata_##I##J->eij; \
         r##I##J = pdata_##I##J->rij;
 
+/*
+ * Gathers the ij primitive pairs which pass the screening of at least one kl
+ * primitive pair (cceij <= cutoff) into the arrays cceij, eij, rij and ipidx.
+ * The pairs of primitive jp are stored in [start[jp], start[jp+1]). Each
+ * pair is written unconditionally and the counter is advanced by the result
+ * of the test, so the loop has no data dependent branch.
+ */
+static FINT _compact_ij_pairs(FINT *start, FINT *ipidx, double *cceij, double *eij,
+                              double *rij, PairData *pdata, FINT i_prim, FINT j_prim,
+                              double cutoff)
+{
+        FINT ip, jp;
+        FINT n = 0;
+        for (jp = 0; jp < j_prim; jp++) {
+                start[jp] = n;
+                for (ip = 0; ip < i_prim; ip++, pdata++) {
+                        ipidx[n] = ip;
+                        cceij[n] = pdata->cceij;
+                        eij[n] = pdata->eij;
+                        rij[n*3+0] = pdata->rij[0];
+                        rij[n*3+1] = pdata->rij[1];
+                        rij[n*3+2] = pdata->rij[2];
+                        n += pdata->cceij <= cutoff;
+                }
+        }
+        start[j_prim] = n;
+        return n;
+}
+
+// The loosest cutoff of the ij pairs is given by the kl pair of smallest cceij
+#define PREFILTER_IJ \
+        FINT *ij_start, *ij_ip; \
+        double *ij_cceij, *ij_eij, *ij_rij; \
+        FINT nij; \
+        { \
+                double cceij_kl = _pdata_kl[0].cceij; \
+                for (nij = 1; nij < k_prim * l_prim; nij++) { \
+                        cceij_kl = MIN(cceij_kl, _pdata_kl[nij].cceij); \
+                } \
+                MALLOC_INSTACK(ij_cceij, i_prim * j_prim * 5); \
+                ij_eij = ij_cceij + i_prim * j_prim; \
+                ij_rij = ij_eij + i_prim * j_prim; \
+                MALLOC_INSTACK(ij_start, j_prim + 1); \
+                MALLOC_INSTACK(ij_ip, i_prim * j_prim); \
+                if (_compact_ij_pairs(ij_start, ij_ip, ij_cceij, ij_eij, ij_rij, \
+                                      _pdata_ij, i_prim, j_prim, \
+                                      eklcutoff - cceij_kl) == 0) { \
+                        return 0; \
+                } \
+        }
+
+#define SET_RIJ_IJ      \
+        if (ij_cceij[nij] > eijcutoff) { \
+                continue; } \
+        ip = ij_ip[nij]; \
+        envs->ai[0] = ai[ip]; \
+        expij = ij_eij[nij]; \
+        rij = ij_rij + nij * 3; \
+        PERF_COUNT(CINT_PERF_PRIM_QUARTETS_EVAL, 1);
+
+/*
+ * Root finding and g of a batch of primitive quartets collected by
+ * CINT2e_1111_loop
+ */
+static void _2e_quartet_batch(double *gout, double *g, FINT *idx, CINTEnvVars *envs,
+                              PrimQuartet *quartets, FINT nq, FINT *gempty)
+{
+        FINT nroots = envs->nrys_roots;
+        double u[QUARTET_BATCH*MXRYSROOTS];
+        double w[QUARTET_BATCH*MXRYSROOTS];
+        FINT n;
+        CINTg0_2e_roots_batch(u, w, quartets, nq, envs);
+        for (n = 0; n < nq; n++) {
+                CINTg0_2e_from_roots(g, u+n*nroots, w+n*nroots, quartets+n, envs);
+                (*envs->f_gout)(gout, g, idx, envs, *gempty);
+                *gempty = 0;
+        }
+}
+
 // i_ctr = j_ctr = k_ctr = l_ctr = 1;
 FINT CINT2e_1111_loop(double *gctr, CINTEnvVars *envs, double *cache, FINT *empty)
 {
         COMMON_ENVS_AND_DECLARE;
         ADJUST_CUTOFF;
+        PREFILTER_IJ;
         FINT nc = 1;
         size_t leng = envs->g_size * 3 * ((1<<envs->gbits)+1);
         size_t len0 = nf * n_comp;
@@ -403,6 +492,16 @@ FINT CINT2e_1111_loop(double *gctr, CINTEnvVars *envs, double *cache, FINT *empt
                 gout = g + leng;
         }
 
+        // For the plain Coulomb operator and the short-range Coulomb which
+        // needs only the SR roots, the screening loops only collect the
+        // surviving primitive quartets. They are evaluated in batches.
+        // A batch is flushed right after the current quartet is added, so
+        // the exponents in envs are those of the current quartet afterwards.
+        FINT batch = envs->f_g0_2e == &CINTg0_2e &&
+                (omega == 0 || (omega < 0 && envs->rys_order == envs->nrys_roots));
+        PrimQuartet quartets[QUARTET_BATCH];
+        FINT nq = 0;
+
         pdata_kl = _pdata_kl;
         for (lp = 0; lp < l_prim; lp++) {
                 envs->al[0] = al[lp];
@@ -411,25 +510,39 @@ FINT CINT2e_1111_loop(double *gctr, CINTEnvVars *envs, double *cache, FINT *empt
                         SET_RIJ(k, l);
                         fac1k = fac1l * ck[kp];
                         eijcutoff = eklcutoff - pdata_kl->cceij;
-                        pdata_ij = _pdata_ij;
                         for (jp = 0; jp < j_prim; jp++) {
                                 envs->aj[0] = aj[jp];
                                 fac1j = fac1k * cj[jp];
-                                for (ip = 0; ip < i_prim; ip++, pdata_ij++) {
-                                        SET_RIJ(i, j);
+                                for (nij = ij_start[jp]; nij < ij_start[jp+1]; nij++) {
+                                        SET_RIJ_IJ;
                                         fac1i = fac1j*ci[ip]*expij*expkl;
+                                        cutoff = eijcutoff - ij_cceij[nij];
+                                        if (batch) {
+                                                if (!CINTg0_2e_quartet(quartets+nq, fac1i,
+                                                                       rij, rkl, cutoff, envs)) {
+                                                        continue;
+                                                }
+                                                nq++;
+                                                if (nq == QUARTET_BATCH) {
+                                                        _2e_quartet_batch(gout, g, idx, envs,
+                                                                          quartets, nq, gempty);
+                                                        nq = 0;
+                                                }
+                                                continue;
+                                        }
                                         envs->fac[0] = fac1i;
-                                        cutoff = eijcutoff - pdata_ij->cceij;
                                         if ((*envs->f_g0_2e)(g, rij, rkl, cutoff, envs)) {
                                                 (*envs->f_gout)(gout, g, idx, envs, *gempty);
                                                 *gempty = 0;
                                         }
-i_contracted: ;
                                 } // end loop i_prim
                         } // end loop j_prim
 k_contracted: ;
                 } // end loop k_prim
         } // end loop l_prim
+        if (nq > 0) {
+                _2e_quartet_batch(gout, g, idx, envs, quartets, nq, gempty);
+        }
 
         if (n_comp > 1 && !*gempty) {
                 TRANSPOSE(gout);
@@ -442,6 +555,7 @@ FINT CINT2e_n111_loop(double *gctr, CINTEnvVars *envs, double *cache, FINT *empt
 {
         COMMON_ENVS_AND_DECLARE;
         ADJUST_CUTOFF;
+        PREFILTER_IJ;
         FINT nc = i_ctr;
         size_t leng = envs->g_size * 3 * ((1<<envs->gbits)+1);
         size_t leni = nf * i_ctr * n_comp; // gctri
@@ -462,23 +576,18 @@ FINT CINT2e_n111_loop(double *gctr, CINTEnvVars *envs, double *cache, FINT *empt
                         SET_RIJ(k, l);
                         fac1k = fac1l * ck[kp];
                         eijcutoff = eklcutoff - pdata_kl->cceij;
-                        pdata_ij = _pdata_ij;
                         for (jp = 0; jp < j_prim; jp++) {
                                 envs->aj[0] = aj[jp];
                                 fac1j = fac1k * cj[jp];
-                                for (ip = 0; ip < i_prim; ip++, pdata_ij++) {
-                                        if (pdata_ij->cceij > eijcutoff) {
-                                                goto i_contracted;
-                                        }
-                                        SET_RIJ(i, j);
-                                        cutoff = eijcutoff - pdata_ij->cceij;
+                                for (nij = ij_start[jp]; nij < ij_start[jp+1]; nij++) {
+                                        SET_RIJ_IJ;
+                                        cutoff = eijcutoff - ij_cceij[nij];
                                         fac1i = fac1j*expij*expkl;
                                         envs->fac[0] = fac1i;
                                         if ((*envs->f_g0_2e)(g, rij, rkl, cutoff, envs)) {
                                                 (*envs->f_gout)(gout, g, idx, envs, 1);
                                                 PRIM2CTR(i, gout, len0);
                                         }
-i_contracted: ;
                                 } // end loop i_prim
                         } // end loop j_prim
 k_contracted: ;
@@ -496,6 +605,7 @@ FINT CINT2e_1n11_loop(double *gctr, CINTEnvVars *envs, double *cache, FINT *empt
 {
         COMMON_ENVS_AND_DECLARE;
         ADJUST_CUTOFF;
+        PREFILTER_IJ;
         FINT nc = j_ctr;
         size_t leng = envs->g_size * 3 * ((1<<envs->gbits)+1);
         size_t lenj = nf * j_ctr * n_comp; // gctrj
@@ -516,21 +626,19 @@ FINT CINT2e_1n11_loop(double *gctr, CINTEnvVars *envs, double *cache, FINT *empt
                         SET_RIJ(k, l);
                         fac1k = fac1l * ck[kp];
                         eijcutoff = eklcutoff - pdata_kl->cceij;
-                        pdata_ij = _pdata_ij;
                         for (jp = 0; jp < j_prim; jp++) {
                                 envs->aj[0] = aj[jp];
                                 fac1j = fac1k;
                                 *iempty = 1;
-                                for (ip = 0; ip < i_prim; ip++, pdata_ij++) {
-                                        SET_RIJ(i, j);
-                                        cutoff = eijcutoff - pdata_ij->cceij;
+                                for (nij = ij_start[jp]; nij < ij_start[jp+1]; nij++) {
+                                        SET_RIJ_IJ;
+                                        cutoff = eijcutoff - ij_cceij[nij];
                                         fac1i = fac1j*ci[ip]*expij*expkl;
                                         envs->fac[0] = fac1i;
                                         if ((*envs->f_g0_2e)(g, rij, rkl, cutoff, envs)) {
                                                 (*envs->f_gout)(gout, g, idx, envs, *iempty);
                                                 *iempty = 0;
                                         }
-i_contracted: ;
                                 } // end loop i_prim
                                 if (!*iempty) {
                                         PRIM2CTR(j, gout, len0);
@@ -551,6 +659,7 @@ FINT CINT2e_11n1_loop(double *gctr, CINTEnvVars *envs, double *cache, FINT *empt
 {
         COMMON_ENVS_AND_DECLARE;
         ADJUST_CUTOFF;
+        PREFILTER_IJ;
         FINT nc = k_ctr;
         size_t leng = envs->g_size * 3 * ((1<<envs->gbits)+1);
         size_t lenk = nf * k_ctr * n_comp; // gctrk
@@ -571,21 +680,19 @@ FINT CINT2e_11n1_loop(double *gctr, CINTEnvVars *envs, double *cache, FINT *empt
                         SET_RIJ(k, l);
                         fac1k = fac1l;
                         eijcutoff = eklcutoff - pdata_kl->cceij;
-                        pdata_ij = _pdata_ij;
                         *jempty = 1;
                         for (jp = 0; jp < j_prim; jp++) {
                                 envs->aj[0] = aj[jp];
                                 fac1j = fac1k * cj[jp];
-                                for (ip = 0; ip < i_prim; ip++, pdata_ij++) {
-                                        SET_RIJ(i, j);
-                                        cutoff = eijcutoff - pdata_ij->cceij;
+                                for (nij = ij_start[jp]; nij < ij_start[jp+1]; nij++) {
+                                        SET_RIJ_IJ;
+                                        cutoff = eijcutoff - ij_cceij[nij];
                                         fac1i = fac1j*ci[ip]*expij*expkl;
                                         envs->fac[0] = fac1i;
                                         if ((*envs->f_g0_2e)(g, rij, rkl, cutoff, envs)) {
                                                 (*envs->f_gout)(gout, g, idx, envs, *jempty);
                                                 *jempty = 0;
                                         }
-i_contracted: ;
                                 } // end loop i_prim
                         } // end loop j_prim
                         if (!*jempty) {
@@ -606,6 +713,7 @@ FINT CINT2e_111n_loop(double *gctr, CINTEnvVars *envs, double *cache, FINT *empt
 {
         COMMON_ENVS_AND_DECLARE;
         ADJUST_CUTOFF;
+        PREFILTER_IJ;
         FINT nc = l_ctr;
         size_t leng = envs->g_size * 3 * ((1<<envs->gbits)+1);
         size_t lenl = nf * l_ctr * n_comp; // gctrl
@@ -627,20 +735,18 @@ FINT CINT2e_111n_loop(double *gctr, CINTEnvVars *envs, double *cache, FINT *empt
                         SET_RIJ(k, l);
                         fac1k = fac1l * ck[kp];
                         eijcutoff = eklcutoff - pdata_kl->cceij;
-                        pdata_ij = _pdata_ij;
                         for (jp = 0; jp < j_prim; jp++) {
                                 envs->aj[0] = aj[jp];
                                 fac1j = fac1k * cj[jp];
-                                for (ip = 0; ip < i_prim; ip++, pdata_ij++) {
-                                        SET_RIJ(i, j);
-                                        cutoff = eijcutoff - pdata_ij->cceij;
+                                for (nij = ij_start[jp]; nij < ij_start[jp+1]; nij++) {
+                                        SET_RIJ_IJ;
+                                        cutoff = eijcutoff - ij_cceij[nij];
                                         fac1i = fac1j*ci[ip]*expij*expkl;
                                         envs->fac[0] = fac1i;
                                         if ((*envs->f_g0_2e)(g, rij, rkl, cutoff, envs)) {
                                                 (*envs->f_gout)(gout, g, idx, envs, *kempty);
                                                 *kempty = 0;
                                         }
-i_contracted: ;
                                 } // end loop i_prim
                         } // end loop j_prim
 k_contracted: ;
@@ -661,6 +767,7 @@ FINT CINT2e_loop(double *gctr, CINTEnvVars *envs, double *cache, FINT *empty)
 {
         COMMON_ENVS_AND_DECLARE;
         ADJUST_CUTOFF;
+        PREFILTER_IJ;
         FINT nc = i_ctr * j_ctr * k_ctr * l_ctr;
         size_t leng = envs->g_size * 3 * ((1<<envs->gbits)+1); // (irys,i,j,k,l,coord,0:1);
         size_t lenl = nf * nc * n_comp; // gctrl
@@ -706,7 +813,6 @@ FINT CINT2e_loop(double *gctr, CINTEnvVars *envs, double *cache, FINT *empty)
                                 *jempty = 1;
                         }
 
-                        pdata_ij = _pdata_ij;
                         for (jp = 0; jp < j_prim; jp++) {
                                 envs->aj[0] = aj[jp];
                                 if (j_ctr == 1) {
@@ -715,16 +821,9 @@ FINT CINT2e_loop(double *gctr, CINTEnvVars *envs, double *cache, FINT *empty)
                                         fac1j = fac1k;
                                         *iempty = 1;
                                 }
-                                for (ip = 0; ip < i_prim; ip++, pdata_ij++) {
-                                        /* SET_RIJ(i, j); */
-                                        if (pdata_ij->cceij > eijcutoff) {
-                                                goto i_contracted;
-                                        }
-                                        envs->ai[0] = ai[ip];
-                                        expij = pdata_ij->eij;
-                                        rij = pdata_ij->rij;
-                                        /* SET_RIJ(i, j); end */
-                                        cutoff = eijcutoff - pdata_ij->cceij;
+                                for (nij = ij_start[jp]; nij < ij_start[jp+1]; nij++) {
+                                        SET_RIJ_IJ;
+                                        cutoff = eijcutoff - ij_cceij[nij];
                                         if (i_ctr == 1) {
                                                 fac1i = fac1j*ci[ip] * expij*expkl;
                                         } else {
@@ -735,7 +834,6 @@ FINT CINT2e_loop(double *gctr, CINTEnvVars *envs, double *cache, FINT *empty)
                                                 (*envs->f_gout)(gout, g, idx, envs, *gempty);
                                                 PRIM2CTR(i, gout, len0);
                                         }
-i_contracted: ;
                                 } // end loop i_prim
                                 if (!*iempty) {
                                         PRIM2CTR(j, gctri, leni);
@@ -789,7 +887,87 @@ static FINT (*CINTf_2e_loop[16])(double *, CINTEnvVars *, double *, FINT *) = {
                            + j_prim * x_ctr[1] \
                            + k_prim * x_ctr[2] \
                            + l_prim * x_ctr[3] \
-                           +(i_prim+j_prim+k_prim+l_prim)*2 + nf*3);
+                           +(i_prim+j_prim+k_prim+l_prim)*2 + nf*3 \
+                           + i_prim*j_prim*6 + j_prim + 3);
+
+/*
+ * The 4D transfer of CINT2e_loop is repeated for every primitive quartet.
+ * For contracted shells, transfer once per contracted block instead.
+ */
+static FINT _rys_hrr_selected(CINTEnvVars *envs, CINTOpt *opt)
+{
+        FINT *bas = envs->bas;
+        FINT *shls = envs->shls;
+        FINT nprim = bas(NPRIM_OF, shls[0]) * bas(NPRIM_OF, shls[1])
+                   * bas(NPRIM_OF, shls[2]) * bas(NPRIM_OF, shls[3]);
+        FINT ltot = envs->i_l + envs->j_l + envs->k_l + envs->l_l;
+        // Without the index_xyz of the optimizer, the loops would build one
+        // for the nf of (ij|kl) in the cache of the [e0|f0]
+        return nprim >= HRR_AFTER_CTR_NPRIM && ltot >= HRR_AFTER_CTR_LMIN
+                && CINTrys_hrr_available(envs)
+                && opt->index_xyz_array[envs->i_l*LMAX1*LMAX1*LMAX1
+                                        +envs->j_l*LMAX1*LMAX1
+                                        +envs->k_l*LMAX1
+                                        +envs->l_l] != NULL;
+}
+
+// cache of the [e0|f0] loop and CINTg2e_ef_hrr, excluding pairdata
+static size_t _ef_cache_size(CINTEnvVars *envs)
+{
+        FINT *x_ctr = envs->x_ctr;
+        size_t nc = x_ctr[0] * x_ctr[1] * x_ctr[2] * x_ctr[3];
+        size_t len0 = CINTg2e_ef_len(envs);
+        size_t ni = x_ctr[0];
+        size_t nij = ni * x_ctr[1];
+        size_t nijk = nij * x_ctr[2];
+        // g_size of CINTinit_2e_ef_rys <= g_size of CINTinit_int2e_EnvVars
+        size_t leng = envs->g_size * 3 * 2;
+        size_t len = leng + len0 * (nc + nijk + nij + ni + 1);
+        return envs->nf * nc + len0 * nc + len0 * 3
+                + MAX(len, CINTg2e_ef_hrr_cache_size(envs));
+}
+
+/*
+ * The [e0|f0] of all primitive quartets are computed and contracted by the
+ * regular loops with CINTgout2e_ef. The HRR is then applied to the
+ * contracted gint[nc,len0].
+ */
+static FINT _rys_hrr_loop(double *gctr, CINTEnvVars *envs, double *cache)
+{
+        FINT *x_ctr = envs->x_ctr;
+        FINT nc = x_ctr[0] * x_ctr[1] * x_ctr[2] * x_ctr[3];
+        FINT nf = envs->nf;
+        size_t len0 = CINTg2e_ef_len(envs);
+        FINT empty = 1;
+        double *gint;
+        FINT *idx_ef;
+        MALLOC_INSTACK(gint, len0 * nc);
+        MALLOC_INSTACK(idx_ef, len0 * 3);
+        CINTinit_2e_ef_rys(envs);
+        CINTg2e_ef_index_xyz(idx_ef, envs);
+        envs->idx = (int *)idx_ef;
+        envs->nf = len0;
+        envs->f_gout = &CINTgout2e_ef;
+        FINT n = ((x_ctr[0]==1) << 3) + ((x_ctr[1]==1) << 2)
+               + ((x_ctr[2]==1) << 1) +  (x_ctr[3]==1);
+        CINTf_2e_loop[n](gint, envs, cache, &empty);
+        envs->nf = nf;
+        envs->f_gout = &CINTgout2e;
+        if (!empty) {
+                CINTg2e_ef_hrr(gctr, gint, envs, cache);
+        }
+        return !empty;
+}
+
+#ifdef WITH_PERF_COUNTERS
+static unsigned long long _nprim_quartets(CINTEnvVars *envs)
+{
+        FINT *shls = envs->shls;
+        FINT *bas = envs->bas;
+        return (unsigned long long)bas(NPRIM_OF, shls[0]) * bas(NPRIM_OF, shls[1])
+                * bas(NPRIM_OF, shls[2]) * bas(NPRIM_OF, shls[3]);
+}
+#endif
 
 CACHE_SIZE_T CINT2e_drv(double *out, FINT *dims, CINTEnvVars *envs, CINTOpt *opt,
                       double *cache, void (*f_c2s)())
@@ -804,6 +982,10 @@ CACHE_SIZE_T CINT2e_drv(double *out, FINT *dims, CINTEnvVars *envs, CINTOpt *opt
                 size_t len0 = nf*n_comp;
                 size_t cache_size = MAX(leng+len0+nc*n_comp*3 + pdata_size,
                                         nc*n_comp+nf*4);
+                if (CINTrys_hrr_available(envs)) {
+                        cache_size = MAX(cache_size, _ef_cache_size(envs) + pdata_size);
+                }
+                cache_size = MAX(cache_size, nc*n_comp + CINTmultipole_2e_cache_size(envs, opt));
 #if !defined(I8) && !defined(CACHE_SIZE_I8)
                 if (cache_size >= INT32_MAX) {
                         fprintf(stderr, "CINT2e_drv cache_size overflow: "
@@ -821,6 +1003,10 @@ CACHE_SIZE_T CINT2e_drv(double *out, FINT *dims, CINTEnvVars *envs, CINTOpt *opt
                 size_t len0 = nf*n_comp;
                 size_t cache_size = MAX(leng+len0+nc*n_comp*3 + pdata_size,
                                         nc*n_comp+nf*4);
+                if (CINTrys_hrr_available(envs)) {
+                        cache_size = MAX(cache_size, _ef_cache_size(envs) + pdata_size);
+                }
+                cache_size = MAX(cache_size, nc*n_comp + CINTmultipole_2e_cache_size(envs, opt));
                 stack = malloc(sizeof(double)*cache_size);
                 cache = stack;
         }
@@ -829,14 +1015,34 @@ CACHE_SIZE_T CINT2e_drv(double *out, FINT *dims, CINTEnvVars *envs, CINTOpt *opt
 
         FINT n;
         FINT empty = 1;
-        if (opt != NULL) {
+        // far-field quartets are evaluated by the multipole expansion, see
+        // CINTOpt_set_multipole
+        FINT far_field = (opt != NULL && opt->multipoles != NULL &&
+                          CINTmultipole_2e(gctr, envs, opt, cache));
+        if (!far_field && opt != NULL && opt->mixed_precision) {
+                CINTg2e_f32_kernels(envs);
+        }
+        PERF_COUNT(CINT_PERF_PRIM_QUARTETS, _nprim_quartets(envs));
+        PERF_TICK(t0);
+        if (far_field) {
+                empty = 0;
+        } else if (opt != NULL && _rys_hrr_selected(envs, opt)) {
                 envs->opt = opt;
-                n = ((x_ctr[0]==1) << 3) + ((x_ctr[1]==1) << 2)
-                  + ((x_ctr[2]==1) << 1) +  (x_ctr[3]==1);
-                CINTf_2e_loop[n](gctr, envs, cache, &empty);
+                empty = !_rys_hrr_loop(gctr, envs, cache);
         } else {
-                CINT2e_loop_nopt(gctr, envs, cache, &empty);
+                if (envs->f_gout == &CINTgout2e) {
+                        CINTg2e_class_kernels(envs);
+                }
+                if (opt != NULL) {
+                        envs->opt = opt;
+                        n = ((x_ctr[0]==1) << 3) + ((x_ctr[1]==1) << 2)
+                          + ((x_ctr[2]==1) << 1) +  (x_ctr[3]==1);
+                        CINTf_2e_loop[n](gctr, envs, cache, &empty);
+                } else {
+                        CINT2e_loop_nopt(gctr, envs, cache, &empty);
+                }
         }
+        PERF_TOCK(CINT_PERF_TICKS_LOOP, t0);
 
         FINT counts[4];
         if (f_c2s == &c2s_sph_2e1) {
@@ -855,9 +1061,11 @@ CACHE_SIZE_T CINT2e_drv(double *out, FINT *dims, CINTEnvVars *envs, CINTOpt *opt
         }
         FINT nout = dims[0] * dims[1] * dims[2] * dims[3];
         if (!empty) {
+                PERF_TICK(t1);
                 for (n = 0; n < n_comp; n++) {
                         (*f_c2s)(out+nout*n, gctr+nc*n, dims, envs, cache);
                 }
+                PERF_TOCK(CINT_PERF_TICKS_C2S, t1);
         } else {
                 for (n = 0; n < n_comp; n++) {
                         c2s_dset0(out+nout*n, dims, counts);
@@ -868,8 +1076,9 @@ CACHE_SIZE_T CINT2e_drv(double *out, FINT *dims, CINTEnvVars *envs, CINTOpt *opt
         }
         return !empty;
 }
-CACHE_SIZE_T CINT2e_spinor_drv(double complex *out, FINT *dims, CINTEnvVars *envs, CINTOpt *opt,
-                      double *cache, void (*f_e1_c2s)(), void (*f_e2_c2s)())
+static CACHE_SIZE_T _2e_spinor_drv(double complex *out, FINT *dims, CINTEnvVars *envs,
+                                   CINTOpt *opt, double *cache, void (*f_e1_c2s)(),
+                                   void (*f_e2_c2s)(), FINT kramers)
 {
         FINT *shls = envs->shls;
         FINT *bas = envs->bas;
@@ -878,12 +1087,29 @@ CACHE_SIZE_T CINT2e_spinor_drv(double complex *out, FINT *dims, CINTEnvVars *env
         counts[1] = CINTcgto_spinor(shls[1], bas);
         counts[2] = CINTcgto_spinor(shls[2], bas);
         counts[3] = CINTcgto_spinor(shls[3], bas);
+        if (kramers) {
+                counts[0] /= 2;
+        }
         FINT *x_ctr = envs->x_ctr;
         size_t nf = envs->nf;
         size_t nc = nf * x_ctr[0] * x_ctr[1] * x_ctr[2] * x_ctr[3];
         FINT n_comp = envs->ncomp_e1 * envs->ncomp_e2 * envs->ncomp_tensor;
         FINT n1 = counts[0] * envs->nfk * x_ctr[2]
                            * envs->nfl * x_ctr[3] * counts[1];
+        // c2s_2e_spinor keeps only one contraction block of the partially
+        // transformed integrals
+        FINT c2s_type = c2s_2e_spinor_type(f_e1_c2s, f_e2_c2s);
+        if (kramers) {
+                // only the sf/si transformations have the Kramers
+                // restricted form
+                if (c2s_type < 0) {
+                        return 0;
+                }
+                c2s_type |= C2S_KRAMERS;
+        }
+        if (c2s_type >= 0) {
+                n1 /= x_ctr[0] * x_ctr[1] * x_ctr[2] * x_ctr[3];
+        }
         if (out == NULL) {
                 PAIRDATA_NON0IDX_SIZE(pdata_size);
                 size_t leng = envs->g_size*3*((1<<envs->gbits)+1);
@@ -917,6 +1143,11 @@ CACHE_SIZE_T CINT2e_spinor_drv(double complex *out, FINT *dims, CINTEnvVars *env
 
         FINT n, m;
         FINT empty = 1;
+        if (envs->f_gout == &CINTgout2e) {
+                CINTg2e_class_kernels(envs);
+        }
+        PERF_COUNT(CINT_PERF_PRIM_QUARTETS, _nprim_quartets(envs));
+        PERF_TICK(t0);
         if (opt != NULL) {
                 envs->opt = opt;
                 n = ((x_ctr[0]==1) << 3) + ((x_ctr[1]==1) << 2)
@@ -925,12 +1156,19 @@ CACHE_SIZE_T CINT2e_spinor_drv(double complex *out, FINT *dims, CINTEnvVars *env
         } else {
                 CINT2e_loop_nopt(gctr, envs, cache, &empty);
         }
+        PERF_TOCK(CINT_PERF_TICKS_LOOP, t0);
 
         if (dims == NULL) {
                 dims = counts;
         }
         FINT nout = dims[0] * dims[1] * dims[2] * dims[3];
-        if (!empty) {
+        PERF_TICK(t1);
+        if (!empty && c2s_type >= 0) {
+                for (n = 0; n < envs->ncomp_tensor; n++) {
+                        c2s_2e_spinor(out+nout*n, gctr, dims, envs, cache, c2s_type);
+                        gctr += nc * envs->ncomp_e1 * envs->ncomp_e2;
+                }
+        } else if (!empty) {
                 double complex *opij;
                 MALLOC_INSTACK(opij, n1*envs->ncomp_e2);
                 for (n = 0; n < envs->ncomp_tensor; n++) {
@@ -945,11 +1183,28 @@ CACHE_SIZE_T CINT2e_spinor_drv(double complex *out, FINT *dims, CINTEnvVars *env
                         c2s_zset0(out+nout*n, dims, counts);
                 }
         }
+        PERF_TOCK(CINT_PERF_TICKS_C2S, t1);
         if (stack != NULL) {
                 free(stack);
         }
         return !empty;
 }
+CACHE_SIZE_T CINT2e_spinor_drv(double complex *out, FINT *dims, CINTEnvVars *envs, CINTOpt *opt,
+                      double *cache, void (*f_e1_c2s)(), void (*f_e2_c2s)())
+{
+        return _2e_spinor_drv(out, dims, envs, opt, cache, f_e1_c2s, f_e2_c2s, 0);
+}
+/*
+ * Kramers restricted spinor integrals.  Only the Kramers unique half of the
+ * spinors of shell i are evaluated, the output is out[l,k,j,i/2].  The full
+ * integrals can be obtained with CINTc2s_kramers_2e.
+ */
+CACHE_SIZE_T CINT2e_spinor_kr_drv(double complex *out, FINT *dims, CINTEnvVars *envs,
+                                  CINTOpt *opt, double *cache,
+                                  void (*f_e1_c2s)(), void (*f_e2_c2s)())
+{
+        return _2e_spinor_drv(out, dims, envs, opt, cache, f_e1_c2s, f_e2_c2s, 1);
+}
 
 
 /*
@@ -1209,6 +1464,69 @@ CACHE_SIZE_T int2e_cart(double *out, FINT *dims, FINT *shls, FINT *atm, FINT nat
         return CINT2e_drv(out, dims, &envs, opt, cache, &c2s_cart_2e1);
 }
 
+/*
+ * Copies the integrals buf of one shell block, ordered as counts[:nd], to
+ * the float array out of the shape dims[:nd]. dims = NULL for
+ * out[counts[:nd]]
+ */
+void CINTdcopy_f32(float *out, double *buf, FINT *dims, FINT *counts, FINT nd)
+{
+        FINT c[4] = {1, 1, 1, 1};
+        FINT d[4] = {1, 1, 1, 1};
+        FINT i, j, k, l;
+        for (i = 0; i < nd; i++) {
+                c[i] = counts[i];
+                d[i] = (dims == NULL) ? counts[i] : dims[i];
+        }
+        float *pout;
+        for (l = 0; l < c[3]; l++) {
+        for (k = 0; k < c[2]; k++) {
+        for (j = 0; j < c[1]; j++) {
+                pout = out + ((l * d[2] + k) * d[1] + j) * d[0];
+                for (i = 0; i < c[0]; i++) {
+                        pout[i] = buf[i];
+                }
+                buf += c[0];
+        } } }
+}
+
+/*
+ * int2e_sph with the mixed precision kernels and float output
+ */
+CACHE_SIZE_T int2e_sph_f32(float *out, FINT *dims, FINT *shls, FINT *atm, FINT natm,
+                           FINT *bas, FINT nbas, double *env, CINTOpt *opt, double *cache)
+{
+        FINT ng[] = {0, 0, 0, 0, 0, 1, 1, 1};
+        CINTEnvVars envs;
+        CINTinit_int2e_EnvVars(&envs, ng, shls, atm, natm, bas, nbas, env);
+        envs.f_gout = &CINTgout2e;
+        CINTg2e_f32_kernels(&envs);
+        FINT counts[4];
+        counts[0] = CINTcgto_spheric(shls[0], bas);
+        counts[1] = CINTcgto_spheric(shls[1], bas);
+        counts[2] = CINTcgto_spheric(shls[2], bas);
+        counts[3] = CINTcgto_spheric(shls[3], bas);
+        size_t nout = counts[0] * counts[1] * counts[2] * counts[3];
+        if (out == NULL) {
+                return CINT2e_drv(NULL, NULL, &envs, opt, cache, &c2s_sph_2e1) + nout;
+        }
+        double *stack = NULL;
+        if (cache == NULL) {
+                size_t cache_size = CINT2e_drv(NULL, NULL, &envs, opt, NULL,
+                                               &c2s_sph_2e1) + nout;
+                stack = malloc(sizeof(double)*cache_size);
+                cache = stack;
+        }
+        double *buf;
+        MALLOC_INSTACK(buf, nout);
+        CACHE_SIZE_T has_value = CINT2e_drv(buf, NULL, &envs, opt, cache, &c2s_sph_2e1);
+        CINTdcopy_f32(out, buf, dims, counts, 4);
+        if (stack != NULL) {
+                free(stack);
+        }
+        return has_value;
+}
+
 /*
  * spinor <ki|jl> = (ij|kl); i,j\in electron 1; k,l\in electron 2
  */
@@ -1223,7 +1541,53 @@ CACHE_SIZE_T int2e_spinor(double complex *out, FINT *dims, FINT *shls, FINT *atm
                                  &c2s_sf_2e1, &c2s_sf_2e2);
 }
 
+void int2e_kr_optimizer(CINTOpt **opt, FINT *atm, FINT natm,
+                        FINT *bas, FINT nbas, double *env)
+{
+        int2e_optimizer(opt, atm, natm, bas, nbas, env);
+}
+/*
+ * Kramers unique part of int2e_spinor, see CINT2e_spinor_kr_drv
+ */
+CACHE_SIZE_T int2e_kr_spinor(double complex *out, FINT *dims, FINT *shls, FINT *atm, FINT natm,
+                             FINT *bas, FINT nbas, double *env, CINTOpt *opt, double *cache)
+{
+        FINT ng[] = {0, 0, 0, 0, 0, 1, 1, 1};
+        CINTEnvVars envs;
+        CINTinit_int2e_EnvVars(&envs, ng, shls, atm, natm, bas, nbas, env);
+        envs.f_gout = &CINTgout2e;
+        return CINT2e_spinor_kr_drv(out, dims, &envs, opt, cache,
+                                    &c2s_sf_2e1, &c2s_sf_2e2);
+}
+
+void CINTgout2e_int2e_spsp1(double *gout, double *g, FINT *idx,
+                            CINTEnvVars *envs, FINT gout_empty);
+void int2e_spsp1_kr_optimizer(CINTOpt **opt, FINT *atm, FINT natm,
+                              FINT *bas, FINT nbas, double *env)
+{
+        FINT ng[] = {1, 1, 0, 0, 2, 4, 1, 1};
+        CINTall_2e_optimizer(opt, ng, atm, natm, bas, nbas, env);
+}
+/*
+ * Kramers unique part of int2e_spsp1_spinor
+ */
+CACHE_SIZE_T int2e_spsp1_kr_spinor(double complex *out, FINT *dims, FINT *shls,
+                                   FINT *atm, FINT natm, FINT *bas, FINT nbas,
+                                   double *env, CINTOpt *opt, double *cache)
+{
+        FINT ng[] = {1, 1, 0, 0, 2, 4, 1, 1};
+        CINTEnvVars envs;
+        CINTinit_int2e_EnvVars(&envs, ng, shls, atm, natm, bas, nbas, env);
+        envs.f_gout = &CINTgout2e_int2e_spsp1;
+        return CINT2e_spinor_kr_drv(out, dims, &envs, opt, cache,
+                                    &c2s_si_2e1, &c2s_sf_2e2);
+}
+
 
 ALL_CINT(int2e)
 ALL_CINT_FORTRAN_(int2e)
+ALL_CINT_SPINOR(int2e_kr)
+ALL_CINT_SPINOR_FORTRAN_(int2e_kr)
+ALL_CINT_SPINOR(int2e_spsp1_kr)
+ALL_CINT_SPINOR_FORTRAN_(int2e_spsp1_kr)
 
@@ -16,12 +16,20 @@ CACHE_SIZE_T CINT2e_drv(double *out, FINT *dims, CINTEnvVars *envs, CINTOpt *opt
                     double *cache, void (*f_c2s)());
 CACHE_SIZE_T CINT2e_spinor_drv(double complex *out, FINT *dims, CINTEnvVars *envs, CINTOpt *opt,
                       double *cache, void (*f_e1_c2s)(), void (*f_e2_c2s)());
+CACHE_SIZE_T CINT2e_spinor_kr_drv(double complex *out, FINT *dims, CINTEnvVars *envs,
+                                  CINTOpt *opt, double *cache,
+                                  void (*f_e1_c2s)(), void (*f_e2_c2s)());
 
 CACHE_SIZE_T CINT3c2e_drv(double *out, FINT *dims, CINTEnvVars *envs, CINTOpt *opt,
                          double *cache, void (*f_e1_c2s)(), FINT is_ssc);
 CACHE_SIZE_T CINT3c2e_spinor_drv(double complex *out, FINT *dims, CINTEnvVars *envs, CINTOpt *opt,
                         double *cache, void (*f_e1_c2s)(), FINT is_ssc);
+CACHE_SIZE_T CINT3c2e_lattice_drv(double *out, FINT *dims, CINTEnvVars *envs, CINTOpt *opt,
+                                  double *cache, void (*f_e1_c2s)(), FINT is_ssc,
+                                  double *lattice, double rcut);
 CACHE_SIZE_T CINT2c2e_drv(double *out, FINT *dims, CINTEnvVars *envs, CINTOpt *opt,
                       double *cache, void (*f_c2s)());
+void CINTdcopy_f32(float *out, double *buf, FINT *dims, FINT *counts, FINT nd);
+
 CACHE_SIZE_T CINT2c2e_spinor_drv(double complex *out, FINT *dims, CINTEnvVars *envs, CINTOpt *opt,
                         double *cache, void (*f_e1_c2s)());
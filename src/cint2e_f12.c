@@ -51,8 +51,58 @@ void c##NAME##_sph_optimizer(CINTOpt **opt, FINT *atm, FINT natm, \
         NAME##_optimizer(opt, atm, natm, bas, nbas, env); \
 }
 
+/*
+ * (ij| sum_n c_n exp(-zeta_n r12) |kl) for the geminals in
+ * env[PTR_F12_GEMINALS], summed over the geminals
+ */
+CACHE_SIZE_T int2e_stg_sum_sph(double *out, FINT *dims, FINT *shls, FINT *atm, FINT natm,
+                      FINT *bas, FINT nbas, double *env, CINTOpt *opt, double *cache)
+{
+        FINT ng[] = {0, 0, 0, 0, 0, 1, 1, 1};
+        CINTEnvVars envs;
+        CINTinit_int2e_stg_geminals_EnvVars(&envs, ng, shls, atm, natm, bas, nbas, env);
+        envs.f_gout = &CINTgout2e;
+        if (CINTstg_geminals_overflow(&envs)) {
+                return 0;
+        }
+        return CINT2e_drv(out, dims, &envs, opt, cache, &c2s_sph_2e1);
+}
+void int2e_stg_sum_optimizer(CINTOpt **opt, FINT *atm, FINT natm,
+                             FINT *bas, FINT nbas, double *env)
+{
+        FINT ng[] = {0, 0, 0, 0, 0, 1, 1, 1};
+        CINTall_2e_stg_geminals_optimizer(opt, ng, atm, natm, bas, nbas, env);
+}
+
+/*
+ * (ij| c_n exp(-zeta_n r12) |kl) of each geminal as one tensor component,
+ * out[ngeminals,l,k,j,i]
+ */
+CACHE_SIZE_T int2e_stg_geminals_sph(double *out, FINT *dims, FINT *shls, FINT *atm, FINT natm,
+                           FINT *bas, FINT nbas, double *env, CINTOpt *opt, double *cache)
+{
+        FINT ng[] = {0, 0, 0, 0, 0, 1, 1, 1};
+        ng[TENSOR] = env[NF12_GEMINALS];
+        CINTEnvVars envs;
+        CINTinit_int2e_stg_geminals_EnvVars(&envs, ng, shls, atm, natm, bas, nbas, env);
+        envs.f_gout = &CINTgout2e_stg_geminals;
+        if (CINTstg_geminals_overflow(&envs)) {
+                return 0;
+        }
+        return CINT2e_drv(out, dims, &envs, opt, cache, &c2s_sph_2e1);
+}
+void int2e_stg_geminals_optimizer(CINTOpt **opt, FINT *atm, FINT natm,
+                                  FINT *bas, FINT nbas, double *env)
+{
+        FINT ng[] = {0, 0, 0, 0, 0, 1, 1, 1};
+        ng[TENSOR] = env[NF12_GEMINALS];
+        CINTall_2e_stg_geminals_optimizer(opt, ng, atm, natm, bas, nbas, env);
+}
+
 ALL_CINT(int2e_yp)
 ALL_CINT(int2e_stg)
+ALL_CINT(int2e_stg_sum)
+ALL_CINT(int2e_stg_geminals)
 
 
 
@@ -218,9 +218,12 @@ i_contracted: ;
         FINT i_sh = shls[0]; \
         FINT j_sh = shls[1]; \
         CINTOpt *opt = envs->opt; \
-        if (opt->pairdata != NULL && \
-            opt->pairdata[i_sh*opt->nbas+j_sh] == NOVALUE) { \
-                return 0; \
+        PairData *pdata_base, *pdata_ij; \
+        if (opt->pairdata != NULL) { \
+                pdata_base = CINTOpt_pairdata(opt, i_sh, j_sh, envs->atm, bas, env); \
+                if (pdata_base == NOVALUE) { \
+                        return 0; \
+                } \
         } \
         FINT k_sh = shls[2]; \
         FINT i_ctr = envs->x_ctr[0]; \
@@ -237,10 +240,7 @@ i_contracted: ;
         double *ck = env + bas(PTR_COEFF, k_sh); \
         double expcutoff = envs->expcutoff; \
         double rr_ij = SQUARE(envs->rirj); \
-        PairData *pdata_base, *pdata_ij; \
-        if (opt->pairdata != NULL) { \
-                pdata_base = opt->pairdata[i_sh*opt->nbas+j_sh]; \
-        } else { \
+        if (opt->pairdata == NULL) { \
                 double *log_maxci = opt->log_max_coeff[i_sh]; \
                 double *log_maxcj = opt->log_max_coeff[j_sh]; \
                 MALLOC_INSTACK(pdata_base, i_prim*j_prim); \
@@ -582,6 +582,9 @@ CACHE_SIZE_T CINT3c2e_drv(double *out, FINT *dims, CINTEnvVars *envs, CINTOpt *o
 
         FINT n;
         FINT empty = 1;
+        if (opt != NULL && opt->mixed_precision) {
+                CINTg2e_f32_kernels(envs);
+        }
         if (opt != NULL) {
                 envs->opt = opt;
                 n = ((envs->x_ctr[0]==1) << 2) + ((envs->x_ctr[1]==1) << 1) + (envs->x_ctr[2]==1);
@@ -689,6 +692,361 @@ CACHE_SIZE_T CINT3c2e_spinor_drv(double complex *out, FINT *dims, CINTEnvVars *e
         return !empty;
 }
 
+/*
+ * Lattice sum over the images of the third shell
+ *      (i j|k) = \sum_L (i j|k(r-L))
+ * The images of shell k are kept when the distance between the image and
+ * the segment ri-rj is smaller than rcut. For the short-range Coulomb
+ * interaction (omega < 0), the distance is further bounded by the decay
+ * exp(-theta*a0*R^2) of the most diffuse primitives. The images are summed in
+ * the primitive loop, before the contraction of shell k, and the pair data of
+ * the ij pair are computed once for all images.
+ */
+static FINT _3c2e_lattice_images(double *rimgs, CINTEnvVars *envs, double *cache,
+                                 double *lattice, double rcut, double cutoff)
+{
+        FINT *shls = envs->shls;
+        FINT *bas = envs->bas;
+        double *env = envs->env;
+        double *ri = envs->ri;
+        double *rj = envs->rj;
+        double *rk = envs->rk;
+        double rmax = rcut;
+        double omega = env[PTR_RANGE_OMEGA];
+        FINT n;
+        if (omega < 0) {
+                // CINTg0_2e drops the primitives of theta*a0*|rk-rij|^2 > cutoff.
+                // theta*a0 is smallest for the most diffuse primitives
+                FINT i_prim = bas(NPRIM_OF, shls[0]);
+                FINT j_prim = bas(NPRIM_OF, shls[1]);
+                FINT k_prim = bas(NPRIM_OF, shls[2]);
+                double *ai = env + bas(PTR_EXP, shls[0]);
+                double *aj = env + bas(PTR_EXP, shls[1]);
+                double *ak = env + bas(PTR_EXP, shls[2]);
+                double ai_min = ai[0];
+                double aj_min = aj[0];
+                double ak_min = ak[0];
+                for (n = 1; n < i_prim; n++) {
+                        ai_min = MIN(ai_min, ai[n]);
+                }
+                for (n = 1; n < j_prim; n++) {
+                        aj_min = MIN(aj_min, aj[n]);
+                }
+                for (n = 1; n < k_prim; n++) {
+                        ak_min = MIN(ak_min, ak[n]);
+                }
+                double aij = ai_min + aj_min;
+                double a0 = aij * ak_min / (aij + ak_min);
+                double omega2 = omega * omega;
+                double theta = omega2 / (omega2 + a0);
+                rmax = MIN(rmax, sqrt(MAX(cutoff, 0.) / (theta * a0)));
+        }
+
+        // the images within rmax of the segment ri-rj are within
+        // rmax+|ri-rj|/2 of the middle point of the segment
+        double half_ij = .5 * sqrt(SQUARE(envs->rirj));
+        double r0[3];
+        r0[0] = rk[0] - .5 * (ri[0] + rj[0]);
+        r0[1] = rk[1] - .5 * (ri[1] + rj[1]);
+        r0[2] = rk[2] - .5 * (ri[2] + rj[2]);
+        double *Ls = cache;
+        FINT nL = CINTlattice_translations(Ls, lattice, r0, rmax+half_ij);
+
+        double rij[3], rk_L[3];
+        rij[0] = rj[0] - ri[0];
+        rij[1] = rj[1] - ri[1];
+        rij[2] = rj[2] - ri[2];
+        double rr_ij = SQUARE(rij);
+        double rr_max = rmax * rmax;
+        double t, d[3];
+        FINT nimgs = 0;
+        for (n = 0; n < nL; n++) {
+                rk_L[0] = rk[0] + Ls[n*3+0];
+                rk_L[1] = rk[1] + Ls[n*3+1];
+                rk_L[2] = rk[2] + Ls[n*3+2];
+                // the closest point of the segment ri-rj
+                t = 0;
+                if (rr_ij > 0) {
+                        t = ((rk_L[0]-ri[0])*rij[0] + (rk_L[1]-ri[1])*rij[1]
+                             + (rk_L[2]-ri[2])*rij[2]) / rr_ij;
+                        t = MIN(MAX(t, 0.), 1.);
+                }
+                d[0] = rk_L[0] - ri[0] - t * rij[0];
+                d[1] = rk_L[1] - ri[1] - t * rij[1];
+                d[2] = rk_L[2] - ri[2] - t * rij[2];
+                if (SQUARE(d) <= rr_max) {
+                        rimgs[nimgs*3+0] = rk_L[0];
+                        rimgs[nimgs*3+1] = rk_L[1];
+                        rimgs[nimgs*3+2] = rk_L[2];
+                        nimgs++;
+                }
+        }
+        return nimgs;
+}
+
+static FINT _3c2e_lattice_loop(double *gctr, CINTEnvVars *envs, double *cache, FINT *empty,
+                               double *rimgs, double *lattice, double rcut)
+{
+        FINT *shls  = envs->shls;
+        FINT *bas = envs->bas;
+        double *env = envs->env;
+        FINT i_sh = shls[0];
+        FINT j_sh = shls[1];
+        FINT k_sh = shls[2];
+        FINT i_ctr = envs->x_ctr[0];
+        FINT j_ctr = envs->x_ctr[1];
+        FINT k_ctr = envs->x_ctr[2];
+        FINT i_prim = bas(NPRIM_OF, i_sh);
+        FINT j_prim = bas(NPRIM_OF, j_sh);
+        FINT k_prim = bas(NPRIM_OF, k_sh);
+        double *ai = env + bas(PTR_EXP, i_sh);
+        double *aj = env + bas(PTR_EXP, j_sh);
+        double *ak = env + bas(PTR_EXP, k_sh);
+        double *ci = env + bas(PTR_COEFF, i_sh);
+        double *cj = env + bas(PTR_COEFF, j_sh);
+        double *ck = env + bas(PTR_COEFF, k_sh);
+        CINTOpt *opt = envs->opt;
+
+        double expcutoff = envs->expcutoff;
+        double rr_ij = SQUARE(envs->rirj);
+        PairData *pdata_base, *pdata_ij;
+        if (opt != NULL && opt->pairdata != NULL) {
+                pdata_base = CINTOpt_pairdata(opt, i_sh, j_sh, envs->atm, bas, env);
+                if (pdata_base == NOVALUE) {
+                        return 0;
+                }
+        } else {
+                double *log_maxci, *log_maxcj;
+                MALLOC_INSTACK(log_maxci, i_prim+j_prim);
+                MALLOC_INSTACK(pdata_base, i_prim*j_prim);
+                log_maxcj = log_maxci + i_prim;
+                CINTOpt_log_max_pgto_coeff(log_maxci, ci, i_prim, i_ctr);
+                CINTOpt_log_max_pgto_coeff(log_maxcj, cj, j_prim, j_ctr);
+                if (CINTset_pairdata(pdata_base, ai, aj, envs->ri, envs->rj,
+                                     log_maxci, log_maxcj, envs->li_ceil, envs->lj_ceil,
+                                     i_prim, j_prim, rr_ij, expcutoff, env)) {
+                        return 0;
+                }
+        }
+
+        FINT n_comp = envs->ncomp_e1 * envs->ncomp_tensor;
+        size_t nf = envs->nf;
+        double fac1i, fac1j, fac1k;
+        FINT ip, jp, kp, n;
+        FINT _empty[4] = {1, 1, 1, 1};
+        FINT *iempty = _empty + 0;
+        FINT *jempty = _empty + 1;
+        FINT *kempty = _empty + 2;
+        FINT *gempty = _empty + 3;
+
+        double expij, cutoff;
+        double *rij;
+        double *rkl = envs->rkl;
+        double omega = env[PTR_RANGE_OMEGA];
+        if (omega < 0 && envs->rys_order > 1) {
+                double r_guess = 8.;
+                double omega2 = omega * omega;
+                int lij = envs->li_ceil + envs->lj_ceil;
+                if (lij > 0) {
+                        double dist_ij = sqrt(rr_ij);
+                        double aij = ai[i_prim-1] + aj[j_prim-1];
+                        double theta = omega2 / (omega2 + aij);
+                        expcutoff += lij * approx_log(
+                                (dist_ij+theta*r_guess+1.)/(dist_ij+1.));
+                }
+                if (envs->lk_ceil > 0) {
+                        double theta = omega2 / (omega2 + ak[k_prim-1]);
+                        expcutoff += envs->lk_ceil * approx_log(theta*r_guess+1.);
+                }
+        }
+
+        double cceij_min = pdata_base[0].cceij;
+        for (n = 1; n < i_prim*j_prim; n++) {
+                cceij_min = MIN(cceij_min, pdata_base[n].cceij);
+        }
+        FINT nimgs = _3c2e_lattice_images(rimgs, envs, cache, lattice, rcut,
+                                          expcutoff - cceij_min);
+        if (nimgs == 0) {
+                return 0;
+        }
+
+        FINT *idx;
+        MALLOC_INSTACK(idx, nf * 3);
+        CINTg2e_index_xyz(idx, envs);
+
+        FINT *non0ctri, *non0ctrj, *non0ctrk;
+        FINT *non0idxi, *non0idxj, *non0idxk;
+        MALLOC_INSTACK(non0ctri, i_prim+j_prim+k_prim+i_prim*i_ctr+j_prim*j_ctr+k_prim*k_ctr);
+        non0ctrj = non0ctri + i_prim;
+        non0ctrk = non0ctrj + j_prim;
+        non0idxi = non0ctrk + k_prim;
+        non0idxj = non0idxi + i_prim*i_ctr;
+        non0idxk = non0idxj + j_prim*j_ctr;
+        CINTOpt_non0coeff_byshell(non0idxi, non0ctri, ci, i_prim, i_ctr);
+        CINTOpt_non0coeff_byshell(non0idxj, non0ctrj, cj, j_prim, j_ctr);
+        CINTOpt_non0coeff_byshell(non0idxk, non0ctrk, ck, k_prim, k_ctr);
+
+        FINT nc = i_ctr * j_ctr * k_ctr;
+        size_t leng = envs->g_size * 3 * ((1<<envs->gbits)+1);
+        size_t lenk = nf * nc * n_comp; // gctrk
+        size_t lenj = nf * i_ctr * j_ctr * n_comp; // gctrj
+        size_t leni = nf * i_ctr * n_comp; // gctri
+        size_t len0 = nf * n_comp; // gout
+        size_t len = leng + lenk + lenj + leni + len0;
+        double *g;
+        MALLOC_INSTACK(g, len);  // must be allocated last in this function
+        double *g1 = g + leng;
+        double *gout, *gctri, *gctrj, *gctrk;
+
+        ALIAS_ADDR_IF_EQUAL(k, m);
+        ALIAS_ADDR_IF_EQUAL(j, k);
+        ALIAS_ADDR_IF_EQUAL(i, j);
+        ALIAS_ADDR_IF_EQUAL(g, i);
+
+        for (kp = 0; kp < k_prim; kp++) {
+                envs->ak[0] = ak[kp];
+                if (k_ctr == 1) {
+                        fac1k = envs->common_factor * ck[kp];
+                } else {
+                        fac1k = envs->common_factor;
+                        *jempty = 1;
+                }
+
+                // The images are summed into gctrj, the contraction of
+                // shell k is applied once for all images
+                for (n = 0; n < nimgs; n++) {
+                        envs->rk = rimgs + n * 3;
+                        envs->rx_in_rklrx = envs->rk;
+                        rkl[0] = envs->rk[0];
+                        rkl[1] = envs->rk[1];
+                        rkl[2] = envs->rk[2];
+                        envs->rkrl[0] = envs->rk[0];
+                        envs->rkrl[1] = envs->rk[1];
+                        envs->rkrl[2] = envs->rk[2];
+
+                        pdata_ij = pdata_base;
+                        for (jp = 0; jp < j_prim; jp++) {
+                                envs->aj[0] = aj[jp];
+                                if (j_ctr == 1) {
+                                        fac1j = fac1k * cj[jp];
+                                } else {
+                                        fac1j = fac1k;
+                                        *iempty = 1;
+                                }
+                                for (ip = 0; ip < i_prim; ip++, pdata_ij++) {
+                                        if (pdata_ij->cceij > expcutoff) {
+                                                goto i_contracted;
+                                        }
+                                        envs->ai[0] = ai[ip];
+                                        expij = pdata_ij->eij;
+                                        rij = pdata_ij->rij;
+                                        cutoff = expcutoff - pdata_ij->cceij;
+                                        if (i_ctr == 1) {
+                                                fac1i = fac1j*ci[ip]*expij;
+                                        } else {
+                                                fac1i = fac1j*expij;
+                                        }
+                                        envs->fac[0] = fac1i;
+                                        if ((*envs->f_g0_2e)(g, rij, rkl, cutoff, envs)) {
+                                                (*envs->f_gout)(gout, g, idx, envs, *gempty);
+                                                PRIM2CTR0(i, gout, len0);
+                                        }
+i_contracted: ;
+                                } // end loop i_prim
+                                if (!*iempty) {
+                                        PRIM2CTR0(j, gctri, leni);
+                                }
+                        } // end loop j_prim
+                } // end loop images
+                if (!*jempty) {
+                        PRIM2CTR0(k, gctrj, lenj);
+                }
+        } // end loop k_prim
+
+        if (n_comp > 1 && !*kempty) {
+                TRANSPOSE(gctrk);
+        }
+        return !*empty;
+}
+
+/*
+ * lattice[3][3] holds the lattice vectors (one vector per row). rcut is the
+ * largest distance between the images of shell k and the segment ri-rj.
+ */
+CACHE_SIZE_T CINT3c2e_lattice_drv(double *out, FINT *dims, CINTEnvVars *envs, CINTOpt *opt,
+                                  double *cache, void (*f_e1_c2s)(), FINT is_ssc,
+                                  double *lattice, double rcut)
+{
+        FINT *x_ctr = envs->x_ctr;
+        size_t nc = envs->nf * x_ctr[0] * x_ctr[1] * x_ctr[2];
+        FINT n_comp = envs->ncomp_e1 * envs->ncomp_tensor;
+        double half_ij = .5 * sqrt(SQUARE(envs->rirj));
+        // translations of CINTlattice_translations and the image coordinates
+        size_t nL = CINTlattice_translations(NULL, lattice, NULL, rcut+half_ij);
+        if (out == NULL) {
+                PAIRDATA_NON0IDX_SIZE(pdata_size);
+                CACHE_SIZE_T leng = envs->g_size*3*((1<<envs->gbits)+1);
+                CACHE_SIZE_T len0 = envs->nf*n_comp;
+                CACHE_SIZE_T cache_size = MAX(leng+len0+nc*n_comp*3 + pdata_size,
+                                      nc*n_comp+envs->nf*3);
+                return cache_size + nL * 6;
+        }
+        double *stack = NULL;
+        if (cache == NULL) {
+                PAIRDATA_NON0IDX_SIZE(pdata_size);
+                size_t leng = envs->g_size*3*((1<<envs->gbits)+1);
+                size_t len0 = envs->nf*n_comp;
+                size_t cache_size = MAX(leng+len0+nc*n_comp*3 + pdata_size,
+                                      nc*n_comp+envs->nf*3);
+                stack = malloc(sizeof(double)*(cache_size + nL*6));
+                cache = stack;
+        }
+        double *gctr, *rimgs;
+        MALLOC_INSTACK(gctr, nc*n_comp);
+        MALLOC_INSTACK(rimgs, nL*3);
+
+        FINT n;
+        FINT empty = 1;
+        if (opt != NULL && opt->mixed_precision) {
+                CINTg2e_f32_kernels(envs);
+        }
+        envs->opt = opt;
+        _3c2e_lattice_loop(gctr, envs, cache, &empty, rimgs, lattice, rcut);
+
+        FINT counts[4];
+        if (f_e1_c2s == &c2s_sph_3c2e1) {
+                counts[0] = (envs->i_l*2+1) * x_ctr[0];
+                counts[1] = (envs->j_l*2+1) * x_ctr[1];
+                if (is_ssc) {
+                        counts[2] = envs->nfk * x_ctr[2];
+                } else {
+                        counts[2] = (envs->k_l*2+1) * x_ctr[2];
+                }
+        } else {
+                counts[0] = envs->nfi * x_ctr[0];
+                counts[1] = envs->nfj * x_ctr[1];
+                counts[2] = envs->nfk * x_ctr[2];
+        }
+        counts[3] = 1;
+        if (dims == NULL) {
+                dims = counts;
+        }
+        FINT nout = dims[0] * dims[1] * dims[2];
+        if (!empty) {
+                for (n = 0; n < n_comp; n++) {
+                        (*f_e1_c2s)(out+nout*n, gctr+nc*n, dims, envs, cache);
+                }
+        } else {
+                for (n = 0; n < n_comp; n++) {
+                        c2s_dset0(out+nout*n, dims, counts);
+                }
+        }
+        if (stack != NULL) {
+                free(stack);
+        }
+        return !empty;
+}
+
 
 CACHE_SIZE_T int3c2e_sph(double *out, FINT *dims, FINT *shls, FINT *atm, FINT natm,
                 FINT *bas, FINT nbas, double *env, CINTOpt *opt, double *cache)
@@ -699,6 +1057,67 @@ CACHE_SIZE_T int3c2e_sph(double *out, FINT *dims, FINT *shls, FINT *atm, FINT na
         envs.f_gout = &CINTgout2e;
         return CINT3c2e_drv(out, dims, &envs, opt, cache, &c2s_sph_3c2e1, 0);
 }
+/*
+ * int3c2e_sph with the mixed precision kernels and float output
+ */
+CACHE_SIZE_T int3c2e_sph_f32(float *out, FINT *dims, FINT *shls, FINT *atm, FINT natm,
+                             FINT *bas, FINT nbas, double *env, CINTOpt *opt, double *cache)
+{
+        FINT ng[] = {0, 0, 0, 0, 0, 1, 1, 1};
+        CINTEnvVars envs;
+        CINTinit_int3c2e_EnvVars(&envs, ng, shls, atm, natm, bas, nbas, env);
+        envs.f_gout = &CINTgout2e;
+        CINTg2e_f32_kernels(&envs);
+        FINT counts[3];
+        counts[0] = CINTcgto_spheric(shls[0], bas);
+        counts[1] = CINTcgto_spheric(shls[1], bas);
+        counts[2] = CINTcgto_spheric(shls[2], bas);
+        size_t nout = counts[0] * counts[1] * counts[2];
+        if (out == NULL) {
+                return CINT3c2e_drv(NULL, NULL, &envs, opt, cache, &c2s_sph_3c2e1, 0) + nout;
+        }
+        double *stack = NULL;
+        if (cache == NULL) {
+                size_t cache_size = CINT3c2e_drv(NULL, NULL, &envs, opt, NULL,
+                                                 &c2s_sph_3c2e1, 0) + nout;
+                stack = malloc(sizeof(double)*cache_size);
+                cache = stack;
+        }
+        double *buf;
+        MALLOC_INSTACK(buf, nout);
+        CACHE_SIZE_T has_value = CINT3c2e_drv(buf, NULL, &envs, opt, cache,
+                                              &c2s_sph_3c2e1, 0);
+        CINTdcopy_f32(out, buf, dims, counts, 3);
+        if (stack != NULL) {
+                free(stack);
+        }
+        return has_value;
+}
+/*
+ * int3c2e summed over the images of shell k, see CINT3c2e_lattice_drv
+ */
+CACHE_SIZE_T int3c2e_sph_lattice(double *out, FINT *dims, FINT *shls, FINT *atm, FINT natm,
+                                 FINT *bas, FINT nbas, double *env, CINTOpt *opt,
+                                 double *cache, double *lattice, double rcut)
+{
+        FINT ng[] = {0, 0, 0, 0, 0, 1, 1, 1};
+        CINTEnvVars envs;
+        CINTinit_int3c2e_EnvVars(&envs, ng, shls, atm, natm, bas, nbas, env);
+        envs.f_gout = &CINTgout2e;
+        return CINT3c2e_lattice_drv(out, dims, &envs, opt, cache, &c2s_sph_3c2e1, 0,
+                                    lattice, rcut);
+}
+CACHE_SIZE_T int3c2e_cart_lattice(double *out, FINT *dims, FINT *shls, FINT *atm, FINT natm,
+                                  FINT *bas, FINT nbas, double *env, CINTOpt *opt,
+                                  double *cache, double *lattice, double rcut)
+{
+        FINT ng[] = {0, 0, 0, 0, 0, 1, 1, 1};
+        CINTEnvVars envs;
+        CINTinit_int3c2e_EnvVars(&envs, ng, shls, atm, natm, bas, nbas, env);
+        envs.f_gout = &CINTgout2e;
+        return CINT3c2e_lattice_drv(out, dims, &envs, opt, cache, &c2s_cart_3c2e1, 0,
+                                    lattice, rcut);
+}
 void int3c2e_optimizer(CINTOpt **opt, FINT *atm, FINT natm,
                        FINT *bas, FINT nbas, double *env)
 {
@@ -0,0 +1,482 @@
+/*
+ * Copyright (C) 2013-  Qiming Sun <osirpt.sun@gmail.com>
+ *
+ * Runtime code generation for integrals of custom operators.
+ *
+ * The operator expression is written in the mini-language of
+ * scripts/gen-code.cl, e.g. "( \\| rc rc rc \\| )" or "( \\, \\| nabla \\, )".
+ * CINTjit_intor runs gen-cint on it, compiles the generated code with the
+ * system C compiler into a shared object and loads the requested function.
+ * The shared object is cached under the key of the name, the expression
+ * and CINT_VERSION, so the code is generated and compiled only once.
+ *
+ * The scripts and the headers the generated code includes are installed in
+ * the data directory CINT_JIT_DATADIR, which is relative to the directory
+ * of the loaded libcint.so (../share/libcint for the default layout). The
+ * paths can be overridden by environment variables, which is needed to run
+ * from a build tree
+ *      LIBCINT_JIT_CACHE    directory of the cached code (~/.cache/libcint)
+ *      LIBCINT_JIT_SCRIPTS  directory of gen-code.cl (<datadir>/scripts)
+ *      LIBCINT_JIT_CLISP    lisp interpreter (clisp)
+ *      LIBCINT_JIT_CC       C compiler (cc)
+ *      LIBCINT_JIT_CFLAGS   compiler flags, separated by white spaces without
+ *                           any quoting (-I<datadir>/include)
+ *      LIBCINT_JIT_LIBDIR   directory of libcint.so (of the loaded library)
+ *
+ * The expression is checked against the syntax of the operators before it
+ * is written to the lisp code. clisp and the compiler are executed
+ * directly, not through a shell.
+ *
+ * The code is generated and compiled in the files <key>.<pid>.* of the
+ * cache, so that processes sharing the cache do not overwrite each other.
+ * They are removed once the shared object is in place and kept with the
+ * compiler log on failure.
+ *
+ * CINTjit_intor is not thread-safe. Call it before entering parallel
+ * regions.
+ */
+
+// dladdr
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <unistd.h>
+#include <dlfcn.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "config.h"
+
+#define PATH_LEN        4096
+#define MAX_ARGS        64
+
+static const char *_getenv(const char *key, const char *default_value)
+{
+        const char *val = getenv(key);
+        if (val == NULL || val[0] == '\0') {
+                return default_value;
+        }
+        return val;
+}
+
+// snprintf which fails if the output is truncated
+static int _format(char *buf, size_t size, const char *fmt, ...)
+{
+        va_list ap;
+        va_start(ap, fmt);
+        int n = vsnprintf(buf, size, fmt, ap);
+        va_end(ap);
+        if (n < 0 || (size_t)n >= size) {
+                fprintf(stderr, "CINTjit: path too long: %.80s...\n", buf);
+                return 0;
+        }
+        return 1;
+}
+
+// FNV-1a
+static unsigned long long _hash(const char *s, unsigned long long h)
+{
+        for (; *s != '\0'; s++) {
+                h ^= (unsigned char)*s;
+                h *= 0x100000001b3ULL;
+        }
+        // separator
+        h ^= 0xff;
+        h *= 0x100000001b3ULL;
+        return h;
+}
+
+static int _valid_name(const char *name)
+{
+        const char *p;
+        if (name[0] == '\0') {
+                return 0;
+        }
+        for (p = name; *p != '\0'; p++) {
+                if (!(('a' <= *p && *p <= 'z') || ('A' <= *p && *p <= 'Z') ||
+                      ('0' <= *p && *p <= '9') || *p == '_')) {
+                        return 0;
+                }
+        }
+        return 1;
+}
+
+// paths are double-quoted strings in the lisp code
+static int _valid_path(const char *path)
+{
+        return strchr(path, '"') == NULL && strchr(path, '\\') == NULL;
+}
+
+static int _atom_char(char c)
+{
+        return (('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') ||
+                ('0' <= c && c <= '9') || c == '-' || c == '+' ||
+                c == '.' || c == '*' || c == '_');
+}
+
+static const char *_skip_spaces(const char *p)
+{
+        while (*p == ' ' || *p == '\t') {
+                p++;
+        }
+        return p;
+}
+
+/*
+ * The expression is a list of the gen-code.cl syntax
+ *      ( item ... )
+ * where an item is the separator \| or \, an operator or a number like
+ * rc, nabla-rinv, p*, -.5, or a complex number #C(re im).
+ */
+static int _valid_expr(const char *expr)
+{
+        const char *p = _skip_spaces(expr);
+        if (*p != '(') {
+                return 0;
+        }
+        p++;
+        while (1) {
+                p = _skip_spaces(p);
+                if (*p == ')') {
+                        p = _skip_spaces(p + 1);
+                        return *p == '\0';
+                } else if (*p == '\\') {
+                        if (p[1] != '|' && p[1] != ',') {
+                                return 0;
+                        }
+                        p += 2;
+                } else if (strncmp(p, "#C(", 3) == 0) {
+                        p += 3;
+                        FINT nparts;
+                        for (nparts = 0; nparts < 2; nparts++) {
+                                p = _skip_spaces(p);
+                                if (!_atom_char(*p)) {
+                                        return 0;
+                                }
+                                while (_atom_char(*p)) {
+                                        p++;
+                                }
+                        }
+                        p = _skip_spaces(p);
+                        if (*p != ')') {
+                                return 0;
+                        }
+                        p++;
+                } else if (_atom_char(*p)) {
+                        while (_atom_char(*p)) {
+                                p++;
+                        }
+                } else {
+                        return 0;
+                }
+        }
+}
+
+/*
+ * Directory of the loaded libcint.so
+ */
+static int _lib_dir(char *dir)
+{
+        static int anchor;
+        Dl_info info;
+        if (dladdr(&anchor, &info) == 0 || info.dli_fname == NULL) {
+                fprintf(stderr, "CINTjit: cannot locate libcint\n");
+                return 0;
+        }
+        const char *slash = strrchr(info.dli_fname, '/');
+        if (slash == NULL) {
+                return _format(dir, PATH_LEN, ".");
+        }
+        return _format(dir, PATH_LEN, "%.*s",
+                       (int)(slash - info.dli_fname), info.dli_fname);
+}
+
+/*
+ * Runs argv with stdout and stderr redirected to log in the working
+ * directory cwd (the current directory if NULL). Returns 1 if the command
+ * exits with status 0.
+ */
+static int _run(char **argv, const char *cwd, const char *log, int append)
+{
+        pid_t pid = fork();
+        if (pid < 0) {
+                fprintf(stderr, "CINTjit: cannot run %s\n", argv[0]);
+                return 0;
+        }
+        if (pid == 0) {
+                int flags = O_WRONLY | O_CREAT | (append ? O_APPEND : O_TRUNC);
+                int fd = open(log, flags, 0644);
+                if (fd < 0 || dup2(fd, STDOUT_FILENO) < 0 ||
+                    dup2(fd, STDERR_FILENO) < 0 ||
+                    (cwd != NULL && chdir(cwd) != 0)) {
+                        _exit(127);
+                }
+                close(fd);
+                execvp(argv[0], argv);
+                _exit(127);
+        }
+        int status;
+        while (waitpid(pid, &status, 0) < 0) {
+                if (errno != EINTR) {
+                        return 0;
+                }
+        }
+        return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+static int _cache_dir(char *dir)
+{
+        const char *env_dir = getenv("LIBCINT_JIT_CACHE");
+        if (env_dir != NULL && env_dir[0] != '\0') {
+                if (!_format(dir, PATH_LEN, "%s", env_dir)) {
+                        return 0;
+                }
+        } else {
+                const char *home = _getenv("HOME", "/tmp");
+                char parent[PATH_LEN];
+                if (!_format(parent, PATH_LEN, "%s/.cache", home) ||
+                    !_format(dir, PATH_LEN, "%s/.cache/libcint", home)) {
+                        return 0;
+                }
+                mkdir(parent, 0755);
+        }
+        mkdir(dir, 0755);
+        struct stat st;
+        if (stat(dir, &st) != 0 || !S_ISDIR(st.st_mode)) {
+                fprintf(stderr, "CINTjit: cannot create cache directory %s\n", dir);
+                return 0;
+        }
+        // clisp runs in the directory of the scripts. The paths of the
+        // temporary files have to be absolute
+        char abs_dir[PATH_MAX];
+        if (realpath(dir, abs_dir) == NULL) {
+                fprintf(stderr, "CINTjit: cannot resolve cache directory %s\n", dir);
+                return 0;
+        }
+        return _format(dir, PATH_LEN, "%s", abs_dir);
+}
+
+static int _file_exists(const char *path)
+{
+        struct stat st;
+        return stat(path, &st) == 0;
+}
+
+static void _remove(const char *tmp, const char *ext)
+{
+        char path[PATH_LEN];
+        if (_format(path, PATH_LEN, "%s%s", tmp, ext)) {
+                remove(path);
+        }
+}
+
+/*
+ * Generates tmp.c from the expression. tmp is the base name of the
+ * temporary files of this process.
+ */
+static int _generate(const char *tmp, const char *datadir,
+                     const char *name, const char *expr)
+{
+        const char *scripts = getenv("LIBCINT_JIT_SCRIPTS");
+        const char *clisp = _getenv("LIBCINT_JIT_CLISP", "clisp");
+        char default_scripts[PATH_LEN];
+        char path[PATH_LEN];
+        char log[PATH_LEN];
+        char c_file[PATH_LEN];
+        if (scripts == NULL || scripts[0] == '\0') {
+                if (!_format(default_scripts, PATH_LEN, "%s/scripts", datadir)) {
+                        return 0;
+                }
+                scripts = default_scripts;
+        }
+        if (!_format(path, PATH_LEN, "%s.cl", tmp) ||
+            !_format(log, PATH_LEN, "%s.log", tmp) ||
+            !_format(c_file, PATH_LEN, "%s.c", tmp)) {
+                return 0;
+        }
+
+        FILE *fp = fopen(path, "w");
+        if (fp == NULL) {
+                fprintf(stderr, "CINTjit: cannot write %s\n", path);
+                return 0;
+        }
+        fprintf(fp, "(load \"gen-code.cl\")\n");
+        fprintf(fp, "(gen-cint \"%s.c\"\n  '(\"%s\" %s))\n", tmp, name, expr);
+        fclose(fp);
+
+        // gen-code.cl loads its dependencies from the working directory
+        char *argv[] = {(char *)clisp, path, NULL};
+        if (!_run(argv, scripts, log, 0) || !_file_exists(c_file)) {
+                fprintf(stderr, "CINTjit: failed to generate code for %s. "
+                        "See %s.log\n", name, tmp);
+                return 0;
+        }
+        return 1;
+}
+
+/*
+ * Compiles tmp.c to tmp.so then renames it to so, so that other processes
+ * never load a partially written object.
+ */
+static int _compile(const char *tmp, const char *so, const char *libdir,
+                    const char *datadir, const char *name)
+{
+        const char *cc = _getenv("LIBCINT_JIT_CC", "cc");
+        const char *env_cflags = getenv("LIBCINT_JIT_CFLAGS");
+        char cflags[PATH_LEN];
+        char c_file[PATH_LEN];
+        char tmp_so[PATH_LEN];
+        char log[PATH_LEN];
+        char lib_flag[PATH_LEN];
+        char rpath_flag[PATH_LEN];
+        char *argv[MAX_ARGS];
+        FINT nargs = 0;
+        if (!_format(c_file, PATH_LEN, "%s.c", tmp) ||
+            !_format(tmp_so, PATH_LEN, "%s.so", tmp) ||
+            !_format(log, PATH_LEN, "%s.log", tmp) ||
+            !_format(lib_flag, PATH_LEN, "-L%s", libdir) ||
+            !_format(rpath_flag, PATH_LEN, "-Wl,-rpath,%s", libdir)) {
+                return 0;
+        }
+
+        argv[nargs++] = (char *)cc;
+        argv[nargs++] = "-O2";
+        argv[nargs++] = "-fPIC";
+        argv[nargs++] = "-shared";
+        if (env_cflags == NULL || env_cflags[0] == '\0') {
+                if (!_format(cflags, PATH_LEN, "-I%s/include", datadir)) {
+                        return 0;
+                }
+                argv[nargs++] = cflags;
+        } else {
+                if (!_format(cflags, PATH_LEN, "%s", env_cflags)) {
+                        return 0;
+                }
+                char *flag;
+                for (flag = strtok(cflags, " \t\n"); flag != NULL;
+                     flag = strtok(NULL, " \t\n")) {
+                        // 10 more arguments below
+                        if (nargs >= MAX_ARGS - 10) {
+                                fprintf(stderr, "CINTjit: too many flags in "
+                                        "LIBCINT_JIT_CFLAGS\n");
+                                return 0;
+                        }
+                        argv[nargs++] = flag;
+                }
+        }
+        argv[nargs++] = c_file;
+        argv[nargs++] = "-o";
+        argv[nargs++] = tmp_so;
+        argv[nargs++] = lib_flag;
+        argv[nargs++] = rpath_flag;
+        argv[nargs++] = "-lcint";
+        argv[nargs++] = "-lm";
+        argv[nargs++] = NULL;
+
+        if (!_run(argv, NULL, log, 1) || rename(tmp_so, so) != 0) {
+                fprintf(stderr, "CINTjit: failed to compile %s. See %s.log\n",
+                        name, tmp);
+                remove(tmp_so);
+                return 0;
+        }
+        return 1;
+}
+
+static void *_jit_symbol(const char *name, const char *expr, const char *suffix)
+{
+        if (!_valid_name(name)) {
+                fprintf(stderr, "CINTjit: invalid integral name %s\n", name);
+                return NULL;
+        }
+        if (!_valid_expr(expr)) {
+                fprintf(stderr, "CINTjit: invalid operator expression %s\n", expr);
+                return NULL;
+        }
+
+        char dir[PATH_LEN];
+        char so[PATH_LEN];
+        char tmp[PATH_LEN];
+        char symbol[PATH_LEN];
+        if (!_cache_dir(dir) || !_valid_path(dir)) {
+                return NULL;
+        }
+        unsigned long long key = 0xcbf29ce484222325ULL;
+        key = _hash(CINT_VERSION, key);
+        key = _hash(name, key);
+        key = _hash(expr, key);
+        if (!_format(so, PATH_LEN, "%s/%s-%016llx.so", dir, name, key) ||
+            !_format(tmp, PATH_LEN, "%s/%s-%016llx.%ld", dir, name, key,
+                     (long)getpid()) ||
+            !_format(symbol, PATH_LEN, "%s_%s", name, suffix)) {
+                return NULL;
+        }
+
+        if (!_file_exists(so)) {
+                const char *libdir = getenv("LIBCINT_JIT_LIBDIR");
+                char default_libdir[PATH_LEN];
+                char datadir[PATH_LEN];
+                if (!_lib_dir(default_libdir) ||
+                    !_format(datadir, PATH_LEN, "%s/%s", default_libdir,
+                             CINT_JIT_DATADIR)) {
+                        return NULL;
+                }
+                if (libdir == NULL || libdir[0] == '\0') {
+                        libdir = default_libdir;
+                }
+                if (!_generate(tmp, datadir, name, expr) ||
+                    !_compile(tmp, so, libdir, datadir, name)) {
+                        return NULL;
+                }
+                _remove(tmp, ".cl");
+                _remove(tmp, ".c");
+                _remove(tmp, ".log");
+        }
+
+        void *handle = dlopen(so, RTLD_NOW | RTLD_LOCAL);
+        if (handle == NULL) {
+                fprintf(stderr, "CINTjit: %s\n", dlerror());
+                return NULL;
+        }
+        // The handle is kept open. The function pointers remain valid for
+        // the lifetime of the process.
+        void *fn = dlsym(handle, symbol);
+        if (fn == NULL) {
+                fprintf(stderr, "CINTjit: %s not found in %s\n", symbol, so);
+        }
+        return fn;
+}
+
+/*
+ * Returns the function <name>_<suffix> of the operator expression expr,
+ * NULL if the code cannot be generated, compiled or loaded. suffix can be
+ * "cart", "sph" or "spinor".
+ */
+CINTIntegralFunction *CINTjit_intor(const char *name, const char *expr,
+                                    const char *suffix)
+{
+        if (strcmp(suffix, "cart") != 0 && strcmp(suffix, "sph") != 0 &&
+            strcmp(suffix, "spinor") != 0) {
+                fprintf(stderr, "CINTjit: invalid suffix %s\n", suffix);
+                return NULL;
+        }
+        CINTIntegralFunction *fn;
+        // ISO C does not convert the void * of dlsym to a function pointer,
+        // see the example of dlsym(3)
+        *(void **)(&fn) = _jit_symbol(name, expr, suffix);
+        return fn;
+}
+
+/*
+ * Returns the function <name>_optimizer of the operator expression expr
+ */
+CINTOptimizerFunction *CINTjit_optimizer(const char *name, const char *expr)
+{
+        CINTOptimizerFunction *fn;
+        *(void **)(&fn) = _jit_symbol(name, expr, "optimizer");
+        return fn;
+}
@@ -0,0 +1,522 @@
+/*
+ * Coulomb matrix by the fast multipole method.
+ *
+ * The shell pairs (ij), i >= j, are sorted in an octree by the centers of
+ * their multipole expansions (see CINTOpt_set_multipole). The charges of the
+ * pairs, the moments contracted with the density matrix, are translated to
+ * the multipoles of the boxes from the leaves to the root. A dual tree
+ * traversal then lets each pair of boxes interact either through the
+ * multipole-to-local translation, when the boxes are well separated, or
+ * through the ERIs of the shell quartets when both boxes are leaves. At
+ * last the local expansions are translated from the root to the leaves and
+ * contracted with the moments of the pairs.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "cint_bas.h"
+#include "optimizer.h"
+#include "g1e.h"
+#include "multipole.h"
+#include "misc.h"
+#include "cart2sph.h"
+
+// max number of shell pairs in a leaf box
+#define FMM_LEAF_PAIRS  16
+#define FMM_MAX_DEPTH   24
+
+CACHE_SIZE_T int2e_sph(double *out, FINT *dims, FINT *shls, FINT *atm, FINT natm,
+                       FINT *bas, FINT nbas, double *env, CINTOpt *opt, double *cache);
+CACHE_SIZE_T int2e_cart(double *out, FINT *dims, FINT *shls, FINT *atm, FINT natm,
+                        FINT *bas, FINT nbas, double *env, CINTOpt *opt, double *cache);
+
+typedef struct {
+        FINT ish;
+        FINT jsh;
+        FINT nij;        // = di * dj
+        PairMultipole *pm;
+        double *moments; // [nmoments,dj,di] in the AOs of the integrals
+        double *dm;      // [dj,di], the densities of (ij) and (ji) summed
+        double *vj;      // [dj,di]
+        double *charges; // [nmoments], moments contracted with dm
+} FMMPair;
+
+typedef struct {
+        double center[3];
+        double half;     // half width of the box
+        double radius;   // radius of the pair densities around center
+        FINT pair0;      // pairs[pair0:pair1] are in the box
+        FINT pair1;
+        FINT child0;     // nodes[child0:child0+nchild] are the sub-boxes
+        FINT nchild;
+} FMMNode;
+
+typedef struct {
+        FMMNode *nodes;
+        FINT nnode;
+        FINT nnode_alloc;
+        FMMPair *pairs;
+        FINT npair;
+        FINT order;
+        FINT nmom;
+        double theta;
+        double *multipoles; // [nnode,nmoments] about the box centers
+        double *locals;     // [nnode,nmoments] about the box centers
+
+        CACHE_SIZE_T (*intor)();
+        FINT *atm;
+        FINT natm;
+        FINT *bas;
+        FINT nbas;
+        double *env;
+        CINTOpt *opt;
+        double *buf;
+        double *cache;
+        size_t cache_size;
+} FMMTree;
+
+static FINT _new_node(FMMTree *tree)
+{
+        if (tree->nnode == tree->nnode_alloc) {
+                tree->nnode_alloc = tree->nnode_alloc * 2 + 8;
+                tree->nodes = realloc(tree->nodes, sizeof(FMMNode) * tree->nnode_alloc);
+        }
+        return tree->nnode++;
+}
+
+/*
+ * Split the box into the non-empty octants until the number of pairs in a
+ * box is <= FMM_LEAF_PAIRS
+ */
+static void _build_node(FMMTree *tree, FINT inode, FINT depth, FMMPair *tmp)
+{
+        FMMNode *node = tree->nodes + inode;
+        FINT pair0 = node->pair0;
+        FINT pair1 = node->pair1;
+        node->child0 = 0;
+        node->nchild = 0;
+        if (pair1 - pair0 <= FMM_LEAF_PAIRS || depth >= FMM_MAX_DEPTH) {
+                return;
+        }
+
+        double center[3];
+        double half = node->half * .5;
+        center[0] = node->center[0];
+        center[1] = node->center[1];
+        center[2] = node->center[2];
+        FMMPair *pairs = tree->pairs;
+        FINT counts[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+        FINT offsets[9];
+        FINT n, oct, ic;
+        double *r;
+        for (n = pair0; n < pair1; n++) {
+                r = pairs[n].pm->center;
+                oct = ((r[0] > center[0]) << 2) + ((r[1] > center[1]) << 1)
+                    + (r[2] > center[2]);
+                counts[oct]++;
+        }
+        offsets[0] = pair0;
+        for (oct = 0; oct < 8; oct++) {
+                offsets[oct+1] = offsets[oct] + counts[oct];
+                counts[oct] = offsets[oct];
+        }
+        for (n = pair0; n < pair1; n++) {
+                r = pairs[n].pm->center;
+                oct = ((r[0] > center[0]) << 2) + ((r[1] > center[1]) << 1)
+                    + (r[2] > center[2]);
+                tmp[counts[oct]++] = pairs[n];
+        }
+        memcpy(pairs + pair0, tmp + pair0, sizeof(FMMPair) * (pair1 - pair0));
+
+        FINT child0 = tree->nnode;
+        FINT nchild = 0;
+        FMMNode *child;
+        for (oct = 0; oct < 8; oct++) {
+                if (offsets[oct] == offsets[oct+1]) {
+                        continue;
+                }
+                ic = _new_node(tree);
+                child = tree->nodes + ic;
+                child->center[0] = center[0] + ((oct & 4) ? half : -half);
+                child->center[1] = center[1] + ((oct & 2) ? half : -half);
+                child->center[2] = center[2] + ((oct & 1) ? half : -half);
+                child->half = half;
+                child->pair0 = offsets[oct];
+                child->pair1 = offsets[oct+1];
+                nchild++;
+        }
+        // tree->nodes may be reallocated by _new_node
+        node = tree->nodes + inode;
+        node->child0 = child0;
+        node->nchild = nchild;
+        for (ic = child0; ic < child0 + nchild; ic++) {
+                _build_node(tree, ic, depth+1, tmp);
+        }
+}
+
+/*
+ * Multipoles and radii of the boxes, from the leaves to the root. The
+ * children are always stored after their parents.
+ */
+static void _upward(FMMTree *tree)
+{
+        FINT nmom = tree->nmom;
+        FINT n, ic, ip;
+        FMMNode *node, *child;
+        FMMPair *pair;
+        double *q;
+        double d[3];
+        double radius;
+        for (n = tree->nnode - 1; n >= 0; n--) {
+                node = tree->nodes + n;
+                q = tree->multipoles + n * nmom;
+                CINTdset0(nmom, q);
+                radius = 0;
+                for (ic = node->child0; ic < node->child0 + node->nchild; ic++) {
+                        child = tree->nodes + ic;
+                        d[0] = child->center[0] - node->center[0];
+                        d[1] = child->center[1] - node->center[1];
+                        d[2] = child->center[2] - node->center[2];
+                        CINTmultipole_shift(q, tree->multipoles + ic * nmom, d,
+                                            tree->order, 1);
+                        radius = MAX(radius, sqrt(SQUARE(d)) + child->radius);
+                }
+                if (node->nchild == 0) {
+                        for (ip = node->pair0; ip < node->pair1; ip++) {
+                                pair = tree->pairs + ip;
+                                d[0] = pair->pm->center[0] - node->center[0];
+                                d[1] = pair->pm->center[1] - node->center[1];
+                                d[2] = pair->pm->center[2] - node->center[2];
+                                CINTmultipole_shift(q, pair->charges, d, tree->order, 1);
+                                radius = MAX(radius, sqrt(SQUARE(d)) + pair->pm->extent);
+                        }
+                }
+                node->radius = radius;
+        }
+}
+
+/*
+ * vj of the pairs in box a from the densities of the pairs in box b
+ */
+static void _near_field(FMMTree *tree, FMMNode *a, FMMNode *b)
+{
+        FMMPair *pairs = tree->pairs;
+        double *buf = tree->buf;
+        FINT shls[4];
+        FINT ip, iq, ij, kl, nij, nkl;
+        size_t cache_size;
+        double *vj, *dm, dkl;
+        for (ip = a->pair0; ip < a->pair1; ip++) {
+                shls[0] = pairs[ip].ish;
+                shls[1] = pairs[ip].jsh;
+                nij = pairs[ip].nij;
+                vj = pairs[ip].vj;
+                for (iq = b->pair0; iq < b->pair1; iq++) {
+                        shls[2] = pairs[iq].ish;
+                        shls[3] = pairs[iq].jsh;
+                        cache_size = (*tree->intor)(NULL, NULL, shls, tree->atm, tree->natm,
+                                                    tree->bas, tree->nbas, tree->env,
+                                                    tree->opt, NULL);
+                        if (cache_size > tree->cache_size) {
+                                free(tree->cache);
+                                tree->cache = malloc(sizeof(double) * cache_size);
+                                tree->cache_size = cache_size;
+                        }
+                        if (!(*tree->intor)(buf, NULL, shls, tree->atm, tree->natm,
+                                            tree->bas, tree->nbas, tree->env,
+                                            tree->opt, tree->cache)) {
+                                continue;
+                        }
+                        nkl = pairs[iq].nij;
+                        dm = pairs[iq].dm;
+                        for (kl = 0; kl < nkl; kl++) {
+                                dkl = dm[kl];
+                                for (ij = 0; ij < nij; ij++) {
+                                        vj[ij] += buf[kl*nij+ij] * dkl;
+                                }
+                        }
+                }
+        }
+}
+
+/*
+ * Interactions of the pairs in box ia with the pairs in box ib
+ */
+static void _interact(FMMTree *tree, FINT ia, FINT ib, double *w)
+{
+        FMMNode *a = tree->nodes + ia;
+        FMMNode *b = tree->nodes + ib;
+        FINT nmom = tree->nmom;
+        FINT n, m;
+        double r[3];
+        r[0] = a->center[0] - b->center[0];
+        r[1] = a->center[1] - b->center[1];
+        r[2] = a->center[2] - b->center[2];
+        double rr = SQUARE(r);
+        double rab = a->radius + b->radius;
+        if (rab * rab < tree->theta * tree->theta * rr) {
+                // multipole to local, local[a] += sum_b w[b,a] multipoles[b]
+                double *local = tree->locals + ia * nmom;
+                double *q = tree->multipoles + ib * nmom;
+                CINTmultipole_interaction(w, r, tree->order);
+                for (m = 0; m < nmom; m++) {
+                        for (n = 0; n < nmom; n++) {
+                                local[n] += w[m*nmom+n] * q[m];
+                        }
+                }
+        } else if (a->nchild == 0 && b->nchild == 0) {
+                _near_field(tree, a, b);
+        } else if (b->nchild == 0 || (a->nchild > 0 && a->radius >= b->radius)) {
+                for (n = a->child0; n < a->child0 + a->nchild; n++) {
+                        _interact(tree, n, ib, w);
+                }
+        } else {
+                for (n = b->child0; n < b->child0 + b->nchild; n++) {
+                        _interact(tree, ia, n, w);
+                }
+        }
+}
+
+/*
+ * Translate the local expansions from the root to the leaves and evaluate
+ * them with the moments of the pairs
+ */
+static void _downward(FMMTree *tree)
+{
+        FINT nmom = tree->nmom;
+        FINT n, ic, ip, ij, m, nij;
+        FMMNode *node, *child;
+        FMMPair *pair;
+        double *local, *moments;
+        double lp[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER)];
+        double d[3];
+        for (n = 0; n < tree->nnode; n++) {
+                node = tree->nodes + n;
+                local = tree->locals + n * nmom;
+                for (ic = node->child0; ic < node->child0 + node->nchild; ic++) {
+                        child = tree->nodes + ic;
+                        d[0] = child->center[0] - node->center[0];
+                        d[1] = child->center[1] - node->center[1];
+                        d[2] = child->center[2] - node->center[2];
+                        CINTmultipole_shift_local(tree->locals + ic * nmom, local,
+                                                  d, tree->order);
+                }
+                if (node->nchild > 0) {
+                        continue;
+                }
+                for (ip = node->pair0; ip < node->pair1; ip++) {
+                        pair = tree->pairs + ip;
+                        d[0] = pair->pm->center[0] - node->center[0];
+                        d[1] = pair->pm->center[1] - node->center[1];
+                        d[2] = pair->pm->center[2] - node->center[2];
+                        CINTdset0(nmom, lp);
+                        CINTmultipole_shift_local(lp, local, d, tree->order);
+                        nij = pair->nij;
+                        moments = pair->moments;
+                        for (m = 0; m < nmom; m++) {
+                                for (ij = 0; ij < nij; ij++) {
+                                        pair->vj[ij] += moments[m*nij+ij] * lp[m];
+                                }
+                        }
+                }
+        }
+}
+
+static void _fmm_vj(double *vj, double *dm, double theta,
+                    FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env,
+                    CINTOpt *opt, CACHE_SIZE_T (*intor)(), void (*f_c2s)(),
+                    FINT *ao_loc, FINT nao)
+{
+        if (opt == NULL || opt->multipoles == NULL) {
+                fprintf(stderr, "CINTfmm_vj: the multipoles of the shell pairs "
+                        "are not initialized. Call CINTOpt_set_multipole first\n");
+                return;
+        }
+        if (opt->nbas != nbas) {
+                fprintf(stderr, "CINTfmm_vj: nbas %d != nbas %d of the optimizer\n",
+                        (int)nbas, (int)opt->nbas);
+                return;
+        }
+
+        FMMTree tree;
+        tree.order = opt->multipole_order;
+        tree.nmom = MULTIPOLE_NMOMENTS(tree.order);
+        tree.theta = theta;
+        tree.intor = intor;
+        tree.atm = atm;
+        tree.natm = natm;
+        tree.bas = bas;
+        tree.nbas = nbas;
+        tree.env = env;
+        tree.opt = opt;
+        FINT nmom = tree.nmom;
+
+        FINT i, j, m, n, mu, nu, di, dj, i0, j0;
+        size_t size = 0;
+        FINT npair = 0;
+        FINT max_nij = 0;
+        for (i = 0; i < nbas; i++) {
+                for (j = 0; j <= i; j++) {
+                        if (opt->multipoles[i*nbas+j] != NULL) {
+                                n = (ao_loc[i+1] - ao_loc[i]) * (ao_loc[j+1] - ao_loc[j]);
+                                max_nij = MAX(max_nij, n);
+                                size += n * (nmom + 2) + nmom;
+                                npair++;
+                        }
+                }
+        }
+        CINTdset0((size_t)nao * nao, vj);
+        if (npair == 0) {
+                return;
+        }
+
+        FMMPair *pairs = malloc(sizeof(FMMPair) * npair * 2);
+        FMMPair *tmp = pairs + npair;
+        double *data = malloc(sizeof(double) * size);
+        double *c2s_cache = malloc(sizeof(double) * (CART_MAX * CART_MAX * 2 + 16));
+        double *pdata = data;
+        PairMultipole *pm;
+        FMMPair *pair;
+        CINTEnvVars envs;
+        FINT ng[] = {0, 0, 0, 0, 0, 1, 1, 1};
+        FINT shls[2];
+        FINT dims[2];
+        size_t nf;
+        double dmax[3], dmin[3];
+        dmax[0] = dmax[1] = dmax[2] = -1e99;
+        dmin[0] = dmin[1] = dmin[2] = 1e99;
+        for (n = 0, i = 0; i < nbas; i++) {
+        for (j = 0; j <= i; j++) {
+                pm = opt->multipoles[i*nbas+j];
+                if (pm == NULL) {
+                        continue;
+                }
+                i0 = ao_loc[i];
+                j0 = ao_loc[j];
+                di = ao_loc[i+1] - i0;
+                dj = ao_loc[j+1] - j0;
+                pair = pairs + n;
+                pair->ish = i;
+                pair->jsh = j;
+                pair->nij = di * dj;
+                pair->pm = pm;
+                pair->moments = pdata;
+                pair->dm = pair->moments + nmom * di * dj;
+                pair->vj = pair->dm + di * dj;
+                pair->charges = pair->vj + di * dj;
+                pdata = pair->charges + nmom;
+                n++;
+
+                shls[0] = i;
+                shls[1] = j;
+                dims[0] = di;
+                dims[1] = dj;
+                CINTinit_int1e_EnvVars(&envs, ng, shls, atm, natm, bas, nbas, env);
+                nf = envs.nf * envs.x_ctr[0] * envs.x_ctr[1];
+                for (m = 0; m < nmom; m++) {
+                        (*f_c2s)(pair->moments + m * di * dj, pm->moments + m * nf,
+                                 dims, &envs, c2s_cache);
+                }
+
+                for (nu = 0; nu < dj; nu++) {
+                for (mu = 0; mu < di; mu++) {
+                        pair->dm[nu*di+mu] = dm[(i0+mu)*nao+j0+nu];
+                        if (i != j) {
+                                pair->dm[nu*di+mu] += dm[(j0+nu)*nao+i0+mu];
+                        }
+                } }
+                CINTdset0(di * dj, pair->vj);
+                for (m = 0; m < nmom; m++) {
+                        pair->charges[m] = 0;
+                        for (mu = 0; mu < di * dj; mu++) {
+                                pair->charges[m] += pair->moments[m*di*dj+mu] * pair->dm[mu];
+                        }
+                }
+
+                for (m = 0; m < 3; m++) {
+                        dmax[m] = MAX(dmax[m], pm->center[m]);
+                        dmin[m] = MIN(dmin[m], pm->center[m]);
+                }
+        } }
+        free(c2s_cache);
+
+        tree.pairs = pairs;
+        tree.npair = npair;
+        tree.nnode = 0;
+        tree.nnode_alloc = 0;
+        tree.nodes = NULL;
+        FINT root = _new_node(&tree);
+        FMMNode *node = tree.nodes + root;
+        node->half = 0;
+        for (m = 0; m < 3; m++) {
+                node->center[m] = (dmax[m] + dmin[m]) * .5;
+                node->half = MAX(node->half, (dmax[m] - dmin[m]) * .5);
+        }
+        node->half += 1e-8;
+        node->pair0 = 0;
+        node->pair1 = npair;
+        _build_node(&tree, root, 0, tmp);
+
+        tree.multipoles = malloc(sizeof(double) * tree.nnode * nmom * 2);
+        tree.locals = tree.multipoles + tree.nnode * nmom;
+        CINTdset0(tree.nnode * nmom, tree.locals);
+        tree.buf = malloc(sizeof(double) * max_nij * max_nij);
+        tree.cache = NULL;
+        tree.cache_size = 0;
+        double *w = malloc(sizeof(double) * nmom * nmom);
+
+        _upward(&tree);
+        _interact(&tree, root, root, w);
+        _downward(&tree);
+
+        for (n = 0; n < npair; n++) {
+                pair = pairs + n;
+                i = pair->ish;
+                j = pair->jsh;
+                i0 = ao_loc[i];
+                j0 = ao_loc[j];
+                di = ao_loc[i+1] - i0;
+                dj = ao_loc[j+1] - j0;
+                for (nu = 0; nu < dj; nu++) {
+                for (mu = 0; mu < di; mu++) {
+                        vj[(i0+mu)*nao+j0+nu] = pair->vj[nu*di+mu];
+                        vj[(j0+nu)*nao+i0+mu] = pair->vj[nu*di+mu];
+                } }
+        }
+
+        free(w);
+        free(tree.cache);
+        free(tree.buf);
+        free(tree.multipoles);
+        free(tree.nodes);
+        free(data);
+        free(pairs);
+}
+
+void CINTfmm_vj_sph(double *vj, double *dm, double theta,
+                    FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env,
+                    CINTOpt *opt)
+{
+        FINT *ao_loc = malloc(sizeof(FINT) * (nbas+1));
+        CINTshells_spheric_offset(ao_loc, bas, nbas);
+        FINT nao = CINTtot_cgto_spheric(bas, nbas);
+        ao_loc[nbas] = nao;
+        _fmm_vj(vj, dm, theta, atm, natm, bas, nbas, env, opt,
+                &int2e_sph, &c2s_sph_1e, ao_loc, nao);
+        free(ao_loc);
+}
+
+void CINTfmm_vj_cart(double *vj, double *dm, double theta,
+                     FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env,
+                     CINTOpt *opt)
+{
+        FINT *ao_loc = malloc(sizeof(FINT) * (nbas+1));
+        CINTshells_cart_offset(ao_loc, bas, nbas);
+        FINT nao = CINTtot_cgto_cart(bas, nbas);
+        ao_loc[nbas] = nao;
+        _fmm_vj(vj, dm, theta, atm, natm, bas, nbas, env, opt,
+                &int2e_cart, &c2s_cart_1e, ao_loc, nao);
+        free(ao_loc);
+}
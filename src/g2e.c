@@ -12,6 +12,7 @@
 #include "rys_roots.h"
 #include "misc.h"
 #include "g2e.h"
+#include "perf_counters.h"
 
 #define DEF_GXYZ(type, G, GX, GY, GZ) \
         type *GX = G; \
@@ -4422,8 +4423,78 @@ void CINTg0_2e_il2d4d(double * g, Rys2eT *bc, CINTEnvVars *envs)
 /*
  * g[i,k,l,j] = < ik | lj > = ( i j | k l )
  */
+/*
+ * The recurrence coefficients of the roots u and the 2D, 4D integrals. The
+ * weights in gz are multiplied by fac1.
+ */
+static void _g0_2e_2d4d(double *g, double *u, double aij, double akl,
+                        double a0, double a1, double fac1,
+                        double *rij, double *rkl, CINTEnvVars *envs)
+{
+        FINT irys;
+        FINT nroots = envs->nrys_roots;
+        double *w = g + envs->g_size * 2; // ~ gz
+        PERF_TICK(t0);
+        if (envs->g_size == 1) {
+                g[0] = 1;
+                g[1] = 1;
+                g[2] *= fac1;
+                PERF_TOCK(CINT_PERF_TICKS_2D4D, t0);
+                return;
+        }
+
+        double xij_kl = rij[0] - rkl[0];
+        double yij_kl = rij[1] - rkl[1];
+        double zij_kl = rij[2] - rkl[2];
+        double u2, tmp1, tmp2, tmp3, tmp4, tmp5;
+        double rijrx = rij[0] - envs->rx_in_rijrx[0];
+        double rijry = rij[1] - envs->rx_in_rijrx[1];
+        double rijrz = rij[2] - envs->rx_in_rijrx[2];
+        double rklrx = rkl[0] - envs->rx_in_rklrx[0];
+        double rklry = rkl[1] - envs->rx_in_rklrx[1];
+        double rklrz = rkl[2] - envs->rx_in_rklrx[2];
+        Rys2eT bc;
+        double *b00 = bc.b00;
+        double *b10 = bc.b10;
+        double *b01 = bc.b01;
+        double *c00x = bc.c00x;
+        double *c00y = bc.c00y;
+        double *c00z = bc.c00z;
+        double *c0px = bc.c0px;
+        double *c0py = bc.c0py;
+        double *c0pz = bc.c0pz;
+
+        for (irys = 0; irys < nroots; irys++) {
+                /*
+                 *u(irys) = t2/(1-t2)
+                 *t2 = u(irys)/(1+u(irys))
+                 *u2 = aij*akl/(aij+akl)*t2/(1-t2)
+                 */
+                u2 = a0 * u[irys];
+                tmp4 = .5 / (u2 * (aij + akl) + a1);
+                tmp5 = u2 * tmp4;
+                tmp1 = 2. * tmp5;
+                tmp2 = tmp1 * akl;
+                tmp3 = tmp1 * aij;
+                b00[irys] = tmp5;
+                b10[irys] = tmp5 + tmp4 * akl;
+                b01[irys] = tmp5 + tmp4 * aij;
+                c00x[irys] = rijrx - tmp2 * xij_kl;
+                c00y[irys] = rijry - tmp2 * yij_kl;
+                c00z[irys] = rijrz - tmp2 * zij_kl;
+                c0px[irys] = rklrx + tmp3 * xij_kl;
+                c0py[irys] = rklry + tmp3 * yij_kl;
+                c0pz[irys] = rklrz + tmp3 * zij_kl;
+                w[irys] *= fac1;
+        }
+
+        (*envs->f_g0_2d4d)(g, &bc, envs);
+        PERF_TOCK(CINT_PERF_TICKS_2D4D, t0);
+}
+
 FINT CINTg0_2e(double *g, double *rij, double *rkl, double cutoff, CINTEnvVars *envs)
 {
+        PERF_TICK(t0);
         FINT irys;
         FINT nroots = envs->nrys_roots;
         double aij = envs->ai[0] + envs->aj[0];
@@ -4490,58 +4561,92 @@ FINT CINTg0_2e(double *g, double *rij, double *rkl, double cutoff, CINTEnvVars *
                         u[irys] = ut / (u[irys]+1.-ut);
                 }
         }
-        if (envs->g_size == 1) {
-                g[0] = 1;
-                g[1] = 1;
-                g[2] *= fac1;
-                return 1;
+        PERF_TOCK(CINT_PERF_TICKS_ROOTS, t0);
+        _g0_2e_2d4d(g, u, aij, akl, a0, a1, fac1, rij, rkl, envs);
+        return 1;
+}
+
+/*
+ * CINTg0_2e for omega = 0 and for the short-range Coulomb with
+ * rys_order = nrys_roots in two stages, so that the root finding of a batch
+ * of primitive quartets runs in one tight loop. CINTg0_2e_quartet computes
+ * x and the prefactor of a quartet, CINTg0_2e_roots_batch the roots and
+ * weights of nq quartets, CINTg0_2e_from_roots the g array of one quartet.
+ * The results are identical to CINTg0_2e.
+ */
+FINT CINTg0_2e_quartet(PrimQuartet *q, double fac, double *rij, double *rkl,
+                       double cutoff, CINTEnvVars *envs)
+{
+        double aij = envs->ai[0] + envs->aj[0];
+        double akl = envs->ak[0] + envs->al[0];
+        double xij_kl = rij[0] - rkl[0];
+        double yij_kl = rij[1] - rkl[1];
+        double zij_kl = rij[2] - rkl[2];
+        double rr = xij_kl * xij_kl + yij_kl * yij_kl + zij_kl * zij_kl;
+        double a1 = aij * akl;
+        double a0 = a1 / (aij + akl);
+        double x = a0 * rr;
+        const double omega = envs->env[PTR_RANGE_OMEGA];
+        if (omega < 0.) {
+                double theta = omega * omega / (omega * omega + a0);
+                if (theta * x > cutoff || theta * x > EXPCUTOFF_SR) {
+                        return 0;
+                }
+                q->lower = sqrt(theta);
+        } else {
+                q->lower = 0.;
         }
+        q->ai = envs->ai[0];
+        q->aj = envs->aj[0];
+        q->ak = envs->ak[0];
+        q->al = envs->al[0];
+        q->x = x;
+        q->fac = sqrt(a0 / (a1 * a1 * a1)) * fac;
+        q->rij = rij;
+        q->rkl = rkl;
+        return 1;
+}
 
-        double u2, tmp1, tmp2, tmp3, tmp4, tmp5;
-        double rijrx = rij[0] - envs->rx_in_rijrx[0];
-        double rijry = rij[1] - envs->rx_in_rijrx[1];
-        double rijrz = rij[2] - envs->rx_in_rijrx[2];
-        double rklrx = rkl[0] - envs->rx_in_rklrx[0];
-        double rklry = rkl[1] - envs->rx_in_rklrx[1];
-        double rklrz = rkl[2] - envs->rx_in_rklrx[2];
-        Rys2eT bc;
-        double *b00 = bc.b00;
-        double *b10 = bc.b10;
-        double *b01 = bc.b01;
-        double *c00x = bc.c00x;
-        double *c00y = bc.c00y;
-        double *c00z = bc.c00z;
-        double *c0px = bc.c0px;
-        double *c0py = bc.c0py;
-        double *c0pz = bc.c0pz;
+void CINTg0_2e_roots_batch(double *u, double *w, PrimQuartet *q, FINT nq,
+                           CINTEnvVars *envs)
+{
+        PERF_TICK(t0);
+        FINT nroots = envs->nrys_roots;
+        FINT n;
+        if (envs->env[PTR_RANGE_OMEGA] == 0.) {
+                for (n = 0; n < nq; n++) {
+                        CINTrys_roots(nroots, q[n].x, u + n * nroots, w + n * nroots);
+                }
+        } else {
+                double x[QUARTET_BATCH];
+                double lower[QUARTET_BATCH];
+                for (n = 0; n < nq; n++) {
+                        x[n] = q[n].x;
+                        lower[n] = q[n].lower;
+                }
+                CINTsr_rys_roots_batch(nroots, nq, x, lower, u, w);
+        }
+        PERF_TOCK(CINT_PERF_TICKS_ROOTS, t0);
+}
 
+void CINTg0_2e_from_roots(double *g, double *u, double *w, PrimQuartet *q,
+                          CINTEnvVars *envs)
+{
+        FINT nroots = envs->nrys_roots;
+        double *gz = g + envs->g_size * 2;
+        FINT irys;
         for (irys = 0; irys < nroots; irys++) {
-                /*
-                 *u(irys) = t2/(1-t2)
-                 *t2 = u(irys)/(1+u(irys))
-                 *u2 = aij*akl/(aij+akl)*t2/(1-t2)
-                 */
-                u2 = a0 * u[irys];
-                tmp4 = .5 / (u2 * (aij + akl) + a1);
-                tmp5 = u2 * tmp4;
-                tmp1 = 2. * tmp5;
-                tmp2 = tmp1 * akl;
-                tmp3 = tmp1 * aij;
-                b00[irys] = tmp5;
-                b10[irys] = tmp5 + tmp4 * akl;
-                b01[irys] = tmp5 + tmp4 * aij;
-                c00x[irys] = rijrx - tmp2 * xij_kl;
-                c00y[irys] = rijry - tmp2 * yij_kl;
-                c00z[irys] = rijrz - tmp2 * zij_kl;
-                c0px[irys] = rklrx + tmp3 * xij_kl;
-                c0py[irys] = rklry + tmp3 * yij_kl;
-                c0pz[irys] = rklrz + tmp3 * zij_kl;
-                w[irys] *= fac1;
+                gz[irys] = w[irys];
         }
-
-        (*envs->f_g0_2d4d)(g, &bc, envs);
-
-        return 1;
+        envs->ai[0] = q->ai;
+        envs->aj[0] = q->aj;
+        envs->ak[0] = q->ak;
+        envs->al[0] = q->al;
+        double aij = q->ai + q->aj;
+        double akl = q->ak + q->al;
+        double a1 = aij * akl;
+        double a0 = a1 / (aij + akl);
+        _g0_2e_2d4d(g, u, aij, akl, a0, a1, q->fac, q->rij, q->rkl, envs);
 }
 
 /*
@@ -40,11 +40,54 @@ void CINTg0_2e_kj2d4d(double *g, Rys2eT *bc, CINTEnvVars *envs);
 void CINTg0_2e_il2d4d(double *g, Rys2eT *bc, CINTEnvVars *envs);
 void CINTg0_2e_ik2d4d(double *g, Rys2eT *bc, CINTEnvVars *envs);
 
+// A primitive quartet which survived the screening of CINT2e_1111_loop.
+// x and fac are the argument of the Rys roots and the prefactor of g. lower
+// is sqrt(theta) of the short-range Coulomb, 0 for the full Coulomb.
+typedef struct {
+        double ai, aj, ak, al;
+        double x;
+        double fac;
+        double lower;
+        double *rij;
+        double *rkl;
+} PrimQuartet;
+// number of primitive quartets per batch of root finding
+#define QUARTET_BATCH   32
+FINT CINTg0_2e_quartet(PrimQuartet *q, double fac, double *rij, double *rkl,
+                       double cutoff, CINTEnvVars *envs);
+void CINTg0_2e_roots_batch(double *u, double *w, PrimQuartet *q, FINT nq,
+                           CINTEnvVars *envs);
+void CINTg0_2e_from_roots(double *g, double *u, double *w, PrimQuartet *q,
+                          CINTEnvVars *envs);
+
 void CINTg0_lj2d_4d(double *g, CINTEnvVars *envs);
 void CINTg0_kj2d_4d(double *g, CINTEnvVars *envs);
 void CINTg0_il2d_4d(double *g, CINTEnvVars *envs);
 void CINTg0_ik2d_4d(double *g, CINTEnvVars *envs);
 
+// max angular momentum of the class kernels in g2e_kernels.c
+#define G2E_KERNEL_LMAX 2
+void CINTg2e_class_kernels(CINTEnvVars *envs);
+
+// mixed precision kernels, see g2e_f32.c
+FINT CINTg0_2e_f32(double *g, double *rij, double *rkl, double cutoff, CINTEnvVars *envs);
+void CINTgout2e_f32(double *gout, double *g, FINT *idx,
+                    CINTEnvVars *envs, FINT gout_empty);
+FINT CINTg2e_f32_kernels(CINTEnvVars *envs);
+
+// min. number of primitive quartets and total angular momentum to apply
+// the HRR after contraction, see g2e_hrr.c
+#define HRR_AFTER_CTR_NPRIM     16
+#define HRR_AFTER_CTR_LMIN      6
+FINT CINTrys_hrr_available(CINTEnvVars *envs);
+size_t CINTg2e_ef_len(CINTEnvVars *envs);
+size_t CINTg2e_ef_hrr_cache_size(CINTEnvVars *envs);
+void CINTinit_2e_ef_rys(CINTEnvVars *envs);
+void CINTg2e_ef_index_xyz(FINT *idx, CINTEnvVars *envs);
+void CINTgout2e_ef(double *gout, double *g, FINT *idx, CINTEnvVars *envs,
+                   FINT gout_empty);
+void CINTg2e_ef_hrr(double *gctr, double *gint, CINTEnvVars *envs, double *cache);
+
 void CINTnabla1i_2e(double *f, const double *g,
                     const FINT li, const FINT lj, const FINT lk, const FINT ll,
                     const CINTEnvVars *envs);
@@ -82,6 +125,11 @@ void CINTinit_int2e_stg_EnvVars(CINTEnvVars *envs, FINT *ng, FINT *shls,
                            FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env);
 void CINTinit_int2e_yp_EnvVars(CINTEnvVars *envs, FINT *ng, FINT *shls,
                            FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env);
+void CINTinit_int2e_stg_geminals_EnvVars(CINTEnvVars *envs, FINT *ng, FINT *shls,
+                           FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env);
+FINT CINTstg_geminals_overflow(CINTEnvVars *envs);
+void CINTgout2e_stg_geminals(double *gout, double *g, FINT *idx,
+                             CINTEnvVars *envs, FINT gout_empty);
 #endif
 
 
@@ -6,6 +6,7 @@
 
 
 #include <stdlib.h>
+#include <stdio.h>
 #include <math.h>
 #include <assert.h>
 #include "config.h"
@@ -14,12 +15,87 @@
 #include "misc.h"
 #include "g2e.h"
 
+static FINT _g0_2e_f12_2d4d(double *g, double *rij, double *rkl, double *u,
+                            double fac1, CINTEnvVars *envs)
+{
+        double *w = g + envs->g_size * 2; // ~ gz
+        FINT nroots = envs->nrys_roots;
+        FINT irys;
+        double aij = envs->ai[0] + envs->aj[0];
+        double akl = envs->ak[0] + envs->al[0];
+        double a1 = aij * akl;
+        double a0 = a1 / (aij + akl);
+        double xij_kl = rij[0] - rkl[0];
+        double yij_kl = rij[1] - rkl[1];
+        double zij_kl = rij[2] - rkl[2];
+
+        if (envs->g_size == 1) {
+                g[0] = 1;
+                g[1] = 1;
+                g[2] *= fac1;
+                return 1;
+        }
+
+        double u2, tmp1, tmp2, tmp3, tmp4, tmp5;
+        double rijrx = rij[0] - envs->rx_in_rijrx[0];
+        double rijry = rij[1] - envs->rx_in_rijrx[1];
+        double rijrz = rij[2] - envs->rx_in_rijrx[2];
+        double rklrx = rkl[0] - envs->rx_in_rklrx[0];
+        double rklry = rkl[1] - envs->rx_in_rklrx[1];
+        double rklrz = rkl[2] - envs->rx_in_rklrx[2];
+        Rys2eT bc;
+        double *b00 = bc.b00;
+        double *b10 = bc.b10;
+        double *b01 = bc.b01;
+        double *c00x = bc.c00x;
+        double *c00y = bc.c00y;
+        double *c00z = bc.c00z;
+        double *c0px = bc.c0px;
+        double *c0py = bc.c0py;
+        double *c0pz = bc.c0pz;
+
+        for (irys = 0; irys < nroots; irys++) {
+                /*
+                 *u(irys) = t2/(1-t2)
+                 *t2 = u(irys)/(1+u(irys))
+                 *u2 = aij*akl/(aij+akl)*t2/(1-t2)
+                 */
+                u2 = a0 * u[irys];
+                tmp4 = .5 / (u2 * (aij + akl) + a1);
+                tmp5 = u2 * tmp4;
+                tmp1 = 2. * tmp5;
+                tmp2 = tmp1 * akl;
+                tmp3 = tmp1 * aij;
+                b00[irys] = tmp5;
+                b10[irys] = tmp5 + tmp4 * akl;
+                b01[irys] = tmp5 + tmp4 * aij;
+                c00x[irys] = rijrx - tmp2 * xij_kl;
+                c00y[irys] = rijry - tmp2 * yij_kl;
+                c00z[irys] = rijrz - tmp2 * zij_kl;
+                c0px[irys] = rklrx + tmp3 * xij_kl;
+                c0py[irys] = rklry + tmp3 * yij_kl;
+                c0pz[irys] = rklrz + tmp3 * zij_kl;
+                w[irys] *= fac1;
+        }
+
+        (*envs->f_g0_2d4d)(g, &bc, envs);
+        return 1;
+}
+
 FINT CINTg0_2e_stg(double *g, double *rij, double *rkl, double cutoff, CINTEnvVars *envs);
 FINT CINTg0_2e_yp(double *g, double *rij, double *rkl, double cutoff, CINTEnvVars *envs);
 void CINTg0_2e_stg_lj2d4d(double *g, Rys2eT *bc, CINTEnvVars *envs);
 
-void CINTinit_int2e_yp_EnvVars(CINTEnvVars *envs, FINT *ng, FINT *shls,
-                               FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env)
+FINT CINTg0_2e_stg_geminals(double *g, double *rij, double *rkl, double cutoff,
+                            CINTEnvVars *envs);
+
+/*
+ * Each geminal takes rys_order roots. The roots of all ngeminals geminals
+ * are concatenated, nrys_roots = rys_order * ngeminals.
+ */
+static void _init_int2e_f12_EnvVars(CINTEnvVars *envs, FINT *ng, FINT *shls,
+                                    FINT *atm, FINT natm, FINT *bas, FINT nbas,
+                                    double *env, FINT ngeminals)
 {
         envs->natm = natm;
         envs->nbas = nbas;
@@ -73,8 +149,12 @@ void CINTinit_int2e_yp_EnvVars(CINTEnvVars *envs, FINT *ng, FINT *shls,
         // ceil(L_tot/2) + 1
         FINT nroots = (envs->li_ceil + envs->lj_ceil +
                       envs->lk_ceil + envs->ll_ceil + 3)/2;
-        envs->nrys_roots = nroots;
         assert(nroots < MXRYSROOTS);
+        envs->rys_order = nroots;
+        // nroots * ngeminals > MXRYSROOTS is rejected by the drivers of the
+        // geminals, see CINTstg_geminals_overflow
+        nroots *= ngeminals;
+        envs->nrys_roots = nroots;
 
         FINT dli, dlj, dlk, dll;
         FINT ibase = envs->li_ceil > envs->lj_ceil;
@@ -144,6 +224,12 @@ void CINTinit_int2e_yp_EnvVars(CINTEnvVars *envs, FINT *ng, FINT *shls,
         }
 }
 
+void CINTinit_int2e_yp_EnvVars(CINTEnvVars *envs, FINT *ng, FINT *shls,
+                               FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env)
+{
+        _init_int2e_f12_EnvVars(envs, ng, shls, atm, natm, bas, nbas, env, 1);
+}
+
 void CINTinit_int2e_stg_EnvVars(CINTEnvVars *envs, FINT *ng, FINT *shls,
                                 FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env)
 {
@@ -151,6 +237,36 @@ void CINTinit_int2e_stg_EnvVars(CINTEnvVars *envs, FINT *ng, FINT *shls,
         envs->f_g0_2e = &CINTg0_2e_stg;
 }
 
+/*
+ * Whether the roots of all geminals exceed MXRYSROOTS. The drivers return 0
+ * and leave out untouched in this case.
+ */
+FINT CINTstg_geminals_overflow(CINTEnvVars *envs)
+{
+        if (envs->nrys_roots > MXRYSROOTS) {
+                fprintf(stderr, "int2e_stg_geminals: %d geminals with %d roots "
+                        "each exceed MXRYSROOTS=%d\n",
+                        (int)(envs->nrys_roots / envs->rys_order),
+                        (int)envs->rys_order, MXRYSROOTS);
+                return 1;
+        }
+        return 0;
+}
+
+/*
+ * STG geminals sum_n c_n e^{-zeta_n r12} in one pass. Everything except the
+ * roots and weights (pair data, g0_2d4d, gout, contraction) is shared by
+ * the geminals.
+ */
+void CINTinit_int2e_stg_geminals_EnvVars(CINTEnvVars *envs, FINT *ng, FINT *shls,
+                                         FINT *atm, FINT natm, FINT *bas, FINT nbas,
+                                         double *env)
+{
+        FINT ngeminals = env[NF12_GEMINALS];
+        _init_int2e_f12_EnvVars(envs, ng, shls, atm, natm, bas, nbas, env, ngeminals);
+        envs->f_g0_2e = &CINTg0_2e_stg_geminals;
+}
+
 
 void CINTg0_2e_stg_lj2d4d(double *g, Rys2eT *bc, CINTEnvVars *envs)
 {
@@ -200,57 +316,7 @@ FINT CINTg0_2e_yp(double *g, double *rij, double *rkl, double cutoff, CINTEnvVar
                 }
         }
 
-        if (envs->g_size == 1) {
-                g[0] = 1;
-                g[1] = 1;
-                g[2] *= fac1;
-                return 1;
-        }
-
-        double u2, tmp1, tmp2, tmp3, tmp4, tmp5;
-        double rijrx = rij[0] - envs->rx_in_rijrx[0];
-        double rijry = rij[1] - envs->rx_in_rijrx[1];
-        double rijrz = rij[2] - envs->rx_in_rijrx[2];
-        double rklrx = rkl[0] - envs->rx_in_rklrx[0];
-        double rklry = rkl[1] - envs->rx_in_rklrx[1];
-        double rklrz = rkl[2] - envs->rx_in_rklrx[2];
-        Rys2eT bc;
-        double *b00 = bc.b00;
-        double *b10 = bc.b10;
-        double *b01 = bc.b01;
-        double *c00x = bc.c00x;
-        double *c00y = bc.c00y;
-        double *c00z = bc.c00z;
-        double *c0px = bc.c0px;
-        double *c0py = bc.c0py;
-        double *c0pz = bc.c0pz;
-
-        for (irys = 0; irys < nroots; irys++) {
-                /*
-                 *u(irys) = t2/(1-t2)
-                 *t2 = u(irys)/(1+u(irys))
-                 *u2 = aij*akl/(aij+akl)*t2/(1-t2)
-                 */
-                u2 = a0 * u[irys];
-                tmp4 = .5 / (u2 * (aij + akl) + a1);
-                tmp5 = u2 * tmp4;
-                tmp1 = 2. * tmp5;
-                tmp2 = tmp1 * akl;
-                tmp3 = tmp1 * aij;
-                b00[irys] = tmp5;
-                b10[irys] = tmp5 + tmp4 * akl;
-                b01[irys] = tmp5 + tmp4 * aij;
-                c00x[irys] = rijrx - tmp2 * xij_kl;
-                c00y[irys] = rijry - tmp2 * yij_kl;
-                c00z[irys] = rijrz - tmp2 * zij_kl;
-                c0px[irys] = rklrx + tmp3 * xij_kl;
-                c0py[irys] = rklry + tmp3 * yij_kl;
-                c0pz[irys] = rklrz + tmp3 * zij_kl;
-                w[irys] *= fac1;
-        }
-
-        (*envs->f_g0_2d4d)(g, &bc, envs);
-        return 1;
+        return _g0_2e_f12_2d4d(g, rij, rkl, u, fac1, envs);
 }
 
 
@@ -297,55 +363,101 @@ FINT CINTg0_2e_stg(double *g, double *rij, double *rkl, double cutoff, CINTEnvVa
                 }
         }
 
-        if (envs->g_size == 1) {
-                g[0] = 1;
-                g[1] = 1;
-                g[2] *= fac1;
-                return 1;
-        }
+        return _g0_2e_f12_2d4d(g, rij, rkl, u, fac1, envs);
+}
 
-        double u2, tmp1, tmp2, tmp3, tmp4, tmp5;
-        double rijrx = rij[0] - envs->rx_in_rijrx[0];
-        double rijry = rij[1] - envs->rx_in_rijrx[1];
-        double rijrz = rij[2] - envs->rx_in_rijrx[2];
-        double rklrx = rkl[0] - envs->rx_in_rklrx[0];
-        double rklry = rkl[1] - envs->rx_in_rklrx[1];
-        double rklrz = rkl[2] - envs->rx_in_rklrx[2];
-        Rys2eT bc;
-        double *b00 = bc.b00;
-        double *b10 = bc.b10;
-        double *b01 = bc.b01;
-        double *c00x = bc.c00x;
-        double *c00y = bc.c00y;
-        double *c00z = bc.c00z;
-        double *c0px = bc.c0px;
-        double *c0py = bc.c0py;
-        double *c0pz = bc.c0pz;
+FINT CINTg0_2e_stg_geminals(double *g, double *rij, double *rkl, double cutoff,
+                            CINTEnvVars *envs)
+{
+        double *env = envs->env;
+        FINT ngeminals = env[NF12_GEMINALS];
+        double *zetas = env + (FINT)env[PTR_F12_GEMINALS];
+        double *coeffs = zetas + ngeminals;
+        FINT nroots = envs->rys_order;
+        double aij, akl, a0, a1, fac1, x, uw;
+        double u[MXRYSROOTS];
+        double *w = g + envs->g_size * 2; // ~ gz
+        double ta[MXRYSROOTS];
+        double ua[MXRYSROOTS];
+        FINT irys, n;
 
-        for (irys = 0; irys < nroots; irys++) {
-                /*
-                 *u(irys) = t2/(1-t2)
-                 *t2 = u(irys)/(1+u(irys))
-                 *u2 = aij*akl/(aij+akl)*t2/(1-t2)
-                 */
-                u2 = a0 * u[irys];
-                tmp4 = .5 / (u2 * (aij + akl) + a1);
-                tmp5 = u2 * tmp4;
-                tmp1 = 2. * tmp5;
-                tmp2 = tmp1 * akl;
-                tmp3 = tmp1 * aij;
-                b00[irys] = tmp5;
-                b10[irys] = tmp5 + tmp4 * akl;
-                b01[irys] = tmp5 + tmp4 * aij;
-                c00x[irys] = rijrx - tmp2 * xij_kl;
-                c00y[irys] = rijry - tmp2 * yij_kl;
-                c00z[irys] = rijrz - tmp2 * zij_kl;
-                c0px[irys] = rklrx + tmp3 * xij_kl;
-                c0py[irys] = rklry + tmp3 * yij_kl;
-                c0pz[irys] = rklrz + tmp3 * zij_kl;
-                w[irys] *= fac1;
+        aij = envs->ai[0] + envs->aj[0];
+        akl = envs->ak[0] + envs->al[0];
+        a1 = aij * akl;
+        a0 = a1 / (aij + akl);
+        fac1 = envs->fac[0] / (sqrt(aij+akl) * a1);
+
+        double xij_kl = rij[0] - rkl[0];
+        double yij_kl = rij[1] - rkl[1];
+        double zij_kl = rij[2] - rkl[2];
+        double rr = xij_kl * xij_kl + yij_kl * yij_kl + zij_kl * zij_kl;
+        x = a0 * rr;
+        for (n = 0; n < ngeminals; n++) {
+                ta[n] = x;
+                if (zetas[n] == 0) {
+                        // ua = 0 is out of the range of the STG roots. Any
+                        // valid ua will do since the roots of zeta = 0 are
+                        // replaced below.
+                        ua[n] = 1.;
+                } else {
+                        ua[n] = .25 * zetas[n] * zetas[n] / a0;
+                }
+        }
+        CINTstg_roots_batch(nroots, ngeminals, ta, ua, u, w);
+
+        for (n = 0; n < ngeminals; n++) {
+                if (zetas[n] == 0) {
+                        // e^{-zeta r12} = 1, (ij|kl) = S_ij S_kl. One root
+                        // u = 0 decouples the 2D integrals into overlaps.
+                        // sqrt(pi/a0)/2 converts the Coulomb prefactor fac1
+                        // to (pi^2/(aij*akl))^{3/2}
+                        irys = n * nroots;
+                        u[irys] = 0;
+                        w[irys] = .5 * sqrt(M_PI / a0) * coeffs[n];
+                        for (irys++; irys < (n+1) * nroots; irys++) {
+                                u[irys] = 0;
+                                w[irys] = 0;
+                        }
+                        continue;
+                }
+                //:w *= (1-t) * 2*ua/zeta;
+                //:u -> t/(1-t);
+                uw = 2. * ua[n] / zetas[n] * coeffs[n];
+                for (irys = n * nroots; irys < (n+1) * nroots; irys++) {
+                        w[irys] *= (1-u[irys]) * uw;
+                        u[irys] = u[irys] / (1 - u[irys]);
+                }
         }
+        return _g0_2e_f12_2d4d(g, rij, rkl, u, fac1, envs);
+}
 
-        (*envs->f_g0_2d4d)(g, &bc, envs);
-        return 1;
+/*
+ * The integrals of each geminal in a separate tensor component,
+ * gout[nf,ngeminals]
+ */
+void CINTgout2e_stg_geminals(double *gout, double *g, FINT *idx,
+                             CINTEnvVars *envs, FINT gout_empty)
+{
+        FINT nf = envs->nf;
+        FINT nroots = envs->rys_order;
+        FINT ngeminals = envs->ncomp_tensor;
+        FINT i, ix, iy, iz, n, m;
+        double s;
+
+        for (n = 0; n < nf; n++, idx+=3) {
+                ix = idx[0];
+                iy = idx[1];
+                iz = idx[2];
+                for (m = 0; m < ngeminals; m++) {
+                        s = 0;
+                        for (i = m * nroots; i < (m+1) * nroots; i++) {
+                                s += g[ix+i] * g[iy+i] * g[iz+i];
+                        }
+                        if (gout_empty) {
+                                gout[n*ngeminals+m] = s;
+                        } else {
+                                gout[n*ngeminals+m] += s;
+                        }
+                }
+        }
 }
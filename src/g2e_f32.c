@@ -0,0 +1,467 @@
+/*
+ * Copyright (C) 2013-  Qiming Sun <osirpt.sun@gmail.com>
+ *
+ * Mixed precision kernels of the plain Coulomb integrals (ij|kl), (ij|k)
+ * and (i|k). The Rys roots and weights and the recurrence coefficients are
+ * computed in double precision. The 2D, 4D integrals and the products in
+ * gout are evaluated in single precision. The contraction and the
+ * cartesian to spherical transformation remain in double precision.
+ *
+ * The single precision g array has the layout of the double precision one,
+ * so CINTg0_2e_f32 and CINTgout2e_f32 replace f_g0_2e and f_gout without
+ * changes in the primitive loops.
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include "config.h"
+#include "cint_bas.h"
+#include "rys_roots.h"
+#include "g2e.h"
+#include "cint2e.h"
+
+#define DEF_GXYZ(type, G, GX, GY, GZ) \
+        type *GX = G; \
+        type *GY = G + envs->g_size; \
+        type *GZ = G + envs->g_size * 2
+
+typedef struct {
+        float c00x[MXRYSROOTS];
+        float c00y[MXRYSROOTS];
+        float c00z[MXRYSROOTS];
+        float c0px[MXRYSROOTS];
+        float c0py[MXRYSROOTS];
+        float c0pz[MXRYSROOTS];
+        float b01[MXRYSROOTS];
+        float b00[MXRYSROOTS];
+        float b10[MXRYSROOTS];
+} Rys2eT_f32;
+
+/*
+ * g(nroots,0:nmax,0:mmax), see CINTg0_2e_2d
+ */
+static void _g0_2e_2d_f32(float *g, Rys2eT_f32 *bc, CINTEnvVars *envs)
+{
+        const FINT nroots = envs->nrys_roots;
+        const FINT nmax = envs->li_ceil + envs->lj_ceil;
+        const FINT mmax = envs->lk_ceil + envs->ll_ceil;
+        const FINT dm = envs->g2d_klmax;
+        const FINT dn = envs->g2d_ijmax;
+        FINT i, j, m, n;
+        DEF_GXYZ(float, g, gx, gy, gz);
+        float s0x, s1x, s2x;
+        float s0y, s1y, s2y;
+        float s0z, s1z, s2z;
+        float c00x, c00y, c00z, c0px, c0py, c0pz, b10, b01, b00;
+
+        for (i = 0; i < nroots; i++) {
+                gx[i] = 1;
+                gy[i] = 1;
+        }
+
+        for (i = 0; i < nroots; i++) {
+                c00x = bc->c00x[i];
+                c00y = bc->c00y[i];
+                c00z = bc->c00z[i];
+                c0px = bc->c0px[i];
+                c0py = bc->c0py[i];
+                c0pz = bc->c0pz[i];
+                b10 = bc->b10[i];
+                b01 = bc->b01[i];
+                b00 = bc->b00[i];
+                if (nmax > 0) {
+                        s0x = gx[i];
+                        s0y = gy[i];
+                        s0z = gz[i];
+                        s1x = c00x * s0x;
+                        s1y = c00y * s0y;
+                        s1z = c00z * s0z;
+                        gx[i+dn] = s1x;
+                        gy[i+dn] = s1y;
+                        gz[i+dn] = s1z;
+                        for (n = 1; n < nmax; ++n) {
+                                s2x = c00x * s1x + n * b10 * s0x;
+                                s2y = c00y * s1y + n * b10 * s0y;
+                                s2z = c00z * s1z + n * b10 * s0z;
+                                gx[i+(n+1)*dn] = s2x;
+                                gy[i+(n+1)*dn] = s2y;
+                                gz[i+(n+1)*dn] = s2z;
+                                s0x = s1x;
+                                s0y = s1y;
+                                s0z = s1z;
+                                s1x = s2x;
+                                s1y = s2y;
+                                s1z = s2z;
+                        }
+                }
+
+                if (mmax > 0) {
+                        s0x = gx[i];
+                        s0y = gy[i];
+                        s0z = gz[i];
+                        s1x = c0px * s0x;
+                        s1y = c0py * s0y;
+                        s1z = c0pz * s0z;
+                        gx[i+dm] = s1x;
+                        gy[i+dm] = s1y;
+                        gz[i+dm] = s1z;
+                        for (m = 1; m < mmax; ++m) {
+                                s2x = c0px * s1x + m * b01 * s0x;
+                                s2y = c0py * s1y + m * b01 * s0y;
+                                s2z = c0pz * s1z + m * b01 * s0z;
+                                gx[i+(m+1)*dm] = s2x;
+                                gy[i+(m+1)*dm] = s2y;
+                                gz[i+(m+1)*dm] = s2z;
+                                s0x = s1x;
+                                s0y = s1y;
+                                s0z = s1z;
+                                s1x = s2x;
+                                s1y = s2y;
+                                s1z = s2z;
+                        }
+
+                        if (nmax > 0) {
+                                s0x = gx[i+dn];
+                                s0y = gy[i+dn];
+                                s0z = gz[i+dn];
+                                s1x = c0px * s0x + b00 * gx[i];
+                                s1y = c0py * s0y + b00 * gy[i];
+                                s1z = c0pz * s0z + b00 * gz[i];
+                                gx[i+dn+dm] = s1x;
+                                gy[i+dn+dm] = s1y;
+                                gz[i+dn+dm] = s1z;
+                                for (m = 1; m < mmax; ++m) {
+                                        s2x = c0px*s1x + m*b01*s0x + b00*gx[i+m*dm];
+                                        s2y = c0py*s1y + m*b01*s0y + b00*gy[i+m*dm];
+                                        s2z = c0pz*s1z + m*b01*s0z + b00*gz[i+m*dm];
+                                        gx[i+dn+(m+1)*dm] = s2x;
+                                        gy[i+dn+(m+1)*dm] = s2y;
+                                        gz[i+dn+(m+1)*dm] = s2z;
+                                        s0x = s1x;
+                                        s0y = s1y;
+                                        s0z = s1z;
+                                        s1x = s2x;
+                                        s1y = s2y;
+                                        s1z = s2z;
+                                }
+                        }
+                }
+
+                for (m = 1; m <= mmax; ++m) {
+                        j = m * dm + i;
+                        s0x = gx[j];
+                        s0y = gy[j];
+                        s0z = gz[j];
+                        s1x = gx[j + dn];
+                        s1y = gy[j + dn];
+                        s1z = gz[j + dn];
+                        for (n = 1; n < nmax; ++n) {
+                                s2x = c00x*s1x + n*b10*s0x + m*b00*gx[j+n*dn-dm];
+                                s2y = c00y*s1y + n*b10*s0y + m*b00*gy[j+n*dn-dm];
+                                s2z = c00z*s1z + n*b10*s0z + m*b00*gz[j+n*dn-dm];
+                                gx[j+(n+1)*dn] = s2x;
+                                gy[j+(n+1)*dn] = s2y;
+                                gz[j+(n+1)*dn] = s2z;
+                                s0x = s1x;
+                                s0y = s1y;
+                                s0z = s1z;
+                                s1x = s2x;
+                                s1y = s2y;
+                                s1z = s2z;
+                        }
+                }
+        }
+}
+
+/*
+ * One step of the horizontal recurrence
+ * g[n] = r * g[n-d1] + g[n-d1+d2]
+ */
+static inline void _hrr_f32(float *gx, float *gy, float *gz, FINT ptr, FINT len,
+                            FINT d1, FINT d2, float rx, float ry, float rz)
+{
+        FINT n;
+        for (n = ptr; n < ptr+len; n++) {
+                gx[n] = rx * gx[n-d1] + gx[n-d1+d2];
+                gy[n] = ry * gy[n-d1] + gy[n-d1+d2];
+                gz[n] = rz * gz[n-d1] + gz[n-d1+d2];
+        }
+}
+
+/* 2d is based on l,j, see CINTg0_lj2d_4d */
+static void _g0_lj2d_4d_f32(float *g, CINTEnvVars *envs)
+{
+        FINT li = envs->li_ceil;
+        FINT lk = envs->lk_ceil;
+        if (li == 0 && lk == 0) {
+                return;
+        }
+        FINT nmax = envs->li_ceil + envs->lj_ceil;
+        FINT mmax = envs->lk_ceil + envs->ll_ceil;
+        FINT lj = envs->lj_ceil;
+        FINT nroots = envs->nrys_roots;
+        FINT i, j, k, l;
+        FINT di = envs->g_stride_i;
+        FINT dk = envs->g_stride_k;
+        FINT dl = envs->g_stride_l;
+        FINT dj = envs->g_stride_j;
+        double *rirj = envs->rirj;
+        double *rkrl = envs->rkrl;
+        DEF_GXYZ(float, g, gx, gy, gz);
+
+        for (i = 1; i <= li; i++) {
+        for (j = 0; j <= nmax-i; j++) {
+        for (l = 0; l <= mmax; l++) {
+                _hrr_f32(gx, gy, gz, j*dj+l*dl+i*di, nroots, di, dj,
+                         rirj[0], rirj[1], rirj[2]);
+        } } }
+
+        for (j = 0; j <= lj; j++) {
+        for (k = 1; k <= lk; k++) {
+        for (l = 0; l <= mmax-k; l++) {
+                _hrr_f32(gx, gy, gz, j*dj+l*dl+k*dk, dk, dk, dl,
+                         rkrl[0], rkrl[1], rkrl[2]);
+        } } }
+}
+
+/* 2d is based on k,j, see CINTg0_kj2d_4d */
+static void _g0_kj2d_4d_f32(float *g, CINTEnvVars *envs)
+{
+        FINT li = envs->li_ceil;
+        FINT ll = envs->ll_ceil;
+        if (li == 0 && ll == 0) {
+                return;
+        }
+        FINT nmax = envs->li_ceil + envs->lj_ceil;
+        FINT mmax = envs->lk_ceil + envs->ll_ceil;
+        FINT lj = envs->lj_ceil;
+        FINT nroots = envs->nrys_roots;
+        FINT i, j, k, l;
+        FINT di = envs->g_stride_i;
+        FINT dk = envs->g_stride_k;
+        FINT dl = envs->g_stride_l;
+        FINT dj = envs->g_stride_j;
+        double *rirj = envs->rirj;
+        double *rkrl = envs->rkrl;
+        DEF_GXYZ(float, g, gx, gy, gz);
+
+        for (i = 1; i <= li; i++) {
+        for (j = 0; j <= nmax-i; j++) {
+        for (k = 0; k <= mmax; k++) {
+                _hrr_f32(gx, gy, gz, j*dj+k*dk+i*di, nroots, di, dj,
+                         rirj[0], rirj[1], rirj[2]);
+        } } }
+
+        for (j = 0; j <= lj; j++) {
+        for (l = 1; l <= ll; l++) {
+        for (k = 0; k <= mmax-l; k++) {
+                _hrr_f32(gx, gy, gz, j*dj+l*dl+k*dk, dk, dl, dk,
+                         rkrl[0], rkrl[1], rkrl[2]);
+        } } }
+}
+
+/* 2d is based on i,l, see CINTg0_il2d_4d */
+static void _g0_il2d_4d_f32(float *g, CINTEnvVars *envs)
+{
+        FINT lk = envs->lk_ceil;
+        FINT lj = envs->lj_ceil;
+        if (lj == 0 && lk == 0) {
+                return;
+        }
+        FINT nmax = envs->li_ceil + envs->lj_ceil;
+        FINT mmax = envs->lk_ceil + envs->ll_ceil;
+        FINT ll = envs->ll_ceil;
+        FINT nroots = envs->nrys_roots;
+        FINT i, j, k, l;
+        FINT di = envs->g_stride_i;
+        FINT dk = envs->g_stride_k;
+        FINT dl = envs->g_stride_l;
+        FINT dj = envs->g_stride_j;
+        double *rirj = envs->rirj;
+        double *rkrl = envs->rkrl;
+        DEF_GXYZ(float, g, gx, gy, gz);
+
+        for (k = 1; k <= lk; k++) {
+        for (l = 0; l <= mmax-k; l++) {
+        for (i = 0; i <= nmax; i++) {
+                _hrr_f32(gx, gy, gz, l*dl+k*dk+i*di, nroots, dk, dl,
+                         rkrl[0], rkrl[1], rkrl[2]);
+        } } }
+
+        for (j = 1; j <= lj; j++) {
+        for (l = 0; l <= ll; l++) {
+        for (k = 0; k <= lk; k++) {
+                _hrr_f32(gx, gy, gz, j*dj+l*dl+k*dk, dk-di*j, dj, di,
+                         rirj[0], rirj[1], rirj[2]);
+        } } }
+}
+
+/* 2d is based on i,k, see CINTg0_ik2d_4d */
+static void _g0_ik2d_4d_f32(float *g, CINTEnvVars *envs)
+{
+        FINT lj = envs->lj_ceil;
+        FINT ll = envs->ll_ceil;
+        if (lj == 0 && ll == 0) {
+                return;
+        }
+        FINT nmax = envs->li_ceil + envs->lj_ceil;
+        FINT mmax = envs->lk_ceil + envs->ll_ceil;
+        FINT lk = envs->lk_ceil;
+        FINT nroots = envs->nrys_roots;
+        FINT i, j, k, l;
+        FINT di = envs->g_stride_i;
+        FINT dk = envs->g_stride_k;
+        FINT dl = envs->g_stride_l;
+        FINT dj = envs->g_stride_j;
+        double *rirj = envs->rirj;
+        double *rkrl = envs->rkrl;
+        DEF_GXYZ(float, g, gx, gy, gz);
+
+        for (l = 1; l <= ll; l++) {
+        for (k = 0; k <= mmax-l; k++) {
+        for (i = 0; i <= nmax; i++) {
+                _hrr_f32(gx, gy, gz, l*dl+k*dk+i*di, nroots, dl, dk,
+                         rkrl[0], rkrl[1], rkrl[2]);
+        } } }
+
+        for (j = 1; j <= lj; j++) {
+        for (l = 0; l <= ll; l++) {
+        for (k = 0; k <= lk; k++) {
+                _hrr_f32(gx, gy, gz, j*dj+l*dl+k*dk, dk-di*j, dj, di,
+                         rirj[0], rirj[1], rirj[2]);
+        } } }
+}
+
+/*
+ * CINTg0_2e for omega = 0. g is the float array of the 2D, 4D integrals
+ * in the storage of the double precision g.
+ */
+FINT CINTg0_2e_f32(double *g, double *rij, double *rkl, double cutoff, CINTEnvVars *envs)
+{
+        FINT irys;
+        FINT nroots = envs->nrys_roots;
+        float *gf = (float *)g;
+        float *gz = gf + envs->g_size * 2;
+        double aij = envs->ai[0] + envs->aj[0];
+        double akl = envs->ak[0] + envs->al[0];
+        double a0, a1, fac1, x;
+        double u[MXRYSROOTS];
+        double w[MXRYSROOTS];
+        double xij_kl = rij[0] - rkl[0];
+        double yij_kl = rij[1] - rkl[1];
+        double zij_kl = rij[2] - rkl[2];
+        double rr = xij_kl * xij_kl + yij_kl * yij_kl + zij_kl * zij_kl;
+
+        a1 = aij * akl;
+        a0 = a1 / (aij + akl);
+        fac1 = sqrt(a0 / (a1 * a1 * a1)) * envs->fac[0];
+        x = a0 * rr;
+        CINTrys_roots(nroots, x, u, w);
+
+        if (envs->g_size == 1) {
+                gf[0] = 1;
+                gf[1] = 1;
+                gf[2] = w[0] * fac1;
+                return 1;
+        }
+
+        double u2, tmp1, tmp2, tmp3, tmp4, tmp5;
+        double rijrx = rij[0] - envs->rx_in_rijrx[0];
+        double rijry = rij[1] - envs->rx_in_rijrx[1];
+        double rijrz = rij[2] - envs->rx_in_rijrx[2];
+        double rklrx = rkl[0] - envs->rx_in_rklrx[0];
+        double rklry = rkl[1] - envs->rx_in_rklrx[1];
+        double rklrz = rkl[2] - envs->rx_in_rklrx[2];
+        Rys2eT_f32 bc;
+        for (irys = 0; irys < nroots; irys++) {
+                u2 = a0 * u[irys];
+                tmp4 = .5 / (u2 * (aij + akl) + a1);
+                tmp5 = u2 * tmp4;
+                tmp1 = 2. * tmp5;
+                tmp2 = tmp1 * akl;
+                tmp3 = tmp1 * aij;
+                bc.b00[irys] = tmp5;
+                bc.b10[irys] = tmp5 + tmp4 * akl;
+                bc.b01[irys] = tmp5 + tmp4 * aij;
+                bc.c00x[irys] = rijrx - tmp2 * xij_kl;
+                bc.c00y[irys] = rijry - tmp2 * yij_kl;
+                bc.c00z[irys] = rijrz - tmp2 * zij_kl;
+                bc.c0px[irys] = rklrx + tmp3 * xij_kl;
+                bc.c0py[irys] = rklry + tmp3 * yij_kl;
+                bc.c0pz[irys] = rklrz + tmp3 * zij_kl;
+                gz[irys] = w[irys] * fac1;
+        }
+
+        _g0_2e_2d_f32(gf, &bc, envs);
+
+        // the 4D layout of CINTinit_int2e_EnvVars. CINTinit_int3c2e_EnvVars
+        // (lk_ceil = 0) makes the same choice, and the transfer is a no-op
+        // for CINTinit_int2c2e_EnvVars (lj_ceil = ll_ceil = 0)
+        FINT ibase = envs->li_ceil > envs->lj_ceil;
+        FINT kbase = envs->lk_ceil > envs->ll_ceil;
+        if (kbase) {
+                if (ibase) {
+                        _g0_ik2d_4d_f32(gf, envs);
+                } else {
+                        _g0_kj2d_4d_f32(gf, envs);
+                }
+        } else {
+                if (ibase) {
+                        _g0_il2d_4d_f32(gf, envs);
+                } else {
+                        _g0_lj2d_4d_f32(gf, envs);
+                }
+        }
+        return 1;
+}
+
+void CINTgout2e_f32(double *gout, double *g, FINT *idx,
+                    CINTEnvVars *envs, FINT gout_empty)
+{
+        FINT nf = envs->nf;
+        FINT nroots = envs->nrys_roots;
+        float *gf = (float *)g;
+        FINT i, n;
+        float *gx, *gy, *gz;
+        float s;
+
+        if (gout_empty) {
+                for (n = 0; n < nf; n++, idx+=3) {
+                        gx = gf + idx[0];
+                        gy = gf + idx[1];
+                        gz = gf + idx[2];
+                        s = gx[0] * gy[0] * gz[0];
+                        for (i = 1; i < nroots; i++) {
+                                s += gx[i] * gy[i] * gz[i];
+                        }
+                        gout[n] = s;
+                }
+        } else {
+                for (n = 0; n < nf; n++, idx+=3) {
+                        gx = gf + idx[0];
+                        gy = gf + idx[1];
+                        gz = gf + idx[2];
+                        s = gx[0] * gy[0] * gz[0];
+                        for (i = 1; i < nroots; i++) {
+                                s += gx[i] * gy[i] * gz[i];
+                        }
+                        gout[n] += s;
+                }
+        }
+}
+
+/*
+ * Switch the plain Coulomb integrals to the mixed precision kernels.
+ * Returns 0 if the integral is not supported. The range separated
+ * Coulomb operators stay in double precision.
+ */
+FINT CINTg2e_f32_kernels(CINTEnvVars *envs)
+{
+        if (envs->f_g0_2e != &CINTg0_2e || envs->f_gout != &CINTgout2e ||
+            envs->env[PTR_RANGE_OMEGA] != 0) {
+                return 0;
+        }
+        envs->f_g0_2e = &CINTg0_2e_f32;
+        envs->f_gout = &CINTgout2e_f32;
+        return 1;
+}
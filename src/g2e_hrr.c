@@ -0,0 +1,255 @@
+/*
+ * Copyright (C) 2013-  Qiming Sun <osirpt.sun@gmail.com>
+ *
+ * ERIs from the contracted [e0|f0] intermediates, e = li..li+lj and
+ * f = lk..lk+ll, with the Head-Gordon-Pople horizontal recursion applied
+ * once per contracted block.
+ *
+ * The primitive [e0|f0] come from the 2D Rys polynomials without the 4D
+ * transfer (see CINTinit_2e_ef_rys). CINTgout2e_ef is the gout of the
+ * regular CINT2e_loop functions, so they are contracted the same way the
+ * Rys gout are contracted. After the HRR, (ij|kl) has the same layout as
+ * the gctr of CINT2e_loop and goes through the same c2s functions.
+ */
+
+#include <string.h>
+#include <math.h>
+#include "cint_bas.h"
+#include "g2e.h"
+#include "cint2e.h"
+#include "misc.h"
+#include "rys_roots.h"
+
+// number of cartesian functions of angular momentum 0..l-1
+#define _OFF(l)         ((l)*((l)+1)*((l)+2)/6)
+// position of (ax,ay,az) in the cartesian components of shell l, see CINTcart_comp
+#define _POS(ay, az)    (((ay)+(az))*((ay)+(az)+1)/2+(az))
+
+// (ij|kl) without operators, the only integrals the [e0|f0] path supports
+static FINT _plain_2e(CINTEnvVars *envs)
+{
+        return (envs->f_g0_2e == &CINTg0_2e &&
+                envs->f_gout == &CINTgout2e &&
+                envs->ncomp_e1 * envs->ncomp_e2 * envs->ncomp_tensor == 1 &&
+                envs->gbits == 0 &&
+                envs->li_ceil == envs->i_l && envs->lj_ceil == envs->j_l &&
+                envs->lk_ceil == envs->k_l && envs->ll_ceil == envs->l_l);
+}
+
+// Nothing to transfer if lj = ll = 0
+FINT CINTrys_hrr_available(CINTEnvVars *envs)
+{
+        return _plain_2e(envs) && envs->j_l + envs->l_l > 0;
+}
+
+/*
+ * Switch envs to the 2D Rys polynomials g[n,m] of (i+j,0|k+l,0) centered on
+ * ri and rk. CINTg0_2e then skips the 4D transfer.
+ */
+void CINTinit_2e_ef_rys(CINTEnvVars *envs)
+{
+        FINT nroots = envs->nrys_roots;
+        FINT dli = envs->i_l + envs->j_l + 1;
+        FINT dlk = envs->k_l + envs->l_l + 1;
+        envs->g_stride_i = nroots;
+        envs->g_stride_k = nroots * dli;
+        envs->g_stride_l = nroots * dli * dlk;
+        envs->g_stride_j = nroots * dli * dlk;
+        envs->g_size = nroots * dli * dlk;
+        envs->g2d_ijmax = envs->g_stride_i;
+        envs->g2d_klmax = envs->g_stride_k;
+        envs->rx_in_rijrx = envs->ri;
+        envs->rx_in_rklrx = envs->rk;
+        envs->f_g0_2d4d = &CINTg0_2e_2d;
+}
+
+// idx[e,f,3] of the 2D Rys polynomials for CINTgout2e_ef
+void CINTg2e_ef_index_xyz(FINT *idx, CINTEnvVars *envs)
+{
+        FINT li = envs->i_l;
+        FINT lk = envs->k_l;
+        FINT lij = li + envs->j_l;
+        FINT lkl = lk + envs->l_l;
+        FINT dn = envs->g_stride_i;
+        FINT dm = envs->g_stride_k;
+        FINT ofy = envs->g_size;
+        FINT ofz = envs->g_size * 2;
+        FINT le, lf, ex, ey, ez, fx, fy, fz;
+        FINT n = 0;
+        for (le = li; le <= lij; le++) {
+        for (ex = le; ex >= 0; ex--) {
+        for (ey = le-ex; ey >= 0; ey--) {
+                ez = le - ex - ey;
+                for (lf = lk; lf <= lkl; lf++) {
+                for (fx = lf; fx >= 0; fx--) {
+                for (fy = lf-fx; fy >= 0; fy--) {
+                        fz = lf - fx - fy;
+                        idx[n+0] = dn * ex + dm * fx;
+                        idx[n+1] = dn * ey + dm * fy + ofy;
+                        idx[n+2] = dn * ez + dm * fz + ofz;
+                        n += 3;
+                } } }
+        } } }
+}
+
+/*
+ * The idx argument is the index_xyz of (ij|kl) passed by the loops. The
+ * [e0|f0] use the index of CINTg2e_ef_index_xyz in envs->idx instead.
+ */
+void CINTgout2e_ef(double *gout, double *g, FINT *idx, CINTEnvVars *envs,
+                   FINT gout_empty)
+{
+        FINT nroots = envs->nrys_roots;
+        idx = (FINT *)envs->idx;
+        size_t nef = CINTg2e_ef_len(envs);
+        size_t n;
+        FINT i;
+        double *gx, *gy, *gz;
+        double s;
+        for (n = 0; n < nef; n++, idx += 3) {
+                gx = g + idx[0];
+                gy = g + idx[1];
+                gz = g + idx[2];
+                s = 0;
+                for (i = 0; i < nroots; i++) {
+                        s += gx[i] * gy[i] * gz[i];
+                }
+                if (gout_empty) {
+                        gout[n] = s;
+                } else {
+                        gout[n] += s;
+                }
+        }
+}
+
+// size of the primitive [e0|f0] intermediates
+size_t CINTg2e_ef_len(CINTEnvVars *envs)
+{
+        FINT lij = envs->i_l + envs->j_l;
+        FINT lkl = envs->k_l + envs->l_l;
+        return (size_t)(_OFF(lij+1) - _OFF(envs->i_l))
+                     * (_OFF(lkl+1) - _OFF(envs->k_l));
+}
+
+size_t CINTg2e_ef_hrr_cache_size(CINTEnvVars *envs)
+{
+        FINT li = envs->i_l;
+        FINT lj = envs->j_l;
+        FINT lk = envs->k_l;
+        FINT ll = envs->l_l;
+        size_t ne = _OFF(li+lj+1) - _OFF(li);
+        size_t nf = _OFF(lk+ll+1) - _OFF(lk);
+        size_t nfij = envs->nfi * envs->nfj;
+        size_t nfkl = envs->nfk * envs->nfl;
+        return nfij * nf * 2 + nfij * nfkl
+                + MAX(envs->nfj * ne * nf, envs->nfl * nf * nfij) * 2;
+}
+
+/*
+ * (a,b+1_d| = (a+1_d,b| + (A-B)_d (a,b|
+ * in[a,nket] for a of angular momentum la..la+lb.
+ * out[b,a,nket] for b of shell lb and a of shell la.
+ */
+static void _hrr(double *out, double *in, FINT la, FINT lb, double *rab,
+                 FINT nket, double *buf)
+{
+        FINT a0 = _OFF(la);
+        if (lb == 0) {
+                memcpy(out, in, sizeof(double) * (_OFF(la+1) - a0) * nket);
+                return;
+        }
+
+        // ping-pong buffers for the intermediate b shells
+        size_t half = (size_t)(lb+1)*(lb+2)/2 * (_OFF(la+lb+1) - a0) * nket;
+        double *prev = in;
+        double *cur;
+        FINT l, d, lx, ax, ay, az, bx, by, bz, ia, ib, iap, ibm, k;
+        FINT na, na_prev;
+        double *pout, *p0, *p1;
+        for (l = 1; l <= lb; l++) {
+                na_prev = _OFF(la+lb-l+2) - a0;
+                na = _OFF(la+lb-l+1) - a0;
+                if (l == lb) {
+                        cur = out;
+                } else if (l & 1) {
+                        cur = buf;
+                } else {
+                        cur = buf + half;
+                }
+                for (bx = l, ib = 0; bx >= 0; bx--) {
+                for (by = l-bx; by >= 0; by--, ib++) {
+                        bz = l - bx - by;
+                        d = bx > 0 ? 0 : (by > 0 ? 1 : 2);
+                        ibm = (d == 0 ? _POS(by, bz)
+                             :(d == 1 ? _POS(by-1, bz) : _POS(by, bz-1)));
+                        for (lx = la, ia = 0; lx <= la+lb-l; lx++) {
+                        for (ax = lx; ax >= 0; ax--) {
+                        for (ay = lx-ax; ay >= 0; ay--, ia++) {
+                                az = lx - ax - ay;
+                                iap = _OFF(lx+1) - a0
+                                    + (d == 0 ? _POS(ay, az)
+                                     :(d == 1 ? _POS(ay+1, az) : _POS(ay, az+1)));
+                                pout = cur + ((size_t)ib * na + ia) * nket;
+                                p0 = prev + ((size_t)ibm * na_prev + ia) * nket;
+                                p1 = prev + ((size_t)ibm * na_prev + iap) * nket;
+                                for (k = 0; k < nket; k++) {
+                                        pout[k] = p1[k] + rab[d] * p0[k];
+                                }
+                        } } }
+                } }
+                prev = cur;
+        }
+}
+
+/*
+ * Transform the contracted [e0|f0] of the CINT2e loops to the cartesian
+ * (ij|kl) blocks gctr[nc,nf] in the layout of CINTg2e_index_xyz
+ */
+void CINTg2e_ef_hrr(double *gctr, double *gint, CINTEnvVars *envs, double *cache)
+{
+        FINT li = envs->i_l;
+        FINT lj = envs->j_l;
+        FINT lk = envs->k_l;
+        FINT ll = envs->l_l;
+        FINT nfi = envs->nfi;
+        FINT nfj = envs->nfj;
+        FINT nfk = envs->nfk;
+        FINT nfl = envs->nfl;
+        FINT nfij = nfi * nfj;
+        FINT *x_ctr = envs->x_ctr;
+        FINT nc = x_ctr[0] * x_ctr[1] * x_ctr[2] * x_ctr[3];
+        size_t nf = envs->nf;
+        size_t len0 = CINTg2e_ef_len(envs);
+        FINT nF = _OFF(lk+ll+1) - _OFF(lk);
+        double rirj[3], rkrl[3];
+        FINT d, i, j, k, l, n;
+        for (d = 0; d < 3; d++) {
+                rirj[d] = envs->ri[d] - envs->rj[d];
+                rkrl[d] = envs->rk[d] - envs->rl[d];
+        }
+        double *bra, *ket, *gt, *buf;
+        MALLOC_INSTACK(bra, nfij * nF);
+        MALLOC_INSTACK(gt, nfij * nF);
+        MALLOC_INSTACK(ket, nf);
+        buf = cache;
+
+        double *pout, *pket;
+        for (n = 0; n < nc; n++, gint += len0, gctr += nf) {
+                _hrr(bra, gint, li, lj, rirj, nF, buf);
+                for (i = 0; i < nfij; i++) {
+                for (j = 0; j < nF; j++) {
+                        gt[j*nfij+i] = bra[i*nF+j];
+                } }
+                _hrr(ket, gt, lk, ll, rkrl, nfij, buf);
+                // ket[l,k,j,i] -> gctr[j,l,k,i]
+                for (j = 0; j < nfj; j++) {
+                for (l = 0; l < nfl; l++) {
+                for (k = 0; k < nfk; k++) {
+                        pout = gctr + ((j * nfl + l) * nfk + k) * nfi;
+                        pket = ket + ((l * nfk + k) * nfj + j) * nfi;
+                        for (i = 0; i < nfi; i++) {
+                                pout[i] = pket[i];
+                        }
+                } } }
+        }
+}
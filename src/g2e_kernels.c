@@ -0,0 +1,16491 @@
+/*
+ * Copyright (C) 2013-  Qiming Sun <osirpt.sun@gmail.com>
+ *
+ * Straight-line g0_2d4d and gout kernels of (ij|kl) for each angular
+ * momentum class up to l = 2.
+ * This file is generated by scripts/gen_g2e_kernels.py. Do not edit.
+ */
+
+#include <stdlib.h>
+#include "config.h"
+#include "cint_bas.h"
+#include "g2e.h"
+
+#define GOUT(n, v)      gout[n] = empty ? (v) : gout[n] + (v)
+
+static inline double _g1_1(const double *z)
+{
+        return z[0];
+}
+static inline double _g2_1(const double *y, const double *z)
+{
+        return y[0]*z[0];
+}
+static inline double _g3_1(const double *x, const double *y, const double *z)
+{
+        return x[0]*y[0]*z[0];
+}
+static inline double _g1_2(const double *z)
+{
+        return z[0]
+             + z[1];
+}
+static inline double _g2_2(const double *y, const double *z)
+{
+        return y[0]*z[0]
+             + y[1]*z[1];
+}
+static inline double _g3_2(const double *x, const double *y, const double *z)
+{
+        return x[0]*y[0]*z[0]
+             + x[1]*y[1]*z[1];
+}
+static inline double _g1_3(const double *z)
+{
+        return z[0]
+             + z[1]
+             + z[2];
+}
+static inline double _g2_3(const double *y, const double *z)
+{
+        return y[0]*z[0]
+             + y[1]*z[1]
+             + y[2]*z[2];
+}
+static inline double _g3_3(const double *x, const double *y, const double *z)
+{
+        return x[0]*y[0]*z[0]
+             + x[1]*y[1]*z[1]
+             + x[2]*y[2]*z[2];
+}
+static inline double _g1_4(const double *z)
+{
+        return z[0]
+             + z[1]
+             + z[2]
+             + z[3];
+}
+static inline double _g2_4(const double *y, const double *z)
+{
+        return y[0]*z[0]
+             + y[1]*z[1]
+             + y[2]*z[2]
+             + y[3]*z[3];
+}
+static inline double _g3_4(const double *x, const double *y, const double *z)
+{
+        return x[0]*y[0]*z[0]
+             + x[1]*y[1]*z[1]
+             + x[2]*y[2]*z[2]
+             + x[3]*y[3]*z[3];
+}
+static inline double _g1_5(const double *z)
+{
+        return z[0]
+             + z[1]
+             + z[2]
+             + z[3]
+             + z[4];
+}
+static inline double _g2_5(const double *y, const double *z)
+{
+        return y[0]*z[0]
+             + y[1]*z[1]
+             + y[2]*z[2]
+             + y[3]*z[3]
+             + y[4]*z[4];
+}
+static inline double _g3_5(const double *x, const double *y, const double *z)
+{
+        return x[0]*y[0]*z[0]
+             + x[1]*y[1]*z[1]
+             + x[2]*y[2]*z[2]
+             + x[3]*y[3]*z[3]
+             + x[4]*y[4]*z[4];
+}
+
+static void _gout_0000(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gz = g + 2;
+        GOUT(0, _g1_1(gz+0));
+}
+
+static void _gout_0001(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 2;
+        double *gz = g + 4;
+        GOUT(0, _g2_1(gx+1, gz+0));
+        GOUT(1, _g2_1(gy+1, gz+0));
+        GOUT(2, _g1_1(gz+1));
+}
+
+static void _gout_0002(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 6;
+        double *gz = g + 12;
+        GOUT(0, _g2_2(gx+4, gz+0));
+        GOUT(1, _g3_2(gx+2, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+2, gz+2));
+        GOUT(3, _g2_2(gy+4, gz+0));
+        GOUT(4, _g2_2(gy+2, gz+2));
+        GOUT(5, _g1_2(gz+4));
+}
+
+static void _gout_0010(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 2;
+        double *gz = g + 4;
+        GOUT(0, _g2_1(gx+1, gz+0));
+        GOUT(1, _g2_1(gy+1, gz+0));
+        GOUT(2, _g1_1(gz+1));
+}
+
+static void _gout_0011(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 12;
+        double *gz = g + 24;
+        GOUT(0, _g2_2(gx+6, gz+0));
+        GOUT(1, _g3_2(gx+4, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+4, gz+2));
+        GOUT(3, _g3_2(gx+2, gy+4, gz+0));
+        GOUT(4, _g2_2(gy+6, gz+0));
+        GOUT(5, _g2_2(gy+4, gz+2));
+        GOUT(6, _g2_2(gx+2, gz+4));
+        GOUT(7, _g2_2(gy+2, gz+4));
+        GOUT(8, _g1_2(gz+6));
+}
+
+static void _gout_0012(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 16;
+        double *gz = g + 32;
+        GOUT(0, _g2_2(gx+10, gz+0));
+        GOUT(1, _g3_2(gx+8, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+8, gz+2));
+        GOUT(3, _g3_2(gx+6, gy+4, gz+0));
+        GOUT(4, _g3_2(gx+4, gy+6, gz+0));
+        GOUT(5, _g3_2(gx+4, gy+4, gz+2));
+        GOUT(6, _g2_2(gx+6, gz+4));
+        GOUT(7, _g3_2(gx+4, gy+2, gz+4));
+        GOUT(8, _g2_2(gx+4, gz+6));
+        GOUT(9, _g3_2(gx+2, gy+8, gz+0));
+        GOUT(10, _g2_2(gy+10, gz+0));
+        GOUT(11, _g2_2(gy+8, gz+2));
+        GOUT(12, _g3_2(gx+2, gy+4, gz+4));
+        GOUT(13, _g2_2(gy+6, gz+4));
+        GOUT(14, _g2_2(gy+4, gz+6));
+        GOUT(15, _g2_2(gx+2, gz+8));
+        GOUT(16, _g2_2(gy+2, gz+8));
+        GOUT(17, _g1_2(gz+10));
+}
+
+static void _gout_0020(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 6;
+        double *gz = g + 12;
+        GOUT(0, _g2_2(gx+4, gz+0));
+        GOUT(1, _g3_2(gx+2, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+2, gz+2));
+        GOUT(3, _g2_2(gy+4, gz+0));
+        GOUT(4, _g2_2(gy+2, gz+2));
+        GOUT(5, _g1_2(gz+4));
+}
+
+static void _gout_0021(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 16;
+        double *gz = g + 32;
+        GOUT(0, _g2_2(gx+12, gz+0));
+        GOUT(1, _g3_2(gx+10, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+10, gz+2));
+        GOUT(3, _g3_2(gx+8, gy+4, gz+0));
+        GOUT(4, _g3_2(gx+8, gy+2, gz+2));
+        GOUT(5, _g2_2(gx+8, gz+4));
+        GOUT(6, _g3_2(gx+4, gy+8, gz+0));
+        GOUT(7, _g3_2(gx+2, gy+10, gz+0));
+        GOUT(8, _g3_2(gx+2, gy+8, gz+2));
+        GOUT(9, _g2_2(gy+12, gz+0));
+        GOUT(10, _g2_2(gy+10, gz+2));
+        GOUT(11, _g2_2(gy+8, gz+4));
+        GOUT(12, _g2_2(gx+4, gz+8));
+        GOUT(13, _g3_2(gx+2, gy+2, gz+8));
+        GOUT(14, _g2_2(gx+2, gz+10));
+        GOUT(15, _g2_2(gy+4, gz+8));
+        GOUT(16, _g2_2(gy+2, gz+10));
+        GOUT(17, _g1_2(gz+12));
+}
+
+static void _g0_2d4d_0022(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 45;
+        double *gz = g + 90;
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b01 = bc->b01[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+9] = c0px;
+                gx[n+3] = sx + gx[n+9];
+                gx[n+18] = c0px * gx[n+9] + b01;
+                gx[n+12] = sx * gx[n+9] + gx[n+18];
+                gx[n+6] = sx * gx[n+3] + gx[n+12];
+                gx[n+27] = c0px * gx[n+18] + 2 * b01 * gx[n+9];
+                gx[n+21] = sx * gx[n+18] + gx[n+27];
+                gx[n+15] = sx * gx[n+12] + gx[n+21];
+                gx[n+36] = c0px * gx[n+27] + 3 * b01 * gx[n+18];
+                gx[n+30] = sx * gx[n+27] + gx[n+36];
+                gx[n+24] = sx * gx[n+21] + gx[n+30];
+                gy[n+9] = c0py;
+                gy[n+3] = sy + gy[n+9];
+                gy[n+18] = c0py * gy[n+9] + b01;
+                gy[n+12] = sy * gy[n+9] + gy[n+18];
+                gy[n+6] = sy * gy[n+3] + gy[n+12];
+                gy[n+27] = c0py * gy[n+18] + 2 * b01 * gy[n+9];
+                gy[n+21] = sy * gy[n+18] + gy[n+27];
+                gy[n+15] = sy * gy[n+12] + gy[n+21];
+                gy[n+36] = c0py * gy[n+27] + 3 * b01 * gy[n+18];
+                gy[n+30] = sy * gy[n+27] + gy[n+36];
+                gy[n+24] = sy * gy[n+21] + gy[n+30];
+                gz[n+9] = c0pz * gz[n+0];
+                gz[n+3] = sz * gz[n+0] + gz[n+9];
+                gz[n+18] = c0pz * gz[n+9] + b01 * gz[n+0];
+                gz[n+12] = sz * gz[n+9] + gz[n+18];
+                gz[n+6] = sz * gz[n+3] + gz[n+12];
+                gz[n+27] = c0pz * gz[n+18] + 2 * b01 * gz[n+9];
+                gz[n+21] = sz * gz[n+18] + gz[n+27];
+                gz[n+15] = sz * gz[n+12] + gz[n+21];
+                gz[n+36] = c0pz * gz[n+27] + 3 * b01 * gz[n+18];
+                gz[n+30] = sz * gz[n+27] + gz[n+36];
+                gz[n+24] = sz * gz[n+21] + gz[n+30];
+        }
+}
+static void _gout_0022(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 45;
+        double *gz = g + 90;
+        GOUT(0, _g2_3(gx+24, gz+0));
+        GOUT(1, _g3_3(gx+21, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+21, gz+3));
+        GOUT(3, _g3_3(gx+18, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+18, gy+3, gz+3));
+        GOUT(5, _g2_3(gx+18, gz+6));
+        GOUT(6, _g3_3(gx+15, gy+9, gz+0));
+        GOUT(7, _g3_3(gx+12, gy+12, gz+0));
+        GOUT(8, _g3_3(gx+12, gy+9, gz+3));
+        GOUT(9, _g3_3(gx+9, gy+15, gz+0));
+        GOUT(10, _g3_3(gx+9, gy+12, gz+3));
+        GOUT(11, _g3_3(gx+9, gy+9, gz+6));
+        GOUT(12, _g2_3(gx+15, gz+9));
+        GOUT(13, _g3_3(gx+12, gy+3, gz+9));
+        GOUT(14, _g2_3(gx+12, gz+12));
+        GOUT(15, _g3_3(gx+9, gy+6, gz+9));
+        GOUT(16, _g3_3(gx+9, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+9, gz+15));
+        GOUT(18, _g3_3(gx+6, gy+18, gz+0));
+        GOUT(19, _g3_3(gx+3, gy+21, gz+0));
+        GOUT(20, _g3_3(gx+3, gy+18, gz+3));
+        GOUT(21, _g2_3(gy+24, gz+0));
+        GOUT(22, _g2_3(gy+21, gz+3));
+        GOUT(23, _g2_3(gy+18, gz+6));
+        GOUT(24, _g3_3(gx+6, gy+9, gz+9));
+        GOUT(25, _g3_3(gx+3, gy+12, gz+9));
+        GOUT(26, _g3_3(gx+3, gy+9, gz+12));
+        GOUT(27, _g2_3(gy+15, gz+9));
+        GOUT(28, _g2_3(gy+12, gz+12));
+        GOUT(29, _g2_3(gy+9, gz+15));
+        GOUT(30, _g2_3(gx+6, gz+18));
+        GOUT(31, _g3_3(gx+3, gy+3, gz+18));
+        GOUT(32, _g2_3(gx+3, gz+21));
+        GOUT(33, _g2_3(gy+6, gz+18));
+        GOUT(34, _g2_3(gy+3, gz+21));
+        GOUT(35, _g1_3(gz+24));
+}
+
+static void _gout_0100(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 2;
+        double *gz = g + 4;
+        GOUT(0, _g2_1(gx+1, gz+0));
+        GOUT(1, _g2_1(gy+1, gz+0));
+        GOUT(2, _g1_1(gz+1));
+}
+
+static void _gout_0101(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 8;
+        double *gz = g + 16;
+        GOUT(0, _g2_2(gx+6, gz+0));
+        GOUT(1, _g3_2(gx+4, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+4, gz+2));
+        GOUT(3, _g3_2(gx+2, gy+4, gz+0));
+        GOUT(4, _g2_2(gy+6, gz+0));
+        GOUT(5, _g2_2(gy+4, gz+2));
+        GOUT(6, _g2_2(gx+2, gz+4));
+        GOUT(7, _g2_2(gy+2, gz+4));
+        GOUT(8, _g1_2(gz+6));
+}
+
+static void _gout_0102(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 12;
+        double *gz = g + 24;
+        GOUT(0, _g2_2(gx+10, gz+0));
+        GOUT(1, _g3_2(gx+8, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+8, gz+2));
+        GOUT(3, _g3_2(gx+6, gy+4, gz+0));
+        GOUT(4, _g3_2(gx+6, gy+2, gz+2));
+        GOUT(5, _g2_2(gx+6, gz+4));
+        GOUT(6, _g3_2(gx+4, gy+6, gz+0));
+        GOUT(7, _g3_2(gx+2, gy+8, gz+0));
+        GOUT(8, _g3_2(gx+2, gy+6, gz+2));
+        GOUT(9, _g2_2(gy+10, gz+0));
+        GOUT(10, _g2_2(gy+8, gz+2));
+        GOUT(11, _g2_2(gy+6, gz+4));
+        GOUT(12, _g2_2(gx+4, gz+6));
+        GOUT(13, _g3_2(gx+2, gy+2, gz+6));
+        GOUT(14, _g2_2(gx+2, gz+8));
+        GOUT(15, _g2_2(gy+4, gz+6));
+        GOUT(16, _g2_2(gy+2, gz+8));
+        GOUT(17, _g1_2(gz+10));
+}
+
+static void _gout_0110(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 8;
+        double *gz = g + 16;
+        GOUT(0, _g2_2(gx+6, gz+0));
+        GOUT(1, _g3_2(gx+4, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+4, gz+2));
+        GOUT(3, _g3_2(gx+2, gy+4, gz+0));
+        GOUT(4, _g2_2(gy+6, gz+0));
+        GOUT(5, _g2_2(gy+4, gz+2));
+        GOUT(6, _g2_2(gx+2, gz+4));
+        GOUT(7, _g2_2(gy+2, gz+4));
+        GOUT(8, _g1_2(gz+6));
+}
+
+static void _gout_0111(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 24;
+        double *gz = g + 48;
+        GOUT(0, _g2_2(gx+18, gz+0));
+        GOUT(1, _g3_2(gx+16, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+16, gz+2));
+        GOUT(3, _g3_2(gx+14, gy+4, gz+0));
+        GOUT(4, _g3_2(gx+12, gy+6, gz+0));
+        GOUT(5, _g3_2(gx+12, gy+4, gz+2));
+        GOUT(6, _g2_2(gx+14, gz+4));
+        GOUT(7, _g3_2(gx+12, gy+2, gz+4));
+        GOUT(8, _g2_2(gx+12, gz+6));
+        GOUT(9, _g3_2(gx+6, gy+12, gz+0));
+        GOUT(10, _g3_2(gx+4, gy+14, gz+0));
+        GOUT(11, _g3_2(gx+4, gy+12, gz+2));
+        GOUT(12, _g3_2(gx+2, gy+16, gz+0));
+        GOUT(13, _g2_2(gy+18, gz+0));
+        GOUT(14, _g2_2(gy+16, gz+2));
+        GOUT(15, _g3_2(gx+2, gy+12, gz+4));
+        GOUT(16, _g2_2(gy+14, gz+4));
+        GOUT(17, _g2_2(gy+12, gz+6));
+        GOUT(18, _g2_2(gx+6, gz+12));
+        GOUT(19, _g3_2(gx+4, gy+2, gz+12));
+        GOUT(20, _g2_2(gx+4, gz+14));
+        GOUT(21, _g3_2(gx+2, gy+4, gz+12));
+        GOUT(22, _g2_2(gy+6, gz+12));
+        GOUT(23, _g2_2(gy+4, gz+14));
+        GOUT(24, _g2_2(gx+2, gz+16));
+        GOUT(25, _g2_2(gy+2, gz+16));
+        GOUT(26, _g1_2(gz+18));
+}
+
+static void _g0_2d4d_0112(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 48;
+        double *gz = g + 96;
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+6] = c0px;
+                gx[n+3] = sx + gx[n+6];
+                gx[n+12] = c0px * gx[n+6] + b01;
+                gx[n+9] = sx * gx[n+6] + gx[n+12];
+                gx[n+18] = c0px * gx[n+12] + 2 * b01 * gx[n+6];
+                gx[n+15] = sx * gx[n+12] + gx[n+18];
+                gx[n+24] = c00x;
+                gx[n+30] = c00x * gx[n+6] + b00;
+                gx[n+27] = sx * gx[n+24] + gx[n+30];
+                gx[n+36] = c00x * gx[n+12] + 2 * b00 * gx[n+6];
+                gx[n+33] = sx * gx[n+30] + gx[n+36];
+                gx[n+42] = c00x * gx[n+18] + 3 * b00 * gx[n+12];
+                gx[n+39] = sx * gx[n+36] + gx[n+42];
+                gy[n+6] = c0py;
+                gy[n+3] = sy + gy[n+6];
+                gy[n+12] = c0py * gy[n+6] + b01;
+                gy[n+9] = sy * gy[n+6] + gy[n+12];
+                gy[n+18] = c0py * gy[n+12] + 2 * b01 * gy[n+6];
+                gy[n+15] = sy * gy[n+12] + gy[n+18];
+                gy[n+24] = c00y;
+                gy[n+30] = c00y * gy[n+6] + b00;
+                gy[n+27] = sy * gy[n+24] + gy[n+30];
+                gy[n+36] = c00y * gy[n+12] + 2 * b00 * gy[n+6];
+                gy[n+33] = sy * gy[n+30] + gy[n+36];
+                gy[n+42] = c00y * gy[n+18] + 3 * b00 * gy[n+12];
+                gy[n+39] = sy * gy[n+36] + gy[n+42];
+                gz[n+6] = c0pz * gz[n+0];
+                gz[n+3] = sz * gz[n+0] + gz[n+6];
+                gz[n+12] = c0pz * gz[n+6] + b01 * gz[n+0];
+                gz[n+9] = sz * gz[n+6] + gz[n+12];
+                gz[n+18] = c0pz * gz[n+12] + 2 * b01 * gz[n+6];
+                gz[n+15] = sz * gz[n+12] + gz[n+18];
+                gz[n+24] = c00z * gz[n+0];
+                gz[n+30] = c00z * gz[n+6] + b00 * gz[n+0];
+                gz[n+27] = sz * gz[n+24] + gz[n+30];
+                gz[n+36] = c00z * gz[n+12] + 2 * b00 * gz[n+6];
+                gz[n+33] = sz * gz[n+30] + gz[n+36];
+                gz[n+42] = c00z * gz[n+18] + 3 * b00 * gz[n+12];
+                gz[n+39] = sz * gz[n+36] + gz[n+42];
+        }
+}
+static void _gout_0112(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 48;
+        double *gz = g + 96;
+        GOUT(0, _g2_3(gx+39, gz+0));
+        GOUT(1, _g3_3(gx+36, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+36, gz+3));
+        GOUT(3, _g3_3(gx+33, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+30, gy+9, gz+0));
+        GOUT(5, _g3_3(gx+30, gy+6, gz+3));
+        GOUT(6, _g2_3(gx+33, gz+6));
+        GOUT(7, _g3_3(gx+30, gy+3, gz+6));
+        GOUT(8, _g2_3(gx+30, gz+9));
+        GOUT(9, _g3_3(gx+27, gy+12, gz+0));
+        GOUT(10, _g3_3(gx+24, gy+15, gz+0));
+        GOUT(11, _g3_3(gx+24, gy+12, gz+3));
+        GOUT(12, _g3_3(gx+27, gy+6, gz+6));
+        GOUT(13, _g3_3(gx+24, gy+9, gz+6));
+        GOUT(14, _g3_3(gx+24, gy+6, gz+9));
+        GOUT(15, _g2_3(gx+27, gz+12));
+        GOUT(16, _g3_3(gx+24, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+24, gz+15));
+        GOUT(18, _g3_3(gx+15, gy+24, gz+0));
+        GOUT(19, _g3_3(gx+12, gy+27, gz+0));
+        GOUT(20, _g3_3(gx+12, gy+24, gz+3));
+        GOUT(21, _g3_3(gx+9, gy+30, gz+0));
+        GOUT(22, _g3_3(gx+6, gy+33, gz+0));
+        GOUT(23, _g3_3(gx+6, gy+30, gz+3));
+        GOUT(24, _g3_3(gx+9, gy+24, gz+6));
+        GOUT(25, _g3_3(gx+6, gy+27, gz+6));
+        GOUT(26, _g3_3(gx+6, gy+24, gz+9));
+        GOUT(27, _g3_3(gx+3, gy+36, gz+0));
+        GOUT(28, _g2_3(gy+39, gz+0));
+        GOUT(29, _g2_3(gy+36, gz+3));
+        GOUT(30, _g3_3(gx+3, gy+30, gz+6));
+        GOUT(31, _g2_3(gy+33, gz+6));
+        GOUT(32, _g2_3(gy+30, gz+9));
+        GOUT(33, _g3_3(gx+3, gy+24, gz+12));
+        GOUT(34, _g2_3(gy+27, gz+12));
+        GOUT(35, _g2_3(gy+24, gz+15));
+        GOUT(36, _g2_3(gx+15, gz+24));
+        GOUT(37, _g3_3(gx+12, gy+3, gz+24));
+        GOUT(38, _g2_3(gx+12, gz+27));
+        GOUT(39, _g3_3(gx+9, gy+6, gz+24));
+        GOUT(40, _g3_3(gx+6, gy+9, gz+24));
+        GOUT(41, _g3_3(gx+6, gy+6, gz+27));
+        GOUT(42, _g2_3(gx+9, gz+30));
+        GOUT(43, _g3_3(gx+6, gy+3, gz+30));
+        GOUT(44, _g2_3(gx+6, gz+33));
+        GOUT(45, _g3_3(gx+3, gy+12, gz+24));
+        GOUT(46, _g2_3(gy+15, gz+24));
+        GOUT(47, _g2_3(gy+12, gz+27));
+        GOUT(48, _g3_3(gx+3, gy+6, gz+30));
+        GOUT(49, _g2_3(gy+9, gz+30));
+        GOUT(50, _g2_3(gy+6, gz+33));
+        GOUT(51, _g2_3(gx+3, gz+36));
+        GOUT(52, _g2_3(gy+3, gz+36));
+        GOUT(53, _g1_3(gz+39));
+}
+
+static void _gout_0120(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 12;
+        double *gz = g + 24;
+        GOUT(0, _g2_2(gx+10, gz+0));
+        GOUT(1, _g3_2(gx+8, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+8, gz+2));
+        GOUT(3, _g3_2(gx+6, gy+4, gz+0));
+        GOUT(4, _g3_2(gx+6, gy+2, gz+2));
+        GOUT(5, _g2_2(gx+6, gz+4));
+        GOUT(6, _g3_2(gx+4, gy+6, gz+0));
+        GOUT(7, _g3_2(gx+2, gy+8, gz+0));
+        GOUT(8, _g3_2(gx+2, gy+6, gz+2));
+        GOUT(9, _g2_2(gy+10, gz+0));
+        GOUT(10, _g2_2(gy+8, gz+2));
+        GOUT(11, _g2_2(gy+6, gz+4));
+        GOUT(12, _g2_2(gx+4, gz+6));
+        GOUT(13, _g3_2(gx+2, gy+2, gz+6));
+        GOUT(14, _g2_2(gx+2, gz+8));
+        GOUT(15, _g2_2(gy+4, gz+6));
+        GOUT(16, _g2_2(gy+2, gz+8));
+        GOUT(17, _g1_2(gz+10));
+}
+
+static void _g0_2d4d_0121(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 48;
+        double *gz = g + 96;
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+3] = c0px;
+                gx[n+6] = c0px * gx[n+3] + b01;
+                gx[n+12] = sx + gx[n+3];
+                gx[n+15] = sx * gx[n+3] + gx[n+6];
+                gx[n+9] = c0px * gx[n+6] + 2 * b01 * gx[n+3];
+                gx[n+18] = sx * gx[n+6] + gx[n+9];
+                gx[n+24] = c00x;
+                gx[n+27] = c00x * gx[n+3] + b00;
+                gx[n+30] = c00x * gx[n+6] + 2 * b00 * gx[n+3];
+                gx[n+36] = sx * gx[n+24] + gx[n+27];
+                gx[n+39] = sx * gx[n+27] + gx[n+30];
+                gx[n+33] = c00x * gx[n+9] + 3 * b00 * gx[n+6];
+                gx[n+42] = sx * gx[n+30] + gx[n+33];
+                gy[n+3] = c0py;
+                gy[n+6] = c0py * gy[n+3] + b01;
+                gy[n+12] = sy + gy[n+3];
+                gy[n+15] = sy * gy[n+3] + gy[n+6];
+                gy[n+9] = c0py * gy[n+6] + 2 * b01 * gy[n+3];
+                gy[n+18] = sy * gy[n+6] + gy[n+9];
+                gy[n+24] = c00y;
+                gy[n+27] = c00y * gy[n+3] + b00;
+                gy[n+30] = c00y * gy[n+6] + 2 * b00 * gy[n+3];
+                gy[n+36] = sy * gy[n+24] + gy[n+27];
+                gy[n+39] = sy * gy[n+27] + gy[n+30];
+                gy[n+33] = c00y * gy[n+9] + 3 * b00 * gy[n+6];
+                gy[n+42] = sy * gy[n+30] + gy[n+33];
+                gz[n+3] = c0pz * gz[n+0];
+                gz[n+6] = c0pz * gz[n+3] + b01 * gz[n+0];
+                gz[n+12] = sz * gz[n+0] + gz[n+3];
+                gz[n+15] = sz * gz[n+3] + gz[n+6];
+                gz[n+9] = c0pz * gz[n+6] + 2 * b01 * gz[n+3];
+                gz[n+18] = sz * gz[n+6] + gz[n+9];
+                gz[n+24] = c00z * gz[n+0];
+                gz[n+27] = c00z * gz[n+3] + b00 * gz[n+0];
+                gz[n+30] = c00z * gz[n+6] + 2 * b00 * gz[n+3];
+                gz[n+36] = sz * gz[n+24] + gz[n+27];
+                gz[n+39] = sz * gz[n+27] + gz[n+30];
+                gz[n+33] = c00z * gz[n+9] + 3 * b00 * gz[n+6];
+                gz[n+42] = sz * gz[n+30] + gz[n+33];
+        }
+}
+static void _gout_0121(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 48;
+        double *gz = g + 96;
+        GOUT(0, _g2_3(gx+42, gz+0));
+        GOUT(1, _g3_3(gx+39, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+39, gz+3));
+        GOUT(3, _g3_3(gx+36, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+36, gy+3, gz+3));
+        GOUT(5, _g2_3(gx+36, gz+6));
+        GOUT(6, _g3_3(gx+30, gy+12, gz+0));
+        GOUT(7, _g3_3(gx+27, gy+15, gz+0));
+        GOUT(8, _g3_3(gx+27, gy+12, gz+3));
+        GOUT(9, _g3_3(gx+24, gy+18, gz+0));
+        GOUT(10, _g3_3(gx+24, gy+15, gz+3));
+        GOUT(11, _g3_3(gx+24, gy+12, gz+6));
+        GOUT(12, _g2_3(gx+30, gz+12));
+        GOUT(13, _g3_3(gx+27, gy+3, gz+12));
+        GOUT(14, _g2_3(gx+27, gz+15));
+        GOUT(15, _g3_3(gx+24, gy+6, gz+12));
+        GOUT(16, _g3_3(gx+24, gy+3, gz+15));
+        GOUT(17, _g2_3(gx+24, gz+18));
+        GOUT(18, _g3_3(gx+18, gy+24, gz+0));
+        GOUT(19, _g3_3(gx+15, gy+27, gz+0));
+        GOUT(20, _g3_3(gx+15, gy+24, gz+3));
+        GOUT(21, _g3_3(gx+12, gy+30, gz+0));
+        GOUT(22, _g3_3(gx+12, gy+27, gz+3));
+        GOUT(23, _g3_3(gx+12, gy+24, gz+6));
+        GOUT(24, _g3_3(gx+6, gy+36, gz+0));
+        GOUT(25, _g3_3(gx+3, gy+39, gz+0));
+        GOUT(26, _g3_3(gx+3, gy+36, gz+3));
+        GOUT(27, _g2_3(gy+42, gz+0));
+        GOUT(28, _g2_3(gy+39, gz+3));
+        GOUT(29, _g2_3(gy+36, gz+6));
+        GOUT(30, _g3_3(gx+6, gy+24, gz+12));
+        GOUT(31, _g3_3(gx+3, gy+27, gz+12));
+        GOUT(32, _g3_3(gx+3, gy+24, gz+15));
+        GOUT(33, _g2_3(gy+30, gz+12));
+        GOUT(34, _g2_3(gy+27, gz+15));
+        GOUT(35, _g2_3(gy+24, gz+18));
+        GOUT(36, _g2_3(gx+18, gz+24));
+        GOUT(37, _g3_3(gx+15, gy+3, gz+24));
+        GOUT(38, _g2_3(gx+15, gz+27));
+        GOUT(39, _g3_3(gx+12, gy+6, gz+24));
+        GOUT(40, _g3_3(gx+12, gy+3, gz+27));
+        GOUT(41, _g2_3(gx+12, gz+30));
+        GOUT(42, _g3_3(gx+6, gy+12, gz+24));
+        GOUT(43, _g3_3(gx+3, gy+15, gz+24));
+        GOUT(44, _g3_3(gx+3, gy+12, gz+27));
+        GOUT(45, _g2_3(gy+18, gz+24));
+        GOUT(46, _g2_3(gy+15, gz+27));
+        GOUT(47, _g2_3(gy+12, gz+30));
+        GOUT(48, _g2_3(gx+6, gz+36));
+        GOUT(49, _g3_3(gx+3, gy+3, gz+36));
+        GOUT(50, _g2_3(gx+3, gz+39));
+        GOUT(51, _g2_3(gy+6, gz+36));
+        GOUT(52, _g2_3(gy+3, gz+39));
+        GOUT(53, _g1_3(gz+42));
+}
+
+static void _g0_2d4d_0122(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 90;
+        double *gz = g + 180;
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+9] = c0px;
+                gx[n+3] = sx + gx[n+9];
+                gx[n+18] = c0px * gx[n+9] + b01;
+                gx[n+12] = sx * gx[n+9] + gx[n+18];
+                gx[n+6] = sx * gx[n+3] + gx[n+12];
+                gx[n+27] = c0px * gx[n+18] + 2 * b01 * gx[n+9];
+                gx[n+21] = sx * gx[n+18] + gx[n+27];
+                gx[n+15] = sx * gx[n+12] + gx[n+21];
+                gx[n+36] = c0px * gx[n+27] + 3 * b01 * gx[n+18];
+                gx[n+30] = sx * gx[n+27] + gx[n+36];
+                gx[n+24] = sx * gx[n+21] + gx[n+30];
+                gx[n+45] = c00x;
+                gx[n+54] = c00x * gx[n+9] + b00;
+                gx[n+48] = sx * gx[n+45] + gx[n+54];
+                gx[n+63] = c00x * gx[n+18] + 2 * b00 * gx[n+9];
+                gx[n+57] = sx * gx[n+54] + gx[n+63];
+                gx[n+51] = sx * gx[n+48] + gx[n+57];
+                gx[n+72] = c00x * gx[n+27] + 3 * b00 * gx[n+18];
+                gx[n+66] = sx * gx[n+63] + gx[n+72];
+                gx[n+60] = sx * gx[n+57] + gx[n+66];
+                gx[n+81] = c00x * gx[n+36] + 4 * b00 * gx[n+27];
+                gx[n+75] = sx * gx[n+72] + gx[n+81];
+                gx[n+69] = sx * gx[n+66] + gx[n+75];
+                gy[n+9] = c0py;
+                gy[n+3] = sy + gy[n+9];
+                gy[n+18] = c0py * gy[n+9] + b01;
+                gy[n+12] = sy * gy[n+9] + gy[n+18];
+                gy[n+6] = sy * gy[n+3] + gy[n+12];
+                gy[n+27] = c0py * gy[n+18] + 2 * b01 * gy[n+9];
+                gy[n+21] = sy * gy[n+18] + gy[n+27];
+                gy[n+15] = sy * gy[n+12] + gy[n+21];
+                gy[n+36] = c0py * gy[n+27] + 3 * b01 * gy[n+18];
+                gy[n+30] = sy * gy[n+27] + gy[n+36];
+                gy[n+24] = sy * gy[n+21] + gy[n+30];
+                gy[n+45] = c00y;
+                gy[n+54] = c00y * gy[n+9] + b00;
+                gy[n+48] = sy * gy[n+45] + gy[n+54];
+                gy[n+63] = c00y * gy[n+18] + 2 * b00 * gy[n+9];
+                gy[n+57] = sy * gy[n+54] + gy[n+63];
+                gy[n+51] = sy * gy[n+48] + gy[n+57];
+                gy[n+72] = c00y * gy[n+27] + 3 * b00 * gy[n+18];
+                gy[n+66] = sy * gy[n+63] + gy[n+72];
+                gy[n+60] = sy * gy[n+57] + gy[n+66];
+                gy[n+81] = c00y * gy[n+36] + 4 * b00 * gy[n+27];
+                gy[n+75] = sy * gy[n+72] + gy[n+81];
+                gy[n+69] = sy * gy[n+66] + gy[n+75];
+                gz[n+9] = c0pz * gz[n+0];
+                gz[n+3] = sz * gz[n+0] + gz[n+9];
+                gz[n+18] = c0pz * gz[n+9] + b01 * gz[n+0];
+                gz[n+12] = sz * gz[n+9] + gz[n+18];
+                gz[n+6] = sz * gz[n+3] + gz[n+12];
+                gz[n+27] = c0pz * gz[n+18] + 2 * b01 * gz[n+9];
+                gz[n+21] = sz * gz[n+18] + gz[n+27];
+                gz[n+15] = sz * gz[n+12] + gz[n+21];
+                gz[n+36] = c0pz * gz[n+27] + 3 * b01 * gz[n+18];
+                gz[n+30] = sz * gz[n+27] + gz[n+36];
+                gz[n+24] = sz * gz[n+21] + gz[n+30];
+                gz[n+45] = c00z * gz[n+0];
+                gz[n+54] = c00z * gz[n+9] + b00 * gz[n+0];
+                gz[n+48] = sz * gz[n+45] + gz[n+54];
+                gz[n+63] = c00z * gz[n+18] + 2 * b00 * gz[n+9];
+                gz[n+57] = sz * gz[n+54] + gz[n+63];
+                gz[n+51] = sz * gz[n+48] + gz[n+57];
+                gz[n+72] = c00z * gz[n+27] + 3 * b00 * gz[n+18];
+                gz[n+66] = sz * gz[n+63] + gz[n+72];
+                gz[n+60] = sz * gz[n+57] + gz[n+66];
+                gz[n+81] = c00z * gz[n+36] + 4 * b00 * gz[n+27];
+                gz[n+75] = sz * gz[n+72] + gz[n+81];
+                gz[n+69] = sz * gz[n+66] + gz[n+75];
+        }
+}
+static void _gout_0122(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 90;
+        double *gz = g + 180;
+        GOUT(0, _g2_3(gx+69, gz+0));
+        GOUT(1, _g3_3(gx+66, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+66, gz+3));
+        GOUT(3, _g3_3(gx+63, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+63, gy+3, gz+3));
+        GOUT(5, _g2_3(gx+63, gz+6));
+        GOUT(6, _g3_3(gx+60, gy+9, gz+0));
+        GOUT(7, _g3_3(gx+57, gy+12, gz+0));
+        GOUT(8, _g3_3(gx+57, gy+9, gz+3));
+        GOUT(9, _g3_3(gx+54, gy+15, gz+0));
+        GOUT(10, _g3_3(gx+54, gy+12, gz+3));
+        GOUT(11, _g3_3(gx+54, gy+9, gz+6));
+        GOUT(12, _g2_3(gx+60, gz+9));
+        GOUT(13, _g3_3(gx+57, gy+3, gz+9));
+        GOUT(14, _g2_3(gx+57, gz+12));
+        GOUT(15, _g3_3(gx+54, gy+6, gz+9));
+        GOUT(16, _g3_3(gx+54, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+54, gz+15));
+        GOUT(18, _g3_3(gx+51, gy+18, gz+0));
+        GOUT(19, _g3_3(gx+48, gy+21, gz+0));
+        GOUT(20, _g3_3(gx+48, gy+18, gz+3));
+        GOUT(21, _g3_3(gx+45, gy+24, gz+0));
+        GOUT(22, _g3_3(gx+45, gy+21, gz+3));
+        GOUT(23, _g3_3(gx+45, gy+18, gz+6));
+        GOUT(24, _g3_3(gx+51, gy+9, gz+9));
+        GOUT(25, _g3_3(gx+48, gy+12, gz+9));
+        GOUT(26, _g3_3(gx+48, gy+9, gz+12));
+        GOUT(27, _g3_3(gx+45, gy+15, gz+9));
+        GOUT(28, _g3_3(gx+45, gy+12, gz+12));
+        GOUT(29, _g3_3(gx+45, gy+9, gz+15));
+        GOUT(30, _g2_3(gx+51, gz+18));
+        GOUT(31, _g3_3(gx+48, gy+3, gz+18));
+        GOUT(32, _g2_3(gx+48, gz+21));
+        GOUT(33, _g3_3(gx+45, gy+6, gz+18));
+        GOUT(34, _g3_3(gx+45, gy+3, gz+21));
+        GOUT(35, _g2_3(gx+45, gz+24));
+        GOUT(36, _g3_3(gx+24, gy+45, gz+0));
+        GOUT(37, _g3_3(gx+21, gy+48, gz+0));
+        GOUT(38, _g3_3(gx+21, gy+45, gz+3));
+        GOUT(39, _g3_3(gx+18, gy+51, gz+0));
+        GOUT(40, _g3_3(gx+18, gy+48, gz+3));
+        GOUT(41, _g3_3(gx+18, gy+45, gz+6));
+        GOUT(42, _g3_3(gx+15, gy+54, gz+0));
+        GOUT(43, _g3_3(gx+12, gy+57, gz+0));
+        GOUT(44, _g3_3(gx+12, gy+54, gz+3));
+        GOUT(45, _g3_3(gx+9, gy+60, gz+0));
+        GOUT(46, _g3_3(gx+9, gy+57, gz+3));
+        GOUT(47, _g3_3(gx+9, gy+54, gz+6));
+        GOUT(48, _g3_3(gx+15, gy+45, gz+9));
+        GOUT(49, _g3_3(gx+12, gy+48, gz+9));
+        GOUT(50, _g3_3(gx+12, gy+45, gz+12));
+        GOUT(51, _g3_3(gx+9, gy+51, gz+9));
+        GOUT(52, _g3_3(gx+9, gy+48, gz+12));
+        GOUT(53, _g3_3(gx+9, gy+45, gz+15));
+        GOUT(54, _g3_3(gx+6, gy+63, gz+0));
+        GOUT(55, _g3_3(gx+3, gy+66, gz+0));
+        GOUT(56, _g3_3(gx+3, gy+63, gz+3));
+        GOUT(57, _g2_3(gy+69, gz+0));
+        GOUT(58, _g2_3(gy+66, gz+3));
+        GOUT(59, _g2_3(gy+63, gz+6));
+        GOUT(60, _g3_3(gx+6, gy+54, gz+9));
+        GOUT(61, _g3_3(gx+3, gy+57, gz+9));
+        GOUT(62, _g3_3(gx+3, gy+54, gz+12));
+        GOUT(63, _g2_3(gy+60, gz+9));
+        GOUT(64, _g2_3(gy+57, gz+12));
+        GOUT(65, _g2_3(gy+54, gz+15));
+        GOUT(66, _g3_3(gx+6, gy+45, gz+18));
+        GOUT(67, _g3_3(gx+3, gy+48, gz+18));
+        GOUT(68, _g3_3(gx+3, gy+45, gz+21));
+        GOUT(69, _g2_3(gy+51, gz+18));
+        GOUT(70, _g2_3(gy+48, gz+21));
+        GOUT(71, _g2_3(gy+45, gz+24));
+        GOUT(72, _g2_3(gx+24, gz+45));
+        GOUT(73, _g3_3(gx+21, gy+3, gz+45));
+        GOUT(74, _g2_3(gx+21, gz+48));
+        GOUT(75, _g3_3(gx+18, gy+6, gz+45));
+        GOUT(76, _g3_3(gx+18, gy+3, gz+48));
+        GOUT(77, _g2_3(gx+18, gz+51));
+        GOUT(78, _g3_3(gx+15, gy+9, gz+45));
+        GOUT(79, _g3_3(gx+12, gy+12, gz+45));
+        GOUT(80, _g3_3(gx+12, gy+9, gz+48));
+        GOUT(81, _g3_3(gx+9, gy+15, gz+45));
+        GOUT(82, _g3_3(gx+9, gy+12, gz+48));
+        GOUT(83, _g3_3(gx+9, gy+9, gz+51));
+        GOUT(84, _g2_3(gx+15, gz+54));
+        GOUT(85, _g3_3(gx+12, gy+3, gz+54));
+        GOUT(86, _g2_3(gx+12, gz+57));
+        GOUT(87, _g3_3(gx+9, gy+6, gz+54));
+        GOUT(88, _g3_3(gx+9, gy+3, gz+57));
+        GOUT(89, _g2_3(gx+9, gz+60));
+        GOUT(90, _g3_3(gx+6, gy+18, gz+45));
+        GOUT(91, _g3_3(gx+3, gy+21, gz+45));
+        GOUT(92, _g3_3(gx+3, gy+18, gz+48));
+        GOUT(93, _g2_3(gy+24, gz+45));
+        GOUT(94, _g2_3(gy+21, gz+48));
+        GOUT(95, _g2_3(gy+18, gz+51));
+        GOUT(96, _g3_3(gx+6, gy+9, gz+54));
+        GOUT(97, _g3_3(gx+3, gy+12, gz+54));
+        GOUT(98, _g3_3(gx+3, gy+9, gz+57));
+        GOUT(99, _g2_3(gy+15, gz+54));
+        GOUT(100, _g2_3(gy+12, gz+57));
+        GOUT(101, _g2_3(gy+9, gz+60));
+        GOUT(102, _g2_3(gx+6, gz+63));
+        GOUT(103, _g3_3(gx+3, gy+3, gz+63));
+        GOUT(104, _g2_3(gx+3, gz+66));
+        GOUT(105, _g2_3(gy+6, gz+63));
+        GOUT(106, _g2_3(gy+3, gz+66));
+        GOUT(107, _g1_3(gz+69));
+}
+
+static void _gout_0200(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 6;
+        double *gz = g + 12;
+        GOUT(0, _g2_2(gx+4, gz+0));
+        GOUT(1, _g3_2(gx+2, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+2, gz+2));
+        GOUT(3, _g2_2(gy+4, gz+0));
+        GOUT(4, _g2_2(gy+2, gz+2));
+        GOUT(5, _g1_2(gz+4));
+}
+
+static void _gout_0201(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 12;
+        double *gz = g + 24;
+        GOUT(0, _g2_2(gx+10, gz+0));
+        GOUT(1, _g3_2(gx+8, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+8, gz+2));
+        GOUT(3, _g3_2(gx+6, gy+4, gz+0));
+        GOUT(4, _g3_2(gx+4, gy+6, gz+0));
+        GOUT(5, _g3_2(gx+4, gy+4, gz+2));
+        GOUT(6, _g2_2(gx+6, gz+4));
+        GOUT(7, _g3_2(gx+4, gy+2, gz+4));
+        GOUT(8, _g2_2(gx+4, gz+6));
+        GOUT(9, _g3_2(gx+2, gy+8, gz+0));
+        GOUT(10, _g2_2(gy+10, gz+0));
+        GOUT(11, _g2_2(gy+8, gz+2));
+        GOUT(12, _g3_2(gx+2, gy+4, gz+4));
+        GOUT(13, _g2_2(gy+6, gz+4));
+        GOUT(14, _g2_2(gy+4, gz+6));
+        GOUT(15, _g2_2(gx+2, gz+8));
+        GOUT(16, _g2_2(gy+2, gz+8));
+        GOUT(17, _g1_2(gz+10));
+}
+
+static void _g0_2d4d_0202(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 27;
+        double *gz = g + 54;
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+3] = c0px;
+                gx[n+6] = c0px * gx[n+3] + b01;
+                gx[n+9] = c00x;
+                gx[n+12] = c00x * gx[n+3] + b00;
+                gx[n+15] = c00x * gx[n+6] + 2 * b00 * gx[n+3];
+                gx[n+18] = c00x * gx[n+9] + b10;
+                gx[n+21] = c00x * gx[n+12] + b10 * gx[n+3] + b00 * gx[n+9];
+                gx[n+24] = c00x * gx[n+15] + b10 * gx[n+6] + 2 * b00 * gx[n+12];
+                gy[n+3] = c0py;
+                gy[n+6] = c0py * gy[n+3] + b01;
+                gy[n+9] = c00y;
+                gy[n+12] = c00y * gy[n+3] + b00;
+                gy[n+15] = c00y * gy[n+6] + 2 * b00 * gy[n+3];
+                gy[n+18] = c00y * gy[n+9] + b10;
+                gy[n+21] = c00y * gy[n+12] + b10 * gy[n+3] + b00 * gy[n+9];
+                gy[n+24] = c00y * gy[n+15] + b10 * gy[n+6] + 2 * b00 * gy[n+12];
+                gz[n+3] = c0pz * gz[n+0];
+                gz[n+6] = c0pz * gz[n+3] + b01 * gz[n+0];
+                gz[n+9] = c00z * gz[n+0];
+                gz[n+12] = c00z * gz[n+3] + b00 * gz[n+0];
+                gz[n+15] = c00z * gz[n+6] + 2 * b00 * gz[n+3];
+                gz[n+18] = c00z * gz[n+9] + b10 * gz[n+0];
+                gz[n+21] = c00z * gz[n+12] + b10 * gz[n+3] + b00 * gz[n+9];
+                gz[n+24] = c00z * gz[n+15] + b10 * gz[n+6] + 2 * b00 * gz[n+12];
+        }
+}
+static void _gout_0202(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 27;
+        double *gz = g + 54;
+        GOUT(0, _g2_3(gx+24, gz+0));
+        GOUT(1, _g3_3(gx+21, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+21, gz+3));
+        GOUT(3, _g3_3(gx+18, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+18, gy+3, gz+3));
+        GOUT(5, _g2_3(gx+18, gz+6));
+        GOUT(6, _g3_3(gx+15, gy+9, gz+0));
+        GOUT(7, _g3_3(gx+12, gy+12, gz+0));
+        GOUT(8, _g3_3(gx+12, gy+9, gz+3));
+        GOUT(9, _g3_3(gx+9, gy+15, gz+0));
+        GOUT(10, _g3_3(gx+9, gy+12, gz+3));
+        GOUT(11, _g3_3(gx+9, gy+9, gz+6));
+        GOUT(12, _g2_3(gx+15, gz+9));
+        GOUT(13, _g3_3(gx+12, gy+3, gz+9));
+        GOUT(14, _g2_3(gx+12, gz+12));
+        GOUT(15, _g3_3(gx+9, gy+6, gz+9));
+        GOUT(16, _g3_3(gx+9, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+9, gz+15));
+        GOUT(18, _g3_3(gx+6, gy+18, gz+0));
+        GOUT(19, _g3_3(gx+3, gy+21, gz+0));
+        GOUT(20, _g3_3(gx+3, gy+18, gz+3));
+        GOUT(21, _g2_3(gy+24, gz+0));
+        GOUT(22, _g2_3(gy+21, gz+3));
+        GOUT(23, _g2_3(gy+18, gz+6));
+        GOUT(24, _g3_3(gx+6, gy+9, gz+9));
+        GOUT(25, _g3_3(gx+3, gy+12, gz+9));
+        GOUT(26, _g3_3(gx+3, gy+9, gz+12));
+        GOUT(27, _g2_3(gy+15, gz+9));
+        GOUT(28, _g2_3(gy+12, gz+12));
+        GOUT(29, _g2_3(gy+9, gz+15));
+        GOUT(30, _g2_3(gx+6, gz+18));
+        GOUT(31, _g3_3(gx+3, gy+3, gz+18));
+        GOUT(32, _g2_3(gx+3, gz+21));
+        GOUT(33, _g2_3(gy+6, gz+18));
+        GOUT(34, _g2_3(gy+3, gz+21));
+        GOUT(35, _g1_3(gz+24));
+}
+
+static void _gout_0210(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 12;
+        double *gz = g + 24;
+        GOUT(0, _g2_2(gx+10, gz+0));
+        GOUT(1, _g3_2(gx+8, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+8, gz+2));
+        GOUT(3, _g3_2(gx+6, gy+4, gz+0));
+        GOUT(4, _g3_2(gx+4, gy+6, gz+0));
+        GOUT(5, _g3_2(gx+4, gy+4, gz+2));
+        GOUT(6, _g2_2(gx+6, gz+4));
+        GOUT(7, _g3_2(gx+4, gy+2, gz+4));
+        GOUT(8, _g2_2(gx+4, gz+6));
+        GOUT(9, _g3_2(gx+2, gy+8, gz+0));
+        GOUT(10, _g2_2(gy+10, gz+0));
+        GOUT(11, _g2_2(gy+8, gz+2));
+        GOUT(12, _g3_2(gx+2, gy+4, gz+4));
+        GOUT(13, _g2_2(gy+6, gz+4));
+        GOUT(14, _g2_2(gy+4, gz+6));
+        GOUT(15, _g2_2(gx+2, gz+8));
+        GOUT(16, _g2_2(gy+2, gz+8));
+        GOUT(17, _g1_2(gz+10));
+}
+
+static void _g0_2d4d_0211(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 54;
+        double *gz = g + 108;
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+6] = c0px;
+                gx[n+3] = sx + gx[n+6];
+                gx[n+12] = c0px * gx[n+6] + b01;
+                gx[n+9] = sx * gx[n+6] + gx[n+12];
+                gx[n+18] = c00x;
+                gx[n+24] = c00x * gx[n+6] + b00;
+                gx[n+21] = sx * gx[n+18] + gx[n+24];
+                gx[n+30] = c00x * gx[n+12] + 2 * b00 * gx[n+6];
+                gx[n+27] = sx * gx[n+24] + gx[n+30];
+                gx[n+36] = c00x * gx[n+18] + b10;
+                gx[n+42] = c00x * gx[n+24] + b10 * gx[n+6] + b00 * gx[n+18];
+                gx[n+39] = sx * gx[n+36] + gx[n+42];
+                gx[n+48] = c00x * gx[n+30] + b10 * gx[n+12] + 2 * b00 * gx[n+24];
+                gx[n+45] = sx * gx[n+42] + gx[n+48];
+                gy[n+6] = c0py;
+                gy[n+3] = sy + gy[n+6];
+                gy[n+12] = c0py * gy[n+6] + b01;
+                gy[n+9] = sy * gy[n+6] + gy[n+12];
+                gy[n+18] = c00y;
+                gy[n+24] = c00y * gy[n+6] + b00;
+                gy[n+21] = sy * gy[n+18] + gy[n+24];
+                gy[n+30] = c00y * gy[n+12] + 2 * b00 * gy[n+6];
+                gy[n+27] = sy * gy[n+24] + gy[n+30];
+                gy[n+36] = c00y * gy[n+18] + b10;
+                gy[n+42] = c00y * gy[n+24] + b10 * gy[n+6] + b00 * gy[n+18];
+                gy[n+39] = sy * gy[n+36] + gy[n+42];
+                gy[n+48] = c00y * gy[n+30] + b10 * gy[n+12] + 2 * b00 * gy[n+24];
+                gy[n+45] = sy * gy[n+42] + gy[n+48];
+                gz[n+6] = c0pz * gz[n+0];
+                gz[n+3] = sz * gz[n+0] + gz[n+6];
+                gz[n+12] = c0pz * gz[n+6] + b01 * gz[n+0];
+                gz[n+9] = sz * gz[n+6] + gz[n+12];
+                gz[n+18] = c00z * gz[n+0];
+                gz[n+24] = c00z * gz[n+6] + b00 * gz[n+0];
+                gz[n+21] = sz * gz[n+18] + gz[n+24];
+                gz[n+30] = c00z * gz[n+12] + 2 * b00 * gz[n+6];
+                gz[n+27] = sz * gz[n+24] + gz[n+30];
+                gz[n+36] = c00z * gz[n+18] + b10 * gz[n+0];
+                gz[n+42] = c00z * gz[n+24] + b10 * gz[n+6] + b00 * gz[n+18];
+                gz[n+39] = sz * gz[n+36] + gz[n+42];
+                gz[n+48] = c00z * gz[n+30] + b10 * gz[n+12] + 2 * b00 * gz[n+24];
+                gz[n+45] = sz * gz[n+42] + gz[n+48];
+        }
+}
+static void _gout_0211(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 54;
+        double *gz = g + 108;
+        GOUT(0, _g2_3(gx+45, gz+0));
+        GOUT(1, _g3_3(gx+42, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+42, gz+3));
+        GOUT(3, _g3_3(gx+39, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+36, gy+9, gz+0));
+        GOUT(5, _g3_3(gx+36, gy+6, gz+3));
+        GOUT(6, _g2_3(gx+39, gz+6));
+        GOUT(7, _g3_3(gx+36, gy+3, gz+6));
+        GOUT(8, _g2_3(gx+36, gz+9));
+        GOUT(9, _g3_3(gx+27, gy+18, gz+0));
+        GOUT(10, _g3_3(gx+24, gy+21, gz+0));
+        GOUT(11, _g3_3(gx+24, gy+18, gz+3));
+        GOUT(12, _g3_3(gx+21, gy+24, gz+0));
+        GOUT(13, _g3_3(gx+18, gy+27, gz+0));
+        GOUT(14, _g3_3(gx+18, gy+24, gz+3));
+        GOUT(15, _g3_3(gx+21, gy+18, gz+6));
+        GOUT(16, _g3_3(gx+18, gy+21, gz+6));
+        GOUT(17, _g3_3(gx+18, gy+18, gz+9));
+        GOUT(18, _g2_3(gx+27, gz+18));
+        GOUT(19, _g3_3(gx+24, gy+3, gz+18));
+        GOUT(20, _g2_3(gx+24, gz+21));
+        GOUT(21, _g3_3(gx+21, gy+6, gz+18));
+        GOUT(22, _g3_3(gx+18, gy+9, gz+18));
+        GOUT(23, _g3_3(gx+18, gy+6, gz+21));
+        GOUT(24, _g2_3(gx+21, gz+24));
+        GOUT(25, _g3_3(gx+18, gy+3, gz+24));
+        GOUT(26, _g2_3(gx+18, gz+27));
+        GOUT(27, _g3_3(gx+9, gy+36, gz+0));
+        GOUT(28, _g3_3(gx+6, gy+39, gz+0));
+        GOUT(29, _g3_3(gx+6, gy+36, gz+3));
+        GOUT(30, _g3_3(gx+3, gy+42, gz+0));
+        GOUT(31, _g2_3(gy+45, gz+0));
+        GOUT(32, _g2_3(gy+42, gz+3));
+        GOUT(33, _g3_3(gx+3, gy+36, gz+6));
+        GOUT(34, _g2_3(gy+39, gz+6));
+        GOUT(35, _g2_3(gy+36, gz+9));
+        GOUT(36, _g3_3(gx+9, gy+18, gz+18));
+        GOUT(37, _g3_3(gx+6, gy+21, gz+18));
+        GOUT(38, _g3_3(gx+6, gy+18, gz+21));
+        GOUT(39, _g3_3(gx+3, gy+24, gz+18));
+        GOUT(40, _g2_3(gy+27, gz+18));
+        GOUT(41, _g2_3(gy+24, gz+21));
+        GOUT(42, _g3_3(gx+3, gy+18, gz+24));
+        GOUT(43, _g2_3(gy+21, gz+24));
+        GOUT(44, _g2_3(gy+18, gz+27));
+        GOUT(45, _g2_3(gx+9, gz+36));
+        GOUT(46, _g3_3(gx+6, gy+3, gz+36));
+        GOUT(47, _g2_3(gx+6, gz+39));
+        GOUT(48, _g3_3(gx+3, gy+6, gz+36));
+        GOUT(49, _g2_3(gy+9, gz+36));
+        GOUT(50, _g2_3(gy+6, gz+39));
+        GOUT(51, _g2_3(gx+3, gz+42));
+        GOUT(52, _g2_3(gy+3, gz+42));
+        GOUT(53, _g1_3(gz+45));
+}
+
+static void _g0_2d4d_0212(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 72;
+        double *gz = g + 144;
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+6] = c0px;
+                gx[n+3] = sx + gx[n+6];
+                gx[n+12] = c0px * gx[n+6] + b01;
+                gx[n+9] = sx * gx[n+6] + gx[n+12];
+                gx[n+18] = c0px * gx[n+12] + 2 * b01 * gx[n+6];
+                gx[n+15] = sx * gx[n+12] + gx[n+18];
+                gx[n+24] = c00x;
+                gx[n+30] = c00x * gx[n+6] + b00;
+                gx[n+27] = sx * gx[n+24] + gx[n+30];
+                gx[n+36] = c00x * gx[n+12] + 2 * b00 * gx[n+6];
+                gx[n+33] = sx * gx[n+30] + gx[n+36];
+                gx[n+42] = c00x * gx[n+18] + 3 * b00 * gx[n+12];
+                gx[n+39] = sx * gx[n+36] + gx[n+42];
+                gx[n+48] = c00x * gx[n+24] + b10;
+                gx[n+54] = c00x * gx[n+30] + b10 * gx[n+6] + b00 * gx[n+24];
+                gx[n+51] = sx * gx[n+48] + gx[n+54];
+                gx[n+60] = c00x * gx[n+36] + b10 * gx[n+12] + 2 * b00 * gx[n+30];
+                gx[n+57] = sx * gx[n+54] + gx[n+60];
+                gx[n+66] = c00x * gx[n+42] + b10 * gx[n+18] + 3 * b00 * gx[n+36];
+                gx[n+63] = sx * gx[n+60] + gx[n+66];
+                gy[n+6] = c0py;
+                gy[n+3] = sy + gy[n+6];
+                gy[n+12] = c0py * gy[n+6] + b01;
+                gy[n+9] = sy * gy[n+6] + gy[n+12];
+                gy[n+18] = c0py * gy[n+12] + 2 * b01 * gy[n+6];
+                gy[n+15] = sy * gy[n+12] + gy[n+18];
+                gy[n+24] = c00y;
+                gy[n+30] = c00y * gy[n+6] + b00;
+                gy[n+27] = sy * gy[n+24] + gy[n+30];
+                gy[n+36] = c00y * gy[n+12] + 2 * b00 * gy[n+6];
+                gy[n+33] = sy * gy[n+30] + gy[n+36];
+                gy[n+42] = c00y * gy[n+18] + 3 * b00 * gy[n+12];
+                gy[n+39] = sy * gy[n+36] + gy[n+42];
+                gy[n+48] = c00y * gy[n+24] + b10;
+                gy[n+54] = c00y * gy[n+30] + b10 * gy[n+6] + b00 * gy[n+24];
+                gy[n+51] = sy * gy[n+48] + gy[n+54];
+                gy[n+60] = c00y * gy[n+36] + b10 * gy[n+12] + 2 * b00 * gy[n+30];
+                gy[n+57] = sy * gy[n+54] + gy[n+60];
+                gy[n+66] = c00y * gy[n+42] + b10 * gy[n+18] + 3 * b00 * gy[n+36];
+                gy[n+63] = sy * gy[n+60] + gy[n+66];
+                gz[n+6] = c0pz * gz[n+0];
+                gz[n+3] = sz * gz[n+0] + gz[n+6];
+                gz[n+12] = c0pz * gz[n+6] + b01 * gz[n+0];
+                gz[n+9] = sz * gz[n+6] + gz[n+12];
+                gz[n+18] = c0pz * gz[n+12] + 2 * b01 * gz[n+6];
+                gz[n+15] = sz * gz[n+12] + gz[n+18];
+                gz[n+24] = c00z * gz[n+0];
+                gz[n+30] = c00z * gz[n+6] + b00 * gz[n+0];
+                gz[n+27] = sz * gz[n+24] + gz[n+30];
+                gz[n+36] = c00z * gz[n+12] + 2 * b00 * gz[n+6];
+                gz[n+33] = sz * gz[n+30] + gz[n+36];
+                gz[n+42] = c00z * gz[n+18] + 3 * b00 * gz[n+12];
+                gz[n+39] = sz * gz[n+36] + gz[n+42];
+                gz[n+48] = c00z * gz[n+24] + b10 * gz[n+0];
+                gz[n+54] = c00z * gz[n+30] + b10 * gz[n+6] + b00 * gz[n+24];
+                gz[n+51] = sz * gz[n+48] + gz[n+54];
+                gz[n+60] = c00z * gz[n+36] + b10 * gz[n+12] + 2 * b00 * gz[n+30];
+                gz[n+57] = sz * gz[n+54] + gz[n+60];
+                gz[n+66] = c00z * gz[n+42] + b10 * gz[n+18] + 3 * b00 * gz[n+36];
+                gz[n+63] = sz * gz[n+60] + gz[n+66];
+        }
+}
+static void _gout_0212(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 72;
+        double *gz = g + 144;
+        GOUT(0, _g2_3(gx+63, gz+0));
+        GOUT(1, _g3_3(gx+60, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+60, gz+3));
+        GOUT(3, _g3_3(gx+57, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+54, gy+9, gz+0));
+        GOUT(5, _g3_3(gx+54, gy+6, gz+3));
+        GOUT(6, _g2_3(gx+57, gz+6));
+        GOUT(7, _g3_3(gx+54, gy+3, gz+6));
+        GOUT(8, _g2_3(gx+54, gz+9));
+        GOUT(9, _g3_3(gx+51, gy+12, gz+0));
+        GOUT(10, _g3_3(gx+48, gy+15, gz+0));
+        GOUT(11, _g3_3(gx+48, gy+12, gz+3));
+        GOUT(12, _g3_3(gx+51, gy+6, gz+6));
+        GOUT(13, _g3_3(gx+48, gy+9, gz+6));
+        GOUT(14, _g3_3(gx+48, gy+6, gz+9));
+        GOUT(15, _g2_3(gx+51, gz+12));
+        GOUT(16, _g3_3(gx+48, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+48, gz+15));
+        GOUT(18, _g3_3(gx+39, gy+24, gz+0));
+        GOUT(19, _g3_3(gx+36, gy+27, gz+0));
+        GOUT(20, _g3_3(gx+36, gy+24, gz+3));
+        GOUT(21, _g3_3(gx+33, gy+30, gz+0));
+        GOUT(22, _g3_3(gx+30, gy+33, gz+0));
+        GOUT(23, _g3_3(gx+30, gy+30, gz+3));
+        GOUT(24, _g3_3(gx+33, gy+24, gz+6));
+        GOUT(25, _g3_3(gx+30, gy+27, gz+6));
+        GOUT(26, _g3_3(gx+30, gy+24, gz+9));
+        GOUT(27, _g3_3(gx+27, gy+36, gz+0));
+        GOUT(28, _g3_3(gx+24, gy+39, gz+0));
+        GOUT(29, _g3_3(gx+24, gy+36, gz+3));
+        GOUT(30, _g3_3(gx+27, gy+30, gz+6));
+        GOUT(31, _g3_3(gx+24, gy+33, gz+6));
+        GOUT(32, _g3_3(gx+24, gy+30, gz+9));
+        GOUT(33, _g3_3(gx+27, gy+24, gz+12));
+        GOUT(34, _g3_3(gx+24, gy+27, gz+12));
+        GOUT(35, _g3_3(gx+24, gy+24, gz+15));
+        GOUT(36, _g2_3(gx+39, gz+24));
+        GOUT(37, _g3_3(gx+36, gy+3, gz+24));
+        GOUT(38, _g2_3(gx+36, gz+27));
+        GOUT(39, _g3_3(gx+33, gy+6, gz+24));
+        GOUT(40, _g3_3(gx+30, gy+9, gz+24));
+        GOUT(41, _g3_3(gx+30, gy+6, gz+27));
+        GOUT(42, _g2_3(gx+33, gz+30));
+        GOUT(43, _g3_3(gx+30, gy+3, gz+30));
+        GOUT(44, _g2_3(gx+30, gz+33));
+        GOUT(45, _g3_3(gx+27, gy+12, gz+24));
+        GOUT(46, _g3_3(gx+24, gy+15, gz+24));
+        GOUT(47, _g3_3(gx+24, gy+12, gz+27));
+        GOUT(48, _g3_3(gx+27, gy+6, gz+30));
+        GOUT(49, _g3_3(gx+24, gy+9, gz+30));
+        GOUT(50, _g3_3(gx+24, gy+6, gz+33));
+        GOUT(51, _g2_3(gx+27, gz+36));
+        GOUT(52, _g3_3(gx+24, gy+3, gz+36));
+        GOUT(53, _g2_3(gx+24, gz+39));
+        GOUT(54, _g3_3(gx+15, gy+48, gz+0));
+        GOUT(55, _g3_3(gx+12, gy+51, gz+0));
+        GOUT(56, _g3_3(gx+12, gy+48, gz+3));
+        GOUT(57, _g3_3(gx+9, gy+54, gz+0));
+        GOUT(58, _g3_3(gx+6, gy+57, gz+0));
+        GOUT(59, _g3_3(gx+6, gy+54, gz+3));
+        GOUT(60, _g3_3(gx+9, gy+48, gz+6));
+        GOUT(61, _g3_3(gx+6, gy+51, gz+6));
+        GOUT(62, _g3_3(gx+6, gy+48, gz+9));
+        GOUT(63, _g3_3(gx+3, gy+60, gz+0));
+        GOUT(64, _g2_3(gy+63, gz+0));
+        GOUT(65, _g2_3(gy+60, gz+3));
+        GOUT(66, _g3_3(gx+3, gy+54, gz+6));
+        GOUT(67, _g2_3(gy+57, gz+6));
+        GOUT(68, _g2_3(gy+54, gz+9));
+        GOUT(69, _g3_3(gx+3, gy+48, gz+12));
+        GOUT(70, _g2_3(gy+51, gz+12));
+        GOUT(71, _g2_3(gy+48, gz+15));
+        GOUT(72, _g3_3(gx+15, gy+24, gz+24));
+        GOUT(73, _g3_3(gx+12, gy+27, gz+24));
+        GOUT(74, _g3_3(gx+12, gy+24, gz+27));
+        GOUT(75, _g3_3(gx+9, gy+30, gz+24));
+        GOUT(76, _g3_3(gx+6, gy+33, gz+24));
+        GOUT(77, _g3_3(gx+6, gy+30, gz+27));
+        GOUT(78, _g3_3(gx+9, gy+24, gz+30));
+        GOUT(79, _g3_3(gx+6, gy+27, gz+30));
+        GOUT(80, _g3_3(gx+6, gy+24, gz+33));
+        GOUT(81, _g3_3(gx+3, gy+36, gz+24));
+        GOUT(82, _g2_3(gy+39, gz+24));
+        GOUT(83, _g2_3(gy+36, gz+27));
+        GOUT(84, _g3_3(gx+3, gy+30, gz+30));
+        GOUT(85, _g2_3(gy+33, gz+30));
+        GOUT(86, _g2_3(gy+30, gz+33));
+        GOUT(87, _g3_3(gx+3, gy+24, gz+36));
+        GOUT(88, _g2_3(gy+27, gz+36));
+        GOUT(89, _g2_3(gy+24, gz+39));
+        GOUT(90, _g2_3(gx+15, gz+48));
+        GOUT(91, _g3_3(gx+12, gy+3, gz+48));
+        GOUT(92, _g2_3(gx+12, gz+51));
+        GOUT(93, _g3_3(gx+9, gy+6, gz+48));
+        GOUT(94, _g3_3(gx+6, gy+9, gz+48));
+        GOUT(95, _g3_3(gx+6, gy+6, gz+51));
+        GOUT(96, _g2_3(gx+9, gz+54));
+        GOUT(97, _g3_3(gx+6, gy+3, gz+54));
+        GOUT(98, _g2_3(gx+6, gz+57));
+        GOUT(99, _g3_3(gx+3, gy+12, gz+48));
+        GOUT(100, _g2_3(gy+15, gz+48));
+        GOUT(101, _g2_3(gy+12, gz+51));
+        GOUT(102, _g3_3(gx+3, gy+6, gz+54));
+        GOUT(103, _g2_3(gy+9, gz+54));
+        GOUT(104, _g2_3(gy+6, gz+57));
+        GOUT(105, _g2_3(gx+3, gz+60));
+        GOUT(106, _g2_3(gy+3, gz+60));
+        GOUT(107, _g1_3(gz+63));
+}
+
+static void _g0_2d4d_0220(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 27;
+        double *gz = g + 54;
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+3] = c0px;
+                gx[n+6] = c0px * gx[n+3] + b01;
+                gx[n+9] = c00x;
+                gx[n+12] = c00x * gx[n+3] + b00;
+                gx[n+15] = c00x * gx[n+6] + 2 * b00 * gx[n+3];
+                gx[n+18] = c00x * gx[n+9] + b10;
+                gx[n+21] = c00x * gx[n+12] + b10 * gx[n+3] + b00 * gx[n+9];
+                gx[n+24] = c00x * gx[n+15] + b10 * gx[n+6] + 2 * b00 * gx[n+12];
+                gy[n+3] = c0py;
+                gy[n+6] = c0py * gy[n+3] + b01;
+                gy[n+9] = c00y;
+                gy[n+12] = c00y * gy[n+3] + b00;
+                gy[n+15] = c00y * gy[n+6] + 2 * b00 * gy[n+3];
+                gy[n+18] = c00y * gy[n+9] + b10;
+                gy[n+21] = c00y * gy[n+12] + b10 * gy[n+3] + b00 * gy[n+9];
+                gy[n+24] = c00y * gy[n+15] + b10 * gy[n+6] + 2 * b00 * gy[n+12];
+                gz[n+3] = c0pz * gz[n+0];
+                gz[n+6] = c0pz * gz[n+3] + b01 * gz[n+0];
+                gz[n+9] = c00z * gz[n+0];
+                gz[n+12] = c00z * gz[n+3] + b00 * gz[n+0];
+                gz[n+15] = c00z * gz[n+6] + 2 * b00 * gz[n+3];
+                gz[n+18] = c00z * gz[n+9] + b10 * gz[n+0];
+                gz[n+21] = c00z * gz[n+12] + b10 * gz[n+3] + b00 * gz[n+9];
+                gz[n+24] = c00z * gz[n+15] + b10 * gz[n+6] + 2 * b00 * gz[n+12];
+        }
+}
+static void _gout_0220(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 27;
+        double *gz = g + 54;
+        GOUT(0, _g2_3(gx+24, gz+0));
+        GOUT(1, _g3_3(gx+21, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+21, gz+3));
+        GOUT(3, _g3_3(gx+18, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+18, gy+3, gz+3));
+        GOUT(5, _g2_3(gx+18, gz+6));
+        GOUT(6, _g3_3(gx+15, gy+9, gz+0));
+        GOUT(7, _g3_3(gx+12, gy+12, gz+0));
+        GOUT(8, _g3_3(gx+12, gy+9, gz+3));
+        GOUT(9, _g3_3(gx+9, gy+15, gz+0));
+        GOUT(10, _g3_3(gx+9, gy+12, gz+3));
+        GOUT(11, _g3_3(gx+9, gy+9, gz+6));
+        GOUT(12, _g2_3(gx+15, gz+9));
+        GOUT(13, _g3_3(gx+12, gy+3, gz+9));
+        GOUT(14, _g2_3(gx+12, gz+12));
+        GOUT(15, _g3_3(gx+9, gy+6, gz+9));
+        GOUT(16, _g3_3(gx+9, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+9, gz+15));
+        GOUT(18, _g3_3(gx+6, gy+18, gz+0));
+        GOUT(19, _g3_3(gx+3, gy+21, gz+0));
+        GOUT(20, _g3_3(gx+3, gy+18, gz+3));
+        GOUT(21, _g2_3(gy+24, gz+0));
+        GOUT(22, _g2_3(gy+21, gz+3));
+        GOUT(23, _g2_3(gy+18, gz+6));
+        GOUT(24, _g3_3(gx+6, gy+9, gz+9));
+        GOUT(25, _g3_3(gx+3, gy+12, gz+9));
+        GOUT(26, _g3_3(gx+3, gy+9, gz+12));
+        GOUT(27, _g2_3(gy+15, gz+9));
+        GOUT(28, _g2_3(gy+12, gz+12));
+        GOUT(29, _g2_3(gy+9, gz+15));
+        GOUT(30, _g2_3(gx+6, gz+18));
+        GOUT(31, _g3_3(gx+3, gy+3, gz+18));
+        GOUT(32, _g2_3(gx+3, gz+21));
+        GOUT(33, _g2_3(gy+6, gz+18));
+        GOUT(34, _g2_3(gy+3, gz+21));
+        GOUT(35, _g1_3(gz+24));
+}
+
+static void _g0_2d4d_0221(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 72;
+        double *gz = g + 144;
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+3] = c0px;
+                gx[n+6] = c0px * gx[n+3] + b01;
+                gx[n+12] = sx + gx[n+3];
+                gx[n+15] = sx * gx[n+3] + gx[n+6];
+                gx[n+9] = c0px * gx[n+6] + 2 * b01 * gx[n+3];
+                gx[n+18] = sx * gx[n+6] + gx[n+9];
+                gx[n+24] = c00x;
+                gx[n+27] = c00x * gx[n+3] + b00;
+                gx[n+30] = c00x * gx[n+6] + 2 * b00 * gx[n+3];
+                gx[n+36] = sx * gx[n+24] + gx[n+27];
+                gx[n+39] = sx * gx[n+27] + gx[n+30];
+                gx[n+33] = c00x * gx[n+9] + 3 * b00 * gx[n+6];
+                gx[n+42] = sx * gx[n+30] + gx[n+33];
+                gx[n+48] = c00x * gx[n+24] + b10;
+                gx[n+51] = c00x * gx[n+27] + b10 * gx[n+3] + b00 * gx[n+24];
+                gx[n+54] = c00x * gx[n+30] + b10 * gx[n+6] + 2 * b00 * gx[n+27];
+                gx[n+60] = sx * gx[n+48] + gx[n+51];
+                gx[n+63] = sx * gx[n+51] + gx[n+54];
+                gx[n+57] = c00x * gx[n+33] + b10 * gx[n+9] + 3 * b00 * gx[n+30];
+                gx[n+66] = sx * gx[n+54] + gx[n+57];
+                gy[n+3] = c0py;
+                gy[n+6] = c0py * gy[n+3] + b01;
+                gy[n+12] = sy + gy[n+3];
+                gy[n+15] = sy * gy[n+3] + gy[n+6];
+                gy[n+9] = c0py * gy[n+6] + 2 * b01 * gy[n+3];
+                gy[n+18] = sy * gy[n+6] + gy[n+9];
+                gy[n+24] = c00y;
+                gy[n+27] = c00y * gy[n+3] + b00;
+                gy[n+30] = c00y * gy[n+6] + 2 * b00 * gy[n+3];
+                gy[n+36] = sy * gy[n+24] + gy[n+27];
+                gy[n+39] = sy * gy[n+27] + gy[n+30];
+                gy[n+33] = c00y * gy[n+9] + 3 * b00 * gy[n+6];
+                gy[n+42] = sy * gy[n+30] + gy[n+33];
+                gy[n+48] = c00y * gy[n+24] + b10;
+                gy[n+51] = c00y * gy[n+27] + b10 * gy[n+3] + b00 * gy[n+24];
+                gy[n+54] = c00y * gy[n+30] + b10 * gy[n+6] + 2 * b00 * gy[n+27];
+                gy[n+60] = sy * gy[n+48] + gy[n+51];
+                gy[n+63] = sy * gy[n+51] + gy[n+54];
+                gy[n+57] = c00y * gy[n+33] + b10 * gy[n+9] + 3 * b00 * gy[n+30];
+                gy[n+66] = sy * gy[n+54] + gy[n+57];
+                gz[n+3] = c0pz * gz[n+0];
+                gz[n+6] = c0pz * gz[n+3] + b01 * gz[n+0];
+                gz[n+12] = sz * gz[n+0] + gz[n+3];
+                gz[n+15] = sz * gz[n+3] + gz[n+6];
+                gz[n+9] = c0pz * gz[n+6] + 2 * b01 * gz[n+3];
+                gz[n+18] = sz * gz[n+6] + gz[n+9];
+                gz[n+24] = c00z * gz[n+0];
+                gz[n+27] = c00z * gz[n+3] + b00 * gz[n+0];
+                gz[n+30] = c00z * gz[n+6] + 2 * b00 * gz[n+3];
+                gz[n+36] = sz * gz[n+24] + gz[n+27];
+                gz[n+39] = sz * gz[n+27] + gz[n+30];
+                gz[n+33] = c00z * gz[n+9] + 3 * b00 * gz[n+6];
+                gz[n+42] = sz * gz[n+30] + gz[n+33];
+                gz[n+48] = c00z * gz[n+24] + b10 * gz[n+0];
+                gz[n+51] = c00z * gz[n+27] + b10 * gz[n+3] + b00 * gz[n+24];
+                gz[n+54] = c00z * gz[n+30] + b10 * gz[n+6] + 2 * b00 * gz[n+27];
+                gz[n+60] = sz * gz[n+48] + gz[n+51];
+                gz[n+63] = sz * gz[n+51] + gz[n+54];
+                gz[n+57] = c00z * gz[n+33] + b10 * gz[n+9] + 3 * b00 * gz[n+30];
+                gz[n+66] = sz * gz[n+54] + gz[n+57];
+        }
+}
+static void _gout_0221(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 72;
+        double *gz = g + 144;
+        GOUT(0, _g2_3(gx+66, gz+0));
+        GOUT(1, _g3_3(gx+63, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+63, gz+3));
+        GOUT(3, _g3_3(gx+60, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+60, gy+3, gz+3));
+        GOUT(5, _g2_3(gx+60, gz+6));
+        GOUT(6, _g3_3(gx+54, gy+12, gz+0));
+        GOUT(7, _g3_3(gx+51, gy+15, gz+0));
+        GOUT(8, _g3_3(gx+51, gy+12, gz+3));
+        GOUT(9, _g3_3(gx+48, gy+18, gz+0));
+        GOUT(10, _g3_3(gx+48, gy+15, gz+3));
+        GOUT(11, _g3_3(gx+48, gy+12, gz+6));
+        GOUT(12, _g2_3(gx+54, gz+12));
+        GOUT(13, _g3_3(gx+51, gy+3, gz+12));
+        GOUT(14, _g2_3(gx+51, gz+15));
+        GOUT(15, _g3_3(gx+48, gy+6, gz+12));
+        GOUT(16, _g3_3(gx+48, gy+3, gz+15));
+        GOUT(17, _g2_3(gx+48, gz+18));
+        GOUT(18, _g3_3(gx+42, gy+24, gz+0));
+        GOUT(19, _g3_3(gx+39, gy+27, gz+0));
+        GOUT(20, _g3_3(gx+39, gy+24, gz+3));
+        GOUT(21, _g3_3(gx+36, gy+30, gz+0));
+        GOUT(22, _g3_3(gx+36, gy+27, gz+3));
+        GOUT(23, _g3_3(gx+36, gy+24, gz+6));
+        GOUT(24, _g3_3(gx+30, gy+36, gz+0));
+        GOUT(25, _g3_3(gx+27, gy+39, gz+0));
+        GOUT(26, _g3_3(gx+27, gy+36, gz+3));
+        GOUT(27, _g3_3(gx+24, gy+42, gz+0));
+        GOUT(28, _g3_3(gx+24, gy+39, gz+3));
+        GOUT(29, _g3_3(gx+24, gy+36, gz+6));
+        GOUT(30, _g3_3(gx+30, gy+24, gz+12));
+        GOUT(31, _g3_3(gx+27, gy+27, gz+12));
+        GOUT(32, _g3_3(gx+27, gy+24, gz+15));
+        GOUT(33, _g3_3(gx+24, gy+30, gz+12));
+        GOUT(34, _g3_3(gx+24, gy+27, gz+15));
+        GOUT(35, _g3_3(gx+24, gy+24, gz+18));
+        GOUT(36, _g2_3(gx+42, gz+24));
+        GOUT(37, _g3_3(gx+39, gy+3, gz+24));
+        GOUT(38, _g2_3(gx+39, gz+27));
+        GOUT(39, _g3_3(gx+36, gy+6, gz+24));
+        GOUT(40, _g3_3(gx+36, gy+3, gz+27));
+        GOUT(41, _g2_3(gx+36, gz+30));
+        GOUT(42, _g3_3(gx+30, gy+12, gz+24));
+        GOUT(43, _g3_3(gx+27, gy+15, gz+24));
+        GOUT(44, _g3_3(gx+27, gy+12, gz+27));
+        GOUT(45, _g3_3(gx+24, gy+18, gz+24));
+        GOUT(46, _g3_3(gx+24, gy+15, gz+27));
+        GOUT(47, _g3_3(gx+24, gy+12, gz+30));
+        GOUT(48, _g2_3(gx+30, gz+36));
+        GOUT(49, _g3_3(gx+27, gy+3, gz+36));
+        GOUT(50, _g2_3(gx+27, gz+39));
+        GOUT(51, _g3_3(gx+24, gy+6, gz+36));
+        GOUT(52, _g3_3(gx+24, gy+3, gz+39));
+        GOUT(53, _g2_3(gx+24, gz+42));
+        GOUT(54, _g3_3(gx+18, gy+48, gz+0));
+        GOUT(55, _g3_3(gx+15, gy+51, gz+0));
+        GOUT(56, _g3_3(gx+15, gy+48, gz+3));
+        GOUT(57, _g3_3(gx+12, gy+54, gz+0));
+        GOUT(58, _g3_3(gx+12, gy+51, gz+3));
+        GOUT(59, _g3_3(gx+12, gy+48, gz+6));
+        GOUT(60, _g3_3(gx+6, gy+60, gz+0));
+        GOUT(61, _g3_3(gx+3, gy+63, gz+0));
+        GOUT(62, _g3_3(gx+3, gy+60, gz+3));
+        GOUT(63, _g2_3(gy+66, gz+0));
+        GOUT(64, _g2_3(gy+63, gz+3));
+        GOUT(65, _g2_3(gy+60, gz+6));
+        GOUT(66, _g3_3(gx+6, gy+48, gz+12));
+        GOUT(67, _g3_3(gx+3, gy+51, gz+12));
+        GOUT(68, _g3_3(gx+3, gy+48, gz+15));
+        GOUT(69, _g2_3(gy+54, gz+12));
+        GOUT(70, _g2_3(gy+51, gz+15));
+        GOUT(71, _g2_3(gy+48, gz+18));
+        GOUT(72, _g3_3(gx+18, gy+24, gz+24));
+        GOUT(73, _g3_3(gx+15, gy+27, gz+24));
+        GOUT(74, _g3_3(gx+15, gy+24, gz+27));
+        GOUT(75, _g3_3(gx+12, gy+30, gz+24));
+        GOUT(76, _g3_3(gx+12, gy+27, gz+27));
+        GOUT(77, _g3_3(gx+12, gy+24, gz+30));
+        GOUT(78, _g3_3(gx+6, gy+36, gz+24));
+        GOUT(79, _g3_3(gx+3, gy+39, gz+24));
+        GOUT(80, _g3_3(gx+3, gy+36, gz+27));
+        GOUT(81, _g2_3(gy+42, gz+24));
+        GOUT(82, _g2_3(gy+39, gz+27));
+        GOUT(83, _g2_3(gy+36, gz+30));
+        GOUT(84, _g3_3(gx+6, gy+24, gz+36));
+        GOUT(85, _g3_3(gx+3, gy+27, gz+36));
+        GOUT(86, _g3_3(gx+3, gy+24, gz+39));
+        GOUT(87, _g2_3(gy+30, gz+36));
+        GOUT(88, _g2_3(gy+27, gz+39));
+        GOUT(89, _g2_3(gy+24, gz+42));
+        GOUT(90, _g2_3(gx+18, gz+48));
+        GOUT(91, _g3_3(gx+15, gy+3, gz+48));
+        GOUT(92, _g2_3(gx+15, gz+51));
+        GOUT(93, _g3_3(gx+12, gy+6, gz+48));
+        GOUT(94, _g3_3(gx+12, gy+3, gz+51));
+        GOUT(95, _g2_3(gx+12, gz+54));
+        GOUT(96, _g3_3(gx+6, gy+12, gz+48));
+        GOUT(97, _g3_3(gx+3, gy+15, gz+48));
+        GOUT(98, _g3_3(gx+3, gy+12, gz+51));
+        GOUT(99, _g2_3(gy+18, gz+48));
+        GOUT(100, _g2_3(gy+15, gz+51));
+        GOUT(101, _g2_3(gy+12, gz+54));
+        GOUT(102, _g2_3(gx+6, gz+60));
+        GOUT(103, _g3_3(gx+3, gy+3, gz+60));
+        GOUT(104, _g2_3(gx+3, gz+63));
+        GOUT(105, _g2_3(gy+6, gz+60));
+        GOUT(106, _g2_3(gy+3, gz+63));
+        GOUT(107, _g1_3(gz+66));
+}
+
+static void _g0_2d4d_0222(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 180;
+        double *gz = g + 360;
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 4; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+12] = c0px;
+                gx[n+4] = sx + gx[n+12];
+                gx[n+24] = c0px * gx[n+12] + b01;
+                gx[n+16] = sx * gx[n+12] + gx[n+24];
+                gx[n+8] = sx * gx[n+4] + gx[n+16];
+                gx[n+36] = c0px * gx[n+24] + 2 * b01 * gx[n+12];
+                gx[n+28] = sx * gx[n+24] + gx[n+36];
+                gx[n+20] = sx * gx[n+16] + gx[n+28];
+                gx[n+48] = c0px * gx[n+36] + 3 * b01 * gx[n+24];
+                gx[n+40] = sx * gx[n+36] + gx[n+48];
+                gx[n+32] = sx * gx[n+28] + gx[n+40];
+                gx[n+60] = c00x;
+                gx[n+72] = c00x * gx[n+12] + b00;
+                gx[n+64] = sx * gx[n+60] + gx[n+72];
+                gx[n+84] = c00x * gx[n+24] + 2 * b00 * gx[n+12];
+                gx[n+76] = sx * gx[n+72] + gx[n+84];
+                gx[n+68] = sx * gx[n+64] + gx[n+76];
+                gx[n+96] = c00x * gx[n+36] + 3 * b00 * gx[n+24];
+                gx[n+88] = sx * gx[n+84] + gx[n+96];
+                gx[n+80] = sx * gx[n+76] + gx[n+88];
+                gx[n+108] = c00x * gx[n+48] + 4 * b00 * gx[n+36];
+                gx[n+100] = sx * gx[n+96] + gx[n+108];
+                gx[n+92] = sx * gx[n+88] + gx[n+100];
+                gx[n+120] = c00x * gx[n+60] + b10;
+                gx[n+132] = c00x * gx[n+72] + b10 * gx[n+12] + b00 * gx[n+60];
+                gx[n+124] = sx * gx[n+120] + gx[n+132];
+                gx[n+144] = c00x * gx[n+84] + b10 * gx[n+24] + 2 * b00 * gx[n+72];
+                gx[n+136] = sx * gx[n+132] + gx[n+144];
+                gx[n+128] = sx * gx[n+124] + gx[n+136];
+                gx[n+156] = c00x * gx[n+96] + b10 * gx[n+36] + 3 * b00 * gx[n+84];
+                gx[n+148] = sx * gx[n+144] + gx[n+156];
+                gx[n+140] = sx * gx[n+136] + gx[n+148];
+                gx[n+168] = c00x * gx[n+108] + b10 * gx[n+48] + 4 * b00 * gx[n+96];
+                gx[n+160] = sx * gx[n+156] + gx[n+168];
+                gx[n+152] = sx * gx[n+148] + gx[n+160];
+                gy[n+12] = c0py;
+                gy[n+4] = sy + gy[n+12];
+                gy[n+24] = c0py * gy[n+12] + b01;
+                gy[n+16] = sy * gy[n+12] + gy[n+24];
+                gy[n+8] = sy * gy[n+4] + gy[n+16];
+                gy[n+36] = c0py * gy[n+24] + 2 * b01 * gy[n+12];
+                gy[n+28] = sy * gy[n+24] + gy[n+36];
+                gy[n+20] = sy * gy[n+16] + gy[n+28];
+                gy[n+48] = c0py * gy[n+36] + 3 * b01 * gy[n+24];
+                gy[n+40] = sy * gy[n+36] + gy[n+48];
+                gy[n+32] = sy * gy[n+28] + gy[n+40];
+                gy[n+60] = c00y;
+                gy[n+72] = c00y * gy[n+12] + b00;
+                gy[n+64] = sy * gy[n+60] + gy[n+72];
+                gy[n+84] = c00y * gy[n+24] + 2 * b00 * gy[n+12];
+                gy[n+76] = sy * gy[n+72] + gy[n+84];
+                gy[n+68] = sy * gy[n+64] + gy[n+76];
+                gy[n+96] = c00y * gy[n+36] + 3 * b00 * gy[n+24];
+                gy[n+88] = sy * gy[n+84] + gy[n+96];
+                gy[n+80] = sy * gy[n+76] + gy[n+88];
+                gy[n+108] = c00y * gy[n+48] + 4 * b00 * gy[n+36];
+                gy[n+100] = sy * gy[n+96] + gy[n+108];
+                gy[n+92] = sy * gy[n+88] + gy[n+100];
+                gy[n+120] = c00y * gy[n+60] + b10;
+                gy[n+132] = c00y * gy[n+72] + b10 * gy[n+12] + b00 * gy[n+60];
+                gy[n+124] = sy * gy[n+120] + gy[n+132];
+                gy[n+144] = c00y * gy[n+84] + b10 * gy[n+24] + 2 * b00 * gy[n+72];
+                gy[n+136] = sy * gy[n+132] + gy[n+144];
+                gy[n+128] = sy * gy[n+124] + gy[n+136];
+                gy[n+156] = c00y * gy[n+96] + b10 * gy[n+36] + 3 * b00 * gy[n+84];
+                gy[n+148] = sy * gy[n+144] + gy[n+156];
+                gy[n+140] = sy * gy[n+136] + gy[n+148];
+                gy[n+168] = c00y * gy[n+108] + b10 * gy[n+48] + 4 * b00 * gy[n+96];
+                gy[n+160] = sy * gy[n+156] + gy[n+168];
+                gy[n+152] = sy * gy[n+148] + gy[n+160];
+                gz[n+12] = c0pz * gz[n+0];
+                gz[n+4] = sz * gz[n+0] + gz[n+12];
+                gz[n+24] = c0pz * gz[n+12] + b01 * gz[n+0];
+                gz[n+16] = sz * gz[n+12] + gz[n+24];
+                gz[n+8] = sz * gz[n+4] + gz[n+16];
+                gz[n+36] = c0pz * gz[n+24] + 2 * b01 * gz[n+12];
+                gz[n+28] = sz * gz[n+24] + gz[n+36];
+                gz[n+20] = sz * gz[n+16] + gz[n+28];
+                gz[n+48] = c0pz * gz[n+36] + 3 * b01 * gz[n+24];
+                gz[n+40] = sz * gz[n+36] + gz[n+48];
+                gz[n+32] = sz * gz[n+28] + gz[n+40];
+                gz[n+60] = c00z * gz[n+0];
+                gz[n+72] = c00z * gz[n+12] + b00 * gz[n+0];
+                gz[n+64] = sz * gz[n+60] + gz[n+72];
+                gz[n+84] = c00z * gz[n+24] + 2 * b00 * gz[n+12];
+                gz[n+76] = sz * gz[n+72] + gz[n+84];
+                gz[n+68] = sz * gz[n+64] + gz[n+76];
+                gz[n+96] = c00z * gz[n+36] + 3 * b00 * gz[n+24];
+                gz[n+88] = sz * gz[n+84] + gz[n+96];
+                gz[n+80] = sz * gz[n+76] + gz[n+88];
+                gz[n+108] = c00z * gz[n+48] + 4 * b00 * gz[n+36];
+                gz[n+100] = sz * gz[n+96] + gz[n+108];
+                gz[n+92] = sz * gz[n+88] + gz[n+100];
+                gz[n+120] = c00z * gz[n+60] + b10 * gz[n+0];
+                gz[n+132] = c00z * gz[n+72] + b10 * gz[n+12] + b00 * gz[n+60];
+                gz[n+124] = sz * gz[n+120] + gz[n+132];
+                gz[n+144] = c00z * gz[n+84] + b10 * gz[n+24] + 2 * b00 * gz[n+72];
+                gz[n+136] = sz * gz[n+132] + gz[n+144];
+                gz[n+128] = sz * gz[n+124] + gz[n+136];
+                gz[n+156] = c00z * gz[n+96] + b10 * gz[n+36] + 3 * b00 * gz[n+84];
+                gz[n+148] = sz * gz[n+144] + gz[n+156];
+                gz[n+140] = sz * gz[n+136] + gz[n+148];
+                gz[n+168] = c00z * gz[n+108] + b10 * gz[n+48] + 4 * b00 * gz[n+96];
+                gz[n+160] = sz * gz[n+156] + gz[n+168];
+                gz[n+152] = sz * gz[n+148] + gz[n+160];
+        }
+}
+static void _gout_0222(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 180;
+        double *gz = g + 360;
+        GOUT(0, _g2_4(gx+152, gz+0));
+        GOUT(1, _g3_4(gx+148, gy+4, gz+0));
+        GOUT(2, _g2_4(gx+148, gz+4));
+        GOUT(3, _g3_4(gx+144, gy+8, gz+0));
+        GOUT(4, _g3_4(gx+144, gy+4, gz+4));
+        GOUT(5, _g2_4(gx+144, gz+8));
+        GOUT(6, _g3_4(gx+140, gy+12, gz+0));
+        GOUT(7, _g3_4(gx+136, gy+16, gz+0));
+        GOUT(8, _g3_4(gx+136, gy+12, gz+4));
+        GOUT(9, _g3_4(gx+132, gy+20, gz+0));
+        GOUT(10, _g3_4(gx+132, gy+16, gz+4));
+        GOUT(11, _g3_4(gx+132, gy+12, gz+8));
+        GOUT(12, _g2_4(gx+140, gz+12));
+        GOUT(13, _g3_4(gx+136, gy+4, gz+12));
+        GOUT(14, _g2_4(gx+136, gz+16));
+        GOUT(15, _g3_4(gx+132, gy+8, gz+12));
+        GOUT(16, _g3_4(gx+132, gy+4, gz+16));
+        GOUT(17, _g2_4(gx+132, gz+20));
+        GOUT(18, _g3_4(gx+128, gy+24, gz+0));
+        GOUT(19, _g3_4(gx+124, gy+28, gz+0));
+        GOUT(20, _g3_4(gx+124, gy+24, gz+4));
+        GOUT(21, _g3_4(gx+120, gy+32, gz+0));
+        GOUT(22, _g3_4(gx+120, gy+28, gz+4));
+        GOUT(23, _g3_4(gx+120, gy+24, gz+8));
+        GOUT(24, _g3_4(gx+128, gy+12, gz+12));
+        GOUT(25, _g3_4(gx+124, gy+16, gz+12));
+        GOUT(26, _g3_4(gx+124, gy+12, gz+16));
+        GOUT(27, _g3_4(gx+120, gy+20, gz+12));
+        GOUT(28, _g3_4(gx+120, gy+16, gz+16));
+        GOUT(29, _g3_4(gx+120, gy+12, gz+20));
+        GOUT(30, _g2_4(gx+128, gz+24));
+        GOUT(31, _g3_4(gx+124, gy+4, gz+24));
+        GOUT(32, _g2_4(gx+124, gz+28));
+        GOUT(33, _g3_4(gx+120, gy+8, gz+24));
+        GOUT(34, _g3_4(gx+120, gy+4, gz+28));
+        GOUT(35, _g2_4(gx+120, gz+32));
+        GOUT(36, _g3_4(gx+92, gy+60, gz+0));
+        GOUT(37, _g3_4(gx+88, gy+64, gz+0));
+        GOUT(38, _g3_4(gx+88, gy+60, gz+4));
+        GOUT(39, _g3_4(gx+84, gy+68, gz+0));
+        GOUT(40, _g3_4(gx+84, gy+64, gz+4));
+        GOUT(41, _g3_4(gx+84, gy+60, gz+8));
+        GOUT(42, _g3_4(gx+80, gy+72, gz+0));
+        GOUT(43, _g3_4(gx+76, gy+76, gz+0));
+        GOUT(44, _g3_4(gx+76, gy+72, gz+4));
+        GOUT(45, _g3_4(gx+72, gy+80, gz+0));
+        GOUT(46, _g3_4(gx+72, gy+76, gz+4));
+        GOUT(47, _g3_4(gx+72, gy+72, gz+8));
+        GOUT(48, _g3_4(gx+80, gy+60, gz+12));
+        GOUT(49, _g3_4(gx+76, gy+64, gz+12));
+        GOUT(50, _g3_4(gx+76, gy+60, gz+16));
+        GOUT(51, _g3_4(gx+72, gy+68, gz+12));
+        GOUT(52, _g3_4(gx+72, gy+64, gz+16));
+        GOUT(53, _g3_4(gx+72, gy+60, gz+20));
+        GOUT(54, _g3_4(gx+68, gy+84, gz+0));
+        GOUT(55, _g3_4(gx+64, gy+88, gz+0));
+        GOUT(56, _g3_4(gx+64, gy+84, gz+4));
+        GOUT(57, _g3_4(gx+60, gy+92, gz+0));
+        GOUT(58, _g3_4(gx+60, gy+88, gz+4));
+        GOUT(59, _g3_4(gx+60, gy+84, gz+8));
+        GOUT(60, _g3_4(gx+68, gy+72, gz+12));
+        GOUT(61, _g3_4(gx+64, gy+76, gz+12));
+        GOUT(62, _g3_4(gx+64, gy+72, gz+16));
+        GOUT(63, _g3_4(gx+60, gy+80, gz+12));
+        GOUT(64, _g3_4(gx+60, gy+76, gz+16));
+        GOUT(65, _g3_4(gx+60, gy+72, gz+20));
+        GOUT(66, _g3_4(gx+68, gy+60, gz+24));
+        GOUT(67, _g3_4(gx+64, gy+64, gz+24));
+        GOUT(68, _g3_4(gx+64, gy+60, gz+28));
+        GOUT(69, _g3_4(gx+60, gy+68, gz+24));
+        GOUT(70, _g3_4(gx+60, gy+64, gz+28));
+        GOUT(71, _g3_4(gx+60, gy+60, gz+32));
+        GOUT(72, _g2_4(gx+92, gz+60));
+        GOUT(73, _g3_4(gx+88, gy+4, gz+60));
+        GOUT(74, _g2_4(gx+88, gz+64));
+        GOUT(75, _g3_4(gx+84, gy+8, gz+60));
+        GOUT(76, _g3_4(gx+84, gy+4, gz+64));
+        GOUT(77, _g2_4(gx+84, gz+68));
+        GOUT(78, _g3_4(gx+80, gy+12, gz+60));
+        GOUT(79, _g3_4(gx+76, gy+16, gz+60));
+        GOUT(80, _g3_4(gx+76, gy+12, gz+64));
+        GOUT(81, _g3_4(gx+72, gy+20, gz+60));
+        GOUT(82, _g3_4(gx+72, gy+16, gz+64));
+        GOUT(83, _g3_4(gx+72, gy+12, gz+68));
+        GOUT(84, _g2_4(gx+80, gz+72));
+        GOUT(85, _g3_4(gx+76, gy+4, gz+72));
+        GOUT(86, _g2_4(gx+76, gz+76));
+        GOUT(87, _g3_4(gx+72, gy+8, gz+72));
+        GOUT(88, _g3_4(gx+72, gy+4, gz+76));
+        GOUT(89, _g2_4(gx+72, gz+80));
+        GOUT(90, _g3_4(gx+68, gy+24, gz+60));
+        GOUT(91, _g3_4(gx+64, gy+28, gz+60));
+        GOUT(92, _g3_4(gx+64, gy+24, gz+64));
+        GOUT(93, _g3_4(gx+60, gy+32, gz+60));
+        GOUT(94, _g3_4(gx+60, gy+28, gz+64));
+        GOUT(95, _g3_4(gx+60, gy+24, gz+68));
+        GOUT(96, _g3_4(gx+68, gy+12, gz+72));
+        GOUT(97, _g3_4(gx+64, gy+16, gz+72));
+        GOUT(98, _g3_4(gx+64, gy+12, gz+76));
+        GOUT(99, _g3_4(gx+60, gy+20, gz+72));
+        GOUT(100, _g3_4(gx+60, gy+16, gz+76));
+        GOUT(101, _g3_4(gx+60, gy+12, gz+80));
+        GOUT(102, _g2_4(gx+68, gz+84));
+        GOUT(103, _g3_4(gx+64, gy+4, gz+84));
+        GOUT(104, _g2_4(gx+64, gz+88));
+        GOUT(105, _g3_4(gx+60, gy+8, gz+84));
+        GOUT(106, _g3_4(gx+60, gy+4, gz+88));
+        GOUT(107, _g2_4(gx+60, gz+92));
+        GOUT(108, _g3_4(gx+32, gy+120, gz+0));
+        GOUT(109, _g3_4(gx+28, gy+124, gz+0));
+        GOUT(110, _g3_4(gx+28, gy+120, gz+4));
+        GOUT(111, _g3_4(gx+24, gy+128, gz+0));
+        GOUT(112, _g3_4(gx+24, gy+124, gz+4));
+        GOUT(113, _g3_4(gx+24, gy+120, gz+8));
+        GOUT(114, _g3_4(gx+20, gy+132, gz+0));
+        GOUT(115, _g3_4(gx+16, gy+136, gz+0));
+        GOUT(116, _g3_4(gx+16, gy+132, gz+4));
+        GOUT(117, _g3_4(gx+12, gy+140, gz+0));
+        GOUT(118, _g3_4(gx+12, gy+136, gz+4));
+        GOUT(119, _g3_4(gx+12, gy+132, gz+8));
+        GOUT(120, _g3_4(gx+20, gy+120, gz+12));
+        GOUT(121, _g3_4(gx+16, gy+124, gz+12));
+        GOUT(122, _g3_4(gx+16, gy+120, gz+16));
+        GOUT(123, _g3_4(gx+12, gy+128, gz+12));
+        GOUT(124, _g3_4(gx+12, gy+124, gz+16));
+        GOUT(125, _g3_4(gx+12, gy+120, gz+20));
+        GOUT(126, _g3_4(gx+8, gy+144, gz+0));
+        GOUT(127, _g3_4(gx+4, gy+148, gz+0));
+        GOUT(128, _g3_4(gx+4, gy+144, gz+4));
+        GOUT(129, _g2_4(gy+152, gz+0));
+        GOUT(130, _g2_4(gy+148, gz+4));
+        GOUT(131, _g2_4(gy+144, gz+8));
+        GOUT(132, _g3_4(gx+8, gy+132, gz+12));
+        GOUT(133, _g3_4(gx+4, gy+136, gz+12));
+        GOUT(134, _g3_4(gx+4, gy+132, gz+16));
+        GOUT(135, _g2_4(gy+140, gz+12));
+        GOUT(136, _g2_4(gy+136, gz+16));
+        GOUT(137, _g2_4(gy+132, gz+20));
+        GOUT(138, _g3_4(gx+8, gy+120, gz+24));
+        GOUT(139, _g3_4(gx+4, gy+124, gz+24));
+        GOUT(140, _g3_4(gx+4, gy+120, gz+28));
+        GOUT(141, _g2_4(gy+128, gz+24));
+        GOUT(142, _g2_4(gy+124, gz+28));
+        GOUT(143, _g2_4(gy+120, gz+32));
+        GOUT(144, _g3_4(gx+32, gy+60, gz+60));
+        GOUT(145, _g3_4(gx+28, gy+64, gz+60));
+        GOUT(146, _g3_4(gx+28, gy+60, gz+64));
+        GOUT(147, _g3_4(gx+24, gy+68, gz+60));
+        GOUT(148, _g3_4(gx+24, gy+64, gz+64));
+        GOUT(149, _g3_4(gx+24, gy+60, gz+68));
+        GOUT(150, _g3_4(gx+20, gy+72, gz+60));
+        GOUT(151, _g3_4(gx+16, gy+76, gz+60));
+        GOUT(152, _g3_4(gx+16, gy+72, gz+64));
+        GOUT(153, _g3_4(gx+12, gy+80, gz+60));
+        GOUT(154, _g3_4(gx+12, gy+76, gz+64));
+        GOUT(155, _g3_4(gx+12, gy+72, gz+68));
+        GOUT(156, _g3_4(gx+20, gy+60, gz+72));
+        GOUT(157, _g3_4(gx+16, gy+64, gz+72));
+        GOUT(158, _g3_4(gx+16, gy+60, gz+76));
+        GOUT(159, _g3_4(gx+12, gy+68, gz+72));
+        GOUT(160, _g3_4(gx+12, gy+64, gz+76));
+        GOUT(161, _g3_4(gx+12, gy+60, gz+80));
+        GOUT(162, _g3_4(gx+8, gy+84, gz+60));
+        GOUT(163, _g3_4(gx+4, gy+88, gz+60));
+        GOUT(164, _g3_4(gx+4, gy+84, gz+64));
+        GOUT(165, _g2_4(gy+92, gz+60));
+        GOUT(166, _g2_4(gy+88, gz+64));
+        GOUT(167, _g2_4(gy+84, gz+68));
+        GOUT(168, _g3_4(gx+8, gy+72, gz+72));
+        GOUT(169, _g3_4(gx+4, gy+76, gz+72));
+        GOUT(170, _g3_4(gx+4, gy+72, gz+76));
+        GOUT(171, _g2_4(gy+80, gz+72));
+        GOUT(172, _g2_4(gy+76, gz+76));
+        GOUT(173, _g2_4(gy+72, gz+80));
+        GOUT(174, _g3_4(gx+8, gy+60, gz+84));
+        GOUT(175, _g3_4(gx+4, gy+64, gz+84));
+        GOUT(176, _g3_4(gx+4, gy+60, gz+88));
+        GOUT(177, _g2_4(gy+68, gz+84));
+        GOUT(178, _g2_4(gy+64, gz+88));
+        GOUT(179, _g2_4(gy+60, gz+92));
+        GOUT(180, _g2_4(gx+32, gz+120));
+        GOUT(181, _g3_4(gx+28, gy+4, gz+120));
+        GOUT(182, _g2_4(gx+28, gz+124));
+        GOUT(183, _g3_4(gx+24, gy+8, gz+120));
+        GOUT(184, _g3_4(gx+24, gy+4, gz+124));
+        GOUT(185, _g2_4(gx+24, gz+128));
+        GOUT(186, _g3_4(gx+20, gy+12, gz+120));
+        GOUT(187, _g3_4(gx+16, gy+16, gz+120));
+        GOUT(188, _g3_4(gx+16, gy+12, gz+124));
+        GOUT(189, _g3_4(gx+12, gy+20, gz+120));
+        GOUT(190, _g3_4(gx+12, gy+16, gz+124));
+        GOUT(191, _g3_4(gx+12, gy+12, gz+128));
+        GOUT(192, _g2_4(gx+20, gz+132));
+        GOUT(193, _g3_4(gx+16, gy+4, gz+132));
+        GOUT(194, _g2_4(gx+16, gz+136));
+        GOUT(195, _g3_4(gx+12, gy+8, gz+132));
+        GOUT(196, _g3_4(gx+12, gy+4, gz+136));
+        GOUT(197, _g2_4(gx+12, gz+140));
+        GOUT(198, _g3_4(gx+8, gy+24, gz+120));
+        GOUT(199, _g3_4(gx+4, gy+28, gz+120));
+        GOUT(200, _g3_4(gx+4, gy+24, gz+124));
+        GOUT(201, _g2_4(gy+32, gz+120));
+        GOUT(202, _g2_4(gy+28, gz+124));
+        GOUT(203, _g2_4(gy+24, gz+128));
+        GOUT(204, _g3_4(gx+8, gy+12, gz+132));
+        GOUT(205, _g3_4(gx+4, gy+16, gz+132));
+        GOUT(206, _g3_4(gx+4, gy+12, gz+136));
+        GOUT(207, _g2_4(gy+20, gz+132));
+        GOUT(208, _g2_4(gy+16, gz+136));
+        GOUT(209, _g2_4(gy+12, gz+140));
+        GOUT(210, _g2_4(gx+8, gz+144));
+        GOUT(211, _g3_4(gx+4, gy+4, gz+144));
+        GOUT(212, _g2_4(gx+4, gz+148));
+        GOUT(213, _g2_4(gy+8, gz+144));
+        GOUT(214, _g2_4(gy+4, gz+148));
+        GOUT(215, _g1_4(gz+152));
+}
+
+static void _gout_1000(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 2;
+        double *gz = g + 4;
+        GOUT(0, _g2_1(gx+1, gz+0));
+        GOUT(1, _g2_1(gy+1, gz+0));
+        GOUT(2, _g1_1(gz+1));
+}
+
+static void _gout_1001(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 8;
+        double *gz = g + 16;
+        GOUT(0, _g2_2(gx+6, gz+0));
+        GOUT(1, _g3_2(gx+4, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+4, gz+2));
+        GOUT(3, _g3_2(gx+2, gy+4, gz+0));
+        GOUT(4, _g2_2(gy+6, gz+0));
+        GOUT(5, _g2_2(gy+4, gz+2));
+        GOUT(6, _g2_2(gx+2, gz+4));
+        GOUT(7, _g2_2(gy+2, gz+4));
+        GOUT(8, _g1_2(gz+6));
+}
+
+static void _gout_1002(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 12;
+        double *gz = g + 24;
+        GOUT(0, _g2_2(gx+10, gz+0));
+        GOUT(1, _g3_2(gx+8, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+8, gz+2));
+        GOUT(3, _g3_2(gx+6, gy+4, gz+0));
+        GOUT(4, _g3_2(gx+4, gy+6, gz+0));
+        GOUT(5, _g3_2(gx+4, gy+4, gz+2));
+        GOUT(6, _g2_2(gx+6, gz+4));
+        GOUT(7, _g3_2(gx+4, gy+2, gz+4));
+        GOUT(8, _g2_2(gx+4, gz+6));
+        GOUT(9, _g3_2(gx+2, gy+8, gz+0));
+        GOUT(10, _g2_2(gy+10, gz+0));
+        GOUT(11, _g2_2(gy+8, gz+2));
+        GOUT(12, _g3_2(gx+2, gy+4, gz+4));
+        GOUT(13, _g2_2(gy+6, gz+4));
+        GOUT(14, _g2_2(gy+4, gz+6));
+        GOUT(15, _g2_2(gx+2, gz+8));
+        GOUT(16, _g2_2(gy+2, gz+8));
+        GOUT(17, _g1_2(gz+10));
+}
+
+static void _gout_1010(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 8;
+        double *gz = g + 16;
+        GOUT(0, _g2_2(gx+6, gz+0));
+        GOUT(1, _g3_2(gx+4, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+4, gz+2));
+        GOUT(3, _g3_2(gx+2, gy+4, gz+0));
+        GOUT(4, _g2_2(gy+6, gz+0));
+        GOUT(5, _g2_2(gy+4, gz+2));
+        GOUT(6, _g2_2(gx+2, gz+4));
+        GOUT(7, _g2_2(gy+2, gz+4));
+        GOUT(8, _g1_2(gz+6));
+}
+
+static void _gout_1011(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 24;
+        double *gz = g + 48;
+        GOUT(0, _g2_2(gx+14, gz+0));
+        GOUT(1, _g3_2(gx+12, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+12, gz+2));
+        GOUT(3, _g3_2(gx+10, gy+4, gz+0));
+        GOUT(4, _g3_2(gx+8, gy+6, gz+0));
+        GOUT(5, _g3_2(gx+8, gy+4, gz+2));
+        GOUT(6, _g2_2(gx+10, gz+4));
+        GOUT(7, _g3_2(gx+8, gy+2, gz+4));
+        GOUT(8, _g2_2(gx+8, gz+6));
+        GOUT(9, _g3_2(gx+6, gy+8, gz+0));
+        GOUT(10, _g3_2(gx+4, gy+10, gz+0));
+        GOUT(11, _g3_2(gx+4, gy+8, gz+2));
+        GOUT(12, _g3_2(gx+2, gy+12, gz+0));
+        GOUT(13, _g2_2(gy+14, gz+0));
+        GOUT(14, _g2_2(gy+12, gz+2));
+        GOUT(15, _g3_2(gx+2, gy+8, gz+4));
+        GOUT(16, _g2_2(gy+10, gz+4));
+        GOUT(17, _g2_2(gy+8, gz+6));
+        GOUT(18, _g2_2(gx+6, gz+8));
+        GOUT(19, _g3_2(gx+4, gy+2, gz+8));
+        GOUT(20, _g2_2(gx+4, gz+10));
+        GOUT(21, _g3_2(gx+2, gy+4, gz+8));
+        GOUT(22, _g2_2(gy+6, gz+8));
+        GOUT(23, _g2_2(gy+4, gz+10));
+        GOUT(24, _g2_2(gx+2, gz+12));
+        GOUT(25, _g2_2(gy+2, gz+12));
+        GOUT(26, _g1_2(gz+14));
+}
+
+static void _g0_2d4d_1012(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 48;
+        double *gz = g + 96;
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+3] = c00x;
+                gx[n+12] = c0px;
+                gx[n+6] = sx + gx[n+12];
+                gx[n+15] = c00x * gx[n+12] + b00;
+                gx[n+9] = sx * gx[n+3] + gx[n+15];
+                gx[n+24] = c0px * gx[n+12] + b01;
+                gx[n+18] = sx * gx[n+12] + gx[n+24];
+                gx[n+27] = c00x * gx[n+24] + 2 * b00 * gx[n+12];
+                gx[n+21] = sx * gx[n+15] + gx[n+27];
+                gx[n+36] = c0px * gx[n+24] + 2 * b01 * gx[n+12];
+                gx[n+30] = sx * gx[n+24] + gx[n+36];
+                gx[n+39] = c00x * gx[n+36] + 3 * b00 * gx[n+24];
+                gx[n+33] = sx * gx[n+27] + gx[n+39];
+                gy[n+3] = c00y;
+                gy[n+12] = c0py;
+                gy[n+6] = sy + gy[n+12];
+                gy[n+15] = c00y * gy[n+12] + b00;
+                gy[n+9] = sy * gy[n+3] + gy[n+15];
+                gy[n+24] = c0py * gy[n+12] + b01;
+                gy[n+18] = sy * gy[n+12] + gy[n+24];
+                gy[n+27] = c00y * gy[n+24] + 2 * b00 * gy[n+12];
+                gy[n+21] = sy * gy[n+15] + gy[n+27];
+                gy[n+36] = c0py * gy[n+24] + 2 * b01 * gy[n+12];
+                gy[n+30] = sy * gy[n+24] + gy[n+36];
+                gy[n+39] = c00y * gy[n+36] + 3 * b00 * gy[n+24];
+                gy[n+33] = sy * gy[n+27] + gy[n+39];
+                gz[n+3] = c00z * gz[n+0];
+                gz[n+12] = c0pz * gz[n+0];
+                gz[n+6] = sz * gz[n+0] + gz[n+12];
+                gz[n+15] = c00z * gz[n+12] + b00 * gz[n+0];
+                gz[n+9] = sz * gz[n+3] + gz[n+15];
+                gz[n+24] = c0pz * gz[n+12] + b01 * gz[n+0];
+                gz[n+18] = sz * gz[n+12] + gz[n+24];
+                gz[n+27] = c00z * gz[n+24] + 2 * b00 * gz[n+12];
+                gz[n+21] = sz * gz[n+15] + gz[n+27];
+                gz[n+36] = c0pz * gz[n+24] + 2 * b01 * gz[n+12];
+                gz[n+30] = sz * gz[n+24] + gz[n+36];
+                gz[n+39] = c00z * gz[n+36] + 3 * b00 * gz[n+24];
+                gz[n+33] = sz * gz[n+27] + gz[n+39];
+        }
+}
+static void _gout_1012(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 48;
+        double *gz = g + 96;
+        GOUT(0, _g2_3(gx+33, gz+0));
+        GOUT(1, _g3_3(gx+30, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+30, gz+3));
+        GOUT(3, _g3_3(gx+27, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+24, gy+9, gz+0));
+        GOUT(5, _g3_3(gx+24, gy+6, gz+3));
+        GOUT(6, _g2_3(gx+27, gz+6));
+        GOUT(7, _g3_3(gx+24, gy+3, gz+6));
+        GOUT(8, _g2_3(gx+24, gz+9));
+        GOUT(9, _g3_3(gx+21, gy+12, gz+0));
+        GOUT(10, _g3_3(gx+18, gy+15, gz+0));
+        GOUT(11, _g3_3(gx+18, gy+12, gz+3));
+        GOUT(12, _g3_3(gx+15, gy+18, gz+0));
+        GOUT(13, _g3_3(gx+12, gy+21, gz+0));
+        GOUT(14, _g3_3(gx+12, gy+18, gz+3));
+        GOUT(15, _g3_3(gx+15, gy+12, gz+6));
+        GOUT(16, _g3_3(gx+12, gy+15, gz+6));
+        GOUT(17, _g3_3(gx+12, gy+12, gz+9));
+        GOUT(18, _g2_3(gx+21, gz+12));
+        GOUT(19, _g3_3(gx+18, gy+3, gz+12));
+        GOUT(20, _g2_3(gx+18, gz+15));
+        GOUT(21, _g3_3(gx+15, gy+6, gz+12));
+        GOUT(22, _g3_3(gx+12, gy+9, gz+12));
+        GOUT(23, _g3_3(gx+12, gy+6, gz+15));
+        GOUT(24, _g2_3(gx+15, gz+18));
+        GOUT(25, _g3_3(gx+12, gy+3, gz+18));
+        GOUT(26, _g2_3(gx+12, gz+21));
+        GOUT(27, _g3_3(gx+9, gy+24, gz+0));
+        GOUT(28, _g3_3(gx+6, gy+27, gz+0));
+        GOUT(29, _g3_3(gx+6, gy+24, gz+3));
+        GOUT(30, _g3_3(gx+3, gy+30, gz+0));
+        GOUT(31, _g2_3(gy+33, gz+0));
+        GOUT(32, _g2_3(gy+30, gz+3));
+        GOUT(33, _g3_3(gx+3, gy+24, gz+6));
+        GOUT(34, _g2_3(gy+27, gz+6));
+        GOUT(35, _g2_3(gy+24, gz+9));
+        GOUT(36, _g3_3(gx+9, gy+12, gz+12));
+        GOUT(37, _g3_3(gx+6, gy+15, gz+12));
+        GOUT(38, _g3_3(gx+6, gy+12, gz+15));
+        GOUT(39, _g3_3(gx+3, gy+18, gz+12));
+        GOUT(40, _g2_3(gy+21, gz+12));
+        GOUT(41, _g2_3(gy+18, gz+15));
+        GOUT(42, _g3_3(gx+3, gy+12, gz+18));
+        GOUT(43, _g2_3(gy+15, gz+18));
+        GOUT(44, _g2_3(gy+12, gz+21));
+        GOUT(45, _g2_3(gx+9, gz+24));
+        GOUT(46, _g3_3(gx+6, gy+3, gz+24));
+        GOUT(47, _g2_3(gx+6, gz+27));
+        GOUT(48, _g3_3(gx+3, gy+6, gz+24));
+        GOUT(49, _g2_3(gy+9, gz+24));
+        GOUT(50, _g2_3(gy+6, gz+27));
+        GOUT(51, _g2_3(gx+3, gz+30));
+        GOUT(52, _g2_3(gy+3, gz+30));
+        GOUT(53, _g1_3(gz+33));
+}
+
+static void _gout_1020(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 12;
+        double *gz = g + 24;
+        GOUT(0, _g2_2(gx+10, gz+0));
+        GOUT(1, _g3_2(gx+8, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+8, gz+2));
+        GOUT(3, _g3_2(gx+6, gy+4, gz+0));
+        GOUT(4, _g3_2(gx+4, gy+6, gz+0));
+        GOUT(5, _g3_2(gx+4, gy+4, gz+2));
+        GOUT(6, _g2_2(gx+6, gz+4));
+        GOUT(7, _g3_2(gx+4, gy+2, gz+4));
+        GOUT(8, _g2_2(gx+4, gz+6));
+        GOUT(9, _g3_2(gx+2, gy+8, gz+0));
+        GOUT(10, _g2_2(gy+10, gz+0));
+        GOUT(11, _g2_2(gy+8, gz+2));
+        GOUT(12, _g3_2(gx+2, gy+4, gz+4));
+        GOUT(13, _g2_2(gy+6, gz+4));
+        GOUT(14, _g2_2(gy+4, gz+6));
+        GOUT(15, _g2_2(gx+2, gz+8));
+        GOUT(16, _g2_2(gy+2, gz+8));
+        GOUT(17, _g1_2(gz+10));
+}
+
+static void _g0_2d4d_1021(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 48;
+        double *gz = g + 96;
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+3] = c00x;
+                gx[n+6] = c0px;
+                gx[n+9] = c00x * gx[n+6] + b00;
+                gx[n+12] = c0px * gx[n+6] + b01;
+                gx[n+15] = c00x * gx[n+12] + 2 * b00 * gx[n+6];
+                gx[n+24] = sx + gx[n+6];
+                gx[n+27] = sx * gx[n+3] + gx[n+9];
+                gx[n+30] = sx * gx[n+6] + gx[n+12];
+                gx[n+33] = sx * gx[n+9] + gx[n+15];
+                gx[n+18] = c0px * gx[n+12] + 2 * b01 * gx[n+6];
+                gx[n+36] = sx * gx[n+12] + gx[n+18];
+                gx[n+21] = c00x * gx[n+18] + 3 * b00 * gx[n+12];
+                gx[n+39] = sx * gx[n+15] + gx[n+21];
+                gy[n+3] = c00y;
+                gy[n+6] = c0py;
+                gy[n+9] = c00y * gy[n+6] + b00;
+                gy[n+12] = c0py * gy[n+6] + b01;
+                gy[n+15] = c00y * gy[n+12] + 2 * b00 * gy[n+6];
+                gy[n+24] = sy + gy[n+6];
+                gy[n+27] = sy * gy[n+3] + gy[n+9];
+                gy[n+30] = sy * gy[n+6] + gy[n+12];
+                gy[n+33] = sy * gy[n+9] + gy[n+15];
+                gy[n+18] = c0py * gy[n+12] + 2 * b01 * gy[n+6];
+                gy[n+36] = sy * gy[n+12] + gy[n+18];
+                gy[n+21] = c00y * gy[n+18] + 3 * b00 * gy[n+12];
+                gy[n+39] = sy * gy[n+15] + gy[n+21];
+                gz[n+3] = c00z * gz[n+0];
+                gz[n+6] = c0pz * gz[n+0];
+                gz[n+9] = c00z * gz[n+6] + b00 * gz[n+0];
+                gz[n+12] = c0pz * gz[n+6] + b01 * gz[n+0];
+                gz[n+15] = c00z * gz[n+12] + 2 * b00 * gz[n+6];
+                gz[n+24] = sz * gz[n+0] + gz[n+6];
+                gz[n+27] = sz * gz[n+3] + gz[n+9];
+                gz[n+30] = sz * gz[n+6] + gz[n+12];
+                gz[n+33] = sz * gz[n+9] + gz[n+15];
+                gz[n+18] = c0pz * gz[n+12] + 2 * b01 * gz[n+6];
+                gz[n+36] = sz * gz[n+12] + gz[n+18];
+                gz[n+21] = c00z * gz[n+18] + 3 * b00 * gz[n+12];
+                gz[n+39] = sz * gz[n+15] + gz[n+21];
+        }
+}
+static void _gout_1021(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 48;
+        double *gz = g + 96;
+        GOUT(0, _g2_3(gx+39, gz+0));
+        GOUT(1, _g3_3(gx+36, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+36, gz+3));
+        GOUT(3, _g3_3(gx+33, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+30, gy+9, gz+0));
+        GOUT(5, _g3_3(gx+30, gy+6, gz+3));
+        GOUT(6, _g2_3(gx+33, gz+6));
+        GOUT(7, _g3_3(gx+30, gy+3, gz+6));
+        GOUT(8, _g2_3(gx+30, gz+9));
+        GOUT(9, _g3_3(gx+27, gy+12, gz+0));
+        GOUT(10, _g3_3(gx+24, gy+15, gz+0));
+        GOUT(11, _g3_3(gx+24, gy+12, gz+3));
+        GOUT(12, _g3_3(gx+27, gy+6, gz+6));
+        GOUT(13, _g3_3(gx+24, gy+9, gz+6));
+        GOUT(14, _g3_3(gx+24, gy+6, gz+9));
+        GOUT(15, _g2_3(gx+27, gz+12));
+        GOUT(16, _g3_3(gx+24, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+24, gz+15));
+        GOUT(18, _g3_3(gx+15, gy+24, gz+0));
+        GOUT(19, _g3_3(gx+12, gy+27, gz+0));
+        GOUT(20, _g3_3(gx+12, gy+24, gz+3));
+        GOUT(21, _g3_3(gx+9, gy+30, gz+0));
+        GOUT(22, _g3_3(gx+6, gy+33, gz+0));
+        GOUT(23, _g3_3(gx+6, gy+30, gz+3));
+        GOUT(24, _g3_3(gx+9, gy+24, gz+6));
+        GOUT(25, _g3_3(gx+6, gy+27, gz+6));
+        GOUT(26, _g3_3(gx+6, gy+24, gz+9));
+        GOUT(27, _g3_3(gx+3, gy+36, gz+0));
+        GOUT(28, _g2_3(gy+39, gz+0));
+        GOUT(29, _g2_3(gy+36, gz+3));
+        GOUT(30, _g3_3(gx+3, gy+30, gz+6));
+        GOUT(31, _g2_3(gy+33, gz+6));
+        GOUT(32, _g2_3(gy+30, gz+9));
+        GOUT(33, _g3_3(gx+3, gy+24, gz+12));
+        GOUT(34, _g2_3(gy+27, gz+12));
+        GOUT(35, _g2_3(gy+24, gz+15));
+        GOUT(36, _g2_3(gx+15, gz+24));
+        GOUT(37, _g3_3(gx+12, gy+3, gz+24));
+        GOUT(38, _g2_3(gx+12, gz+27));
+        GOUT(39, _g3_3(gx+9, gy+6, gz+24));
+        GOUT(40, _g3_3(gx+6, gy+9, gz+24));
+        GOUT(41, _g3_3(gx+6, gy+6, gz+27));
+        GOUT(42, _g2_3(gx+9, gz+30));
+        GOUT(43, _g3_3(gx+6, gy+3, gz+30));
+        GOUT(44, _g2_3(gx+6, gz+33));
+        GOUT(45, _g3_3(gx+3, gy+12, gz+24));
+        GOUT(46, _g2_3(gy+15, gz+24));
+        GOUT(47, _g2_3(gy+12, gz+27));
+        GOUT(48, _g3_3(gx+3, gy+6, gz+30));
+        GOUT(49, _g2_3(gy+9, gz+30));
+        GOUT(50, _g2_3(gy+6, gz+33));
+        GOUT(51, _g2_3(gx+3, gz+36));
+        GOUT(52, _g2_3(gy+3, gz+36));
+        GOUT(53, _g1_3(gz+39));
+}
+
+static void _g0_2d4d_1022(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 90;
+        double *gz = g + 180;
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+3] = c00x;
+                gx[n+18] = c0px;
+                gx[n+6] = sx + gx[n+18];
+                gx[n+21] = c00x * gx[n+18] + b00;
+                gx[n+9] = sx * gx[n+3] + gx[n+21];
+                gx[n+36] = c0px * gx[n+18] + b01;
+                gx[n+24] = sx * gx[n+18] + gx[n+36];
+                gx[n+12] = sx * gx[n+6] + gx[n+24];
+                gx[n+39] = c00x * gx[n+36] + 2 * b00 * gx[n+18];
+                gx[n+27] = sx * gx[n+21] + gx[n+39];
+                gx[n+15] = sx * gx[n+9] + gx[n+27];
+                gx[n+54] = c0px * gx[n+36] + 2 * b01 * gx[n+18];
+                gx[n+42] = sx * gx[n+36] + gx[n+54];
+                gx[n+30] = sx * gx[n+24] + gx[n+42];
+                gx[n+57] = c00x * gx[n+54] + 3 * b00 * gx[n+36];
+                gx[n+45] = sx * gx[n+39] + gx[n+57];
+                gx[n+33] = sx * gx[n+27] + gx[n+45];
+                gx[n+72] = c0px * gx[n+54] + 3 * b01 * gx[n+36];
+                gx[n+60] = sx * gx[n+54] + gx[n+72];
+                gx[n+48] = sx * gx[n+42] + gx[n+60];
+                gx[n+75] = c00x * gx[n+72] + 4 * b00 * gx[n+54];
+                gx[n+63] = sx * gx[n+57] + gx[n+75];
+                gx[n+51] = sx * gx[n+45] + gx[n+63];
+                gy[n+3] = c00y;
+                gy[n+18] = c0py;
+                gy[n+6] = sy + gy[n+18];
+                gy[n+21] = c00y * gy[n+18] + b00;
+                gy[n+9] = sy * gy[n+3] + gy[n+21];
+                gy[n+36] = c0py * gy[n+18] + b01;
+                gy[n+24] = sy * gy[n+18] + gy[n+36];
+                gy[n+12] = sy * gy[n+6] + gy[n+24];
+                gy[n+39] = c00y * gy[n+36] + 2 * b00 * gy[n+18];
+                gy[n+27] = sy * gy[n+21] + gy[n+39];
+                gy[n+15] = sy * gy[n+9] + gy[n+27];
+                gy[n+54] = c0py * gy[n+36] + 2 * b01 * gy[n+18];
+                gy[n+42] = sy * gy[n+36] + gy[n+54];
+                gy[n+30] = sy * gy[n+24] + gy[n+42];
+                gy[n+57] = c00y * gy[n+54] + 3 * b00 * gy[n+36];
+                gy[n+45] = sy * gy[n+39] + gy[n+57];
+                gy[n+33] = sy * gy[n+27] + gy[n+45];
+                gy[n+72] = c0py * gy[n+54] + 3 * b01 * gy[n+36];
+                gy[n+60] = sy * gy[n+54] + gy[n+72];
+                gy[n+48] = sy * gy[n+42] + gy[n+60];
+                gy[n+75] = c00y * gy[n+72] + 4 * b00 * gy[n+54];
+                gy[n+63] = sy * gy[n+57] + gy[n+75];
+                gy[n+51] = sy * gy[n+45] + gy[n+63];
+                gz[n+3] = c00z * gz[n+0];
+                gz[n+18] = c0pz * gz[n+0];
+                gz[n+6] = sz * gz[n+0] + gz[n+18];
+                gz[n+21] = c00z * gz[n+18] + b00 * gz[n+0];
+                gz[n+9] = sz * gz[n+3] + gz[n+21];
+                gz[n+36] = c0pz * gz[n+18] + b01 * gz[n+0];
+                gz[n+24] = sz * gz[n+18] + gz[n+36];
+                gz[n+12] = sz * gz[n+6] + gz[n+24];
+                gz[n+39] = c00z * gz[n+36] + 2 * b00 * gz[n+18];
+                gz[n+27] = sz * gz[n+21] + gz[n+39];
+                gz[n+15] = sz * gz[n+9] + gz[n+27];
+                gz[n+54] = c0pz * gz[n+36] + 2 * b01 * gz[n+18];
+                gz[n+42] = sz * gz[n+36] + gz[n+54];
+                gz[n+30] = sz * gz[n+24] + gz[n+42];
+                gz[n+57] = c00z * gz[n+54] + 3 * b00 * gz[n+36];
+                gz[n+45] = sz * gz[n+39] + gz[n+57];
+                gz[n+33] = sz * gz[n+27] + gz[n+45];
+                gz[n+72] = c0pz * gz[n+54] + 3 * b01 * gz[n+36];
+                gz[n+60] = sz * gz[n+54] + gz[n+72];
+                gz[n+48] = sz * gz[n+42] + gz[n+60];
+                gz[n+75] = c00z * gz[n+72] + 4 * b00 * gz[n+54];
+                gz[n+63] = sz * gz[n+57] + gz[n+75];
+                gz[n+51] = sz * gz[n+45] + gz[n+63];
+        }
+}
+static void _gout_1022(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 90;
+        double *gz = g + 180;
+        GOUT(0, _g2_3(gx+51, gz+0));
+        GOUT(1, _g3_3(gx+48, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+48, gz+3));
+        GOUT(3, _g3_3(gx+45, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+42, gy+9, gz+0));
+        GOUT(5, _g3_3(gx+42, gy+6, gz+3));
+        GOUT(6, _g2_3(gx+45, gz+6));
+        GOUT(7, _g3_3(gx+42, gy+3, gz+6));
+        GOUT(8, _g2_3(gx+42, gz+9));
+        GOUT(9, _g3_3(gx+39, gy+12, gz+0));
+        GOUT(10, _g3_3(gx+36, gy+15, gz+0));
+        GOUT(11, _g3_3(gx+36, gy+12, gz+3));
+        GOUT(12, _g3_3(gx+39, gy+6, gz+6));
+        GOUT(13, _g3_3(gx+36, gy+9, gz+6));
+        GOUT(14, _g3_3(gx+36, gy+6, gz+9));
+        GOUT(15, _g2_3(gx+39, gz+12));
+        GOUT(16, _g3_3(gx+36, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+36, gz+15));
+        GOUT(18, _g3_3(gx+33, gy+18, gz+0));
+        GOUT(19, _g3_3(gx+30, gy+21, gz+0));
+        GOUT(20, _g3_3(gx+30, gy+18, gz+3));
+        GOUT(21, _g3_3(gx+27, gy+24, gz+0));
+        GOUT(22, _g3_3(gx+24, gy+27, gz+0));
+        GOUT(23, _g3_3(gx+24, gy+24, gz+3));
+        GOUT(24, _g3_3(gx+27, gy+18, gz+6));
+        GOUT(25, _g3_3(gx+24, gy+21, gz+6));
+        GOUT(26, _g3_3(gx+24, gy+18, gz+9));
+        GOUT(27, _g3_3(gx+21, gy+30, gz+0));
+        GOUT(28, _g3_3(gx+18, gy+33, gz+0));
+        GOUT(29, _g3_3(gx+18, gy+30, gz+3));
+        GOUT(30, _g3_3(gx+21, gy+24, gz+6));
+        GOUT(31, _g3_3(gx+18, gy+27, gz+6));
+        GOUT(32, _g3_3(gx+18, gy+24, gz+9));
+        GOUT(33, _g3_3(gx+21, gy+18, gz+12));
+        GOUT(34, _g3_3(gx+18, gy+21, gz+12));
+        GOUT(35, _g3_3(gx+18, gy+18, gz+15));
+        GOUT(36, _g2_3(gx+33, gz+18));
+        GOUT(37, _g3_3(gx+30, gy+3, gz+18));
+        GOUT(38, _g2_3(gx+30, gz+21));
+        GOUT(39, _g3_3(gx+27, gy+6, gz+18));
+        GOUT(40, _g3_3(gx+24, gy+9, gz+18));
+        GOUT(41, _g3_3(gx+24, gy+6, gz+21));
+        GOUT(42, _g2_3(gx+27, gz+24));
+        GOUT(43, _g3_3(gx+24, gy+3, gz+24));
+        GOUT(44, _g2_3(gx+24, gz+27));
+        GOUT(45, _g3_3(gx+21, gy+12, gz+18));
+        GOUT(46, _g3_3(gx+18, gy+15, gz+18));
+        GOUT(47, _g3_3(gx+18, gy+12, gz+21));
+        GOUT(48, _g3_3(gx+21, gy+6, gz+24));
+        GOUT(49, _g3_3(gx+18, gy+9, gz+24));
+        GOUT(50, _g3_3(gx+18, gy+6, gz+27));
+        GOUT(51, _g2_3(gx+21, gz+30));
+        GOUT(52, _g3_3(gx+18, gy+3, gz+30));
+        GOUT(53, _g2_3(gx+18, gz+33));
+        GOUT(54, _g3_3(gx+15, gy+36, gz+0));
+        GOUT(55, _g3_3(gx+12, gy+39, gz+0));
+        GOUT(56, _g3_3(gx+12, gy+36, gz+3));
+        GOUT(57, _g3_3(gx+9, gy+42, gz+0));
+        GOUT(58, _g3_3(gx+6, gy+45, gz+0));
+        GOUT(59, _g3_3(gx+6, gy+42, gz+3));
+        GOUT(60, _g3_3(gx+9, gy+36, gz+6));
+        GOUT(61, _g3_3(gx+6, gy+39, gz+6));
+        GOUT(62, _g3_3(gx+6, gy+36, gz+9));
+        GOUT(63, _g3_3(gx+3, gy+48, gz+0));
+        GOUT(64, _g2_3(gy+51, gz+0));
+        GOUT(65, _g2_3(gy+48, gz+3));
+        GOUT(66, _g3_3(gx+3, gy+42, gz+6));
+        GOUT(67, _g2_3(gy+45, gz+6));
+        GOUT(68, _g2_3(gy+42, gz+9));
+        GOUT(69, _g3_3(gx+3, gy+36, gz+12));
+        GOUT(70, _g2_3(gy+39, gz+12));
+        GOUT(71, _g2_3(gy+36, gz+15));
+        GOUT(72, _g3_3(gx+15, gy+18, gz+18));
+        GOUT(73, _g3_3(gx+12, gy+21, gz+18));
+        GOUT(74, _g3_3(gx+12, gy+18, gz+21));
+        GOUT(75, _g3_3(gx+9, gy+24, gz+18));
+        GOUT(76, _g3_3(gx+6, gy+27, gz+18));
+        GOUT(77, _g3_3(gx+6, gy+24, gz+21));
+        GOUT(78, _g3_3(gx+9, gy+18, gz+24));
+        GOUT(79, _g3_3(gx+6, gy+21, gz+24));
+        GOUT(80, _g3_3(gx+6, gy+18, gz+27));
+        GOUT(81, _g3_3(gx+3, gy+30, gz+18));
+        GOUT(82, _g2_3(gy+33, gz+18));
+        GOUT(83, _g2_3(gy+30, gz+21));
+        GOUT(84, _g3_3(gx+3, gy+24, gz+24));
+        GOUT(85, _g2_3(gy+27, gz+24));
+        GOUT(86, _g2_3(gy+24, gz+27));
+        GOUT(87, _g3_3(gx+3, gy+18, gz+30));
+        GOUT(88, _g2_3(gy+21, gz+30));
+        GOUT(89, _g2_3(gy+18, gz+33));
+        GOUT(90, _g2_3(gx+15, gz+36));
+        GOUT(91, _g3_3(gx+12, gy+3, gz+36));
+        GOUT(92, _g2_3(gx+12, gz+39));
+        GOUT(93, _g3_3(gx+9, gy+6, gz+36));
+        GOUT(94, _g3_3(gx+6, gy+9, gz+36));
+        GOUT(95, _g3_3(gx+6, gy+6, gz+39));
+        GOUT(96, _g2_3(gx+9, gz+42));
+        GOUT(97, _g3_3(gx+6, gy+3, gz+42));
+        GOUT(98, _g2_3(gx+6, gz+45));
+        GOUT(99, _g3_3(gx+3, gy+12, gz+36));
+        GOUT(100, _g2_3(gy+15, gz+36));
+        GOUT(101, _g2_3(gy+12, gz+39));
+        GOUT(102, _g3_3(gx+3, gy+6, gz+42));
+        GOUT(103, _g2_3(gy+9, gz+42));
+        GOUT(104, _g2_3(gy+6, gz+45));
+        GOUT(105, _g2_3(gx+3, gz+48));
+        GOUT(106, _g2_3(gy+3, gz+48));
+        GOUT(107, _g1_3(gz+51));
+}
+
+static void _gout_1100(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 12;
+        double *gz = g + 24;
+        GOUT(0, _g2_2(gx+6, gz+0));
+        GOUT(1, _g3_2(gx+4, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+4, gz+2));
+        GOUT(3, _g3_2(gx+2, gy+4, gz+0));
+        GOUT(4, _g2_2(gy+6, gz+0));
+        GOUT(5, _g2_2(gy+4, gz+2));
+        GOUT(6, _g2_2(gx+2, gz+4));
+        GOUT(7, _g2_2(gy+2, gz+4));
+        GOUT(8, _g1_2(gz+6));
+}
+
+static void _gout_1101(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 24;
+        double *gz = g + 48;
+        GOUT(0, _g2_2(gx+14, gz+0));
+        GOUT(1, _g3_2(gx+12, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+12, gz+2));
+        GOUT(3, _g3_2(gx+10, gy+4, gz+0));
+        GOUT(4, _g3_2(gx+8, gy+6, gz+0));
+        GOUT(5, _g3_2(gx+8, gy+4, gz+2));
+        GOUT(6, _g2_2(gx+10, gz+4));
+        GOUT(7, _g3_2(gx+8, gy+2, gz+4));
+        GOUT(8, _g2_2(gx+8, gz+6));
+        GOUT(9, _g3_2(gx+6, gy+8, gz+0));
+        GOUT(10, _g3_2(gx+4, gy+10, gz+0));
+        GOUT(11, _g3_2(gx+4, gy+8, gz+2));
+        GOUT(12, _g3_2(gx+2, gy+12, gz+0));
+        GOUT(13, _g2_2(gy+14, gz+0));
+        GOUT(14, _g2_2(gy+12, gz+2));
+        GOUT(15, _g3_2(gx+2, gy+8, gz+4));
+        GOUT(16, _g2_2(gy+10, gz+4));
+        GOUT(17, _g2_2(gy+8, gz+6));
+        GOUT(18, _g2_2(gx+6, gz+8));
+        GOUT(19, _g3_2(gx+4, gy+2, gz+8));
+        GOUT(20, _g2_2(gx+4, gz+10));
+        GOUT(21, _g3_2(gx+2, gy+4, gz+8));
+        GOUT(22, _g2_2(gy+6, gz+8));
+        GOUT(23, _g2_2(gy+4, gz+10));
+        GOUT(24, _g2_2(gx+2, gz+12));
+        GOUT(25, _g2_2(gy+2, gz+12));
+        GOUT(26, _g1_2(gz+14));
+}
+
+static void _g0_2d4d_1102(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 54;
+        double *gz = g + 108;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+18] = c00x;
+                gx[n+3] = rx + gx[n+18];
+                gx[n+6] = c0px;
+                gx[n+24] = c00x * gx[n+6] + b00;
+                gx[n+9] = rx * gx[n+6] + gx[n+24];
+                gx[n+12] = c0px * gx[n+6] + b01;
+                gx[n+30] = c00x * gx[n+12] + 2 * b00 * gx[n+6];
+                gx[n+15] = rx * gx[n+12] + gx[n+30];
+                gx[n+36] = c00x * gx[n+18] + b10;
+                gx[n+21] = rx * gx[n+18] + gx[n+36];
+                gx[n+42] = c00x * gx[n+24] + b10 * gx[n+6] + b00 * gx[n+18];
+                gx[n+27] = rx * gx[n+24] + gx[n+42];
+                gx[n+48] = c00x * gx[n+30] + b10 * gx[n+12] + 2 * b00 * gx[n+24];
+                gx[n+33] = rx * gx[n+30] + gx[n+48];
+                gy[n+18] = c00y;
+                gy[n+3] = ry + gy[n+18];
+                gy[n+6] = c0py;
+                gy[n+24] = c00y * gy[n+6] + b00;
+                gy[n+9] = ry * gy[n+6] + gy[n+24];
+                gy[n+12] = c0py * gy[n+6] + b01;
+                gy[n+30] = c00y * gy[n+12] + 2 * b00 * gy[n+6];
+                gy[n+15] = ry * gy[n+12] + gy[n+30];
+                gy[n+36] = c00y * gy[n+18] + b10;
+                gy[n+21] = ry * gy[n+18] + gy[n+36];
+                gy[n+42] = c00y * gy[n+24] + b10 * gy[n+6] + b00 * gy[n+18];
+                gy[n+27] = ry * gy[n+24] + gy[n+42];
+                gy[n+48] = c00y * gy[n+30] + b10 * gy[n+12] + 2 * b00 * gy[n+24];
+                gy[n+33] = ry * gy[n+30] + gy[n+48];
+                gz[n+18] = c00z * gz[n+0];
+                gz[n+3] = rz * gz[n+0] + gz[n+18];
+                gz[n+6] = c0pz * gz[n+0];
+                gz[n+24] = c00z * gz[n+6] + b00 * gz[n+0];
+                gz[n+9] = rz * gz[n+6] + gz[n+24];
+                gz[n+12] = c0pz * gz[n+6] + b01 * gz[n+0];
+                gz[n+30] = c00z * gz[n+12] + 2 * b00 * gz[n+6];
+                gz[n+15] = rz * gz[n+12] + gz[n+30];
+                gz[n+36] = c00z * gz[n+18] + b10 * gz[n+0];
+                gz[n+21] = rz * gz[n+18] + gz[n+36];
+                gz[n+42] = c00z * gz[n+24] + b10 * gz[n+6] + b00 * gz[n+18];
+                gz[n+27] = rz * gz[n+24] + gz[n+42];
+                gz[n+48] = c00z * gz[n+30] + b10 * gz[n+12] + 2 * b00 * gz[n+24];
+                gz[n+33] = rz * gz[n+30] + gz[n+48];
+        }
+}
+static void _gout_1102(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 54;
+        double *gz = g + 108;
+        GOUT(0, _g2_3(gx+33, gz+0));
+        GOUT(1, _g3_3(gx+30, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+30, gz+3));
+        GOUT(3, _g3_3(gx+27, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+24, gy+9, gz+0));
+        GOUT(5, _g3_3(gx+24, gy+6, gz+3));
+        GOUT(6, _g2_3(gx+27, gz+6));
+        GOUT(7, _g3_3(gx+24, gy+3, gz+6));
+        GOUT(8, _g2_3(gx+24, gz+9));
+        GOUT(9, _g3_3(gx+21, gy+12, gz+0));
+        GOUT(10, _g3_3(gx+18, gy+15, gz+0));
+        GOUT(11, _g3_3(gx+18, gy+12, gz+3));
+        GOUT(12, _g3_3(gx+21, gy+6, gz+6));
+        GOUT(13, _g3_3(gx+18, gy+9, gz+6));
+        GOUT(14, _g3_3(gx+18, gy+6, gz+9));
+        GOUT(15, _g2_3(gx+21, gz+12));
+        GOUT(16, _g3_3(gx+18, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+18, gz+15));
+        GOUT(18, _g3_3(gx+15, gy+18, gz+0));
+        GOUT(19, _g3_3(gx+12, gy+21, gz+0));
+        GOUT(20, _g3_3(gx+12, gy+18, gz+3));
+        GOUT(21, _g3_3(gx+9, gy+24, gz+0));
+        GOUT(22, _g3_3(gx+6, gy+27, gz+0));
+        GOUT(23, _g3_3(gx+6, gy+24, gz+3));
+        GOUT(24, _g3_3(gx+9, gy+18, gz+6));
+        GOUT(25, _g3_3(gx+6, gy+21, gz+6));
+        GOUT(26, _g3_3(gx+6, gy+18, gz+9));
+        GOUT(27, _g3_3(gx+3, gy+30, gz+0));
+        GOUT(28, _g2_3(gy+33, gz+0));
+        GOUT(29, _g2_3(gy+30, gz+3));
+        GOUT(30, _g3_3(gx+3, gy+24, gz+6));
+        GOUT(31, _g2_3(gy+27, gz+6));
+        GOUT(32, _g2_3(gy+24, gz+9));
+        GOUT(33, _g3_3(gx+3, gy+18, gz+12));
+        GOUT(34, _g2_3(gy+21, gz+12));
+        GOUT(35, _g2_3(gy+18, gz+15));
+        GOUT(36, _g2_3(gx+15, gz+18));
+        GOUT(37, _g3_3(gx+12, gy+3, gz+18));
+        GOUT(38, _g2_3(gx+12, gz+21));
+        GOUT(39, _g3_3(gx+9, gy+6, gz+18));
+        GOUT(40, _g3_3(gx+6, gy+9, gz+18));
+        GOUT(41, _g3_3(gx+6, gy+6, gz+21));
+        GOUT(42, _g2_3(gx+9, gz+24));
+        GOUT(43, _g3_3(gx+6, gy+3, gz+24));
+        GOUT(44, _g2_3(gx+6, gz+27));
+        GOUT(45, _g3_3(gx+3, gy+12, gz+18));
+        GOUT(46, _g2_3(gy+15, gz+18));
+        GOUT(47, _g2_3(gy+12, gz+21));
+        GOUT(48, _g3_3(gx+3, gy+6, gz+24));
+        GOUT(49, _g2_3(gy+9, gz+24));
+        GOUT(50, _g2_3(gy+6, gz+27));
+        GOUT(51, _g2_3(gx+3, gz+30));
+        GOUT(52, _g2_3(gy+3, gz+30));
+        GOUT(53, _g1_3(gz+33));
+}
+
+static void _gout_1110(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 24;
+        double *gz = g + 48;
+        GOUT(0, _g2_2(gx+14, gz+0));
+        GOUT(1, _g3_2(gx+12, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+12, gz+2));
+        GOUT(3, _g3_2(gx+10, gy+4, gz+0));
+        GOUT(4, _g3_2(gx+8, gy+6, gz+0));
+        GOUT(5, _g3_2(gx+8, gy+4, gz+2));
+        GOUT(6, _g2_2(gx+10, gz+4));
+        GOUT(7, _g3_2(gx+8, gy+2, gz+4));
+        GOUT(8, _g2_2(gx+8, gz+6));
+        GOUT(9, _g3_2(gx+6, gy+8, gz+0));
+        GOUT(10, _g3_2(gx+4, gy+10, gz+0));
+        GOUT(11, _g3_2(gx+4, gy+8, gz+2));
+        GOUT(12, _g3_2(gx+2, gy+12, gz+0));
+        GOUT(13, _g2_2(gy+14, gz+0));
+        GOUT(14, _g2_2(gy+12, gz+2));
+        GOUT(15, _g3_2(gx+2, gy+8, gz+4));
+        GOUT(16, _g2_2(gy+10, gz+4));
+        GOUT(17, _g2_2(gy+8, gz+6));
+        GOUT(18, _g2_2(gx+6, gz+8));
+        GOUT(19, _g3_2(gx+4, gy+2, gz+8));
+        GOUT(20, _g2_2(gx+4, gz+10));
+        GOUT(21, _g3_2(gx+2, gy+4, gz+8));
+        GOUT(22, _g2_2(gy+6, gz+8));
+        GOUT(23, _g2_2(gy+4, gz+10));
+        GOUT(24, _g2_2(gx+2, gz+12));
+        GOUT(25, _g2_2(gy+2, gz+12));
+        GOUT(26, _g1_2(gz+14));
+}
+
+static void _g0_2d4d_1111(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 108;
+        double *gz = g + 216;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+36] = c00x;
+                gx[n+3] = rx + gx[n+36];
+                gx[n+12] = c0px;
+                gx[n+6] = sx + gx[n+12];
+                gx[n+48] = c00x * gx[n+12] + b00;
+                gx[n+42] = sx * gx[n+36] + gx[n+48];
+                gx[n+9] = rx * gx[n+6] + gx[n+42];
+                gx[n+15] = rx * gx[n+12] + gx[n+48];
+                gx[n+24] = c0px * gx[n+12] + b01;
+                gx[n+18] = sx * gx[n+12] + gx[n+24];
+                gx[n+60] = c00x * gx[n+24] + 2 * b00 * gx[n+12];
+                gx[n+54] = sx * gx[n+48] + gx[n+60];
+                gx[n+21] = rx * gx[n+18] + gx[n+54];
+                gx[n+72] = c00x * gx[n+36] + b10;
+                gx[n+39] = rx * gx[n+36] + gx[n+72];
+                gx[n+84] = c00x * gx[n+48] + b10 * gx[n+12] + b00 * gx[n+36];
+                gx[n+78] = sx * gx[n+72] + gx[n+84];
+                gx[n+45] = rx * gx[n+42] + gx[n+78];
+                gx[n+51] = rx * gx[n+48] + gx[n+84];
+                gx[n+96] = c00x * gx[n+60] + b10 * gx[n+24] + 2 * b00 * gx[n+48];
+                gx[n+90] = sx * gx[n+84] + gx[n+96];
+                gx[n+57] = rx * gx[n+54] + gx[n+90];
+                gy[n+36] = c00y;
+                gy[n+3] = ry + gy[n+36];
+                gy[n+12] = c0py;
+                gy[n+6] = sy + gy[n+12];
+                gy[n+48] = c00y * gy[n+12] + b00;
+                gy[n+42] = sy * gy[n+36] + gy[n+48];
+                gy[n+9] = ry * gy[n+6] + gy[n+42];
+                gy[n+15] = ry * gy[n+12] + gy[n+48];
+                gy[n+24] = c0py * gy[n+12] + b01;
+                gy[n+18] = sy * gy[n+12] + gy[n+24];
+                gy[n+60] = c00y * gy[n+24] + 2 * b00 * gy[n+12];
+                gy[n+54] = sy * gy[n+48] + gy[n+60];
+                gy[n+21] = ry * gy[n+18] + gy[n+54];
+                gy[n+72] = c00y * gy[n+36] + b10;
+                gy[n+39] = ry * gy[n+36] + gy[n+72];
+                gy[n+84] = c00y * gy[n+48] + b10 * gy[n+12] + b00 * gy[n+36];
+                gy[n+78] = sy * gy[n+72] + gy[n+84];
+                gy[n+45] = ry * gy[n+42] + gy[n+78];
+                gy[n+51] = ry * gy[n+48] + gy[n+84];
+                gy[n+96] = c00y * gy[n+60] + b10 * gy[n+24] + 2 * b00 * gy[n+48];
+                gy[n+90] = sy * gy[n+84] + gy[n+96];
+                gy[n+57] = ry * gy[n+54] + gy[n+90];
+                gz[n+36] = c00z * gz[n+0];
+                gz[n+3] = rz * gz[n+0] + gz[n+36];
+                gz[n+12] = c0pz * gz[n+0];
+                gz[n+6] = sz * gz[n+0] + gz[n+12];
+                gz[n+48] = c00z * gz[n+12] + b00 * gz[n+0];
+                gz[n+42] = sz * gz[n+36] + gz[n+48];
+                gz[n+9] = rz * gz[n+6] + gz[n+42];
+                gz[n+15] = rz * gz[n+12] + gz[n+48];
+                gz[n+24] = c0pz * gz[n+12] + b01 * gz[n+0];
+                gz[n+18] = sz * gz[n+12] + gz[n+24];
+                gz[n+60] = c00z * gz[n+24] + 2 * b00 * gz[n+12];
+                gz[n+54] = sz * gz[n+48] + gz[n+60];
+                gz[n+21] = rz * gz[n+18] + gz[n+54];
+                gz[n+72] = c00z * gz[n+36] + b10 * gz[n+0];
+                gz[n+39] = rz * gz[n+36] + gz[n+72];
+                gz[n+84] = c00z * gz[n+48] + b10 * gz[n+12] + b00 * gz[n+36];
+                gz[n+78] = sz * gz[n+72] + gz[n+84];
+                gz[n+45] = rz * gz[n+42] + gz[n+78];
+                gz[n+51] = rz * gz[n+48] + gz[n+84];
+                gz[n+96] = c00z * gz[n+60] + b10 * gz[n+24] + 2 * b00 * gz[n+48];
+                gz[n+90] = sz * gz[n+84] + gz[n+96];
+                gz[n+57] = rz * gz[n+54] + gz[n+90];
+        }
+}
+static void _gout_1111(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 108;
+        double *gz = g + 216;
+        GOUT(0, _g2_3(gx+57, gz+0));
+        GOUT(1, _g3_3(gx+54, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+54, gz+3));
+        GOUT(3, _g3_3(gx+51, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+48, gy+9, gz+0));
+        GOUT(5, _g3_3(gx+48, gy+6, gz+3));
+        GOUT(6, _g2_3(gx+51, gz+6));
+        GOUT(7, _g3_3(gx+48, gy+3, gz+6));
+        GOUT(8, _g2_3(gx+48, gz+9));
+        GOUT(9, _g3_3(gx+45, gy+12, gz+0));
+        GOUT(10, _g3_3(gx+42, gy+15, gz+0));
+        GOUT(11, _g3_3(gx+42, gy+12, gz+3));
+        GOUT(12, _g3_3(gx+39, gy+18, gz+0));
+        GOUT(13, _g3_3(gx+36, gy+21, gz+0));
+        GOUT(14, _g3_3(gx+36, gy+18, gz+3));
+        GOUT(15, _g3_3(gx+39, gy+12, gz+6));
+        GOUT(16, _g3_3(gx+36, gy+15, gz+6));
+        GOUT(17, _g3_3(gx+36, gy+12, gz+9));
+        GOUT(18, _g2_3(gx+45, gz+12));
+        GOUT(19, _g3_3(gx+42, gy+3, gz+12));
+        GOUT(20, _g2_3(gx+42, gz+15));
+        GOUT(21, _g3_3(gx+39, gy+6, gz+12));
+        GOUT(22, _g3_3(gx+36, gy+9, gz+12));
+        GOUT(23, _g3_3(gx+36, gy+6, gz+15));
+        GOUT(24, _g2_3(gx+39, gz+18));
+        GOUT(25, _g3_3(gx+36, gy+3, gz+18));
+        GOUT(26, _g2_3(gx+36, gz+21));
+        GOUT(27, _g3_3(gx+21, gy+36, gz+0));
+        GOUT(28, _g3_3(gx+18, gy+39, gz+0));
+        GOUT(29, _g3_3(gx+18, gy+36, gz+3));
+        GOUT(30, _g3_3(gx+15, gy+42, gz+0));
+        GOUT(31, _g3_3(gx+12, gy+45, gz+0));
+        GOUT(32, _g3_3(gx+12, gy+42, gz+3));
+        GOUT(33, _g3_3(gx+15, gy+36, gz+6));
+        GOUT(34, _g3_3(gx+12, gy+39, gz+6));
+        GOUT(35, _g3_3(gx+12, gy+36, gz+9));
+        GOUT(36, _g3_3(gx+9, gy+48, gz+0));
+        GOUT(37, _g3_3(gx+6, gy+51, gz+0));
+        GOUT(38, _g3_3(gx+6, gy+48, gz+3));
+        GOUT(39, _g3_3(gx+3, gy+54, gz+0));
+        GOUT(40, _g2_3(gy+57, gz+0));
+        GOUT(41, _g2_3(gy+54, gz+3));
+        GOUT(42, _g3_3(gx+3, gy+48, gz+6));
+        GOUT(43, _g2_3(gy+51, gz+6));
+        GOUT(44, _g2_3(gy+48, gz+9));
+        GOUT(45, _g3_3(gx+9, gy+36, gz+12));
+        GOUT(46, _g3_3(gx+6, gy+39, gz+12));
+        GOUT(47, _g3_3(gx+6, gy+36, gz+15));
+        GOUT(48, _g3_3(gx+3, gy+42, gz+12));
+        GOUT(49, _g2_3(gy+45, gz+12));
+        GOUT(50, _g2_3(gy+42, gz+15));
+        GOUT(51, _g3_3(gx+3, gy+36, gz+18));
+        GOUT(52, _g2_3(gy+39, gz+18));
+        GOUT(53, _g2_3(gy+36, gz+21));
+        GOUT(54, _g2_3(gx+21, gz+36));
+        GOUT(55, _g3_3(gx+18, gy+3, gz+36));
+        GOUT(56, _g2_3(gx+18, gz+39));
+        GOUT(57, _g3_3(gx+15, gy+6, gz+36));
+        GOUT(58, _g3_3(gx+12, gy+9, gz+36));
+        GOUT(59, _g3_3(gx+12, gy+6, gz+39));
+        GOUT(60, _g2_3(gx+15, gz+42));
+        GOUT(61, _g3_3(gx+12, gy+3, gz+42));
+        GOUT(62, _g2_3(gx+12, gz+45));
+        GOUT(63, _g3_3(gx+9, gy+12, gz+36));
+        GOUT(64, _g3_3(gx+6, gy+15, gz+36));
+        GOUT(65, _g3_3(gx+6, gy+12, gz+39));
+        GOUT(66, _g3_3(gx+3, gy+18, gz+36));
+        GOUT(67, _g2_3(gy+21, gz+36));
+        GOUT(68, _g2_3(gy+18, gz+39));
+        GOUT(69, _g3_3(gx+3, gy+12, gz+42));
+        GOUT(70, _g2_3(gy+15, gz+42));
+        GOUT(71, _g2_3(gy+12, gz+45));
+        GOUT(72, _g2_3(gx+9, gz+48));
+        GOUT(73, _g3_3(gx+6, gy+3, gz+48));
+        GOUT(74, _g2_3(gx+6, gz+51));
+        GOUT(75, _g3_3(gx+3, gy+6, gz+48));
+        GOUT(76, _g2_3(gy+9, gz+48));
+        GOUT(77, _g2_3(gy+6, gz+51));
+        GOUT(78, _g2_3(gx+3, gz+54));
+        GOUT(79, _g2_3(gy+3, gz+54));
+        GOUT(80, _g1_3(gz+57));
+}
+
+static void _g0_2d4d_1112(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 144;
+        double *gz = g + 288;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+48] = c00x;
+                gx[n+3] = rx + gx[n+48];
+                gx[n+12] = c0px;
+                gx[n+6] = sx + gx[n+12];
+                gx[n+60] = c00x * gx[n+12] + b00;
+                gx[n+54] = sx * gx[n+48] + gx[n+60];
+                gx[n+9] = rx * gx[n+6] + gx[n+54];
+                gx[n+15] = rx * gx[n+12] + gx[n+60];
+                gx[n+24] = c0px * gx[n+12] + b01;
+                gx[n+18] = sx * gx[n+12] + gx[n+24];
+                gx[n+72] = c00x * gx[n+24] + 2 * b00 * gx[n+12];
+                gx[n+66] = sx * gx[n+60] + gx[n+72];
+                gx[n+21] = rx * gx[n+18] + gx[n+66];
+                gx[n+27] = rx * gx[n+24] + gx[n+72];
+                gx[n+36] = c0px * gx[n+24] + 2 * b01 * gx[n+12];
+                gx[n+30] = sx * gx[n+24] + gx[n+36];
+                gx[n+84] = c00x * gx[n+36] + 3 * b00 * gx[n+24];
+                gx[n+78] = sx * gx[n+72] + gx[n+84];
+                gx[n+33] = rx * gx[n+30] + gx[n+78];
+                gx[n+96] = c00x * gx[n+48] + b10;
+                gx[n+51] = rx * gx[n+48] + gx[n+96];
+                gx[n+108] = c00x * gx[n+60] + b10 * gx[n+12] + b00 * gx[n+48];
+                gx[n+102] = sx * gx[n+96] + gx[n+108];
+                gx[n+57] = rx * gx[n+54] + gx[n+102];
+                gx[n+63] = rx * gx[n+60] + gx[n+108];
+                gx[n+120] = c00x * gx[n+72] + b10 * gx[n+24] + 2 * b00 * gx[n+60];
+                gx[n+114] = sx * gx[n+108] + gx[n+120];
+                gx[n+69] = rx * gx[n+66] + gx[n+114];
+                gx[n+75] = rx * gx[n+72] + gx[n+120];
+                gx[n+132] = c00x * gx[n+84] + b10 * gx[n+36] + 3 * b00 * gx[n+72];
+                gx[n+126] = sx * gx[n+120] + gx[n+132];
+                gx[n+81] = rx * gx[n+78] + gx[n+126];
+                gy[n+48] = c00y;
+                gy[n+3] = ry + gy[n+48];
+                gy[n+12] = c0py;
+                gy[n+6] = sy + gy[n+12];
+                gy[n+60] = c00y * gy[n+12] + b00;
+                gy[n+54] = sy * gy[n+48] + gy[n+60];
+                gy[n+9] = ry * gy[n+6] + gy[n+54];
+                gy[n+15] = ry * gy[n+12] + gy[n+60];
+                gy[n+24] = c0py * gy[n+12] + b01;
+                gy[n+18] = sy * gy[n+12] + gy[n+24];
+                gy[n+72] = c00y * gy[n+24] + 2 * b00 * gy[n+12];
+                gy[n+66] = sy * gy[n+60] + gy[n+72];
+                gy[n+21] = ry * gy[n+18] + gy[n+66];
+                gy[n+27] = ry * gy[n+24] + gy[n+72];
+                gy[n+36] = c0py * gy[n+24] + 2 * b01 * gy[n+12];
+                gy[n+30] = sy * gy[n+24] + gy[n+36];
+                gy[n+84] = c00y * gy[n+36] + 3 * b00 * gy[n+24];
+                gy[n+78] = sy * gy[n+72] + gy[n+84];
+                gy[n+33] = ry * gy[n+30] + gy[n+78];
+                gy[n+96] = c00y * gy[n+48] + b10;
+                gy[n+51] = ry * gy[n+48] + gy[n+96];
+                gy[n+108] = c00y * gy[n+60] + b10 * gy[n+12] + b00 * gy[n+48];
+                gy[n+102] = sy * gy[n+96] + gy[n+108];
+                gy[n+57] = ry * gy[n+54] + gy[n+102];
+                gy[n+63] = ry * gy[n+60] + gy[n+108];
+                gy[n+120] = c00y * gy[n+72] + b10 * gy[n+24] + 2 * b00 * gy[n+60];
+                gy[n+114] = sy * gy[n+108] + gy[n+120];
+                gy[n+69] = ry * gy[n+66] + gy[n+114];
+                gy[n+75] = ry * gy[n+72] + gy[n+120];
+                gy[n+132] = c00y * gy[n+84] + b10 * gy[n+36] + 3 * b00 * gy[n+72];
+                gy[n+126] = sy * gy[n+120] + gy[n+132];
+                gy[n+81] = ry * gy[n+78] + gy[n+126];
+                gz[n+48] = c00z * gz[n+0];
+                gz[n+3] = rz * gz[n+0] + gz[n+48];
+                gz[n+12] = c0pz * gz[n+0];
+                gz[n+6] = sz * gz[n+0] + gz[n+12];
+                gz[n+60] = c00z * gz[n+12] + b00 * gz[n+0];
+                gz[n+54] = sz * gz[n+48] + gz[n+60];
+                gz[n+9] = rz * gz[n+6] + gz[n+54];
+                gz[n+15] = rz * gz[n+12] + gz[n+60];
+                gz[n+24] = c0pz * gz[n+12] + b01 * gz[n+0];
+                gz[n+18] = sz * gz[n+12] + gz[n+24];
+                gz[n+72] = c00z * gz[n+24] + 2 * b00 * gz[n+12];
+                gz[n+66] = sz * gz[n+60] + gz[n+72];
+                gz[n+21] = rz * gz[n+18] + gz[n+66];
+                gz[n+27] = rz * gz[n+24] + gz[n+72];
+                gz[n+36] = c0pz * gz[n+24] + 2 * b01 * gz[n+12];
+                gz[n+30] = sz * gz[n+24] + gz[n+36];
+                gz[n+84] = c00z * gz[n+36] + 3 * b00 * gz[n+24];
+                gz[n+78] = sz * gz[n+72] + gz[n+84];
+                gz[n+33] = rz * gz[n+30] + gz[n+78];
+                gz[n+96] = c00z * gz[n+48] + b10 * gz[n+0];
+                gz[n+51] = rz * gz[n+48] + gz[n+96];
+                gz[n+108] = c00z * gz[n+60] + b10 * gz[n+12] + b00 * gz[n+48];
+                gz[n+102] = sz * gz[n+96] + gz[n+108];
+                gz[n+57] = rz * gz[n+54] + gz[n+102];
+                gz[n+63] = rz * gz[n+60] + gz[n+108];
+                gz[n+120] = c00z * gz[n+72] + b10 * gz[n+24] + 2 * b00 * gz[n+60];
+                gz[n+114] = sz * gz[n+108] + gz[n+120];
+                gz[n+69] = rz * gz[n+66] + gz[n+114];
+                gz[n+75] = rz * gz[n+72] + gz[n+120];
+                gz[n+132] = c00z * gz[n+84] + b10 * gz[n+36] + 3 * b00 * gz[n+72];
+                gz[n+126] = sz * gz[n+120] + gz[n+132];
+                gz[n+81] = rz * gz[n+78] + gz[n+126];
+        }
+}
+static void _gout_1112(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 144;
+        double *gz = g + 288;
+        GOUT(0, _g2_3(gx+81, gz+0));
+        GOUT(1, _g3_3(gx+78, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+78, gz+3));
+        GOUT(3, _g3_3(gx+75, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+72, gy+9, gz+0));
+        GOUT(5, _g3_3(gx+72, gy+6, gz+3));
+        GOUT(6, _g2_3(gx+75, gz+6));
+        GOUT(7, _g3_3(gx+72, gy+3, gz+6));
+        GOUT(8, _g2_3(gx+72, gz+9));
+        GOUT(9, _g3_3(gx+69, gy+12, gz+0));
+        GOUT(10, _g3_3(gx+66, gy+15, gz+0));
+        GOUT(11, _g3_3(gx+66, gy+12, gz+3));
+        GOUT(12, _g3_3(gx+63, gy+18, gz+0));
+        GOUT(13, _g3_3(gx+60, gy+21, gz+0));
+        GOUT(14, _g3_3(gx+60, gy+18, gz+3));
+        GOUT(15, _g3_3(gx+63, gy+12, gz+6));
+        GOUT(16, _g3_3(gx+60, gy+15, gz+6));
+        GOUT(17, _g3_3(gx+60, gy+12, gz+9));
+        GOUT(18, _g2_3(gx+69, gz+12));
+        GOUT(19, _g3_3(gx+66, gy+3, gz+12));
+        GOUT(20, _g2_3(gx+66, gz+15));
+        GOUT(21, _g3_3(gx+63, gy+6, gz+12));
+        GOUT(22, _g3_3(gx+60, gy+9, gz+12));
+        GOUT(23, _g3_3(gx+60, gy+6, gz+15));
+        GOUT(24, _g2_3(gx+63, gz+18));
+        GOUT(25, _g3_3(gx+60, gy+3, gz+18));
+        GOUT(26, _g2_3(gx+60, gz+21));
+        GOUT(27, _g3_3(gx+57, gy+24, gz+0));
+        GOUT(28, _g3_3(gx+54, gy+27, gz+0));
+        GOUT(29, _g3_3(gx+54, gy+24, gz+3));
+        GOUT(30, _g3_3(gx+51, gy+30, gz+0));
+        GOUT(31, _g3_3(gx+48, gy+33, gz+0));
+        GOUT(32, _g3_3(gx+48, gy+30, gz+3));
+        GOUT(33, _g3_3(gx+51, gy+24, gz+6));
+        GOUT(34, _g3_3(gx+48, gy+27, gz+6));
+        GOUT(35, _g3_3(gx+48, gy+24, gz+9));
+        GOUT(36, _g3_3(gx+57, gy+12, gz+12));
+        GOUT(37, _g3_3(gx+54, gy+15, gz+12));
+        GOUT(38, _g3_3(gx+54, gy+12, gz+15));
+        GOUT(39, _g3_3(gx+51, gy+18, gz+12));
+        GOUT(40, _g3_3(gx+48, gy+21, gz+12));
+        GOUT(41, _g3_3(gx+48, gy+18, gz+15));
+        GOUT(42, _g3_3(gx+51, gy+12, gz+18));
+        GOUT(43, _g3_3(gx+48, gy+15, gz+18));
+        GOUT(44, _g3_3(gx+48, gy+12, gz+21));
+        GOUT(45, _g2_3(gx+57, gz+24));
+        GOUT(46, _g3_3(gx+54, gy+3, gz+24));
+        GOUT(47, _g2_3(gx+54, gz+27));
+        GOUT(48, _g3_3(gx+51, gy+6, gz+24));
+        GOUT(49, _g3_3(gx+48, gy+9, gz+24));
+        GOUT(50, _g3_3(gx+48, gy+6, gz+27));
+        GOUT(51, _g2_3(gx+51, gz+30));
+        GOUT(52, _g3_3(gx+48, gy+3, gz+30));
+        GOUT(53, _g2_3(gx+48, gz+33));
+        GOUT(54, _g3_3(gx+33, gy+48, gz+0));
+        GOUT(55, _g3_3(gx+30, gy+51, gz+0));
+        GOUT(56, _g3_3(gx+30, gy+48, gz+3));
+        GOUT(57, _g3_3(gx+27, gy+54, gz+0));
+        GOUT(58, _g3_3(gx+24, gy+57, gz+0));
+        GOUT(59, _g3_3(gx+24, gy+54, gz+3));
+        GOUT(60, _g3_3(gx+27, gy+48, gz+6));
+        GOUT(61, _g3_3(gx+24, gy+51, gz+6));
+        GOUT(62, _g3_3(gx+24, gy+48, gz+9));
+        GOUT(63, _g3_3(gx+21, gy+60, gz+0));
+        GOUT(64, _g3_3(gx+18, gy+63, gz+0));
+        GOUT(65, _g3_3(gx+18, gy+60, gz+3));
+        GOUT(66, _g3_3(gx+15, gy+66, gz+0));
+        GOUT(67, _g3_3(gx+12, gy+69, gz+0));
+        GOUT(68, _g3_3(gx+12, gy+66, gz+3));
+        GOUT(69, _g3_3(gx+15, gy+60, gz+6));
+        GOUT(70, _g3_3(gx+12, gy+63, gz+6));
+        GOUT(71, _g3_3(gx+12, gy+60, gz+9));
+        GOUT(72, _g3_3(gx+21, gy+48, gz+12));
+        GOUT(73, _g3_3(gx+18, gy+51, gz+12));
+        GOUT(74, _g3_3(gx+18, gy+48, gz+15));
+        GOUT(75, _g3_3(gx+15, gy+54, gz+12));
+        GOUT(76, _g3_3(gx+12, gy+57, gz+12));
+        GOUT(77, _g3_3(gx+12, gy+54, gz+15));
+        GOUT(78, _g3_3(gx+15, gy+48, gz+18));
+        GOUT(79, _g3_3(gx+12, gy+51, gz+18));
+        GOUT(80, _g3_3(gx+12, gy+48, gz+21));
+        GOUT(81, _g3_3(gx+9, gy+72, gz+0));
+        GOUT(82, _g3_3(gx+6, gy+75, gz+0));
+        GOUT(83, _g3_3(gx+6, gy+72, gz+3));
+        GOUT(84, _g3_3(gx+3, gy+78, gz+0));
+        GOUT(85, _g2_3(gy+81, gz+0));
+        GOUT(86, _g2_3(gy+78, gz+3));
+        GOUT(87, _g3_3(gx+3, gy+72, gz+6));
+        GOUT(88, _g2_3(gy+75, gz+6));
+        GOUT(89, _g2_3(gy+72, gz+9));
+        GOUT(90, _g3_3(gx+9, gy+60, gz+12));
+        GOUT(91, _g3_3(gx+6, gy+63, gz+12));
+        GOUT(92, _g3_3(gx+6, gy+60, gz+15));
+        GOUT(93, _g3_3(gx+3, gy+66, gz+12));
+        GOUT(94, _g2_3(gy+69, gz+12));
+        GOUT(95, _g2_3(gy+66, gz+15));
+        GOUT(96, _g3_3(gx+3, gy+60, gz+18));
+        GOUT(97, _g2_3(gy+63, gz+18));
+        GOUT(98, _g2_3(gy+60, gz+21));
+        GOUT(99, _g3_3(gx+9, gy+48, gz+24));
+        GOUT(100, _g3_3(gx+6, gy+51, gz+24));
+        GOUT(101, _g3_3(gx+6, gy+48, gz+27));
+        GOUT(102, _g3_3(gx+3, gy+54, gz+24));
+        GOUT(103, _g2_3(gy+57, gz+24));
+        GOUT(104, _g2_3(gy+54, gz+27));
+        GOUT(105, _g3_3(gx+3, gy+48, gz+30));
+        GOUT(106, _g2_3(gy+51, gz+30));
+        GOUT(107, _g2_3(gy+48, gz+33));
+        GOUT(108, _g2_3(gx+33, gz+48));
+        GOUT(109, _g3_3(gx+30, gy+3, gz+48));
+        GOUT(110, _g2_3(gx+30, gz+51));
+        GOUT(111, _g3_3(gx+27, gy+6, gz+48));
+        GOUT(112, _g3_3(gx+24, gy+9, gz+48));
+        GOUT(113, _g3_3(gx+24, gy+6, gz+51));
+        GOUT(114, _g2_3(gx+27, gz+54));
+        GOUT(115, _g3_3(gx+24, gy+3, gz+54));
+        GOUT(116, _g2_3(gx+24, gz+57));
+        GOUT(117, _g3_3(gx+21, gy+12, gz+48));
+        GOUT(118, _g3_3(gx+18, gy+15, gz+48));
+        GOUT(119, _g3_3(gx+18, gy+12, gz+51));
+        GOUT(120, _g3_3(gx+15, gy+18, gz+48));
+        GOUT(121, _g3_3(gx+12, gy+21, gz+48));
+        GOUT(122, _g3_3(gx+12, gy+18, gz+51));
+        GOUT(123, _g3_3(gx+15, gy+12, gz+54));
+        GOUT(124, _g3_3(gx+12, gy+15, gz+54));
+        GOUT(125, _g3_3(gx+12, gy+12, gz+57));
+        GOUT(126, _g2_3(gx+21, gz+60));
+        GOUT(127, _g3_3(gx+18, gy+3, gz+60));
+        GOUT(128, _g2_3(gx+18, gz+63));
+        GOUT(129, _g3_3(gx+15, gy+6, gz+60));
+        GOUT(130, _g3_3(gx+12, gy+9, gz+60));
+        GOUT(131, _g3_3(gx+12, gy+6, gz+63));
+        GOUT(132, _g2_3(gx+15, gz+66));
+        GOUT(133, _g3_3(gx+12, gy+3, gz+66));
+        GOUT(134, _g2_3(gx+12, gz+69));
+        GOUT(135, _g3_3(gx+9, gy+24, gz+48));
+        GOUT(136, _g3_3(gx+6, gy+27, gz+48));
+        GOUT(137, _g3_3(gx+6, gy+24, gz+51));
+        GOUT(138, _g3_3(gx+3, gy+30, gz+48));
+        GOUT(139, _g2_3(gy+33, gz+48));
+        GOUT(140, _g2_3(gy+30, gz+51));
+        GOUT(141, _g3_3(gx+3, gy+24, gz+54));
+        GOUT(142, _g2_3(gy+27, gz+54));
+        GOUT(143, _g2_3(gy+24, gz+57));
+        GOUT(144, _g3_3(gx+9, gy+12, gz+60));
+        GOUT(145, _g3_3(gx+6, gy+15, gz+60));
+        GOUT(146, _g3_3(gx+6, gy+12, gz+63));
+        GOUT(147, _g3_3(gx+3, gy+18, gz+60));
+        GOUT(148, _g2_3(gy+21, gz+60));
+        GOUT(149, _g2_3(gy+18, gz+63));
+        GOUT(150, _g3_3(gx+3, gy+12, gz+66));
+        GOUT(151, _g2_3(gy+15, gz+66));
+        GOUT(152, _g2_3(gy+12, gz+69));
+        GOUT(153, _g2_3(gx+9, gz+72));
+        GOUT(154, _g3_3(gx+6, gy+3, gz+72));
+        GOUT(155, _g2_3(gx+6, gz+75));
+        GOUT(156, _g3_3(gx+3, gy+6, gz+72));
+        GOUT(157, _g2_3(gy+9, gz+72));
+        GOUT(158, _g2_3(gy+6, gz+75));
+        GOUT(159, _g2_3(gx+3, gz+78));
+        GOUT(160, _g2_3(gy+3, gz+78));
+        GOUT(161, _g1_3(gz+81));
+}
+
+static void _g0_2d4d_1120(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 54;
+        double *gz = g + 108;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+18] = c00x;
+                gx[n+3] = rx + gx[n+18];
+                gx[n+6] = c0px;
+                gx[n+24] = c00x * gx[n+6] + b00;
+                gx[n+9] = rx * gx[n+6] + gx[n+24];
+                gx[n+12] = c0px * gx[n+6] + b01;
+                gx[n+30] = c00x * gx[n+12] + 2 * b00 * gx[n+6];
+                gx[n+15] = rx * gx[n+12] + gx[n+30];
+                gx[n+36] = c00x * gx[n+18] + b10;
+                gx[n+21] = rx * gx[n+18] + gx[n+36];
+                gx[n+42] = c00x * gx[n+24] + b10 * gx[n+6] + b00 * gx[n+18];
+                gx[n+27] = rx * gx[n+24] + gx[n+42];
+                gx[n+48] = c00x * gx[n+30] + b10 * gx[n+12] + 2 * b00 * gx[n+24];
+                gx[n+33] = rx * gx[n+30] + gx[n+48];
+                gy[n+18] = c00y;
+                gy[n+3] = ry + gy[n+18];
+                gy[n+6] = c0py;
+                gy[n+24] = c00y * gy[n+6] + b00;
+                gy[n+9] = ry * gy[n+6] + gy[n+24];
+                gy[n+12] = c0py * gy[n+6] + b01;
+                gy[n+30] = c00y * gy[n+12] + 2 * b00 * gy[n+6];
+                gy[n+15] = ry * gy[n+12] + gy[n+30];
+                gy[n+36] = c00y * gy[n+18] + b10;
+                gy[n+21] = ry * gy[n+18] + gy[n+36];
+                gy[n+42] = c00y * gy[n+24] + b10 * gy[n+6] + b00 * gy[n+18];
+                gy[n+27] = ry * gy[n+24] + gy[n+42];
+                gy[n+48] = c00y * gy[n+30] + b10 * gy[n+12] + 2 * b00 * gy[n+24];
+                gy[n+33] = ry * gy[n+30] + gy[n+48];
+                gz[n+18] = c00z * gz[n+0];
+                gz[n+3] = rz * gz[n+0] + gz[n+18];
+                gz[n+6] = c0pz * gz[n+0];
+                gz[n+24] = c00z * gz[n+6] + b00 * gz[n+0];
+                gz[n+9] = rz * gz[n+6] + gz[n+24];
+                gz[n+12] = c0pz * gz[n+6] + b01 * gz[n+0];
+                gz[n+30] = c00z * gz[n+12] + 2 * b00 * gz[n+6];
+                gz[n+15] = rz * gz[n+12] + gz[n+30];
+                gz[n+36] = c00z * gz[n+18] + b10 * gz[n+0];
+                gz[n+21] = rz * gz[n+18] + gz[n+36];
+                gz[n+42] = c00z * gz[n+24] + b10 * gz[n+6] + b00 * gz[n+18];
+                gz[n+27] = rz * gz[n+24] + gz[n+42];
+                gz[n+48] = c00z * gz[n+30] + b10 * gz[n+12] + 2 * b00 * gz[n+24];
+                gz[n+33] = rz * gz[n+30] + gz[n+48];
+        }
+}
+static void _gout_1120(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 54;
+        double *gz = g + 108;
+        GOUT(0, _g2_3(gx+33, gz+0));
+        GOUT(1, _g3_3(gx+30, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+30, gz+3));
+        GOUT(3, _g3_3(gx+27, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+24, gy+9, gz+0));
+        GOUT(5, _g3_3(gx+24, gy+6, gz+3));
+        GOUT(6, _g2_3(gx+27, gz+6));
+        GOUT(7, _g3_3(gx+24, gy+3, gz+6));
+        GOUT(8, _g2_3(gx+24, gz+9));
+        GOUT(9, _g3_3(gx+21, gy+12, gz+0));
+        GOUT(10, _g3_3(gx+18, gy+15, gz+0));
+        GOUT(11, _g3_3(gx+18, gy+12, gz+3));
+        GOUT(12, _g3_3(gx+21, gy+6, gz+6));
+        GOUT(13, _g3_3(gx+18, gy+9, gz+6));
+        GOUT(14, _g3_3(gx+18, gy+6, gz+9));
+        GOUT(15, _g2_3(gx+21, gz+12));
+        GOUT(16, _g3_3(gx+18, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+18, gz+15));
+        GOUT(18, _g3_3(gx+15, gy+18, gz+0));
+        GOUT(19, _g3_3(gx+12, gy+21, gz+0));
+        GOUT(20, _g3_3(gx+12, gy+18, gz+3));
+        GOUT(21, _g3_3(gx+9, gy+24, gz+0));
+        GOUT(22, _g3_3(gx+6, gy+27, gz+0));
+        GOUT(23, _g3_3(gx+6, gy+24, gz+3));
+        GOUT(24, _g3_3(gx+9, gy+18, gz+6));
+        GOUT(25, _g3_3(gx+6, gy+21, gz+6));
+        GOUT(26, _g3_3(gx+6, gy+18, gz+9));
+        GOUT(27, _g3_3(gx+3, gy+30, gz+0));
+        GOUT(28, _g2_3(gy+33, gz+0));
+        GOUT(29, _g2_3(gy+30, gz+3));
+        GOUT(30, _g3_3(gx+3, gy+24, gz+6));
+        GOUT(31, _g2_3(gy+27, gz+6));
+        GOUT(32, _g2_3(gy+24, gz+9));
+        GOUT(33, _g3_3(gx+3, gy+18, gz+12));
+        GOUT(34, _g2_3(gy+21, gz+12));
+        GOUT(35, _g2_3(gy+18, gz+15));
+        GOUT(36, _g2_3(gx+15, gz+18));
+        GOUT(37, _g3_3(gx+12, gy+3, gz+18));
+        GOUT(38, _g2_3(gx+12, gz+21));
+        GOUT(39, _g3_3(gx+9, gy+6, gz+18));
+        GOUT(40, _g3_3(gx+6, gy+9, gz+18));
+        GOUT(41, _g3_3(gx+6, gy+6, gz+21));
+        GOUT(42, _g2_3(gx+9, gz+24));
+        GOUT(43, _g3_3(gx+6, gy+3, gz+24));
+        GOUT(44, _g2_3(gx+6, gz+27));
+        GOUT(45, _g3_3(gx+3, gy+12, gz+18));
+        GOUT(46, _g2_3(gy+15, gz+18));
+        GOUT(47, _g2_3(gy+12, gz+21));
+        GOUT(48, _g3_3(gx+3, gy+6, gz+24));
+        GOUT(49, _g2_3(gy+9, gz+24));
+        GOUT(50, _g2_3(gy+6, gz+27));
+        GOUT(51, _g2_3(gx+3, gz+30));
+        GOUT(52, _g2_3(gy+3, gz+30));
+        GOUT(53, _g1_3(gz+33));
+}
+
+static void _g0_2d4d_1121(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 144;
+        double *gz = g + 288;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+48] = c00x;
+                gx[n+3] = rx + gx[n+48];
+                gx[n+6] = c0px;
+                gx[n+54] = c00x * gx[n+6] + b00;
+                gx[n+9] = rx * gx[n+6] + gx[n+54];
+                gx[n+12] = c0px * gx[n+6] + b01;
+                gx[n+60] = c00x * gx[n+12] + 2 * b00 * gx[n+6];
+                gx[n+15] = rx * gx[n+12] + gx[n+60];
+                gx[n+24] = sx + gx[n+6];
+                gx[n+72] = sx * gx[n+48] + gx[n+54];
+                gx[n+27] = rx * gx[n+24] + gx[n+72];
+                gx[n+30] = sx * gx[n+6] + gx[n+12];
+                gx[n+78] = sx * gx[n+54] + gx[n+60];
+                gx[n+33] = rx * gx[n+30] + gx[n+78];
+                gx[n+18] = c0px * gx[n+12] + 2 * b01 * gx[n+6];
+                gx[n+36] = sx * gx[n+12] + gx[n+18];
+                gx[n+66] = c00x * gx[n+18] + 3 * b00 * gx[n+12];
+                gx[n+84] = sx * gx[n+60] + gx[n+66];
+                gx[n+39] = rx * gx[n+36] + gx[n+84];
+                gx[n+96] = c00x * gx[n+48] + b10;
+                gx[n+51] = rx * gx[n+48] + gx[n+96];
+                gx[n+102] = c00x * gx[n+54] + b10 * gx[n+6] + b00 * gx[n+48];
+                gx[n+57] = rx * gx[n+54] + gx[n+102];
+                gx[n+108] = c00x * gx[n+60] + b10 * gx[n+12] + 2 * b00 * gx[n+54];
+                gx[n+63] = rx * gx[n+60] + gx[n+108];
+                gx[n+120] = sx * gx[n+96] + gx[n+102];
+                gx[n+75] = rx * gx[n+72] + gx[n+120];
+                gx[n+126] = sx * gx[n+102] + gx[n+108];
+                gx[n+81] = rx * gx[n+78] + gx[n+126];
+                gx[n+114] = c00x * gx[n+66] + b10 * gx[n+18] + 3 * b00 * gx[n+60];
+                gx[n+132] = sx * gx[n+108] + gx[n+114];
+                gx[n+87] = rx * gx[n+84] + gx[n+132];
+                gy[n+48] = c00y;
+                gy[n+3] = ry + gy[n+48];
+                gy[n+6] = c0py;
+                gy[n+54] = c00y * gy[n+6] + b00;
+                gy[n+9] = ry * gy[n+6] + gy[n+54];
+                gy[n+12] = c0py * gy[n+6] + b01;
+                gy[n+60] = c00y * gy[n+12] + 2 * b00 * gy[n+6];
+                gy[n+15] = ry * gy[n+12] + gy[n+60];
+                gy[n+24] = sy + gy[n+6];
+                gy[n+72] = sy * gy[n+48] + gy[n+54];
+                gy[n+27] = ry * gy[n+24] + gy[n+72];
+                gy[n+30] = sy * gy[n+6] + gy[n+12];
+                gy[n+78] = sy * gy[n+54] + gy[n+60];
+                gy[n+33] = ry * gy[n+30] + gy[n+78];
+                gy[n+18] = c0py * gy[n+12] + 2 * b01 * gy[n+6];
+                gy[n+36] = sy * gy[n+12] + gy[n+18];
+                gy[n+66] = c00y * gy[n+18] + 3 * b00 * gy[n+12];
+                gy[n+84] = sy * gy[n+60] + gy[n+66];
+                gy[n+39] = ry * gy[n+36] + gy[n+84];
+                gy[n+96] = c00y * gy[n+48] + b10;
+                gy[n+51] = ry * gy[n+48] + gy[n+96];
+                gy[n+102] = c00y * gy[n+54] + b10 * gy[n+6] + b00 * gy[n+48];
+                gy[n+57] = ry * gy[n+54] + gy[n+102];
+                gy[n+108] = c00y * gy[n+60] + b10 * gy[n+12] + 2 * b00 * gy[n+54];
+                gy[n+63] = ry * gy[n+60] + gy[n+108];
+                gy[n+120] = sy * gy[n+96] + gy[n+102];
+                gy[n+75] = ry * gy[n+72] + gy[n+120];
+                gy[n+126] = sy * gy[n+102] + gy[n+108];
+                gy[n+81] = ry * gy[n+78] + gy[n+126];
+                gy[n+114] = c00y * gy[n+66] + b10 * gy[n+18] + 3 * b00 * gy[n+60];
+                gy[n+132] = sy * gy[n+108] + gy[n+114];
+                gy[n+87] = ry * gy[n+84] + gy[n+132];
+                gz[n+48] = c00z * gz[n+0];
+                gz[n+3] = rz * gz[n+0] + gz[n+48];
+                gz[n+6] = c0pz * gz[n+0];
+                gz[n+54] = c00z * gz[n+6] + b00 * gz[n+0];
+                gz[n+9] = rz * gz[n+6] + gz[n+54];
+                gz[n+12] = c0pz * gz[n+6] + b01 * gz[n+0];
+                gz[n+60] = c00z * gz[n+12] + 2 * b00 * gz[n+6];
+                gz[n+15] = rz * gz[n+12] + gz[n+60];
+                gz[n+24] = sz * gz[n+0] + gz[n+6];
+                gz[n+72] = sz * gz[n+48] + gz[n+54];
+                gz[n+27] = rz * gz[n+24] + gz[n+72];
+                gz[n+30] = sz * gz[n+6] + gz[n+12];
+                gz[n+78] = sz * gz[n+54] + gz[n+60];
+                gz[n+33] = rz * gz[n+30] + gz[n+78];
+                gz[n+18] = c0pz * gz[n+12] + 2 * b01 * gz[n+6];
+                gz[n+36] = sz * gz[n+12] + gz[n+18];
+                gz[n+66] = c00z * gz[n+18] + 3 * b00 * gz[n+12];
+                gz[n+84] = sz * gz[n+60] + gz[n+66];
+                gz[n+39] = rz * gz[n+36] + gz[n+84];
+                gz[n+96] = c00z * gz[n+48] + b10 * gz[n+0];
+                gz[n+51] = rz * gz[n+48] + gz[n+96];
+                gz[n+102] = c00z * gz[n+54] + b10 * gz[n+6] + b00 * gz[n+48];
+                gz[n+57] = rz * gz[n+54] + gz[n+102];
+                gz[n+108] = c00z * gz[n+60] + b10 * gz[n+12] + 2 * b00 * gz[n+54];
+                gz[n+63] = rz * gz[n+60] + gz[n+108];
+                gz[n+120] = sz * gz[n+96] + gz[n+102];
+                gz[n+75] = rz * gz[n+72] + gz[n+120];
+                gz[n+126] = sz * gz[n+102] + gz[n+108];
+                gz[n+81] = rz * gz[n+78] + gz[n+126];
+                gz[n+114] = c00z * gz[n+66] + b10 * gz[n+18] + 3 * b00 * gz[n+60];
+                gz[n+132] = sz * gz[n+108] + gz[n+114];
+                gz[n+87] = rz * gz[n+84] + gz[n+132];
+        }
+}
+static void _gout_1121(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 144;
+        double *gz = g + 288;
+        GOUT(0, _g2_3(gx+87, gz+0));
+        GOUT(1, _g3_3(gx+84, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+84, gz+3));
+        GOUT(3, _g3_3(gx+81, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+78, gy+9, gz+0));
+        GOUT(5, _g3_3(gx+78, gy+6, gz+3));
+        GOUT(6, _g2_3(gx+81, gz+6));
+        GOUT(7, _g3_3(gx+78, gy+3, gz+6));
+        GOUT(8, _g2_3(gx+78, gz+9));
+        GOUT(9, _g3_3(gx+75, gy+12, gz+0));
+        GOUT(10, _g3_3(gx+72, gy+15, gz+0));
+        GOUT(11, _g3_3(gx+72, gy+12, gz+3));
+        GOUT(12, _g3_3(gx+75, gy+6, gz+6));
+        GOUT(13, _g3_3(gx+72, gy+9, gz+6));
+        GOUT(14, _g3_3(gx+72, gy+6, gz+9));
+        GOUT(15, _g2_3(gx+75, gz+12));
+        GOUT(16, _g3_3(gx+72, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+72, gz+15));
+        GOUT(18, _g3_3(gx+63, gy+24, gz+0));
+        GOUT(19, _g3_3(gx+60, gy+27, gz+0));
+        GOUT(20, _g3_3(gx+60, gy+24, gz+3));
+        GOUT(21, _g3_3(gx+57, gy+30, gz+0));
+        GOUT(22, _g3_3(gx+54, gy+33, gz+0));
+        GOUT(23, _g3_3(gx+54, gy+30, gz+3));
+        GOUT(24, _g3_3(gx+57, gy+24, gz+6));
+        GOUT(25, _g3_3(gx+54, gy+27, gz+6));
+        GOUT(26, _g3_3(gx+54, gy+24, gz+9));
+        GOUT(27, _g3_3(gx+51, gy+36, gz+0));
+        GOUT(28, _g3_3(gx+48, gy+39, gz+0));
+        GOUT(29, _g3_3(gx+48, gy+36, gz+3));
+        GOUT(30, _g3_3(gx+51, gy+30, gz+6));
+        GOUT(31, _g3_3(gx+48, gy+33, gz+6));
+        GOUT(32, _g3_3(gx+48, gy+30, gz+9));
+        GOUT(33, _g3_3(gx+51, gy+24, gz+12));
+        GOUT(34, _g3_3(gx+48, gy+27, gz+12));
+        GOUT(35, _g3_3(gx+48, gy+24, gz+15));
+        GOUT(36, _g2_3(gx+63, gz+24));
+        GOUT(37, _g3_3(gx+60, gy+3, gz+24));
+        GOUT(38, _g2_3(gx+60, gz+27));
+        GOUT(39, _g3_3(gx+57, gy+6, gz+24));
+        GOUT(40, _g3_3(gx+54, gy+9, gz+24));
+        GOUT(41, _g3_3(gx+54, gy+6, gz+27));
+        GOUT(42, _g2_3(gx+57, gz+30));
+        GOUT(43, _g3_3(gx+54, gy+3, gz+30));
+        GOUT(44, _g2_3(gx+54, gz+33));
+        GOUT(45, _g3_3(gx+51, gy+12, gz+24));
+        GOUT(46, _g3_3(gx+48, gy+15, gz+24));
+        GOUT(47, _g3_3(gx+48, gy+12, gz+27));
+        GOUT(48, _g3_3(gx+51, gy+6, gz+30));
+        GOUT(49, _g3_3(gx+48, gy+9, gz+30));
+        GOUT(50, _g3_3(gx+48, gy+6, gz+33));
+        GOUT(51, _g2_3(gx+51, gz+36));
+        GOUT(52, _g3_3(gx+48, gy+3, gz+36));
+        GOUT(53, _g2_3(gx+48, gz+39));
+        GOUT(54, _g3_3(gx+39, gy+48, gz+0));
+        GOUT(55, _g3_3(gx+36, gy+51, gz+0));
+        GOUT(56, _g3_3(gx+36, gy+48, gz+3));
+        GOUT(57, _g3_3(gx+33, gy+54, gz+0));
+        GOUT(58, _g3_3(gx+30, gy+57, gz+0));
+        GOUT(59, _g3_3(gx+30, gy+54, gz+3));
+        GOUT(60, _g3_3(gx+33, gy+48, gz+6));
+        GOUT(61, _g3_3(gx+30, gy+51, gz+6));
+        GOUT(62, _g3_3(gx+30, gy+48, gz+9));
+        GOUT(63, _g3_3(gx+27, gy+60, gz+0));
+        GOUT(64, _g3_3(gx+24, gy+63, gz+0));
+        GOUT(65, _g3_3(gx+24, gy+60, gz+3));
+        GOUT(66, _g3_3(gx+27, gy+54, gz+6));
+        GOUT(67, _g3_3(gx+24, gy+57, gz+6));
+        GOUT(68, _g3_3(gx+24, gy+54, gz+9));
+        GOUT(69, _g3_3(gx+27, gy+48, gz+12));
+        GOUT(70, _g3_3(gx+24, gy+51, gz+12));
+        GOUT(71, _g3_3(gx+24, gy+48, gz+15));
+        GOUT(72, _g3_3(gx+15, gy+72, gz+0));
+        GOUT(73, _g3_3(gx+12, gy+75, gz+0));
+        GOUT(74, _g3_3(gx+12, gy+72, gz+3));
+        GOUT(75, _g3_3(gx+9, gy+78, gz+0));
+        GOUT(76, _g3_3(gx+6, gy+81, gz+0));
+        GOUT(77, _g3_3(gx+6, gy+78, gz+3));
+        GOUT(78, _g3_3(gx+9, gy+72, gz+6));
+        GOUT(79, _g3_3(gx+6, gy+75, gz+6));
+        GOUT(80, _g3_3(gx+6, gy+72, gz+9));
+        GOUT(81, _g3_3(gx+3, gy+84, gz+0));
+        GOUT(82, _g2_3(gy+87, gz+0));
+        GOUT(83, _g2_3(gy+84, gz+3));
+        GOUT(84, _g3_3(gx+3, gy+78, gz+6));
+        GOUT(85, _g2_3(gy+81, gz+6));
+        GOUT(86, _g2_3(gy+78, gz+9));
+        GOUT(87, _g3_3(gx+3, gy+72, gz+12));
+        GOUT(88, _g2_3(gy+75, gz+12));
+        GOUT(89, _g2_3(gy+72, gz+15));
+        GOUT(90, _g3_3(gx+15, gy+48, gz+24));
+        GOUT(91, _g3_3(gx+12, gy+51, gz+24));
+        GOUT(92, _g3_3(gx+12, gy+48, gz+27));
+        GOUT(93, _g3_3(gx+9, gy+54, gz+24));
+        GOUT(94, _g3_3(gx+6, gy+57, gz+24));
+        GOUT(95, _g3_3(gx+6, gy+54, gz+27));
+        GOUT(96, _g3_3(gx+9, gy+48, gz+30));
+        GOUT(97, _g3_3(gx+6, gy+51, gz+30));
+        GOUT(98, _g3_3(gx+6, gy+48, gz+33));
+        GOUT(99, _g3_3(gx+3, gy+60, gz+24));
+        GOUT(100, _g2_3(gy+63, gz+24));
+        GOUT(101, _g2_3(gy+60, gz+27));
+        GOUT(102, _g3_3(gx+3, gy+54, gz+30));
+        GOUT(103, _g2_3(gy+57, gz+30));
+        GOUT(104, _g2_3(gy+54, gz+33));
+        GOUT(105, _g3_3(gx+3, gy+48, gz+36));
+        GOUT(106, _g2_3(gy+51, gz+36));
+        GOUT(107, _g2_3(gy+48, gz+39));
+        GOUT(108, _g2_3(gx+39, gz+48));
+        GOUT(109, _g3_3(gx+36, gy+3, gz+48));
+        GOUT(110, _g2_3(gx+36, gz+51));
+        GOUT(111, _g3_3(gx+33, gy+6, gz+48));
+        GOUT(112, _g3_3(gx+30, gy+9, gz+48));
+        GOUT(113, _g3_3(gx+30, gy+6, gz+51));
+        GOUT(114, _g2_3(gx+33, gz+54));
+        GOUT(115, _g3_3(gx+30, gy+3, gz+54));
+        GOUT(116, _g2_3(gx+30, gz+57));
+        GOUT(117, _g3_3(gx+27, gy+12, gz+48));
+        GOUT(118, _g3_3(gx+24, gy+15, gz+48));
+        GOUT(119, _g3_3(gx+24, gy+12, gz+51));
+        GOUT(120, _g3_3(gx+27, gy+6, gz+54));
+        GOUT(121, _g3_3(gx+24, gy+9, gz+54));
+        GOUT(122, _g3_3(gx+24, gy+6, gz+57));
+        GOUT(123, _g2_3(gx+27, gz+60));
+        GOUT(124, _g3_3(gx+24, gy+3, gz+60));
+        GOUT(125, _g2_3(gx+24, gz+63));
+        GOUT(126, _g3_3(gx+15, gy+24, gz+48));
+        GOUT(127, _g3_3(gx+12, gy+27, gz+48));
+        GOUT(128, _g3_3(gx+12, gy+24, gz+51));
+        GOUT(129, _g3_3(gx+9, gy+30, gz+48));
+        GOUT(130, _g3_3(gx+6, gy+33, gz+48));
+        GOUT(131, _g3_3(gx+6, gy+30, gz+51));
+        GOUT(132, _g3_3(gx+9, gy+24, gz+54));
+        GOUT(133, _g3_3(gx+6, gy+27, gz+54));
+        GOUT(134, _g3_3(gx+6, gy+24, gz+57));
+        GOUT(135, _g3_3(gx+3, gy+36, gz+48));
+        GOUT(136, _g2_3(gy+39, gz+48));
+        GOUT(137, _g2_3(gy+36, gz+51));
+        GOUT(138, _g3_3(gx+3, gy+30, gz+54));
+        GOUT(139, _g2_3(gy+33, gz+54));
+        GOUT(140, _g2_3(gy+30, gz+57));
+        GOUT(141, _g3_3(gx+3, gy+24, gz+60));
+        GOUT(142, _g2_3(gy+27, gz+60));
+        GOUT(143, _g2_3(gy+24, gz+63));
+        GOUT(144, _g2_3(gx+15, gz+72));
+        GOUT(145, _g3_3(gx+12, gy+3, gz+72));
+        GOUT(146, _g2_3(gx+12, gz+75));
+        GOUT(147, _g3_3(gx+9, gy+6, gz+72));
+        GOUT(148, _g3_3(gx+6, gy+9, gz+72));
+        GOUT(149, _g3_3(gx+6, gy+6, gz+75));
+        GOUT(150, _g2_3(gx+9, gz+78));
+        GOUT(151, _g3_3(gx+6, gy+3, gz+78));
+        GOUT(152, _g2_3(gx+6, gz+81));
+        GOUT(153, _g3_3(gx+3, gy+12, gz+72));
+        GOUT(154, _g2_3(gy+15, gz+72));
+        GOUT(155, _g2_3(gy+12, gz+75));
+        GOUT(156, _g3_3(gx+3, gy+6, gz+78));
+        GOUT(157, _g2_3(gy+9, gz+78));
+        GOUT(158, _g2_3(gy+6, gz+81));
+        GOUT(159, _g2_3(gx+3, gz+84));
+        GOUT(160, _g2_3(gy+3, gz+84));
+        GOUT(161, _g1_3(gz+87));
+}
+
+static void _g0_2d4d_1122(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 360;
+        double *gz = g + 720;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 4; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+120] = c00x;
+                gx[n+4] = rx + gx[n+120];
+                gx[n+24] = c0px;
+                gx[n+8] = sx + gx[n+24];
+                gx[n+144] = c00x * gx[n+24] + b00;
+                gx[n+128] = sx * gx[n+120] + gx[n+144];
+                gx[n+12] = rx * gx[n+8] + gx[n+128];
+                gx[n+48] = c0px * gx[n+24] + b01;
+                gx[n+32] = sx * gx[n+24] + gx[n+48];
+                gx[n+16] = sx * gx[n+8] + gx[n+32];
+                gx[n+168] = c00x * gx[n+48] + 2 * b00 * gx[n+24];
+                gx[n+152] = sx * gx[n+144] + gx[n+168];
+                gx[n+136] = sx * gx[n+128] + gx[n+152];
+                gx[n+20] = rx * gx[n+16] + gx[n+136];
+                gx[n+28] = rx * gx[n+24] + gx[n+144];
+                gx[n+36] = rx * gx[n+32] + gx[n+152];
+                gx[n+72] = c0px * gx[n+48] + 2 * b01 * gx[n+24];
+                gx[n+56] = sx * gx[n+48] + gx[n+72];
+                gx[n+40] = sx * gx[n+32] + gx[n+56];
+                gx[n+192] = c00x * gx[n+72] + 3 * b00 * gx[n+48];
+                gx[n+176] = sx * gx[n+168] + gx[n+192];
+                gx[n+160] = sx * gx[n+152] + gx[n+176];
+                gx[n+44] = rx * gx[n+40] + gx[n+160];
+                gx[n+52] = rx * gx[n+48] + gx[n+168];
+                gx[n+60] = rx * gx[n+56] + gx[n+176];
+                gx[n+96] = c0px * gx[n+72] + 3 * b01 * gx[n+48];
+                gx[n+80] = sx * gx[n+72] + gx[n+96];
+                gx[n+64] = sx * gx[n+56] + gx[n+80];
+                gx[n+216] = c00x * gx[n+96] + 4 * b00 * gx[n+72];
+                gx[n+200] = sx * gx[n+192] + gx[n+216];
+                gx[n+184] = sx * gx[n+176] + gx[n+200];
+                gx[n+68] = rx * gx[n+64] + gx[n+184];
+                gx[n+240] = c00x * gx[n+120] + b10;
+                gx[n+124] = rx * gx[n+120] + gx[n+240];
+                gx[n+264] = c00x * gx[n+144] + b10 * gx[n+24] + b00 * gx[n+120];
+                gx[n+248] = sx * gx[n+240] + gx[n+264];
+                gx[n+132] = rx * gx[n+128] + gx[n+248];
+                gx[n+288] = c00x * gx[n+168] + b10 * gx[n+48] + 2 * b00 * gx[n+144];
+                gx[n+272] = sx * gx[n+264] + gx[n+288];
+                gx[n+256] = sx * gx[n+248] + gx[n+272];
+                gx[n+140] = rx * gx[n+136] + gx[n+256];
+                gx[n+148] = rx * gx[n+144] + gx[n+264];
+                gx[n+156] = rx * gx[n+152] + gx[n+272];
+                gx[n+312] = c00x * gx[n+192] + b10 * gx[n+72] + 3 * b00 * gx[n+168];
+                gx[n+296] = sx * gx[n+288] + gx[n+312];
+                gx[n+280] = sx * gx[n+272] + gx[n+296];
+                gx[n+164] = rx * gx[n+160] + gx[n+280];
+                gx[n+172] = rx * gx[n+168] + gx[n+288];
+                gx[n+180] = rx * gx[n+176] + gx[n+296];
+                gx[n+336] = c00x * gx[n+216] + b10 * gx[n+96] + 4 * b00 * gx[n+192];
+                gx[n+320] = sx * gx[n+312] + gx[n+336];
+                gx[n+304] = sx * gx[n+296] + gx[n+320];
+                gx[n+188] = rx * gx[n+184] + gx[n+304];
+                gy[n+120] = c00y;
+                gy[n+4] = ry + gy[n+120];
+                gy[n+24] = c0py;
+                gy[n+8] = sy + gy[n+24];
+                gy[n+144] = c00y * gy[n+24] + b00;
+                gy[n+128] = sy * gy[n+120] + gy[n+144];
+                gy[n+12] = ry * gy[n+8] + gy[n+128];
+                gy[n+48] = c0py * gy[n+24] + b01;
+                gy[n+32] = sy * gy[n+24] + gy[n+48];
+                gy[n+16] = sy * gy[n+8] + gy[n+32];
+                gy[n+168] = c00y * gy[n+48] + 2 * b00 * gy[n+24];
+                gy[n+152] = sy * gy[n+144] + gy[n+168];
+                gy[n+136] = sy * gy[n+128] + gy[n+152];
+                gy[n+20] = ry * gy[n+16] + gy[n+136];
+                gy[n+28] = ry * gy[n+24] + gy[n+144];
+                gy[n+36] = ry * gy[n+32] + gy[n+152];
+                gy[n+72] = c0py * gy[n+48] + 2 * b01 * gy[n+24];
+                gy[n+56] = sy * gy[n+48] + gy[n+72];
+                gy[n+40] = sy * gy[n+32] + gy[n+56];
+                gy[n+192] = c00y * gy[n+72] + 3 * b00 * gy[n+48];
+                gy[n+176] = sy * gy[n+168] + gy[n+192];
+                gy[n+160] = sy * gy[n+152] + gy[n+176];
+                gy[n+44] = ry * gy[n+40] + gy[n+160];
+                gy[n+52] = ry * gy[n+48] + gy[n+168];
+                gy[n+60] = ry * gy[n+56] + gy[n+176];
+                gy[n+96] = c0py * gy[n+72] + 3 * b01 * gy[n+48];
+                gy[n+80] = sy * gy[n+72] + gy[n+96];
+                gy[n+64] = sy * gy[n+56] + gy[n+80];
+                gy[n+216] = c00y * gy[n+96] + 4 * b00 * gy[n+72];
+                gy[n+200] = sy * gy[n+192] + gy[n+216];
+                gy[n+184] = sy * gy[n+176] + gy[n+200];
+                gy[n+68] = ry * gy[n+64] + gy[n+184];
+                gy[n+240] = c00y * gy[n+120] + b10;
+                gy[n+124] = ry * gy[n+120] + gy[n+240];
+                gy[n+264] = c00y * gy[n+144] + b10 * gy[n+24] + b00 * gy[n+120];
+                gy[n+248] = sy * gy[n+240] + gy[n+264];
+                gy[n+132] = ry * gy[n+128] + gy[n+248];
+                gy[n+288] = c00y * gy[n+168] + b10 * gy[n+48] + 2 * b00 * gy[n+144];
+                gy[n+272] = sy * gy[n+264] + gy[n+288];
+                gy[n+256] = sy * gy[n+248] + gy[n+272];
+                gy[n+140] = ry * gy[n+136] + gy[n+256];
+                gy[n+148] = ry * gy[n+144] + gy[n+264];
+                gy[n+156] = ry * gy[n+152] + gy[n+272];
+                gy[n+312] = c00y * gy[n+192] + b10 * gy[n+72] + 3 * b00 * gy[n+168];
+                gy[n+296] = sy * gy[n+288] + gy[n+312];
+                gy[n+280] = sy * gy[n+272] + gy[n+296];
+                gy[n+164] = ry * gy[n+160] + gy[n+280];
+                gy[n+172] = ry * gy[n+168] + gy[n+288];
+                gy[n+180] = ry * gy[n+176] + gy[n+296];
+                gy[n+336] = c00y * gy[n+216] + b10 * gy[n+96] + 4 * b00 * gy[n+192];
+                gy[n+320] = sy * gy[n+312] + gy[n+336];
+                gy[n+304] = sy * gy[n+296] + gy[n+320];
+                gy[n+188] = ry * gy[n+184] + gy[n+304];
+                gz[n+120] = c00z * gz[n+0];
+                gz[n+4] = rz * gz[n+0] + gz[n+120];
+                gz[n+24] = c0pz * gz[n+0];
+                gz[n+8] = sz * gz[n+0] + gz[n+24];
+                gz[n+144] = c00z * gz[n+24] + b00 * gz[n+0];
+                gz[n+128] = sz * gz[n+120] + gz[n+144];
+                gz[n+12] = rz * gz[n+8] + gz[n+128];
+                gz[n+48] = c0pz * gz[n+24] + b01 * gz[n+0];
+                gz[n+32] = sz * gz[n+24] + gz[n+48];
+                gz[n+16] = sz * gz[n+8] + gz[n+32];
+                gz[n+168] = c00z * gz[n+48] + 2 * b00 * gz[n+24];
+                gz[n+152] = sz * gz[n+144] + gz[n+168];
+                gz[n+136] = sz * gz[n+128] + gz[n+152];
+                gz[n+20] = rz * gz[n+16] + gz[n+136];
+                gz[n+28] = rz * gz[n+24] + gz[n+144];
+                gz[n+36] = rz * gz[n+32] + gz[n+152];
+                gz[n+72] = c0pz * gz[n+48] + 2 * b01 * gz[n+24];
+                gz[n+56] = sz * gz[n+48] + gz[n+72];
+                gz[n+40] = sz * gz[n+32] + gz[n+56];
+                gz[n+192] = c00z * gz[n+72] + 3 * b00 * gz[n+48];
+                gz[n+176] = sz * gz[n+168] + gz[n+192];
+                gz[n+160] = sz * gz[n+152] + gz[n+176];
+                gz[n+44] = rz * gz[n+40] + gz[n+160];
+                gz[n+52] = rz * gz[n+48] + gz[n+168];
+                gz[n+60] = rz * gz[n+56] + gz[n+176];
+                gz[n+96] = c0pz * gz[n+72] + 3 * b01 * gz[n+48];
+                gz[n+80] = sz * gz[n+72] + gz[n+96];
+                gz[n+64] = sz * gz[n+56] + gz[n+80];
+                gz[n+216] = c00z * gz[n+96] + 4 * b00 * gz[n+72];
+                gz[n+200] = sz * gz[n+192] + gz[n+216];
+                gz[n+184] = sz * gz[n+176] + gz[n+200];
+                gz[n+68] = rz * gz[n+64] + gz[n+184];
+                gz[n+240] = c00z * gz[n+120] + b10 * gz[n+0];
+                gz[n+124] = rz * gz[n+120] + gz[n+240];
+                gz[n+264] = c00z * gz[n+144] + b10 * gz[n+24] + b00 * gz[n+120];
+                gz[n+248] = sz * gz[n+240] + gz[n+264];
+                gz[n+132] = rz * gz[n+128] + gz[n+248];
+                gz[n+288] = c00z * gz[n+168] + b10 * gz[n+48] + 2 * b00 * gz[n+144];
+                gz[n+272] = sz * gz[n+264] + gz[n+288];
+                gz[n+256] = sz * gz[n+248] + gz[n+272];
+                gz[n+140] = rz * gz[n+136] + gz[n+256];
+                gz[n+148] = rz * gz[n+144] + gz[n+264];
+                gz[n+156] = rz * gz[n+152] + gz[n+272];
+                gz[n+312] = c00z * gz[n+192] + b10 * gz[n+72] + 3 * b00 * gz[n+168];
+                gz[n+296] = sz * gz[n+288] + gz[n+312];
+                gz[n+280] = sz * gz[n+272] + gz[n+296];
+                gz[n+164] = rz * gz[n+160] + gz[n+280];
+                gz[n+172] = rz * gz[n+168] + gz[n+288];
+                gz[n+180] = rz * gz[n+176] + gz[n+296];
+                gz[n+336] = c00z * gz[n+216] + b10 * gz[n+96] + 4 * b00 * gz[n+192];
+                gz[n+320] = sz * gz[n+312] + gz[n+336];
+                gz[n+304] = sz * gz[n+296] + gz[n+320];
+                gz[n+188] = rz * gz[n+184] + gz[n+304];
+        }
+}
+static void _gout_1122(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 360;
+        double *gz = g + 720;
+        GOUT(0, _g2_4(gx+188, gz+0));
+        GOUT(1, _g3_4(gx+184, gy+4, gz+0));
+        GOUT(2, _g2_4(gx+184, gz+4));
+        GOUT(3, _g3_4(gx+180, gy+8, gz+0));
+        GOUT(4, _g3_4(gx+176, gy+12, gz+0));
+        GOUT(5, _g3_4(gx+176, gy+8, gz+4));
+        GOUT(6, _g2_4(gx+180, gz+8));
+        GOUT(7, _g3_4(gx+176, gy+4, gz+8));
+        GOUT(8, _g2_4(gx+176, gz+12));
+        GOUT(9, _g3_4(gx+172, gy+16, gz+0));
+        GOUT(10, _g3_4(gx+168, gy+20, gz+0));
+        GOUT(11, _g3_4(gx+168, gy+16, gz+4));
+        GOUT(12, _g3_4(gx+172, gy+8, gz+8));
+        GOUT(13, _g3_4(gx+168, gy+12, gz+8));
+        GOUT(14, _g3_4(gx+168, gy+8, gz+12));
+        GOUT(15, _g2_4(gx+172, gz+16));
+        GOUT(16, _g3_4(gx+168, gy+4, gz+16));
+        GOUT(17, _g2_4(gx+168, gz+20));
+        GOUT(18, _g3_4(gx+164, gy+24, gz+0));
+        GOUT(19, _g3_4(gx+160, gy+28, gz+0));
+        GOUT(20, _g3_4(gx+160, gy+24, gz+4));
+        GOUT(21, _g3_4(gx+156, gy+32, gz+0));
+        GOUT(22, _g3_4(gx+152, gy+36, gz+0));
+        GOUT(23, _g3_4(gx+152, gy+32, gz+4));
+        GOUT(24, _g3_4(gx+156, gy+24, gz+8));
+        GOUT(25, _g3_4(gx+152, gy+28, gz+8));
+        GOUT(26, _g3_4(gx+152, gy+24, gz+12));
+        GOUT(27, _g3_4(gx+148, gy+40, gz+0));
+        GOUT(28, _g3_4(gx+144, gy+44, gz+0));
+        GOUT(29, _g3_4(gx+144, gy+40, gz+4));
+        GOUT(30, _g3_4(gx+148, gy+32, gz+8));
+        GOUT(31, _g3_4(gx+144, gy+36, gz+8));
+        GOUT(32, _g3_4(gx+144, gy+32, gz+12));
+        GOUT(33, _g3_4(gx+148, gy+24, gz+16));
+        GOUT(34, _g3_4(gx+144, gy+28, gz+16));
+        GOUT(35, _g3_4(gx+144, gy+24, gz+20));
+        GOUT(36, _g2_4(gx+164, gz+24));
+        GOUT(37, _g3_4(gx+160, gy+4, gz+24));
+        GOUT(38, _g2_4(gx+160, gz+28));
+        GOUT(39, _g3_4(gx+156, gy+8, gz+24));
+        GOUT(40, _g3_4(gx+152, gy+12, gz+24));
+        GOUT(41, _g3_4(gx+152, gy+8, gz+28));
+        GOUT(42, _g2_4(gx+156, gz+32));
+        GOUT(43, _g3_4(gx+152, gy+4, gz+32));
+        GOUT(44, _g2_4(gx+152, gz+36));
+        GOUT(45, _g3_4(gx+148, gy+16, gz+24));
+        GOUT(46, _g3_4(gx+144, gy+20, gz+24));
+        GOUT(47, _g3_4(gx+144, gy+16, gz+28));
+        GOUT(48, _g3_4(gx+148, gy+8, gz+32));
+        GOUT(49, _g3_4(gx+144, gy+12, gz+32));
+        GOUT(50, _g3_4(gx+144, gy+8, gz+36));
+        GOUT(51, _g2_4(gx+148, gz+40));
+        GOUT(52, _g3_4(gx+144, gy+4, gz+40));
+        GOUT(53, _g2_4(gx+144, gz+44));
+        GOUT(54, _g3_4(gx+140, gy+48, gz+0));
+        GOUT(55, _g3_4(gx+136, gy+52, gz+0));
+        GOUT(56, _g3_4(gx+136, gy+48, gz+4));
+        GOUT(57, _g3_4(gx+132, gy+56, gz+0));
+        GOUT(58, _g3_4(gx+128, gy+60, gz+0));
+        GOUT(59, _g3_4(gx+128, gy+56, gz+4));
+        GOUT(60, _g3_4(gx+132, gy+48, gz+8));
+        GOUT(61, _g3_4(gx+128, gy+52, gz+8));
+        GOUT(62, _g3_4(gx+128, gy+48, gz+12));
+        GOUT(63, _g3_4(gx+124, gy+64, gz+0));
+        GOUT(64, _g3_4(gx+120, gy+68, gz+0));
+        GOUT(65, _g3_4(gx+120, gy+64, gz+4));
+        GOUT(66, _g3_4(gx+124, gy+56, gz+8));
+        GOUT(67, _g3_4(gx+120, gy+60, gz+8));
+        GOUT(68, _g3_4(gx+120, gy+56, gz+12));
+        GOUT(69, _g3_4(gx+124, gy+48, gz+16));
+        GOUT(70, _g3_4(gx+120, gy+52, gz+16));
+        GOUT(71, _g3_4(gx+120, gy+48, gz+20));
+        GOUT(72, _g3_4(gx+140, gy+24, gz+24));
+        GOUT(73, _g3_4(gx+136, gy+28, gz+24));
+        GOUT(74, _g3_4(gx+136, gy+24, gz+28));
+        GOUT(75, _g3_4(gx+132, gy+32, gz+24));
+        GOUT(76, _g3_4(gx+128, gy+36, gz+24));
+        GOUT(77, _g3_4(gx+128, gy+32, gz+28));
+        GOUT(78, _g3_4(gx+132, gy+24, gz+32));
+        GOUT(79, _g3_4(gx+128, gy+28, gz+32));
+        GOUT(80, _g3_4(gx+128, gy+24, gz+36));
+        GOUT(81, _g3_4(gx+124, gy+40, gz+24));
+        GOUT(82, _g3_4(gx+120, gy+44, gz+24));
+        GOUT(83, _g3_4(gx+120, gy+40, gz+28));
+        GOUT(84, _g3_4(gx+124, gy+32, gz+32));
+        GOUT(85, _g3_4(gx+120, gy+36, gz+32));
+        GOUT(86, _g3_4(gx+120, gy+32, gz+36));
+        GOUT(87, _g3_4(gx+124, gy+24, gz+40));
+        GOUT(88, _g3_4(gx+120, gy+28, gz+40));
+        GOUT(89, _g3_4(gx+120, gy+24, gz+44));
+        GOUT(90, _g2_4(gx+140, gz+48));
+        GOUT(91, _g3_4(gx+136, gy+4, gz+48));
+        GOUT(92, _g2_4(gx+136, gz+52));
+        GOUT(93, _g3_4(gx+132, gy+8, gz+48));
+        GOUT(94, _g3_4(gx+128, gy+12, gz+48));
+        GOUT(95, _g3_4(gx+128, gy+8, gz+52));
+        GOUT(96, _g2_4(gx+132, gz+56));
+        GOUT(97, _g3_4(gx+128, gy+4, gz+56));
+        GOUT(98, _g2_4(gx+128, gz+60));
+        GOUT(99, _g3_4(gx+124, gy+16, gz+48));
+        GOUT(100, _g3_4(gx+120, gy+20, gz+48));
+        GOUT(101, _g3_4(gx+120, gy+16, gz+52));
+        GOUT(102, _g3_4(gx+124, gy+8, gz+56));
+        GOUT(103, _g3_4(gx+120, gy+12, gz+56));
+        GOUT(104, _g3_4(gx+120, gy+8, gz+60));
+        GOUT(105, _g2_4(gx+124, gz+64));
+        GOUT(106, _g3_4(gx+120, gy+4, gz+64));
+        GOUT(107, _g2_4(gx+120, gz+68));
+        GOUT(108, _g3_4(gx+68, gy+120, gz+0));
+        GOUT(109, _g3_4(gx+64, gy+124, gz+0));
+        GOUT(110, _g3_4(gx+64, gy+120, gz+4));
+        GOUT(111, _g3_4(gx+60, gy+128, gz+0));
+        GOUT(112, _g3_4(gx+56, gy+132, gz+0));
+        GOUT(113, _g3_4(gx+56, gy+128, gz+4));
+        GOUT(114, _g3_4(gx+60, gy+120, gz+8));
+        GOUT(115, _g3_4(gx+56, gy+124, gz+8));
+        GOUT(116, _g3_4(gx+56, gy+120, gz+12));
+        GOUT(117, _g3_4(gx+52, gy+136, gz+0));
+        GOUT(118, _g3_4(gx+48, gy+140, gz+0));
+        GOUT(119, _g3_4(gx+48, gy+136, gz+4));
+        GOUT(120, _g3_4(gx+52, gy+128, gz+8));
+        GOUT(121, _g3_4(gx+48, gy+132, gz+8));
+        GOUT(122, _g3_4(gx+48, gy+128, gz+12));
+        GOUT(123, _g3_4(gx+52, gy+120, gz+16));
+        GOUT(124, _g3_4(gx+48, gy+124, gz+16));
+        GOUT(125, _g3_4(gx+48, gy+120, gz+20));
+        GOUT(126, _g3_4(gx+44, gy+144, gz+0));
+        GOUT(127, _g3_4(gx+40, gy+148, gz+0));
+        GOUT(128, _g3_4(gx+40, gy+144, gz+4));
+        GOUT(129, _g3_4(gx+36, gy+152, gz+0));
+        GOUT(130, _g3_4(gx+32, gy+156, gz+0));
+        GOUT(131, _g3_4(gx+32, gy+152, gz+4));
+        GOUT(132, _g3_4(gx+36, gy+144, gz+8));
+        GOUT(133, _g3_4(gx+32, gy+148, gz+8));
+        GOUT(134, _g3_4(gx+32, gy+144, gz+12));
+        GOUT(135, _g3_4(gx+28, gy+160, gz+0));
+        GOUT(136, _g3_4(gx+24, gy+164, gz+0));
+        GOUT(137, _g3_4(gx+24, gy+160, gz+4));
+        GOUT(138, _g3_4(gx+28, gy+152, gz+8));
+        GOUT(139, _g3_4(gx+24, gy+156, gz+8));
+        GOUT(140, _g3_4(gx+24, gy+152, gz+12));
+        GOUT(141, _g3_4(gx+28, gy+144, gz+16));
+        GOUT(142, _g3_4(gx+24, gy+148, gz+16));
+        GOUT(143, _g3_4(gx+24, gy+144, gz+20));
+        GOUT(144, _g3_4(gx+44, gy+120, gz+24));
+        GOUT(145, _g3_4(gx+40, gy+124, gz+24));
+        GOUT(146, _g3_4(gx+40, gy+120, gz+28));
+        GOUT(147, _g3_4(gx+36, gy+128, gz+24));
+        GOUT(148, _g3_4(gx+32, gy+132, gz+24));
+        GOUT(149, _g3_4(gx+32, gy+128, gz+28));
+        GOUT(150, _g3_4(gx+36, gy+120, gz+32));
+        GOUT(151, _g3_4(gx+32, gy+124, gz+32));
+        GOUT(152, _g3_4(gx+32, gy+120, gz+36));
+        GOUT(153, _g3_4(gx+28, gy+136, gz+24));
+        GOUT(154, _g3_4(gx+24, gy+140, gz+24));
+        GOUT(155, _g3_4(gx+24, gy+136, gz+28));
+        GOUT(156, _g3_4(gx+28, gy+128, gz+32));
+        GOUT(157, _g3_4(gx+24, gy+132, gz+32));
+        GOUT(158, _g3_4(gx+24, gy+128, gz+36));
+        GOUT(159, _g3_4(gx+28, gy+120, gz+40));
+        GOUT(160, _g3_4(gx+24, gy+124, gz+40));
+        GOUT(161, _g3_4(gx+24, gy+120, gz+44));
+        GOUT(162, _g3_4(gx+20, gy+168, gz+0));
+        GOUT(163, _g3_4(gx+16, gy+172, gz+0));
+        GOUT(164, _g3_4(gx+16, gy+168, gz+4));
+        GOUT(165, _g3_4(gx+12, gy+176, gz+0));
+        GOUT(166, _g3_4(gx+8, gy+180, gz+0));
+        GOUT(167, _g3_4(gx+8, gy+176, gz+4));
+        GOUT(168, _g3_4(gx+12, gy+168, gz+8));
+        GOUT(169, _g3_4(gx+8, gy+172, gz+8));
+        GOUT(170, _g3_4(gx+8, gy+168, gz+12));
+        GOUT(171, _g3_4(gx+4, gy+184, gz+0));
+        GOUT(172, _g2_4(gy+188, gz+0));
+        GOUT(173, _g2_4(gy+184, gz+4));
+        GOUT(174, _g3_4(gx+4, gy+176, gz+8));
+        GOUT(175, _g2_4(gy+180, gz+8));
+        GOUT(176, _g2_4(gy+176, gz+12));
+        GOUT(177, _g3_4(gx+4, gy+168, gz+16));
+        GOUT(178, _g2_4(gy+172, gz+16));
+        GOUT(179, _g2_4(gy+168, gz+20));
+        GOUT(180, _g3_4(gx+20, gy+144, gz+24));
+        GOUT(181, _g3_4(gx+16, gy+148, gz+24));
+        GOUT(182, _g3_4(gx+16, gy+144, gz+28));
+        GOUT(183, _g3_4(gx+12, gy+152, gz+24));
+        GOUT(184, _g3_4(gx+8, gy+156, gz+24));
+        GOUT(185, _g3_4(gx+8, gy+152, gz+28));
+        GOUT(186, _g3_4(gx+12, gy+144, gz+32));
+        GOUT(187, _g3_4(gx+8, gy+148, gz+32));
+        GOUT(188, _g3_4(gx+8, gy+144, gz+36));
+        GOUT(189, _g3_4(gx+4, gy+160, gz+24));
+        GOUT(190, _g2_4(gy+164, gz+24));
+        GOUT(191, _g2_4(gy+160, gz+28));
+        GOUT(192, _g3_4(gx+4, gy+152, gz+32));
+        GOUT(193, _g2_4(gy+156, gz+32));
+        GOUT(194, _g2_4(gy+152, gz+36));
+        GOUT(195, _g3_4(gx+4, gy+144, gz+40));
+        GOUT(196, _g2_4(gy+148, gz+40));
+        GOUT(197, _g2_4(gy+144, gz+44));
+        GOUT(198, _g3_4(gx+20, gy+120, gz+48));
+        GOUT(199, _g3_4(gx+16, gy+124, gz+48));
+        GOUT(200, _g3_4(gx+16, gy+120, gz+52));
+        GOUT(201, _g3_4(gx+12, gy+128, gz+48));
+        GOUT(202, _g3_4(gx+8, gy+132, gz+48));
+        GOUT(203, _g3_4(gx+8, gy+128, gz+52));
+        GOUT(204, _g3_4(gx+12, gy+120, gz+56));
+        GOUT(205, _g3_4(gx+8, gy+124, gz+56));
+        GOUT(206, _g3_4(gx+8, gy+120, gz+60));
+        GOUT(207, _g3_4(gx+4, gy+136, gz+48));
+        GOUT(208, _g2_4(gy+140, gz+48));
+        GOUT(209, _g2_4(gy+136, gz+52));
+        GOUT(210, _g3_4(gx+4, gy+128, gz+56));
+        GOUT(211, _g2_4(gy+132, gz+56));
+        GOUT(212, _g2_4(gy+128, gz+60));
+        GOUT(213, _g3_4(gx+4, gy+120, gz+64));
+        GOUT(214, _g2_4(gy+124, gz+64));
+        GOUT(215, _g2_4(gy+120, gz+68));
+        GOUT(216, _g2_4(gx+68, gz+120));
+        GOUT(217, _g3_4(gx+64, gy+4, gz+120));
+        GOUT(218, _g2_4(gx+64, gz+124));
+        GOUT(219, _g3_4(gx+60, gy+8, gz+120));
+        GOUT(220, _g3_4(gx+56, gy+12, gz+120));
+        GOUT(221, _g3_4(gx+56, gy+8, gz+124));
+        GOUT(222, _g2_4(gx+60, gz+128));
+        GOUT(223, _g3_4(gx+56, gy+4, gz+128));
+        GOUT(224, _g2_4(gx+56, gz+132));
+        GOUT(225, _g3_4(gx+52, gy+16, gz+120));
+        GOUT(226, _g3_4(gx+48, gy+20, gz+120));
+        GOUT(227, _g3_4(gx+48, gy+16, gz+124));
+        GOUT(228, _g3_4(gx+52, gy+8, gz+128));
+        GOUT(229, _g3_4(gx+48, gy+12, gz+128));
+        GOUT(230, _g3_4(gx+48, gy+8, gz+132));
+        GOUT(231, _g2_4(gx+52, gz+136));
+        GOUT(232, _g3_4(gx+48, gy+4, gz+136));
+        GOUT(233, _g2_4(gx+48, gz+140));
+        GOUT(234, _g3_4(gx+44, gy+24, gz+120));
+        GOUT(235, _g3_4(gx+40, gy+28, gz+120));
+        GOUT(236, _g3_4(gx+40, gy+24, gz+124));
+        GOUT(237, _g3_4(gx+36, gy+32, gz+120));
+        GOUT(238, _g3_4(gx+32, gy+36, gz+120));
+        GOUT(239, _g3_4(gx+32, gy+32, gz+124));
+        GOUT(240, _g3_4(gx+36, gy+24, gz+128));
+        GOUT(241, _g3_4(gx+32, gy+28, gz+128));
+        GOUT(242, _g3_4(gx+32, gy+24, gz+132));
+        GOUT(243, _g3_4(gx+28, gy+40, gz+120));
+        GOUT(244, _g3_4(gx+24, gy+44, gz+120));
+        GOUT(245, _g3_4(gx+24, gy+40, gz+124));
+        GOUT(246, _g3_4(gx+28, gy+32, gz+128));
+        GOUT(247, _g3_4(gx+24, gy+36, gz+128));
+        GOUT(248, _g3_4(gx+24, gy+32, gz+132));
+        GOUT(249, _g3_4(gx+28, gy+24, gz+136));
+        GOUT(250, _g3_4(gx+24, gy+28, gz+136));
+        GOUT(251, _g3_4(gx+24, gy+24, gz+140));
+        GOUT(252, _g2_4(gx+44, gz+144));
+        GOUT(253, _g3_4(gx+40, gy+4, gz+144));
+        GOUT(254, _g2_4(gx+40, gz+148));
+        GOUT(255, _g3_4(gx+36, gy+8, gz+144));
+        GOUT(256, _g3_4(gx+32, gy+12, gz+144));
+        GOUT(257, _g3_4(gx+32, gy+8, gz+148));
+        GOUT(258, _g2_4(gx+36, gz+152));
+        GOUT(259, _g3_4(gx+32, gy+4, gz+152));
+        GOUT(260, _g2_4(gx+32, gz+156));
+        GOUT(261, _g3_4(gx+28, gy+16, gz+144));
+        GOUT(262, _g3_4(gx+24, gy+20, gz+144));
+        GOUT(263, _g3_4(gx+24, gy+16, gz+148));
+        GOUT(264, _g3_4(gx+28, gy+8, gz+152));
+        GOUT(265, _g3_4(gx+24, gy+12, gz+152));
+        GOUT(266, _g3_4(gx+24, gy+8, gz+156));
+        GOUT(267, _g2_4(gx+28, gz+160));
+        GOUT(268, _g3_4(gx+24, gy+4, gz+160));
+        GOUT(269, _g2_4(gx+24, gz+164));
+        GOUT(270, _g3_4(gx+20, gy+48, gz+120));
+        GOUT(271, _g3_4(gx+16, gy+52, gz+120));
+        GOUT(272, _g3_4(gx+16, gy+48, gz+124));
+        GOUT(273, _g3_4(gx+12, gy+56, gz+120));
+        GOUT(274, _g3_4(gx+8, gy+60, gz+120));
+        GOUT(275, _g3_4(gx+8, gy+56, gz+124));
+        GOUT(276, _g3_4(gx+12, gy+48, gz+128));
+        GOUT(277, _g3_4(gx+8, gy+52, gz+128));
+        GOUT(278, _g3_4(gx+8, gy+48, gz+132));
+        GOUT(279, _g3_4(gx+4, gy+64, gz+120));
+        GOUT(280, _g2_4(gy+68, gz+120));
+        GOUT(281, _g2_4(gy+64, gz+124));
+        GOUT(282, _g3_4(gx+4, gy+56, gz+128));
+        GOUT(283, _g2_4(gy+60, gz+128));
+        GOUT(284, _g2_4(gy+56, gz+132));
+        GOUT(285, _g3_4(gx+4, gy+48, gz+136));
+        GOUT(286, _g2_4(gy+52, gz+136));
+        GOUT(287, _g2_4(gy+48, gz+140));
+        GOUT(288, _g3_4(gx+20, gy+24, gz+144));
+        GOUT(289, _g3_4(gx+16, gy+28, gz+144));
+        GOUT(290, _g3_4(gx+16, gy+24, gz+148));
+        GOUT(291, _g3_4(gx+12, gy+32, gz+144));
+        GOUT(292, _g3_4(gx+8, gy+36, gz+144));
+        GOUT(293, _g3_4(gx+8, gy+32, gz+148));
+        GOUT(294, _g3_4(gx+12, gy+24, gz+152));
+        GOUT(295, _g3_4(gx+8, gy+28, gz+152));
+        GOUT(296, _g3_4(gx+8, gy+24, gz+156));
+        GOUT(297, _g3_4(gx+4, gy+40, gz+144));
+        GOUT(298, _g2_4(gy+44, gz+144));
+        GOUT(299, _g2_4(gy+40, gz+148));
+        GOUT(300, _g3_4(gx+4, gy+32, gz+152));
+        GOUT(301, _g2_4(gy+36, gz+152));
+        GOUT(302, _g2_4(gy+32, gz+156));
+        GOUT(303, _g3_4(gx+4, gy+24, gz+160));
+        GOUT(304, _g2_4(gy+28, gz+160));
+        GOUT(305, _g2_4(gy+24, gz+164));
+        GOUT(306, _g2_4(gx+20, gz+168));
+        GOUT(307, _g3_4(gx+16, gy+4, gz+168));
+        GOUT(308, _g2_4(gx+16, gz+172));
+        GOUT(309, _g3_4(gx+12, gy+8, gz+168));
+        GOUT(310, _g3_4(gx+8, gy+12, gz+168));
+        GOUT(311, _g3_4(gx+8, gy+8, gz+172));
+        GOUT(312, _g2_4(gx+12, gz+176));
+        GOUT(313, _g3_4(gx+8, gy+4, gz+176));
+        GOUT(314, _g2_4(gx+8, gz+180));
+        GOUT(315, _g3_4(gx+4, gy+16, gz+168));
+        GOUT(316, _g2_4(gy+20, gz+168));
+        GOUT(317, _g2_4(gy+16, gz+172));
+        GOUT(318, _g3_4(gx+4, gy+8, gz+176));
+        GOUT(319, _g2_4(gy+12, gz+176));
+        GOUT(320, _g2_4(gy+8, gz+180));
+        GOUT(321, _g2_4(gx+4, gz+184));
+        GOUT(322, _g2_4(gy+4, gz+184));
+        GOUT(323, _g1_4(gz+188));
+}
+
+static void _gout_1200(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 16;
+        double *gz = g + 32;
+        GOUT(0, _g2_2(gx+10, gz+0));
+        GOUT(1, _g3_2(gx+8, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+8, gz+2));
+        GOUT(3, _g3_2(gx+6, gy+4, gz+0));
+        GOUT(4, _g3_2(gx+4, gy+6, gz+0));
+        GOUT(5, _g3_2(gx+4, gy+4, gz+2));
+        GOUT(6, _g2_2(gx+6, gz+4));
+        GOUT(7, _g3_2(gx+4, gy+2, gz+4));
+        GOUT(8, _g2_2(gx+4, gz+6));
+        GOUT(9, _g3_2(gx+2, gy+8, gz+0));
+        GOUT(10, _g2_2(gy+10, gz+0));
+        GOUT(11, _g2_2(gy+8, gz+2));
+        GOUT(12, _g3_2(gx+2, gy+4, gz+4));
+        GOUT(13, _g2_2(gy+6, gz+4));
+        GOUT(14, _g2_2(gy+4, gz+6));
+        GOUT(15, _g2_2(gx+2, gz+8));
+        GOUT(16, _g2_2(gy+2, gz+8));
+        GOUT(17, _g1_2(gz+10));
+}
+
+static void _g0_2d4d_1201(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 48;
+        double *gz = g + 96;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+12] = c00x;
+                gx[n+3] = rx + gx[n+12];
+                gx[n+6] = c0px;
+                gx[n+18] = c00x * gx[n+6] + b00;
+                gx[n+9] = rx * gx[n+6] + gx[n+18];
+                gx[n+24] = c00x * gx[n+12] + b10;
+                gx[n+15] = rx * gx[n+12] + gx[n+24];
+                gx[n+30] = c00x * gx[n+18] + b10 * gx[n+6] + b00 * gx[n+12];
+                gx[n+21] = rx * gx[n+18] + gx[n+30];
+                gx[n+36] = c00x * gx[n+24] + 2 * b10 * gx[n+12];
+                gx[n+27] = rx * gx[n+24] + gx[n+36];
+                gx[n+42] = c00x * gx[n+30] + 2 * b10 * gx[n+18] + b00 * gx[n+24];
+                gx[n+33] = rx * gx[n+30] + gx[n+42];
+                gy[n+12] = c00y;
+                gy[n+3] = ry + gy[n+12];
+                gy[n+6] = c0py;
+                gy[n+18] = c00y * gy[n+6] + b00;
+                gy[n+9] = ry * gy[n+6] + gy[n+18];
+                gy[n+24] = c00y * gy[n+12] + b10;
+                gy[n+15] = ry * gy[n+12] + gy[n+24];
+                gy[n+30] = c00y * gy[n+18] + b10 * gy[n+6] + b00 * gy[n+12];
+                gy[n+21] = ry * gy[n+18] + gy[n+30];
+                gy[n+36] = c00y * gy[n+24] + 2 * b10 * gy[n+12];
+                gy[n+27] = ry * gy[n+24] + gy[n+36];
+                gy[n+42] = c00y * gy[n+30] + 2 * b10 * gy[n+18] + b00 * gy[n+24];
+                gy[n+33] = ry * gy[n+30] + gy[n+42];
+                gz[n+12] = c00z * gz[n+0];
+                gz[n+3] = rz * gz[n+0] + gz[n+12];
+                gz[n+6] = c0pz * gz[n+0];
+                gz[n+18] = c00z * gz[n+6] + b00 * gz[n+0];
+                gz[n+9] = rz * gz[n+6] + gz[n+18];
+                gz[n+24] = c00z * gz[n+12] + b10 * gz[n+0];
+                gz[n+15] = rz * gz[n+12] + gz[n+24];
+                gz[n+30] = c00z * gz[n+18] + b10 * gz[n+6] + b00 * gz[n+12];
+                gz[n+21] = rz * gz[n+18] + gz[n+30];
+                gz[n+36] = c00z * gz[n+24] + 2 * b10 * gz[n+12];
+                gz[n+27] = rz * gz[n+24] + gz[n+36];
+                gz[n+42] = c00z * gz[n+30] + 2 * b10 * gz[n+18] + b00 * gz[n+24];
+                gz[n+33] = rz * gz[n+30] + gz[n+42];
+        }
+}
+static void _gout_1201(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 48;
+        double *gz = g + 96;
+        GOUT(0, _g2_3(gx+33, gz+0));
+        GOUT(1, _g3_3(gx+30, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+30, gz+3));
+        GOUT(3, _g3_3(gx+27, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+24, gy+9, gz+0));
+        GOUT(5, _g3_3(gx+24, gy+6, gz+3));
+        GOUT(6, _g2_3(gx+27, gz+6));
+        GOUT(7, _g3_3(gx+24, gy+3, gz+6));
+        GOUT(8, _g2_3(gx+24, gz+9));
+        GOUT(9, _g3_3(gx+21, gy+12, gz+0));
+        GOUT(10, _g3_3(gx+18, gy+15, gz+0));
+        GOUT(11, _g3_3(gx+18, gy+12, gz+3));
+        GOUT(12, _g3_3(gx+15, gy+18, gz+0));
+        GOUT(13, _g3_3(gx+12, gy+21, gz+0));
+        GOUT(14, _g3_3(gx+12, gy+18, gz+3));
+        GOUT(15, _g3_3(gx+15, gy+12, gz+6));
+        GOUT(16, _g3_3(gx+12, gy+15, gz+6));
+        GOUT(17, _g3_3(gx+12, gy+12, gz+9));
+        GOUT(18, _g2_3(gx+21, gz+12));
+        GOUT(19, _g3_3(gx+18, gy+3, gz+12));
+        GOUT(20, _g2_3(gx+18, gz+15));
+        GOUT(21, _g3_3(gx+15, gy+6, gz+12));
+        GOUT(22, _g3_3(gx+12, gy+9, gz+12));
+        GOUT(23, _g3_3(gx+12, gy+6, gz+15));
+        GOUT(24, _g2_3(gx+15, gz+18));
+        GOUT(25, _g3_3(gx+12, gy+3, gz+18));
+        GOUT(26, _g2_3(gx+12, gz+21));
+        GOUT(27, _g3_3(gx+9, gy+24, gz+0));
+        GOUT(28, _g3_3(gx+6, gy+27, gz+0));
+        GOUT(29, _g3_3(gx+6, gy+24, gz+3));
+        GOUT(30, _g3_3(gx+3, gy+30, gz+0));
+        GOUT(31, _g2_3(gy+33, gz+0));
+        GOUT(32, _g2_3(gy+30, gz+3));
+        GOUT(33, _g3_3(gx+3, gy+24, gz+6));
+        GOUT(34, _g2_3(gy+27, gz+6));
+        GOUT(35, _g2_3(gy+24, gz+9));
+        GOUT(36, _g3_3(gx+9, gy+12, gz+12));
+        GOUT(37, _g3_3(gx+6, gy+15, gz+12));
+        GOUT(38, _g3_3(gx+6, gy+12, gz+15));
+        GOUT(39, _g3_3(gx+3, gy+18, gz+12));
+        GOUT(40, _g2_3(gy+21, gz+12));
+        GOUT(41, _g2_3(gy+18, gz+15));
+        GOUT(42, _g3_3(gx+3, gy+12, gz+18));
+        GOUT(43, _g2_3(gy+15, gz+18));
+        GOUT(44, _g2_3(gy+12, gz+21));
+        GOUT(45, _g2_3(gx+9, gz+24));
+        GOUT(46, _g3_3(gx+6, gy+3, gz+24));
+        GOUT(47, _g2_3(gx+6, gz+27));
+        GOUT(48, _g3_3(gx+3, gy+6, gz+24));
+        GOUT(49, _g2_3(gy+9, gz+24));
+        GOUT(50, _g2_3(gy+6, gz+27));
+        GOUT(51, _g2_3(gx+3, gz+30));
+        GOUT(52, _g2_3(gy+3, gz+30));
+        GOUT(53, _g1_3(gz+33));
+}
+
+static void _g0_2d4d_1202(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 72;
+        double *gz = g + 144;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+18] = c00x;
+                gx[n+3] = rx + gx[n+18];
+                gx[n+6] = c0px;
+                gx[n+24] = c00x * gx[n+6] + b00;
+                gx[n+9] = rx * gx[n+6] + gx[n+24];
+                gx[n+12] = c0px * gx[n+6] + b01;
+                gx[n+30] = c00x * gx[n+12] + 2 * b00 * gx[n+6];
+                gx[n+15] = rx * gx[n+12] + gx[n+30];
+                gx[n+36] = c00x * gx[n+18] + b10;
+                gx[n+21] = rx * gx[n+18] + gx[n+36];
+                gx[n+42] = c00x * gx[n+24] + b10 * gx[n+6] + b00 * gx[n+18];
+                gx[n+27] = rx * gx[n+24] + gx[n+42];
+                gx[n+48] = c00x * gx[n+30] + b10 * gx[n+12] + 2 * b00 * gx[n+24];
+                gx[n+33] = rx * gx[n+30] + gx[n+48];
+                gx[n+54] = c00x * gx[n+36] + 2 * b10 * gx[n+18];
+                gx[n+39] = rx * gx[n+36] + gx[n+54];
+                gx[n+60] = c00x * gx[n+42] + 2 * b10 * gx[n+24] + b00 * gx[n+36];
+                gx[n+45] = rx * gx[n+42] + gx[n+60];
+                gx[n+66] = c00x * gx[n+48] + 2 * b10 * gx[n+30] + 2 * b00 * gx[n+42];
+                gx[n+51] = rx * gx[n+48] + gx[n+66];
+                gy[n+18] = c00y;
+                gy[n+3] = ry + gy[n+18];
+                gy[n+6] = c0py;
+                gy[n+24] = c00y * gy[n+6] + b00;
+                gy[n+9] = ry * gy[n+6] + gy[n+24];
+                gy[n+12] = c0py * gy[n+6] + b01;
+                gy[n+30] = c00y * gy[n+12] + 2 * b00 * gy[n+6];
+                gy[n+15] = ry * gy[n+12] + gy[n+30];
+                gy[n+36] = c00y * gy[n+18] + b10;
+                gy[n+21] = ry * gy[n+18] + gy[n+36];
+                gy[n+42] = c00y * gy[n+24] + b10 * gy[n+6] + b00 * gy[n+18];
+                gy[n+27] = ry * gy[n+24] + gy[n+42];
+                gy[n+48] = c00y * gy[n+30] + b10 * gy[n+12] + 2 * b00 * gy[n+24];
+                gy[n+33] = ry * gy[n+30] + gy[n+48];
+                gy[n+54] = c00y * gy[n+36] + 2 * b10 * gy[n+18];
+                gy[n+39] = ry * gy[n+36] + gy[n+54];
+                gy[n+60] = c00y * gy[n+42] + 2 * b10 * gy[n+24] + b00 * gy[n+36];
+                gy[n+45] = ry * gy[n+42] + gy[n+60];
+                gy[n+66] = c00y * gy[n+48] + 2 * b10 * gy[n+30] + 2 * b00 * gy[n+42];
+                gy[n+51] = ry * gy[n+48] + gy[n+66];
+                gz[n+18] = c00z * gz[n+0];
+                gz[n+3] = rz * gz[n+0] + gz[n+18];
+                gz[n+6] = c0pz * gz[n+0];
+                gz[n+24] = c00z * gz[n+6] + b00 * gz[n+0];
+                gz[n+9] = rz * gz[n+6] + gz[n+24];
+                gz[n+12] = c0pz * gz[n+6] + b01 * gz[n+0];
+                gz[n+30] = c00z * gz[n+12] + 2 * b00 * gz[n+6];
+                gz[n+15] = rz * gz[n+12] + gz[n+30];
+                gz[n+36] = c00z * gz[n+18] + b10 * gz[n+0];
+                gz[n+21] = rz * gz[n+18] + gz[n+36];
+                gz[n+42] = c00z * gz[n+24] + b10 * gz[n+6] + b00 * gz[n+18];
+                gz[n+27] = rz * gz[n+24] + gz[n+42];
+                gz[n+48] = c00z * gz[n+30] + b10 * gz[n+12] + 2 * b00 * gz[n+24];
+                gz[n+33] = rz * gz[n+30] + gz[n+48];
+                gz[n+54] = c00z * gz[n+36] + 2 * b10 * gz[n+18];
+                gz[n+39] = rz * gz[n+36] + gz[n+54];
+                gz[n+60] = c00z * gz[n+42] + 2 * b10 * gz[n+24] + b00 * gz[n+36];
+                gz[n+45] = rz * gz[n+42] + gz[n+60];
+                gz[n+66] = c00z * gz[n+48] + 2 * b10 * gz[n+30] + 2 * b00 * gz[n+42];
+                gz[n+51] = rz * gz[n+48] + gz[n+66];
+        }
+}
+static void _gout_1202(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 72;
+        double *gz = g + 144;
+        GOUT(0, _g2_3(gx+51, gz+0));
+        GOUT(1, _g3_3(gx+48, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+48, gz+3));
+        GOUT(3, _g3_3(gx+45, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+42, gy+9, gz+0));
+        GOUT(5, _g3_3(gx+42, gy+6, gz+3));
+        GOUT(6, _g2_3(gx+45, gz+6));
+        GOUT(7, _g3_3(gx+42, gy+3, gz+6));
+        GOUT(8, _g2_3(gx+42, gz+9));
+        GOUT(9, _g3_3(gx+39, gy+12, gz+0));
+        GOUT(10, _g3_3(gx+36, gy+15, gz+0));
+        GOUT(11, _g3_3(gx+36, gy+12, gz+3));
+        GOUT(12, _g3_3(gx+39, gy+6, gz+6));
+        GOUT(13, _g3_3(gx+36, gy+9, gz+6));
+        GOUT(14, _g3_3(gx+36, gy+6, gz+9));
+        GOUT(15, _g2_3(gx+39, gz+12));
+        GOUT(16, _g3_3(gx+36, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+36, gz+15));
+        GOUT(18, _g3_3(gx+33, gy+18, gz+0));
+        GOUT(19, _g3_3(gx+30, gy+21, gz+0));
+        GOUT(20, _g3_3(gx+30, gy+18, gz+3));
+        GOUT(21, _g3_3(gx+27, gy+24, gz+0));
+        GOUT(22, _g3_3(gx+24, gy+27, gz+0));
+        GOUT(23, _g3_3(gx+24, gy+24, gz+3));
+        GOUT(24, _g3_3(gx+27, gy+18, gz+6));
+        GOUT(25, _g3_3(gx+24, gy+21, gz+6));
+        GOUT(26, _g3_3(gx+24, gy+18, gz+9));
+        GOUT(27, _g3_3(gx+21, gy+30, gz+0));
+        GOUT(28, _g3_3(gx+18, gy+33, gz+0));
+        GOUT(29, _g3_3(gx+18, gy+30, gz+3));
+        GOUT(30, _g3_3(gx+21, gy+24, gz+6));
+        GOUT(31, _g3_3(gx+18, gy+27, gz+6));
+        GOUT(32, _g3_3(gx+18, gy+24, gz+9));
+        GOUT(33, _g3_3(gx+21, gy+18, gz+12));
+        GOUT(34, _g3_3(gx+18, gy+21, gz+12));
+        GOUT(35, _g3_3(gx+18, gy+18, gz+15));
+        GOUT(36, _g2_3(gx+33, gz+18));
+        GOUT(37, _g3_3(gx+30, gy+3, gz+18));
+        GOUT(38, _g2_3(gx+30, gz+21));
+        GOUT(39, _g3_3(gx+27, gy+6, gz+18));
+        GOUT(40, _g3_3(gx+24, gy+9, gz+18));
+        GOUT(41, _g3_3(gx+24, gy+6, gz+21));
+        GOUT(42, _g2_3(gx+27, gz+24));
+        GOUT(43, _g3_3(gx+24, gy+3, gz+24));
+        GOUT(44, _g2_3(gx+24, gz+27));
+        GOUT(45, _g3_3(gx+21, gy+12, gz+18));
+        GOUT(46, _g3_3(gx+18, gy+15, gz+18));
+        GOUT(47, _g3_3(gx+18, gy+12, gz+21));
+        GOUT(48, _g3_3(gx+21, gy+6, gz+24));
+        GOUT(49, _g3_3(gx+18, gy+9, gz+24));
+        GOUT(50, _g3_3(gx+18, gy+6, gz+27));
+        GOUT(51, _g2_3(gx+21, gz+30));
+        GOUT(52, _g3_3(gx+18, gy+3, gz+30));
+        GOUT(53, _g2_3(gx+18, gz+33));
+        GOUT(54, _g3_3(gx+15, gy+36, gz+0));
+        GOUT(55, _g3_3(gx+12, gy+39, gz+0));
+        GOUT(56, _g3_3(gx+12, gy+36, gz+3));
+        GOUT(57, _g3_3(gx+9, gy+42, gz+0));
+        GOUT(58, _g3_3(gx+6, gy+45, gz+0));
+        GOUT(59, _g3_3(gx+6, gy+42, gz+3));
+        GOUT(60, _g3_3(gx+9, gy+36, gz+6));
+        GOUT(61, _g3_3(gx+6, gy+39, gz+6));
+        GOUT(62, _g3_3(gx+6, gy+36, gz+9));
+        GOUT(63, _g3_3(gx+3, gy+48, gz+0));
+        GOUT(64, _g2_3(gy+51, gz+0));
+        GOUT(65, _g2_3(gy+48, gz+3));
+        GOUT(66, _g3_3(gx+3, gy+42, gz+6));
+        GOUT(67, _g2_3(gy+45, gz+6));
+        GOUT(68, _g2_3(gy+42, gz+9));
+        GOUT(69, _g3_3(gx+3, gy+36, gz+12));
+        GOUT(70, _g2_3(gy+39, gz+12));
+        GOUT(71, _g2_3(gy+36, gz+15));
+        GOUT(72, _g3_3(gx+15, gy+18, gz+18));
+        GOUT(73, _g3_3(gx+12, gy+21, gz+18));
+        GOUT(74, _g3_3(gx+12, gy+18, gz+21));
+        GOUT(75, _g3_3(gx+9, gy+24, gz+18));
+        GOUT(76, _g3_3(gx+6, gy+27, gz+18));
+        GOUT(77, _g3_3(gx+6, gy+24, gz+21));
+        GOUT(78, _g3_3(gx+9, gy+18, gz+24));
+        GOUT(79, _g3_3(gx+6, gy+21, gz+24));
+        GOUT(80, _g3_3(gx+6, gy+18, gz+27));
+        GOUT(81, _g3_3(gx+3, gy+30, gz+18));
+        GOUT(82, _g2_3(gy+33, gz+18));
+        GOUT(83, _g2_3(gy+30, gz+21));
+        GOUT(84, _g3_3(gx+3, gy+24, gz+24));
+        GOUT(85, _g2_3(gy+27, gz+24));
+        GOUT(86, _g2_3(gy+24, gz+27));
+        GOUT(87, _g3_3(gx+3, gy+18, gz+30));
+        GOUT(88, _g2_3(gy+21, gz+30));
+        GOUT(89, _g2_3(gy+18, gz+33));
+        GOUT(90, _g2_3(gx+15, gz+36));
+        GOUT(91, _g3_3(gx+12, gy+3, gz+36));
+        GOUT(92, _g2_3(gx+12, gz+39));
+        GOUT(93, _g3_3(gx+9, gy+6, gz+36));
+        GOUT(94, _g3_3(gx+6, gy+9, gz+36));
+        GOUT(95, _g3_3(gx+6, gy+6, gz+39));
+        GOUT(96, _g2_3(gx+9, gz+42));
+        GOUT(97, _g3_3(gx+6, gy+3, gz+42));
+        GOUT(98, _g2_3(gx+6, gz+45));
+        GOUT(99, _g3_3(gx+3, gy+12, gz+36));
+        GOUT(100, _g2_3(gy+15, gz+36));
+        GOUT(101, _g2_3(gy+12, gz+39));
+        GOUT(102, _g3_3(gx+3, gy+6, gz+42));
+        GOUT(103, _g2_3(gy+9, gz+42));
+        GOUT(104, _g2_3(gy+6, gz+45));
+        GOUT(105, _g2_3(gx+3, gz+48));
+        GOUT(106, _g2_3(gy+3, gz+48));
+        GOUT(107, _g1_3(gz+51));
+}
+
+static void _g0_2d4d_1210(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 48;
+        double *gz = g + 96;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+12] = c00x;
+                gx[n+3] = rx + gx[n+12];
+                gx[n+6] = c0px;
+                gx[n+18] = c00x * gx[n+6] + b00;
+                gx[n+9] = rx * gx[n+6] + gx[n+18];
+                gx[n+24] = c00x * gx[n+12] + b10;
+                gx[n+15] = rx * gx[n+12] + gx[n+24];
+                gx[n+30] = c00x * gx[n+18] + b10 * gx[n+6] + b00 * gx[n+12];
+                gx[n+21] = rx * gx[n+18] + gx[n+30];
+                gx[n+36] = c00x * gx[n+24] + 2 * b10 * gx[n+12];
+                gx[n+27] = rx * gx[n+24] + gx[n+36];
+                gx[n+42] = c00x * gx[n+30] + 2 * b10 * gx[n+18] + b00 * gx[n+24];
+                gx[n+33] = rx * gx[n+30] + gx[n+42];
+                gy[n+12] = c00y;
+                gy[n+3] = ry + gy[n+12];
+                gy[n+6] = c0py;
+                gy[n+18] = c00y * gy[n+6] + b00;
+                gy[n+9] = ry * gy[n+6] + gy[n+18];
+                gy[n+24] = c00y * gy[n+12] + b10;
+                gy[n+15] = ry * gy[n+12] + gy[n+24];
+                gy[n+30] = c00y * gy[n+18] + b10 * gy[n+6] + b00 * gy[n+12];
+                gy[n+21] = ry * gy[n+18] + gy[n+30];
+                gy[n+36] = c00y * gy[n+24] + 2 * b10 * gy[n+12];
+                gy[n+27] = ry * gy[n+24] + gy[n+36];
+                gy[n+42] = c00y * gy[n+30] + 2 * b10 * gy[n+18] + b00 * gy[n+24];
+                gy[n+33] = ry * gy[n+30] + gy[n+42];
+                gz[n+12] = c00z * gz[n+0];
+                gz[n+3] = rz * gz[n+0] + gz[n+12];
+                gz[n+6] = c0pz * gz[n+0];
+                gz[n+18] = c00z * gz[n+6] + b00 * gz[n+0];
+                gz[n+9] = rz * gz[n+6] + gz[n+18];
+                gz[n+24] = c00z * gz[n+12] + b10 * gz[n+0];
+                gz[n+15] = rz * gz[n+12] + gz[n+24];
+                gz[n+30] = c00z * gz[n+18] + b10 * gz[n+6] + b00 * gz[n+12];
+                gz[n+21] = rz * gz[n+18] + gz[n+30];
+                gz[n+36] = c00z * gz[n+24] + 2 * b10 * gz[n+12];
+                gz[n+27] = rz * gz[n+24] + gz[n+36];
+                gz[n+42] = c00z * gz[n+30] + 2 * b10 * gz[n+18] + b00 * gz[n+24];
+                gz[n+33] = rz * gz[n+30] + gz[n+42];
+        }
+}
+static void _gout_1210(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 48;
+        double *gz = g + 96;
+        GOUT(0, _g2_3(gx+33, gz+0));
+        GOUT(1, _g3_3(gx+30, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+30, gz+3));
+        GOUT(3, _g3_3(gx+27, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+24, gy+9, gz+0));
+        GOUT(5, _g3_3(gx+24, gy+6, gz+3));
+        GOUT(6, _g2_3(gx+27, gz+6));
+        GOUT(7, _g3_3(gx+24, gy+3, gz+6));
+        GOUT(8, _g2_3(gx+24, gz+9));
+        GOUT(9, _g3_3(gx+21, gy+12, gz+0));
+        GOUT(10, _g3_3(gx+18, gy+15, gz+0));
+        GOUT(11, _g3_3(gx+18, gy+12, gz+3));
+        GOUT(12, _g3_3(gx+15, gy+18, gz+0));
+        GOUT(13, _g3_3(gx+12, gy+21, gz+0));
+        GOUT(14, _g3_3(gx+12, gy+18, gz+3));
+        GOUT(15, _g3_3(gx+15, gy+12, gz+6));
+        GOUT(16, _g3_3(gx+12, gy+15, gz+6));
+        GOUT(17, _g3_3(gx+12, gy+12, gz+9));
+        GOUT(18, _g2_3(gx+21, gz+12));
+        GOUT(19, _g3_3(gx+18, gy+3, gz+12));
+        GOUT(20, _g2_3(gx+18, gz+15));
+        GOUT(21, _g3_3(gx+15, gy+6, gz+12));
+        GOUT(22, _g3_3(gx+12, gy+9, gz+12));
+        GOUT(23, _g3_3(gx+12, gy+6, gz+15));
+        GOUT(24, _g2_3(gx+15, gz+18));
+        GOUT(25, _g3_3(gx+12, gy+3, gz+18));
+        GOUT(26, _g2_3(gx+12, gz+21));
+        GOUT(27, _g3_3(gx+9, gy+24, gz+0));
+        GOUT(28, _g3_3(gx+6, gy+27, gz+0));
+        GOUT(29, _g3_3(gx+6, gy+24, gz+3));
+        GOUT(30, _g3_3(gx+3, gy+30, gz+0));
+        GOUT(31, _g2_3(gy+33, gz+0));
+        GOUT(32, _g2_3(gy+30, gz+3));
+        GOUT(33, _g3_3(gx+3, gy+24, gz+6));
+        GOUT(34, _g2_3(gy+27, gz+6));
+        GOUT(35, _g2_3(gy+24, gz+9));
+        GOUT(36, _g3_3(gx+9, gy+12, gz+12));
+        GOUT(37, _g3_3(gx+6, gy+15, gz+12));
+        GOUT(38, _g3_3(gx+6, gy+12, gz+15));
+        GOUT(39, _g3_3(gx+3, gy+18, gz+12));
+        GOUT(40, _g2_3(gy+21, gz+12));
+        GOUT(41, _g2_3(gy+18, gz+15));
+        GOUT(42, _g3_3(gx+3, gy+12, gz+18));
+        GOUT(43, _g2_3(gy+15, gz+18));
+        GOUT(44, _g2_3(gy+12, gz+21));
+        GOUT(45, _g2_3(gx+9, gz+24));
+        GOUT(46, _g3_3(gx+6, gy+3, gz+24));
+        GOUT(47, _g2_3(gx+6, gz+27));
+        GOUT(48, _g3_3(gx+3, gy+6, gz+24));
+        GOUT(49, _g2_3(gy+9, gz+24));
+        GOUT(50, _g2_3(gy+6, gz+27));
+        GOUT(51, _g2_3(gx+3, gz+30));
+        GOUT(52, _g2_3(gy+3, gz+30));
+        GOUT(53, _g1_3(gz+33));
+}
+
+static void _g0_2d4d_1211(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 144;
+        double *gz = g + 288;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+36] = c00x;
+                gx[n+3] = rx + gx[n+36];
+                gx[n+12] = c0px;
+                gx[n+6] = sx + gx[n+12];
+                gx[n+48] = c00x * gx[n+12] + b00;
+                gx[n+42] = sx * gx[n+36] + gx[n+48];
+                gx[n+9] = rx * gx[n+6] + gx[n+42];
+                gx[n+15] = rx * gx[n+12] + gx[n+48];
+                gx[n+24] = c0px * gx[n+12] + b01;
+                gx[n+18] = sx * gx[n+12] + gx[n+24];
+                gx[n+60] = c00x * gx[n+24] + 2 * b00 * gx[n+12];
+                gx[n+54] = sx * gx[n+48] + gx[n+60];
+                gx[n+21] = rx * gx[n+18] + gx[n+54];
+                gx[n+72] = c00x * gx[n+36] + b10;
+                gx[n+39] = rx * gx[n+36] + gx[n+72];
+                gx[n+84] = c00x * gx[n+48] + b10 * gx[n+12] + b00 * gx[n+36];
+                gx[n+78] = sx * gx[n+72] + gx[n+84];
+                gx[n+45] = rx * gx[n+42] + gx[n+78];
+                gx[n+51] = rx * gx[n+48] + gx[n+84];
+                gx[n+96] = c00x * gx[n+60] + b10 * gx[n+24] + 2 * b00 * gx[n+48];
+                gx[n+90] = sx * gx[n+84] + gx[n+96];
+                gx[n+57] = rx * gx[n+54] + gx[n+90];
+                gx[n+108] = c00x * gx[n+72] + 2 * b10 * gx[n+36];
+                gx[n+75] = rx * gx[n+72] + gx[n+108];
+                gx[n+120] = c00x * gx[n+84] + 2 * b10 * gx[n+48] + b00 * gx[n+72];
+                gx[n+114] = sx * gx[n+108] + gx[n+120];
+                gx[n+81] = rx * gx[n+78] + gx[n+114];
+                gx[n+87] = rx * gx[n+84] + gx[n+120];
+                gx[n+132] = c00x * gx[n+96] + 2 * b10 * gx[n+60] + 2 * b00 * gx[n+84];
+                gx[n+126] = sx * gx[n+120] + gx[n+132];
+                gx[n+93] = rx * gx[n+90] + gx[n+126];
+                gy[n+36] = c00y;
+                gy[n+3] = ry + gy[n+36];
+                gy[n+12] = c0py;
+                gy[n+6] = sy + gy[n+12];
+                gy[n+48] = c00y * gy[n+12] + b00;
+                gy[n+42] = sy * gy[n+36] + gy[n+48];
+                gy[n+9] = ry * gy[n+6] + gy[n+42];
+                gy[n+15] = ry * gy[n+12] + gy[n+48];
+                gy[n+24] = c0py * gy[n+12] + b01;
+                gy[n+18] = sy * gy[n+12] + gy[n+24];
+                gy[n+60] = c00y * gy[n+24] + 2 * b00 * gy[n+12];
+                gy[n+54] = sy * gy[n+48] + gy[n+60];
+                gy[n+21] = ry * gy[n+18] + gy[n+54];
+                gy[n+72] = c00y * gy[n+36] + b10;
+                gy[n+39] = ry * gy[n+36] + gy[n+72];
+                gy[n+84] = c00y * gy[n+48] + b10 * gy[n+12] + b00 * gy[n+36];
+                gy[n+78] = sy * gy[n+72] + gy[n+84];
+                gy[n+45] = ry * gy[n+42] + gy[n+78];
+                gy[n+51] = ry * gy[n+48] + gy[n+84];
+                gy[n+96] = c00y * gy[n+60] + b10 * gy[n+24] + 2 * b00 * gy[n+48];
+                gy[n+90] = sy * gy[n+84] + gy[n+96];
+                gy[n+57] = ry * gy[n+54] + gy[n+90];
+                gy[n+108] = c00y * gy[n+72] + 2 * b10 * gy[n+36];
+                gy[n+75] = ry * gy[n+72] + gy[n+108];
+                gy[n+120] = c00y * gy[n+84] + 2 * b10 * gy[n+48] + b00 * gy[n+72];
+                gy[n+114] = sy * gy[n+108] + gy[n+120];
+                gy[n+81] = ry * gy[n+78] + gy[n+114];
+                gy[n+87] = ry * gy[n+84] + gy[n+120];
+                gy[n+132] = c00y * gy[n+96] + 2 * b10 * gy[n+60] + 2 * b00 * gy[n+84];
+                gy[n+126] = sy * gy[n+120] + gy[n+132];
+                gy[n+93] = ry * gy[n+90] + gy[n+126];
+                gz[n+36] = c00z * gz[n+0];
+                gz[n+3] = rz * gz[n+0] + gz[n+36];
+                gz[n+12] = c0pz * gz[n+0];
+                gz[n+6] = sz * gz[n+0] + gz[n+12];
+                gz[n+48] = c00z * gz[n+12] + b00 * gz[n+0];
+                gz[n+42] = sz * gz[n+36] + gz[n+48];
+                gz[n+9] = rz * gz[n+6] + gz[n+42];
+                gz[n+15] = rz * gz[n+12] + gz[n+48];
+                gz[n+24] = c0pz * gz[n+12] + b01 * gz[n+0];
+                gz[n+18] = sz * gz[n+12] + gz[n+24];
+                gz[n+60] = c00z * gz[n+24] + 2 * b00 * gz[n+12];
+                gz[n+54] = sz * gz[n+48] + gz[n+60];
+                gz[n+21] = rz * gz[n+18] + gz[n+54];
+                gz[n+72] = c00z * gz[n+36] + b10 * gz[n+0];
+                gz[n+39] = rz * gz[n+36] + gz[n+72];
+                gz[n+84] = c00z * gz[n+48] + b10 * gz[n+12] + b00 * gz[n+36];
+                gz[n+78] = sz * gz[n+72] + gz[n+84];
+                gz[n+45] = rz * gz[n+42] + gz[n+78];
+                gz[n+51] = rz * gz[n+48] + gz[n+84];
+                gz[n+96] = c00z * gz[n+60] + b10 * gz[n+24] + 2 * b00 * gz[n+48];
+                gz[n+90] = sz * gz[n+84] + gz[n+96];
+                gz[n+57] = rz * gz[n+54] + gz[n+90];
+                gz[n+108] = c00z * gz[n+72] + 2 * b10 * gz[n+36];
+                gz[n+75] = rz * gz[n+72] + gz[n+108];
+                gz[n+120] = c00z * gz[n+84] + 2 * b10 * gz[n+48] + b00 * gz[n+72];
+                gz[n+114] = sz * gz[n+108] + gz[n+120];
+                gz[n+81] = rz * gz[n+78] + gz[n+114];
+                gz[n+87] = rz * gz[n+84] + gz[n+120];
+                gz[n+132] = c00z * gz[n+96] + 2 * b10 * gz[n+60] + 2 * b00 * gz[n+84];
+                gz[n+126] = sz * gz[n+120] + gz[n+132];
+                gz[n+93] = rz * gz[n+90] + gz[n+126];
+        }
+}
+static void _gout_1211(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 144;
+        double *gz = g + 288;
+        GOUT(0, _g2_3(gx+93, gz+0));
+        GOUT(1, _g3_3(gx+90, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+90, gz+3));
+        GOUT(3, _g3_3(gx+87, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+84, gy+9, gz+0));
+        GOUT(5, _g3_3(gx+84, gy+6, gz+3));
+        GOUT(6, _g2_3(gx+87, gz+6));
+        GOUT(7, _g3_3(gx+84, gy+3, gz+6));
+        GOUT(8, _g2_3(gx+84, gz+9));
+        GOUT(9, _g3_3(gx+81, gy+12, gz+0));
+        GOUT(10, _g3_3(gx+78, gy+15, gz+0));
+        GOUT(11, _g3_3(gx+78, gy+12, gz+3));
+        GOUT(12, _g3_3(gx+75, gy+18, gz+0));
+        GOUT(13, _g3_3(gx+72, gy+21, gz+0));
+        GOUT(14, _g3_3(gx+72, gy+18, gz+3));
+        GOUT(15, _g3_3(gx+75, gy+12, gz+6));
+        GOUT(16, _g3_3(gx+72, gy+15, gz+6));
+        GOUT(17, _g3_3(gx+72, gy+12, gz+9));
+        GOUT(18, _g2_3(gx+81, gz+12));
+        GOUT(19, _g3_3(gx+78, gy+3, gz+12));
+        GOUT(20, _g2_3(gx+78, gz+15));
+        GOUT(21, _g3_3(gx+75, gy+6, gz+12));
+        GOUT(22, _g3_3(gx+72, gy+9, gz+12));
+        GOUT(23, _g3_3(gx+72, gy+6, gz+15));
+        GOUT(24, _g2_3(gx+75, gz+18));
+        GOUT(25, _g3_3(gx+72, gy+3, gz+18));
+        GOUT(26, _g2_3(gx+72, gz+21));
+        GOUT(27, _g3_3(gx+57, gy+36, gz+0));
+        GOUT(28, _g3_3(gx+54, gy+39, gz+0));
+        GOUT(29, _g3_3(gx+54, gy+36, gz+3));
+        GOUT(30, _g3_3(gx+51, gy+42, gz+0));
+        GOUT(31, _g3_3(gx+48, gy+45, gz+0));
+        GOUT(32, _g3_3(gx+48, gy+42, gz+3));
+        GOUT(33, _g3_3(gx+51, gy+36, gz+6));
+        GOUT(34, _g3_3(gx+48, gy+39, gz+6));
+        GOUT(35, _g3_3(gx+48, gy+36, gz+9));
+        GOUT(36, _g3_3(gx+45, gy+48, gz+0));
+        GOUT(37, _g3_3(gx+42, gy+51, gz+0));
+        GOUT(38, _g3_3(gx+42, gy+48, gz+3));
+        GOUT(39, _g3_3(gx+39, gy+54, gz+0));
+        GOUT(40, _g3_3(gx+36, gy+57, gz+0));
+        GOUT(41, _g3_3(gx+36, gy+54, gz+3));
+        GOUT(42, _g3_3(gx+39, gy+48, gz+6));
+        GOUT(43, _g3_3(gx+36, gy+51, gz+6));
+        GOUT(44, _g3_3(gx+36, gy+48, gz+9));
+        GOUT(45, _g3_3(gx+45, gy+36, gz+12));
+        GOUT(46, _g3_3(gx+42, gy+39, gz+12));
+        GOUT(47, _g3_3(gx+42, gy+36, gz+15));
+        GOUT(48, _g3_3(gx+39, gy+42, gz+12));
+        GOUT(49, _g3_3(gx+36, gy+45, gz+12));
+        GOUT(50, _g3_3(gx+36, gy+42, gz+15));
+        GOUT(51, _g3_3(gx+39, gy+36, gz+18));
+        GOUT(52, _g3_3(gx+36, gy+39, gz+18));
+        GOUT(53, _g3_3(gx+36, gy+36, gz+21));
+        GOUT(54, _g2_3(gx+57, gz+36));
+        GOUT(55, _g3_3(gx+54, gy+3, gz+36));
+        GOUT(56, _g2_3(gx+54, gz+39));
+        GOUT(57, _g3_3(gx+51, gy+6, gz+36));
+        GOUT(58, _g3_3(gx+48, gy+9, gz+36));
+        GOUT(59, _g3_3(gx+48, gy+6, gz+39));
+        GOUT(60, _g2_3(gx+51, gz+42));
+        GOUT(61, _g3_3(gx+48, gy+3, gz+42));
+        GOUT(62, _g2_3(gx+48, gz+45));
+        GOUT(63, _g3_3(gx+45, gy+12, gz+36));
+        GOUT(64, _g3_3(gx+42, gy+15, gz+36));
+        GOUT(65, _g3_3(gx+42, gy+12, gz+39));
+        GOUT(66, _g3_3(gx+39, gy+18, gz+36));
+        GOUT(67, _g3_3(gx+36, gy+21, gz+36));
+        GOUT(68, _g3_3(gx+36, gy+18, gz+39));
+        GOUT(69, _g3_3(gx+39, gy+12, gz+42));
+        GOUT(70, _g3_3(gx+36, gy+15, gz+42));
+        GOUT(71, _g3_3(gx+36, gy+12, gz+45));
+        GOUT(72, _g2_3(gx+45, gz+48));
+        GOUT(73, _g3_3(gx+42, gy+3, gz+48));
+        GOUT(74, _g2_3(gx+42, gz+51));
+        GOUT(75, _g3_3(gx+39, gy+6, gz+48));
+        GOUT(76, _g3_3(gx+36, gy+9, gz+48));
+        GOUT(77, _g3_3(gx+36, gy+6, gz+51));
+        GOUT(78, _g2_3(gx+39, gz+54));
+        GOUT(79, _g3_3(gx+36, gy+3, gz+54));
+        GOUT(80, _g2_3(gx+36, gz+57));
+        GOUT(81, _g3_3(gx+21, gy+72, gz+0));
+        GOUT(82, _g3_3(gx+18, gy+75, gz+0));
+        GOUT(83, _g3_3(gx+18, gy+72, gz+3));
+        GOUT(84, _g3_3(gx+15, gy+78, gz+0));
+        GOUT(85, _g3_3(gx+12, gy+81, gz+0));
+        GOUT(86, _g3_3(gx+12, gy+78, gz+3));
+        GOUT(87, _g3_3(gx+15, gy+72, gz+6));
+        GOUT(88, _g3_3(gx+12, gy+75, gz+6));
+        GOUT(89, _g3_3(gx+12, gy+72, gz+9));
+        GOUT(90, _g3_3(gx+9, gy+84, gz+0));
+        GOUT(91, _g3_3(gx+6, gy+87, gz+0));
+        GOUT(92, _g3_3(gx+6, gy+84, gz+3));
+        GOUT(93, _g3_3(gx+3, gy+90, gz+0));
+        GOUT(94, _g2_3(gy+93, gz+0));
+        GOUT(95, _g2_3(gy+90, gz+3));
+        GOUT(96, _g3_3(gx+3, gy+84, gz+6));
+        GOUT(97, _g2_3(gy+87, gz+6));
+        GOUT(98, _g2_3(gy+84, gz+9));
+        GOUT(99, _g3_3(gx+9, gy+72, gz+12));
+        GOUT(100, _g3_3(gx+6, gy+75, gz+12));
+        GOUT(101, _g3_3(gx+6, gy+72, gz+15));
+        GOUT(102, _g3_3(gx+3, gy+78, gz+12));
+        GOUT(103, _g2_3(gy+81, gz+12));
+        GOUT(104, _g2_3(gy+78, gz+15));
+        GOUT(105, _g3_3(gx+3, gy+72, gz+18));
+        GOUT(106, _g2_3(gy+75, gz+18));
+        GOUT(107, _g2_3(gy+72, gz+21));
+        GOUT(108, _g3_3(gx+21, gy+36, gz+36));
+        GOUT(109, _g3_3(gx+18, gy+39, gz+36));
+        GOUT(110, _g3_3(gx+18, gy+36, gz+39));
+        GOUT(111, _g3_3(gx+15, gy+42, gz+36));
+        GOUT(112, _g3_3(gx+12, gy+45, gz+36));
+        GOUT(113, _g3_3(gx+12, gy+42, gz+39));
+        GOUT(114, _g3_3(gx+15, gy+36, gz+42));
+        GOUT(115, _g3_3(gx+12, gy+39, gz+42));
+        GOUT(116, _g3_3(gx+12, gy+36, gz+45));
+        GOUT(117, _g3_3(gx+9, gy+48, gz+36));
+        GOUT(118, _g3_3(gx+6, gy+51, gz+36));
+        GOUT(119, _g3_3(gx+6, gy+48, gz+39));
+        GOUT(120, _g3_3(gx+3, gy+54, gz+36));
+        GOUT(121, _g2_3(gy+57, gz+36));
+        GOUT(122, _g2_3(gy+54, gz+39));
+        GOUT(123, _g3_3(gx+3, gy+48, gz+42));
+        GOUT(124, _g2_3(gy+51, gz+42));
+        GOUT(125, _g2_3(gy+48, gz+45));
+        GOUT(126, _g3_3(gx+9, gy+36, gz+48));
+        GOUT(127, _g3_3(gx+6, gy+39, gz+48));
+        GOUT(128, _g3_3(gx+6, gy+36, gz+51));
+        GOUT(129, _g3_3(gx+3, gy+42, gz+48));
+        GOUT(130, _g2_3(gy+45, gz+48));
+        GOUT(131, _g2_3(gy+42, gz+51));
+        GOUT(132, _g3_3(gx+3, gy+36, gz+54));
+        GOUT(133, _g2_3(gy+39, gz+54));
+        GOUT(134, _g2_3(gy+36, gz+57));
+        GOUT(135, _g2_3(gx+21, gz+72));
+        GOUT(136, _g3_3(gx+18, gy+3, gz+72));
+        GOUT(137, _g2_3(gx+18, gz+75));
+        GOUT(138, _g3_3(gx+15, gy+6, gz+72));
+        GOUT(139, _g3_3(gx+12, gy+9, gz+72));
+        GOUT(140, _g3_3(gx+12, gy+6, gz+75));
+        GOUT(141, _g2_3(gx+15, gz+78));
+        GOUT(142, _g3_3(gx+12, gy+3, gz+78));
+        GOUT(143, _g2_3(gx+12, gz+81));
+        GOUT(144, _g3_3(gx+9, gy+12, gz+72));
+        GOUT(145, _g3_3(gx+6, gy+15, gz+72));
+        GOUT(146, _g3_3(gx+6, gy+12, gz+75));
+        GOUT(147, _g3_3(gx+3, gy+18, gz+72));
+        GOUT(148, _g2_3(gy+21, gz+72));
+        GOUT(149, _g2_3(gy+18, gz+75));
+        GOUT(150, _g3_3(gx+3, gy+12, gz+78));
+        GOUT(151, _g2_3(gy+15, gz+78));
+        GOUT(152, _g2_3(gy+12, gz+81));
+        GOUT(153, _g2_3(gx+9, gz+84));
+        GOUT(154, _g3_3(gx+6, gy+3, gz+84));
+        GOUT(155, _g2_3(gx+6, gz+87));
+        GOUT(156, _g3_3(gx+3, gy+6, gz+84));
+        GOUT(157, _g2_3(gy+9, gz+84));
+        GOUT(158, _g2_3(gy+6, gz+87));
+        GOUT(159, _g2_3(gx+3, gz+90));
+        GOUT(160, _g2_3(gy+3, gz+90));
+        GOUT(161, _g1_3(gz+93));
+}
+
+static void _g0_2d4d_1212(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 256;
+        double *gz = g + 512;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 4; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+64] = c00x;
+                gx[n+4] = rx + gx[n+64];
+                gx[n+16] = c0px;
+                gx[n+8] = sx + gx[n+16];
+                gx[n+80] = c00x * gx[n+16] + b00;
+                gx[n+72] = sx * gx[n+64] + gx[n+80];
+                gx[n+12] = rx * gx[n+8] + gx[n+72];
+                gx[n+20] = rx * gx[n+16] + gx[n+80];
+                gx[n+32] = c0px * gx[n+16] + b01;
+                gx[n+24] = sx * gx[n+16] + gx[n+32];
+                gx[n+96] = c00x * gx[n+32] + 2 * b00 * gx[n+16];
+                gx[n+88] = sx * gx[n+80] + gx[n+96];
+                gx[n+28] = rx * gx[n+24] + gx[n+88];
+                gx[n+36] = rx * gx[n+32] + gx[n+96];
+                gx[n+48] = c0px * gx[n+32] + 2 * b01 * gx[n+16];
+                gx[n+40] = sx * gx[n+32] + gx[n+48];
+                gx[n+112] = c00x * gx[n+48] + 3 * b00 * gx[n+32];
+                gx[n+104] = sx * gx[n+96] + gx[n+112];
+                gx[n+44] = rx * gx[n+40] + gx[n+104];
+                gx[n+128] = c00x * gx[n+64] + b10;
+                gx[n+68] = rx * gx[n+64] + gx[n+128];
+                gx[n+144] = c00x * gx[n+80] + b10 * gx[n+16] + b00 * gx[n+64];
+                gx[n+136] = sx * gx[n+128] + gx[n+144];
+                gx[n+76] = rx * gx[n+72] + gx[n+136];
+                gx[n+84] = rx * gx[n+80] + gx[n+144];
+                gx[n+160] = c00x * gx[n+96] + b10 * gx[n+32] + 2 * b00 * gx[n+80];
+                gx[n+152] = sx * gx[n+144] + gx[n+160];
+                gx[n+92] = rx * gx[n+88] + gx[n+152];
+                gx[n+100] = rx * gx[n+96] + gx[n+160];
+                gx[n+176] = c00x * gx[n+112] + b10 * gx[n+48] + 3 * b00 * gx[n+96];
+                gx[n+168] = sx * gx[n+160] + gx[n+176];
+                gx[n+108] = rx * gx[n+104] + gx[n+168];
+                gx[n+192] = c00x * gx[n+128] + 2 * b10 * gx[n+64];
+                gx[n+132] = rx * gx[n+128] + gx[n+192];
+                gx[n+208] = c00x * gx[n+144] + 2 * b10 * gx[n+80] + b00 * gx[n+128];
+                gx[n+200] = sx * gx[n+192] + gx[n+208];
+                gx[n+140] = rx * gx[n+136] + gx[n+200];
+                gx[n+148] = rx * gx[n+144] + gx[n+208];
+                gx[n+224] = c00x * gx[n+160] + 2 * b10 * gx[n+96] + 2 * b00 * gx[n+144];
+                gx[n+216] = sx * gx[n+208] + gx[n+224];
+                gx[n+156] = rx * gx[n+152] + gx[n+216];
+                gx[n+164] = rx * gx[n+160] + gx[n+224];
+                gx[n+240] = c00x * gx[n+176] + 2 * b10 * gx[n+112] + 3 * b00 * gx[n+160];
+                gx[n+232] = sx * gx[n+224] + gx[n+240];
+                gx[n+172] = rx * gx[n+168] + gx[n+232];
+                gy[n+64] = c00y;
+                gy[n+4] = ry + gy[n+64];
+                gy[n+16] = c0py;
+                gy[n+8] = sy + gy[n+16];
+                gy[n+80] = c00y * gy[n+16] + b00;
+                gy[n+72] = sy * gy[n+64] + gy[n+80];
+                gy[n+12] = ry * gy[n+8] + gy[n+72];
+                gy[n+20] = ry * gy[n+16] + gy[n+80];
+                gy[n+32] = c0py * gy[n+16] + b01;
+                gy[n+24] = sy * gy[n+16] + gy[n+32];
+                gy[n+96] = c00y * gy[n+32] + 2 * b00 * gy[n+16];
+                gy[n+88] = sy * gy[n+80] + gy[n+96];
+                gy[n+28] = ry * gy[n+24] + gy[n+88];
+                gy[n+36] = ry * gy[n+32] + gy[n+96];
+                gy[n+48] = c0py * gy[n+32] + 2 * b01 * gy[n+16];
+                gy[n+40] = sy * gy[n+32] + gy[n+48];
+                gy[n+112] = c00y * gy[n+48] + 3 * b00 * gy[n+32];
+                gy[n+104] = sy * gy[n+96] + gy[n+112];
+                gy[n+44] = ry * gy[n+40] + gy[n+104];
+                gy[n+128] = c00y * gy[n+64] + b10;
+                gy[n+68] = ry * gy[n+64] + gy[n+128];
+                gy[n+144] = c00y * gy[n+80] + b10 * gy[n+16] + b00 * gy[n+64];
+                gy[n+136] = sy * gy[n+128] + gy[n+144];
+                gy[n+76] = ry * gy[n+72] + gy[n+136];
+                gy[n+84] = ry * gy[n+80] + gy[n+144];
+                gy[n+160] = c00y * gy[n+96] + b10 * gy[n+32] + 2 * b00 * gy[n+80];
+                gy[n+152] = sy * gy[n+144] + gy[n+160];
+                gy[n+92] = ry * gy[n+88] + gy[n+152];
+                gy[n+100] = ry * gy[n+96] + gy[n+160];
+                gy[n+176] = c00y * gy[n+112] + b10 * gy[n+48] + 3 * b00 * gy[n+96];
+                gy[n+168] = sy * gy[n+160] + gy[n+176];
+                gy[n+108] = ry * gy[n+104] + gy[n+168];
+                gy[n+192] = c00y * gy[n+128] + 2 * b10 * gy[n+64];
+                gy[n+132] = ry * gy[n+128] + gy[n+192];
+                gy[n+208] = c00y * gy[n+144] + 2 * b10 * gy[n+80] + b00 * gy[n+128];
+                gy[n+200] = sy * gy[n+192] + gy[n+208];
+                gy[n+140] = ry * gy[n+136] + gy[n+200];
+                gy[n+148] = ry * gy[n+144] + gy[n+208];
+                gy[n+224] = c00y * gy[n+160] + 2 * b10 * gy[n+96] + 2 * b00 * gy[n+144];
+                gy[n+216] = sy * gy[n+208] + gy[n+224];
+                gy[n+156] = ry * gy[n+152] + gy[n+216];
+                gy[n+164] = ry * gy[n+160] + gy[n+224];
+                gy[n+240] = c00y * gy[n+176] + 2 * b10 * gy[n+112] + 3 * b00 * gy[n+160];
+                gy[n+232] = sy * gy[n+224] + gy[n+240];
+                gy[n+172] = ry * gy[n+168] + gy[n+232];
+                gz[n+64] = c00z * gz[n+0];
+                gz[n+4] = rz * gz[n+0] + gz[n+64];
+                gz[n+16] = c0pz * gz[n+0];
+                gz[n+8] = sz * gz[n+0] + gz[n+16];
+                gz[n+80] = c00z * gz[n+16] + b00 * gz[n+0];
+                gz[n+72] = sz * gz[n+64] + gz[n+80];
+                gz[n+12] = rz * gz[n+8] + gz[n+72];
+                gz[n+20] = rz * gz[n+16] + gz[n+80];
+                gz[n+32] = c0pz * gz[n+16] + b01 * gz[n+0];
+                gz[n+24] = sz * gz[n+16] + gz[n+32];
+                gz[n+96] = c00z * gz[n+32] + 2 * b00 * gz[n+16];
+                gz[n+88] = sz * gz[n+80] + gz[n+96];
+                gz[n+28] = rz * gz[n+24] + gz[n+88];
+                gz[n+36] = rz * gz[n+32] + gz[n+96];
+                gz[n+48] = c0pz * gz[n+32] + 2 * b01 * gz[n+16];
+                gz[n+40] = sz * gz[n+32] + gz[n+48];
+                gz[n+112] = c00z * gz[n+48] + 3 * b00 * gz[n+32];
+                gz[n+104] = sz * gz[n+96] + gz[n+112];
+                gz[n+44] = rz * gz[n+40] + gz[n+104];
+                gz[n+128] = c00z * gz[n+64] + b10 * gz[n+0];
+                gz[n+68] = rz * gz[n+64] + gz[n+128];
+                gz[n+144] = c00z * gz[n+80] + b10 * gz[n+16] + b00 * gz[n+64];
+                gz[n+136] = sz * gz[n+128] + gz[n+144];
+                gz[n+76] = rz * gz[n+72] + gz[n+136];
+                gz[n+84] = rz * gz[n+80] + gz[n+144];
+                gz[n+160] = c00z * gz[n+96] + b10 * gz[n+32] + 2 * b00 * gz[n+80];
+                gz[n+152] = sz * gz[n+144] + gz[n+160];
+                gz[n+92] = rz * gz[n+88] + gz[n+152];
+                gz[n+100] = rz * gz[n+96] + gz[n+160];
+                gz[n+176] = c00z * gz[n+112] + b10 * gz[n+48] + 3 * b00 * gz[n+96];
+                gz[n+168] = sz * gz[n+160] + gz[n+176];
+                gz[n+108] = rz * gz[n+104] + gz[n+168];
+                gz[n+192] = c00z * gz[n+128] + 2 * b10 * gz[n+64];
+                gz[n+132] = rz * gz[n+128] + gz[n+192];
+                gz[n+208] = c00z * gz[n+144] + 2 * b10 * gz[n+80] + b00 * gz[n+128];
+                gz[n+200] = sz * gz[n+192] + gz[n+208];
+                gz[n+140] = rz * gz[n+136] + gz[n+200];
+                gz[n+148] = rz * gz[n+144] + gz[n+208];
+                gz[n+224] = c00z * gz[n+160] + 2 * b10 * gz[n+96] + 2 * b00 * gz[n+144];
+                gz[n+216] = sz * gz[n+208] + gz[n+224];
+                gz[n+156] = rz * gz[n+152] + gz[n+216];
+                gz[n+164] = rz * gz[n+160] + gz[n+224];
+                gz[n+240] = c00z * gz[n+176] + 2 * b10 * gz[n+112] + 3 * b00 * gz[n+160];
+                gz[n+232] = sz * gz[n+224] + gz[n+240];
+                gz[n+172] = rz * gz[n+168] + gz[n+232];
+        }
+}
+static void _gout_1212(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 256;
+        double *gz = g + 512;
+        GOUT(0, _g2_4(gx+172, gz+0));
+        GOUT(1, _g3_4(gx+168, gy+4, gz+0));
+        GOUT(2, _g2_4(gx+168, gz+4));
+        GOUT(3, _g3_4(gx+164, gy+8, gz+0));
+        GOUT(4, _g3_4(gx+160, gy+12, gz+0));
+        GOUT(5, _g3_4(gx+160, gy+8, gz+4));
+        GOUT(6, _g2_4(gx+164, gz+8));
+        GOUT(7, _g3_4(gx+160, gy+4, gz+8));
+        GOUT(8, _g2_4(gx+160, gz+12));
+        GOUT(9, _g3_4(gx+156, gy+16, gz+0));
+        GOUT(10, _g3_4(gx+152, gy+20, gz+0));
+        GOUT(11, _g3_4(gx+152, gy+16, gz+4));
+        GOUT(12, _g3_4(gx+148, gy+24, gz+0));
+        GOUT(13, _g3_4(gx+144, gy+28, gz+0));
+        GOUT(14, _g3_4(gx+144, gy+24, gz+4));
+        GOUT(15, _g3_4(gx+148, gy+16, gz+8));
+        GOUT(16, _g3_4(gx+144, gy+20, gz+8));
+        GOUT(17, _g3_4(gx+144, gy+16, gz+12));
+        GOUT(18, _g2_4(gx+156, gz+16));
+        GOUT(19, _g3_4(gx+152, gy+4, gz+16));
+        GOUT(20, _g2_4(gx+152, gz+20));
+        GOUT(21, _g3_4(gx+148, gy+8, gz+16));
+        GOUT(22, _g3_4(gx+144, gy+12, gz+16));
+        GOUT(23, _g3_4(gx+144, gy+8, gz+20));
+        GOUT(24, _g2_4(gx+148, gz+24));
+        GOUT(25, _g3_4(gx+144, gy+4, gz+24));
+        GOUT(26, _g2_4(gx+144, gz+28));
+        GOUT(27, _g3_4(gx+140, gy+32, gz+0));
+        GOUT(28, _g3_4(gx+136, gy+36, gz+0));
+        GOUT(29, _g3_4(gx+136, gy+32, gz+4));
+        GOUT(30, _g3_4(gx+132, gy+40, gz+0));
+        GOUT(31, _g3_4(gx+128, gy+44, gz+0));
+        GOUT(32, _g3_4(gx+128, gy+40, gz+4));
+        GOUT(33, _g3_4(gx+132, gy+32, gz+8));
+        GOUT(34, _g3_4(gx+128, gy+36, gz+8));
+        GOUT(35, _g3_4(gx+128, gy+32, gz+12));
+        GOUT(36, _g3_4(gx+140, gy+16, gz+16));
+        GOUT(37, _g3_4(gx+136, gy+20, gz+16));
+        GOUT(38, _g3_4(gx+136, gy+16, gz+20));
+        GOUT(39, _g3_4(gx+132, gy+24, gz+16));
+        GOUT(40, _g3_4(gx+128, gy+28, gz+16));
+        GOUT(41, _g3_4(gx+128, gy+24, gz+20));
+        GOUT(42, _g3_4(gx+132, gy+16, gz+24));
+        GOUT(43, _g3_4(gx+128, gy+20, gz+24));
+        GOUT(44, _g3_4(gx+128, gy+16, gz+28));
+        GOUT(45, _g2_4(gx+140, gz+32));
+        GOUT(46, _g3_4(gx+136, gy+4, gz+32));
+        GOUT(47, _g2_4(gx+136, gz+36));
+        GOUT(48, _g3_4(gx+132, gy+8, gz+32));
+        GOUT(49, _g3_4(gx+128, gy+12, gz+32));
+        GOUT(50, _g3_4(gx+128, gy+8, gz+36));
+        GOUT(51, _g2_4(gx+132, gz+40));
+        GOUT(52, _g3_4(gx+128, gy+4, gz+40));
+        GOUT(53, _g2_4(gx+128, gz+44));
+        GOUT(54, _g3_4(gx+108, gy+64, gz+0));
+        GOUT(55, _g3_4(gx+104, gy+68, gz+0));
+        GOUT(56, _g3_4(gx+104, gy+64, gz+4));
+        GOUT(57, _g3_4(gx+100, gy+72, gz+0));
+        GOUT(58, _g3_4(gx+96, gy+76, gz+0));
+        GOUT(59, _g3_4(gx+96, gy+72, gz+4));
+        GOUT(60, _g3_4(gx+100, gy+64, gz+8));
+        GOUT(61, _g3_4(gx+96, gy+68, gz+8));
+        GOUT(62, _g3_4(gx+96, gy+64, gz+12));
+        GOUT(63, _g3_4(gx+92, gy+80, gz+0));
+        GOUT(64, _g3_4(gx+88, gy+84, gz+0));
+        GOUT(65, _g3_4(gx+88, gy+80, gz+4));
+        GOUT(66, _g3_4(gx+84, gy+88, gz+0));
+        GOUT(67, _g3_4(gx+80, gy+92, gz+0));
+        GOUT(68, _g3_4(gx+80, gy+88, gz+4));
+        GOUT(69, _g3_4(gx+84, gy+80, gz+8));
+        GOUT(70, _g3_4(gx+80, gy+84, gz+8));
+        GOUT(71, _g3_4(gx+80, gy+80, gz+12));
+        GOUT(72, _g3_4(gx+92, gy+64, gz+16));
+        GOUT(73, _g3_4(gx+88, gy+68, gz+16));
+        GOUT(74, _g3_4(gx+88, gy+64, gz+20));
+        GOUT(75, _g3_4(gx+84, gy+72, gz+16));
+        GOUT(76, _g3_4(gx+80, gy+76, gz+16));
+        GOUT(77, _g3_4(gx+80, gy+72, gz+20));
+        GOUT(78, _g3_4(gx+84, gy+64, gz+24));
+        GOUT(79, _g3_4(gx+80, gy+68, gz+24));
+        GOUT(80, _g3_4(gx+80, gy+64, gz+28));
+        GOUT(81, _g3_4(gx+76, gy+96, gz+0));
+        GOUT(82, _g3_4(gx+72, gy+100, gz+0));
+        GOUT(83, _g3_4(gx+72, gy+96, gz+4));
+        GOUT(84, _g3_4(gx+68, gy+104, gz+0));
+        GOUT(85, _g3_4(gx+64, gy+108, gz+0));
+        GOUT(86, _g3_4(gx+64, gy+104, gz+4));
+        GOUT(87, _g3_4(gx+68, gy+96, gz+8));
+        GOUT(88, _g3_4(gx+64, gy+100, gz+8));
+        GOUT(89, _g3_4(gx+64, gy+96, gz+12));
+        GOUT(90, _g3_4(gx+76, gy+80, gz+16));
+        GOUT(91, _g3_4(gx+72, gy+84, gz+16));
+        GOUT(92, _g3_4(gx+72, gy+80, gz+20));
+        GOUT(93, _g3_4(gx+68, gy+88, gz+16));
+        GOUT(94, _g3_4(gx+64, gy+92, gz+16));
+        GOUT(95, _g3_4(gx+64, gy+88, gz+20));
+        GOUT(96, _g3_4(gx+68, gy+80, gz+24));
+        GOUT(97, _g3_4(gx+64, gy+84, gz+24));
+        GOUT(98, _g3_4(gx+64, gy+80, gz+28));
+        GOUT(99, _g3_4(gx+76, gy+64, gz+32));
+        GOUT(100, _g3_4(gx+72, gy+68, gz+32));
+        GOUT(101, _g3_4(gx+72, gy+64, gz+36));
+        GOUT(102, _g3_4(gx+68, gy+72, gz+32));
+        GOUT(103, _g3_4(gx+64, gy+76, gz+32));
+        GOUT(104, _g3_4(gx+64, gy+72, gz+36));
+        GOUT(105, _g3_4(gx+68, gy+64, gz+40));
+        GOUT(106, _g3_4(gx+64, gy+68, gz+40));
+        GOUT(107, _g3_4(gx+64, gy+64, gz+44));
+        GOUT(108, _g2_4(gx+108, gz+64));
+        GOUT(109, _g3_4(gx+104, gy+4, gz+64));
+        GOUT(110, _g2_4(gx+104, gz+68));
+        GOUT(111, _g3_4(gx+100, gy+8, gz+64));
+        GOUT(112, _g3_4(gx+96, gy+12, gz+64));
+        GOUT(113, _g3_4(gx+96, gy+8, gz+68));
+        GOUT(114, _g2_4(gx+100, gz+72));
+        GOUT(115, _g3_4(gx+96, gy+4, gz+72));
+        GOUT(116, _g2_4(gx+96, gz+76));
+        GOUT(117, _g3_4(gx+92, gy+16, gz+64));
+        GOUT(118, _g3_4(gx+88, gy+20, gz+64));
+        GOUT(119, _g3_4(gx+88, gy+16, gz+68));
+        GOUT(120, _g3_4(gx+84, gy+24, gz+64));
+        GOUT(121, _g3_4(gx+80, gy+28, gz+64));
+        GOUT(122, _g3_4(gx+80, gy+24, gz+68));
+        GOUT(123, _g3_4(gx+84, gy+16, gz+72));
+        GOUT(124, _g3_4(gx+80, gy+20, gz+72));
+        GOUT(125, _g3_4(gx+80, gy+16, gz+76));
+        GOUT(126, _g2_4(gx+92, gz+80));
+        GOUT(127, _g3_4(gx+88, gy+4, gz+80));
+        GOUT(128, _g2_4(gx+88, gz+84));
+        GOUT(129, _g3_4(gx+84, gy+8, gz+80));
+        GOUT(130, _g3_4(gx+80, gy+12, gz+80));
+        GOUT(131, _g3_4(gx+80, gy+8, gz+84));
+        GOUT(132, _g2_4(gx+84, gz+88));
+        GOUT(133, _g3_4(gx+80, gy+4, gz+88));
+        GOUT(134, _g2_4(gx+80, gz+92));
+        GOUT(135, _g3_4(gx+76, gy+32, gz+64));
+        GOUT(136, _g3_4(gx+72, gy+36, gz+64));
+        GOUT(137, _g3_4(gx+72, gy+32, gz+68));
+        GOUT(138, _g3_4(gx+68, gy+40, gz+64));
+        GOUT(139, _g3_4(gx+64, gy+44, gz+64));
+        GOUT(140, _g3_4(gx+64, gy+40, gz+68));
+        GOUT(141, _g3_4(gx+68, gy+32, gz+72));
+        GOUT(142, _g3_4(gx+64, gy+36, gz+72));
+        GOUT(143, _g3_4(gx+64, gy+32, gz+76));
+        GOUT(144, _g3_4(gx+76, gy+16, gz+80));
+        GOUT(145, _g3_4(gx+72, gy+20, gz+80));
+        GOUT(146, _g3_4(gx+72, gy+16, gz+84));
+        GOUT(147, _g3_4(gx+68, gy+24, gz+80));
+        GOUT(148, _g3_4(gx+64, gy+28, gz+80));
+        GOUT(149, _g3_4(gx+64, gy+24, gz+84));
+        GOUT(150, _g3_4(gx+68, gy+16, gz+88));
+        GOUT(151, _g3_4(gx+64, gy+20, gz+88));
+        GOUT(152, _g3_4(gx+64, gy+16, gz+92));
+        GOUT(153, _g2_4(gx+76, gz+96));
+        GOUT(154, _g3_4(gx+72, gy+4, gz+96));
+        GOUT(155, _g2_4(gx+72, gz+100));
+        GOUT(156, _g3_4(gx+68, gy+8, gz+96));
+        GOUT(157, _g3_4(gx+64, gy+12, gz+96));
+        GOUT(158, _g3_4(gx+64, gy+8, gz+100));
+        GOUT(159, _g2_4(gx+68, gz+104));
+        GOUT(160, _g3_4(gx+64, gy+4, gz+104));
+        GOUT(161, _g2_4(gx+64, gz+108));
+        GOUT(162, _g3_4(gx+44, gy+128, gz+0));
+        GOUT(163, _g3_4(gx+40, gy+132, gz+0));
+        GOUT(164, _g3_4(gx+40, gy+128, gz+4));
+        GOUT(165, _g3_4(gx+36, gy+136, gz+0));
+        GOUT(166, _g3_4(gx+32, gy+140, gz+0));
+        GOUT(167, _g3_4(gx+32, gy+136, gz+4));
+        GOUT(168, _g3_4(gx+36, gy+128, gz+8));
+        GOUT(169, _g3_4(gx+32, gy+132, gz+8));
+        GOUT(170, _g3_4(gx+32, gy+128, gz+12));
+        GOUT(171, _g3_4(gx+28, gy+144, gz+0));
+        GOUT(172, _g3_4(gx+24, gy+148, gz+0));
+        GOUT(173, _g3_4(gx+24, gy+144, gz+4));
+        GOUT(174, _g3_4(gx+20, gy+152, gz+0));
+        GOUT(175, _g3_4(gx+16, gy+156, gz+0));
+        GOUT(176, _g3_4(gx+16, gy+152, gz+4));
+        GOUT(177, _g3_4(gx+20, gy+144, gz+8));
+        GOUT(178, _g3_4(gx+16, gy+148, gz+8));
+        GOUT(179, _g3_4(gx+16, gy+144, gz+12));
+        GOUT(180, _g3_4(gx+28, gy+128, gz+16));
+        GOUT(181, _g3_4(gx+24, gy+132, gz+16));
+        GOUT(182, _g3_4(gx+24, gy+128, gz+20));
+        GOUT(183, _g3_4(gx+20, gy+136, gz+16));
+        GOUT(184, _g3_4(gx+16, gy+140, gz+16));
+        GOUT(185, _g3_4(gx+16, gy+136, gz+20));
+        GOUT(186, _g3_4(gx+20, gy+128, gz+24));
+        GOUT(187, _g3_4(gx+16, gy+132, gz+24));
+        GOUT(188, _g3_4(gx+16, gy+128, gz+28));
+        GOUT(189, _g3_4(gx+12, gy+160, gz+0));
+        GOUT(190, _g3_4(gx+8, gy+164, gz+0));
+        GOUT(191, _g3_4(gx+8, gy+160, gz+4));
+        GOUT(192, _g3_4(gx+4, gy+168, gz+0));
+        GOUT(193, _g2_4(gy+172, gz+0));
+        GOUT(194, _g2_4(gy+168, gz+4));
+        GOUT(195, _g3_4(gx+4, gy+160, gz+8));
+        GOUT(196, _g2_4(gy+164, gz+8));
+        GOUT(197, _g2_4(gy+160, gz+12));
+        GOUT(198, _g3_4(gx+12, gy+144, gz+16));
+        GOUT(199, _g3_4(gx+8, gy+148, gz+16));
+        GOUT(200, _g3_4(gx+8, gy+144, gz+20));
+        GOUT(201, _g3_4(gx+4, gy+152, gz+16));
+        GOUT(202, _g2_4(gy+156, gz+16));
+        GOUT(203, _g2_4(gy+152, gz+20));
+        GOUT(204, _g3_4(gx+4, gy+144, gz+24));
+        GOUT(205, _g2_4(gy+148, gz+24));
+        GOUT(206, _g2_4(gy+144, gz+28));
+        GOUT(207, _g3_4(gx+12, gy+128, gz+32));
+        GOUT(208, _g3_4(gx+8, gy+132, gz+32));
+        GOUT(209, _g3_4(gx+8, gy+128, gz+36));
+        GOUT(210, _g3_4(gx+4, gy+136, gz+32));
+        GOUT(211, _g2_4(gy+140, gz+32));
+        GOUT(212, _g2_4(gy+136, gz+36));
+        GOUT(213, _g3_4(gx+4, gy+128, gz+40));
+        GOUT(214, _g2_4(gy+132, gz+40));
+        GOUT(215, _g2_4(gy+128, gz+44));
+        GOUT(216, _g3_4(gx+44, gy+64, gz+64));
+        GOUT(217, _g3_4(gx+40, gy+68, gz+64));
+        GOUT(218, _g3_4(gx+40, gy+64, gz+68));
+        GOUT(219, _g3_4(gx+36, gy+72, gz+64));
+        GOUT(220, _g3_4(gx+32, gy+76, gz+64));
+        GOUT(221, _g3_4(gx+32, gy+72, gz+68));
+        GOUT(222, _g3_4(gx+36, gy+64, gz+72));
+        GOUT(223, _g3_4(gx+32, gy+68, gz+72));
+        GOUT(224, _g3_4(gx+32, gy+64, gz+76));
+        GOUT(225, _g3_4(gx+28, gy+80, gz+64));
+        GOUT(226, _g3_4(gx+24, gy+84, gz+64));
+        GOUT(227, _g3_4(gx+24, gy+80, gz+68));
+        GOUT(228, _g3_4(gx+20, gy+88, gz+64));
+        GOUT(229, _g3_4(gx+16, gy+92, gz+64));
+        GOUT(230, _g3_4(gx+16, gy+88, gz+68));
+        GOUT(231, _g3_4(gx+20, gy+80, gz+72));
+        GOUT(232, _g3_4(gx+16, gy+84, gz+72));
+        GOUT(233, _g3_4(gx+16, gy+80, gz+76));
+        GOUT(234, _g3_4(gx+28, gy+64, gz+80));
+        GOUT(235, _g3_4(gx+24, gy+68, gz+80));
+        GOUT(236, _g3_4(gx+24, gy+64, gz+84));
+        GOUT(237, _g3_4(gx+20, gy+72, gz+80));
+        GOUT(238, _g3_4(gx+16, gy+76, gz+80));
+        GOUT(239, _g3_4(gx+16, gy+72, gz+84));
+        GOUT(240, _g3_4(gx+20, gy+64, gz+88));
+        GOUT(241, _g3_4(gx+16, gy+68, gz+88));
+        GOUT(242, _g3_4(gx+16, gy+64, gz+92));
+        GOUT(243, _g3_4(gx+12, gy+96, gz+64));
+        GOUT(244, _g3_4(gx+8, gy+100, gz+64));
+        GOUT(245, _g3_4(gx+8, gy+96, gz+68));
+        GOUT(246, _g3_4(gx+4, gy+104, gz+64));
+        GOUT(247, _g2_4(gy+108, gz+64));
+        GOUT(248, _g2_4(gy+104, gz+68));
+        GOUT(249, _g3_4(gx+4, gy+96, gz+72));
+        GOUT(250, _g2_4(gy+100, gz+72));
+        GOUT(251, _g2_4(gy+96, gz+76));
+        GOUT(252, _g3_4(gx+12, gy+80, gz+80));
+        GOUT(253, _g3_4(gx+8, gy+84, gz+80));
+        GOUT(254, _g3_4(gx+8, gy+80, gz+84));
+        GOUT(255, _g3_4(gx+4, gy+88, gz+80));
+        GOUT(256, _g2_4(gy+92, gz+80));
+        GOUT(257, _g2_4(gy+88, gz+84));
+        GOUT(258, _g3_4(gx+4, gy+80, gz+88));
+        GOUT(259, _g2_4(gy+84, gz+88));
+        GOUT(260, _g2_4(gy+80, gz+92));
+        GOUT(261, _g3_4(gx+12, gy+64, gz+96));
+        GOUT(262, _g3_4(gx+8, gy+68, gz+96));
+        GOUT(263, _g3_4(gx+8, gy+64, gz+100));
+        GOUT(264, _g3_4(gx+4, gy+72, gz+96));
+        GOUT(265, _g2_4(gy+76, gz+96));
+        GOUT(266, _g2_4(gy+72, gz+100));
+        GOUT(267, _g3_4(gx+4, gy+64, gz+104));
+        GOUT(268, _g2_4(gy+68, gz+104));
+        GOUT(269, _g2_4(gy+64, gz+108));
+        GOUT(270, _g2_4(gx+44, gz+128));
+        GOUT(271, _g3_4(gx+40, gy+4, gz+128));
+        GOUT(272, _g2_4(gx+40, gz+132));
+        GOUT(273, _g3_4(gx+36, gy+8, gz+128));
+        GOUT(274, _g3_4(gx+32, gy+12, gz+128));
+        GOUT(275, _g3_4(gx+32, gy+8, gz+132));
+        GOUT(276, _g2_4(gx+36, gz+136));
+        GOUT(277, _g3_4(gx+32, gy+4, gz+136));
+        GOUT(278, _g2_4(gx+32, gz+140));
+        GOUT(279, _g3_4(gx+28, gy+16, gz+128));
+        GOUT(280, _g3_4(gx+24, gy+20, gz+128));
+        GOUT(281, _g3_4(gx+24, gy+16, gz+132));
+        GOUT(282, _g3_4(gx+20, gy+24, gz+128));
+        GOUT(283, _g3_4(gx+16, gy+28, gz+128));
+        GOUT(284, _g3_4(gx+16, gy+24, gz+132));
+        GOUT(285, _g3_4(gx+20, gy+16, gz+136));
+        GOUT(286, _g3_4(gx+16, gy+20, gz+136));
+        GOUT(287, _g3_4(gx+16, gy+16, gz+140));
+        GOUT(288, _g2_4(gx+28, gz+144));
+        GOUT(289, _g3_4(gx+24, gy+4, gz+144));
+        GOUT(290, _g2_4(gx+24, gz+148));
+        GOUT(291, _g3_4(gx+20, gy+8, gz+144));
+        GOUT(292, _g3_4(gx+16, gy+12, gz+144));
+        GOUT(293, _g3_4(gx+16, gy+8, gz+148));
+        GOUT(294, _g2_4(gx+20, gz+152));
+        GOUT(295, _g3_4(gx+16, gy+4, gz+152));
+        GOUT(296, _g2_4(gx+16, gz+156));
+        GOUT(297, _g3_4(gx+12, gy+32, gz+128));
+        GOUT(298, _g3_4(gx+8, gy+36, gz+128));
+        GOUT(299, _g3_4(gx+8, gy+32, gz+132));
+        GOUT(300, _g3_4(gx+4, gy+40, gz+128));
+        GOUT(301, _g2_4(gy+44, gz+128));
+        GOUT(302, _g2_4(gy+40, gz+132));
+        GOUT(303, _g3_4(gx+4, gy+32, gz+136));
+        GOUT(304, _g2_4(gy+36, gz+136));
+        GOUT(305, _g2_4(gy+32, gz+140));
+        GOUT(306, _g3_4(gx+12, gy+16, gz+144));
+        GOUT(307, _g3_4(gx+8, gy+20, gz+144));
+        GOUT(308, _g3_4(gx+8, gy+16, gz+148));
+        GOUT(309, _g3_4(gx+4, gy+24, gz+144));
+        GOUT(310, _g2_4(gy+28, gz+144));
+        GOUT(311, _g2_4(gy+24, gz+148));
+        GOUT(312, _g3_4(gx+4, gy+16, gz+152));
+        GOUT(313, _g2_4(gy+20, gz+152));
+        GOUT(314, _g2_4(gy+16, gz+156));
+        GOUT(315, _g2_4(gx+12, gz+160));
+        GOUT(316, _g3_4(gx+8, gy+4, gz+160));
+        GOUT(317, _g2_4(gx+8, gz+164));
+        GOUT(318, _g3_4(gx+4, gy+8, gz+160));
+        GOUT(319, _g2_4(gy+12, gz+160));
+        GOUT(320, _g2_4(gy+8, gz+164));
+        GOUT(321, _g2_4(gx+4, gz+168));
+        GOUT(322, _g2_4(gy+4, gz+168));
+        GOUT(323, _g1_4(gz+172));
+}
+
+static void _g0_2d4d_1220(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 72;
+        double *gz = g + 144;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+18] = c00x;
+                gx[n+3] = rx + gx[n+18];
+                gx[n+6] = c0px;
+                gx[n+24] = c00x * gx[n+6] + b00;
+                gx[n+9] = rx * gx[n+6] + gx[n+24];
+                gx[n+12] = c0px * gx[n+6] + b01;
+                gx[n+30] = c00x * gx[n+12] + 2 * b00 * gx[n+6];
+                gx[n+15] = rx * gx[n+12] + gx[n+30];
+                gx[n+36] = c00x * gx[n+18] + b10;
+                gx[n+21] = rx * gx[n+18] + gx[n+36];
+                gx[n+42] = c00x * gx[n+24] + b10 * gx[n+6] + b00 * gx[n+18];
+                gx[n+27] = rx * gx[n+24] + gx[n+42];
+                gx[n+48] = c00x * gx[n+30] + b10 * gx[n+12] + 2 * b00 * gx[n+24];
+                gx[n+33] = rx * gx[n+30] + gx[n+48];
+                gx[n+54] = c00x * gx[n+36] + 2 * b10 * gx[n+18];
+                gx[n+39] = rx * gx[n+36] + gx[n+54];
+                gx[n+60] = c00x * gx[n+42] + 2 * b10 * gx[n+24] + b00 * gx[n+36];
+                gx[n+45] = rx * gx[n+42] + gx[n+60];
+                gx[n+66] = c00x * gx[n+48] + 2 * b10 * gx[n+30] + 2 * b00 * gx[n+42];
+                gx[n+51] = rx * gx[n+48] + gx[n+66];
+                gy[n+18] = c00y;
+                gy[n+3] = ry + gy[n+18];
+                gy[n+6] = c0py;
+                gy[n+24] = c00y * gy[n+6] + b00;
+                gy[n+9] = ry * gy[n+6] + gy[n+24];
+                gy[n+12] = c0py * gy[n+6] + b01;
+                gy[n+30] = c00y * gy[n+12] + 2 * b00 * gy[n+6];
+                gy[n+15] = ry * gy[n+12] + gy[n+30];
+                gy[n+36] = c00y * gy[n+18] + b10;
+                gy[n+21] = ry * gy[n+18] + gy[n+36];
+                gy[n+42] = c00y * gy[n+24] + b10 * gy[n+6] + b00 * gy[n+18];
+                gy[n+27] = ry * gy[n+24] + gy[n+42];
+                gy[n+48] = c00y * gy[n+30] + b10 * gy[n+12] + 2 * b00 * gy[n+24];
+                gy[n+33] = ry * gy[n+30] + gy[n+48];
+                gy[n+54] = c00y * gy[n+36] + 2 * b10 * gy[n+18];
+                gy[n+39] = ry * gy[n+36] + gy[n+54];
+                gy[n+60] = c00y * gy[n+42] + 2 * b10 * gy[n+24] + b00 * gy[n+36];
+                gy[n+45] = ry * gy[n+42] + gy[n+60];
+                gy[n+66] = c00y * gy[n+48] + 2 * b10 * gy[n+30] + 2 * b00 * gy[n+42];
+                gy[n+51] = ry * gy[n+48] + gy[n+66];
+                gz[n+18] = c00z * gz[n+0];
+                gz[n+3] = rz * gz[n+0] + gz[n+18];
+                gz[n+6] = c0pz * gz[n+0];
+                gz[n+24] = c00z * gz[n+6] + b00 * gz[n+0];
+                gz[n+9] = rz * gz[n+6] + gz[n+24];
+                gz[n+12] = c0pz * gz[n+6] + b01 * gz[n+0];
+                gz[n+30] = c00z * gz[n+12] + 2 * b00 * gz[n+6];
+                gz[n+15] = rz * gz[n+12] + gz[n+30];
+                gz[n+36] = c00z * gz[n+18] + b10 * gz[n+0];
+                gz[n+21] = rz * gz[n+18] + gz[n+36];
+                gz[n+42] = c00z * gz[n+24] + b10 * gz[n+6] + b00 * gz[n+18];
+                gz[n+27] = rz * gz[n+24] + gz[n+42];
+                gz[n+48] = c00z * gz[n+30] + b10 * gz[n+12] + 2 * b00 * gz[n+24];
+                gz[n+33] = rz * gz[n+30] + gz[n+48];
+                gz[n+54] = c00z * gz[n+36] + 2 * b10 * gz[n+18];
+                gz[n+39] = rz * gz[n+36] + gz[n+54];
+                gz[n+60] = c00z * gz[n+42] + 2 * b10 * gz[n+24] + b00 * gz[n+36];
+                gz[n+45] = rz * gz[n+42] + gz[n+60];
+                gz[n+66] = c00z * gz[n+48] + 2 * b10 * gz[n+30] + 2 * b00 * gz[n+42];
+                gz[n+51] = rz * gz[n+48] + gz[n+66];
+        }
+}
+static void _gout_1220(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 72;
+        double *gz = g + 144;
+        GOUT(0, _g2_3(gx+51, gz+0));
+        GOUT(1, _g3_3(gx+48, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+48, gz+3));
+        GOUT(3, _g3_3(gx+45, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+42, gy+9, gz+0));
+        GOUT(5, _g3_3(gx+42, gy+6, gz+3));
+        GOUT(6, _g2_3(gx+45, gz+6));
+        GOUT(7, _g3_3(gx+42, gy+3, gz+6));
+        GOUT(8, _g2_3(gx+42, gz+9));
+        GOUT(9, _g3_3(gx+39, gy+12, gz+0));
+        GOUT(10, _g3_3(gx+36, gy+15, gz+0));
+        GOUT(11, _g3_3(gx+36, gy+12, gz+3));
+        GOUT(12, _g3_3(gx+39, gy+6, gz+6));
+        GOUT(13, _g3_3(gx+36, gy+9, gz+6));
+        GOUT(14, _g3_3(gx+36, gy+6, gz+9));
+        GOUT(15, _g2_3(gx+39, gz+12));
+        GOUT(16, _g3_3(gx+36, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+36, gz+15));
+        GOUT(18, _g3_3(gx+33, gy+18, gz+0));
+        GOUT(19, _g3_3(gx+30, gy+21, gz+0));
+        GOUT(20, _g3_3(gx+30, gy+18, gz+3));
+        GOUT(21, _g3_3(gx+27, gy+24, gz+0));
+        GOUT(22, _g3_3(gx+24, gy+27, gz+0));
+        GOUT(23, _g3_3(gx+24, gy+24, gz+3));
+        GOUT(24, _g3_3(gx+27, gy+18, gz+6));
+        GOUT(25, _g3_3(gx+24, gy+21, gz+6));
+        GOUT(26, _g3_3(gx+24, gy+18, gz+9));
+        GOUT(27, _g3_3(gx+21, gy+30, gz+0));
+        GOUT(28, _g3_3(gx+18, gy+33, gz+0));
+        GOUT(29, _g3_3(gx+18, gy+30, gz+3));
+        GOUT(30, _g3_3(gx+21, gy+24, gz+6));
+        GOUT(31, _g3_3(gx+18, gy+27, gz+6));
+        GOUT(32, _g3_3(gx+18, gy+24, gz+9));
+        GOUT(33, _g3_3(gx+21, gy+18, gz+12));
+        GOUT(34, _g3_3(gx+18, gy+21, gz+12));
+        GOUT(35, _g3_3(gx+18, gy+18, gz+15));
+        GOUT(36, _g2_3(gx+33, gz+18));
+        GOUT(37, _g3_3(gx+30, gy+3, gz+18));
+        GOUT(38, _g2_3(gx+30, gz+21));
+        GOUT(39, _g3_3(gx+27, gy+6, gz+18));
+        GOUT(40, _g3_3(gx+24, gy+9, gz+18));
+        GOUT(41, _g3_3(gx+24, gy+6, gz+21));
+        GOUT(42, _g2_3(gx+27, gz+24));
+        GOUT(43, _g3_3(gx+24, gy+3, gz+24));
+        GOUT(44, _g2_3(gx+24, gz+27));
+        GOUT(45, _g3_3(gx+21, gy+12, gz+18));
+        GOUT(46, _g3_3(gx+18, gy+15, gz+18));
+        GOUT(47, _g3_3(gx+18, gy+12, gz+21));
+        GOUT(48, _g3_3(gx+21, gy+6, gz+24));
+        GOUT(49, _g3_3(gx+18, gy+9, gz+24));
+        GOUT(50, _g3_3(gx+18, gy+6, gz+27));
+        GOUT(51, _g2_3(gx+21, gz+30));
+        GOUT(52, _g3_3(gx+18, gy+3, gz+30));
+        GOUT(53, _g2_3(gx+18, gz+33));
+        GOUT(54, _g3_3(gx+15, gy+36, gz+0));
+        GOUT(55, _g3_3(gx+12, gy+39, gz+0));
+        GOUT(56, _g3_3(gx+12, gy+36, gz+3));
+        GOUT(57, _g3_3(gx+9, gy+42, gz+0));
+        GOUT(58, _g3_3(gx+6, gy+45, gz+0));
+        GOUT(59, _g3_3(gx+6, gy+42, gz+3));
+        GOUT(60, _g3_3(gx+9, gy+36, gz+6));
+        GOUT(61, _g3_3(gx+6, gy+39, gz+6));
+        GOUT(62, _g3_3(gx+6, gy+36, gz+9));
+        GOUT(63, _g3_3(gx+3, gy+48, gz+0));
+        GOUT(64, _g2_3(gy+51, gz+0));
+        GOUT(65, _g2_3(gy+48, gz+3));
+        GOUT(66, _g3_3(gx+3, gy+42, gz+6));
+        GOUT(67, _g2_3(gy+45, gz+6));
+        GOUT(68, _g2_3(gy+42, gz+9));
+        GOUT(69, _g3_3(gx+3, gy+36, gz+12));
+        GOUT(70, _g2_3(gy+39, gz+12));
+        GOUT(71, _g2_3(gy+36, gz+15));
+        GOUT(72, _g3_3(gx+15, gy+18, gz+18));
+        GOUT(73, _g3_3(gx+12, gy+21, gz+18));
+        GOUT(74, _g3_3(gx+12, gy+18, gz+21));
+        GOUT(75, _g3_3(gx+9, gy+24, gz+18));
+        GOUT(76, _g3_3(gx+6, gy+27, gz+18));
+        GOUT(77, _g3_3(gx+6, gy+24, gz+21));
+        GOUT(78, _g3_3(gx+9, gy+18, gz+24));
+        GOUT(79, _g3_3(gx+6, gy+21, gz+24));
+        GOUT(80, _g3_3(gx+6, gy+18, gz+27));
+        GOUT(81, _g3_3(gx+3, gy+30, gz+18));
+        GOUT(82, _g2_3(gy+33, gz+18));
+        GOUT(83, _g2_3(gy+30, gz+21));
+        GOUT(84, _g3_3(gx+3, gy+24, gz+24));
+        GOUT(85, _g2_3(gy+27, gz+24));
+        GOUT(86, _g2_3(gy+24, gz+27));
+        GOUT(87, _g3_3(gx+3, gy+18, gz+30));
+        GOUT(88, _g2_3(gy+21, gz+30));
+        GOUT(89, _g2_3(gy+18, gz+33));
+        GOUT(90, _g2_3(gx+15, gz+36));
+        GOUT(91, _g3_3(gx+12, gy+3, gz+36));
+        GOUT(92, _g2_3(gx+12, gz+39));
+        GOUT(93, _g3_3(gx+9, gy+6, gz+36));
+        GOUT(94, _g3_3(gx+6, gy+9, gz+36));
+        GOUT(95, _g3_3(gx+6, gy+6, gz+39));
+        GOUT(96, _g2_3(gx+9, gz+42));
+        GOUT(97, _g3_3(gx+6, gy+3, gz+42));
+        GOUT(98, _g2_3(gx+6, gz+45));
+        GOUT(99, _g3_3(gx+3, gy+12, gz+36));
+        GOUT(100, _g2_3(gy+15, gz+36));
+        GOUT(101, _g2_3(gy+12, gz+39));
+        GOUT(102, _g3_3(gx+3, gy+6, gz+42));
+        GOUT(103, _g2_3(gy+9, gz+42));
+        GOUT(104, _g2_3(gy+6, gz+45));
+        GOUT(105, _g2_3(gx+3, gz+48));
+        GOUT(106, _g2_3(gy+3, gz+48));
+        GOUT(107, _g1_3(gz+51));
+}
+
+static void _g0_2d4d_1221(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 256;
+        double *gz = g + 512;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 4; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+64] = c00x;
+                gx[n+4] = rx + gx[n+64];
+                gx[n+8] = c0px;
+                gx[n+72] = c00x * gx[n+8] + b00;
+                gx[n+12] = rx * gx[n+8] + gx[n+72];
+                gx[n+16] = c0px * gx[n+8] + b01;
+                gx[n+80] = c00x * gx[n+16] + 2 * b00 * gx[n+8];
+                gx[n+20] = rx * gx[n+16] + gx[n+80];
+                gx[n+32] = sx + gx[n+8];
+                gx[n+96] = sx * gx[n+64] + gx[n+72];
+                gx[n+36] = rx * gx[n+32] + gx[n+96];
+                gx[n+40] = sx * gx[n+8] + gx[n+16];
+                gx[n+104] = sx * gx[n+72] + gx[n+80];
+                gx[n+44] = rx * gx[n+40] + gx[n+104];
+                gx[n+24] = c0px * gx[n+16] + 2 * b01 * gx[n+8];
+                gx[n+48] = sx * gx[n+16] + gx[n+24];
+                gx[n+88] = c00x * gx[n+24] + 3 * b00 * gx[n+16];
+                gx[n+112] = sx * gx[n+80] + gx[n+88];
+                gx[n+52] = rx * gx[n+48] + gx[n+112];
+                gx[n+128] = c00x * gx[n+64] + b10;
+                gx[n+68] = rx * gx[n+64] + gx[n+128];
+                gx[n+136] = c00x * gx[n+72] + b10 * gx[n+8] + b00 * gx[n+64];
+                gx[n+76] = rx * gx[n+72] + gx[n+136];
+                gx[n+144] = c00x * gx[n+80] + b10 * gx[n+16] + 2 * b00 * gx[n+72];
+                gx[n+84] = rx * gx[n+80] + gx[n+144];
+                gx[n+160] = sx * gx[n+128] + gx[n+136];
+                gx[n+100] = rx * gx[n+96] + gx[n+160];
+                gx[n+168] = sx * gx[n+136] + gx[n+144];
+                gx[n+108] = rx * gx[n+104] + gx[n+168];
+                gx[n+152] = c00x * gx[n+88] + b10 * gx[n+24] + 3 * b00 * gx[n+80];
+                gx[n+176] = sx * gx[n+144] + gx[n+152];
+                gx[n+116] = rx * gx[n+112] + gx[n+176];
+                gx[n+192] = c00x * gx[n+128] + 2 * b10 * gx[n+64];
+                gx[n+132] = rx * gx[n+128] + gx[n+192];
+                gx[n+200] = c00x * gx[n+136] + 2 * b10 * gx[n+72] + b00 * gx[n+128];
+                gx[n+140] = rx * gx[n+136] + gx[n+200];
+                gx[n+208] = c00x * gx[n+144] + 2 * b10 * gx[n+80] + 2 * b00 * gx[n+136];
+                gx[n+148] = rx * gx[n+144] + gx[n+208];
+                gx[n+224] = sx * gx[n+192] + gx[n+200];
+                gx[n+164] = rx * gx[n+160] + gx[n+224];
+                gx[n+232] = sx * gx[n+200] + gx[n+208];
+                gx[n+172] = rx * gx[n+168] + gx[n+232];
+                gx[n+216] = c00x * gx[n+152] + 2 * b10 * gx[n+88] + 3 * b00 * gx[n+144];
+                gx[n+240] = sx * gx[n+208] + gx[n+216];
+                gx[n+180] = rx * gx[n+176] + gx[n+240];
+                gy[n+64] = c00y;
+                gy[n+4] = ry + gy[n+64];
+                gy[n+8] = c0py;
+                gy[n+72] = c00y * gy[n+8] + b00;
+                gy[n+12] = ry * gy[n+8] + gy[n+72];
+                gy[n+16] = c0py * gy[n+8] + b01;
+                gy[n+80] = c00y * gy[n+16] + 2 * b00 * gy[n+8];
+                gy[n+20] = ry * gy[n+16] + gy[n+80];
+                gy[n+32] = sy + gy[n+8];
+                gy[n+96] = sy * gy[n+64] + gy[n+72];
+                gy[n+36] = ry * gy[n+32] + gy[n+96];
+                gy[n+40] = sy * gy[n+8] + gy[n+16];
+                gy[n+104] = sy * gy[n+72] + gy[n+80];
+                gy[n+44] = ry * gy[n+40] + gy[n+104];
+                gy[n+24] = c0py * gy[n+16] + 2 * b01 * gy[n+8];
+                gy[n+48] = sy * gy[n+16] + gy[n+24];
+                gy[n+88] = c00y * gy[n+24] + 3 * b00 * gy[n+16];
+                gy[n+112] = sy * gy[n+80] + gy[n+88];
+                gy[n+52] = ry * gy[n+48] + gy[n+112];
+                gy[n+128] = c00y * gy[n+64] + b10;
+                gy[n+68] = ry * gy[n+64] + gy[n+128];
+                gy[n+136] = c00y * gy[n+72] + b10 * gy[n+8] + b00 * gy[n+64];
+                gy[n+76] = ry * gy[n+72] + gy[n+136];
+                gy[n+144] = c00y * gy[n+80] + b10 * gy[n+16] + 2 * b00 * gy[n+72];
+                gy[n+84] = ry * gy[n+80] + gy[n+144];
+                gy[n+160] = sy * gy[n+128] + gy[n+136];
+                gy[n+100] = ry * gy[n+96] + gy[n+160];
+                gy[n+168] = sy * gy[n+136] + gy[n+144];
+                gy[n+108] = ry * gy[n+104] + gy[n+168];
+                gy[n+152] = c00y * gy[n+88] + b10 * gy[n+24] + 3 * b00 * gy[n+80];
+                gy[n+176] = sy * gy[n+144] + gy[n+152];
+                gy[n+116] = ry * gy[n+112] + gy[n+176];
+                gy[n+192] = c00y * gy[n+128] + 2 * b10 * gy[n+64];
+                gy[n+132] = ry * gy[n+128] + gy[n+192];
+                gy[n+200] = c00y * gy[n+136] + 2 * b10 * gy[n+72] + b00 * gy[n+128];
+                gy[n+140] = ry * gy[n+136] + gy[n+200];
+                gy[n+208] = c00y * gy[n+144] + 2 * b10 * gy[n+80] + 2 * b00 * gy[n+136];
+                gy[n+148] = ry * gy[n+144] + gy[n+208];
+                gy[n+224] = sy * gy[n+192] + gy[n+200];
+                gy[n+164] = ry * gy[n+160] + gy[n+224];
+                gy[n+232] = sy * gy[n+200] + gy[n+208];
+                gy[n+172] = ry * gy[n+168] + gy[n+232];
+                gy[n+216] = c00y * gy[n+152] + 2 * b10 * gy[n+88] + 3 * b00 * gy[n+144];
+                gy[n+240] = sy * gy[n+208] + gy[n+216];
+                gy[n+180] = ry * gy[n+176] + gy[n+240];
+                gz[n+64] = c00z * gz[n+0];
+                gz[n+4] = rz * gz[n+0] + gz[n+64];
+                gz[n+8] = c0pz * gz[n+0];
+                gz[n+72] = c00z * gz[n+8] + b00 * gz[n+0];
+                gz[n+12] = rz * gz[n+8] + gz[n+72];
+                gz[n+16] = c0pz * gz[n+8] + b01 * gz[n+0];
+                gz[n+80] = c00z * gz[n+16] + 2 * b00 * gz[n+8];
+                gz[n+20] = rz * gz[n+16] + gz[n+80];
+                gz[n+32] = sz * gz[n+0] + gz[n+8];
+                gz[n+96] = sz * gz[n+64] + gz[n+72];
+                gz[n+36] = rz * gz[n+32] + gz[n+96];
+                gz[n+40] = sz * gz[n+8] + gz[n+16];
+                gz[n+104] = sz * gz[n+72] + gz[n+80];
+                gz[n+44] = rz * gz[n+40] + gz[n+104];
+                gz[n+24] = c0pz * gz[n+16] + 2 * b01 * gz[n+8];
+                gz[n+48] = sz * gz[n+16] + gz[n+24];
+                gz[n+88] = c00z * gz[n+24] + 3 * b00 * gz[n+16];
+                gz[n+112] = sz * gz[n+80] + gz[n+88];
+                gz[n+52] = rz * gz[n+48] + gz[n+112];
+                gz[n+128] = c00z * gz[n+64] + b10 * gz[n+0];
+                gz[n+68] = rz * gz[n+64] + gz[n+128];
+                gz[n+136] = c00z * gz[n+72] + b10 * gz[n+8] + b00 * gz[n+64];
+                gz[n+76] = rz * gz[n+72] + gz[n+136];
+                gz[n+144] = c00z * gz[n+80] + b10 * gz[n+16] + 2 * b00 * gz[n+72];
+                gz[n+84] = rz * gz[n+80] + gz[n+144];
+                gz[n+160] = sz * gz[n+128] + gz[n+136];
+                gz[n+100] = rz * gz[n+96] + gz[n+160];
+                gz[n+168] = sz * gz[n+136] + gz[n+144];
+                gz[n+108] = rz * gz[n+104] + gz[n+168];
+                gz[n+152] = c00z * gz[n+88] + b10 * gz[n+24] + 3 * b00 * gz[n+80];
+                gz[n+176] = sz * gz[n+144] + gz[n+152];
+                gz[n+116] = rz * gz[n+112] + gz[n+176];
+                gz[n+192] = c00z * gz[n+128] + 2 * b10 * gz[n+64];
+                gz[n+132] = rz * gz[n+128] + gz[n+192];
+                gz[n+200] = c00z * gz[n+136] + 2 * b10 * gz[n+72] + b00 * gz[n+128];
+                gz[n+140] = rz * gz[n+136] + gz[n+200];
+                gz[n+208] = c00z * gz[n+144] + 2 * b10 * gz[n+80] + 2 * b00 * gz[n+136];
+                gz[n+148] = rz * gz[n+144] + gz[n+208];
+                gz[n+224] = sz * gz[n+192] + gz[n+200];
+                gz[n+164] = rz * gz[n+160] + gz[n+224];
+                gz[n+232] = sz * gz[n+200] + gz[n+208];
+                gz[n+172] = rz * gz[n+168] + gz[n+232];
+                gz[n+216] = c00z * gz[n+152] + 2 * b10 * gz[n+88] + 3 * b00 * gz[n+144];
+                gz[n+240] = sz * gz[n+208] + gz[n+216];
+                gz[n+180] = rz * gz[n+176] + gz[n+240];
+        }
+}
+static void _gout_1221(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 256;
+        double *gz = g + 512;
+        GOUT(0, _g2_4(gx+180, gz+0));
+        GOUT(1, _g3_4(gx+176, gy+4, gz+0));
+        GOUT(2, _g2_4(gx+176, gz+4));
+        GOUT(3, _g3_4(gx+172, gy+8, gz+0));
+        GOUT(4, _g3_4(gx+168, gy+12, gz+0));
+        GOUT(5, _g3_4(gx+168, gy+8, gz+4));
+        GOUT(6, _g2_4(gx+172, gz+8));
+        GOUT(7, _g3_4(gx+168, gy+4, gz+8));
+        GOUT(8, _g2_4(gx+168, gz+12));
+        GOUT(9, _g3_4(gx+164, gy+16, gz+0));
+        GOUT(10, _g3_4(gx+160, gy+20, gz+0));
+        GOUT(11, _g3_4(gx+160, gy+16, gz+4));
+        GOUT(12, _g3_4(gx+164, gy+8, gz+8));
+        GOUT(13, _g3_4(gx+160, gy+12, gz+8));
+        GOUT(14, _g3_4(gx+160, gy+8, gz+12));
+        GOUT(15, _g2_4(gx+164, gz+16));
+        GOUT(16, _g3_4(gx+160, gy+4, gz+16));
+        GOUT(17, _g2_4(gx+160, gz+20));
+        GOUT(18, _g3_4(gx+148, gy+32, gz+0));
+        GOUT(19, _g3_4(gx+144, gy+36, gz+0));
+        GOUT(20, _g3_4(gx+144, gy+32, gz+4));
+        GOUT(21, _g3_4(gx+140, gy+40, gz+0));
+        GOUT(22, _g3_4(gx+136, gy+44, gz+0));
+        GOUT(23, _g3_4(gx+136, gy+40, gz+4));
+        GOUT(24, _g3_4(gx+140, gy+32, gz+8));
+        GOUT(25, _g3_4(gx+136, gy+36, gz+8));
+        GOUT(26, _g3_4(gx+136, gy+32, gz+12));
+        GOUT(27, _g3_4(gx+132, gy+48, gz+0));
+        GOUT(28, _g3_4(gx+128, gy+52, gz+0));
+        GOUT(29, _g3_4(gx+128, gy+48, gz+4));
+        GOUT(30, _g3_4(gx+132, gy+40, gz+8));
+        GOUT(31, _g3_4(gx+128, gy+44, gz+8));
+        GOUT(32, _g3_4(gx+128, gy+40, gz+12));
+        GOUT(33, _g3_4(gx+132, gy+32, gz+16));
+        GOUT(34, _g3_4(gx+128, gy+36, gz+16));
+        GOUT(35, _g3_4(gx+128, gy+32, gz+20));
+        GOUT(36, _g2_4(gx+148, gz+32));
+        GOUT(37, _g3_4(gx+144, gy+4, gz+32));
+        GOUT(38, _g2_4(gx+144, gz+36));
+        GOUT(39, _g3_4(gx+140, gy+8, gz+32));
+        GOUT(40, _g3_4(gx+136, gy+12, gz+32));
+        GOUT(41, _g3_4(gx+136, gy+8, gz+36));
+        GOUT(42, _g2_4(gx+140, gz+40));
+        GOUT(43, _g3_4(gx+136, gy+4, gz+40));
+        GOUT(44, _g2_4(gx+136, gz+44));
+        GOUT(45, _g3_4(gx+132, gy+16, gz+32));
+        GOUT(46, _g3_4(gx+128, gy+20, gz+32));
+        GOUT(47, _g3_4(gx+128, gy+16, gz+36));
+        GOUT(48, _g3_4(gx+132, gy+8, gz+40));
+        GOUT(49, _g3_4(gx+128, gy+12, gz+40));
+        GOUT(50, _g3_4(gx+128, gy+8, gz+44));
+        GOUT(51, _g2_4(gx+132, gz+48));
+        GOUT(52, _g3_4(gx+128, gy+4, gz+48));
+        GOUT(53, _g2_4(gx+128, gz+52));
+        GOUT(54, _g3_4(gx+116, gy+64, gz+0));
+        GOUT(55, _g3_4(gx+112, gy+68, gz+0));
+        GOUT(56, _g3_4(gx+112, gy+64, gz+4));
+        GOUT(57, _g3_4(gx+108, gy+72, gz+0));
+        GOUT(58, _g3_4(gx+104, gy+76, gz+0));
+        GOUT(59, _g3_4(gx+104, gy+72, gz+4));
+        GOUT(60, _g3_4(gx+108, gy+64, gz+8));
+        GOUT(61, _g3_4(gx+104, gy+68, gz+8));
+        GOUT(62, _g3_4(gx+104, gy+64, gz+12));
+        GOUT(63, _g3_4(gx+100, gy+80, gz+0));
+        GOUT(64, _g3_4(gx+96, gy+84, gz+0));
+        GOUT(65, _g3_4(gx+96, gy+80, gz+4));
+        GOUT(66, _g3_4(gx+100, gy+72, gz+8));
+        GOUT(67, _g3_4(gx+96, gy+76, gz+8));
+        GOUT(68, _g3_4(gx+96, gy+72, gz+12));
+        GOUT(69, _g3_4(gx+100, gy+64, gz+16));
+        GOUT(70, _g3_4(gx+96, gy+68, gz+16));
+        GOUT(71, _g3_4(gx+96, gy+64, gz+20));
+        GOUT(72, _g3_4(gx+84, gy+96, gz+0));
+        GOUT(73, _g3_4(gx+80, gy+100, gz+0));
+        GOUT(74, _g3_4(gx+80, gy+96, gz+4));
+        GOUT(75, _g3_4(gx+76, gy+104, gz+0));
+        GOUT(76, _g3_4(gx+72, gy+108, gz+0));
+        GOUT(77, _g3_4(gx+72, gy+104, gz+4));
+        GOUT(78, _g3_4(gx+76, gy+96, gz+8));
+        GOUT(79, _g3_4(gx+72, gy+100, gz+8));
+        GOUT(80, _g3_4(gx+72, gy+96, gz+12));
+        GOUT(81, _g3_4(gx+68, gy+112, gz+0));
+        GOUT(82, _g3_4(gx+64, gy+116, gz+0));
+        GOUT(83, _g3_4(gx+64, gy+112, gz+4));
+        GOUT(84, _g3_4(gx+68, gy+104, gz+8));
+        GOUT(85, _g3_4(gx+64, gy+108, gz+8));
+        GOUT(86, _g3_4(gx+64, gy+104, gz+12));
+        GOUT(87, _g3_4(gx+68, gy+96, gz+16));
+        GOUT(88, _g3_4(gx+64, gy+100, gz+16));
+        GOUT(89, _g3_4(gx+64, gy+96, gz+20));
+        GOUT(90, _g3_4(gx+84, gy+64, gz+32));
+        GOUT(91, _g3_4(gx+80, gy+68, gz+32));
+        GOUT(92, _g3_4(gx+80, gy+64, gz+36));
+        GOUT(93, _g3_4(gx+76, gy+72, gz+32));
+        GOUT(94, _g3_4(gx+72, gy+76, gz+32));
+        GOUT(95, _g3_4(gx+72, gy+72, gz+36));
+        GOUT(96, _g3_4(gx+76, gy+64, gz+40));
+        GOUT(97, _g3_4(gx+72, gy+68, gz+40));
+        GOUT(98, _g3_4(gx+72, gy+64, gz+44));
+        GOUT(99, _g3_4(gx+68, gy+80, gz+32));
+        GOUT(100, _g3_4(gx+64, gy+84, gz+32));
+        GOUT(101, _g3_4(gx+64, gy+80, gz+36));
+        GOUT(102, _g3_4(gx+68, gy+72, gz+40));
+        GOUT(103, _g3_4(gx+64, gy+76, gz+40));
+        GOUT(104, _g3_4(gx+64, gy+72, gz+44));
+        GOUT(105, _g3_4(gx+68, gy+64, gz+48));
+        GOUT(106, _g3_4(gx+64, gy+68, gz+48));
+        GOUT(107, _g3_4(gx+64, gy+64, gz+52));
+        GOUT(108, _g2_4(gx+116, gz+64));
+        GOUT(109, _g3_4(gx+112, gy+4, gz+64));
+        GOUT(110, _g2_4(gx+112, gz+68));
+        GOUT(111, _g3_4(gx+108, gy+8, gz+64));
+        GOUT(112, _g3_4(gx+104, gy+12, gz+64));
+        GOUT(113, _g3_4(gx+104, gy+8, gz+68));
+        GOUT(114, _g2_4(gx+108, gz+72));
+        GOUT(115, _g3_4(gx+104, gy+4, gz+72));
+        GOUT(116, _g2_4(gx+104, gz+76));
+        GOUT(117, _g3_4(gx+100, gy+16, gz+64));
+        GOUT(118, _g3_4(gx+96, gy+20, gz+64));
+        GOUT(119, _g3_4(gx+96, gy+16, gz+68));
+        GOUT(120, _g3_4(gx+100, gy+8, gz+72));
+        GOUT(121, _g3_4(gx+96, gy+12, gz+72));
+        GOUT(122, _g3_4(gx+96, gy+8, gz+76));
+        GOUT(123, _g2_4(gx+100, gz+80));
+        GOUT(124, _g3_4(gx+96, gy+4, gz+80));
+        GOUT(125, _g2_4(gx+96, gz+84));
+        GOUT(126, _g3_4(gx+84, gy+32, gz+64));
+        GOUT(127, _g3_4(gx+80, gy+36, gz+64));
+        GOUT(128, _g3_4(gx+80, gy+32, gz+68));
+        GOUT(129, _g3_4(gx+76, gy+40, gz+64));
+        GOUT(130, _g3_4(gx+72, gy+44, gz+64));
+        GOUT(131, _g3_4(gx+72, gy+40, gz+68));
+        GOUT(132, _g3_4(gx+76, gy+32, gz+72));
+        GOUT(133, _g3_4(gx+72, gy+36, gz+72));
+        GOUT(134, _g3_4(gx+72, gy+32, gz+76));
+        GOUT(135, _g3_4(gx+68, gy+48, gz+64));
+        GOUT(136, _g3_4(gx+64, gy+52, gz+64));
+        GOUT(137, _g3_4(gx+64, gy+48, gz+68));
+        GOUT(138, _g3_4(gx+68, gy+40, gz+72));
+        GOUT(139, _g3_4(gx+64, gy+44, gz+72));
+        GOUT(140, _g3_4(gx+64, gy+40, gz+76));
+        GOUT(141, _g3_4(gx+68, gy+32, gz+80));
+        GOUT(142, _g3_4(gx+64, gy+36, gz+80));
+        GOUT(143, _g3_4(gx+64, gy+32, gz+84));
+        GOUT(144, _g2_4(gx+84, gz+96));
+        GOUT(145, _g3_4(gx+80, gy+4, gz+96));
+        GOUT(146, _g2_4(gx+80, gz+100));
+        GOUT(147, _g3_4(gx+76, gy+8, gz+96));
+        GOUT(148, _g3_4(gx+72, gy+12, gz+96));
+        GOUT(149, _g3_4(gx+72, gy+8, gz+100));
+        GOUT(150, _g2_4(gx+76, gz+104));
+        GOUT(151, _g3_4(gx+72, gy+4, gz+104));
+        GOUT(152, _g2_4(gx+72, gz+108));
+        GOUT(153, _g3_4(gx+68, gy+16, gz+96));
+        GOUT(154, _g3_4(gx+64, gy+20, gz+96));
+        GOUT(155, _g3_4(gx+64, gy+16, gz+100));
+        GOUT(156, _g3_4(gx+68, gy+8, gz+104));
+        GOUT(157, _g3_4(gx+64, gy+12, gz+104));
+        GOUT(158, _g3_4(gx+64, gy+8, gz+108));
+        GOUT(159, _g2_4(gx+68, gz+112));
+        GOUT(160, _g3_4(gx+64, gy+4, gz+112));
+        GOUT(161, _g2_4(gx+64, gz+116));
+        GOUT(162, _g3_4(gx+52, gy+128, gz+0));
+        GOUT(163, _g3_4(gx+48, gy+132, gz+0));
+        GOUT(164, _g3_4(gx+48, gy+128, gz+4));
+        GOUT(165, _g3_4(gx+44, gy+136, gz+0));
+        GOUT(166, _g3_4(gx+40, gy+140, gz+0));
+        GOUT(167, _g3_4(gx+40, gy+136, gz+4));
+        GOUT(168, _g3_4(gx+44, gy+128, gz+8));
+        GOUT(169, _g3_4(gx+40, gy+132, gz+8));
+        GOUT(170, _g3_4(gx+40, gy+128, gz+12));
+        GOUT(171, _g3_4(gx+36, gy+144, gz+0));
+        GOUT(172, _g3_4(gx+32, gy+148, gz+0));
+        GOUT(173, _g3_4(gx+32, gy+144, gz+4));
+        GOUT(174, _g3_4(gx+36, gy+136, gz+8));
+        GOUT(175, _g3_4(gx+32, gy+140, gz+8));
+        GOUT(176, _g3_4(gx+32, gy+136, gz+12));
+        GOUT(177, _g3_4(gx+36, gy+128, gz+16));
+        GOUT(178, _g3_4(gx+32, gy+132, gz+16));
+        GOUT(179, _g3_4(gx+32, gy+128, gz+20));
+        GOUT(180, _g3_4(gx+20, gy+160, gz+0));
+        GOUT(181, _g3_4(gx+16, gy+164, gz+0));
+        GOUT(182, _g3_4(gx+16, gy+160, gz+4));
+        GOUT(183, _g3_4(gx+12, gy+168, gz+0));
+        GOUT(184, _g3_4(gx+8, gy+172, gz+0));
+        GOUT(185, _g3_4(gx+8, gy+168, gz+4));
+        GOUT(186, _g3_4(gx+12, gy+160, gz+8));
+        GOUT(187, _g3_4(gx+8, gy+164, gz+8));
+        GOUT(188, _g3_4(gx+8, gy+160, gz+12));
+        GOUT(189, _g3_4(gx+4, gy+176, gz+0));
+        GOUT(190, _g2_4(gy+180, gz+0));
+        GOUT(191, _g2_4(gy+176, gz+4));
+        GOUT(192, _g3_4(gx+4, gy+168, gz+8));
+        GOUT(193, _g2_4(gy+172, gz+8));
+        GOUT(194, _g2_4(gy+168, gz+12));
+        GOUT(195, _g3_4(gx+4, gy+160, gz+16));
+        GOUT(196, _g2_4(gy+164, gz+16));
+        GOUT(197, _g2_4(gy+160, gz+20));
+        GOUT(198, _g3_4(gx+20, gy+128, gz+32));
+        GOUT(199, _g3_4(gx+16, gy+132, gz+32));
+        GOUT(200, _g3_4(gx+16, gy+128, gz+36));
+        GOUT(201, _g3_4(gx+12, gy+136, gz+32));
+        GOUT(202, _g3_4(gx+8, gy+140, gz+32));
+        GOUT(203, _g3_4(gx+8, gy+136, gz+36));
+        GOUT(204, _g3_4(gx+12, gy+128, gz+40));
+        GOUT(205, _g3_4(gx+8, gy+132, gz+40));
+        GOUT(206, _g3_4(gx+8, gy+128, gz+44));
+        GOUT(207, _g3_4(gx+4, gy+144, gz+32));
+        GOUT(208, _g2_4(gy+148, gz+32));
+        GOUT(209, _g2_4(gy+144, gz+36));
+        GOUT(210, _g3_4(gx+4, gy+136, gz+40));
+        GOUT(211, _g2_4(gy+140, gz+40));
+        GOUT(212, _g2_4(gy+136, gz+44));
+        GOUT(213, _g3_4(gx+4, gy+128, gz+48));
+        GOUT(214, _g2_4(gy+132, gz+48));
+        GOUT(215, _g2_4(gy+128, gz+52));
+        GOUT(216, _g3_4(gx+52, gy+64, gz+64));
+        GOUT(217, _g3_4(gx+48, gy+68, gz+64));
+        GOUT(218, _g3_4(gx+48, gy+64, gz+68));
+        GOUT(219, _g3_4(gx+44, gy+72, gz+64));
+        GOUT(220, _g3_4(gx+40, gy+76, gz+64));
+        GOUT(221, _g3_4(gx+40, gy+72, gz+68));
+        GOUT(222, _g3_4(gx+44, gy+64, gz+72));
+        GOUT(223, _g3_4(gx+40, gy+68, gz+72));
+        GOUT(224, _g3_4(gx+40, gy+64, gz+76));
+        GOUT(225, _g3_4(gx+36, gy+80, gz+64));
+        GOUT(226, _g3_4(gx+32, gy+84, gz+64));
+        GOUT(227, _g3_4(gx+32, gy+80, gz+68));
+        GOUT(228, _g3_4(gx+36, gy+72, gz+72));
+        GOUT(229, _g3_4(gx+32, gy+76, gz+72));
+        GOUT(230, _g3_4(gx+32, gy+72, gz+76));
+        GOUT(231, _g3_4(gx+36, gy+64, gz+80));
+        GOUT(232, _g3_4(gx+32, gy+68, gz+80));
+        GOUT(233, _g3_4(gx+32, gy+64, gz+84));
+        GOUT(234, _g3_4(gx+20, gy+96, gz+64));
+        GOUT(235, _g3_4(gx+16, gy+100, gz+64));
+        GOUT(236, _g3_4(gx+16, gy+96, gz+68));
+        GOUT(237, _g3_4(gx+12, gy+104, gz+64));
+        GOUT(238, _g3_4(gx+8, gy+108, gz+64));
+        GOUT(239, _g3_4(gx+8, gy+104, gz+68));
+        GOUT(240, _g3_4(gx+12, gy+96, gz+72));
+        GOUT(241, _g3_4(gx+8, gy+100, gz+72));
+        GOUT(242, _g3_4(gx+8, gy+96, gz+76));
+        GOUT(243, _g3_4(gx+4, gy+112, gz+64));
+        GOUT(244, _g2_4(gy+116, gz+64));
+        GOUT(245, _g2_4(gy+112, gz+68));
+        GOUT(246, _g3_4(gx+4, gy+104, gz+72));
+        GOUT(247, _g2_4(gy+108, gz+72));
+        GOUT(248, _g2_4(gy+104, gz+76));
+        GOUT(249, _g3_4(gx+4, gy+96, gz+80));
+        GOUT(250, _g2_4(gy+100, gz+80));
+        GOUT(251, _g2_4(gy+96, gz+84));
+        GOUT(252, _g3_4(gx+20, gy+64, gz+96));
+        GOUT(253, _g3_4(gx+16, gy+68, gz+96));
+        GOUT(254, _g3_4(gx+16, gy+64, gz+100));
+        GOUT(255, _g3_4(gx+12, gy+72, gz+96));
+        GOUT(256, _g3_4(gx+8, gy+76, gz+96));
+        GOUT(257, _g3_4(gx+8, gy+72, gz+100));
+        GOUT(258, _g3_4(gx+12, gy+64, gz+104));
+        GOUT(259, _g3_4(gx+8, gy+68, gz+104));
+        GOUT(260, _g3_4(gx+8, gy+64, gz+108));
+        GOUT(261, _g3_4(gx+4, gy+80, gz+96));
+        GOUT(262, _g2_4(gy+84, gz+96));
+        GOUT(263, _g2_4(gy+80, gz+100));
+        GOUT(264, _g3_4(gx+4, gy+72, gz+104));
+        GOUT(265, _g2_4(gy+76, gz+104));
+        GOUT(266, _g2_4(gy+72, gz+108));
+        GOUT(267, _g3_4(gx+4, gy+64, gz+112));
+        GOUT(268, _g2_4(gy+68, gz+112));
+        GOUT(269, _g2_4(gy+64, gz+116));
+        GOUT(270, _g2_4(gx+52, gz+128));
+        GOUT(271, _g3_4(gx+48, gy+4, gz+128));
+        GOUT(272, _g2_4(gx+48, gz+132));
+        GOUT(273, _g3_4(gx+44, gy+8, gz+128));
+        GOUT(274, _g3_4(gx+40, gy+12, gz+128));
+        GOUT(275, _g3_4(gx+40, gy+8, gz+132));
+        GOUT(276, _g2_4(gx+44, gz+136));
+        GOUT(277, _g3_4(gx+40, gy+4, gz+136));
+        GOUT(278, _g2_4(gx+40, gz+140));
+        GOUT(279, _g3_4(gx+36, gy+16, gz+128));
+        GOUT(280, _g3_4(gx+32, gy+20, gz+128));
+        GOUT(281, _g3_4(gx+32, gy+16, gz+132));
+        GOUT(282, _g3_4(gx+36, gy+8, gz+136));
+        GOUT(283, _g3_4(gx+32, gy+12, gz+136));
+        GOUT(284, _g3_4(gx+32, gy+8, gz+140));
+        GOUT(285, _g2_4(gx+36, gz+144));
+        GOUT(286, _g3_4(gx+32, gy+4, gz+144));
+        GOUT(287, _g2_4(gx+32, gz+148));
+        GOUT(288, _g3_4(gx+20, gy+32, gz+128));
+        GOUT(289, _g3_4(gx+16, gy+36, gz+128));
+        GOUT(290, _g3_4(gx+16, gy+32, gz+132));
+        GOUT(291, _g3_4(gx+12, gy+40, gz+128));
+        GOUT(292, _g3_4(gx+8, gy+44, gz+128));
+        GOUT(293, _g3_4(gx+8, gy+40, gz+132));
+        GOUT(294, _g3_4(gx+12, gy+32, gz+136));
+        GOUT(295, _g3_4(gx+8, gy+36, gz+136));
+        GOUT(296, _g3_4(gx+8, gy+32, gz+140));
+        GOUT(297, _g3_4(gx+4, gy+48, gz+128));
+        GOUT(298, _g2_4(gy+52, gz+128));
+        GOUT(299, _g2_4(gy+48, gz+132));
+        GOUT(300, _g3_4(gx+4, gy+40, gz+136));
+        GOUT(301, _g2_4(gy+44, gz+136));
+        GOUT(302, _g2_4(gy+40, gz+140));
+        GOUT(303, _g3_4(gx+4, gy+32, gz+144));
+        GOUT(304, _g2_4(gy+36, gz+144));
+        GOUT(305, _g2_4(gy+32, gz+148));
+        GOUT(306, _g2_4(gx+20, gz+160));
+        GOUT(307, _g3_4(gx+16, gy+4, gz+160));
+        GOUT(308, _g2_4(gx+16, gz+164));
+        GOUT(309, _g3_4(gx+12, gy+8, gz+160));
+        GOUT(310, _g3_4(gx+8, gy+12, gz+160));
+        GOUT(311, _g3_4(gx+8, gy+8, gz+164));
+        GOUT(312, _g2_4(gx+12, gz+168));
+        GOUT(313, _g3_4(gx+8, gy+4, gz+168));
+        GOUT(314, _g2_4(gx+8, gz+172));
+        GOUT(315, _g3_4(gx+4, gy+16, gz+160));
+        GOUT(316, _g2_4(gy+20, gz+160));
+        GOUT(317, _g2_4(gy+16, gz+164));
+        GOUT(318, _g3_4(gx+4, gy+8, gz+168));
+        GOUT(319, _g2_4(gy+12, gz+168));
+        GOUT(320, _g2_4(gy+8, gz+172));
+        GOUT(321, _g2_4(gx+4, gz+176));
+        GOUT(322, _g2_4(gy+4, gz+176));
+        GOUT(323, _g1_4(gz+180));
+}
+
+static void _g0_2d4d_1222(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 480;
+        double *gz = g + 960;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 4; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+120] = c00x;
+                gx[n+4] = rx + gx[n+120];
+                gx[n+24] = c0px;
+                gx[n+8] = sx + gx[n+24];
+                gx[n+144] = c00x * gx[n+24] + b00;
+                gx[n+128] = sx * gx[n+120] + gx[n+144];
+                gx[n+12] = rx * gx[n+8] + gx[n+128];
+                gx[n+48] = c0px * gx[n+24] + b01;
+                gx[n+32] = sx * gx[n+24] + gx[n+48];
+                gx[n+16] = sx * gx[n+8] + gx[n+32];
+                gx[n+168] = c00x * gx[n+48] + 2 * b00 * gx[n+24];
+                gx[n+152] = sx * gx[n+144] + gx[n+168];
+                gx[n+136] = sx * gx[n+128] + gx[n+152];
+                gx[n+20] = rx * gx[n+16] + gx[n+136];
+                gx[n+28] = rx * gx[n+24] + gx[n+144];
+                gx[n+36] = rx * gx[n+32] + gx[n+152];
+                gx[n+72] = c0px * gx[n+48] + 2 * b01 * gx[n+24];
+                gx[n+56] = sx * gx[n+48] + gx[n+72];
+                gx[n+40] = sx * gx[n+32] + gx[n+56];
+                gx[n+192] = c00x * gx[n+72] + 3 * b00 * gx[n+48];
+                gx[n+176] = sx * gx[n+168] + gx[n+192];
+                gx[n+160] = sx * gx[n+152] + gx[n+176];
+                gx[n+44] = rx * gx[n+40] + gx[n+160];
+                gx[n+52] = rx * gx[n+48] + gx[n+168];
+                gx[n+60] = rx * gx[n+56] + gx[n+176];
+                gx[n+96] = c0px * gx[n+72] + 3 * b01 * gx[n+48];
+                gx[n+80] = sx * gx[n+72] + gx[n+96];
+                gx[n+64] = sx * gx[n+56] + gx[n+80];
+                gx[n+216] = c00x * gx[n+96] + 4 * b00 * gx[n+72];
+                gx[n+200] = sx * gx[n+192] + gx[n+216];
+                gx[n+184] = sx * gx[n+176] + gx[n+200];
+                gx[n+68] = rx * gx[n+64] + gx[n+184];
+                gx[n+240] = c00x * gx[n+120] + b10;
+                gx[n+124] = rx * gx[n+120] + gx[n+240];
+                gx[n+264] = c00x * gx[n+144] + b10 * gx[n+24] + b00 * gx[n+120];
+                gx[n+248] = sx * gx[n+240] + gx[n+264];
+                gx[n+132] = rx * gx[n+128] + gx[n+248];
+                gx[n+288] = c00x * gx[n+168] + b10 * gx[n+48] + 2 * b00 * gx[n+144];
+                gx[n+272] = sx * gx[n+264] + gx[n+288];
+                gx[n+256] = sx * gx[n+248] + gx[n+272];
+                gx[n+140] = rx * gx[n+136] + gx[n+256];
+                gx[n+148] = rx * gx[n+144] + gx[n+264];
+                gx[n+156] = rx * gx[n+152] + gx[n+272];
+                gx[n+312] = c00x * gx[n+192] + b10 * gx[n+72] + 3 * b00 * gx[n+168];
+                gx[n+296] = sx * gx[n+288] + gx[n+312];
+                gx[n+280] = sx * gx[n+272] + gx[n+296];
+                gx[n+164] = rx * gx[n+160] + gx[n+280];
+                gx[n+172] = rx * gx[n+168] + gx[n+288];
+                gx[n+180] = rx * gx[n+176] + gx[n+296];
+                gx[n+336] = c00x * gx[n+216] + b10 * gx[n+96] + 4 * b00 * gx[n+192];
+                gx[n+320] = sx * gx[n+312] + gx[n+336];
+                gx[n+304] = sx * gx[n+296] + gx[n+320];
+                gx[n+188] = rx * gx[n+184] + gx[n+304];
+                gx[n+360] = c00x * gx[n+240] + 2 * b10 * gx[n+120];
+                gx[n+244] = rx * gx[n+240] + gx[n+360];
+                gx[n+384] = c00x * gx[n+264] + 2 * b10 * gx[n+144] + b00 * gx[n+240];
+                gx[n+368] = sx * gx[n+360] + gx[n+384];
+                gx[n+252] = rx * gx[n+248] + gx[n+368];
+                gx[n+408] = c00x * gx[n+288] + 2 * b10 * gx[n+168] + 2 * b00 * gx[n+264];
+                gx[n+392] = sx * gx[n+384] + gx[n+408];
+                gx[n+376] = sx * gx[n+368] + gx[n+392];
+                gx[n+260] = rx * gx[n+256] + gx[n+376];
+                gx[n+268] = rx * gx[n+264] + gx[n+384];
+                gx[n+276] = rx * gx[n+272] + gx[n+392];
+                gx[n+432] = c00x * gx[n+312] + 2 * b10 * gx[n+192] + 3 * b00 * gx[n+288];
+                gx[n+416] = sx * gx[n+408] + gx[n+432];
+                gx[n+400] = sx * gx[n+392] + gx[n+416];
+                gx[n+284] = rx * gx[n+280] + gx[n+400];
+                gx[n+292] = rx * gx[n+288] + gx[n+408];
+                gx[n+300] = rx * gx[n+296] + gx[n+416];
+                gx[n+456] = c00x * gx[n+336] + 2 * b10 * gx[n+216] + 4 * b00 * gx[n+312];
+                gx[n+440] = sx * gx[n+432] + gx[n+456];
+                gx[n+424] = sx * gx[n+416] + gx[n+440];
+                gx[n+308] = rx * gx[n+304] + gx[n+424];
+                gy[n+120] = c00y;
+                gy[n+4] = ry + gy[n+120];
+                gy[n+24] = c0py;
+                gy[n+8] = sy + gy[n+24];
+                gy[n+144] = c00y * gy[n+24] + b00;
+                gy[n+128] = sy * gy[n+120] + gy[n+144];
+                gy[n+12] = ry * gy[n+8] + gy[n+128];
+                gy[n+48] = c0py * gy[n+24] + b01;
+                gy[n+32] = sy * gy[n+24] + gy[n+48];
+                gy[n+16] = sy * gy[n+8] + gy[n+32];
+                gy[n+168] = c00y * gy[n+48] + 2 * b00 * gy[n+24];
+                gy[n+152] = sy * gy[n+144] + gy[n+168];
+                gy[n+136] = sy * gy[n+128] + gy[n+152];
+                gy[n+20] = ry * gy[n+16] + gy[n+136];
+                gy[n+28] = ry * gy[n+24] + gy[n+144];
+                gy[n+36] = ry * gy[n+32] + gy[n+152];
+                gy[n+72] = c0py * gy[n+48] + 2 * b01 * gy[n+24];
+                gy[n+56] = sy * gy[n+48] + gy[n+72];
+                gy[n+40] = sy * gy[n+32] + gy[n+56];
+                gy[n+192] = c00y * gy[n+72] + 3 * b00 * gy[n+48];
+                gy[n+176] = sy * gy[n+168] + gy[n+192];
+                gy[n+160] = sy * gy[n+152] + gy[n+176];
+                gy[n+44] = ry * gy[n+40] + gy[n+160];
+                gy[n+52] = ry * gy[n+48] + gy[n+168];
+                gy[n+60] = ry * gy[n+56] + gy[n+176];
+                gy[n+96] = c0py * gy[n+72] + 3 * b01 * gy[n+48];
+                gy[n+80] = sy * gy[n+72] + gy[n+96];
+                gy[n+64] = sy * gy[n+56] + gy[n+80];
+                gy[n+216] = c00y * gy[n+96] + 4 * b00 * gy[n+72];
+                gy[n+200] = sy * gy[n+192] + gy[n+216];
+                gy[n+184] = sy * gy[n+176] + gy[n+200];
+                gy[n+68] = ry * gy[n+64] + gy[n+184];
+                gy[n+240] = c00y * gy[n+120] + b10;
+                gy[n+124] = ry * gy[n+120] + gy[n+240];
+                gy[n+264] = c00y * gy[n+144] + b10 * gy[n+24] + b00 * gy[n+120];
+                gy[n+248] = sy * gy[n+240] + gy[n+264];
+                gy[n+132] = ry * gy[n+128] + gy[n+248];
+                gy[n+288] = c00y * gy[n+168] + b10 * gy[n+48] + 2 * b00 * gy[n+144];
+                gy[n+272] = sy * gy[n+264] + gy[n+288];
+                gy[n+256] = sy * gy[n+248] + gy[n+272];
+                gy[n+140] = ry * gy[n+136] + gy[n+256];
+                gy[n+148] = ry * gy[n+144] + gy[n+264];
+                gy[n+156] = ry * gy[n+152] + gy[n+272];
+                gy[n+312] = c00y * gy[n+192] + b10 * gy[n+72] + 3 * b00 * gy[n+168];
+                gy[n+296] = sy * gy[n+288] + gy[n+312];
+                gy[n+280] = sy * gy[n+272] + gy[n+296];
+                gy[n+164] = ry * gy[n+160] + gy[n+280];
+                gy[n+172] = ry * gy[n+168] + gy[n+288];
+                gy[n+180] = ry * gy[n+176] + gy[n+296];
+                gy[n+336] = c00y * gy[n+216] + b10 * gy[n+96] + 4 * b00 * gy[n+192];
+                gy[n+320] = sy * gy[n+312] + gy[n+336];
+                gy[n+304] = sy * gy[n+296] + gy[n+320];
+                gy[n+188] = ry * gy[n+184] + gy[n+304];
+                gy[n+360] = c00y * gy[n+240] + 2 * b10 * gy[n+120];
+                gy[n+244] = ry * gy[n+240] + gy[n+360];
+                gy[n+384] = c00y * gy[n+264] + 2 * b10 * gy[n+144] + b00 * gy[n+240];
+                gy[n+368] = sy * gy[n+360] + gy[n+384];
+                gy[n+252] = ry * gy[n+248] + gy[n+368];
+                gy[n+408] = c00y * gy[n+288] + 2 * b10 * gy[n+168] + 2 * b00 * gy[n+264];
+                gy[n+392] = sy * gy[n+384] + gy[n+408];
+                gy[n+376] = sy * gy[n+368] + gy[n+392];
+                gy[n+260] = ry * gy[n+256] + gy[n+376];
+                gy[n+268] = ry * gy[n+264] + gy[n+384];
+                gy[n+276] = ry * gy[n+272] + gy[n+392];
+                gy[n+432] = c00y * gy[n+312] + 2 * b10 * gy[n+192] + 3 * b00 * gy[n+288];
+                gy[n+416] = sy * gy[n+408] + gy[n+432];
+                gy[n+400] = sy * gy[n+392] + gy[n+416];
+                gy[n+284] = ry * gy[n+280] + gy[n+400];
+                gy[n+292] = ry * gy[n+288] + gy[n+408];
+                gy[n+300] = ry * gy[n+296] + gy[n+416];
+                gy[n+456] = c00y * gy[n+336] + 2 * b10 * gy[n+216] + 4 * b00 * gy[n+312];
+                gy[n+440] = sy * gy[n+432] + gy[n+456];
+                gy[n+424] = sy * gy[n+416] + gy[n+440];
+                gy[n+308] = ry * gy[n+304] + gy[n+424];
+                gz[n+120] = c00z * gz[n+0];
+                gz[n+4] = rz * gz[n+0] + gz[n+120];
+                gz[n+24] = c0pz * gz[n+0];
+                gz[n+8] = sz * gz[n+0] + gz[n+24];
+                gz[n+144] = c00z * gz[n+24] + b00 * gz[n+0];
+                gz[n+128] = sz * gz[n+120] + gz[n+144];
+                gz[n+12] = rz * gz[n+8] + gz[n+128];
+                gz[n+48] = c0pz * gz[n+24] + b01 * gz[n+0];
+                gz[n+32] = sz * gz[n+24] + gz[n+48];
+                gz[n+16] = sz * gz[n+8] + gz[n+32];
+                gz[n+168] = c00z * gz[n+48] + 2 * b00 * gz[n+24];
+                gz[n+152] = sz * gz[n+144] + gz[n+168];
+                gz[n+136] = sz * gz[n+128] + gz[n+152];
+                gz[n+20] = rz * gz[n+16] + gz[n+136];
+                gz[n+28] = rz * gz[n+24] + gz[n+144];
+                gz[n+36] = rz * gz[n+32] + gz[n+152];
+                gz[n+72] = c0pz * gz[n+48] + 2 * b01 * gz[n+24];
+                gz[n+56] = sz * gz[n+48] + gz[n+72];
+                gz[n+40] = sz * gz[n+32] + gz[n+56];
+                gz[n+192] = c00z * gz[n+72] + 3 * b00 * gz[n+48];
+                gz[n+176] = sz * gz[n+168] + gz[n+192];
+                gz[n+160] = sz * gz[n+152] + gz[n+176];
+                gz[n+44] = rz * gz[n+40] + gz[n+160];
+                gz[n+52] = rz * gz[n+48] + gz[n+168];
+                gz[n+60] = rz * gz[n+56] + gz[n+176];
+                gz[n+96] = c0pz * gz[n+72] + 3 * b01 * gz[n+48];
+                gz[n+80] = sz * gz[n+72] + gz[n+96];
+                gz[n+64] = sz * gz[n+56] + gz[n+80];
+                gz[n+216] = c00z * gz[n+96] + 4 * b00 * gz[n+72];
+                gz[n+200] = sz * gz[n+192] + gz[n+216];
+                gz[n+184] = sz * gz[n+176] + gz[n+200];
+                gz[n+68] = rz * gz[n+64] + gz[n+184];
+                gz[n+240] = c00z * gz[n+120] + b10 * gz[n+0];
+                gz[n+124] = rz * gz[n+120] + gz[n+240];
+                gz[n+264] = c00z * gz[n+144] + b10 * gz[n+24] + b00 * gz[n+120];
+                gz[n+248] = sz * gz[n+240] + gz[n+264];
+                gz[n+132] = rz * gz[n+128] + gz[n+248];
+                gz[n+288] = c00z * gz[n+168] + b10 * gz[n+48] + 2 * b00 * gz[n+144];
+                gz[n+272] = sz * gz[n+264] + gz[n+288];
+                gz[n+256] = sz * gz[n+248] + gz[n+272];
+                gz[n+140] = rz * gz[n+136] + gz[n+256];
+                gz[n+148] = rz * gz[n+144] + gz[n+264];
+                gz[n+156] = rz * gz[n+152] + gz[n+272];
+                gz[n+312] = c00z * gz[n+192] + b10 * gz[n+72] + 3 * b00 * gz[n+168];
+                gz[n+296] = sz * gz[n+288] + gz[n+312];
+                gz[n+280] = sz * gz[n+272] + gz[n+296];
+                gz[n+164] = rz * gz[n+160] + gz[n+280];
+                gz[n+172] = rz * gz[n+168] + gz[n+288];
+                gz[n+180] = rz * gz[n+176] + gz[n+296];
+                gz[n+336] = c00z * gz[n+216] + b10 * gz[n+96] + 4 * b00 * gz[n+192];
+                gz[n+320] = sz * gz[n+312] + gz[n+336];
+                gz[n+304] = sz * gz[n+296] + gz[n+320];
+                gz[n+188] = rz * gz[n+184] + gz[n+304];
+                gz[n+360] = c00z * gz[n+240] + 2 * b10 * gz[n+120];
+                gz[n+244] = rz * gz[n+240] + gz[n+360];
+                gz[n+384] = c00z * gz[n+264] + 2 * b10 * gz[n+144] + b00 * gz[n+240];
+                gz[n+368] = sz * gz[n+360] + gz[n+384];
+                gz[n+252] = rz * gz[n+248] + gz[n+368];
+                gz[n+408] = c00z * gz[n+288] + 2 * b10 * gz[n+168] + 2 * b00 * gz[n+264];
+                gz[n+392] = sz * gz[n+384] + gz[n+408];
+                gz[n+376] = sz * gz[n+368] + gz[n+392];
+                gz[n+260] = rz * gz[n+256] + gz[n+376];
+                gz[n+268] = rz * gz[n+264] + gz[n+384];
+                gz[n+276] = rz * gz[n+272] + gz[n+392];
+                gz[n+432] = c00z * gz[n+312] + 2 * b10 * gz[n+192] + 3 * b00 * gz[n+288];
+                gz[n+416] = sz * gz[n+408] + gz[n+432];
+                gz[n+400] = sz * gz[n+392] + gz[n+416];
+                gz[n+284] = rz * gz[n+280] + gz[n+400];
+                gz[n+292] = rz * gz[n+288] + gz[n+408];
+                gz[n+300] = rz * gz[n+296] + gz[n+416];
+                gz[n+456] = c00z * gz[n+336] + 2 * b10 * gz[n+216] + 4 * b00 * gz[n+312];
+                gz[n+440] = sz * gz[n+432] + gz[n+456];
+                gz[n+424] = sz * gz[n+416] + gz[n+440];
+                gz[n+308] = rz * gz[n+304] + gz[n+424];
+        }
+}
+static void _gout_1222(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 480;
+        double *gz = g + 960;
+        GOUT(0, _g2_4(gx+308, gz+0));
+        GOUT(1, _g3_4(gx+304, gy+4, gz+0));
+        GOUT(2, _g2_4(gx+304, gz+4));
+        GOUT(3, _g3_4(gx+300, gy+8, gz+0));
+        GOUT(4, _g3_4(gx+296, gy+12, gz+0));
+        GOUT(5, _g3_4(gx+296, gy+8, gz+4));
+        GOUT(6, _g2_4(gx+300, gz+8));
+        GOUT(7, _g3_4(gx+296, gy+4, gz+8));
+        GOUT(8, _g2_4(gx+296, gz+12));
+        GOUT(9, _g3_4(gx+292, gy+16, gz+0));
+        GOUT(10, _g3_4(gx+288, gy+20, gz+0));
+        GOUT(11, _g3_4(gx+288, gy+16, gz+4));
+        GOUT(12, _g3_4(gx+292, gy+8, gz+8));
+        GOUT(13, _g3_4(gx+288, gy+12, gz+8));
+        GOUT(14, _g3_4(gx+288, gy+8, gz+12));
+        GOUT(15, _g2_4(gx+292, gz+16));
+        GOUT(16, _g3_4(gx+288, gy+4, gz+16));
+        GOUT(17, _g2_4(gx+288, gz+20));
+        GOUT(18, _g3_4(gx+284, gy+24, gz+0));
+        GOUT(19, _g3_4(gx+280, gy+28, gz+0));
+        GOUT(20, _g3_4(gx+280, gy+24, gz+4));
+        GOUT(21, _g3_4(gx+276, gy+32, gz+0));
+        GOUT(22, _g3_4(gx+272, gy+36, gz+0));
+        GOUT(23, _g3_4(gx+272, gy+32, gz+4));
+        GOUT(24, _g3_4(gx+276, gy+24, gz+8));
+        GOUT(25, _g3_4(gx+272, gy+28, gz+8));
+        GOUT(26, _g3_4(gx+272, gy+24, gz+12));
+        GOUT(27, _g3_4(gx+268, gy+40, gz+0));
+        GOUT(28, _g3_4(gx+264, gy+44, gz+0));
+        GOUT(29, _g3_4(gx+264, gy+40, gz+4));
+        GOUT(30, _g3_4(gx+268, gy+32, gz+8));
+        GOUT(31, _g3_4(gx+264, gy+36, gz+8));
+        GOUT(32, _g3_4(gx+264, gy+32, gz+12));
+        GOUT(33, _g3_4(gx+268, gy+24, gz+16));
+        GOUT(34, _g3_4(gx+264, gy+28, gz+16));
+        GOUT(35, _g3_4(gx+264, gy+24, gz+20));
+        GOUT(36, _g2_4(gx+284, gz+24));
+        GOUT(37, _g3_4(gx+280, gy+4, gz+24));
+        GOUT(38, _g2_4(gx+280, gz+28));
+        GOUT(39, _g3_4(gx+276, gy+8, gz+24));
+        GOUT(40, _g3_4(gx+272, gy+12, gz+24));
+        GOUT(41, _g3_4(gx+272, gy+8, gz+28));
+        GOUT(42, _g2_4(gx+276, gz+32));
+        GOUT(43, _g3_4(gx+272, gy+4, gz+32));
+        GOUT(44, _g2_4(gx+272, gz+36));
+        GOUT(45, _g3_4(gx+268, gy+16, gz+24));
+        GOUT(46, _g3_4(gx+264, gy+20, gz+24));
+        GOUT(47, _g3_4(gx+264, gy+16, gz+28));
+        GOUT(48, _g3_4(gx+268, gy+8, gz+32));
+        GOUT(49, _g3_4(gx+264, gy+12, gz+32));
+        GOUT(50, _g3_4(gx+264, gy+8, gz+36));
+        GOUT(51, _g2_4(gx+268, gz+40));
+        GOUT(52, _g3_4(gx+264, gy+4, gz+40));
+        GOUT(53, _g2_4(gx+264, gz+44));
+        GOUT(54, _g3_4(gx+260, gy+48, gz+0));
+        GOUT(55, _g3_4(gx+256, gy+52, gz+0));
+        GOUT(56, _g3_4(gx+256, gy+48, gz+4));
+        GOUT(57, _g3_4(gx+252, gy+56, gz+0));
+        GOUT(58, _g3_4(gx+248, gy+60, gz+0));
+        GOUT(59, _g3_4(gx+248, gy+56, gz+4));
+        GOUT(60, _g3_4(gx+252, gy+48, gz+8));
+        GOUT(61, _g3_4(gx+248, gy+52, gz+8));
+        GOUT(62, _g3_4(gx+248, gy+48, gz+12));
+        GOUT(63, _g3_4(gx+244, gy+64, gz+0));
+        GOUT(64, _g3_4(gx+240, gy+68, gz+0));
+        GOUT(65, _g3_4(gx+240, gy+64, gz+4));
+        GOUT(66, _g3_4(gx+244, gy+56, gz+8));
+        GOUT(67, _g3_4(gx+240, gy+60, gz+8));
+        GOUT(68, _g3_4(gx+240, gy+56, gz+12));
+        GOUT(69, _g3_4(gx+244, gy+48, gz+16));
+        GOUT(70, _g3_4(gx+240, gy+52, gz+16));
+        GOUT(71, _g3_4(gx+240, gy+48, gz+20));
+        GOUT(72, _g3_4(gx+260, gy+24, gz+24));
+        GOUT(73, _g3_4(gx+256, gy+28, gz+24));
+        GOUT(74, _g3_4(gx+256, gy+24, gz+28));
+        GOUT(75, _g3_4(gx+252, gy+32, gz+24));
+        GOUT(76, _g3_4(gx+248, gy+36, gz+24));
+        GOUT(77, _g3_4(gx+248, gy+32, gz+28));
+        GOUT(78, _g3_4(gx+252, gy+24, gz+32));
+        GOUT(79, _g3_4(gx+248, gy+28, gz+32));
+        GOUT(80, _g3_4(gx+248, gy+24, gz+36));
+        GOUT(81, _g3_4(gx+244, gy+40, gz+24));
+        GOUT(82, _g3_4(gx+240, gy+44, gz+24));
+        GOUT(83, _g3_4(gx+240, gy+40, gz+28));
+        GOUT(84, _g3_4(gx+244, gy+32, gz+32));
+        GOUT(85, _g3_4(gx+240, gy+36, gz+32));
+        GOUT(86, _g3_4(gx+240, gy+32, gz+36));
+        GOUT(87, _g3_4(gx+244, gy+24, gz+40));
+        GOUT(88, _g3_4(gx+240, gy+28, gz+40));
+        GOUT(89, _g3_4(gx+240, gy+24, gz+44));
+        GOUT(90, _g2_4(gx+260, gz+48));
+        GOUT(91, _g3_4(gx+256, gy+4, gz+48));
+        GOUT(92, _g2_4(gx+256, gz+52));
+        GOUT(93, _g3_4(gx+252, gy+8, gz+48));
+        GOUT(94, _g3_4(gx+248, gy+12, gz+48));
+        GOUT(95, _g3_4(gx+248, gy+8, gz+52));
+        GOUT(96, _g2_4(gx+252, gz+56));
+        GOUT(97, _g3_4(gx+248, gy+4, gz+56));
+        GOUT(98, _g2_4(gx+248, gz+60));
+        GOUT(99, _g3_4(gx+244, gy+16, gz+48));
+        GOUT(100, _g3_4(gx+240, gy+20, gz+48));
+        GOUT(101, _g3_4(gx+240, gy+16, gz+52));
+        GOUT(102, _g3_4(gx+244, gy+8, gz+56));
+        GOUT(103, _g3_4(gx+240, gy+12, gz+56));
+        GOUT(104, _g3_4(gx+240, gy+8, gz+60));
+        GOUT(105, _g2_4(gx+244, gz+64));
+        GOUT(106, _g3_4(gx+240, gy+4, gz+64));
+        GOUT(107, _g2_4(gx+240, gz+68));
+        GOUT(108, _g3_4(gx+188, gy+120, gz+0));
+        GOUT(109, _g3_4(gx+184, gy+124, gz+0));
+        GOUT(110, _g3_4(gx+184, gy+120, gz+4));
+        GOUT(111, _g3_4(gx+180, gy+128, gz+0));
+        GOUT(112, _g3_4(gx+176, gy+132, gz+0));
+        GOUT(113, _g3_4(gx+176, gy+128, gz+4));
+        GOUT(114, _g3_4(gx+180, gy+120, gz+8));
+        GOUT(115, _g3_4(gx+176, gy+124, gz+8));
+        GOUT(116, _g3_4(gx+176, gy+120, gz+12));
+        GOUT(117, _g3_4(gx+172, gy+136, gz+0));
+        GOUT(118, _g3_4(gx+168, gy+140, gz+0));
+        GOUT(119, _g3_4(gx+168, gy+136, gz+4));
+        GOUT(120, _g3_4(gx+172, gy+128, gz+8));
+        GOUT(121, _g3_4(gx+168, gy+132, gz+8));
+        GOUT(122, _g3_4(gx+168, gy+128, gz+12));
+        GOUT(123, _g3_4(gx+172, gy+120, gz+16));
+        GOUT(124, _g3_4(gx+168, gy+124, gz+16));
+        GOUT(125, _g3_4(gx+168, gy+120, gz+20));
+        GOUT(126, _g3_4(gx+164, gy+144, gz+0));
+        GOUT(127, _g3_4(gx+160, gy+148, gz+0));
+        GOUT(128, _g3_4(gx+160, gy+144, gz+4));
+        GOUT(129, _g3_4(gx+156, gy+152, gz+0));
+        GOUT(130, _g3_4(gx+152, gy+156, gz+0));
+        GOUT(131, _g3_4(gx+152, gy+152, gz+4));
+        GOUT(132, _g3_4(gx+156, gy+144, gz+8));
+        GOUT(133, _g3_4(gx+152, gy+148, gz+8));
+        GOUT(134, _g3_4(gx+152, gy+144, gz+12));
+        GOUT(135, _g3_4(gx+148, gy+160, gz+0));
+        GOUT(136, _g3_4(gx+144, gy+164, gz+0));
+        GOUT(137, _g3_4(gx+144, gy+160, gz+4));
+        GOUT(138, _g3_4(gx+148, gy+152, gz+8));
+        GOUT(139, _g3_4(gx+144, gy+156, gz+8));
+        GOUT(140, _g3_4(gx+144, gy+152, gz+12));
+        GOUT(141, _g3_4(gx+148, gy+144, gz+16));
+        GOUT(142, _g3_4(gx+144, gy+148, gz+16));
+        GOUT(143, _g3_4(gx+144, gy+144, gz+20));
+        GOUT(144, _g3_4(gx+164, gy+120, gz+24));
+        GOUT(145, _g3_4(gx+160, gy+124, gz+24));
+        GOUT(146, _g3_4(gx+160, gy+120, gz+28));
+        GOUT(147, _g3_4(gx+156, gy+128, gz+24));
+        GOUT(148, _g3_4(gx+152, gy+132, gz+24));
+        GOUT(149, _g3_4(gx+152, gy+128, gz+28));
+        GOUT(150, _g3_4(gx+156, gy+120, gz+32));
+        GOUT(151, _g3_4(gx+152, gy+124, gz+32));
+        GOUT(152, _g3_4(gx+152, gy+120, gz+36));
+        GOUT(153, _g3_4(gx+148, gy+136, gz+24));
+        GOUT(154, _g3_4(gx+144, gy+140, gz+24));
+        GOUT(155, _g3_4(gx+144, gy+136, gz+28));
+        GOUT(156, _g3_4(gx+148, gy+128, gz+32));
+        GOUT(157, _g3_4(gx+144, gy+132, gz+32));
+        GOUT(158, _g3_4(gx+144, gy+128, gz+36));
+        GOUT(159, _g3_4(gx+148, gy+120, gz+40));
+        GOUT(160, _g3_4(gx+144, gy+124, gz+40));
+        GOUT(161, _g3_4(gx+144, gy+120, gz+44));
+        GOUT(162, _g3_4(gx+140, gy+168, gz+0));
+        GOUT(163, _g3_4(gx+136, gy+172, gz+0));
+        GOUT(164, _g3_4(gx+136, gy+168, gz+4));
+        GOUT(165, _g3_4(gx+132, gy+176, gz+0));
+        GOUT(166, _g3_4(gx+128, gy+180, gz+0));
+        GOUT(167, _g3_4(gx+128, gy+176, gz+4));
+        GOUT(168, _g3_4(gx+132, gy+168, gz+8));
+        GOUT(169, _g3_4(gx+128, gy+172, gz+8));
+        GOUT(170, _g3_4(gx+128, gy+168, gz+12));
+        GOUT(171, _g3_4(gx+124, gy+184, gz+0));
+        GOUT(172, _g3_4(gx+120, gy+188, gz+0));
+        GOUT(173, _g3_4(gx+120, gy+184, gz+4));
+        GOUT(174, _g3_4(gx+124, gy+176, gz+8));
+        GOUT(175, _g3_4(gx+120, gy+180, gz+8));
+        GOUT(176, _g3_4(gx+120, gy+176, gz+12));
+        GOUT(177, _g3_4(gx+124, gy+168, gz+16));
+        GOUT(178, _g3_4(gx+120, gy+172, gz+16));
+        GOUT(179, _g3_4(gx+120, gy+168, gz+20));
+        GOUT(180, _g3_4(gx+140, gy+144, gz+24));
+        GOUT(181, _g3_4(gx+136, gy+148, gz+24));
+        GOUT(182, _g3_4(gx+136, gy+144, gz+28));
+        GOUT(183, _g3_4(gx+132, gy+152, gz+24));
+        GOUT(184, _g3_4(gx+128, gy+156, gz+24));
+        GOUT(185, _g3_4(gx+128, gy+152, gz+28));
+        GOUT(186, _g3_4(gx+132, gy+144, gz+32));
+        GOUT(187, _g3_4(gx+128, gy+148, gz+32));
+        GOUT(188, _g3_4(gx+128, gy+144, gz+36));
+        GOUT(189, _g3_4(gx+124, gy+160, gz+24));
+        GOUT(190, _g3_4(gx+120, gy+164, gz+24));
+        GOUT(191, _g3_4(gx+120, gy+160, gz+28));
+        GOUT(192, _g3_4(gx+124, gy+152, gz+32));
+        GOUT(193, _g3_4(gx+120, gy+156, gz+32));
+        GOUT(194, _g3_4(gx+120, gy+152, gz+36));
+        GOUT(195, _g3_4(gx+124, gy+144, gz+40));
+        GOUT(196, _g3_4(gx+120, gy+148, gz+40));
+        GOUT(197, _g3_4(gx+120, gy+144, gz+44));
+        GOUT(198, _g3_4(gx+140, gy+120, gz+48));
+        GOUT(199, _g3_4(gx+136, gy+124, gz+48));
+        GOUT(200, _g3_4(gx+136, gy+120, gz+52));
+        GOUT(201, _g3_4(gx+132, gy+128, gz+48));
+        GOUT(202, _g3_4(gx+128, gy+132, gz+48));
+        GOUT(203, _g3_4(gx+128, gy+128, gz+52));
+        GOUT(204, _g3_4(gx+132, gy+120, gz+56));
+        GOUT(205, _g3_4(gx+128, gy+124, gz+56));
+        GOUT(206, _g3_4(gx+128, gy+120, gz+60));
+        GOUT(207, _g3_4(gx+124, gy+136, gz+48));
+        GOUT(208, _g3_4(gx+120, gy+140, gz+48));
+        GOUT(209, _g3_4(gx+120, gy+136, gz+52));
+        GOUT(210, _g3_4(gx+124, gy+128, gz+56));
+        GOUT(211, _g3_4(gx+120, gy+132, gz+56));
+        GOUT(212, _g3_4(gx+120, gy+128, gz+60));
+        GOUT(213, _g3_4(gx+124, gy+120, gz+64));
+        GOUT(214, _g3_4(gx+120, gy+124, gz+64));
+        GOUT(215, _g3_4(gx+120, gy+120, gz+68));
+        GOUT(216, _g2_4(gx+188, gz+120));
+        GOUT(217, _g3_4(gx+184, gy+4, gz+120));
+        GOUT(218, _g2_4(gx+184, gz+124));
+        GOUT(219, _g3_4(gx+180, gy+8, gz+120));
+        GOUT(220, _g3_4(gx+176, gy+12, gz+120));
+        GOUT(221, _g3_4(gx+176, gy+8, gz+124));
+        GOUT(222, _g2_4(gx+180, gz+128));
+        GOUT(223, _g3_4(gx+176, gy+4, gz+128));
+        GOUT(224, _g2_4(gx+176, gz+132));
+        GOUT(225, _g3_4(gx+172, gy+16, gz+120));
+        GOUT(226, _g3_4(gx+168, gy+20, gz+120));
+        GOUT(227, _g3_4(gx+168, gy+16, gz+124));
+        GOUT(228, _g3_4(gx+172, gy+8, gz+128));
+        GOUT(229, _g3_4(gx+168, gy+12, gz+128));
+        GOUT(230, _g3_4(gx+168, gy+8, gz+132));
+        GOUT(231, _g2_4(gx+172, gz+136));
+        GOUT(232, _g3_4(gx+168, gy+4, gz+136));
+        GOUT(233, _g2_4(gx+168, gz+140));
+        GOUT(234, _g3_4(gx+164, gy+24, gz+120));
+        GOUT(235, _g3_4(gx+160, gy+28, gz+120));
+        GOUT(236, _g3_4(gx+160, gy+24, gz+124));
+        GOUT(237, _g3_4(gx+156, gy+32, gz+120));
+        GOUT(238, _g3_4(gx+152, gy+36, gz+120));
+        GOUT(239, _g3_4(gx+152, gy+32, gz+124));
+        GOUT(240, _g3_4(gx+156, gy+24, gz+128));
+        GOUT(241, _g3_4(gx+152, gy+28, gz+128));
+        GOUT(242, _g3_4(gx+152, gy+24, gz+132));
+        GOUT(243, _g3_4(gx+148, gy+40, gz+120));
+        GOUT(244, _g3_4(gx+144, gy+44, gz+120));
+        GOUT(245, _g3_4(gx+144, gy+40, gz+124));
+        GOUT(246, _g3_4(gx+148, gy+32, gz+128));
+        GOUT(247, _g3_4(gx+144, gy+36, gz+128));
+        GOUT(248, _g3_4(gx+144, gy+32, gz+132));
+        GOUT(249, _g3_4(gx+148, gy+24, gz+136));
+        GOUT(250, _g3_4(gx+144, gy+28, gz+136));
+        GOUT(251, _g3_4(gx+144, gy+24, gz+140));
+        GOUT(252, _g2_4(gx+164, gz+144));
+        GOUT(253, _g3_4(gx+160, gy+4, gz+144));
+        GOUT(254, _g2_4(gx+160, gz+148));
+        GOUT(255, _g3_4(gx+156, gy+8, gz+144));
+        GOUT(256, _g3_4(gx+152, gy+12, gz+144));
+        GOUT(257, _g3_4(gx+152, gy+8, gz+148));
+        GOUT(258, _g2_4(gx+156, gz+152));
+        GOUT(259, _g3_4(gx+152, gy+4, gz+152));
+        GOUT(260, _g2_4(gx+152, gz+156));
+        GOUT(261, _g3_4(gx+148, gy+16, gz+144));
+        GOUT(262, _g3_4(gx+144, gy+20, gz+144));
+        GOUT(263, _g3_4(gx+144, gy+16, gz+148));
+        GOUT(264, _g3_4(gx+148, gy+8, gz+152));
+        GOUT(265, _g3_4(gx+144, gy+12, gz+152));
+        GOUT(266, _g3_4(gx+144, gy+8, gz+156));
+        GOUT(267, _g2_4(gx+148, gz+160));
+        GOUT(268, _g3_4(gx+144, gy+4, gz+160));
+        GOUT(269, _g2_4(gx+144, gz+164));
+        GOUT(270, _g3_4(gx+140, gy+48, gz+120));
+        GOUT(271, _g3_4(gx+136, gy+52, gz+120));
+        GOUT(272, _g3_4(gx+136, gy+48, gz+124));
+        GOUT(273, _g3_4(gx+132, gy+56, gz+120));
+        GOUT(274, _g3_4(gx+128, gy+60, gz+120));
+        GOUT(275, _g3_4(gx+128, gy+56, gz+124));
+        GOUT(276, _g3_4(gx+132, gy+48, gz+128));
+        GOUT(277, _g3_4(gx+128, gy+52, gz+128));
+        GOUT(278, _g3_4(gx+128, gy+48, gz+132));
+        GOUT(279, _g3_4(gx+124, gy+64, gz+120));
+        GOUT(280, _g3_4(gx+120, gy+68, gz+120));
+        GOUT(281, _g3_4(gx+120, gy+64, gz+124));
+        GOUT(282, _g3_4(gx+124, gy+56, gz+128));
+        GOUT(283, _g3_4(gx+120, gy+60, gz+128));
+        GOUT(284, _g3_4(gx+120, gy+56, gz+132));
+        GOUT(285, _g3_4(gx+124, gy+48, gz+136));
+        GOUT(286, _g3_4(gx+120, gy+52, gz+136));
+        GOUT(287, _g3_4(gx+120, gy+48, gz+140));
+        GOUT(288, _g3_4(gx+140, gy+24, gz+144));
+        GOUT(289, _g3_4(gx+136, gy+28, gz+144));
+        GOUT(290, _g3_4(gx+136, gy+24, gz+148));
+        GOUT(291, _g3_4(gx+132, gy+32, gz+144));
+        GOUT(292, _g3_4(gx+128, gy+36, gz+144));
+        GOUT(293, _g3_4(gx+128, gy+32, gz+148));
+        GOUT(294, _g3_4(gx+132, gy+24, gz+152));
+        GOUT(295, _g3_4(gx+128, gy+28, gz+152));
+        GOUT(296, _g3_4(gx+128, gy+24, gz+156));
+        GOUT(297, _g3_4(gx+124, gy+40, gz+144));
+        GOUT(298, _g3_4(gx+120, gy+44, gz+144));
+        GOUT(299, _g3_4(gx+120, gy+40, gz+148));
+        GOUT(300, _g3_4(gx+124, gy+32, gz+152));
+        GOUT(301, _g3_4(gx+120, gy+36, gz+152));
+        GOUT(302, _g3_4(gx+120, gy+32, gz+156));
+        GOUT(303, _g3_4(gx+124, gy+24, gz+160));
+        GOUT(304, _g3_4(gx+120, gy+28, gz+160));
+        GOUT(305, _g3_4(gx+120, gy+24, gz+164));
+        GOUT(306, _g2_4(gx+140, gz+168));
+        GOUT(307, _g3_4(gx+136, gy+4, gz+168));
+        GOUT(308, _g2_4(gx+136, gz+172));
+        GOUT(309, _g3_4(gx+132, gy+8, gz+168));
+        GOUT(310, _g3_4(gx+128, gy+12, gz+168));
+        GOUT(311, _g3_4(gx+128, gy+8, gz+172));
+        GOUT(312, _g2_4(gx+132, gz+176));
+        GOUT(313, _g3_4(gx+128, gy+4, gz+176));
+        GOUT(314, _g2_4(gx+128, gz+180));
+        GOUT(315, _g3_4(gx+124, gy+16, gz+168));
+        GOUT(316, _g3_4(gx+120, gy+20, gz+168));
+        GOUT(317, _g3_4(gx+120, gy+16, gz+172));
+        GOUT(318, _g3_4(gx+124, gy+8, gz+176));
+        GOUT(319, _g3_4(gx+120, gy+12, gz+176));
+        GOUT(320, _g3_4(gx+120, gy+8, gz+180));
+        GOUT(321, _g2_4(gx+124, gz+184));
+        GOUT(322, _g3_4(gx+120, gy+4, gz+184));
+        GOUT(323, _g2_4(gx+120, gz+188));
+        GOUT(324, _g3_4(gx+68, gy+240, gz+0));
+        GOUT(325, _g3_4(gx+64, gy+244, gz+0));
+        GOUT(326, _g3_4(gx+64, gy+240, gz+4));
+        GOUT(327, _g3_4(gx+60, gy+248, gz+0));
+        GOUT(328, _g3_4(gx+56, gy+252, gz+0));
+        GOUT(329, _g3_4(gx+56, gy+248, gz+4));
+        GOUT(330, _g3_4(gx+60, gy+240, gz+8));
+        GOUT(331, _g3_4(gx+56, gy+244, gz+8));
+        GOUT(332, _g3_4(gx+56, gy+240, gz+12));
+        GOUT(333, _g3_4(gx+52, gy+256, gz+0));
+        GOUT(334, _g3_4(gx+48, gy+260, gz+0));
+        GOUT(335, _g3_4(gx+48, gy+256, gz+4));
+        GOUT(336, _g3_4(gx+52, gy+248, gz+8));
+        GOUT(337, _g3_4(gx+48, gy+252, gz+8));
+        GOUT(338, _g3_4(gx+48, gy+248, gz+12));
+        GOUT(339, _g3_4(gx+52, gy+240, gz+16));
+        GOUT(340, _g3_4(gx+48, gy+244, gz+16));
+        GOUT(341, _g3_4(gx+48, gy+240, gz+20));
+        GOUT(342, _g3_4(gx+44, gy+264, gz+0));
+        GOUT(343, _g3_4(gx+40, gy+268, gz+0));
+        GOUT(344, _g3_4(gx+40, gy+264, gz+4));
+        GOUT(345, _g3_4(gx+36, gy+272, gz+0));
+        GOUT(346, _g3_4(gx+32, gy+276, gz+0));
+        GOUT(347, _g3_4(gx+32, gy+272, gz+4));
+        GOUT(348, _g3_4(gx+36, gy+264, gz+8));
+        GOUT(349, _g3_4(gx+32, gy+268, gz+8));
+        GOUT(350, _g3_4(gx+32, gy+264, gz+12));
+        GOUT(351, _g3_4(gx+28, gy+280, gz+0));
+        GOUT(352, _g3_4(gx+24, gy+284, gz+0));
+        GOUT(353, _g3_4(gx+24, gy+280, gz+4));
+        GOUT(354, _g3_4(gx+28, gy+272, gz+8));
+        GOUT(355, _g3_4(gx+24, gy+276, gz+8));
+        GOUT(356, _g3_4(gx+24, gy+272, gz+12));
+        GOUT(357, _g3_4(gx+28, gy+264, gz+16));
+        GOUT(358, _g3_4(gx+24, gy+268, gz+16));
+        GOUT(359, _g3_4(gx+24, gy+264, gz+20));
+        GOUT(360, _g3_4(gx+44, gy+240, gz+24));
+        GOUT(361, _g3_4(gx+40, gy+244, gz+24));
+        GOUT(362, _g3_4(gx+40, gy+240, gz+28));
+        GOUT(363, _g3_4(gx+36, gy+248, gz+24));
+        GOUT(364, _g3_4(gx+32, gy+252, gz+24));
+        GOUT(365, _g3_4(gx+32, gy+248, gz+28));
+        GOUT(366, _g3_4(gx+36, gy+240, gz+32));
+        GOUT(367, _g3_4(gx+32, gy+244, gz+32));
+        GOUT(368, _g3_4(gx+32, gy+240, gz+36));
+        GOUT(369, _g3_4(gx+28, gy+256, gz+24));
+        GOUT(370, _g3_4(gx+24, gy+260, gz+24));
+        GOUT(371, _g3_4(gx+24, gy+256, gz+28));
+        GOUT(372, _g3_4(gx+28, gy+248, gz+32));
+        GOUT(373, _g3_4(gx+24, gy+252, gz+32));
+        GOUT(374, _g3_4(gx+24, gy+248, gz+36));
+        GOUT(375, _g3_4(gx+28, gy+240, gz+40));
+        GOUT(376, _g3_4(gx+24, gy+244, gz+40));
+        GOUT(377, _g3_4(gx+24, gy+240, gz+44));
+        GOUT(378, _g3_4(gx+20, gy+288, gz+0));
+        GOUT(379, _g3_4(gx+16, gy+292, gz+0));
+        GOUT(380, _g3_4(gx+16, gy+288, gz+4));
+        GOUT(381, _g3_4(gx+12, gy+296, gz+0));
+        GOUT(382, _g3_4(gx+8, gy+300, gz+0));
+        GOUT(383, _g3_4(gx+8, gy+296, gz+4));
+        GOUT(384, _g3_4(gx+12, gy+288, gz+8));
+        GOUT(385, _g3_4(gx+8, gy+292, gz+8));
+        GOUT(386, _g3_4(gx+8, gy+288, gz+12));
+        GOUT(387, _g3_4(gx+4, gy+304, gz+0));
+        GOUT(388, _g2_4(gy+308, gz+0));
+        GOUT(389, _g2_4(gy+304, gz+4));
+        GOUT(390, _g3_4(gx+4, gy+296, gz+8));
+        GOUT(391, _g2_4(gy+300, gz+8));
+        GOUT(392, _g2_4(gy+296, gz+12));
+        GOUT(393, _g3_4(gx+4, gy+288, gz+16));
+        GOUT(394, _g2_4(gy+292, gz+16));
+        GOUT(395, _g2_4(gy+288, gz+20));
+        GOUT(396, _g3_4(gx+20, gy+264, gz+24));
+        GOUT(397, _g3_4(gx+16, gy+268, gz+24));
+        GOUT(398, _g3_4(gx+16, gy+264, gz+28));
+        GOUT(399, _g3_4(gx+12, gy+272, gz+24));
+        GOUT(400, _g3_4(gx+8, gy+276, gz+24));
+        GOUT(401, _g3_4(gx+8, gy+272, gz+28));
+        GOUT(402, _g3_4(gx+12, gy+264, gz+32));
+        GOUT(403, _g3_4(gx+8, gy+268, gz+32));
+        GOUT(404, _g3_4(gx+8, gy+264, gz+36));
+        GOUT(405, _g3_4(gx+4, gy+280, gz+24));
+        GOUT(406, _g2_4(gy+284, gz+24));
+        GOUT(407, _g2_4(gy+280, gz+28));
+        GOUT(408, _g3_4(gx+4, gy+272, gz+32));
+        GOUT(409, _g2_4(gy+276, gz+32));
+        GOUT(410, _g2_4(gy+272, gz+36));
+        GOUT(411, _g3_4(gx+4, gy+264, gz+40));
+        GOUT(412, _g2_4(gy+268, gz+40));
+        GOUT(413, _g2_4(gy+264, gz+44));
+        GOUT(414, _g3_4(gx+20, gy+240, gz+48));
+        GOUT(415, _g3_4(gx+16, gy+244, gz+48));
+        GOUT(416, _g3_4(gx+16, gy+240, gz+52));
+        GOUT(417, _g3_4(gx+12, gy+248, gz+48));
+        GOUT(418, _g3_4(gx+8, gy+252, gz+48));
+        GOUT(419, _g3_4(gx+8, gy+248, gz+52));
+        GOUT(420, _g3_4(gx+12, gy+240, gz+56));
+        GOUT(421, _g3_4(gx+8, gy+244, gz+56));
+        GOUT(422, _g3_4(gx+8, gy+240, gz+60));
+        GOUT(423, _g3_4(gx+4, gy+256, gz+48));
+        GOUT(424, _g2_4(gy+260, gz+48));
+        GOUT(425, _g2_4(gy+256, gz+52));
+        GOUT(426, _g3_4(gx+4, gy+248, gz+56));
+        GOUT(427, _g2_4(gy+252, gz+56));
+        GOUT(428, _g2_4(gy+248, gz+60));
+        GOUT(429, _g3_4(gx+4, gy+240, gz+64));
+        GOUT(430, _g2_4(gy+244, gz+64));
+        GOUT(431, _g2_4(gy+240, gz+68));
+        GOUT(432, _g3_4(gx+68, gy+120, gz+120));
+        GOUT(433, _g3_4(gx+64, gy+124, gz+120));
+        GOUT(434, _g3_4(gx+64, gy+120, gz+124));
+        GOUT(435, _g3_4(gx+60, gy+128, gz+120));
+        GOUT(436, _g3_4(gx+56, gy+132, gz+120));
+        GOUT(437, _g3_4(gx+56, gy+128, gz+124));
+        GOUT(438, _g3_4(gx+60, gy+120, gz+128));
+        GOUT(439, _g3_4(gx+56, gy+124, gz+128));
+        GOUT(440, _g3_4(gx+56, gy+120, gz+132));
+        GOUT(441, _g3_4(gx+52, gy+136, gz+120));
+        GOUT(442, _g3_4(gx+48, gy+140, gz+120));
+        GOUT(443, _g3_4(gx+48, gy+136, gz+124));
+        GOUT(444, _g3_4(gx+52, gy+128, gz+128));
+        GOUT(445, _g3_4(gx+48, gy+132, gz+128));
+        GOUT(446, _g3_4(gx+48, gy+128, gz+132));
+        GOUT(447, _g3_4(gx+52, gy+120, gz+136));
+        GOUT(448, _g3_4(gx+48, gy+124, gz+136));
+        GOUT(449, _g3_4(gx+48, gy+120, gz+140));
+        GOUT(450, _g3_4(gx+44, gy+144, gz+120));
+        GOUT(451, _g3_4(gx+40, gy+148, gz+120));
+        GOUT(452, _g3_4(gx+40, gy+144, gz+124));
+        GOUT(453, _g3_4(gx+36, gy+152, gz+120));
+        GOUT(454, _g3_4(gx+32, gy+156, gz+120));
+        GOUT(455, _g3_4(gx+32, gy+152, gz+124));
+        GOUT(456, _g3_4(gx+36, gy+144, gz+128));
+        GOUT(457, _g3_4(gx+32, gy+148, gz+128));
+        GOUT(458, _g3_4(gx+32, gy+144, gz+132));
+        GOUT(459, _g3_4(gx+28, gy+160, gz+120));
+        GOUT(460, _g3_4(gx+24, gy+164, gz+120));
+        GOUT(461, _g3_4(gx+24, gy+160, gz+124));
+        GOUT(462, _g3_4(gx+28, gy+152, gz+128));
+        GOUT(463, _g3_4(gx+24, gy+156, gz+128));
+        GOUT(464, _g3_4(gx+24, gy+152, gz+132));
+        GOUT(465, _g3_4(gx+28, gy+144, gz+136));
+        GOUT(466, _g3_4(gx+24, gy+148, gz+136));
+        GOUT(467, _g3_4(gx+24, gy+144, gz+140));
+        GOUT(468, _g3_4(gx+44, gy+120, gz+144));
+        GOUT(469, _g3_4(gx+40, gy+124, gz+144));
+        GOUT(470, _g3_4(gx+40, gy+120, gz+148));
+        GOUT(471, _g3_4(gx+36, gy+128, gz+144));
+        GOUT(472, _g3_4(gx+32, gy+132, gz+144));
+        GOUT(473, _g3_4(gx+32, gy+128, gz+148));
+        GOUT(474, _g3_4(gx+36, gy+120, gz+152));
+        GOUT(475, _g3_4(gx+32, gy+124, gz+152));
+        GOUT(476, _g3_4(gx+32, gy+120, gz+156));
+        GOUT(477, _g3_4(gx+28, gy+136, gz+144));
+        GOUT(478, _g3_4(gx+24, gy+140, gz+144));
+        GOUT(479, _g3_4(gx+24, gy+136, gz+148));
+        GOUT(480, _g3_4(gx+28, gy+128, gz+152));
+        GOUT(481, _g3_4(gx+24, gy+132, gz+152));
+        GOUT(482, _g3_4(gx+24, gy+128, gz+156));
+        GOUT(483, _g3_4(gx+28, gy+120, gz+160));
+        GOUT(484, _g3_4(gx+24, gy+124, gz+160));
+        GOUT(485, _g3_4(gx+24, gy+120, gz+164));
+        GOUT(486, _g3_4(gx+20, gy+168, gz+120));
+        GOUT(487, _g3_4(gx+16, gy+172, gz+120));
+        GOUT(488, _g3_4(gx+16, gy+168, gz+124));
+        GOUT(489, _g3_4(gx+12, gy+176, gz+120));
+        GOUT(490, _g3_4(gx+8, gy+180, gz+120));
+        GOUT(491, _g3_4(gx+8, gy+176, gz+124));
+        GOUT(492, _g3_4(gx+12, gy+168, gz+128));
+        GOUT(493, _g3_4(gx+8, gy+172, gz+128));
+        GOUT(494, _g3_4(gx+8, gy+168, gz+132));
+        GOUT(495, _g3_4(gx+4, gy+184, gz+120));
+        GOUT(496, _g2_4(gy+188, gz+120));
+        GOUT(497, _g2_4(gy+184, gz+124));
+        GOUT(498, _g3_4(gx+4, gy+176, gz+128));
+        GOUT(499, _g2_4(gy+180, gz+128));
+        GOUT(500, _g2_4(gy+176, gz+132));
+        GOUT(501, _g3_4(gx+4, gy+168, gz+136));
+        GOUT(502, _g2_4(gy+172, gz+136));
+        GOUT(503, _g2_4(gy+168, gz+140));
+        GOUT(504, _g3_4(gx+20, gy+144, gz+144));
+        GOUT(505, _g3_4(gx+16, gy+148, gz+144));
+        GOUT(506, _g3_4(gx+16, gy+144, gz+148));
+        GOUT(507, _g3_4(gx+12, gy+152, gz+144));
+        GOUT(508, _g3_4(gx+8, gy+156, gz+144));
+        GOUT(509, _g3_4(gx+8, gy+152, gz+148));
+        GOUT(510, _g3_4(gx+12, gy+144, gz+152));
+        GOUT(511, _g3_4(gx+8, gy+148, gz+152));
+        GOUT(512, _g3_4(gx+8, gy+144, gz+156));
+        GOUT(513, _g3_4(gx+4, gy+160, gz+144));
+        GOUT(514, _g2_4(gy+164, gz+144));
+        GOUT(515, _g2_4(gy+160, gz+148));
+        GOUT(516, _g3_4(gx+4, gy+152, gz+152));
+        GOUT(517, _g2_4(gy+156, gz+152));
+        GOUT(518, _g2_4(gy+152, gz+156));
+        GOUT(519, _g3_4(gx+4, gy+144, gz+160));
+        GOUT(520, _g2_4(gy+148, gz+160));
+        GOUT(521, _g2_4(gy+144, gz+164));
+        GOUT(522, _g3_4(gx+20, gy+120, gz+168));
+        GOUT(523, _g3_4(gx+16, gy+124, gz+168));
+        GOUT(524, _g3_4(gx+16, gy+120, gz+172));
+        GOUT(525, _g3_4(gx+12, gy+128, gz+168));
+        GOUT(526, _g3_4(gx+8, gy+132, gz+168));
+        GOUT(527, _g3_4(gx+8, gy+128, gz+172));
+        GOUT(528, _g3_4(gx+12, gy+120, gz+176));
+        GOUT(529, _g3_4(gx+8, gy+124, gz+176));
+        GOUT(530, _g3_4(gx+8, gy+120, gz+180));
+        GOUT(531, _g3_4(gx+4, gy+136, gz+168));
+        GOUT(532, _g2_4(gy+140, gz+168));
+        GOUT(533, _g2_4(gy+136, gz+172));
+        GOUT(534, _g3_4(gx+4, gy+128, gz+176));
+        GOUT(535, _g2_4(gy+132, gz+176));
+        GOUT(536, _g2_4(gy+128, gz+180));
+        GOUT(537, _g3_4(gx+4, gy+120, gz+184));
+        GOUT(538, _g2_4(gy+124, gz+184));
+        GOUT(539, _g2_4(gy+120, gz+188));
+        GOUT(540, _g2_4(gx+68, gz+240));
+        GOUT(541, _g3_4(gx+64, gy+4, gz+240));
+        GOUT(542, _g2_4(gx+64, gz+244));
+        GOUT(543, _g3_4(gx+60, gy+8, gz+240));
+        GOUT(544, _g3_4(gx+56, gy+12, gz+240));
+        GOUT(545, _g3_4(gx+56, gy+8, gz+244));
+        GOUT(546, _g2_4(gx+60, gz+248));
+        GOUT(547, _g3_4(gx+56, gy+4, gz+248));
+        GOUT(548, _g2_4(gx+56, gz+252));
+        GOUT(549, _g3_4(gx+52, gy+16, gz+240));
+        GOUT(550, _g3_4(gx+48, gy+20, gz+240));
+        GOUT(551, _g3_4(gx+48, gy+16, gz+244));
+        GOUT(552, _g3_4(gx+52, gy+8, gz+248));
+        GOUT(553, _g3_4(gx+48, gy+12, gz+248));
+        GOUT(554, _g3_4(gx+48, gy+8, gz+252));
+        GOUT(555, _g2_4(gx+52, gz+256));
+        GOUT(556, _g3_4(gx+48, gy+4, gz+256));
+        GOUT(557, _g2_4(gx+48, gz+260));
+        GOUT(558, _g3_4(gx+44, gy+24, gz+240));
+        GOUT(559, _g3_4(gx+40, gy+28, gz+240));
+        GOUT(560, _g3_4(gx+40, gy+24, gz+244));
+        GOUT(561, _g3_4(gx+36, gy+32, gz+240));
+        GOUT(562, _g3_4(gx+32, gy+36, gz+240));
+        GOUT(563, _g3_4(gx+32, gy+32, gz+244));
+        GOUT(564, _g3_4(gx+36, gy+24, gz+248));
+        GOUT(565, _g3_4(gx+32, gy+28, gz+248));
+        GOUT(566, _g3_4(gx+32, gy+24, gz+252));
+        GOUT(567, _g3_4(gx+28, gy+40, gz+240));
+        GOUT(568, _g3_4(gx+24, gy+44, gz+240));
+        GOUT(569, _g3_4(gx+24, gy+40, gz+244));
+        GOUT(570, _g3_4(gx+28, gy+32, gz+248));
+        GOUT(571, _g3_4(gx+24, gy+36, gz+248));
+        GOUT(572, _g3_4(gx+24, gy+32, gz+252));
+        GOUT(573, _g3_4(gx+28, gy+24, gz+256));
+        GOUT(574, _g3_4(gx+24, gy+28, gz+256));
+        GOUT(575, _g3_4(gx+24, gy+24, gz+260));
+        GOUT(576, _g2_4(gx+44, gz+264));
+        GOUT(577, _g3_4(gx+40, gy+4, gz+264));
+        GOUT(578, _g2_4(gx+40, gz+268));
+        GOUT(579, _g3_4(gx+36, gy+8, gz+264));
+        GOUT(580, _g3_4(gx+32, gy+12, gz+264));
+        GOUT(581, _g3_4(gx+32, gy+8, gz+268));
+        GOUT(582, _g2_4(gx+36, gz+272));
+        GOUT(583, _g3_4(gx+32, gy+4, gz+272));
+        GOUT(584, _g2_4(gx+32, gz+276));
+        GOUT(585, _g3_4(gx+28, gy+16, gz+264));
+        GOUT(586, _g3_4(gx+24, gy+20, gz+264));
+        GOUT(587, _g3_4(gx+24, gy+16, gz+268));
+        GOUT(588, _g3_4(gx+28, gy+8, gz+272));
+        GOUT(589, _g3_4(gx+24, gy+12, gz+272));
+        GOUT(590, _g3_4(gx+24, gy+8, gz+276));
+        GOUT(591, _g2_4(gx+28, gz+280));
+        GOUT(592, _g3_4(gx+24, gy+4, gz+280));
+        GOUT(593, _g2_4(gx+24, gz+284));
+        GOUT(594, _g3_4(gx+20, gy+48, gz+240));
+        GOUT(595, _g3_4(gx+16, gy+52, gz+240));
+        GOUT(596, _g3_4(gx+16, gy+48, gz+244));
+        GOUT(597, _g3_4(gx+12, gy+56, gz+240));
+        GOUT(598, _g3_4(gx+8, gy+60, gz+240));
+        GOUT(599, _g3_4(gx+8, gy+56, gz+244));
+        GOUT(600, _g3_4(gx+12, gy+48, gz+248));
+        GOUT(601, _g3_4(gx+8, gy+52, gz+248));
+        GOUT(602, _g3_4(gx+8, gy+48, gz+252));
+        GOUT(603, _g3_4(gx+4, gy+64, gz+240));
+        GOUT(604, _g2_4(gy+68, gz+240));
+        GOUT(605, _g2_4(gy+64, gz+244));
+        GOUT(606, _g3_4(gx+4, gy+56, gz+248));
+        GOUT(607, _g2_4(gy+60, gz+248));
+        GOUT(608, _g2_4(gy+56, gz+252));
+        GOUT(609, _g3_4(gx+4, gy+48, gz+256));
+        GOUT(610, _g2_4(gy+52, gz+256));
+        GOUT(611, _g2_4(gy+48, gz+260));
+        GOUT(612, _g3_4(gx+20, gy+24, gz+264));
+        GOUT(613, _g3_4(gx+16, gy+28, gz+264));
+        GOUT(614, _g3_4(gx+16, gy+24, gz+268));
+        GOUT(615, _g3_4(gx+12, gy+32, gz+264));
+        GOUT(616, _g3_4(gx+8, gy+36, gz+264));
+        GOUT(617, _g3_4(gx+8, gy+32, gz+268));
+        GOUT(618, _g3_4(gx+12, gy+24, gz+272));
+        GOUT(619, _g3_4(gx+8, gy+28, gz+272));
+        GOUT(620, _g3_4(gx+8, gy+24, gz+276));
+        GOUT(621, _g3_4(gx+4, gy+40, gz+264));
+        GOUT(622, _g2_4(gy+44, gz+264));
+        GOUT(623, _g2_4(gy+40, gz+268));
+        GOUT(624, _g3_4(gx+4, gy+32, gz+272));
+        GOUT(625, _g2_4(gy+36, gz+272));
+        GOUT(626, _g2_4(gy+32, gz+276));
+        GOUT(627, _g3_4(gx+4, gy+24, gz+280));
+        GOUT(628, _g2_4(gy+28, gz+280));
+        GOUT(629, _g2_4(gy+24, gz+284));
+        GOUT(630, _g2_4(gx+20, gz+288));
+        GOUT(631, _g3_4(gx+16, gy+4, gz+288));
+        GOUT(632, _g2_4(gx+16, gz+292));
+        GOUT(633, _g3_4(gx+12, gy+8, gz+288));
+        GOUT(634, _g3_4(gx+8, gy+12, gz+288));
+        GOUT(635, _g3_4(gx+8, gy+8, gz+292));
+        GOUT(636, _g2_4(gx+12, gz+296));
+        GOUT(637, _g3_4(gx+8, gy+4, gz+296));
+        GOUT(638, _g2_4(gx+8, gz+300));
+        GOUT(639, _g3_4(gx+4, gy+16, gz+288));
+        GOUT(640, _g2_4(gy+20, gz+288));
+        GOUT(641, _g2_4(gy+16, gz+292));
+        GOUT(642, _g3_4(gx+4, gy+8, gz+296));
+        GOUT(643, _g2_4(gy+12, gz+296));
+        GOUT(644, _g2_4(gy+8, gz+300));
+        GOUT(645, _g2_4(gx+4, gz+304));
+        GOUT(646, _g2_4(gy+4, gz+304));
+        GOUT(647, _g1_4(gz+308));
+}
+
+static void _gout_2000(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 6;
+        double *gz = g + 12;
+        GOUT(0, _g2_2(gx+4, gz+0));
+        GOUT(1, _g3_2(gx+2, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+2, gz+2));
+        GOUT(3, _g2_2(gy+4, gz+0));
+        GOUT(4, _g2_2(gy+2, gz+2));
+        GOUT(5, _g1_2(gz+4));
+}
+
+static void _gout_2001(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 12;
+        double *gz = g + 24;
+        GOUT(0, _g2_2(gx+10, gz+0));
+        GOUT(1, _g3_2(gx+8, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+8, gz+2));
+        GOUT(3, _g3_2(gx+6, gy+4, gz+0));
+        GOUT(4, _g3_2(gx+6, gy+2, gz+2));
+        GOUT(5, _g2_2(gx+6, gz+4));
+        GOUT(6, _g3_2(gx+4, gy+6, gz+0));
+        GOUT(7, _g3_2(gx+2, gy+8, gz+0));
+        GOUT(8, _g3_2(gx+2, gy+6, gz+2));
+        GOUT(9, _g2_2(gy+10, gz+0));
+        GOUT(10, _g2_2(gy+8, gz+2));
+        GOUT(11, _g2_2(gy+6, gz+4));
+        GOUT(12, _g2_2(gx+4, gz+6));
+        GOUT(13, _g3_2(gx+2, gy+2, gz+6));
+        GOUT(14, _g2_2(gx+2, gz+8));
+        GOUT(15, _g2_2(gy+4, gz+6));
+        GOUT(16, _g2_2(gy+2, gz+8));
+        GOUT(17, _g1_2(gz+10));
+}
+
+static void _g0_2d4d_2002(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 27;
+        double *gz = g + 54;
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+3] = c00x;
+                gx[n+6] = c00x * gx[n+3] + b10;
+                gx[n+9] = c0px;
+                gx[n+12] = c00x * gx[n+9] + b00;
+                gx[n+15] = c00x * gx[n+12] + b10 * gx[n+9] + b00 * gx[n+3];
+                gx[n+18] = c0px * gx[n+9] + b01;
+                gx[n+21] = c00x * gx[n+18] + 2 * b00 * gx[n+9];
+                gx[n+24] = c00x * gx[n+21] + b10 * gx[n+18] + 2 * b00 * gx[n+12];
+                gy[n+3] = c00y;
+                gy[n+6] = c00y * gy[n+3] + b10;
+                gy[n+9] = c0py;
+                gy[n+12] = c00y * gy[n+9] + b00;
+                gy[n+15] = c00y * gy[n+12] + b10 * gy[n+9] + b00 * gy[n+3];
+                gy[n+18] = c0py * gy[n+9] + b01;
+                gy[n+21] = c00y * gy[n+18] + 2 * b00 * gy[n+9];
+                gy[n+24] = c00y * gy[n+21] + b10 * gy[n+18] + 2 * b00 * gy[n+12];
+                gz[n+3] = c00z * gz[n+0];
+                gz[n+6] = c00z * gz[n+3] + b10 * gz[n+0];
+                gz[n+9] = c0pz * gz[n+0];
+                gz[n+12] = c00z * gz[n+9] + b00 * gz[n+0];
+                gz[n+15] = c00z * gz[n+12] + b10 * gz[n+9] + b00 * gz[n+3];
+                gz[n+18] = c0pz * gz[n+9] + b01 * gz[n+0];
+                gz[n+21] = c00z * gz[n+18] + 2 * b00 * gz[n+9];
+                gz[n+24] = c00z * gz[n+21] + b10 * gz[n+18] + 2 * b00 * gz[n+12];
+        }
+}
+static void _gout_2002(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 27;
+        double *gz = g + 54;
+        GOUT(0, _g2_3(gx+24, gz+0));
+        GOUT(1, _g3_3(gx+21, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+21, gz+3));
+        GOUT(3, _g3_3(gx+18, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+18, gy+3, gz+3));
+        GOUT(5, _g2_3(gx+18, gz+6));
+        GOUT(6, _g3_3(gx+15, gy+9, gz+0));
+        GOUT(7, _g3_3(gx+12, gy+12, gz+0));
+        GOUT(8, _g3_3(gx+12, gy+9, gz+3));
+        GOUT(9, _g3_3(gx+9, gy+15, gz+0));
+        GOUT(10, _g3_3(gx+9, gy+12, gz+3));
+        GOUT(11, _g3_3(gx+9, gy+9, gz+6));
+        GOUT(12, _g2_3(gx+15, gz+9));
+        GOUT(13, _g3_3(gx+12, gy+3, gz+9));
+        GOUT(14, _g2_3(gx+12, gz+12));
+        GOUT(15, _g3_3(gx+9, gy+6, gz+9));
+        GOUT(16, _g3_3(gx+9, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+9, gz+15));
+        GOUT(18, _g3_3(gx+6, gy+18, gz+0));
+        GOUT(19, _g3_3(gx+3, gy+21, gz+0));
+        GOUT(20, _g3_3(gx+3, gy+18, gz+3));
+        GOUT(21, _g2_3(gy+24, gz+0));
+        GOUT(22, _g2_3(gy+21, gz+3));
+        GOUT(23, _g2_3(gy+18, gz+6));
+        GOUT(24, _g3_3(gx+6, gy+9, gz+9));
+        GOUT(25, _g3_3(gx+3, gy+12, gz+9));
+        GOUT(26, _g3_3(gx+3, gy+9, gz+12));
+        GOUT(27, _g2_3(gy+15, gz+9));
+        GOUT(28, _g2_3(gy+12, gz+12));
+        GOUT(29, _g2_3(gy+9, gz+15));
+        GOUT(30, _g2_3(gx+6, gz+18));
+        GOUT(31, _g3_3(gx+3, gy+3, gz+18));
+        GOUT(32, _g2_3(gx+3, gz+21));
+        GOUT(33, _g2_3(gy+6, gz+18));
+        GOUT(34, _g2_3(gy+3, gz+21));
+        GOUT(35, _g1_3(gz+24));
+}
+
+static void _gout_2010(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 12;
+        double *gz = g + 24;
+        GOUT(0, _g2_2(gx+10, gz+0));
+        GOUT(1, _g3_2(gx+8, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+8, gz+2));
+        GOUT(3, _g3_2(gx+6, gy+4, gz+0));
+        GOUT(4, _g3_2(gx+6, gy+2, gz+2));
+        GOUT(5, _g2_2(gx+6, gz+4));
+        GOUT(6, _g3_2(gx+4, gy+6, gz+0));
+        GOUT(7, _g3_2(gx+2, gy+8, gz+0));
+        GOUT(8, _g3_2(gx+2, gy+6, gz+2));
+        GOUT(9, _g2_2(gy+10, gz+0));
+        GOUT(10, _g2_2(gy+8, gz+2));
+        GOUT(11, _g2_2(gy+6, gz+4));
+        GOUT(12, _g2_2(gx+4, gz+6));
+        GOUT(13, _g3_2(gx+2, gy+2, gz+6));
+        GOUT(14, _g2_2(gx+2, gz+8));
+        GOUT(15, _g2_2(gy+4, gz+6));
+        GOUT(16, _g2_2(gy+2, gz+8));
+        GOUT(17, _g1_2(gz+10));
+}
+
+static void _g0_2d4d_2011(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 54;
+        double *gz = g + 108;
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+3] = c00x;
+                gx[n+6] = c00x * gx[n+3] + b10;
+                gx[n+18] = c0px;
+                gx[n+9] = sx + gx[n+18];
+                gx[n+21] = c00x * gx[n+18] + b00;
+                gx[n+12] = sx * gx[n+3] + gx[n+21];
+                gx[n+24] = c00x * gx[n+21] + b10 * gx[n+18] + b00 * gx[n+3];
+                gx[n+15] = sx * gx[n+6] + gx[n+24];
+                gx[n+36] = c0px * gx[n+18] + b01;
+                gx[n+27] = sx * gx[n+18] + gx[n+36];
+                gx[n+39] = c00x * gx[n+36] + 2 * b00 * gx[n+18];
+                gx[n+30] = sx * gx[n+21] + gx[n+39];
+                gx[n+42] = c00x * gx[n+39] + b10 * gx[n+36] + 2 * b00 * gx[n+21];
+                gx[n+33] = sx * gx[n+24] + gx[n+42];
+                gy[n+3] = c00y;
+                gy[n+6] = c00y * gy[n+3] + b10;
+                gy[n+18] = c0py;
+                gy[n+9] = sy + gy[n+18];
+                gy[n+21] = c00y * gy[n+18] + b00;
+                gy[n+12] = sy * gy[n+3] + gy[n+21];
+                gy[n+24] = c00y * gy[n+21] + b10 * gy[n+18] + b00 * gy[n+3];
+                gy[n+15] = sy * gy[n+6] + gy[n+24];
+                gy[n+36] = c0py * gy[n+18] + b01;
+                gy[n+27] = sy * gy[n+18] + gy[n+36];
+                gy[n+39] = c00y * gy[n+36] + 2 * b00 * gy[n+18];
+                gy[n+30] = sy * gy[n+21] + gy[n+39];
+                gy[n+42] = c00y * gy[n+39] + b10 * gy[n+36] + 2 * b00 * gy[n+21];
+                gy[n+33] = sy * gy[n+24] + gy[n+42];
+                gz[n+3] = c00z * gz[n+0];
+                gz[n+6] = c00z * gz[n+3] + b10 * gz[n+0];
+                gz[n+18] = c0pz * gz[n+0];
+                gz[n+9] = sz * gz[n+0] + gz[n+18];
+                gz[n+21] = c00z * gz[n+18] + b00 * gz[n+0];
+                gz[n+12] = sz * gz[n+3] + gz[n+21];
+                gz[n+24] = c00z * gz[n+21] + b10 * gz[n+18] + b00 * gz[n+3];
+                gz[n+15] = sz * gz[n+6] + gz[n+24];
+                gz[n+36] = c0pz * gz[n+18] + b01 * gz[n+0];
+                gz[n+27] = sz * gz[n+18] + gz[n+36];
+                gz[n+39] = c00z * gz[n+36] + 2 * b00 * gz[n+18];
+                gz[n+30] = sz * gz[n+21] + gz[n+39];
+                gz[n+42] = c00z * gz[n+39] + b10 * gz[n+36] + 2 * b00 * gz[n+21];
+                gz[n+33] = sz * gz[n+24] + gz[n+42];
+        }
+}
+static void _gout_2011(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 54;
+        double *gz = g + 108;
+        GOUT(0, _g2_3(gx+33, gz+0));
+        GOUT(1, _g3_3(gx+30, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+30, gz+3));
+        GOUT(3, _g3_3(gx+27, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+27, gy+3, gz+3));
+        GOUT(5, _g2_3(gx+27, gz+6));
+        GOUT(6, _g3_3(gx+24, gy+9, gz+0));
+        GOUT(7, _g3_3(gx+21, gy+12, gz+0));
+        GOUT(8, _g3_3(gx+21, gy+9, gz+3));
+        GOUT(9, _g3_3(gx+18, gy+15, gz+0));
+        GOUT(10, _g3_3(gx+18, gy+12, gz+3));
+        GOUT(11, _g3_3(gx+18, gy+9, gz+6));
+        GOUT(12, _g2_3(gx+24, gz+9));
+        GOUT(13, _g3_3(gx+21, gy+3, gz+9));
+        GOUT(14, _g2_3(gx+21, gz+12));
+        GOUT(15, _g3_3(gx+18, gy+6, gz+9));
+        GOUT(16, _g3_3(gx+18, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+18, gz+15));
+        GOUT(18, _g3_3(gx+15, gy+18, gz+0));
+        GOUT(19, _g3_3(gx+12, gy+21, gz+0));
+        GOUT(20, _g3_3(gx+12, gy+18, gz+3));
+        GOUT(21, _g3_3(gx+9, gy+24, gz+0));
+        GOUT(22, _g3_3(gx+9, gy+21, gz+3));
+        GOUT(23, _g3_3(gx+9, gy+18, gz+6));
+        GOUT(24, _g3_3(gx+6, gy+27, gz+0));
+        GOUT(25, _g3_3(gx+3, gy+30, gz+0));
+        GOUT(26, _g3_3(gx+3, gy+27, gz+3));
+        GOUT(27, _g2_3(gy+33, gz+0));
+        GOUT(28, _g2_3(gy+30, gz+3));
+        GOUT(29, _g2_3(gy+27, gz+6));
+        GOUT(30, _g3_3(gx+6, gy+18, gz+9));
+        GOUT(31, _g3_3(gx+3, gy+21, gz+9));
+        GOUT(32, _g3_3(gx+3, gy+18, gz+12));
+        GOUT(33, _g2_3(gy+24, gz+9));
+        GOUT(34, _g2_3(gy+21, gz+12));
+        GOUT(35, _g2_3(gy+18, gz+15));
+        GOUT(36, _g2_3(gx+15, gz+18));
+        GOUT(37, _g3_3(gx+12, gy+3, gz+18));
+        GOUT(38, _g2_3(gx+12, gz+21));
+        GOUT(39, _g3_3(gx+9, gy+6, gz+18));
+        GOUT(40, _g3_3(gx+9, gy+3, gz+21));
+        GOUT(41, _g2_3(gx+9, gz+24));
+        GOUT(42, _g3_3(gx+6, gy+9, gz+18));
+        GOUT(43, _g3_3(gx+3, gy+12, gz+18));
+        GOUT(44, _g3_3(gx+3, gy+9, gz+21));
+        GOUT(45, _g2_3(gy+15, gz+18));
+        GOUT(46, _g2_3(gy+12, gz+21));
+        GOUT(47, _g2_3(gy+9, gz+24));
+        GOUT(48, _g2_3(gx+6, gz+27));
+        GOUT(49, _g3_3(gx+3, gy+3, gz+27));
+        GOUT(50, _g2_3(gx+3, gz+30));
+        GOUT(51, _g2_3(gy+6, gz+27));
+        GOUT(52, _g2_3(gy+3, gz+30));
+        GOUT(53, _g1_3(gz+33));
+}
+
+static void _g0_2d4d_2012(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 72;
+        double *gz = g + 144;
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+3] = c00x;
+                gx[n+6] = c00x * gx[n+3] + b10;
+                gx[n+18] = c0px;
+                gx[n+9] = sx + gx[n+18];
+                gx[n+21] = c00x * gx[n+18] + b00;
+                gx[n+12] = sx * gx[n+3] + gx[n+21];
+                gx[n+24] = c00x * gx[n+21] + b10 * gx[n+18] + b00 * gx[n+3];
+                gx[n+15] = sx * gx[n+6] + gx[n+24];
+                gx[n+36] = c0px * gx[n+18] + b01;
+                gx[n+27] = sx * gx[n+18] + gx[n+36];
+                gx[n+39] = c00x * gx[n+36] + 2 * b00 * gx[n+18];
+                gx[n+30] = sx * gx[n+21] + gx[n+39];
+                gx[n+42] = c00x * gx[n+39] + b10 * gx[n+36] + 2 * b00 * gx[n+21];
+                gx[n+33] = sx * gx[n+24] + gx[n+42];
+                gx[n+54] = c0px * gx[n+36] + 2 * b01 * gx[n+18];
+                gx[n+45] = sx * gx[n+36] + gx[n+54];
+                gx[n+57] = c00x * gx[n+54] + 3 * b00 * gx[n+36];
+                gx[n+48] = sx * gx[n+39] + gx[n+57];
+                gx[n+60] = c00x * gx[n+57] + b10 * gx[n+54] + 3 * b00 * gx[n+39];
+                gx[n+51] = sx * gx[n+42] + gx[n+60];
+                gy[n+3] = c00y;
+                gy[n+6] = c00y * gy[n+3] + b10;
+                gy[n+18] = c0py;
+                gy[n+9] = sy + gy[n+18];
+                gy[n+21] = c00y * gy[n+18] + b00;
+                gy[n+12] = sy * gy[n+3] + gy[n+21];
+                gy[n+24] = c00y * gy[n+21] + b10 * gy[n+18] + b00 * gy[n+3];
+                gy[n+15] = sy * gy[n+6] + gy[n+24];
+                gy[n+36] = c0py * gy[n+18] + b01;
+                gy[n+27] = sy * gy[n+18] + gy[n+36];
+                gy[n+39] = c00y * gy[n+36] + 2 * b00 * gy[n+18];
+                gy[n+30] = sy * gy[n+21] + gy[n+39];
+                gy[n+42] = c00y * gy[n+39] + b10 * gy[n+36] + 2 * b00 * gy[n+21];
+                gy[n+33] = sy * gy[n+24] + gy[n+42];
+                gy[n+54] = c0py * gy[n+36] + 2 * b01 * gy[n+18];
+                gy[n+45] = sy * gy[n+36] + gy[n+54];
+                gy[n+57] = c00y * gy[n+54] + 3 * b00 * gy[n+36];
+                gy[n+48] = sy * gy[n+39] + gy[n+57];
+                gy[n+60] = c00y * gy[n+57] + b10 * gy[n+54] + 3 * b00 * gy[n+39];
+                gy[n+51] = sy * gy[n+42] + gy[n+60];
+                gz[n+3] = c00z * gz[n+0];
+                gz[n+6] = c00z * gz[n+3] + b10 * gz[n+0];
+                gz[n+18] = c0pz * gz[n+0];
+                gz[n+9] = sz * gz[n+0] + gz[n+18];
+                gz[n+21] = c00z * gz[n+18] + b00 * gz[n+0];
+                gz[n+12] = sz * gz[n+3] + gz[n+21];
+                gz[n+24] = c00z * gz[n+21] + b10 * gz[n+18] + b00 * gz[n+3];
+                gz[n+15] = sz * gz[n+6] + gz[n+24];
+                gz[n+36] = c0pz * gz[n+18] + b01 * gz[n+0];
+                gz[n+27] = sz * gz[n+18] + gz[n+36];
+                gz[n+39] = c00z * gz[n+36] + 2 * b00 * gz[n+18];
+                gz[n+30] = sz * gz[n+21] + gz[n+39];
+                gz[n+42] = c00z * gz[n+39] + b10 * gz[n+36] + 2 * b00 * gz[n+21];
+                gz[n+33] = sz * gz[n+24] + gz[n+42];
+                gz[n+54] = c0pz * gz[n+36] + 2 * b01 * gz[n+18];
+                gz[n+45] = sz * gz[n+36] + gz[n+54];
+                gz[n+57] = c00z * gz[n+54] + 3 * b00 * gz[n+36];
+                gz[n+48] = sz * gz[n+39] + gz[n+57];
+                gz[n+60] = c00z * gz[n+57] + b10 * gz[n+54] + 3 * b00 * gz[n+39];
+                gz[n+51] = sz * gz[n+42] + gz[n+60];
+        }
+}
+static void _gout_2012(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 72;
+        double *gz = g + 144;
+        GOUT(0, _g2_3(gx+51, gz+0));
+        GOUT(1, _g3_3(gx+48, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+48, gz+3));
+        GOUT(3, _g3_3(gx+45, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+45, gy+3, gz+3));
+        GOUT(5, _g2_3(gx+45, gz+6));
+        GOUT(6, _g3_3(gx+42, gy+9, gz+0));
+        GOUT(7, _g3_3(gx+39, gy+12, gz+0));
+        GOUT(8, _g3_3(gx+39, gy+9, gz+3));
+        GOUT(9, _g3_3(gx+36, gy+15, gz+0));
+        GOUT(10, _g3_3(gx+36, gy+12, gz+3));
+        GOUT(11, _g3_3(gx+36, gy+9, gz+6));
+        GOUT(12, _g2_3(gx+42, gz+9));
+        GOUT(13, _g3_3(gx+39, gy+3, gz+9));
+        GOUT(14, _g2_3(gx+39, gz+12));
+        GOUT(15, _g3_3(gx+36, gy+6, gz+9));
+        GOUT(16, _g3_3(gx+36, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+36, gz+15));
+        GOUT(18, _g3_3(gx+33, gy+18, gz+0));
+        GOUT(19, _g3_3(gx+30, gy+21, gz+0));
+        GOUT(20, _g3_3(gx+30, gy+18, gz+3));
+        GOUT(21, _g3_3(gx+27, gy+24, gz+0));
+        GOUT(22, _g3_3(gx+27, gy+21, gz+3));
+        GOUT(23, _g3_3(gx+27, gy+18, gz+6));
+        GOUT(24, _g3_3(gx+24, gy+27, gz+0));
+        GOUT(25, _g3_3(gx+21, gy+30, gz+0));
+        GOUT(26, _g3_3(gx+21, gy+27, gz+3));
+        GOUT(27, _g3_3(gx+18, gy+33, gz+0));
+        GOUT(28, _g3_3(gx+18, gy+30, gz+3));
+        GOUT(29, _g3_3(gx+18, gy+27, gz+6));
+        GOUT(30, _g3_3(gx+24, gy+18, gz+9));
+        GOUT(31, _g3_3(gx+21, gy+21, gz+9));
+        GOUT(32, _g3_3(gx+21, gy+18, gz+12));
+        GOUT(33, _g3_3(gx+18, gy+24, gz+9));
+        GOUT(34, _g3_3(gx+18, gy+21, gz+12));
+        GOUT(35, _g3_3(gx+18, gy+18, gz+15));
+        GOUT(36, _g2_3(gx+33, gz+18));
+        GOUT(37, _g3_3(gx+30, gy+3, gz+18));
+        GOUT(38, _g2_3(gx+30, gz+21));
+        GOUT(39, _g3_3(gx+27, gy+6, gz+18));
+        GOUT(40, _g3_3(gx+27, gy+3, gz+21));
+        GOUT(41, _g2_3(gx+27, gz+24));
+        GOUT(42, _g3_3(gx+24, gy+9, gz+18));
+        GOUT(43, _g3_3(gx+21, gy+12, gz+18));
+        GOUT(44, _g3_3(gx+21, gy+9, gz+21));
+        GOUT(45, _g3_3(gx+18, gy+15, gz+18));
+        GOUT(46, _g3_3(gx+18, gy+12, gz+21));
+        GOUT(47, _g3_3(gx+18, gy+9, gz+24));
+        GOUT(48, _g2_3(gx+24, gz+27));
+        GOUT(49, _g3_3(gx+21, gy+3, gz+27));
+        GOUT(50, _g2_3(gx+21, gz+30));
+        GOUT(51, _g3_3(gx+18, gy+6, gz+27));
+        GOUT(52, _g3_3(gx+18, gy+3, gz+30));
+        GOUT(53, _g2_3(gx+18, gz+33));
+        GOUT(54, _g3_3(gx+15, gy+36, gz+0));
+        GOUT(55, _g3_3(gx+12, gy+39, gz+0));
+        GOUT(56, _g3_3(gx+12, gy+36, gz+3));
+        GOUT(57, _g3_3(gx+9, gy+42, gz+0));
+        GOUT(58, _g3_3(gx+9, gy+39, gz+3));
+        GOUT(59, _g3_3(gx+9, gy+36, gz+6));
+        GOUT(60, _g3_3(gx+6, gy+45, gz+0));
+        GOUT(61, _g3_3(gx+3, gy+48, gz+0));
+        GOUT(62, _g3_3(gx+3, gy+45, gz+3));
+        GOUT(63, _g2_3(gy+51, gz+0));
+        GOUT(64, _g2_3(gy+48, gz+3));
+        GOUT(65, _g2_3(gy+45, gz+6));
+        GOUT(66, _g3_3(gx+6, gy+36, gz+9));
+        GOUT(67, _g3_3(gx+3, gy+39, gz+9));
+        GOUT(68, _g3_3(gx+3, gy+36, gz+12));
+        GOUT(69, _g2_3(gy+42, gz+9));
+        GOUT(70, _g2_3(gy+39, gz+12));
+        GOUT(71, _g2_3(gy+36, gz+15));
+        GOUT(72, _g3_3(gx+15, gy+18, gz+18));
+        GOUT(73, _g3_3(gx+12, gy+21, gz+18));
+        GOUT(74, _g3_3(gx+12, gy+18, gz+21));
+        GOUT(75, _g3_3(gx+9, gy+24, gz+18));
+        GOUT(76, _g3_3(gx+9, gy+21, gz+21));
+        GOUT(77, _g3_3(gx+9, gy+18, gz+24));
+        GOUT(78, _g3_3(gx+6, gy+27, gz+18));
+        GOUT(79, _g3_3(gx+3, gy+30, gz+18));
+        GOUT(80, _g3_3(gx+3, gy+27, gz+21));
+        GOUT(81, _g2_3(gy+33, gz+18));
+        GOUT(82, _g2_3(gy+30, gz+21));
+        GOUT(83, _g2_3(gy+27, gz+24));
+        GOUT(84, _g3_3(gx+6, gy+18, gz+27));
+        GOUT(85, _g3_3(gx+3, gy+21, gz+27));
+        GOUT(86, _g3_3(gx+3, gy+18, gz+30));
+        GOUT(87, _g2_3(gy+24, gz+27));
+        GOUT(88, _g2_3(gy+21, gz+30));
+        GOUT(89, _g2_3(gy+18, gz+33));
+        GOUT(90, _g2_3(gx+15, gz+36));
+        GOUT(91, _g3_3(gx+12, gy+3, gz+36));
+        GOUT(92, _g2_3(gx+12, gz+39));
+        GOUT(93, _g3_3(gx+9, gy+6, gz+36));
+        GOUT(94, _g3_3(gx+9, gy+3, gz+39));
+        GOUT(95, _g2_3(gx+9, gz+42));
+        GOUT(96, _g3_3(gx+6, gy+9, gz+36));
+        GOUT(97, _g3_3(gx+3, gy+12, gz+36));
+        GOUT(98, _g3_3(gx+3, gy+9, gz+39));
+        GOUT(99, _g2_3(gy+15, gz+36));
+        GOUT(100, _g2_3(gy+12, gz+39));
+        GOUT(101, _g2_3(gy+9, gz+42));
+        GOUT(102, _g2_3(gx+6, gz+45));
+        GOUT(103, _g3_3(gx+3, gy+3, gz+45));
+        GOUT(104, _g2_3(gx+3, gz+48));
+        GOUT(105, _g2_3(gy+6, gz+45));
+        GOUT(106, _g2_3(gy+3, gz+48));
+        GOUT(107, _g1_3(gz+51));
+}
+
+static void _g0_2d4d_2020(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 27;
+        double *gz = g + 54;
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+3] = c00x;
+                gx[n+6] = c00x * gx[n+3] + b10;
+                gx[n+9] = c0px;
+                gx[n+12] = c00x * gx[n+9] + b00;
+                gx[n+15] = c00x * gx[n+12] + b10 * gx[n+9] + b00 * gx[n+3];
+                gx[n+18] = c0px * gx[n+9] + b01;
+                gx[n+21] = c00x * gx[n+18] + 2 * b00 * gx[n+9];
+                gx[n+24] = c00x * gx[n+21] + b10 * gx[n+18] + 2 * b00 * gx[n+12];
+                gy[n+3] = c00y;
+                gy[n+6] = c00y * gy[n+3] + b10;
+                gy[n+9] = c0py;
+                gy[n+12] = c00y * gy[n+9] + b00;
+                gy[n+15] = c00y * gy[n+12] + b10 * gy[n+9] + b00 * gy[n+3];
+                gy[n+18] = c0py * gy[n+9] + b01;
+                gy[n+21] = c00y * gy[n+18] + 2 * b00 * gy[n+9];
+                gy[n+24] = c00y * gy[n+21] + b10 * gy[n+18] + 2 * b00 * gy[n+12];
+                gz[n+3] = c00z * gz[n+0];
+                gz[n+6] = c00z * gz[n+3] + b10 * gz[n+0];
+                gz[n+9] = c0pz * gz[n+0];
+                gz[n+12] = c00z * gz[n+9] + b00 * gz[n+0];
+                gz[n+15] = c00z * gz[n+12] + b10 * gz[n+9] + b00 * gz[n+3];
+                gz[n+18] = c0pz * gz[n+9] + b01 * gz[n+0];
+                gz[n+21] = c00z * gz[n+18] + 2 * b00 * gz[n+9];
+                gz[n+24] = c00z * gz[n+21] + b10 * gz[n+18] + 2 * b00 * gz[n+12];
+        }
+}
+static void _gout_2020(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 27;
+        double *gz = g + 54;
+        GOUT(0, _g2_3(gx+24, gz+0));
+        GOUT(1, _g3_3(gx+21, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+21, gz+3));
+        GOUT(3, _g3_3(gx+18, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+18, gy+3, gz+3));
+        GOUT(5, _g2_3(gx+18, gz+6));
+        GOUT(6, _g3_3(gx+15, gy+9, gz+0));
+        GOUT(7, _g3_3(gx+12, gy+12, gz+0));
+        GOUT(8, _g3_3(gx+12, gy+9, gz+3));
+        GOUT(9, _g3_3(gx+9, gy+15, gz+0));
+        GOUT(10, _g3_3(gx+9, gy+12, gz+3));
+        GOUT(11, _g3_3(gx+9, gy+9, gz+6));
+        GOUT(12, _g2_3(gx+15, gz+9));
+        GOUT(13, _g3_3(gx+12, gy+3, gz+9));
+        GOUT(14, _g2_3(gx+12, gz+12));
+        GOUT(15, _g3_3(gx+9, gy+6, gz+9));
+        GOUT(16, _g3_3(gx+9, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+9, gz+15));
+        GOUT(18, _g3_3(gx+6, gy+18, gz+0));
+        GOUT(19, _g3_3(gx+3, gy+21, gz+0));
+        GOUT(20, _g3_3(gx+3, gy+18, gz+3));
+        GOUT(21, _g2_3(gy+24, gz+0));
+        GOUT(22, _g2_3(gy+21, gz+3));
+        GOUT(23, _g2_3(gy+18, gz+6));
+        GOUT(24, _g3_3(gx+6, gy+9, gz+9));
+        GOUT(25, _g3_3(gx+3, gy+12, gz+9));
+        GOUT(26, _g3_3(gx+3, gy+9, gz+12));
+        GOUT(27, _g2_3(gy+15, gz+9));
+        GOUT(28, _g2_3(gy+12, gz+12));
+        GOUT(29, _g2_3(gy+9, gz+15));
+        GOUT(30, _g2_3(gx+6, gz+18));
+        GOUT(31, _g3_3(gx+3, gy+3, gz+18));
+        GOUT(32, _g2_3(gx+3, gz+21));
+        GOUT(33, _g2_3(gy+6, gz+18));
+        GOUT(34, _g2_3(gy+3, gz+21));
+        GOUT(35, _g1_3(gz+24));
+}
+
+static void _g0_2d4d_2021(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 72;
+        double *gz = g + 144;
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+3] = c00x;
+                gx[n+6] = c00x * gx[n+3] + b10;
+                gx[n+9] = c0px;
+                gx[n+12] = c00x * gx[n+9] + b00;
+                gx[n+15] = c00x * gx[n+12] + b10 * gx[n+9] + b00 * gx[n+3];
+                gx[n+18] = c0px * gx[n+9] + b01;
+                gx[n+21] = c00x * gx[n+18] + 2 * b00 * gx[n+9];
+                gx[n+24] = c00x * gx[n+21] + b10 * gx[n+18] + 2 * b00 * gx[n+12];
+                gx[n+36] = sx + gx[n+9];
+                gx[n+39] = sx * gx[n+3] + gx[n+12];
+                gx[n+42] = sx * gx[n+6] + gx[n+15];
+                gx[n+45] = sx * gx[n+9] + gx[n+18];
+                gx[n+48] = sx * gx[n+12] + gx[n+21];
+                gx[n+51] = sx * gx[n+15] + gx[n+24];
+                gx[n+27] = c0px * gx[n+18] + 2 * b01 * gx[n+9];
+                gx[n+54] = sx * gx[n+18] + gx[n+27];
+                gx[n+30] = c00x * gx[n+27] + 3 * b00 * gx[n+18];
+                gx[n+57] = sx * gx[n+21] + gx[n+30];
+                gx[n+33] = c00x * gx[n+30] + b10 * gx[n+27] + 3 * b00 * gx[n+21];
+                gx[n+60] = sx * gx[n+24] + gx[n+33];
+                gy[n+3] = c00y;
+                gy[n+6] = c00y * gy[n+3] + b10;
+                gy[n+9] = c0py;
+                gy[n+12] = c00y * gy[n+9] + b00;
+                gy[n+15] = c00y * gy[n+12] + b10 * gy[n+9] + b00 * gy[n+3];
+                gy[n+18] = c0py * gy[n+9] + b01;
+                gy[n+21] = c00y * gy[n+18] + 2 * b00 * gy[n+9];
+                gy[n+24] = c00y * gy[n+21] + b10 * gy[n+18] + 2 * b00 * gy[n+12];
+                gy[n+36] = sy + gy[n+9];
+                gy[n+39] = sy * gy[n+3] + gy[n+12];
+                gy[n+42] = sy * gy[n+6] + gy[n+15];
+                gy[n+45] = sy * gy[n+9] + gy[n+18];
+                gy[n+48] = sy * gy[n+12] + gy[n+21];
+                gy[n+51] = sy * gy[n+15] + gy[n+24];
+                gy[n+27] = c0py * gy[n+18] + 2 * b01 * gy[n+9];
+                gy[n+54] = sy * gy[n+18] + gy[n+27];
+                gy[n+30] = c00y * gy[n+27] + 3 * b00 * gy[n+18];
+                gy[n+57] = sy * gy[n+21] + gy[n+30];
+                gy[n+33] = c00y * gy[n+30] + b10 * gy[n+27] + 3 * b00 * gy[n+21];
+                gy[n+60] = sy * gy[n+24] + gy[n+33];
+                gz[n+3] = c00z * gz[n+0];
+                gz[n+6] = c00z * gz[n+3] + b10 * gz[n+0];
+                gz[n+9] = c0pz * gz[n+0];
+                gz[n+12] = c00z * gz[n+9] + b00 * gz[n+0];
+                gz[n+15] = c00z * gz[n+12] + b10 * gz[n+9] + b00 * gz[n+3];
+                gz[n+18] = c0pz * gz[n+9] + b01 * gz[n+0];
+                gz[n+21] = c00z * gz[n+18] + 2 * b00 * gz[n+9];
+                gz[n+24] = c00z * gz[n+21] + b10 * gz[n+18] + 2 * b00 * gz[n+12];
+                gz[n+36] = sz * gz[n+0] + gz[n+9];
+                gz[n+39] = sz * gz[n+3] + gz[n+12];
+                gz[n+42] = sz * gz[n+6] + gz[n+15];
+                gz[n+45] = sz * gz[n+9] + gz[n+18];
+                gz[n+48] = sz * gz[n+12] + gz[n+21];
+                gz[n+51] = sz * gz[n+15] + gz[n+24];
+                gz[n+27] = c0pz * gz[n+18] + 2 * b01 * gz[n+9];
+                gz[n+54] = sz * gz[n+18] + gz[n+27];
+                gz[n+30] = c00z * gz[n+27] + 3 * b00 * gz[n+18];
+                gz[n+57] = sz * gz[n+21] + gz[n+30];
+                gz[n+33] = c00z * gz[n+30] + b10 * gz[n+27] + 3 * b00 * gz[n+21];
+                gz[n+60] = sz * gz[n+24] + gz[n+33];
+        }
+}
+static void _gout_2021(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 72;
+        double *gz = g + 144;
+        GOUT(0, _g2_3(gx+60, gz+0));
+        GOUT(1, _g3_3(gx+57, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+57, gz+3));
+        GOUT(3, _g3_3(gx+54, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+54, gy+3, gz+3));
+        GOUT(5, _g2_3(gx+54, gz+6));
+        GOUT(6, _g3_3(gx+51, gy+9, gz+0));
+        GOUT(7, _g3_3(gx+48, gy+12, gz+0));
+        GOUT(8, _g3_3(gx+48, gy+9, gz+3));
+        GOUT(9, _g3_3(gx+45, gy+15, gz+0));
+        GOUT(10, _g3_3(gx+45, gy+12, gz+3));
+        GOUT(11, _g3_3(gx+45, gy+9, gz+6));
+        GOUT(12, _g2_3(gx+51, gz+9));
+        GOUT(13, _g3_3(gx+48, gy+3, gz+9));
+        GOUT(14, _g2_3(gx+48, gz+12));
+        GOUT(15, _g3_3(gx+45, gy+6, gz+9));
+        GOUT(16, _g3_3(gx+45, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+45, gz+15));
+        GOUT(18, _g3_3(gx+42, gy+18, gz+0));
+        GOUT(19, _g3_3(gx+39, gy+21, gz+0));
+        GOUT(20, _g3_3(gx+39, gy+18, gz+3));
+        GOUT(21, _g3_3(gx+36, gy+24, gz+0));
+        GOUT(22, _g3_3(gx+36, gy+21, gz+3));
+        GOUT(23, _g3_3(gx+36, gy+18, gz+6));
+        GOUT(24, _g3_3(gx+42, gy+9, gz+9));
+        GOUT(25, _g3_3(gx+39, gy+12, gz+9));
+        GOUT(26, _g3_3(gx+39, gy+9, gz+12));
+        GOUT(27, _g3_3(gx+36, gy+15, gz+9));
+        GOUT(28, _g3_3(gx+36, gy+12, gz+12));
+        GOUT(29, _g3_3(gx+36, gy+9, gz+15));
+        GOUT(30, _g2_3(gx+42, gz+18));
+        GOUT(31, _g3_3(gx+39, gy+3, gz+18));
+        GOUT(32, _g2_3(gx+39, gz+21));
+        GOUT(33, _g3_3(gx+36, gy+6, gz+18));
+        GOUT(34, _g3_3(gx+36, gy+3, gz+21));
+        GOUT(35, _g2_3(gx+36, gz+24));
+        GOUT(36, _g3_3(gx+24, gy+36, gz+0));
+        GOUT(37, _g3_3(gx+21, gy+39, gz+0));
+        GOUT(38, _g3_3(gx+21, gy+36, gz+3));
+        GOUT(39, _g3_3(gx+18, gy+42, gz+0));
+        GOUT(40, _g3_3(gx+18, gy+39, gz+3));
+        GOUT(41, _g3_3(gx+18, gy+36, gz+6));
+        GOUT(42, _g3_3(gx+15, gy+45, gz+0));
+        GOUT(43, _g3_3(gx+12, gy+48, gz+0));
+        GOUT(44, _g3_3(gx+12, gy+45, gz+3));
+        GOUT(45, _g3_3(gx+9, gy+51, gz+0));
+        GOUT(46, _g3_3(gx+9, gy+48, gz+3));
+        GOUT(47, _g3_3(gx+9, gy+45, gz+6));
+        GOUT(48, _g3_3(gx+15, gy+36, gz+9));
+        GOUT(49, _g3_3(gx+12, gy+39, gz+9));
+        GOUT(50, _g3_3(gx+12, gy+36, gz+12));
+        GOUT(51, _g3_3(gx+9, gy+42, gz+9));
+        GOUT(52, _g3_3(gx+9, gy+39, gz+12));
+        GOUT(53, _g3_3(gx+9, gy+36, gz+15));
+        GOUT(54, _g3_3(gx+6, gy+54, gz+0));
+        GOUT(55, _g3_3(gx+3, gy+57, gz+0));
+        GOUT(56, _g3_3(gx+3, gy+54, gz+3));
+        GOUT(57, _g2_3(gy+60, gz+0));
+        GOUT(58, _g2_3(gy+57, gz+3));
+        GOUT(59, _g2_3(gy+54, gz+6));
+        GOUT(60, _g3_3(gx+6, gy+45, gz+9));
+        GOUT(61, _g3_3(gx+3, gy+48, gz+9));
+        GOUT(62, _g3_3(gx+3, gy+45, gz+12));
+        GOUT(63, _g2_3(gy+51, gz+9));
+        GOUT(64, _g2_3(gy+48, gz+12));
+        GOUT(65, _g2_3(gy+45, gz+15));
+        GOUT(66, _g3_3(gx+6, gy+36, gz+18));
+        GOUT(67, _g3_3(gx+3, gy+39, gz+18));
+        GOUT(68, _g3_3(gx+3, gy+36, gz+21));
+        GOUT(69, _g2_3(gy+42, gz+18));
+        GOUT(70, _g2_3(gy+39, gz+21));
+        GOUT(71, _g2_3(gy+36, gz+24));
+        GOUT(72, _g2_3(gx+24, gz+36));
+        GOUT(73, _g3_3(gx+21, gy+3, gz+36));
+        GOUT(74, _g2_3(gx+21, gz+39));
+        GOUT(75, _g3_3(gx+18, gy+6, gz+36));
+        GOUT(76, _g3_3(gx+18, gy+3, gz+39));
+        GOUT(77, _g2_3(gx+18, gz+42));
+        GOUT(78, _g3_3(gx+15, gy+9, gz+36));
+        GOUT(79, _g3_3(gx+12, gy+12, gz+36));
+        GOUT(80, _g3_3(gx+12, gy+9, gz+39));
+        GOUT(81, _g3_3(gx+9, gy+15, gz+36));
+        GOUT(82, _g3_3(gx+9, gy+12, gz+39));
+        GOUT(83, _g3_3(gx+9, gy+9, gz+42));
+        GOUT(84, _g2_3(gx+15, gz+45));
+        GOUT(85, _g3_3(gx+12, gy+3, gz+45));
+        GOUT(86, _g2_3(gx+12, gz+48));
+        GOUT(87, _g3_3(gx+9, gy+6, gz+45));
+        GOUT(88, _g3_3(gx+9, gy+3, gz+48));
+        GOUT(89, _g2_3(gx+9, gz+51));
+        GOUT(90, _g3_3(gx+6, gy+18, gz+36));
+        GOUT(91, _g3_3(gx+3, gy+21, gz+36));
+        GOUT(92, _g3_3(gx+3, gy+18, gz+39));
+        GOUT(93, _g2_3(gy+24, gz+36));
+        GOUT(94, _g2_3(gy+21, gz+39));
+        GOUT(95, _g2_3(gy+18, gz+42));
+        GOUT(96, _g3_3(gx+6, gy+9, gz+45));
+        GOUT(97, _g3_3(gx+3, gy+12, gz+45));
+        GOUT(98, _g3_3(gx+3, gy+9, gz+48));
+        GOUT(99, _g2_3(gy+15, gz+45));
+        GOUT(100, _g2_3(gy+12, gz+48));
+        GOUT(101, _g2_3(gy+9, gz+51));
+        GOUT(102, _g2_3(gx+6, gz+54));
+        GOUT(103, _g3_3(gx+3, gy+3, gz+54));
+        GOUT(104, _g2_3(gx+3, gz+57));
+        GOUT(105, _g2_3(gy+6, gz+54));
+        GOUT(106, _g2_3(gy+3, gz+57));
+        GOUT(107, _g1_3(gz+60));
+}
+
+static void _g0_2d4d_2022(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 180;
+        double *gz = g + 360;
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 4; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+4] = c00x;
+                gx[n+8] = c00x * gx[n+4] + b10;
+                gx[n+36] = c0px;
+                gx[n+12] = sx + gx[n+36];
+                gx[n+40] = c00x * gx[n+36] + b00;
+                gx[n+16] = sx * gx[n+4] + gx[n+40];
+                gx[n+44] = c00x * gx[n+40] + b10 * gx[n+36] + b00 * gx[n+4];
+                gx[n+20] = sx * gx[n+8] + gx[n+44];
+                gx[n+72] = c0px * gx[n+36] + b01;
+                gx[n+48] = sx * gx[n+36] + gx[n+72];
+                gx[n+24] = sx * gx[n+12] + gx[n+48];
+                gx[n+76] = c00x * gx[n+72] + 2 * b00 * gx[n+36];
+                gx[n+52] = sx * gx[n+40] + gx[n+76];
+                gx[n+28] = sx * gx[n+16] + gx[n+52];
+                gx[n+80] = c00x * gx[n+76] + b10 * gx[n+72] + 2 * b00 * gx[n+40];
+                gx[n+56] = sx * gx[n+44] + gx[n+80];
+                gx[n+32] = sx * gx[n+20] + gx[n+56];
+                gx[n+108] = c0px * gx[n+72] + 2 * b01 * gx[n+36];
+                gx[n+84] = sx * gx[n+72] + gx[n+108];
+                gx[n+60] = sx * gx[n+48] + gx[n+84];
+                gx[n+112] = c00x * gx[n+108] + 3 * b00 * gx[n+72];
+                gx[n+88] = sx * gx[n+76] + gx[n+112];
+                gx[n+64] = sx * gx[n+52] + gx[n+88];
+                gx[n+116] = c00x * gx[n+112] + b10 * gx[n+108] + 3 * b00 * gx[n+76];
+                gx[n+92] = sx * gx[n+80] + gx[n+116];
+                gx[n+68] = sx * gx[n+56] + gx[n+92];
+                gx[n+144] = c0px * gx[n+108] + 3 * b01 * gx[n+72];
+                gx[n+120] = sx * gx[n+108] + gx[n+144];
+                gx[n+96] = sx * gx[n+84] + gx[n+120];
+                gx[n+148] = c00x * gx[n+144] + 4 * b00 * gx[n+108];
+                gx[n+124] = sx * gx[n+112] + gx[n+148];
+                gx[n+100] = sx * gx[n+88] + gx[n+124];
+                gx[n+152] = c00x * gx[n+148] + b10 * gx[n+144] + 4 * b00 * gx[n+112];
+                gx[n+128] = sx * gx[n+116] + gx[n+152];
+                gx[n+104] = sx * gx[n+92] + gx[n+128];
+                gy[n+4] = c00y;
+                gy[n+8] = c00y * gy[n+4] + b10;
+                gy[n+36] = c0py;
+                gy[n+12] = sy + gy[n+36];
+                gy[n+40] = c00y * gy[n+36] + b00;
+                gy[n+16] = sy * gy[n+4] + gy[n+40];
+                gy[n+44] = c00y * gy[n+40] + b10 * gy[n+36] + b00 * gy[n+4];
+                gy[n+20] = sy * gy[n+8] + gy[n+44];
+                gy[n+72] = c0py * gy[n+36] + b01;
+                gy[n+48] = sy * gy[n+36] + gy[n+72];
+                gy[n+24] = sy * gy[n+12] + gy[n+48];
+                gy[n+76] = c00y * gy[n+72] + 2 * b00 * gy[n+36];
+                gy[n+52] = sy * gy[n+40] + gy[n+76];
+                gy[n+28] = sy * gy[n+16] + gy[n+52];
+                gy[n+80] = c00y * gy[n+76] + b10 * gy[n+72] + 2 * b00 * gy[n+40];
+                gy[n+56] = sy * gy[n+44] + gy[n+80];
+                gy[n+32] = sy * gy[n+20] + gy[n+56];
+                gy[n+108] = c0py * gy[n+72] + 2 * b01 * gy[n+36];
+                gy[n+84] = sy * gy[n+72] + gy[n+108];
+                gy[n+60] = sy * gy[n+48] + gy[n+84];
+                gy[n+112] = c00y * gy[n+108] + 3 * b00 * gy[n+72];
+                gy[n+88] = sy * gy[n+76] + gy[n+112];
+                gy[n+64] = sy * gy[n+52] + gy[n+88];
+                gy[n+116] = c00y * gy[n+112] + b10 * gy[n+108] + 3 * b00 * gy[n+76];
+                gy[n+92] = sy * gy[n+80] + gy[n+116];
+                gy[n+68] = sy * gy[n+56] + gy[n+92];
+                gy[n+144] = c0py * gy[n+108] + 3 * b01 * gy[n+72];
+                gy[n+120] = sy * gy[n+108] + gy[n+144];
+                gy[n+96] = sy * gy[n+84] + gy[n+120];
+                gy[n+148] = c00y * gy[n+144] + 4 * b00 * gy[n+108];
+                gy[n+124] = sy * gy[n+112] + gy[n+148];
+                gy[n+100] = sy * gy[n+88] + gy[n+124];
+                gy[n+152] = c00y * gy[n+148] + b10 * gy[n+144] + 4 * b00 * gy[n+112];
+                gy[n+128] = sy * gy[n+116] + gy[n+152];
+                gy[n+104] = sy * gy[n+92] + gy[n+128];
+                gz[n+4] = c00z * gz[n+0];
+                gz[n+8] = c00z * gz[n+4] + b10 * gz[n+0];
+                gz[n+36] = c0pz * gz[n+0];
+                gz[n+12] = sz * gz[n+0] + gz[n+36];
+                gz[n+40] = c00z * gz[n+36] + b00 * gz[n+0];
+                gz[n+16] = sz * gz[n+4] + gz[n+40];
+                gz[n+44] = c00z * gz[n+40] + b10 * gz[n+36] + b00 * gz[n+4];
+                gz[n+20] = sz * gz[n+8] + gz[n+44];
+                gz[n+72] = c0pz * gz[n+36] + b01 * gz[n+0];
+                gz[n+48] = sz * gz[n+36] + gz[n+72];
+                gz[n+24] = sz * gz[n+12] + gz[n+48];
+                gz[n+76] = c00z * gz[n+72] + 2 * b00 * gz[n+36];
+                gz[n+52] = sz * gz[n+40] + gz[n+76];
+                gz[n+28] = sz * gz[n+16] + gz[n+52];
+                gz[n+80] = c00z * gz[n+76] + b10 * gz[n+72] + 2 * b00 * gz[n+40];
+                gz[n+56] = sz * gz[n+44] + gz[n+80];
+                gz[n+32] = sz * gz[n+20] + gz[n+56];
+                gz[n+108] = c0pz * gz[n+72] + 2 * b01 * gz[n+36];
+                gz[n+84] = sz * gz[n+72] + gz[n+108];
+                gz[n+60] = sz * gz[n+48] + gz[n+84];
+                gz[n+112] = c00z * gz[n+108] + 3 * b00 * gz[n+72];
+                gz[n+88] = sz * gz[n+76] + gz[n+112];
+                gz[n+64] = sz * gz[n+52] + gz[n+88];
+                gz[n+116] = c00z * gz[n+112] + b10 * gz[n+108] + 3 * b00 * gz[n+76];
+                gz[n+92] = sz * gz[n+80] + gz[n+116];
+                gz[n+68] = sz * gz[n+56] + gz[n+92];
+                gz[n+144] = c0pz * gz[n+108] + 3 * b01 * gz[n+72];
+                gz[n+120] = sz * gz[n+108] + gz[n+144];
+                gz[n+96] = sz * gz[n+84] + gz[n+120];
+                gz[n+148] = c00z * gz[n+144] + 4 * b00 * gz[n+108];
+                gz[n+124] = sz * gz[n+112] + gz[n+148];
+                gz[n+100] = sz * gz[n+88] + gz[n+124];
+                gz[n+152] = c00z * gz[n+148] + b10 * gz[n+144] + 4 * b00 * gz[n+112];
+                gz[n+128] = sz * gz[n+116] + gz[n+152];
+                gz[n+104] = sz * gz[n+92] + gz[n+128];
+        }
+}
+static void _gout_2022(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 180;
+        double *gz = g + 360;
+        GOUT(0, _g2_4(gx+104, gz+0));
+        GOUT(1, _g3_4(gx+100, gy+4, gz+0));
+        GOUT(2, _g2_4(gx+100, gz+4));
+        GOUT(3, _g3_4(gx+96, gy+8, gz+0));
+        GOUT(4, _g3_4(gx+96, gy+4, gz+4));
+        GOUT(5, _g2_4(gx+96, gz+8));
+        GOUT(6, _g3_4(gx+92, gy+12, gz+0));
+        GOUT(7, _g3_4(gx+88, gy+16, gz+0));
+        GOUT(8, _g3_4(gx+88, gy+12, gz+4));
+        GOUT(9, _g3_4(gx+84, gy+20, gz+0));
+        GOUT(10, _g3_4(gx+84, gy+16, gz+4));
+        GOUT(11, _g3_4(gx+84, gy+12, gz+8));
+        GOUT(12, _g2_4(gx+92, gz+12));
+        GOUT(13, _g3_4(gx+88, gy+4, gz+12));
+        GOUT(14, _g2_4(gx+88, gz+16));
+        GOUT(15, _g3_4(gx+84, gy+8, gz+12));
+        GOUT(16, _g3_4(gx+84, gy+4, gz+16));
+        GOUT(17, _g2_4(gx+84, gz+20));
+        GOUT(18, _g3_4(gx+80, gy+24, gz+0));
+        GOUT(19, _g3_4(gx+76, gy+28, gz+0));
+        GOUT(20, _g3_4(gx+76, gy+24, gz+4));
+        GOUT(21, _g3_4(gx+72, gy+32, gz+0));
+        GOUT(22, _g3_4(gx+72, gy+28, gz+4));
+        GOUT(23, _g3_4(gx+72, gy+24, gz+8));
+        GOUT(24, _g3_4(gx+80, gy+12, gz+12));
+        GOUT(25, _g3_4(gx+76, gy+16, gz+12));
+        GOUT(26, _g3_4(gx+76, gy+12, gz+16));
+        GOUT(27, _g3_4(gx+72, gy+20, gz+12));
+        GOUT(28, _g3_4(gx+72, gy+16, gz+16));
+        GOUT(29, _g3_4(gx+72, gy+12, gz+20));
+        GOUT(30, _g2_4(gx+80, gz+24));
+        GOUT(31, _g3_4(gx+76, gy+4, gz+24));
+        GOUT(32, _g2_4(gx+76, gz+28));
+        GOUT(33, _g3_4(gx+72, gy+8, gz+24));
+        GOUT(34, _g3_4(gx+72, gy+4, gz+28));
+        GOUT(35, _g2_4(gx+72, gz+32));
+        GOUT(36, _g3_4(gx+68, gy+36, gz+0));
+        GOUT(37, _g3_4(gx+64, gy+40, gz+0));
+        GOUT(38, _g3_4(gx+64, gy+36, gz+4));
+        GOUT(39, _g3_4(gx+60, gy+44, gz+0));
+        GOUT(40, _g3_4(gx+60, gy+40, gz+4));
+        GOUT(41, _g3_4(gx+60, gy+36, gz+8));
+        GOUT(42, _g3_4(gx+56, gy+48, gz+0));
+        GOUT(43, _g3_4(gx+52, gy+52, gz+0));
+        GOUT(44, _g3_4(gx+52, gy+48, gz+4));
+        GOUT(45, _g3_4(gx+48, gy+56, gz+0));
+        GOUT(46, _g3_4(gx+48, gy+52, gz+4));
+        GOUT(47, _g3_4(gx+48, gy+48, gz+8));
+        GOUT(48, _g3_4(gx+56, gy+36, gz+12));
+        GOUT(49, _g3_4(gx+52, gy+40, gz+12));
+        GOUT(50, _g3_4(gx+52, gy+36, gz+16));
+        GOUT(51, _g3_4(gx+48, gy+44, gz+12));
+        GOUT(52, _g3_4(gx+48, gy+40, gz+16));
+        GOUT(53, _g3_4(gx+48, gy+36, gz+20));
+        GOUT(54, _g3_4(gx+44, gy+60, gz+0));
+        GOUT(55, _g3_4(gx+40, gy+64, gz+0));
+        GOUT(56, _g3_4(gx+40, gy+60, gz+4));
+        GOUT(57, _g3_4(gx+36, gy+68, gz+0));
+        GOUT(58, _g3_4(gx+36, gy+64, gz+4));
+        GOUT(59, _g3_4(gx+36, gy+60, gz+8));
+        GOUT(60, _g3_4(gx+44, gy+48, gz+12));
+        GOUT(61, _g3_4(gx+40, gy+52, gz+12));
+        GOUT(62, _g3_4(gx+40, gy+48, gz+16));
+        GOUT(63, _g3_4(gx+36, gy+56, gz+12));
+        GOUT(64, _g3_4(gx+36, gy+52, gz+16));
+        GOUT(65, _g3_4(gx+36, gy+48, gz+20));
+        GOUT(66, _g3_4(gx+44, gy+36, gz+24));
+        GOUT(67, _g3_4(gx+40, gy+40, gz+24));
+        GOUT(68, _g3_4(gx+40, gy+36, gz+28));
+        GOUT(69, _g3_4(gx+36, gy+44, gz+24));
+        GOUT(70, _g3_4(gx+36, gy+40, gz+28));
+        GOUT(71, _g3_4(gx+36, gy+36, gz+32));
+        GOUT(72, _g2_4(gx+68, gz+36));
+        GOUT(73, _g3_4(gx+64, gy+4, gz+36));
+        GOUT(74, _g2_4(gx+64, gz+40));
+        GOUT(75, _g3_4(gx+60, gy+8, gz+36));
+        GOUT(76, _g3_4(gx+60, gy+4, gz+40));
+        GOUT(77, _g2_4(gx+60, gz+44));
+        GOUT(78, _g3_4(gx+56, gy+12, gz+36));
+        GOUT(79, _g3_4(gx+52, gy+16, gz+36));
+        GOUT(80, _g3_4(gx+52, gy+12, gz+40));
+        GOUT(81, _g3_4(gx+48, gy+20, gz+36));
+        GOUT(82, _g3_4(gx+48, gy+16, gz+40));
+        GOUT(83, _g3_4(gx+48, gy+12, gz+44));
+        GOUT(84, _g2_4(gx+56, gz+48));
+        GOUT(85, _g3_4(gx+52, gy+4, gz+48));
+        GOUT(86, _g2_4(gx+52, gz+52));
+        GOUT(87, _g3_4(gx+48, gy+8, gz+48));
+        GOUT(88, _g3_4(gx+48, gy+4, gz+52));
+        GOUT(89, _g2_4(gx+48, gz+56));
+        GOUT(90, _g3_4(gx+44, gy+24, gz+36));
+        GOUT(91, _g3_4(gx+40, gy+28, gz+36));
+        GOUT(92, _g3_4(gx+40, gy+24, gz+40));
+        GOUT(93, _g3_4(gx+36, gy+32, gz+36));
+        GOUT(94, _g3_4(gx+36, gy+28, gz+40));
+        GOUT(95, _g3_4(gx+36, gy+24, gz+44));
+        GOUT(96, _g3_4(gx+44, gy+12, gz+48));
+        GOUT(97, _g3_4(gx+40, gy+16, gz+48));
+        GOUT(98, _g3_4(gx+40, gy+12, gz+52));
+        GOUT(99, _g3_4(gx+36, gy+20, gz+48));
+        GOUT(100, _g3_4(gx+36, gy+16, gz+52));
+        GOUT(101, _g3_4(gx+36, gy+12, gz+56));
+        GOUT(102, _g2_4(gx+44, gz+60));
+        GOUT(103, _g3_4(gx+40, gy+4, gz+60));
+        GOUT(104, _g2_4(gx+40, gz+64));
+        GOUT(105, _g3_4(gx+36, gy+8, gz+60));
+        GOUT(106, _g3_4(gx+36, gy+4, gz+64));
+        GOUT(107, _g2_4(gx+36, gz+68));
+        GOUT(108, _g3_4(gx+32, gy+72, gz+0));
+        GOUT(109, _g3_4(gx+28, gy+76, gz+0));
+        GOUT(110, _g3_4(gx+28, gy+72, gz+4));
+        GOUT(111, _g3_4(gx+24, gy+80, gz+0));
+        GOUT(112, _g3_4(gx+24, gy+76, gz+4));
+        GOUT(113, _g3_4(gx+24, gy+72, gz+8));
+        GOUT(114, _g3_4(gx+20, gy+84, gz+0));
+        GOUT(115, _g3_4(gx+16, gy+88, gz+0));
+        GOUT(116, _g3_4(gx+16, gy+84, gz+4));
+        GOUT(117, _g3_4(gx+12, gy+92, gz+0));
+        GOUT(118, _g3_4(gx+12, gy+88, gz+4));
+        GOUT(119, _g3_4(gx+12, gy+84, gz+8));
+        GOUT(120, _g3_4(gx+20, gy+72, gz+12));
+        GOUT(121, _g3_4(gx+16, gy+76, gz+12));
+        GOUT(122, _g3_4(gx+16, gy+72, gz+16));
+        GOUT(123, _g3_4(gx+12, gy+80, gz+12));
+        GOUT(124, _g3_4(gx+12, gy+76, gz+16));
+        GOUT(125, _g3_4(gx+12, gy+72, gz+20));
+        GOUT(126, _g3_4(gx+8, gy+96, gz+0));
+        GOUT(127, _g3_4(gx+4, gy+100, gz+0));
+        GOUT(128, _g3_4(gx+4, gy+96, gz+4));
+        GOUT(129, _g2_4(gy+104, gz+0));
+        GOUT(130, _g2_4(gy+100, gz+4));
+        GOUT(131, _g2_4(gy+96, gz+8));
+        GOUT(132, _g3_4(gx+8, gy+84, gz+12));
+        GOUT(133, _g3_4(gx+4, gy+88, gz+12));
+        GOUT(134, _g3_4(gx+4, gy+84, gz+16));
+        GOUT(135, _g2_4(gy+92, gz+12));
+        GOUT(136, _g2_4(gy+88, gz+16));
+        GOUT(137, _g2_4(gy+84, gz+20));
+        GOUT(138, _g3_4(gx+8, gy+72, gz+24));
+        GOUT(139, _g3_4(gx+4, gy+76, gz+24));
+        GOUT(140, _g3_4(gx+4, gy+72, gz+28));
+        GOUT(141, _g2_4(gy+80, gz+24));
+        GOUT(142, _g2_4(gy+76, gz+28));
+        GOUT(143, _g2_4(gy+72, gz+32));
+        GOUT(144, _g3_4(gx+32, gy+36, gz+36));
+        GOUT(145, _g3_4(gx+28, gy+40, gz+36));
+        GOUT(146, _g3_4(gx+28, gy+36, gz+40));
+        GOUT(147, _g3_4(gx+24, gy+44, gz+36));
+        GOUT(148, _g3_4(gx+24, gy+40, gz+40));
+        GOUT(149, _g3_4(gx+24, gy+36, gz+44));
+        GOUT(150, _g3_4(gx+20, gy+48, gz+36));
+        GOUT(151, _g3_4(gx+16, gy+52, gz+36));
+        GOUT(152, _g3_4(gx+16, gy+48, gz+40));
+        GOUT(153, _g3_4(gx+12, gy+56, gz+36));
+        GOUT(154, _g3_4(gx+12, gy+52, gz+40));
+        GOUT(155, _g3_4(gx+12, gy+48, gz+44));
+        GOUT(156, _g3_4(gx+20, gy+36, gz+48));
+        GOUT(157, _g3_4(gx+16, gy+40, gz+48));
+        GOUT(158, _g3_4(gx+16, gy+36, gz+52));
+        GOUT(159, _g3_4(gx+12, gy+44, gz+48));
+        GOUT(160, _g3_4(gx+12, gy+40, gz+52));
+        GOUT(161, _g3_4(gx+12, gy+36, gz+56));
+        GOUT(162, _g3_4(gx+8, gy+60, gz+36));
+        GOUT(163, _g3_4(gx+4, gy+64, gz+36));
+        GOUT(164, _g3_4(gx+4, gy+60, gz+40));
+        GOUT(165, _g2_4(gy+68, gz+36));
+        GOUT(166, _g2_4(gy+64, gz+40));
+        GOUT(167, _g2_4(gy+60, gz+44));
+        GOUT(168, _g3_4(gx+8, gy+48, gz+48));
+        GOUT(169, _g3_4(gx+4, gy+52, gz+48));
+        GOUT(170, _g3_4(gx+4, gy+48, gz+52));
+        GOUT(171, _g2_4(gy+56, gz+48));
+        GOUT(172, _g2_4(gy+52, gz+52));
+        GOUT(173, _g2_4(gy+48, gz+56));
+        GOUT(174, _g3_4(gx+8, gy+36, gz+60));
+        GOUT(175, _g3_4(gx+4, gy+40, gz+60));
+        GOUT(176, _g3_4(gx+4, gy+36, gz+64));
+        GOUT(177, _g2_4(gy+44, gz+60));
+        GOUT(178, _g2_4(gy+40, gz+64));
+        GOUT(179, _g2_4(gy+36, gz+68));
+        GOUT(180, _g2_4(gx+32, gz+72));
+        GOUT(181, _g3_4(gx+28, gy+4, gz+72));
+        GOUT(182, _g2_4(gx+28, gz+76));
+        GOUT(183, _g3_4(gx+24, gy+8, gz+72));
+        GOUT(184, _g3_4(gx+24, gy+4, gz+76));
+        GOUT(185, _g2_4(gx+24, gz+80));
+        GOUT(186, _g3_4(gx+20, gy+12, gz+72));
+        GOUT(187, _g3_4(gx+16, gy+16, gz+72));
+        GOUT(188, _g3_4(gx+16, gy+12, gz+76));
+        GOUT(189, _g3_4(gx+12, gy+20, gz+72));
+        GOUT(190, _g3_4(gx+12, gy+16, gz+76));
+        GOUT(191, _g3_4(gx+12, gy+12, gz+80));
+        GOUT(192, _g2_4(gx+20, gz+84));
+        GOUT(193, _g3_4(gx+16, gy+4, gz+84));
+        GOUT(194, _g2_4(gx+16, gz+88));
+        GOUT(195, _g3_4(gx+12, gy+8, gz+84));
+        GOUT(196, _g3_4(gx+12, gy+4, gz+88));
+        GOUT(197, _g2_4(gx+12, gz+92));
+        GOUT(198, _g3_4(gx+8, gy+24, gz+72));
+        GOUT(199, _g3_4(gx+4, gy+28, gz+72));
+        GOUT(200, _g3_4(gx+4, gy+24, gz+76));
+        GOUT(201, _g2_4(gy+32, gz+72));
+        GOUT(202, _g2_4(gy+28, gz+76));
+        GOUT(203, _g2_4(gy+24, gz+80));
+        GOUT(204, _g3_4(gx+8, gy+12, gz+84));
+        GOUT(205, _g3_4(gx+4, gy+16, gz+84));
+        GOUT(206, _g3_4(gx+4, gy+12, gz+88));
+        GOUT(207, _g2_4(gy+20, gz+84));
+        GOUT(208, _g2_4(gy+16, gz+88));
+        GOUT(209, _g2_4(gy+12, gz+92));
+        GOUT(210, _g2_4(gx+8, gz+96));
+        GOUT(211, _g3_4(gx+4, gy+4, gz+96));
+        GOUT(212, _g2_4(gx+4, gz+100));
+        GOUT(213, _g2_4(gy+8, gz+96));
+        GOUT(214, _g2_4(gy+4, gz+100));
+        GOUT(215, _g1_4(gz+104));
+}
+
+static void _gout_2100(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 16;
+        double *gz = g + 32;
+        GOUT(0, _g2_2(gx+12, gz+0));
+        GOUT(1, _g3_2(gx+10, gy+2, gz+0));
+        GOUT(2, _g2_2(gx+10, gz+2));
+        GOUT(3, _g3_2(gx+8, gy+4, gz+0));
+        GOUT(4, _g3_2(gx+8, gy+2, gz+2));
+        GOUT(5, _g2_2(gx+8, gz+4));
+        GOUT(6, _g3_2(gx+4, gy+8, gz+0));
+        GOUT(7, _g3_2(gx+2, gy+10, gz+0));
+        GOUT(8, _g3_2(gx+2, gy+8, gz+2));
+        GOUT(9, _g2_2(gy+12, gz+0));
+        GOUT(10, _g2_2(gy+10, gz+2));
+        GOUT(11, _g2_2(gy+8, gz+4));
+        GOUT(12, _g2_2(gx+4, gz+8));
+        GOUT(13, _g3_2(gx+2, gy+2, gz+8));
+        GOUT(14, _g2_2(gx+2, gz+10));
+        GOUT(15, _g2_2(gy+4, gz+8));
+        GOUT(16, _g2_2(gy+2, gz+10));
+        GOUT(17, _g1_2(gz+12));
+}
+
+static void _g0_2d4d_2101(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 48;
+        double *gz = g + 96;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+3] = c00x;
+                gx[n+6] = c00x * gx[n+3] + b10;
+                gx[n+12] = c0px;
+                gx[n+15] = c00x * gx[n+12] + b00;
+                gx[n+18] = c00x * gx[n+15] + b10 * gx[n+12] + b00 * gx[n+3];
+                gx[n+24] = rx + gx[n+3];
+                gx[n+27] = rx * gx[n+3] + gx[n+6];
+                gx[n+9] = c00x * gx[n+6] + 2 * b10 * gx[n+3];
+                gx[n+30] = rx * gx[n+6] + gx[n+9];
+                gx[n+36] = rx * gx[n+12] + gx[n+15];
+                gx[n+39] = rx * gx[n+15] + gx[n+18];
+                gx[n+21] = c00x * gx[n+18] + 2 * b10 * gx[n+15] + b00 * gx[n+6];
+                gx[n+42] = rx * gx[n+18] + gx[n+21];
+                gy[n+3] = c00y;
+                gy[n+6] = c00y * gy[n+3] + b10;
+                gy[n+12] = c0py;
+                gy[n+15] = c00y * gy[n+12] + b00;
+                gy[n+18] = c00y * gy[n+15] + b10 * gy[n+12] + b00 * gy[n+3];
+                gy[n+24] = ry + gy[n+3];
+                gy[n+27] = ry * gy[n+3] + gy[n+6];
+                gy[n+9] = c00y * gy[n+6] + 2 * b10 * gy[n+3];
+                gy[n+30] = ry * gy[n+6] + gy[n+9];
+                gy[n+36] = ry * gy[n+12] + gy[n+15];
+                gy[n+39] = ry * gy[n+15] + gy[n+18];
+                gy[n+21] = c00y * gy[n+18] + 2 * b10 * gy[n+15] + b00 * gy[n+6];
+                gy[n+42] = ry * gy[n+18] + gy[n+21];
+                gz[n+3] = c00z * gz[n+0];
+                gz[n+6] = c00z * gz[n+3] + b10 * gz[n+0];
+                gz[n+12] = c0pz * gz[n+0];
+                gz[n+15] = c00z * gz[n+12] + b00 * gz[n+0];
+                gz[n+18] = c00z * gz[n+15] + b10 * gz[n+12] + b00 * gz[n+3];
+                gz[n+24] = rz * gz[n+0] + gz[n+3];
+                gz[n+27] = rz * gz[n+3] + gz[n+6];
+                gz[n+9] = c00z * gz[n+6] + 2 * b10 * gz[n+3];
+                gz[n+30] = rz * gz[n+6] + gz[n+9];
+                gz[n+36] = rz * gz[n+12] + gz[n+15];
+                gz[n+39] = rz * gz[n+15] + gz[n+18];
+                gz[n+21] = c00z * gz[n+18] + 2 * b10 * gz[n+15] + b00 * gz[n+6];
+                gz[n+42] = rz * gz[n+18] + gz[n+21];
+        }
+}
+static void _gout_2101(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 48;
+        double *gz = g + 96;
+        GOUT(0, _g2_3(gx+42, gz+0));
+        GOUT(1, _g3_3(gx+39, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+39, gz+3));
+        GOUT(3, _g3_3(gx+36, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+36, gy+3, gz+3));
+        GOUT(5, _g2_3(gx+36, gz+6));
+        GOUT(6, _g3_3(gx+30, gy+12, gz+0));
+        GOUT(7, _g3_3(gx+27, gy+15, gz+0));
+        GOUT(8, _g3_3(gx+27, gy+12, gz+3));
+        GOUT(9, _g3_3(gx+24, gy+18, gz+0));
+        GOUT(10, _g3_3(gx+24, gy+15, gz+3));
+        GOUT(11, _g3_3(gx+24, gy+12, gz+6));
+        GOUT(12, _g2_3(gx+30, gz+12));
+        GOUT(13, _g3_3(gx+27, gy+3, gz+12));
+        GOUT(14, _g2_3(gx+27, gz+15));
+        GOUT(15, _g3_3(gx+24, gy+6, gz+12));
+        GOUT(16, _g3_3(gx+24, gy+3, gz+15));
+        GOUT(17, _g2_3(gx+24, gz+18));
+        GOUT(18, _g3_3(gx+18, gy+24, gz+0));
+        GOUT(19, _g3_3(gx+15, gy+27, gz+0));
+        GOUT(20, _g3_3(gx+15, gy+24, gz+3));
+        GOUT(21, _g3_3(gx+12, gy+30, gz+0));
+        GOUT(22, _g3_3(gx+12, gy+27, gz+3));
+        GOUT(23, _g3_3(gx+12, gy+24, gz+6));
+        GOUT(24, _g3_3(gx+6, gy+36, gz+0));
+        GOUT(25, _g3_3(gx+3, gy+39, gz+0));
+        GOUT(26, _g3_3(gx+3, gy+36, gz+3));
+        GOUT(27, _g2_3(gy+42, gz+0));
+        GOUT(28, _g2_3(gy+39, gz+3));
+        GOUT(29, _g2_3(gy+36, gz+6));
+        GOUT(30, _g3_3(gx+6, gy+24, gz+12));
+        GOUT(31, _g3_3(gx+3, gy+27, gz+12));
+        GOUT(32, _g3_3(gx+3, gy+24, gz+15));
+        GOUT(33, _g2_3(gy+30, gz+12));
+        GOUT(34, _g2_3(gy+27, gz+15));
+        GOUT(35, _g2_3(gy+24, gz+18));
+        GOUT(36, _g2_3(gx+18, gz+24));
+        GOUT(37, _g3_3(gx+15, gy+3, gz+24));
+        GOUT(38, _g2_3(gx+15, gz+27));
+        GOUT(39, _g3_3(gx+12, gy+6, gz+24));
+        GOUT(40, _g3_3(gx+12, gy+3, gz+27));
+        GOUT(41, _g2_3(gx+12, gz+30));
+        GOUT(42, _g3_3(gx+6, gy+12, gz+24));
+        GOUT(43, _g3_3(gx+3, gy+15, gz+24));
+        GOUT(44, _g3_3(gx+3, gy+12, gz+27));
+        GOUT(45, _g2_3(gy+18, gz+24));
+        GOUT(46, _g2_3(gy+15, gz+27));
+        GOUT(47, _g2_3(gy+12, gz+30));
+        GOUT(48, _g2_3(gx+6, gz+36));
+        GOUT(49, _g3_3(gx+3, gy+3, gz+36));
+        GOUT(50, _g2_3(gx+3, gz+39));
+        GOUT(51, _g2_3(gy+6, gz+36));
+        GOUT(52, _g2_3(gy+3, gz+39));
+        GOUT(53, _g1_3(gz+42));
+}
+
+static void _g0_2d4d_2102(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 72;
+        double *gz = g + 144;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+3] = c00x;
+                gx[n+6] = c00x * gx[n+3] + b10;
+                gx[n+12] = c0px;
+                gx[n+15] = c00x * gx[n+12] + b00;
+                gx[n+18] = c00x * gx[n+15] + b10 * gx[n+12] + b00 * gx[n+3];
+                gx[n+24] = c0px * gx[n+12] + b01;
+                gx[n+27] = c00x * gx[n+24] + 2 * b00 * gx[n+12];
+                gx[n+30] = c00x * gx[n+27] + b10 * gx[n+24] + 2 * b00 * gx[n+15];
+                gx[n+36] = rx + gx[n+3];
+                gx[n+39] = rx * gx[n+3] + gx[n+6];
+                gx[n+9] = c00x * gx[n+6] + 2 * b10 * gx[n+3];
+                gx[n+42] = rx * gx[n+6] + gx[n+9];
+                gx[n+48] = rx * gx[n+12] + gx[n+15];
+                gx[n+51] = rx * gx[n+15] + gx[n+18];
+                gx[n+21] = c00x * gx[n+18] + 2 * b10 * gx[n+15] + b00 * gx[n+6];
+                gx[n+54] = rx * gx[n+18] + gx[n+21];
+                gx[n+60] = rx * gx[n+24] + gx[n+27];
+                gx[n+63] = rx * gx[n+27] + gx[n+30];
+                gx[n+33] = c00x * gx[n+30] + 2 * b10 * gx[n+27] + 2 * b00 * gx[n+18];
+                gx[n+66] = rx * gx[n+30] + gx[n+33];
+                gy[n+3] = c00y;
+                gy[n+6] = c00y * gy[n+3] + b10;
+                gy[n+12] = c0py;
+                gy[n+15] = c00y * gy[n+12] + b00;
+                gy[n+18] = c00y * gy[n+15] + b10 * gy[n+12] + b00 * gy[n+3];
+                gy[n+24] = c0py * gy[n+12] + b01;
+                gy[n+27] = c00y * gy[n+24] + 2 * b00 * gy[n+12];
+                gy[n+30] = c00y * gy[n+27] + b10 * gy[n+24] + 2 * b00 * gy[n+15];
+                gy[n+36] = ry + gy[n+3];
+                gy[n+39] = ry * gy[n+3] + gy[n+6];
+                gy[n+9] = c00y * gy[n+6] + 2 * b10 * gy[n+3];
+                gy[n+42] = ry * gy[n+6] + gy[n+9];
+                gy[n+48] = ry * gy[n+12] + gy[n+15];
+                gy[n+51] = ry * gy[n+15] + gy[n+18];
+                gy[n+21] = c00y * gy[n+18] + 2 * b10 * gy[n+15] + b00 * gy[n+6];
+                gy[n+54] = ry * gy[n+18] + gy[n+21];
+                gy[n+60] = ry * gy[n+24] + gy[n+27];
+                gy[n+63] = ry * gy[n+27] + gy[n+30];
+                gy[n+33] = c00y * gy[n+30] + 2 * b10 * gy[n+27] + 2 * b00 * gy[n+18];
+                gy[n+66] = ry * gy[n+30] + gy[n+33];
+                gz[n+3] = c00z * gz[n+0];
+                gz[n+6] = c00z * gz[n+3] + b10 * gz[n+0];
+                gz[n+12] = c0pz * gz[n+0];
+                gz[n+15] = c00z * gz[n+12] + b00 * gz[n+0];
+                gz[n+18] = c00z * gz[n+15] + b10 * gz[n+12] + b00 * gz[n+3];
+                gz[n+24] = c0pz * gz[n+12] + b01 * gz[n+0];
+                gz[n+27] = c00z * gz[n+24] + 2 * b00 * gz[n+12];
+                gz[n+30] = c00z * gz[n+27] + b10 * gz[n+24] + 2 * b00 * gz[n+15];
+                gz[n+36] = rz * gz[n+0] + gz[n+3];
+                gz[n+39] = rz * gz[n+3] + gz[n+6];
+                gz[n+9] = c00z * gz[n+6] + 2 * b10 * gz[n+3];
+                gz[n+42] = rz * gz[n+6] + gz[n+9];
+                gz[n+48] = rz * gz[n+12] + gz[n+15];
+                gz[n+51] = rz * gz[n+15] + gz[n+18];
+                gz[n+21] = c00z * gz[n+18] + 2 * b10 * gz[n+15] + b00 * gz[n+6];
+                gz[n+54] = rz * gz[n+18] + gz[n+21];
+                gz[n+60] = rz * gz[n+24] + gz[n+27];
+                gz[n+63] = rz * gz[n+27] + gz[n+30];
+                gz[n+33] = c00z * gz[n+30] + 2 * b10 * gz[n+27] + 2 * b00 * gz[n+18];
+                gz[n+66] = rz * gz[n+30] + gz[n+33];
+        }
+}
+static void _gout_2102(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 72;
+        double *gz = g + 144;
+        GOUT(0, _g2_3(gx+66, gz+0));
+        GOUT(1, _g3_3(gx+63, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+63, gz+3));
+        GOUT(3, _g3_3(gx+60, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+60, gy+3, gz+3));
+        GOUT(5, _g2_3(gx+60, gz+6));
+        GOUT(6, _g3_3(gx+54, gy+12, gz+0));
+        GOUT(7, _g3_3(gx+51, gy+15, gz+0));
+        GOUT(8, _g3_3(gx+51, gy+12, gz+3));
+        GOUT(9, _g3_3(gx+48, gy+18, gz+0));
+        GOUT(10, _g3_3(gx+48, gy+15, gz+3));
+        GOUT(11, _g3_3(gx+48, gy+12, gz+6));
+        GOUT(12, _g2_3(gx+54, gz+12));
+        GOUT(13, _g3_3(gx+51, gy+3, gz+12));
+        GOUT(14, _g2_3(gx+51, gz+15));
+        GOUT(15, _g3_3(gx+48, gy+6, gz+12));
+        GOUT(16, _g3_3(gx+48, gy+3, gz+15));
+        GOUT(17, _g2_3(gx+48, gz+18));
+        GOUT(18, _g3_3(gx+42, gy+24, gz+0));
+        GOUT(19, _g3_3(gx+39, gy+27, gz+0));
+        GOUT(20, _g3_3(gx+39, gy+24, gz+3));
+        GOUT(21, _g3_3(gx+36, gy+30, gz+0));
+        GOUT(22, _g3_3(gx+36, gy+27, gz+3));
+        GOUT(23, _g3_3(gx+36, gy+24, gz+6));
+        GOUT(24, _g3_3(gx+42, gy+12, gz+12));
+        GOUT(25, _g3_3(gx+39, gy+15, gz+12));
+        GOUT(26, _g3_3(gx+39, gy+12, gz+15));
+        GOUT(27, _g3_3(gx+36, gy+18, gz+12));
+        GOUT(28, _g3_3(gx+36, gy+15, gz+15));
+        GOUT(29, _g3_3(gx+36, gy+12, gz+18));
+        GOUT(30, _g2_3(gx+42, gz+24));
+        GOUT(31, _g3_3(gx+39, gy+3, gz+24));
+        GOUT(32, _g2_3(gx+39, gz+27));
+        GOUT(33, _g3_3(gx+36, gy+6, gz+24));
+        GOUT(34, _g3_3(gx+36, gy+3, gz+27));
+        GOUT(35, _g2_3(gx+36, gz+30));
+        GOUT(36, _g3_3(gx+30, gy+36, gz+0));
+        GOUT(37, _g3_3(gx+27, gy+39, gz+0));
+        GOUT(38, _g3_3(gx+27, gy+36, gz+3));
+        GOUT(39, _g3_3(gx+24, gy+42, gz+0));
+        GOUT(40, _g3_3(gx+24, gy+39, gz+3));
+        GOUT(41, _g3_3(gx+24, gy+36, gz+6));
+        GOUT(42, _g3_3(gx+18, gy+48, gz+0));
+        GOUT(43, _g3_3(gx+15, gy+51, gz+0));
+        GOUT(44, _g3_3(gx+15, gy+48, gz+3));
+        GOUT(45, _g3_3(gx+12, gy+54, gz+0));
+        GOUT(46, _g3_3(gx+12, gy+51, gz+3));
+        GOUT(47, _g3_3(gx+12, gy+48, gz+6));
+        GOUT(48, _g3_3(gx+18, gy+36, gz+12));
+        GOUT(49, _g3_3(gx+15, gy+39, gz+12));
+        GOUT(50, _g3_3(gx+15, gy+36, gz+15));
+        GOUT(51, _g3_3(gx+12, gy+42, gz+12));
+        GOUT(52, _g3_3(gx+12, gy+39, gz+15));
+        GOUT(53, _g3_3(gx+12, gy+36, gz+18));
+        GOUT(54, _g3_3(gx+6, gy+60, gz+0));
+        GOUT(55, _g3_3(gx+3, gy+63, gz+0));
+        GOUT(56, _g3_3(gx+3, gy+60, gz+3));
+        GOUT(57, _g2_3(gy+66, gz+0));
+        GOUT(58, _g2_3(gy+63, gz+3));
+        GOUT(59, _g2_3(gy+60, gz+6));
+        GOUT(60, _g3_3(gx+6, gy+48, gz+12));
+        GOUT(61, _g3_3(gx+3, gy+51, gz+12));
+        GOUT(62, _g3_3(gx+3, gy+48, gz+15));
+        GOUT(63, _g2_3(gy+54, gz+12));
+        GOUT(64, _g2_3(gy+51, gz+15));
+        GOUT(65, _g2_3(gy+48, gz+18));
+        GOUT(66, _g3_3(gx+6, gy+36, gz+24));
+        GOUT(67, _g3_3(gx+3, gy+39, gz+24));
+        GOUT(68, _g3_3(gx+3, gy+36, gz+27));
+        GOUT(69, _g2_3(gy+42, gz+24));
+        GOUT(70, _g2_3(gy+39, gz+27));
+        GOUT(71, _g2_3(gy+36, gz+30));
+        GOUT(72, _g2_3(gx+30, gz+36));
+        GOUT(73, _g3_3(gx+27, gy+3, gz+36));
+        GOUT(74, _g2_3(gx+27, gz+39));
+        GOUT(75, _g3_3(gx+24, gy+6, gz+36));
+        GOUT(76, _g3_3(gx+24, gy+3, gz+39));
+        GOUT(77, _g2_3(gx+24, gz+42));
+        GOUT(78, _g3_3(gx+18, gy+12, gz+36));
+        GOUT(79, _g3_3(gx+15, gy+15, gz+36));
+        GOUT(80, _g3_3(gx+15, gy+12, gz+39));
+        GOUT(81, _g3_3(gx+12, gy+18, gz+36));
+        GOUT(82, _g3_3(gx+12, gy+15, gz+39));
+        GOUT(83, _g3_3(gx+12, gy+12, gz+42));
+        GOUT(84, _g2_3(gx+18, gz+48));
+        GOUT(85, _g3_3(gx+15, gy+3, gz+48));
+        GOUT(86, _g2_3(gx+15, gz+51));
+        GOUT(87, _g3_3(gx+12, gy+6, gz+48));
+        GOUT(88, _g3_3(gx+12, gy+3, gz+51));
+        GOUT(89, _g2_3(gx+12, gz+54));
+        GOUT(90, _g3_3(gx+6, gy+24, gz+36));
+        GOUT(91, _g3_3(gx+3, gy+27, gz+36));
+        GOUT(92, _g3_3(gx+3, gy+24, gz+39));
+        GOUT(93, _g2_3(gy+30, gz+36));
+        GOUT(94, _g2_3(gy+27, gz+39));
+        GOUT(95, _g2_3(gy+24, gz+42));
+        GOUT(96, _g3_3(gx+6, gy+12, gz+48));
+        GOUT(97, _g3_3(gx+3, gy+15, gz+48));
+        GOUT(98, _g3_3(gx+3, gy+12, gz+51));
+        GOUT(99, _g2_3(gy+18, gz+48));
+        GOUT(100, _g2_3(gy+15, gz+51));
+        GOUT(101, _g2_3(gy+12, gz+54));
+        GOUT(102, _g2_3(gx+6, gz+60));
+        GOUT(103, _g3_3(gx+3, gy+3, gz+60));
+        GOUT(104, _g2_3(gx+3, gz+63));
+        GOUT(105, _g2_3(gy+6, gz+60));
+        GOUT(106, _g2_3(gy+3, gz+63));
+        GOUT(107, _g1_3(gz+66));
+}
+
+static void _g0_2d4d_2110(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 48;
+        double *gz = g + 96;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+3] = c00x;
+                gx[n+6] = c00x * gx[n+3] + b10;
+                gx[n+12] = c0px;
+                gx[n+15] = c00x * gx[n+12] + b00;
+                gx[n+18] = c00x * gx[n+15] + b10 * gx[n+12] + b00 * gx[n+3];
+                gx[n+24] = rx + gx[n+3];
+                gx[n+27] = rx * gx[n+3] + gx[n+6];
+                gx[n+9] = c00x * gx[n+6] + 2 * b10 * gx[n+3];
+                gx[n+30] = rx * gx[n+6] + gx[n+9];
+                gx[n+36] = rx * gx[n+12] + gx[n+15];
+                gx[n+39] = rx * gx[n+15] + gx[n+18];
+                gx[n+21] = c00x * gx[n+18] + 2 * b10 * gx[n+15] + b00 * gx[n+6];
+                gx[n+42] = rx * gx[n+18] + gx[n+21];
+                gy[n+3] = c00y;
+                gy[n+6] = c00y * gy[n+3] + b10;
+                gy[n+12] = c0py;
+                gy[n+15] = c00y * gy[n+12] + b00;
+                gy[n+18] = c00y * gy[n+15] + b10 * gy[n+12] + b00 * gy[n+3];
+                gy[n+24] = ry + gy[n+3];
+                gy[n+27] = ry * gy[n+3] + gy[n+6];
+                gy[n+9] = c00y * gy[n+6] + 2 * b10 * gy[n+3];
+                gy[n+30] = ry * gy[n+6] + gy[n+9];
+                gy[n+36] = ry * gy[n+12] + gy[n+15];
+                gy[n+39] = ry * gy[n+15] + gy[n+18];
+                gy[n+21] = c00y * gy[n+18] + 2 * b10 * gy[n+15] + b00 * gy[n+6];
+                gy[n+42] = ry * gy[n+18] + gy[n+21];
+                gz[n+3] = c00z * gz[n+0];
+                gz[n+6] = c00z * gz[n+3] + b10 * gz[n+0];
+                gz[n+12] = c0pz * gz[n+0];
+                gz[n+15] = c00z * gz[n+12] + b00 * gz[n+0];
+                gz[n+18] = c00z * gz[n+15] + b10 * gz[n+12] + b00 * gz[n+3];
+                gz[n+24] = rz * gz[n+0] + gz[n+3];
+                gz[n+27] = rz * gz[n+3] + gz[n+6];
+                gz[n+9] = c00z * gz[n+6] + 2 * b10 * gz[n+3];
+                gz[n+30] = rz * gz[n+6] + gz[n+9];
+                gz[n+36] = rz * gz[n+12] + gz[n+15];
+                gz[n+39] = rz * gz[n+15] + gz[n+18];
+                gz[n+21] = c00z * gz[n+18] + 2 * b10 * gz[n+15] + b00 * gz[n+6];
+                gz[n+42] = rz * gz[n+18] + gz[n+21];
+        }
+}
+static void _gout_2110(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 48;
+        double *gz = g + 96;
+        GOUT(0, _g2_3(gx+42, gz+0));
+        GOUT(1, _g3_3(gx+39, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+39, gz+3));
+        GOUT(3, _g3_3(gx+36, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+36, gy+3, gz+3));
+        GOUT(5, _g2_3(gx+36, gz+6));
+        GOUT(6, _g3_3(gx+30, gy+12, gz+0));
+        GOUT(7, _g3_3(gx+27, gy+15, gz+0));
+        GOUT(8, _g3_3(gx+27, gy+12, gz+3));
+        GOUT(9, _g3_3(gx+24, gy+18, gz+0));
+        GOUT(10, _g3_3(gx+24, gy+15, gz+3));
+        GOUT(11, _g3_3(gx+24, gy+12, gz+6));
+        GOUT(12, _g2_3(gx+30, gz+12));
+        GOUT(13, _g3_3(gx+27, gy+3, gz+12));
+        GOUT(14, _g2_3(gx+27, gz+15));
+        GOUT(15, _g3_3(gx+24, gy+6, gz+12));
+        GOUT(16, _g3_3(gx+24, gy+3, gz+15));
+        GOUT(17, _g2_3(gx+24, gz+18));
+        GOUT(18, _g3_3(gx+18, gy+24, gz+0));
+        GOUT(19, _g3_3(gx+15, gy+27, gz+0));
+        GOUT(20, _g3_3(gx+15, gy+24, gz+3));
+        GOUT(21, _g3_3(gx+12, gy+30, gz+0));
+        GOUT(22, _g3_3(gx+12, gy+27, gz+3));
+        GOUT(23, _g3_3(gx+12, gy+24, gz+6));
+        GOUT(24, _g3_3(gx+6, gy+36, gz+0));
+        GOUT(25, _g3_3(gx+3, gy+39, gz+0));
+        GOUT(26, _g3_3(gx+3, gy+36, gz+3));
+        GOUT(27, _g2_3(gy+42, gz+0));
+        GOUT(28, _g2_3(gy+39, gz+3));
+        GOUT(29, _g2_3(gy+36, gz+6));
+        GOUT(30, _g3_3(gx+6, gy+24, gz+12));
+        GOUT(31, _g3_3(gx+3, gy+27, gz+12));
+        GOUT(32, _g3_3(gx+3, gy+24, gz+15));
+        GOUT(33, _g2_3(gy+30, gz+12));
+        GOUT(34, _g2_3(gy+27, gz+15));
+        GOUT(35, _g2_3(gy+24, gz+18));
+        GOUT(36, _g2_3(gx+18, gz+24));
+        GOUT(37, _g3_3(gx+15, gy+3, gz+24));
+        GOUT(38, _g2_3(gx+15, gz+27));
+        GOUT(39, _g3_3(gx+12, gy+6, gz+24));
+        GOUT(40, _g3_3(gx+12, gy+3, gz+27));
+        GOUT(41, _g2_3(gx+12, gz+30));
+        GOUT(42, _g3_3(gx+6, gy+12, gz+24));
+        GOUT(43, _g3_3(gx+3, gy+15, gz+24));
+        GOUT(44, _g3_3(gx+3, gy+12, gz+27));
+        GOUT(45, _g2_3(gy+18, gz+24));
+        GOUT(46, _g2_3(gy+15, gz+27));
+        GOUT(47, _g2_3(gy+12, gz+30));
+        GOUT(48, _g2_3(gx+6, gz+36));
+        GOUT(49, _g3_3(gx+3, gy+3, gz+36));
+        GOUT(50, _g2_3(gx+3, gz+39));
+        GOUT(51, _g2_3(gy+6, gz+36));
+        GOUT(52, _g2_3(gy+3, gz+39));
+        GOUT(53, _g1_3(gz+42));
+}
+
+static void _g0_2d4d_2111(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 144;
+        double *gz = g + 288;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+3] = c00x;
+                gx[n+6] = c00x * gx[n+3] + b10;
+                gx[n+24] = c0px;
+                gx[n+12] = sx + gx[n+24];
+                gx[n+27] = c00x * gx[n+24] + b00;
+                gx[n+15] = sx * gx[n+3] + gx[n+27];
+                gx[n+30] = c00x * gx[n+27] + b10 * gx[n+24] + b00 * gx[n+3];
+                gx[n+18] = sx * gx[n+6] + gx[n+30];
+                gx[n+48] = c0px * gx[n+24] + b01;
+                gx[n+36] = sx * gx[n+24] + gx[n+48];
+                gx[n+51] = c00x * gx[n+48] + 2 * b00 * gx[n+24];
+                gx[n+39] = sx * gx[n+27] + gx[n+51];
+                gx[n+54] = c00x * gx[n+51] + b10 * gx[n+48] + 2 * b00 * gx[n+27];
+                gx[n+42] = sx * gx[n+30] + gx[n+54];
+                gx[n+72] = rx + gx[n+3];
+                gx[n+75] = rx * gx[n+3] + gx[n+6];
+                gx[n+9] = c00x * gx[n+6] + 2 * b10 * gx[n+3];
+                gx[n+78] = rx * gx[n+6] + gx[n+9];
+                gx[n+84] = rx * gx[n+12] + gx[n+15];
+                gx[n+87] = rx * gx[n+15] + gx[n+18];
+                gx[n+33] = c00x * gx[n+30] + 2 * b10 * gx[n+27] + b00 * gx[n+6];
+                gx[n+21] = sx * gx[n+9] + gx[n+33];
+                gx[n+90] = rx * gx[n+18] + gx[n+21];
+                gx[n+96] = rx * gx[n+24] + gx[n+27];
+                gx[n+99] = rx * gx[n+27] + gx[n+30];
+                gx[n+102] = rx * gx[n+30] + gx[n+33];
+                gx[n+108] = rx * gx[n+36] + gx[n+39];
+                gx[n+111] = rx * gx[n+39] + gx[n+42];
+                gx[n+57] = c00x * gx[n+54] + 2 * b10 * gx[n+51] + 2 * b00 * gx[n+30];
+                gx[n+45] = sx * gx[n+33] + gx[n+57];
+                gx[n+114] = rx * gx[n+42] + gx[n+45];
+                gy[n+3] = c00y;
+                gy[n+6] = c00y * gy[n+3] + b10;
+                gy[n+24] = c0py;
+                gy[n+12] = sy + gy[n+24];
+                gy[n+27] = c00y * gy[n+24] + b00;
+                gy[n+15] = sy * gy[n+3] + gy[n+27];
+                gy[n+30] = c00y * gy[n+27] + b10 * gy[n+24] + b00 * gy[n+3];
+                gy[n+18] = sy * gy[n+6] + gy[n+30];
+                gy[n+48] = c0py * gy[n+24] + b01;
+                gy[n+36] = sy * gy[n+24] + gy[n+48];
+                gy[n+51] = c00y * gy[n+48] + 2 * b00 * gy[n+24];
+                gy[n+39] = sy * gy[n+27] + gy[n+51];
+                gy[n+54] = c00y * gy[n+51] + b10 * gy[n+48] + 2 * b00 * gy[n+27];
+                gy[n+42] = sy * gy[n+30] + gy[n+54];
+                gy[n+72] = ry + gy[n+3];
+                gy[n+75] = ry * gy[n+3] + gy[n+6];
+                gy[n+9] = c00y * gy[n+6] + 2 * b10 * gy[n+3];
+                gy[n+78] = ry * gy[n+6] + gy[n+9];
+                gy[n+84] = ry * gy[n+12] + gy[n+15];
+                gy[n+87] = ry * gy[n+15] + gy[n+18];
+                gy[n+33] = c00y * gy[n+30] + 2 * b10 * gy[n+27] + b00 * gy[n+6];
+                gy[n+21] = sy * gy[n+9] + gy[n+33];
+                gy[n+90] = ry * gy[n+18] + gy[n+21];
+                gy[n+96] = ry * gy[n+24] + gy[n+27];
+                gy[n+99] = ry * gy[n+27] + gy[n+30];
+                gy[n+102] = ry * gy[n+30] + gy[n+33];
+                gy[n+108] = ry * gy[n+36] + gy[n+39];
+                gy[n+111] = ry * gy[n+39] + gy[n+42];
+                gy[n+57] = c00y * gy[n+54] + 2 * b10 * gy[n+51] + 2 * b00 * gy[n+30];
+                gy[n+45] = sy * gy[n+33] + gy[n+57];
+                gy[n+114] = ry * gy[n+42] + gy[n+45];
+                gz[n+3] = c00z * gz[n+0];
+                gz[n+6] = c00z * gz[n+3] + b10 * gz[n+0];
+                gz[n+24] = c0pz * gz[n+0];
+                gz[n+12] = sz * gz[n+0] + gz[n+24];
+                gz[n+27] = c00z * gz[n+24] + b00 * gz[n+0];
+                gz[n+15] = sz * gz[n+3] + gz[n+27];
+                gz[n+30] = c00z * gz[n+27] + b10 * gz[n+24] + b00 * gz[n+3];
+                gz[n+18] = sz * gz[n+6] + gz[n+30];
+                gz[n+48] = c0pz * gz[n+24] + b01 * gz[n+0];
+                gz[n+36] = sz * gz[n+24] + gz[n+48];
+                gz[n+51] = c00z * gz[n+48] + 2 * b00 * gz[n+24];
+                gz[n+39] = sz * gz[n+27] + gz[n+51];
+                gz[n+54] = c00z * gz[n+51] + b10 * gz[n+48] + 2 * b00 * gz[n+27];
+                gz[n+42] = sz * gz[n+30] + gz[n+54];
+                gz[n+72] = rz * gz[n+0] + gz[n+3];
+                gz[n+75] = rz * gz[n+3] + gz[n+6];
+                gz[n+9] = c00z * gz[n+6] + 2 * b10 * gz[n+3];
+                gz[n+78] = rz * gz[n+6] + gz[n+9];
+                gz[n+84] = rz * gz[n+12] + gz[n+15];
+                gz[n+87] = rz * gz[n+15] + gz[n+18];
+                gz[n+33] = c00z * gz[n+30] + 2 * b10 * gz[n+27] + b00 * gz[n+6];
+                gz[n+21] = sz * gz[n+9] + gz[n+33];
+                gz[n+90] = rz * gz[n+18] + gz[n+21];
+                gz[n+96] = rz * gz[n+24] + gz[n+27];
+                gz[n+99] = rz * gz[n+27] + gz[n+30];
+                gz[n+102] = rz * gz[n+30] + gz[n+33];
+                gz[n+108] = rz * gz[n+36] + gz[n+39];
+                gz[n+111] = rz * gz[n+39] + gz[n+42];
+                gz[n+57] = c00z * gz[n+54] + 2 * b10 * gz[n+51] + 2 * b00 * gz[n+30];
+                gz[n+45] = sz * gz[n+33] + gz[n+57];
+                gz[n+114] = rz * gz[n+42] + gz[n+45];
+        }
+}
+static void _gout_2111(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 144;
+        double *gz = g + 288;
+        GOUT(0, _g2_3(gx+114, gz+0));
+        GOUT(1, _g3_3(gx+111, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+111, gz+3));
+        GOUT(3, _g3_3(gx+108, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+108, gy+3, gz+3));
+        GOUT(5, _g2_3(gx+108, gz+6));
+        GOUT(6, _g3_3(gx+102, gy+12, gz+0));
+        GOUT(7, _g3_3(gx+99, gy+15, gz+0));
+        GOUT(8, _g3_3(gx+99, gy+12, gz+3));
+        GOUT(9, _g3_3(gx+96, gy+18, gz+0));
+        GOUT(10, _g3_3(gx+96, gy+15, gz+3));
+        GOUT(11, _g3_3(gx+96, gy+12, gz+6));
+        GOUT(12, _g2_3(gx+102, gz+12));
+        GOUT(13, _g3_3(gx+99, gy+3, gz+12));
+        GOUT(14, _g2_3(gx+99, gz+15));
+        GOUT(15, _g3_3(gx+96, gy+6, gz+12));
+        GOUT(16, _g3_3(gx+96, gy+3, gz+15));
+        GOUT(17, _g2_3(gx+96, gz+18));
+        GOUT(18, _g3_3(gx+90, gy+24, gz+0));
+        GOUT(19, _g3_3(gx+87, gy+27, gz+0));
+        GOUT(20, _g3_3(gx+87, gy+24, gz+3));
+        GOUT(21, _g3_3(gx+84, gy+30, gz+0));
+        GOUT(22, _g3_3(gx+84, gy+27, gz+3));
+        GOUT(23, _g3_3(gx+84, gy+24, gz+6));
+        GOUT(24, _g3_3(gx+78, gy+36, gz+0));
+        GOUT(25, _g3_3(gx+75, gy+39, gz+0));
+        GOUT(26, _g3_3(gx+75, gy+36, gz+3));
+        GOUT(27, _g3_3(gx+72, gy+42, gz+0));
+        GOUT(28, _g3_3(gx+72, gy+39, gz+3));
+        GOUT(29, _g3_3(gx+72, gy+36, gz+6));
+        GOUT(30, _g3_3(gx+78, gy+24, gz+12));
+        GOUT(31, _g3_3(gx+75, gy+27, gz+12));
+        GOUT(32, _g3_3(gx+75, gy+24, gz+15));
+        GOUT(33, _g3_3(gx+72, gy+30, gz+12));
+        GOUT(34, _g3_3(gx+72, gy+27, gz+15));
+        GOUT(35, _g3_3(gx+72, gy+24, gz+18));
+        GOUT(36, _g2_3(gx+90, gz+24));
+        GOUT(37, _g3_3(gx+87, gy+3, gz+24));
+        GOUT(38, _g2_3(gx+87, gz+27));
+        GOUT(39, _g3_3(gx+84, gy+6, gz+24));
+        GOUT(40, _g3_3(gx+84, gy+3, gz+27));
+        GOUT(41, _g2_3(gx+84, gz+30));
+        GOUT(42, _g3_3(gx+78, gy+12, gz+24));
+        GOUT(43, _g3_3(gx+75, gy+15, gz+24));
+        GOUT(44, _g3_3(gx+75, gy+12, gz+27));
+        GOUT(45, _g3_3(gx+72, gy+18, gz+24));
+        GOUT(46, _g3_3(gx+72, gy+15, gz+27));
+        GOUT(47, _g3_3(gx+72, gy+12, gz+30));
+        GOUT(48, _g2_3(gx+78, gz+36));
+        GOUT(49, _g3_3(gx+75, gy+3, gz+36));
+        GOUT(50, _g2_3(gx+75, gz+39));
+        GOUT(51, _g3_3(gx+72, gy+6, gz+36));
+        GOUT(52, _g3_3(gx+72, gy+3, gz+39));
+        GOUT(53, _g2_3(gx+72, gz+42));
+        GOUT(54, _g3_3(gx+42, gy+72, gz+0));
+        GOUT(55, _g3_3(gx+39, gy+75, gz+0));
+        GOUT(56, _g3_3(gx+39, gy+72, gz+3));
+        GOUT(57, _g3_3(gx+36, gy+78, gz+0));
+        GOUT(58, _g3_3(gx+36, gy+75, gz+3));
+        GOUT(59, _g3_3(gx+36, gy+72, gz+6));
+        GOUT(60, _g3_3(gx+30, gy+84, gz+0));
+        GOUT(61, _g3_3(gx+27, gy+87, gz+0));
+        GOUT(62, _g3_3(gx+27, gy+84, gz+3));
+        GOUT(63, _g3_3(gx+24, gy+90, gz+0));
+        GOUT(64, _g3_3(gx+24, gy+87, gz+3));
+        GOUT(65, _g3_3(gx+24, gy+84, gz+6));
+        GOUT(66, _g3_3(gx+30, gy+72, gz+12));
+        GOUT(67, _g3_3(gx+27, gy+75, gz+12));
+        GOUT(68, _g3_3(gx+27, gy+72, gz+15));
+        GOUT(69, _g3_3(gx+24, gy+78, gz+12));
+        GOUT(70, _g3_3(gx+24, gy+75, gz+15));
+        GOUT(71, _g3_3(gx+24, gy+72, gz+18));
+        GOUT(72, _g3_3(gx+18, gy+96, gz+0));
+        GOUT(73, _g3_3(gx+15, gy+99, gz+0));
+        GOUT(74, _g3_3(gx+15, gy+96, gz+3));
+        GOUT(75, _g3_3(gx+12, gy+102, gz+0));
+        GOUT(76, _g3_3(gx+12, gy+99, gz+3));
+        GOUT(77, _g3_3(gx+12, gy+96, gz+6));
+        GOUT(78, _g3_3(gx+6, gy+108, gz+0));
+        GOUT(79, _g3_3(gx+3, gy+111, gz+0));
+        GOUT(80, _g3_3(gx+3, gy+108, gz+3));
+        GOUT(81, _g2_3(gy+114, gz+0));
+        GOUT(82, _g2_3(gy+111, gz+3));
+        GOUT(83, _g2_3(gy+108, gz+6));
+        GOUT(84, _g3_3(gx+6, gy+96, gz+12));
+        GOUT(85, _g3_3(gx+3, gy+99, gz+12));
+        GOUT(86, _g3_3(gx+3, gy+96, gz+15));
+        GOUT(87, _g2_3(gy+102, gz+12));
+        GOUT(88, _g2_3(gy+99, gz+15));
+        GOUT(89, _g2_3(gy+96, gz+18));
+        GOUT(90, _g3_3(gx+18, gy+72, gz+24));
+        GOUT(91, _g3_3(gx+15, gy+75, gz+24));
+        GOUT(92, _g3_3(gx+15, gy+72, gz+27));
+        GOUT(93, _g3_3(gx+12, gy+78, gz+24));
+        GOUT(94, _g3_3(gx+12, gy+75, gz+27));
+        GOUT(95, _g3_3(gx+12, gy+72, gz+30));
+        GOUT(96, _g3_3(gx+6, gy+84, gz+24));
+        GOUT(97, _g3_3(gx+3, gy+87, gz+24));
+        GOUT(98, _g3_3(gx+3, gy+84, gz+27));
+        GOUT(99, _g2_3(gy+90, gz+24));
+        GOUT(100, _g2_3(gy+87, gz+27));
+        GOUT(101, _g2_3(gy+84, gz+30));
+        GOUT(102, _g3_3(gx+6, gy+72, gz+36));
+        GOUT(103, _g3_3(gx+3, gy+75, gz+36));
+        GOUT(104, _g3_3(gx+3, gy+72, gz+39));
+        GOUT(105, _g2_3(gy+78, gz+36));
+        GOUT(106, _g2_3(gy+75, gz+39));
+        GOUT(107, _g2_3(gy+72, gz+42));
+        GOUT(108, _g2_3(gx+42, gz+72));
+        GOUT(109, _g3_3(gx+39, gy+3, gz+72));
+        GOUT(110, _g2_3(gx+39, gz+75));
+        GOUT(111, _g3_3(gx+36, gy+6, gz+72));
+        GOUT(112, _g3_3(gx+36, gy+3, gz+75));
+        GOUT(113, _g2_3(gx+36, gz+78));
+        GOUT(114, _g3_3(gx+30, gy+12, gz+72));
+        GOUT(115, _g3_3(gx+27, gy+15, gz+72));
+        GOUT(116, _g3_3(gx+27, gy+12, gz+75));
+        GOUT(117, _g3_3(gx+24, gy+18, gz+72));
+        GOUT(118, _g3_3(gx+24, gy+15, gz+75));
+        GOUT(119, _g3_3(gx+24, gy+12, gz+78));
+        GOUT(120, _g2_3(gx+30, gz+84));
+        GOUT(121, _g3_3(gx+27, gy+3, gz+84));
+        GOUT(122, _g2_3(gx+27, gz+87));
+        GOUT(123, _g3_3(gx+24, gy+6, gz+84));
+        GOUT(124, _g3_3(gx+24, gy+3, gz+87));
+        GOUT(125, _g2_3(gx+24, gz+90));
+        GOUT(126, _g3_3(gx+18, gy+24, gz+72));
+        GOUT(127, _g3_3(gx+15, gy+27, gz+72));
+        GOUT(128, _g3_3(gx+15, gy+24, gz+75));
+        GOUT(129, _g3_3(gx+12, gy+30, gz+72));
+        GOUT(130, _g3_3(gx+12, gy+27, gz+75));
+        GOUT(131, _g3_3(gx+12, gy+24, gz+78));
+        GOUT(132, _g3_3(gx+6, gy+36, gz+72));
+        GOUT(133, _g3_3(gx+3, gy+39, gz+72));
+        GOUT(134, _g3_3(gx+3, gy+36, gz+75));
+        GOUT(135, _g2_3(gy+42, gz+72));
+        GOUT(136, _g2_3(gy+39, gz+75));
+        GOUT(137, _g2_3(gy+36, gz+78));
+        GOUT(138, _g3_3(gx+6, gy+24, gz+84));
+        GOUT(139, _g3_3(gx+3, gy+27, gz+84));
+        GOUT(140, _g3_3(gx+3, gy+24, gz+87));
+        GOUT(141, _g2_3(gy+30, gz+84));
+        GOUT(142, _g2_3(gy+27, gz+87));
+        GOUT(143, _g2_3(gy+24, gz+90));
+        GOUT(144, _g2_3(gx+18, gz+96));
+        GOUT(145, _g3_3(gx+15, gy+3, gz+96));
+        GOUT(146, _g2_3(gx+15, gz+99));
+        GOUT(147, _g3_3(gx+12, gy+6, gz+96));
+        GOUT(148, _g3_3(gx+12, gy+3, gz+99));
+        GOUT(149, _g2_3(gx+12, gz+102));
+        GOUT(150, _g3_3(gx+6, gy+12, gz+96));
+        GOUT(151, _g3_3(gx+3, gy+15, gz+96));
+        GOUT(152, _g3_3(gx+3, gy+12, gz+99));
+        GOUT(153, _g2_3(gy+18, gz+96));
+        GOUT(154, _g2_3(gy+15, gz+99));
+        GOUT(155, _g2_3(gy+12, gz+102));
+        GOUT(156, _g2_3(gx+6, gz+108));
+        GOUT(157, _g3_3(gx+3, gy+3, gz+108));
+        GOUT(158, _g2_3(gx+3, gz+111));
+        GOUT(159, _g2_3(gy+6, gz+108));
+        GOUT(160, _g2_3(gy+3, gz+111));
+        GOUT(161, _g1_3(gz+114));
+}
+
+static void _g0_2d4d_2112(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 256;
+        double *gz = g + 512;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 4; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+4] = c00x;
+                gx[n+8] = c00x * gx[n+4] + b10;
+                gx[n+32] = c0px;
+                gx[n+16] = sx + gx[n+32];
+                gx[n+36] = c00x * gx[n+32] + b00;
+                gx[n+20] = sx * gx[n+4] + gx[n+36];
+                gx[n+40] = c00x * gx[n+36] + b10 * gx[n+32] + b00 * gx[n+4];
+                gx[n+24] = sx * gx[n+8] + gx[n+40];
+                gx[n+64] = c0px * gx[n+32] + b01;
+                gx[n+48] = sx * gx[n+32] + gx[n+64];
+                gx[n+68] = c00x * gx[n+64] + 2 * b00 * gx[n+32];
+                gx[n+52] = sx * gx[n+36] + gx[n+68];
+                gx[n+72] = c00x * gx[n+68] + b10 * gx[n+64] + 2 * b00 * gx[n+36];
+                gx[n+56] = sx * gx[n+40] + gx[n+72];
+                gx[n+96] = c0px * gx[n+64] + 2 * b01 * gx[n+32];
+                gx[n+80] = sx * gx[n+64] + gx[n+96];
+                gx[n+100] = c00x * gx[n+96] + 3 * b00 * gx[n+64];
+                gx[n+84] = sx * gx[n+68] + gx[n+100];
+                gx[n+104] = c00x * gx[n+100] + b10 * gx[n+96] + 3 * b00 * gx[n+68];
+                gx[n+88] = sx * gx[n+72] + gx[n+104];
+                gx[n+128] = rx + gx[n+4];
+                gx[n+132] = rx * gx[n+4] + gx[n+8];
+                gx[n+12] = c00x * gx[n+8] + 2 * b10 * gx[n+4];
+                gx[n+136] = rx * gx[n+8] + gx[n+12];
+                gx[n+144] = rx * gx[n+16] + gx[n+20];
+                gx[n+148] = rx * gx[n+20] + gx[n+24];
+                gx[n+44] = c00x * gx[n+40] + 2 * b10 * gx[n+36] + b00 * gx[n+8];
+                gx[n+28] = sx * gx[n+12] + gx[n+44];
+                gx[n+152] = rx * gx[n+24] + gx[n+28];
+                gx[n+160] = rx * gx[n+32] + gx[n+36];
+                gx[n+164] = rx * gx[n+36] + gx[n+40];
+                gx[n+168] = rx * gx[n+40] + gx[n+44];
+                gx[n+176] = rx * gx[n+48] + gx[n+52];
+                gx[n+180] = rx * gx[n+52] + gx[n+56];
+                gx[n+76] = c00x * gx[n+72] + 2 * b10 * gx[n+68] + 2 * b00 * gx[n+40];
+                gx[n+60] = sx * gx[n+44] + gx[n+76];
+                gx[n+184] = rx * gx[n+56] + gx[n+60];
+                gx[n+192] = rx * gx[n+64] + gx[n+68];
+                gx[n+196] = rx * gx[n+68] + gx[n+72];
+                gx[n+200] = rx * gx[n+72] + gx[n+76];
+                gx[n+208] = rx * gx[n+80] + gx[n+84];
+                gx[n+212] = rx * gx[n+84] + gx[n+88];
+                gx[n+108] = c00x * gx[n+104] + 2 * b10 * gx[n+100] + 3 * b00 * gx[n+72];
+                gx[n+92] = sx * gx[n+76] + gx[n+108];
+                gx[n+216] = rx * gx[n+88] + gx[n+92];
+                gy[n+4] = c00y;
+                gy[n+8] = c00y * gy[n+4] + b10;
+                gy[n+32] = c0py;
+                gy[n+16] = sy + gy[n+32];
+                gy[n+36] = c00y * gy[n+32] + b00;
+                gy[n+20] = sy * gy[n+4] + gy[n+36];
+                gy[n+40] = c00y * gy[n+36] + b10 * gy[n+32] + b00 * gy[n+4];
+                gy[n+24] = sy * gy[n+8] + gy[n+40];
+                gy[n+64] = c0py * gy[n+32] + b01;
+                gy[n+48] = sy * gy[n+32] + gy[n+64];
+                gy[n+68] = c00y * gy[n+64] + 2 * b00 * gy[n+32];
+                gy[n+52] = sy * gy[n+36] + gy[n+68];
+                gy[n+72] = c00y * gy[n+68] + b10 * gy[n+64] + 2 * b00 * gy[n+36];
+                gy[n+56] = sy * gy[n+40] + gy[n+72];
+                gy[n+96] = c0py * gy[n+64] + 2 * b01 * gy[n+32];
+                gy[n+80] = sy * gy[n+64] + gy[n+96];
+                gy[n+100] = c00y * gy[n+96] + 3 * b00 * gy[n+64];
+                gy[n+84] = sy * gy[n+68] + gy[n+100];
+                gy[n+104] = c00y * gy[n+100] + b10 * gy[n+96] + 3 * b00 * gy[n+68];
+                gy[n+88] = sy * gy[n+72] + gy[n+104];
+                gy[n+128] = ry + gy[n+4];
+                gy[n+132] = ry * gy[n+4] + gy[n+8];
+                gy[n+12] = c00y * gy[n+8] + 2 * b10 * gy[n+4];
+                gy[n+136] = ry * gy[n+8] + gy[n+12];
+                gy[n+144] = ry * gy[n+16] + gy[n+20];
+                gy[n+148] = ry * gy[n+20] + gy[n+24];
+                gy[n+44] = c00y * gy[n+40] + 2 * b10 * gy[n+36] + b00 * gy[n+8];
+                gy[n+28] = sy * gy[n+12] + gy[n+44];
+                gy[n+152] = ry * gy[n+24] + gy[n+28];
+                gy[n+160] = ry * gy[n+32] + gy[n+36];
+                gy[n+164] = ry * gy[n+36] + gy[n+40];
+                gy[n+168] = ry * gy[n+40] + gy[n+44];
+                gy[n+176] = ry * gy[n+48] + gy[n+52];
+                gy[n+180] = ry * gy[n+52] + gy[n+56];
+                gy[n+76] = c00y * gy[n+72] + 2 * b10 * gy[n+68] + 2 * b00 * gy[n+40];
+                gy[n+60] = sy * gy[n+44] + gy[n+76];
+                gy[n+184] = ry * gy[n+56] + gy[n+60];
+                gy[n+192] = ry * gy[n+64] + gy[n+68];
+                gy[n+196] = ry * gy[n+68] + gy[n+72];
+                gy[n+200] = ry * gy[n+72] + gy[n+76];
+                gy[n+208] = ry * gy[n+80] + gy[n+84];
+                gy[n+212] = ry * gy[n+84] + gy[n+88];
+                gy[n+108] = c00y * gy[n+104] + 2 * b10 * gy[n+100] + 3 * b00 * gy[n+72];
+                gy[n+92] = sy * gy[n+76] + gy[n+108];
+                gy[n+216] = ry * gy[n+88] + gy[n+92];
+                gz[n+4] = c00z * gz[n+0];
+                gz[n+8] = c00z * gz[n+4] + b10 * gz[n+0];
+                gz[n+32] = c0pz * gz[n+0];
+                gz[n+16] = sz * gz[n+0] + gz[n+32];
+                gz[n+36] = c00z * gz[n+32] + b00 * gz[n+0];
+                gz[n+20] = sz * gz[n+4] + gz[n+36];
+                gz[n+40] = c00z * gz[n+36] + b10 * gz[n+32] + b00 * gz[n+4];
+                gz[n+24] = sz * gz[n+8] + gz[n+40];
+                gz[n+64] = c0pz * gz[n+32] + b01 * gz[n+0];
+                gz[n+48] = sz * gz[n+32] + gz[n+64];
+                gz[n+68] = c00z * gz[n+64] + 2 * b00 * gz[n+32];
+                gz[n+52] = sz * gz[n+36] + gz[n+68];
+                gz[n+72] = c00z * gz[n+68] + b10 * gz[n+64] + 2 * b00 * gz[n+36];
+                gz[n+56] = sz * gz[n+40] + gz[n+72];
+                gz[n+96] = c0pz * gz[n+64] + 2 * b01 * gz[n+32];
+                gz[n+80] = sz * gz[n+64] + gz[n+96];
+                gz[n+100] = c00z * gz[n+96] + 3 * b00 * gz[n+64];
+                gz[n+84] = sz * gz[n+68] + gz[n+100];
+                gz[n+104] = c00z * gz[n+100] + b10 * gz[n+96] + 3 * b00 * gz[n+68];
+                gz[n+88] = sz * gz[n+72] + gz[n+104];
+                gz[n+128] = rz * gz[n+0] + gz[n+4];
+                gz[n+132] = rz * gz[n+4] + gz[n+8];
+                gz[n+12] = c00z * gz[n+8] + 2 * b10 * gz[n+4];
+                gz[n+136] = rz * gz[n+8] + gz[n+12];
+                gz[n+144] = rz * gz[n+16] + gz[n+20];
+                gz[n+148] = rz * gz[n+20] + gz[n+24];
+                gz[n+44] = c00z * gz[n+40] + 2 * b10 * gz[n+36] + b00 * gz[n+8];
+                gz[n+28] = sz * gz[n+12] + gz[n+44];
+                gz[n+152] = rz * gz[n+24] + gz[n+28];
+                gz[n+160] = rz * gz[n+32] + gz[n+36];
+                gz[n+164] = rz * gz[n+36] + gz[n+40];
+                gz[n+168] = rz * gz[n+40] + gz[n+44];
+                gz[n+176] = rz * gz[n+48] + gz[n+52];
+                gz[n+180] = rz * gz[n+52] + gz[n+56];
+                gz[n+76] = c00z * gz[n+72] + 2 * b10 * gz[n+68] + 2 * b00 * gz[n+40];
+                gz[n+60] = sz * gz[n+44] + gz[n+76];
+                gz[n+184] = rz * gz[n+56] + gz[n+60];
+                gz[n+192] = rz * gz[n+64] + gz[n+68];
+                gz[n+196] = rz * gz[n+68] + gz[n+72];
+                gz[n+200] = rz * gz[n+72] + gz[n+76];
+                gz[n+208] = rz * gz[n+80] + gz[n+84];
+                gz[n+212] = rz * gz[n+84] + gz[n+88];
+                gz[n+108] = c00z * gz[n+104] + 2 * b10 * gz[n+100] + 3 * b00 * gz[n+72];
+                gz[n+92] = sz * gz[n+76] + gz[n+108];
+                gz[n+216] = rz * gz[n+88] + gz[n+92];
+        }
+}
+static void _gout_2112(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 256;
+        double *gz = g + 512;
+        GOUT(0, _g2_4(gx+216, gz+0));
+        GOUT(1, _g3_4(gx+212, gy+4, gz+0));
+        GOUT(2, _g2_4(gx+212, gz+4));
+        GOUT(3, _g3_4(gx+208, gy+8, gz+0));
+        GOUT(4, _g3_4(gx+208, gy+4, gz+4));
+        GOUT(5, _g2_4(gx+208, gz+8));
+        GOUT(6, _g3_4(gx+200, gy+16, gz+0));
+        GOUT(7, _g3_4(gx+196, gy+20, gz+0));
+        GOUT(8, _g3_4(gx+196, gy+16, gz+4));
+        GOUT(9, _g3_4(gx+192, gy+24, gz+0));
+        GOUT(10, _g3_4(gx+192, gy+20, gz+4));
+        GOUT(11, _g3_4(gx+192, gy+16, gz+8));
+        GOUT(12, _g2_4(gx+200, gz+16));
+        GOUT(13, _g3_4(gx+196, gy+4, gz+16));
+        GOUT(14, _g2_4(gx+196, gz+20));
+        GOUT(15, _g3_4(gx+192, gy+8, gz+16));
+        GOUT(16, _g3_4(gx+192, gy+4, gz+20));
+        GOUT(17, _g2_4(gx+192, gz+24));
+        GOUT(18, _g3_4(gx+184, gy+32, gz+0));
+        GOUT(19, _g3_4(gx+180, gy+36, gz+0));
+        GOUT(20, _g3_4(gx+180, gy+32, gz+4));
+        GOUT(21, _g3_4(gx+176, gy+40, gz+0));
+        GOUT(22, _g3_4(gx+176, gy+36, gz+4));
+        GOUT(23, _g3_4(gx+176, gy+32, gz+8));
+        GOUT(24, _g3_4(gx+168, gy+48, gz+0));
+        GOUT(25, _g3_4(gx+164, gy+52, gz+0));
+        GOUT(26, _g3_4(gx+164, gy+48, gz+4));
+        GOUT(27, _g3_4(gx+160, gy+56, gz+0));
+        GOUT(28, _g3_4(gx+160, gy+52, gz+4));
+        GOUT(29, _g3_4(gx+160, gy+48, gz+8));
+        GOUT(30, _g3_4(gx+168, gy+32, gz+16));
+        GOUT(31, _g3_4(gx+164, gy+36, gz+16));
+        GOUT(32, _g3_4(gx+164, gy+32, gz+20));
+        GOUT(33, _g3_4(gx+160, gy+40, gz+16));
+        GOUT(34, _g3_4(gx+160, gy+36, gz+20));
+        GOUT(35, _g3_4(gx+160, gy+32, gz+24));
+        GOUT(36, _g2_4(gx+184, gz+32));
+        GOUT(37, _g3_4(gx+180, gy+4, gz+32));
+        GOUT(38, _g2_4(gx+180, gz+36));
+        GOUT(39, _g3_4(gx+176, gy+8, gz+32));
+        GOUT(40, _g3_4(gx+176, gy+4, gz+36));
+        GOUT(41, _g2_4(gx+176, gz+40));
+        GOUT(42, _g3_4(gx+168, gy+16, gz+32));
+        GOUT(43, _g3_4(gx+164, gy+20, gz+32));
+        GOUT(44, _g3_4(gx+164, gy+16, gz+36));
+        GOUT(45, _g3_4(gx+160, gy+24, gz+32));
+        GOUT(46, _g3_4(gx+160, gy+20, gz+36));
+        GOUT(47, _g3_4(gx+160, gy+16, gz+40));
+        GOUT(48, _g2_4(gx+168, gz+48));
+        GOUT(49, _g3_4(gx+164, gy+4, gz+48));
+        GOUT(50, _g2_4(gx+164, gz+52));
+        GOUT(51, _g3_4(gx+160, gy+8, gz+48));
+        GOUT(52, _g3_4(gx+160, gy+4, gz+52));
+        GOUT(53, _g2_4(gx+160, gz+56));
+        GOUT(54, _g3_4(gx+152, gy+64, gz+0));
+        GOUT(55, _g3_4(gx+148, gy+68, gz+0));
+        GOUT(56, _g3_4(gx+148, gy+64, gz+4));
+        GOUT(57, _g3_4(gx+144, gy+72, gz+0));
+        GOUT(58, _g3_4(gx+144, gy+68, gz+4));
+        GOUT(59, _g3_4(gx+144, gy+64, gz+8));
+        GOUT(60, _g3_4(gx+136, gy+80, gz+0));
+        GOUT(61, _g3_4(gx+132, gy+84, gz+0));
+        GOUT(62, _g3_4(gx+132, gy+80, gz+4));
+        GOUT(63, _g3_4(gx+128, gy+88, gz+0));
+        GOUT(64, _g3_4(gx+128, gy+84, gz+4));
+        GOUT(65, _g3_4(gx+128, gy+80, gz+8));
+        GOUT(66, _g3_4(gx+136, gy+64, gz+16));
+        GOUT(67, _g3_4(gx+132, gy+68, gz+16));
+        GOUT(68, _g3_4(gx+132, gy+64, gz+20));
+        GOUT(69, _g3_4(gx+128, gy+72, gz+16));
+        GOUT(70, _g3_4(gx+128, gy+68, gz+20));
+        GOUT(71, _g3_4(gx+128, gy+64, gz+24));
+        GOUT(72, _g3_4(gx+152, gy+32, gz+32));
+        GOUT(73, _g3_4(gx+148, gy+36, gz+32));
+        GOUT(74, _g3_4(gx+148, gy+32, gz+36));
+        GOUT(75, _g3_4(gx+144, gy+40, gz+32));
+        GOUT(76, _g3_4(gx+144, gy+36, gz+36));
+        GOUT(77, _g3_4(gx+144, gy+32, gz+40));
+        GOUT(78, _g3_4(gx+136, gy+48, gz+32));
+        GOUT(79, _g3_4(gx+132, gy+52, gz+32));
+        GOUT(80, _g3_4(gx+132, gy+48, gz+36));
+        GOUT(81, _g3_4(gx+128, gy+56, gz+32));
+        GOUT(82, _g3_4(gx+128, gy+52, gz+36));
+        GOUT(83, _g3_4(gx+128, gy+48, gz+40));
+        GOUT(84, _g3_4(gx+136, gy+32, gz+48));
+        GOUT(85, _g3_4(gx+132, gy+36, gz+48));
+        GOUT(86, _g3_4(gx+132, gy+32, gz+52));
+        GOUT(87, _g3_4(gx+128, gy+40, gz+48));
+        GOUT(88, _g3_4(gx+128, gy+36, gz+52));
+        GOUT(89, _g3_4(gx+128, gy+32, gz+56));
+        GOUT(90, _g2_4(gx+152, gz+64));
+        GOUT(91, _g3_4(gx+148, gy+4, gz+64));
+        GOUT(92, _g2_4(gx+148, gz+68));
+        GOUT(93, _g3_4(gx+144, gy+8, gz+64));
+        GOUT(94, _g3_4(gx+144, gy+4, gz+68));
+        GOUT(95, _g2_4(gx+144, gz+72));
+        GOUT(96, _g3_4(gx+136, gy+16, gz+64));
+        GOUT(97, _g3_4(gx+132, gy+20, gz+64));
+        GOUT(98, _g3_4(gx+132, gy+16, gz+68));
+        GOUT(99, _g3_4(gx+128, gy+24, gz+64));
+        GOUT(100, _g3_4(gx+128, gy+20, gz+68));
+        GOUT(101, _g3_4(gx+128, gy+16, gz+72));
+        GOUT(102, _g2_4(gx+136, gz+80));
+        GOUT(103, _g3_4(gx+132, gy+4, gz+80));
+        GOUT(104, _g2_4(gx+132, gz+84));
+        GOUT(105, _g3_4(gx+128, gy+8, gz+80));
+        GOUT(106, _g3_4(gx+128, gy+4, gz+84));
+        GOUT(107, _g2_4(gx+128, gz+88));
+        GOUT(108, _g3_4(gx+88, gy+128, gz+0));
+        GOUT(109, _g3_4(gx+84, gy+132, gz+0));
+        GOUT(110, _g3_4(gx+84, gy+128, gz+4));
+        GOUT(111, _g3_4(gx+80, gy+136, gz+0));
+        GOUT(112, _g3_4(gx+80, gy+132, gz+4));
+        GOUT(113, _g3_4(gx+80, gy+128, gz+8));
+        GOUT(114, _g3_4(gx+72, gy+144, gz+0));
+        GOUT(115, _g3_4(gx+68, gy+148, gz+0));
+        GOUT(116, _g3_4(gx+68, gy+144, gz+4));
+        GOUT(117, _g3_4(gx+64, gy+152, gz+0));
+        GOUT(118, _g3_4(gx+64, gy+148, gz+4));
+        GOUT(119, _g3_4(gx+64, gy+144, gz+8));
+        GOUT(120, _g3_4(gx+72, gy+128, gz+16));
+        GOUT(121, _g3_4(gx+68, gy+132, gz+16));
+        GOUT(122, _g3_4(gx+68, gy+128, gz+20));
+        GOUT(123, _g3_4(gx+64, gy+136, gz+16));
+        GOUT(124, _g3_4(gx+64, gy+132, gz+20));
+        GOUT(125, _g3_4(gx+64, gy+128, gz+24));
+        GOUT(126, _g3_4(gx+56, gy+160, gz+0));
+        GOUT(127, _g3_4(gx+52, gy+164, gz+0));
+        GOUT(128, _g3_4(gx+52, gy+160, gz+4));
+        GOUT(129, _g3_4(gx+48, gy+168, gz+0));
+        GOUT(130, _g3_4(gx+48, gy+164, gz+4));
+        GOUT(131, _g3_4(gx+48, gy+160, gz+8));
+        GOUT(132, _g3_4(gx+40, gy+176, gz+0));
+        GOUT(133, _g3_4(gx+36, gy+180, gz+0));
+        GOUT(134, _g3_4(gx+36, gy+176, gz+4));
+        GOUT(135, _g3_4(gx+32, gy+184, gz+0));
+        GOUT(136, _g3_4(gx+32, gy+180, gz+4));
+        GOUT(137, _g3_4(gx+32, gy+176, gz+8));
+        GOUT(138, _g3_4(gx+40, gy+160, gz+16));
+        GOUT(139, _g3_4(gx+36, gy+164, gz+16));
+        GOUT(140, _g3_4(gx+36, gy+160, gz+20));
+        GOUT(141, _g3_4(gx+32, gy+168, gz+16));
+        GOUT(142, _g3_4(gx+32, gy+164, gz+20));
+        GOUT(143, _g3_4(gx+32, gy+160, gz+24));
+        GOUT(144, _g3_4(gx+56, gy+128, gz+32));
+        GOUT(145, _g3_4(gx+52, gy+132, gz+32));
+        GOUT(146, _g3_4(gx+52, gy+128, gz+36));
+        GOUT(147, _g3_4(gx+48, gy+136, gz+32));
+        GOUT(148, _g3_4(gx+48, gy+132, gz+36));
+        GOUT(149, _g3_4(gx+48, gy+128, gz+40));
+        GOUT(150, _g3_4(gx+40, gy+144, gz+32));
+        GOUT(151, _g3_4(gx+36, gy+148, gz+32));
+        GOUT(152, _g3_4(gx+36, gy+144, gz+36));
+        GOUT(153, _g3_4(gx+32, gy+152, gz+32));
+        GOUT(154, _g3_4(gx+32, gy+148, gz+36));
+        GOUT(155, _g3_4(gx+32, gy+144, gz+40));
+        GOUT(156, _g3_4(gx+40, gy+128, gz+48));
+        GOUT(157, _g3_4(gx+36, gy+132, gz+48));
+        GOUT(158, _g3_4(gx+36, gy+128, gz+52));
+        GOUT(159, _g3_4(gx+32, gy+136, gz+48));
+        GOUT(160, _g3_4(gx+32, gy+132, gz+52));
+        GOUT(161, _g3_4(gx+32, gy+128, gz+56));
+        GOUT(162, _g3_4(gx+24, gy+192, gz+0));
+        GOUT(163, _g3_4(gx+20, gy+196, gz+0));
+        GOUT(164, _g3_4(gx+20, gy+192, gz+4));
+        GOUT(165, _g3_4(gx+16, gy+200, gz+0));
+        GOUT(166, _g3_4(gx+16, gy+196, gz+4));
+        GOUT(167, _g3_4(gx+16, gy+192, gz+8));
+        GOUT(168, _g3_4(gx+8, gy+208, gz+0));
+        GOUT(169, _g3_4(gx+4, gy+212, gz+0));
+        GOUT(170, _g3_4(gx+4, gy+208, gz+4));
+        GOUT(171, _g2_4(gy+216, gz+0));
+        GOUT(172, _g2_4(gy+212, gz+4));
+        GOUT(173, _g2_4(gy+208, gz+8));
+        GOUT(174, _g3_4(gx+8, gy+192, gz+16));
+        GOUT(175, _g3_4(gx+4, gy+196, gz+16));
+        GOUT(176, _g3_4(gx+4, gy+192, gz+20));
+        GOUT(177, _g2_4(gy+200, gz+16));
+        GOUT(178, _g2_4(gy+196, gz+20));
+        GOUT(179, _g2_4(gy+192, gz+24));
+        GOUT(180, _g3_4(gx+24, gy+160, gz+32));
+        GOUT(181, _g3_4(gx+20, gy+164, gz+32));
+        GOUT(182, _g3_4(gx+20, gy+160, gz+36));
+        GOUT(183, _g3_4(gx+16, gy+168, gz+32));
+        GOUT(184, _g3_4(gx+16, gy+164, gz+36));
+        GOUT(185, _g3_4(gx+16, gy+160, gz+40));
+        GOUT(186, _g3_4(gx+8, gy+176, gz+32));
+        GOUT(187, _g3_4(gx+4, gy+180, gz+32));
+        GOUT(188, _g3_4(gx+4, gy+176, gz+36));
+        GOUT(189, _g2_4(gy+184, gz+32));
+        GOUT(190, _g2_4(gy+180, gz+36));
+        GOUT(191, _g2_4(gy+176, gz+40));
+        GOUT(192, _g3_4(gx+8, gy+160, gz+48));
+        GOUT(193, _g3_4(gx+4, gy+164, gz+48));
+        GOUT(194, _g3_4(gx+4, gy+160, gz+52));
+        GOUT(195, _g2_4(gy+168, gz+48));
+        GOUT(196, _g2_4(gy+164, gz+52));
+        GOUT(197, _g2_4(gy+160, gz+56));
+        GOUT(198, _g3_4(gx+24, gy+128, gz+64));
+        GOUT(199, _g3_4(gx+20, gy+132, gz+64));
+        GOUT(200, _g3_4(gx+20, gy+128, gz+68));
+        GOUT(201, _g3_4(gx+16, gy+136, gz+64));
+        GOUT(202, _g3_4(gx+16, gy+132, gz+68));
+        GOUT(203, _g3_4(gx+16, gy+128, gz+72));
+        GOUT(204, _g3_4(gx+8, gy+144, gz+64));
+        GOUT(205, _g3_4(gx+4, gy+148, gz+64));
+        GOUT(206, _g3_4(gx+4, gy+144, gz+68));
+        GOUT(207, _g2_4(gy+152, gz+64));
+        GOUT(208, _g2_4(gy+148, gz+68));
+        GOUT(209, _g2_4(gy+144, gz+72));
+        GOUT(210, _g3_4(gx+8, gy+128, gz+80));
+        GOUT(211, _g3_4(gx+4, gy+132, gz+80));
+        GOUT(212, _g3_4(gx+4, gy+128, gz+84));
+        GOUT(213, _g2_4(gy+136, gz+80));
+        GOUT(214, _g2_4(gy+132, gz+84));
+        GOUT(215, _g2_4(gy+128, gz+88));
+        GOUT(216, _g2_4(gx+88, gz+128));
+        GOUT(217, _g3_4(gx+84, gy+4, gz+128));
+        GOUT(218, _g2_4(gx+84, gz+132));
+        GOUT(219, _g3_4(gx+80, gy+8, gz+128));
+        GOUT(220, _g3_4(gx+80, gy+4, gz+132));
+        GOUT(221, _g2_4(gx+80, gz+136));
+        GOUT(222, _g3_4(gx+72, gy+16, gz+128));
+        GOUT(223, _g3_4(gx+68, gy+20, gz+128));
+        GOUT(224, _g3_4(gx+68, gy+16, gz+132));
+        GOUT(225, _g3_4(gx+64, gy+24, gz+128));
+        GOUT(226, _g3_4(gx+64, gy+20, gz+132));
+        GOUT(227, _g3_4(gx+64, gy+16, gz+136));
+        GOUT(228, _g2_4(gx+72, gz+144));
+        GOUT(229, _g3_4(gx+68, gy+4, gz+144));
+        GOUT(230, _g2_4(gx+68, gz+148));
+        GOUT(231, _g3_4(gx+64, gy+8, gz+144));
+        GOUT(232, _g3_4(gx+64, gy+4, gz+148));
+        GOUT(233, _g2_4(gx+64, gz+152));
+        GOUT(234, _g3_4(gx+56, gy+32, gz+128));
+        GOUT(235, _g3_4(gx+52, gy+36, gz+128));
+        GOUT(236, _g3_4(gx+52, gy+32, gz+132));
+        GOUT(237, _g3_4(gx+48, gy+40, gz+128));
+        GOUT(238, _g3_4(gx+48, gy+36, gz+132));
+        GOUT(239, _g3_4(gx+48, gy+32, gz+136));
+        GOUT(240, _g3_4(gx+40, gy+48, gz+128));
+        GOUT(241, _g3_4(gx+36, gy+52, gz+128));
+        GOUT(242, _g3_4(gx+36, gy+48, gz+132));
+        GOUT(243, _g3_4(gx+32, gy+56, gz+128));
+        GOUT(244, _g3_4(gx+32, gy+52, gz+132));
+        GOUT(245, _g3_4(gx+32, gy+48, gz+136));
+        GOUT(246, _g3_4(gx+40, gy+32, gz+144));
+        GOUT(247, _g3_4(gx+36, gy+36, gz+144));
+        GOUT(248, _g3_4(gx+36, gy+32, gz+148));
+        GOUT(249, _g3_4(gx+32, gy+40, gz+144));
+        GOUT(250, _g3_4(gx+32, gy+36, gz+148));
+        GOUT(251, _g3_4(gx+32, gy+32, gz+152));
+        GOUT(252, _g2_4(gx+56, gz+160));
+        GOUT(253, _g3_4(gx+52, gy+4, gz+160));
+        GOUT(254, _g2_4(gx+52, gz+164));
+        GOUT(255, _g3_4(gx+48, gy+8, gz+160));
+        GOUT(256, _g3_4(gx+48, gy+4, gz+164));
+        GOUT(257, _g2_4(gx+48, gz+168));
+        GOUT(258, _g3_4(gx+40, gy+16, gz+160));
+        GOUT(259, _g3_4(gx+36, gy+20, gz+160));
+        GOUT(260, _g3_4(gx+36, gy+16, gz+164));
+        GOUT(261, _g3_4(gx+32, gy+24, gz+160));
+        GOUT(262, _g3_4(gx+32, gy+20, gz+164));
+        GOUT(263, _g3_4(gx+32, gy+16, gz+168));
+        GOUT(264, _g2_4(gx+40, gz+176));
+        GOUT(265, _g3_4(gx+36, gy+4, gz+176));
+        GOUT(266, _g2_4(gx+36, gz+180));
+        GOUT(267, _g3_4(gx+32, gy+8, gz+176));
+        GOUT(268, _g3_4(gx+32, gy+4, gz+180));
+        GOUT(269, _g2_4(gx+32, gz+184));
+        GOUT(270, _g3_4(gx+24, gy+64, gz+128));
+        GOUT(271, _g3_4(gx+20, gy+68, gz+128));
+        GOUT(272, _g3_4(gx+20, gy+64, gz+132));
+        GOUT(273, _g3_4(gx+16, gy+72, gz+128));
+        GOUT(274, _g3_4(gx+16, gy+68, gz+132));
+        GOUT(275, _g3_4(gx+16, gy+64, gz+136));
+        GOUT(276, _g3_4(gx+8, gy+80, gz+128));
+        GOUT(277, _g3_4(gx+4, gy+84, gz+128));
+        GOUT(278, _g3_4(gx+4, gy+80, gz+132));
+        GOUT(279, _g2_4(gy+88, gz+128));
+        GOUT(280, _g2_4(gy+84, gz+132));
+        GOUT(281, _g2_4(gy+80, gz+136));
+        GOUT(282, _g3_4(gx+8, gy+64, gz+144));
+        GOUT(283, _g3_4(gx+4, gy+68, gz+144));
+        GOUT(284, _g3_4(gx+4, gy+64, gz+148));
+        GOUT(285, _g2_4(gy+72, gz+144));
+        GOUT(286, _g2_4(gy+68, gz+148));
+        GOUT(287, _g2_4(gy+64, gz+152));
+        GOUT(288, _g3_4(gx+24, gy+32, gz+160));
+        GOUT(289, _g3_4(gx+20, gy+36, gz+160));
+        GOUT(290, _g3_4(gx+20, gy+32, gz+164));
+        GOUT(291, _g3_4(gx+16, gy+40, gz+160));
+        GOUT(292, _g3_4(gx+16, gy+36, gz+164));
+        GOUT(293, _g3_4(gx+16, gy+32, gz+168));
+        GOUT(294, _g3_4(gx+8, gy+48, gz+160));
+        GOUT(295, _g3_4(gx+4, gy+52, gz+160));
+        GOUT(296, _g3_4(gx+4, gy+48, gz+164));
+        GOUT(297, _g2_4(gy+56, gz+160));
+        GOUT(298, _g2_4(gy+52, gz+164));
+        GOUT(299, _g2_4(gy+48, gz+168));
+        GOUT(300, _g3_4(gx+8, gy+32, gz+176));
+        GOUT(301, _g3_4(gx+4, gy+36, gz+176));
+        GOUT(302, _g3_4(gx+4, gy+32, gz+180));
+        GOUT(303, _g2_4(gy+40, gz+176));
+        GOUT(304, _g2_4(gy+36, gz+180));
+        GOUT(305, _g2_4(gy+32, gz+184));
+        GOUT(306, _g2_4(gx+24, gz+192));
+        GOUT(307, _g3_4(gx+20, gy+4, gz+192));
+        GOUT(308, _g2_4(gx+20, gz+196));
+        GOUT(309, _g3_4(gx+16, gy+8, gz+192));
+        GOUT(310, _g3_4(gx+16, gy+4, gz+196));
+        GOUT(311, _g2_4(gx+16, gz+200));
+        GOUT(312, _g3_4(gx+8, gy+16, gz+192));
+        GOUT(313, _g3_4(gx+4, gy+20, gz+192));
+        GOUT(314, _g3_4(gx+4, gy+16, gz+196));
+        GOUT(315, _g2_4(gy+24, gz+192));
+        GOUT(316, _g2_4(gy+20, gz+196));
+        GOUT(317, _g2_4(gy+16, gz+200));
+        GOUT(318, _g2_4(gx+8, gz+208));
+        GOUT(319, _g3_4(gx+4, gy+4, gz+208));
+        GOUT(320, _g2_4(gx+4, gz+212));
+        GOUT(321, _g2_4(gy+8, gz+208));
+        GOUT(322, _g2_4(gy+4, gz+212));
+        GOUT(323, _g1_4(gz+216));
+}
+
+static void _g0_2d4d_2120(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 72;
+        double *gz = g + 144;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+3] = c00x;
+                gx[n+6] = c00x * gx[n+3] + b10;
+                gx[n+12] = c0px;
+                gx[n+15] = c00x * gx[n+12] + b00;
+                gx[n+18] = c00x * gx[n+15] + b10 * gx[n+12] + b00 * gx[n+3];
+                gx[n+24] = c0px * gx[n+12] + b01;
+                gx[n+27] = c00x * gx[n+24] + 2 * b00 * gx[n+12];
+                gx[n+30] = c00x * gx[n+27] + b10 * gx[n+24] + 2 * b00 * gx[n+15];
+                gx[n+36] = rx + gx[n+3];
+                gx[n+39] = rx * gx[n+3] + gx[n+6];
+                gx[n+9] = c00x * gx[n+6] + 2 * b10 * gx[n+3];
+                gx[n+42] = rx * gx[n+6] + gx[n+9];
+                gx[n+48] = rx * gx[n+12] + gx[n+15];
+                gx[n+51] = rx * gx[n+15] + gx[n+18];
+                gx[n+21] = c00x * gx[n+18] + 2 * b10 * gx[n+15] + b00 * gx[n+6];
+                gx[n+54] = rx * gx[n+18] + gx[n+21];
+                gx[n+60] = rx * gx[n+24] + gx[n+27];
+                gx[n+63] = rx * gx[n+27] + gx[n+30];
+                gx[n+33] = c00x * gx[n+30] + 2 * b10 * gx[n+27] + 2 * b00 * gx[n+18];
+                gx[n+66] = rx * gx[n+30] + gx[n+33];
+                gy[n+3] = c00y;
+                gy[n+6] = c00y * gy[n+3] + b10;
+                gy[n+12] = c0py;
+                gy[n+15] = c00y * gy[n+12] + b00;
+                gy[n+18] = c00y * gy[n+15] + b10 * gy[n+12] + b00 * gy[n+3];
+                gy[n+24] = c0py * gy[n+12] + b01;
+                gy[n+27] = c00y * gy[n+24] + 2 * b00 * gy[n+12];
+                gy[n+30] = c00y * gy[n+27] + b10 * gy[n+24] + 2 * b00 * gy[n+15];
+                gy[n+36] = ry + gy[n+3];
+                gy[n+39] = ry * gy[n+3] + gy[n+6];
+                gy[n+9] = c00y * gy[n+6] + 2 * b10 * gy[n+3];
+                gy[n+42] = ry * gy[n+6] + gy[n+9];
+                gy[n+48] = ry * gy[n+12] + gy[n+15];
+                gy[n+51] = ry * gy[n+15] + gy[n+18];
+                gy[n+21] = c00y * gy[n+18] + 2 * b10 * gy[n+15] + b00 * gy[n+6];
+                gy[n+54] = ry * gy[n+18] + gy[n+21];
+                gy[n+60] = ry * gy[n+24] + gy[n+27];
+                gy[n+63] = ry * gy[n+27] + gy[n+30];
+                gy[n+33] = c00y * gy[n+30] + 2 * b10 * gy[n+27] + 2 * b00 * gy[n+18];
+                gy[n+66] = ry * gy[n+30] + gy[n+33];
+                gz[n+3] = c00z * gz[n+0];
+                gz[n+6] = c00z * gz[n+3] + b10 * gz[n+0];
+                gz[n+12] = c0pz * gz[n+0];
+                gz[n+15] = c00z * gz[n+12] + b00 * gz[n+0];
+                gz[n+18] = c00z * gz[n+15] + b10 * gz[n+12] + b00 * gz[n+3];
+                gz[n+24] = c0pz * gz[n+12] + b01 * gz[n+0];
+                gz[n+27] = c00z * gz[n+24] + 2 * b00 * gz[n+12];
+                gz[n+30] = c00z * gz[n+27] + b10 * gz[n+24] + 2 * b00 * gz[n+15];
+                gz[n+36] = rz * gz[n+0] + gz[n+3];
+                gz[n+39] = rz * gz[n+3] + gz[n+6];
+                gz[n+9] = c00z * gz[n+6] + 2 * b10 * gz[n+3];
+                gz[n+42] = rz * gz[n+6] + gz[n+9];
+                gz[n+48] = rz * gz[n+12] + gz[n+15];
+                gz[n+51] = rz * gz[n+15] + gz[n+18];
+                gz[n+21] = c00z * gz[n+18] + 2 * b10 * gz[n+15] + b00 * gz[n+6];
+                gz[n+54] = rz * gz[n+18] + gz[n+21];
+                gz[n+60] = rz * gz[n+24] + gz[n+27];
+                gz[n+63] = rz * gz[n+27] + gz[n+30];
+                gz[n+33] = c00z * gz[n+30] + 2 * b10 * gz[n+27] + 2 * b00 * gz[n+18];
+                gz[n+66] = rz * gz[n+30] + gz[n+33];
+        }
+}
+static void _gout_2120(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 72;
+        double *gz = g + 144;
+        GOUT(0, _g2_3(gx+66, gz+0));
+        GOUT(1, _g3_3(gx+63, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+63, gz+3));
+        GOUT(3, _g3_3(gx+60, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+60, gy+3, gz+3));
+        GOUT(5, _g2_3(gx+60, gz+6));
+        GOUT(6, _g3_3(gx+54, gy+12, gz+0));
+        GOUT(7, _g3_3(gx+51, gy+15, gz+0));
+        GOUT(8, _g3_3(gx+51, gy+12, gz+3));
+        GOUT(9, _g3_3(gx+48, gy+18, gz+0));
+        GOUT(10, _g3_3(gx+48, gy+15, gz+3));
+        GOUT(11, _g3_3(gx+48, gy+12, gz+6));
+        GOUT(12, _g2_3(gx+54, gz+12));
+        GOUT(13, _g3_3(gx+51, gy+3, gz+12));
+        GOUT(14, _g2_3(gx+51, gz+15));
+        GOUT(15, _g3_3(gx+48, gy+6, gz+12));
+        GOUT(16, _g3_3(gx+48, gy+3, gz+15));
+        GOUT(17, _g2_3(gx+48, gz+18));
+        GOUT(18, _g3_3(gx+42, gy+24, gz+0));
+        GOUT(19, _g3_3(gx+39, gy+27, gz+0));
+        GOUT(20, _g3_3(gx+39, gy+24, gz+3));
+        GOUT(21, _g3_3(gx+36, gy+30, gz+0));
+        GOUT(22, _g3_3(gx+36, gy+27, gz+3));
+        GOUT(23, _g3_3(gx+36, gy+24, gz+6));
+        GOUT(24, _g3_3(gx+42, gy+12, gz+12));
+        GOUT(25, _g3_3(gx+39, gy+15, gz+12));
+        GOUT(26, _g3_3(gx+39, gy+12, gz+15));
+        GOUT(27, _g3_3(gx+36, gy+18, gz+12));
+        GOUT(28, _g3_3(gx+36, gy+15, gz+15));
+        GOUT(29, _g3_3(gx+36, gy+12, gz+18));
+        GOUT(30, _g2_3(gx+42, gz+24));
+        GOUT(31, _g3_3(gx+39, gy+3, gz+24));
+        GOUT(32, _g2_3(gx+39, gz+27));
+        GOUT(33, _g3_3(gx+36, gy+6, gz+24));
+        GOUT(34, _g3_3(gx+36, gy+3, gz+27));
+        GOUT(35, _g2_3(gx+36, gz+30));
+        GOUT(36, _g3_3(gx+30, gy+36, gz+0));
+        GOUT(37, _g3_3(gx+27, gy+39, gz+0));
+        GOUT(38, _g3_3(gx+27, gy+36, gz+3));
+        GOUT(39, _g3_3(gx+24, gy+42, gz+0));
+        GOUT(40, _g3_3(gx+24, gy+39, gz+3));
+        GOUT(41, _g3_3(gx+24, gy+36, gz+6));
+        GOUT(42, _g3_3(gx+18, gy+48, gz+0));
+        GOUT(43, _g3_3(gx+15, gy+51, gz+0));
+        GOUT(44, _g3_3(gx+15, gy+48, gz+3));
+        GOUT(45, _g3_3(gx+12, gy+54, gz+0));
+        GOUT(46, _g3_3(gx+12, gy+51, gz+3));
+        GOUT(47, _g3_3(gx+12, gy+48, gz+6));
+        GOUT(48, _g3_3(gx+18, gy+36, gz+12));
+        GOUT(49, _g3_3(gx+15, gy+39, gz+12));
+        GOUT(50, _g3_3(gx+15, gy+36, gz+15));
+        GOUT(51, _g3_3(gx+12, gy+42, gz+12));
+        GOUT(52, _g3_3(gx+12, gy+39, gz+15));
+        GOUT(53, _g3_3(gx+12, gy+36, gz+18));
+        GOUT(54, _g3_3(gx+6, gy+60, gz+0));
+        GOUT(55, _g3_3(gx+3, gy+63, gz+0));
+        GOUT(56, _g3_3(gx+3, gy+60, gz+3));
+        GOUT(57, _g2_3(gy+66, gz+0));
+        GOUT(58, _g2_3(gy+63, gz+3));
+        GOUT(59, _g2_3(gy+60, gz+6));
+        GOUT(60, _g3_3(gx+6, gy+48, gz+12));
+        GOUT(61, _g3_3(gx+3, gy+51, gz+12));
+        GOUT(62, _g3_3(gx+3, gy+48, gz+15));
+        GOUT(63, _g2_3(gy+54, gz+12));
+        GOUT(64, _g2_3(gy+51, gz+15));
+        GOUT(65, _g2_3(gy+48, gz+18));
+        GOUT(66, _g3_3(gx+6, gy+36, gz+24));
+        GOUT(67, _g3_3(gx+3, gy+39, gz+24));
+        GOUT(68, _g3_3(gx+3, gy+36, gz+27));
+        GOUT(69, _g2_3(gy+42, gz+24));
+        GOUT(70, _g2_3(gy+39, gz+27));
+        GOUT(71, _g2_3(gy+36, gz+30));
+        GOUT(72, _g2_3(gx+30, gz+36));
+        GOUT(73, _g3_3(gx+27, gy+3, gz+36));
+        GOUT(74, _g2_3(gx+27, gz+39));
+        GOUT(75, _g3_3(gx+24, gy+6, gz+36));
+        GOUT(76, _g3_3(gx+24, gy+3, gz+39));
+        GOUT(77, _g2_3(gx+24, gz+42));
+        GOUT(78, _g3_3(gx+18, gy+12, gz+36));
+        GOUT(79, _g3_3(gx+15, gy+15, gz+36));
+        GOUT(80, _g3_3(gx+15, gy+12, gz+39));
+        GOUT(81, _g3_3(gx+12, gy+18, gz+36));
+        GOUT(82, _g3_3(gx+12, gy+15, gz+39));
+        GOUT(83, _g3_3(gx+12, gy+12, gz+42));
+        GOUT(84, _g2_3(gx+18, gz+48));
+        GOUT(85, _g3_3(gx+15, gy+3, gz+48));
+        GOUT(86, _g2_3(gx+15, gz+51));
+        GOUT(87, _g3_3(gx+12, gy+6, gz+48));
+        GOUT(88, _g3_3(gx+12, gy+3, gz+51));
+        GOUT(89, _g2_3(gx+12, gz+54));
+        GOUT(90, _g3_3(gx+6, gy+24, gz+36));
+        GOUT(91, _g3_3(gx+3, gy+27, gz+36));
+        GOUT(92, _g3_3(gx+3, gy+24, gz+39));
+        GOUT(93, _g2_3(gy+30, gz+36));
+        GOUT(94, _g2_3(gy+27, gz+39));
+        GOUT(95, _g2_3(gy+24, gz+42));
+        GOUT(96, _g3_3(gx+6, gy+12, gz+48));
+        GOUT(97, _g3_3(gx+3, gy+15, gz+48));
+        GOUT(98, _g3_3(gx+3, gy+12, gz+51));
+        GOUT(99, _g2_3(gy+18, gz+48));
+        GOUT(100, _g2_3(gy+15, gz+51));
+        GOUT(101, _g2_3(gy+12, gz+54));
+        GOUT(102, _g2_3(gx+6, gz+60));
+        GOUT(103, _g3_3(gx+3, gy+3, gz+60));
+        GOUT(104, _g2_3(gx+3, gz+63));
+        GOUT(105, _g2_3(gy+6, gz+60));
+        GOUT(106, _g2_3(gy+3, gz+63));
+        GOUT(107, _g1_3(gz+66));
+}
+
+static void _g0_2d4d_2121(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 256;
+        double *gz = g + 512;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 4; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+4] = c00x;
+                gx[n+8] = c00x * gx[n+4] + b10;
+                gx[n+16] = c0px;
+                gx[n+20] = c00x * gx[n+16] + b00;
+                gx[n+24] = c00x * gx[n+20] + b10 * gx[n+16] + b00 * gx[n+4];
+                gx[n+32] = c0px * gx[n+16] + b01;
+                gx[n+36] = c00x * gx[n+32] + 2 * b00 * gx[n+16];
+                gx[n+40] = c00x * gx[n+36] + b10 * gx[n+32] + 2 * b00 * gx[n+20];
+                gx[n+64] = sx + gx[n+16];
+                gx[n+68] = sx * gx[n+4] + gx[n+20];
+                gx[n+72] = sx * gx[n+8] + gx[n+24];
+                gx[n+80] = sx * gx[n+16] + gx[n+32];
+                gx[n+84] = sx * gx[n+20] + gx[n+36];
+                gx[n+88] = sx * gx[n+24] + gx[n+40];
+                gx[n+48] = c0px * gx[n+32] + 2 * b01 * gx[n+16];
+                gx[n+96] = sx * gx[n+32] + gx[n+48];
+                gx[n+52] = c00x * gx[n+48] + 3 * b00 * gx[n+32];
+                gx[n+100] = sx * gx[n+36] + gx[n+52];
+                gx[n+56] = c00x * gx[n+52] + b10 * gx[n+48] + 3 * b00 * gx[n+36];
+                gx[n+104] = sx * gx[n+40] + gx[n+56];
+                gx[n+128] = rx + gx[n+4];
+                gx[n+132] = rx * gx[n+4] + gx[n+8];
+                gx[n+12] = c00x * gx[n+8] + 2 * b10 * gx[n+4];
+                gx[n+136] = rx * gx[n+8] + gx[n+12];
+                gx[n+144] = rx * gx[n+16] + gx[n+20];
+                gx[n+148] = rx * gx[n+20] + gx[n+24];
+                gx[n+28] = c00x * gx[n+24] + 2 * b10 * gx[n+20] + b00 * gx[n+8];
+                gx[n+152] = rx * gx[n+24] + gx[n+28];
+                gx[n+160] = rx * gx[n+32] + gx[n+36];
+                gx[n+164] = rx * gx[n+36] + gx[n+40];
+                gx[n+44] = c00x * gx[n+40] + 2 * b10 * gx[n+36] + 2 * b00 * gx[n+24];
+                gx[n+168] = rx * gx[n+40] + gx[n+44];
+                gx[n+192] = rx * gx[n+64] + gx[n+68];
+                gx[n+196] = rx * gx[n+68] + gx[n+72];
+                gx[n+76] = sx * gx[n+12] + gx[n+28];
+                gx[n+200] = rx * gx[n+72] + gx[n+76];
+                gx[n+208] = rx * gx[n+80] + gx[n+84];
+                gx[n+212] = rx * gx[n+84] + gx[n+88];
+                gx[n+92] = sx * gx[n+28] + gx[n+44];
+                gx[n+216] = rx * gx[n+88] + gx[n+92];
+                gx[n+224] = rx * gx[n+96] + gx[n+100];
+                gx[n+228] = rx * gx[n+100] + gx[n+104];
+                gx[n+60] = c00x * gx[n+56] + 2 * b10 * gx[n+52] + 3 * b00 * gx[n+40];
+                gx[n+108] = sx * gx[n+44] + gx[n+60];
+                gx[n+232] = rx * gx[n+104] + gx[n+108];
+                gy[n+4] = c00y;
+                gy[n+8] = c00y * gy[n+4] + b10;
+                gy[n+16] = c0py;
+                gy[n+20] = c00y * gy[n+16] + b00;
+                gy[n+24] = c00y * gy[n+20] + b10 * gy[n+16] + b00 * gy[n+4];
+                gy[n+32] = c0py * gy[n+16] + b01;
+                gy[n+36] = c00y * gy[n+32] + 2 * b00 * gy[n+16];
+                gy[n+40] = c00y * gy[n+36] + b10 * gy[n+32] + 2 * b00 * gy[n+20];
+                gy[n+64] = sy + gy[n+16];
+                gy[n+68] = sy * gy[n+4] + gy[n+20];
+                gy[n+72] = sy * gy[n+8] + gy[n+24];
+                gy[n+80] = sy * gy[n+16] + gy[n+32];
+                gy[n+84] = sy * gy[n+20] + gy[n+36];
+                gy[n+88] = sy * gy[n+24] + gy[n+40];
+                gy[n+48] = c0py * gy[n+32] + 2 * b01 * gy[n+16];
+                gy[n+96] = sy * gy[n+32] + gy[n+48];
+                gy[n+52] = c00y * gy[n+48] + 3 * b00 * gy[n+32];
+                gy[n+100] = sy * gy[n+36] + gy[n+52];
+                gy[n+56] = c00y * gy[n+52] + b10 * gy[n+48] + 3 * b00 * gy[n+36];
+                gy[n+104] = sy * gy[n+40] + gy[n+56];
+                gy[n+128] = ry + gy[n+4];
+                gy[n+132] = ry * gy[n+4] + gy[n+8];
+                gy[n+12] = c00y * gy[n+8] + 2 * b10 * gy[n+4];
+                gy[n+136] = ry * gy[n+8] + gy[n+12];
+                gy[n+144] = ry * gy[n+16] + gy[n+20];
+                gy[n+148] = ry * gy[n+20] + gy[n+24];
+                gy[n+28] = c00y * gy[n+24] + 2 * b10 * gy[n+20] + b00 * gy[n+8];
+                gy[n+152] = ry * gy[n+24] + gy[n+28];
+                gy[n+160] = ry * gy[n+32] + gy[n+36];
+                gy[n+164] = ry * gy[n+36] + gy[n+40];
+                gy[n+44] = c00y * gy[n+40] + 2 * b10 * gy[n+36] + 2 * b00 * gy[n+24];
+                gy[n+168] = ry * gy[n+40] + gy[n+44];
+                gy[n+192] = ry * gy[n+64] + gy[n+68];
+                gy[n+196] = ry * gy[n+68] + gy[n+72];
+                gy[n+76] = sy * gy[n+12] + gy[n+28];
+                gy[n+200] = ry * gy[n+72] + gy[n+76];
+                gy[n+208] = ry * gy[n+80] + gy[n+84];
+                gy[n+212] = ry * gy[n+84] + gy[n+88];
+                gy[n+92] = sy * gy[n+28] + gy[n+44];
+                gy[n+216] = ry * gy[n+88] + gy[n+92];
+                gy[n+224] = ry * gy[n+96] + gy[n+100];
+                gy[n+228] = ry * gy[n+100] + gy[n+104];
+                gy[n+60] = c00y * gy[n+56] + 2 * b10 * gy[n+52] + 3 * b00 * gy[n+40];
+                gy[n+108] = sy * gy[n+44] + gy[n+60];
+                gy[n+232] = ry * gy[n+104] + gy[n+108];
+                gz[n+4] = c00z * gz[n+0];
+                gz[n+8] = c00z * gz[n+4] + b10 * gz[n+0];
+                gz[n+16] = c0pz * gz[n+0];
+                gz[n+20] = c00z * gz[n+16] + b00 * gz[n+0];
+                gz[n+24] = c00z * gz[n+20] + b10 * gz[n+16] + b00 * gz[n+4];
+                gz[n+32] = c0pz * gz[n+16] + b01 * gz[n+0];
+                gz[n+36] = c00z * gz[n+32] + 2 * b00 * gz[n+16];
+                gz[n+40] = c00z * gz[n+36] + b10 * gz[n+32] + 2 * b00 * gz[n+20];
+                gz[n+64] = sz * gz[n+0] + gz[n+16];
+                gz[n+68] = sz * gz[n+4] + gz[n+20];
+                gz[n+72] = sz * gz[n+8] + gz[n+24];
+                gz[n+80] = sz * gz[n+16] + gz[n+32];
+                gz[n+84] = sz * gz[n+20] + gz[n+36];
+                gz[n+88] = sz * gz[n+24] + gz[n+40];
+                gz[n+48] = c0pz * gz[n+32] + 2 * b01 * gz[n+16];
+                gz[n+96] = sz * gz[n+32] + gz[n+48];
+                gz[n+52] = c00z * gz[n+48] + 3 * b00 * gz[n+32];
+                gz[n+100] = sz * gz[n+36] + gz[n+52];
+                gz[n+56] = c00z * gz[n+52] + b10 * gz[n+48] + 3 * b00 * gz[n+36];
+                gz[n+104] = sz * gz[n+40] + gz[n+56];
+                gz[n+128] = rz * gz[n+0] + gz[n+4];
+                gz[n+132] = rz * gz[n+4] + gz[n+8];
+                gz[n+12] = c00z * gz[n+8] + 2 * b10 * gz[n+4];
+                gz[n+136] = rz * gz[n+8] + gz[n+12];
+                gz[n+144] = rz * gz[n+16] + gz[n+20];
+                gz[n+148] = rz * gz[n+20] + gz[n+24];
+                gz[n+28] = c00z * gz[n+24] + 2 * b10 * gz[n+20] + b00 * gz[n+8];
+                gz[n+152] = rz * gz[n+24] + gz[n+28];
+                gz[n+160] = rz * gz[n+32] + gz[n+36];
+                gz[n+164] = rz * gz[n+36] + gz[n+40];
+                gz[n+44] = c00z * gz[n+40] + 2 * b10 * gz[n+36] + 2 * b00 * gz[n+24];
+                gz[n+168] = rz * gz[n+40] + gz[n+44];
+                gz[n+192] = rz * gz[n+64] + gz[n+68];
+                gz[n+196] = rz * gz[n+68] + gz[n+72];
+                gz[n+76] = sz * gz[n+12] + gz[n+28];
+                gz[n+200] = rz * gz[n+72] + gz[n+76];
+                gz[n+208] = rz * gz[n+80] + gz[n+84];
+                gz[n+212] = rz * gz[n+84] + gz[n+88];
+                gz[n+92] = sz * gz[n+28] + gz[n+44];
+                gz[n+216] = rz * gz[n+88] + gz[n+92];
+                gz[n+224] = rz * gz[n+96] + gz[n+100];
+                gz[n+228] = rz * gz[n+100] + gz[n+104];
+                gz[n+60] = c00z * gz[n+56] + 2 * b10 * gz[n+52] + 3 * b00 * gz[n+40];
+                gz[n+108] = sz * gz[n+44] + gz[n+60];
+                gz[n+232] = rz * gz[n+104] + gz[n+108];
+        }
+}
+static void _gout_2121(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 256;
+        double *gz = g + 512;
+        GOUT(0, _g2_4(gx+232, gz+0));
+        GOUT(1, _g3_4(gx+228, gy+4, gz+0));
+        GOUT(2, _g2_4(gx+228, gz+4));
+        GOUT(3, _g3_4(gx+224, gy+8, gz+0));
+        GOUT(4, _g3_4(gx+224, gy+4, gz+4));
+        GOUT(5, _g2_4(gx+224, gz+8));
+        GOUT(6, _g3_4(gx+216, gy+16, gz+0));
+        GOUT(7, _g3_4(gx+212, gy+20, gz+0));
+        GOUT(8, _g3_4(gx+212, gy+16, gz+4));
+        GOUT(9, _g3_4(gx+208, gy+24, gz+0));
+        GOUT(10, _g3_4(gx+208, gy+20, gz+4));
+        GOUT(11, _g3_4(gx+208, gy+16, gz+8));
+        GOUT(12, _g2_4(gx+216, gz+16));
+        GOUT(13, _g3_4(gx+212, gy+4, gz+16));
+        GOUT(14, _g2_4(gx+212, gz+20));
+        GOUT(15, _g3_4(gx+208, gy+8, gz+16));
+        GOUT(16, _g3_4(gx+208, gy+4, gz+20));
+        GOUT(17, _g2_4(gx+208, gz+24));
+        GOUT(18, _g3_4(gx+200, gy+32, gz+0));
+        GOUT(19, _g3_4(gx+196, gy+36, gz+0));
+        GOUT(20, _g3_4(gx+196, gy+32, gz+4));
+        GOUT(21, _g3_4(gx+192, gy+40, gz+0));
+        GOUT(22, _g3_4(gx+192, gy+36, gz+4));
+        GOUT(23, _g3_4(gx+192, gy+32, gz+8));
+        GOUT(24, _g3_4(gx+200, gy+16, gz+16));
+        GOUT(25, _g3_4(gx+196, gy+20, gz+16));
+        GOUT(26, _g3_4(gx+196, gy+16, gz+20));
+        GOUT(27, _g3_4(gx+192, gy+24, gz+16));
+        GOUT(28, _g3_4(gx+192, gy+20, gz+20));
+        GOUT(29, _g3_4(gx+192, gy+16, gz+24));
+        GOUT(30, _g2_4(gx+200, gz+32));
+        GOUT(31, _g3_4(gx+196, gy+4, gz+32));
+        GOUT(32, _g2_4(gx+196, gz+36));
+        GOUT(33, _g3_4(gx+192, gy+8, gz+32));
+        GOUT(34, _g3_4(gx+192, gy+4, gz+36));
+        GOUT(35, _g2_4(gx+192, gz+40));
+        GOUT(36, _g3_4(gx+168, gy+64, gz+0));
+        GOUT(37, _g3_4(gx+164, gy+68, gz+0));
+        GOUT(38, _g3_4(gx+164, gy+64, gz+4));
+        GOUT(39, _g3_4(gx+160, gy+72, gz+0));
+        GOUT(40, _g3_4(gx+160, gy+68, gz+4));
+        GOUT(41, _g3_4(gx+160, gy+64, gz+8));
+        GOUT(42, _g3_4(gx+152, gy+80, gz+0));
+        GOUT(43, _g3_4(gx+148, gy+84, gz+0));
+        GOUT(44, _g3_4(gx+148, gy+80, gz+4));
+        GOUT(45, _g3_4(gx+144, gy+88, gz+0));
+        GOUT(46, _g3_4(gx+144, gy+84, gz+4));
+        GOUT(47, _g3_4(gx+144, gy+80, gz+8));
+        GOUT(48, _g3_4(gx+152, gy+64, gz+16));
+        GOUT(49, _g3_4(gx+148, gy+68, gz+16));
+        GOUT(50, _g3_4(gx+148, gy+64, gz+20));
+        GOUT(51, _g3_4(gx+144, gy+72, gz+16));
+        GOUT(52, _g3_4(gx+144, gy+68, gz+20));
+        GOUT(53, _g3_4(gx+144, gy+64, gz+24));
+        GOUT(54, _g3_4(gx+136, gy+96, gz+0));
+        GOUT(55, _g3_4(gx+132, gy+100, gz+0));
+        GOUT(56, _g3_4(gx+132, gy+96, gz+4));
+        GOUT(57, _g3_4(gx+128, gy+104, gz+0));
+        GOUT(58, _g3_4(gx+128, gy+100, gz+4));
+        GOUT(59, _g3_4(gx+128, gy+96, gz+8));
+        GOUT(60, _g3_4(gx+136, gy+80, gz+16));
+        GOUT(61, _g3_4(gx+132, gy+84, gz+16));
+        GOUT(62, _g3_4(gx+132, gy+80, gz+20));
+        GOUT(63, _g3_4(gx+128, gy+88, gz+16));
+        GOUT(64, _g3_4(gx+128, gy+84, gz+20));
+        GOUT(65, _g3_4(gx+128, gy+80, gz+24));
+        GOUT(66, _g3_4(gx+136, gy+64, gz+32));
+        GOUT(67, _g3_4(gx+132, gy+68, gz+32));
+        GOUT(68, _g3_4(gx+132, gy+64, gz+36));
+        GOUT(69, _g3_4(gx+128, gy+72, gz+32));
+        GOUT(70, _g3_4(gx+128, gy+68, gz+36));
+        GOUT(71, _g3_4(gx+128, gy+64, gz+40));
+        GOUT(72, _g2_4(gx+168, gz+64));
+        GOUT(73, _g3_4(gx+164, gy+4, gz+64));
+        GOUT(74, _g2_4(gx+164, gz+68));
+        GOUT(75, _g3_4(gx+160, gy+8, gz+64));
+        GOUT(76, _g3_4(gx+160, gy+4, gz+68));
+        GOUT(77, _g2_4(gx+160, gz+72));
+        GOUT(78, _g3_4(gx+152, gy+16, gz+64));
+        GOUT(79, _g3_4(gx+148, gy+20, gz+64));
+        GOUT(80, _g3_4(gx+148, gy+16, gz+68));
+        GOUT(81, _g3_4(gx+144, gy+24, gz+64));
+        GOUT(82, _g3_4(gx+144, gy+20, gz+68));
+        GOUT(83, _g3_4(gx+144, gy+16, gz+72));
+        GOUT(84, _g2_4(gx+152, gz+80));
+        GOUT(85, _g3_4(gx+148, gy+4, gz+80));
+        GOUT(86, _g2_4(gx+148, gz+84));
+        GOUT(87, _g3_4(gx+144, gy+8, gz+80));
+        GOUT(88, _g3_4(gx+144, gy+4, gz+84));
+        GOUT(89, _g2_4(gx+144, gz+88));
+        GOUT(90, _g3_4(gx+136, gy+32, gz+64));
+        GOUT(91, _g3_4(gx+132, gy+36, gz+64));
+        GOUT(92, _g3_4(gx+132, gy+32, gz+68));
+        GOUT(93, _g3_4(gx+128, gy+40, gz+64));
+        GOUT(94, _g3_4(gx+128, gy+36, gz+68));
+        GOUT(95, _g3_4(gx+128, gy+32, gz+72));
+        GOUT(96, _g3_4(gx+136, gy+16, gz+80));
+        GOUT(97, _g3_4(gx+132, gy+20, gz+80));
+        GOUT(98, _g3_4(gx+132, gy+16, gz+84));
+        GOUT(99, _g3_4(gx+128, gy+24, gz+80));
+        GOUT(100, _g3_4(gx+128, gy+20, gz+84));
+        GOUT(101, _g3_4(gx+128, gy+16, gz+88));
+        GOUT(102, _g2_4(gx+136, gz+96));
+        GOUT(103, _g3_4(gx+132, gy+4, gz+96));
+        GOUT(104, _g2_4(gx+132, gz+100));
+        GOUT(105, _g3_4(gx+128, gy+8, gz+96));
+        GOUT(106, _g3_4(gx+128, gy+4, gz+100));
+        GOUT(107, _g2_4(gx+128, gz+104));
+        GOUT(108, _g3_4(gx+104, gy+128, gz+0));
+        GOUT(109, _g3_4(gx+100, gy+132, gz+0));
+        GOUT(110, _g3_4(gx+100, gy+128, gz+4));
+        GOUT(111, _g3_4(gx+96, gy+136, gz+0));
+        GOUT(112, _g3_4(gx+96, gy+132, gz+4));
+        GOUT(113, _g3_4(gx+96, gy+128, gz+8));
+        GOUT(114, _g3_4(gx+88, gy+144, gz+0));
+        GOUT(115, _g3_4(gx+84, gy+148, gz+0));
+        GOUT(116, _g3_4(gx+84, gy+144, gz+4));
+        GOUT(117, _g3_4(gx+80, gy+152, gz+0));
+        GOUT(118, _g3_4(gx+80, gy+148, gz+4));
+        GOUT(119, _g3_4(gx+80, gy+144, gz+8));
+        GOUT(120, _g3_4(gx+88, gy+128, gz+16));
+        GOUT(121, _g3_4(gx+84, gy+132, gz+16));
+        GOUT(122, _g3_4(gx+84, gy+128, gz+20));
+        GOUT(123, _g3_4(gx+80, gy+136, gz+16));
+        GOUT(124, _g3_4(gx+80, gy+132, gz+20));
+        GOUT(125, _g3_4(gx+80, gy+128, gz+24));
+        GOUT(126, _g3_4(gx+72, gy+160, gz+0));
+        GOUT(127, _g3_4(gx+68, gy+164, gz+0));
+        GOUT(128, _g3_4(gx+68, gy+160, gz+4));
+        GOUT(129, _g3_4(gx+64, gy+168, gz+0));
+        GOUT(130, _g3_4(gx+64, gy+164, gz+4));
+        GOUT(131, _g3_4(gx+64, gy+160, gz+8));
+        GOUT(132, _g3_4(gx+72, gy+144, gz+16));
+        GOUT(133, _g3_4(gx+68, gy+148, gz+16));
+        GOUT(134, _g3_4(gx+68, gy+144, gz+20));
+        GOUT(135, _g3_4(gx+64, gy+152, gz+16));
+        GOUT(136, _g3_4(gx+64, gy+148, gz+20));
+        GOUT(137, _g3_4(gx+64, gy+144, gz+24));
+        GOUT(138, _g3_4(gx+72, gy+128, gz+32));
+        GOUT(139, _g3_4(gx+68, gy+132, gz+32));
+        GOUT(140, _g3_4(gx+68, gy+128, gz+36));
+        GOUT(141, _g3_4(gx+64, gy+136, gz+32));
+        GOUT(142, _g3_4(gx+64, gy+132, gz+36));
+        GOUT(143, _g3_4(gx+64, gy+128, gz+40));
+        GOUT(144, _g3_4(gx+40, gy+192, gz+0));
+        GOUT(145, _g3_4(gx+36, gy+196, gz+0));
+        GOUT(146, _g3_4(gx+36, gy+192, gz+4));
+        GOUT(147, _g3_4(gx+32, gy+200, gz+0));
+        GOUT(148, _g3_4(gx+32, gy+196, gz+4));
+        GOUT(149, _g3_4(gx+32, gy+192, gz+8));
+        GOUT(150, _g3_4(gx+24, gy+208, gz+0));
+        GOUT(151, _g3_4(gx+20, gy+212, gz+0));
+        GOUT(152, _g3_4(gx+20, gy+208, gz+4));
+        GOUT(153, _g3_4(gx+16, gy+216, gz+0));
+        GOUT(154, _g3_4(gx+16, gy+212, gz+4));
+        GOUT(155, _g3_4(gx+16, gy+208, gz+8));
+        GOUT(156, _g3_4(gx+24, gy+192, gz+16));
+        GOUT(157, _g3_4(gx+20, gy+196, gz+16));
+        GOUT(158, _g3_4(gx+20, gy+192, gz+20));
+        GOUT(159, _g3_4(gx+16, gy+200, gz+16));
+        GOUT(160, _g3_4(gx+16, gy+196, gz+20));
+        GOUT(161, _g3_4(gx+16, gy+192, gz+24));
+        GOUT(162, _g3_4(gx+8, gy+224, gz+0));
+        GOUT(163, _g3_4(gx+4, gy+228, gz+0));
+        GOUT(164, _g3_4(gx+4, gy+224, gz+4));
+        GOUT(165, _g2_4(gy+232, gz+0));
+        GOUT(166, _g2_4(gy+228, gz+4));
+        GOUT(167, _g2_4(gy+224, gz+8));
+        GOUT(168, _g3_4(gx+8, gy+208, gz+16));
+        GOUT(169, _g3_4(gx+4, gy+212, gz+16));
+        GOUT(170, _g3_4(gx+4, gy+208, gz+20));
+        GOUT(171, _g2_4(gy+216, gz+16));
+        GOUT(172, _g2_4(gy+212, gz+20));
+        GOUT(173, _g2_4(gy+208, gz+24));
+        GOUT(174, _g3_4(gx+8, gy+192, gz+32));
+        GOUT(175, _g3_4(gx+4, gy+196, gz+32));
+        GOUT(176, _g3_4(gx+4, gy+192, gz+36));
+        GOUT(177, _g2_4(gy+200, gz+32));
+        GOUT(178, _g2_4(gy+196, gz+36));
+        GOUT(179, _g2_4(gy+192, gz+40));
+        GOUT(180, _g3_4(gx+40, gy+128, gz+64));
+        GOUT(181, _g3_4(gx+36, gy+132, gz+64));
+        GOUT(182, _g3_4(gx+36, gy+128, gz+68));
+        GOUT(183, _g3_4(gx+32, gy+136, gz+64));
+        GOUT(184, _g3_4(gx+32, gy+132, gz+68));
+        GOUT(185, _g3_4(gx+32, gy+128, gz+72));
+        GOUT(186, _g3_4(gx+24, gy+144, gz+64));
+        GOUT(187, _g3_4(gx+20, gy+148, gz+64));
+        GOUT(188, _g3_4(gx+20, gy+144, gz+68));
+        GOUT(189, _g3_4(gx+16, gy+152, gz+64));
+        GOUT(190, _g3_4(gx+16, gy+148, gz+68));
+        GOUT(191, _g3_4(gx+16, gy+144, gz+72));
+        GOUT(192, _g3_4(gx+24, gy+128, gz+80));
+        GOUT(193, _g3_4(gx+20, gy+132, gz+80));
+        GOUT(194, _g3_4(gx+20, gy+128, gz+84));
+        GOUT(195, _g3_4(gx+16, gy+136, gz+80));
+        GOUT(196, _g3_4(gx+16, gy+132, gz+84));
+        GOUT(197, _g3_4(gx+16, gy+128, gz+88));
+        GOUT(198, _g3_4(gx+8, gy+160, gz+64));
+        GOUT(199, _g3_4(gx+4, gy+164, gz+64));
+        GOUT(200, _g3_4(gx+4, gy+160, gz+68));
+        GOUT(201, _g2_4(gy+168, gz+64));
+        GOUT(202, _g2_4(gy+164, gz+68));
+        GOUT(203, _g2_4(gy+160, gz+72));
+        GOUT(204, _g3_4(gx+8, gy+144, gz+80));
+        GOUT(205, _g3_4(gx+4, gy+148, gz+80));
+        GOUT(206, _g3_4(gx+4, gy+144, gz+84));
+        GOUT(207, _g2_4(gy+152, gz+80));
+        GOUT(208, _g2_4(gy+148, gz+84));
+        GOUT(209, _g2_4(gy+144, gz+88));
+        GOUT(210, _g3_4(gx+8, gy+128, gz+96));
+        GOUT(211, _g3_4(gx+4, gy+132, gz+96));
+        GOUT(212, _g3_4(gx+4, gy+128, gz+100));
+        GOUT(213, _g2_4(gy+136, gz+96));
+        GOUT(214, _g2_4(gy+132, gz+100));
+        GOUT(215, _g2_4(gy+128, gz+104));
+        GOUT(216, _g2_4(gx+104, gz+128));
+        GOUT(217, _g3_4(gx+100, gy+4, gz+128));
+        GOUT(218, _g2_4(gx+100, gz+132));
+        GOUT(219, _g3_4(gx+96, gy+8, gz+128));
+        GOUT(220, _g3_4(gx+96, gy+4, gz+132));
+        GOUT(221, _g2_4(gx+96, gz+136));
+        GOUT(222, _g3_4(gx+88, gy+16, gz+128));
+        GOUT(223, _g3_4(gx+84, gy+20, gz+128));
+        GOUT(224, _g3_4(gx+84, gy+16, gz+132));
+        GOUT(225, _g3_4(gx+80, gy+24, gz+128));
+        GOUT(226, _g3_4(gx+80, gy+20, gz+132));
+        GOUT(227, _g3_4(gx+80, gy+16, gz+136));
+        GOUT(228, _g2_4(gx+88, gz+144));
+        GOUT(229, _g3_4(gx+84, gy+4, gz+144));
+        GOUT(230, _g2_4(gx+84, gz+148));
+        GOUT(231, _g3_4(gx+80, gy+8, gz+144));
+        GOUT(232, _g3_4(gx+80, gy+4, gz+148));
+        GOUT(233, _g2_4(gx+80, gz+152));
+        GOUT(234, _g3_4(gx+72, gy+32, gz+128));
+        GOUT(235, _g3_4(gx+68, gy+36, gz+128));
+        GOUT(236, _g3_4(gx+68, gy+32, gz+132));
+        GOUT(237, _g3_4(gx+64, gy+40, gz+128));
+        GOUT(238, _g3_4(gx+64, gy+36, gz+132));
+        GOUT(239, _g3_4(gx+64, gy+32, gz+136));
+        GOUT(240, _g3_4(gx+72, gy+16, gz+144));
+        GOUT(241, _g3_4(gx+68, gy+20, gz+144));
+        GOUT(242, _g3_4(gx+68, gy+16, gz+148));
+        GOUT(243, _g3_4(gx+64, gy+24, gz+144));
+        GOUT(244, _g3_4(gx+64, gy+20, gz+148));
+        GOUT(245, _g3_4(gx+64, gy+16, gz+152));
+        GOUT(246, _g2_4(gx+72, gz+160));
+        GOUT(247, _g3_4(gx+68, gy+4, gz+160));
+        GOUT(248, _g2_4(gx+68, gz+164));
+        GOUT(249, _g3_4(gx+64, gy+8, gz+160));
+        GOUT(250, _g3_4(gx+64, gy+4, gz+164));
+        GOUT(251, _g2_4(gx+64, gz+168));
+        GOUT(252, _g3_4(gx+40, gy+64, gz+128));
+        GOUT(253, _g3_4(gx+36, gy+68, gz+128));
+        GOUT(254, _g3_4(gx+36, gy+64, gz+132));
+        GOUT(255, _g3_4(gx+32, gy+72, gz+128));
+        GOUT(256, _g3_4(gx+32, gy+68, gz+132));
+        GOUT(257, _g3_4(gx+32, gy+64, gz+136));
+        GOUT(258, _g3_4(gx+24, gy+80, gz+128));
+        GOUT(259, _g3_4(gx+20, gy+84, gz+128));
+        GOUT(260, _g3_4(gx+20, gy+80, gz+132));
+        GOUT(261, _g3_4(gx+16, gy+88, gz+128));
+        GOUT(262, _g3_4(gx+16, gy+84, gz+132));
+        GOUT(263, _g3_4(gx+16, gy+80, gz+136));
+        GOUT(264, _g3_4(gx+24, gy+64, gz+144));
+        GOUT(265, _g3_4(gx+20, gy+68, gz+144));
+        GOUT(266, _g3_4(gx+20, gy+64, gz+148));
+        GOUT(267, _g3_4(gx+16, gy+72, gz+144));
+        GOUT(268, _g3_4(gx+16, gy+68, gz+148));
+        GOUT(269, _g3_4(gx+16, gy+64, gz+152));
+        GOUT(270, _g3_4(gx+8, gy+96, gz+128));
+        GOUT(271, _g3_4(gx+4, gy+100, gz+128));
+        GOUT(272, _g3_4(gx+4, gy+96, gz+132));
+        GOUT(273, _g2_4(gy+104, gz+128));
+        GOUT(274, _g2_4(gy+100, gz+132));
+        GOUT(275, _g2_4(gy+96, gz+136));
+        GOUT(276, _g3_4(gx+8, gy+80, gz+144));
+        GOUT(277, _g3_4(gx+4, gy+84, gz+144));
+        GOUT(278, _g3_4(gx+4, gy+80, gz+148));
+        GOUT(279, _g2_4(gy+88, gz+144));
+        GOUT(280, _g2_4(gy+84, gz+148));
+        GOUT(281, _g2_4(gy+80, gz+152));
+        GOUT(282, _g3_4(gx+8, gy+64, gz+160));
+        GOUT(283, _g3_4(gx+4, gy+68, gz+160));
+        GOUT(284, _g3_4(gx+4, gy+64, gz+164));
+        GOUT(285, _g2_4(gy+72, gz+160));
+        GOUT(286, _g2_4(gy+68, gz+164));
+        GOUT(287, _g2_4(gy+64, gz+168));
+        GOUT(288, _g2_4(gx+40, gz+192));
+        GOUT(289, _g3_4(gx+36, gy+4, gz+192));
+        GOUT(290, _g2_4(gx+36, gz+196));
+        GOUT(291, _g3_4(gx+32, gy+8, gz+192));
+        GOUT(292, _g3_4(gx+32, gy+4, gz+196));
+        GOUT(293, _g2_4(gx+32, gz+200));
+        GOUT(294, _g3_4(gx+24, gy+16, gz+192));
+        GOUT(295, _g3_4(gx+20, gy+20, gz+192));
+        GOUT(296, _g3_4(gx+20, gy+16, gz+196));
+        GOUT(297, _g3_4(gx+16, gy+24, gz+192));
+        GOUT(298, _g3_4(gx+16, gy+20, gz+196));
+        GOUT(299, _g3_4(gx+16, gy+16, gz+200));
+        GOUT(300, _g2_4(gx+24, gz+208));
+        GOUT(301, _g3_4(gx+20, gy+4, gz+208));
+        GOUT(302, _g2_4(gx+20, gz+212));
+        GOUT(303, _g3_4(gx+16, gy+8, gz+208));
+        GOUT(304, _g3_4(gx+16, gy+4, gz+212));
+        GOUT(305, _g2_4(gx+16, gz+216));
+        GOUT(306, _g3_4(gx+8, gy+32, gz+192));
+        GOUT(307, _g3_4(gx+4, gy+36, gz+192));
+        GOUT(308, _g3_4(gx+4, gy+32, gz+196));
+        GOUT(309, _g2_4(gy+40, gz+192));
+        GOUT(310, _g2_4(gy+36, gz+196));
+        GOUT(311, _g2_4(gy+32, gz+200));
+        GOUT(312, _g3_4(gx+8, gy+16, gz+208));
+        GOUT(313, _g3_4(gx+4, gy+20, gz+208));
+        GOUT(314, _g3_4(gx+4, gy+16, gz+212));
+        GOUT(315, _g2_4(gy+24, gz+208));
+        GOUT(316, _g2_4(gy+20, gz+212));
+        GOUT(317, _g2_4(gy+16, gz+216));
+        GOUT(318, _g2_4(gx+8, gz+224));
+        GOUT(319, _g3_4(gx+4, gy+4, gz+224));
+        GOUT(320, _g2_4(gx+4, gz+228));
+        GOUT(321, _g2_4(gy+8, gz+224));
+        GOUT(322, _g2_4(gy+4, gz+228));
+        GOUT(323, _g1_4(gz+232));
+}
+
+static void _g0_2d4d_2122(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 480;
+        double *gz = g + 960;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 4; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+4] = c00x;
+                gx[n+8] = c00x * gx[n+4] + b10;
+                gx[n+48] = c0px;
+                gx[n+16] = sx + gx[n+48];
+                gx[n+52] = c00x * gx[n+48] + b00;
+                gx[n+20] = sx * gx[n+4] + gx[n+52];
+                gx[n+56] = c00x * gx[n+52] + b10 * gx[n+48] + b00 * gx[n+4];
+                gx[n+24] = sx * gx[n+8] + gx[n+56];
+                gx[n+96] = c0px * gx[n+48] + b01;
+                gx[n+64] = sx * gx[n+48] + gx[n+96];
+                gx[n+32] = sx * gx[n+16] + gx[n+64];
+                gx[n+100] = c00x * gx[n+96] + 2 * b00 * gx[n+48];
+                gx[n+68] = sx * gx[n+52] + gx[n+100];
+                gx[n+36] = sx * gx[n+20] + gx[n+68];
+                gx[n+104] = c00x * gx[n+100] + b10 * gx[n+96] + 2 * b00 * gx[n+52];
+                gx[n+72] = sx * gx[n+56] + gx[n+104];
+                gx[n+40] = sx * gx[n+24] + gx[n+72];
+                gx[n+144] = c0px * gx[n+96] + 2 * b01 * gx[n+48];
+                gx[n+112] = sx * gx[n+96] + gx[n+144];
+                gx[n+80] = sx * gx[n+64] + gx[n+112];
+                gx[n+148] = c00x * gx[n+144] + 3 * b00 * gx[n+96];
+                gx[n+116] = sx * gx[n+100] + gx[n+148];
+                gx[n+84] = sx * gx[n+68] + gx[n+116];
+                gx[n+152] = c00x * gx[n+148] + b10 * gx[n+144] + 3 * b00 * gx[n+100];
+                gx[n+120] = sx * gx[n+104] + gx[n+152];
+                gx[n+88] = sx * gx[n+72] + gx[n+120];
+                gx[n+192] = c0px * gx[n+144] + 3 * b01 * gx[n+96];
+                gx[n+160] = sx * gx[n+144] + gx[n+192];
+                gx[n+128] = sx * gx[n+112] + gx[n+160];
+                gx[n+196] = c00x * gx[n+192] + 4 * b00 * gx[n+144];
+                gx[n+164] = sx * gx[n+148] + gx[n+196];
+                gx[n+132] = sx * gx[n+116] + gx[n+164];
+                gx[n+200] = c00x * gx[n+196] + b10 * gx[n+192] + 4 * b00 * gx[n+148];
+                gx[n+168] = sx * gx[n+152] + gx[n+200];
+                gx[n+136] = sx * gx[n+120] + gx[n+168];
+                gx[n+240] = rx + gx[n+4];
+                gx[n+244] = rx * gx[n+4] + gx[n+8];
+                gx[n+12] = c00x * gx[n+8] + 2 * b10 * gx[n+4];
+                gx[n+248] = rx * gx[n+8] + gx[n+12];
+                gx[n+256] = rx * gx[n+16] + gx[n+20];
+                gx[n+260] = rx * gx[n+20] + gx[n+24];
+                gx[n+60] = c00x * gx[n+56] + 2 * b10 * gx[n+52] + b00 * gx[n+8];
+                gx[n+28] = sx * gx[n+12] + gx[n+60];
+                gx[n+264] = rx * gx[n+24] + gx[n+28];
+                gx[n+272] = rx * gx[n+32] + gx[n+36];
+                gx[n+276] = rx * gx[n+36] + gx[n+40];
+                gx[n+108] = c00x * gx[n+104] + 2 * b10 * gx[n+100] + 2 * b00 * gx[n+56];
+                gx[n+76] = sx * gx[n+60] + gx[n+108];
+                gx[n+44] = sx * gx[n+28] + gx[n+76];
+                gx[n+280] = rx * gx[n+40] + gx[n+44];
+                gx[n+288] = rx * gx[n+48] + gx[n+52];
+                gx[n+292] = rx * gx[n+52] + gx[n+56];
+                gx[n+296] = rx * gx[n+56] + gx[n+60];
+                gx[n+304] = rx * gx[n+64] + gx[n+68];
+                gx[n+308] = rx * gx[n+68] + gx[n+72];
+                gx[n+312] = rx * gx[n+72] + gx[n+76];
+                gx[n+320] = rx * gx[n+80] + gx[n+84];
+                gx[n+324] = rx * gx[n+84] + gx[n+88];
+                gx[n+156] = c00x * gx[n+152] + 2 * b10 * gx[n+148] + 3 * b00 * gx[n+104];
+                gx[n+124] = sx * gx[n+108] + gx[n+156];
+                gx[n+92] = sx * gx[n+76] + gx[n+124];
+                gx[n+328] = rx * gx[n+88] + gx[n+92];
+                gx[n+336] = rx * gx[n+96] + gx[n+100];
+                gx[n+340] = rx * gx[n+100] + gx[n+104];
+                gx[n+344] = rx * gx[n+104] + gx[n+108];
+                gx[n+352] = rx * gx[n+112] + gx[n+116];
+                gx[n+356] = rx * gx[n+116] + gx[n+120];
+                gx[n+360] = rx * gx[n+120] + gx[n+124];
+                gx[n+368] = rx * gx[n+128] + gx[n+132];
+                gx[n+372] = rx * gx[n+132] + gx[n+136];
+                gx[n+204] = c00x * gx[n+200] + 2 * b10 * gx[n+196] + 4 * b00 * gx[n+152];
+                gx[n+172] = sx * gx[n+156] + gx[n+204];
+                gx[n+140] = sx * gx[n+124] + gx[n+172];
+                gx[n+376] = rx * gx[n+136] + gx[n+140];
+                gy[n+4] = c00y;
+                gy[n+8] = c00y * gy[n+4] + b10;
+                gy[n+48] = c0py;
+                gy[n+16] = sy + gy[n+48];
+                gy[n+52] = c00y * gy[n+48] + b00;
+                gy[n+20] = sy * gy[n+4] + gy[n+52];
+                gy[n+56] = c00y * gy[n+52] + b10 * gy[n+48] + b00 * gy[n+4];
+                gy[n+24] = sy * gy[n+8] + gy[n+56];
+                gy[n+96] = c0py * gy[n+48] + b01;
+                gy[n+64] = sy * gy[n+48] + gy[n+96];
+                gy[n+32] = sy * gy[n+16] + gy[n+64];
+                gy[n+100] = c00y * gy[n+96] + 2 * b00 * gy[n+48];
+                gy[n+68] = sy * gy[n+52] + gy[n+100];
+                gy[n+36] = sy * gy[n+20] + gy[n+68];
+                gy[n+104] = c00y * gy[n+100] + b10 * gy[n+96] + 2 * b00 * gy[n+52];
+                gy[n+72] = sy * gy[n+56] + gy[n+104];
+                gy[n+40] = sy * gy[n+24] + gy[n+72];
+                gy[n+144] = c0py * gy[n+96] + 2 * b01 * gy[n+48];
+                gy[n+112] = sy * gy[n+96] + gy[n+144];
+                gy[n+80] = sy * gy[n+64] + gy[n+112];
+                gy[n+148] = c00y * gy[n+144] + 3 * b00 * gy[n+96];
+                gy[n+116] = sy * gy[n+100] + gy[n+148];
+                gy[n+84] = sy * gy[n+68] + gy[n+116];
+                gy[n+152] = c00y * gy[n+148] + b10 * gy[n+144] + 3 * b00 * gy[n+100];
+                gy[n+120] = sy * gy[n+104] + gy[n+152];
+                gy[n+88] = sy * gy[n+72] + gy[n+120];
+                gy[n+192] = c0py * gy[n+144] + 3 * b01 * gy[n+96];
+                gy[n+160] = sy * gy[n+144] + gy[n+192];
+                gy[n+128] = sy * gy[n+112] + gy[n+160];
+                gy[n+196] = c00y * gy[n+192] + 4 * b00 * gy[n+144];
+                gy[n+164] = sy * gy[n+148] + gy[n+196];
+                gy[n+132] = sy * gy[n+116] + gy[n+164];
+                gy[n+200] = c00y * gy[n+196] + b10 * gy[n+192] + 4 * b00 * gy[n+148];
+                gy[n+168] = sy * gy[n+152] + gy[n+200];
+                gy[n+136] = sy * gy[n+120] + gy[n+168];
+                gy[n+240] = ry + gy[n+4];
+                gy[n+244] = ry * gy[n+4] + gy[n+8];
+                gy[n+12] = c00y * gy[n+8] + 2 * b10 * gy[n+4];
+                gy[n+248] = ry * gy[n+8] + gy[n+12];
+                gy[n+256] = ry * gy[n+16] + gy[n+20];
+                gy[n+260] = ry * gy[n+20] + gy[n+24];
+                gy[n+60] = c00y * gy[n+56] + 2 * b10 * gy[n+52] + b00 * gy[n+8];
+                gy[n+28] = sy * gy[n+12] + gy[n+60];
+                gy[n+264] = ry * gy[n+24] + gy[n+28];
+                gy[n+272] = ry * gy[n+32] + gy[n+36];
+                gy[n+276] = ry * gy[n+36] + gy[n+40];
+                gy[n+108] = c00y * gy[n+104] + 2 * b10 * gy[n+100] + 2 * b00 * gy[n+56];
+                gy[n+76] = sy * gy[n+60] + gy[n+108];
+                gy[n+44] = sy * gy[n+28] + gy[n+76];
+                gy[n+280] = ry * gy[n+40] + gy[n+44];
+                gy[n+288] = ry * gy[n+48] + gy[n+52];
+                gy[n+292] = ry * gy[n+52] + gy[n+56];
+                gy[n+296] = ry * gy[n+56] + gy[n+60];
+                gy[n+304] = ry * gy[n+64] + gy[n+68];
+                gy[n+308] = ry * gy[n+68] + gy[n+72];
+                gy[n+312] = ry * gy[n+72] + gy[n+76];
+                gy[n+320] = ry * gy[n+80] + gy[n+84];
+                gy[n+324] = ry * gy[n+84] + gy[n+88];
+                gy[n+156] = c00y * gy[n+152] + 2 * b10 * gy[n+148] + 3 * b00 * gy[n+104];
+                gy[n+124] = sy * gy[n+108] + gy[n+156];
+                gy[n+92] = sy * gy[n+76] + gy[n+124];
+                gy[n+328] = ry * gy[n+88] + gy[n+92];
+                gy[n+336] = ry * gy[n+96] + gy[n+100];
+                gy[n+340] = ry * gy[n+100] + gy[n+104];
+                gy[n+344] = ry * gy[n+104] + gy[n+108];
+                gy[n+352] = ry * gy[n+112] + gy[n+116];
+                gy[n+356] = ry * gy[n+116] + gy[n+120];
+                gy[n+360] = ry * gy[n+120] + gy[n+124];
+                gy[n+368] = ry * gy[n+128] + gy[n+132];
+                gy[n+372] = ry * gy[n+132] + gy[n+136];
+                gy[n+204] = c00y * gy[n+200] + 2 * b10 * gy[n+196] + 4 * b00 * gy[n+152];
+                gy[n+172] = sy * gy[n+156] + gy[n+204];
+                gy[n+140] = sy * gy[n+124] + gy[n+172];
+                gy[n+376] = ry * gy[n+136] + gy[n+140];
+                gz[n+4] = c00z * gz[n+0];
+                gz[n+8] = c00z * gz[n+4] + b10 * gz[n+0];
+                gz[n+48] = c0pz * gz[n+0];
+                gz[n+16] = sz * gz[n+0] + gz[n+48];
+                gz[n+52] = c00z * gz[n+48] + b00 * gz[n+0];
+                gz[n+20] = sz * gz[n+4] + gz[n+52];
+                gz[n+56] = c00z * gz[n+52] + b10 * gz[n+48] + b00 * gz[n+4];
+                gz[n+24] = sz * gz[n+8] + gz[n+56];
+                gz[n+96] = c0pz * gz[n+48] + b01 * gz[n+0];
+                gz[n+64] = sz * gz[n+48] + gz[n+96];
+                gz[n+32] = sz * gz[n+16] + gz[n+64];
+                gz[n+100] = c00z * gz[n+96] + 2 * b00 * gz[n+48];
+                gz[n+68] = sz * gz[n+52] + gz[n+100];
+                gz[n+36] = sz * gz[n+20] + gz[n+68];
+                gz[n+104] = c00z * gz[n+100] + b10 * gz[n+96] + 2 * b00 * gz[n+52];
+                gz[n+72] = sz * gz[n+56] + gz[n+104];
+                gz[n+40] = sz * gz[n+24] + gz[n+72];
+                gz[n+144] = c0pz * gz[n+96] + 2 * b01 * gz[n+48];
+                gz[n+112] = sz * gz[n+96] + gz[n+144];
+                gz[n+80] = sz * gz[n+64] + gz[n+112];
+                gz[n+148] = c00z * gz[n+144] + 3 * b00 * gz[n+96];
+                gz[n+116] = sz * gz[n+100] + gz[n+148];
+                gz[n+84] = sz * gz[n+68] + gz[n+116];
+                gz[n+152] = c00z * gz[n+148] + b10 * gz[n+144] + 3 * b00 * gz[n+100];
+                gz[n+120] = sz * gz[n+104] + gz[n+152];
+                gz[n+88] = sz * gz[n+72] + gz[n+120];
+                gz[n+192] = c0pz * gz[n+144] + 3 * b01 * gz[n+96];
+                gz[n+160] = sz * gz[n+144] + gz[n+192];
+                gz[n+128] = sz * gz[n+112] + gz[n+160];
+                gz[n+196] = c00z * gz[n+192] + 4 * b00 * gz[n+144];
+                gz[n+164] = sz * gz[n+148] + gz[n+196];
+                gz[n+132] = sz * gz[n+116] + gz[n+164];
+                gz[n+200] = c00z * gz[n+196] + b10 * gz[n+192] + 4 * b00 * gz[n+148];
+                gz[n+168] = sz * gz[n+152] + gz[n+200];
+                gz[n+136] = sz * gz[n+120] + gz[n+168];
+                gz[n+240] = rz * gz[n+0] + gz[n+4];
+                gz[n+244] = rz * gz[n+4] + gz[n+8];
+                gz[n+12] = c00z * gz[n+8] + 2 * b10 * gz[n+4];
+                gz[n+248] = rz * gz[n+8] + gz[n+12];
+                gz[n+256] = rz * gz[n+16] + gz[n+20];
+                gz[n+260] = rz * gz[n+20] + gz[n+24];
+                gz[n+60] = c00z * gz[n+56] + 2 * b10 * gz[n+52] + b00 * gz[n+8];
+                gz[n+28] = sz * gz[n+12] + gz[n+60];
+                gz[n+264] = rz * gz[n+24] + gz[n+28];
+                gz[n+272] = rz * gz[n+32] + gz[n+36];
+                gz[n+276] = rz * gz[n+36] + gz[n+40];
+                gz[n+108] = c00z * gz[n+104] + 2 * b10 * gz[n+100] + 2 * b00 * gz[n+56];
+                gz[n+76] = sz * gz[n+60] + gz[n+108];
+                gz[n+44] = sz * gz[n+28] + gz[n+76];
+                gz[n+280] = rz * gz[n+40] + gz[n+44];
+                gz[n+288] = rz * gz[n+48] + gz[n+52];
+                gz[n+292] = rz * gz[n+52] + gz[n+56];
+                gz[n+296] = rz * gz[n+56] + gz[n+60];
+                gz[n+304] = rz * gz[n+64] + gz[n+68];
+                gz[n+308] = rz * gz[n+68] + gz[n+72];
+                gz[n+312] = rz * gz[n+72] + gz[n+76];
+                gz[n+320] = rz * gz[n+80] + gz[n+84];
+                gz[n+324] = rz * gz[n+84] + gz[n+88];
+                gz[n+156] = c00z * gz[n+152] + 2 * b10 * gz[n+148] + 3 * b00 * gz[n+104];
+                gz[n+124] = sz * gz[n+108] + gz[n+156];
+                gz[n+92] = sz * gz[n+76] + gz[n+124];
+                gz[n+328] = rz * gz[n+88] + gz[n+92];
+                gz[n+336] = rz * gz[n+96] + gz[n+100];
+                gz[n+340] = rz * gz[n+100] + gz[n+104];
+                gz[n+344] = rz * gz[n+104] + gz[n+108];
+                gz[n+352] = rz * gz[n+112] + gz[n+116];
+                gz[n+356] = rz * gz[n+116] + gz[n+120];
+                gz[n+360] = rz * gz[n+120] + gz[n+124];
+                gz[n+368] = rz * gz[n+128] + gz[n+132];
+                gz[n+372] = rz * gz[n+132] + gz[n+136];
+                gz[n+204] = c00z * gz[n+200] + 2 * b10 * gz[n+196] + 4 * b00 * gz[n+152];
+                gz[n+172] = sz * gz[n+156] + gz[n+204];
+                gz[n+140] = sz * gz[n+124] + gz[n+172];
+                gz[n+376] = rz * gz[n+136] + gz[n+140];
+        }
+}
+static void _gout_2122(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 480;
+        double *gz = g + 960;
+        GOUT(0, _g2_4(gx+376, gz+0));
+        GOUT(1, _g3_4(gx+372, gy+4, gz+0));
+        GOUT(2, _g2_4(gx+372, gz+4));
+        GOUT(3, _g3_4(gx+368, gy+8, gz+0));
+        GOUT(4, _g3_4(gx+368, gy+4, gz+4));
+        GOUT(5, _g2_4(gx+368, gz+8));
+        GOUT(6, _g3_4(gx+360, gy+16, gz+0));
+        GOUT(7, _g3_4(gx+356, gy+20, gz+0));
+        GOUT(8, _g3_4(gx+356, gy+16, gz+4));
+        GOUT(9, _g3_4(gx+352, gy+24, gz+0));
+        GOUT(10, _g3_4(gx+352, gy+20, gz+4));
+        GOUT(11, _g3_4(gx+352, gy+16, gz+8));
+        GOUT(12, _g2_4(gx+360, gz+16));
+        GOUT(13, _g3_4(gx+356, gy+4, gz+16));
+        GOUT(14, _g2_4(gx+356, gz+20));
+        GOUT(15, _g3_4(gx+352, gy+8, gz+16));
+        GOUT(16, _g3_4(gx+352, gy+4, gz+20));
+        GOUT(17, _g2_4(gx+352, gz+24));
+        GOUT(18, _g3_4(gx+344, gy+32, gz+0));
+        GOUT(19, _g3_4(gx+340, gy+36, gz+0));
+        GOUT(20, _g3_4(gx+340, gy+32, gz+4));
+        GOUT(21, _g3_4(gx+336, gy+40, gz+0));
+        GOUT(22, _g3_4(gx+336, gy+36, gz+4));
+        GOUT(23, _g3_4(gx+336, gy+32, gz+8));
+        GOUT(24, _g3_4(gx+344, gy+16, gz+16));
+        GOUT(25, _g3_4(gx+340, gy+20, gz+16));
+        GOUT(26, _g3_4(gx+340, gy+16, gz+20));
+        GOUT(27, _g3_4(gx+336, gy+24, gz+16));
+        GOUT(28, _g3_4(gx+336, gy+20, gz+20));
+        GOUT(29, _g3_4(gx+336, gy+16, gz+24));
+        GOUT(30, _g2_4(gx+344, gz+32));
+        GOUT(31, _g3_4(gx+340, gy+4, gz+32));
+        GOUT(32, _g2_4(gx+340, gz+36));
+        GOUT(33, _g3_4(gx+336, gy+8, gz+32));
+        GOUT(34, _g3_4(gx+336, gy+4, gz+36));
+        GOUT(35, _g2_4(gx+336, gz+40));
+        GOUT(36, _g3_4(gx+328, gy+48, gz+0));
+        GOUT(37, _g3_4(gx+324, gy+52, gz+0));
+        GOUT(38, _g3_4(gx+324, gy+48, gz+4));
+        GOUT(39, _g3_4(gx+320, gy+56, gz+0));
+        GOUT(40, _g3_4(gx+320, gy+52, gz+4));
+        GOUT(41, _g3_4(gx+320, gy+48, gz+8));
+        GOUT(42, _g3_4(gx+312, gy+64, gz+0));
+        GOUT(43, _g3_4(gx+308, gy+68, gz+0));
+        GOUT(44, _g3_4(gx+308, gy+64, gz+4));
+        GOUT(45, _g3_4(gx+304, gy+72, gz+0));
+        GOUT(46, _g3_4(gx+304, gy+68, gz+4));
+        GOUT(47, _g3_4(gx+304, gy+64, gz+8));
+        GOUT(48, _g3_4(gx+312, gy+48, gz+16));
+        GOUT(49, _g3_4(gx+308, gy+52, gz+16));
+        GOUT(50, _g3_4(gx+308, gy+48, gz+20));
+        GOUT(51, _g3_4(gx+304, gy+56, gz+16));
+        GOUT(52, _g3_4(gx+304, gy+52, gz+20));
+        GOUT(53, _g3_4(gx+304, gy+48, gz+24));
+        GOUT(54, _g3_4(gx+296, gy+80, gz+0));
+        GOUT(55, _g3_4(gx+292, gy+84, gz+0));
+        GOUT(56, _g3_4(gx+292, gy+80, gz+4));
+        GOUT(57, _g3_4(gx+288, gy+88, gz+0));
+        GOUT(58, _g3_4(gx+288, gy+84, gz+4));
+        GOUT(59, _g3_4(gx+288, gy+80, gz+8));
+        GOUT(60, _g3_4(gx+296, gy+64, gz+16));
+        GOUT(61, _g3_4(gx+292, gy+68, gz+16));
+        GOUT(62, _g3_4(gx+292, gy+64, gz+20));
+        GOUT(63, _g3_4(gx+288, gy+72, gz+16));
+        GOUT(64, _g3_4(gx+288, gy+68, gz+20));
+        GOUT(65, _g3_4(gx+288, gy+64, gz+24));
+        GOUT(66, _g3_4(gx+296, gy+48, gz+32));
+        GOUT(67, _g3_4(gx+292, gy+52, gz+32));
+        GOUT(68, _g3_4(gx+292, gy+48, gz+36));
+        GOUT(69, _g3_4(gx+288, gy+56, gz+32));
+        GOUT(70, _g3_4(gx+288, gy+52, gz+36));
+        GOUT(71, _g3_4(gx+288, gy+48, gz+40));
+        GOUT(72, _g2_4(gx+328, gz+48));
+        GOUT(73, _g3_4(gx+324, gy+4, gz+48));
+        GOUT(74, _g2_4(gx+324, gz+52));
+        GOUT(75, _g3_4(gx+320, gy+8, gz+48));
+        GOUT(76, _g3_4(gx+320, gy+4, gz+52));
+        GOUT(77, _g2_4(gx+320, gz+56));
+        GOUT(78, _g3_4(gx+312, gy+16, gz+48));
+        GOUT(79, _g3_4(gx+308, gy+20, gz+48));
+        GOUT(80, _g3_4(gx+308, gy+16, gz+52));
+        GOUT(81, _g3_4(gx+304, gy+24, gz+48));
+        GOUT(82, _g3_4(gx+304, gy+20, gz+52));
+        GOUT(83, _g3_4(gx+304, gy+16, gz+56));
+        GOUT(84, _g2_4(gx+312, gz+64));
+        GOUT(85, _g3_4(gx+308, gy+4, gz+64));
+        GOUT(86, _g2_4(gx+308, gz+68));
+        GOUT(87, _g3_4(gx+304, gy+8, gz+64));
+        GOUT(88, _g3_4(gx+304, gy+4, gz+68));
+        GOUT(89, _g2_4(gx+304, gz+72));
+        GOUT(90, _g3_4(gx+296, gy+32, gz+48));
+        GOUT(91, _g3_4(gx+292, gy+36, gz+48));
+        GOUT(92, _g3_4(gx+292, gy+32, gz+52));
+        GOUT(93, _g3_4(gx+288, gy+40, gz+48));
+        GOUT(94, _g3_4(gx+288, gy+36, gz+52));
+        GOUT(95, _g3_4(gx+288, gy+32, gz+56));
+        GOUT(96, _g3_4(gx+296, gy+16, gz+64));
+        GOUT(97, _g3_4(gx+292, gy+20, gz+64));
+        GOUT(98, _g3_4(gx+292, gy+16, gz+68));
+        GOUT(99, _g3_4(gx+288, gy+24, gz+64));
+        GOUT(100, _g3_4(gx+288, gy+20, gz+68));
+        GOUT(101, _g3_4(gx+288, gy+16, gz+72));
+        GOUT(102, _g2_4(gx+296, gz+80));
+        GOUT(103, _g3_4(gx+292, gy+4, gz+80));
+        GOUT(104, _g2_4(gx+292, gz+84));
+        GOUT(105, _g3_4(gx+288, gy+8, gz+80));
+        GOUT(106, _g3_4(gx+288, gy+4, gz+84));
+        GOUT(107, _g2_4(gx+288, gz+88));
+        GOUT(108, _g3_4(gx+280, gy+96, gz+0));
+        GOUT(109, _g3_4(gx+276, gy+100, gz+0));
+        GOUT(110, _g3_4(gx+276, gy+96, gz+4));
+        GOUT(111, _g3_4(gx+272, gy+104, gz+0));
+        GOUT(112, _g3_4(gx+272, gy+100, gz+4));
+        GOUT(113, _g3_4(gx+272, gy+96, gz+8));
+        GOUT(114, _g3_4(gx+264, gy+112, gz+0));
+        GOUT(115, _g3_4(gx+260, gy+116, gz+0));
+        GOUT(116, _g3_4(gx+260, gy+112, gz+4));
+        GOUT(117, _g3_4(gx+256, gy+120, gz+0));
+        GOUT(118, _g3_4(gx+256, gy+116, gz+4));
+        GOUT(119, _g3_4(gx+256, gy+112, gz+8));
+        GOUT(120, _g3_4(gx+264, gy+96, gz+16));
+        GOUT(121, _g3_4(gx+260, gy+100, gz+16));
+        GOUT(122, _g3_4(gx+260, gy+96, gz+20));
+        GOUT(123, _g3_4(gx+256, gy+104, gz+16));
+        GOUT(124, _g3_4(gx+256, gy+100, gz+20));
+        GOUT(125, _g3_4(gx+256, gy+96, gz+24));
+        GOUT(126, _g3_4(gx+248, gy+128, gz+0));
+        GOUT(127, _g3_4(gx+244, gy+132, gz+0));
+        GOUT(128, _g3_4(gx+244, gy+128, gz+4));
+        GOUT(129, _g3_4(gx+240, gy+136, gz+0));
+        GOUT(130, _g3_4(gx+240, gy+132, gz+4));
+        GOUT(131, _g3_4(gx+240, gy+128, gz+8));
+        GOUT(132, _g3_4(gx+248, gy+112, gz+16));
+        GOUT(133, _g3_4(gx+244, gy+116, gz+16));
+        GOUT(134, _g3_4(gx+244, gy+112, gz+20));
+        GOUT(135, _g3_4(gx+240, gy+120, gz+16));
+        GOUT(136, _g3_4(gx+240, gy+116, gz+20));
+        GOUT(137, _g3_4(gx+240, gy+112, gz+24));
+        GOUT(138, _g3_4(gx+248, gy+96, gz+32));
+        GOUT(139, _g3_4(gx+244, gy+100, gz+32));
+        GOUT(140, _g3_4(gx+244, gy+96, gz+36));
+        GOUT(141, _g3_4(gx+240, gy+104, gz+32));
+        GOUT(142, _g3_4(gx+240, gy+100, gz+36));
+        GOUT(143, _g3_4(gx+240, gy+96, gz+40));
+        GOUT(144, _g3_4(gx+280, gy+48, gz+48));
+        GOUT(145, _g3_4(gx+276, gy+52, gz+48));
+        GOUT(146, _g3_4(gx+276, gy+48, gz+52));
+        GOUT(147, _g3_4(gx+272, gy+56, gz+48));
+        GOUT(148, _g3_4(gx+272, gy+52, gz+52));
+        GOUT(149, _g3_4(gx+272, gy+48, gz+56));
+        GOUT(150, _g3_4(gx+264, gy+64, gz+48));
+        GOUT(151, _g3_4(gx+260, gy+68, gz+48));
+        GOUT(152, _g3_4(gx+260, gy+64, gz+52));
+        GOUT(153, _g3_4(gx+256, gy+72, gz+48));
+        GOUT(154, _g3_4(gx+256, gy+68, gz+52));
+        GOUT(155, _g3_4(gx+256, gy+64, gz+56));
+        GOUT(156, _g3_4(gx+264, gy+48, gz+64));
+        GOUT(157, _g3_4(gx+260, gy+52, gz+64));
+        GOUT(158, _g3_4(gx+260, gy+48, gz+68));
+        GOUT(159, _g3_4(gx+256, gy+56, gz+64));
+        GOUT(160, _g3_4(gx+256, gy+52, gz+68));
+        GOUT(161, _g3_4(gx+256, gy+48, gz+72));
+        GOUT(162, _g3_4(gx+248, gy+80, gz+48));
+        GOUT(163, _g3_4(gx+244, gy+84, gz+48));
+        GOUT(164, _g3_4(gx+244, gy+80, gz+52));
+        GOUT(165, _g3_4(gx+240, gy+88, gz+48));
+        GOUT(166, _g3_4(gx+240, gy+84, gz+52));
+        GOUT(167, _g3_4(gx+240, gy+80, gz+56));
+        GOUT(168, _g3_4(gx+248, gy+64, gz+64));
+        GOUT(169, _g3_4(gx+244, gy+68, gz+64));
+        GOUT(170, _g3_4(gx+244, gy+64, gz+68));
+        GOUT(171, _g3_4(gx+240, gy+72, gz+64));
+        GOUT(172, _g3_4(gx+240, gy+68, gz+68));
+        GOUT(173, _g3_4(gx+240, gy+64, gz+72));
+        GOUT(174, _g3_4(gx+248, gy+48, gz+80));
+        GOUT(175, _g3_4(gx+244, gy+52, gz+80));
+        GOUT(176, _g3_4(gx+244, gy+48, gz+84));
+        GOUT(177, _g3_4(gx+240, gy+56, gz+80));
+        GOUT(178, _g3_4(gx+240, gy+52, gz+84));
+        GOUT(179, _g3_4(gx+240, gy+48, gz+88));
+        GOUT(180, _g2_4(gx+280, gz+96));
+        GOUT(181, _g3_4(gx+276, gy+4, gz+96));
+        GOUT(182, _g2_4(gx+276, gz+100));
+        GOUT(183, _g3_4(gx+272, gy+8, gz+96));
+        GOUT(184, _g3_4(gx+272, gy+4, gz+100));
+        GOUT(185, _g2_4(gx+272, gz+104));
+        GOUT(186, _g3_4(gx+264, gy+16, gz+96));
+        GOUT(187, _g3_4(gx+260, gy+20, gz+96));
+        GOUT(188, _g3_4(gx+260, gy+16, gz+100));
+        GOUT(189, _g3_4(gx+256, gy+24, gz+96));
+        GOUT(190, _g3_4(gx+256, gy+20, gz+100));
+        GOUT(191, _g3_4(gx+256, gy+16, gz+104));
+        GOUT(192, _g2_4(gx+264, gz+112));
+        GOUT(193, _g3_4(gx+260, gy+4, gz+112));
+        GOUT(194, _g2_4(gx+260, gz+116));
+        GOUT(195, _g3_4(gx+256, gy+8, gz+112));
+        GOUT(196, _g3_4(gx+256, gy+4, gz+116));
+        GOUT(197, _g2_4(gx+256, gz+120));
+        GOUT(198, _g3_4(gx+248, gy+32, gz+96));
+        GOUT(199, _g3_4(gx+244, gy+36, gz+96));
+        GOUT(200, _g3_4(gx+244, gy+32, gz+100));
+        GOUT(201, _g3_4(gx+240, gy+40, gz+96));
+        GOUT(202, _g3_4(gx+240, gy+36, gz+100));
+        GOUT(203, _g3_4(gx+240, gy+32, gz+104));
+        GOUT(204, _g3_4(gx+248, gy+16, gz+112));
+        GOUT(205, _g3_4(gx+244, gy+20, gz+112));
+        GOUT(206, _g3_4(gx+244, gy+16, gz+116));
+        GOUT(207, _g3_4(gx+240, gy+24, gz+112));
+        GOUT(208, _g3_4(gx+240, gy+20, gz+116));
+        GOUT(209, _g3_4(gx+240, gy+16, gz+120));
+        GOUT(210, _g2_4(gx+248, gz+128));
+        GOUT(211, _g3_4(gx+244, gy+4, gz+128));
+        GOUT(212, _g2_4(gx+244, gz+132));
+        GOUT(213, _g3_4(gx+240, gy+8, gz+128));
+        GOUT(214, _g3_4(gx+240, gy+4, gz+132));
+        GOUT(215, _g2_4(gx+240, gz+136));
+        GOUT(216, _g3_4(gx+136, gy+240, gz+0));
+        GOUT(217, _g3_4(gx+132, gy+244, gz+0));
+        GOUT(218, _g3_4(gx+132, gy+240, gz+4));
+        GOUT(219, _g3_4(gx+128, gy+248, gz+0));
+        GOUT(220, _g3_4(gx+128, gy+244, gz+4));
+        GOUT(221, _g3_4(gx+128, gy+240, gz+8));
+        GOUT(222, _g3_4(gx+120, gy+256, gz+0));
+        GOUT(223, _g3_4(gx+116, gy+260, gz+0));
+        GOUT(224, _g3_4(gx+116, gy+256, gz+4));
+        GOUT(225, _g3_4(gx+112, gy+264, gz+0));
+        GOUT(226, _g3_4(gx+112, gy+260, gz+4));
+        GOUT(227, _g3_4(gx+112, gy+256, gz+8));
+        GOUT(228, _g3_4(gx+120, gy+240, gz+16));
+        GOUT(229, _g3_4(gx+116, gy+244, gz+16));
+        GOUT(230, _g3_4(gx+116, gy+240, gz+20));
+        GOUT(231, _g3_4(gx+112, gy+248, gz+16));
+        GOUT(232, _g3_4(gx+112, gy+244, gz+20));
+        GOUT(233, _g3_4(gx+112, gy+240, gz+24));
+        GOUT(234, _g3_4(gx+104, gy+272, gz+0));
+        GOUT(235, _g3_4(gx+100, gy+276, gz+0));
+        GOUT(236, _g3_4(gx+100, gy+272, gz+4));
+        GOUT(237, _g3_4(gx+96, gy+280, gz+0));
+        GOUT(238, _g3_4(gx+96, gy+276, gz+4));
+        GOUT(239, _g3_4(gx+96, gy+272, gz+8));
+        GOUT(240, _g3_4(gx+104, gy+256, gz+16));
+        GOUT(241, _g3_4(gx+100, gy+260, gz+16));
+        GOUT(242, _g3_4(gx+100, gy+256, gz+20));
+        GOUT(243, _g3_4(gx+96, gy+264, gz+16));
+        GOUT(244, _g3_4(gx+96, gy+260, gz+20));
+        GOUT(245, _g3_4(gx+96, gy+256, gz+24));
+        GOUT(246, _g3_4(gx+104, gy+240, gz+32));
+        GOUT(247, _g3_4(gx+100, gy+244, gz+32));
+        GOUT(248, _g3_4(gx+100, gy+240, gz+36));
+        GOUT(249, _g3_4(gx+96, gy+248, gz+32));
+        GOUT(250, _g3_4(gx+96, gy+244, gz+36));
+        GOUT(251, _g3_4(gx+96, gy+240, gz+40));
+        GOUT(252, _g3_4(gx+88, gy+288, gz+0));
+        GOUT(253, _g3_4(gx+84, gy+292, gz+0));
+        GOUT(254, _g3_4(gx+84, gy+288, gz+4));
+        GOUT(255, _g3_4(gx+80, gy+296, gz+0));
+        GOUT(256, _g3_4(gx+80, gy+292, gz+4));
+        GOUT(257, _g3_4(gx+80, gy+288, gz+8));
+        GOUT(258, _g3_4(gx+72, gy+304, gz+0));
+        GOUT(259, _g3_4(gx+68, gy+308, gz+0));
+        GOUT(260, _g3_4(gx+68, gy+304, gz+4));
+        GOUT(261, _g3_4(gx+64, gy+312, gz+0));
+        GOUT(262, _g3_4(gx+64, gy+308, gz+4));
+        GOUT(263, _g3_4(gx+64, gy+304, gz+8));
+        GOUT(264, _g3_4(gx+72, gy+288, gz+16));
+        GOUT(265, _g3_4(gx+68, gy+292, gz+16));
+        GOUT(266, _g3_4(gx+68, gy+288, gz+20));
+        GOUT(267, _g3_4(gx+64, gy+296, gz+16));
+        GOUT(268, _g3_4(gx+64, gy+292, gz+20));
+        GOUT(269, _g3_4(gx+64, gy+288, gz+24));
+        GOUT(270, _g3_4(gx+56, gy+320, gz+0));
+        GOUT(271, _g3_4(gx+52, gy+324, gz+0));
+        GOUT(272, _g3_4(gx+52, gy+320, gz+4));
+        GOUT(273, _g3_4(gx+48, gy+328, gz+0));
+        GOUT(274, _g3_4(gx+48, gy+324, gz+4));
+        GOUT(275, _g3_4(gx+48, gy+320, gz+8));
+        GOUT(276, _g3_4(gx+56, gy+304, gz+16));
+        GOUT(277, _g3_4(gx+52, gy+308, gz+16));
+        GOUT(278, _g3_4(gx+52, gy+304, gz+20));
+        GOUT(279, _g3_4(gx+48, gy+312, gz+16));
+        GOUT(280, _g3_4(gx+48, gy+308, gz+20));
+        GOUT(281, _g3_4(gx+48, gy+304, gz+24));
+        GOUT(282, _g3_4(gx+56, gy+288, gz+32));
+        GOUT(283, _g3_4(gx+52, gy+292, gz+32));
+        GOUT(284, _g3_4(gx+52, gy+288, gz+36));
+        GOUT(285, _g3_4(gx+48, gy+296, gz+32));
+        GOUT(286, _g3_4(gx+48, gy+292, gz+36));
+        GOUT(287, _g3_4(gx+48, gy+288, gz+40));
+        GOUT(288, _g3_4(gx+88, gy+240, gz+48));
+        GOUT(289, _g3_4(gx+84, gy+244, gz+48));
+        GOUT(290, _g3_4(gx+84, gy+240, gz+52));
+        GOUT(291, _g3_4(gx+80, gy+248, gz+48));
+        GOUT(292, _g3_4(gx+80, gy+244, gz+52));
+        GOUT(293, _g3_4(gx+80, gy+240, gz+56));
+        GOUT(294, _g3_4(gx+72, gy+256, gz+48));
+        GOUT(295, _g3_4(gx+68, gy+260, gz+48));
+        GOUT(296, _g3_4(gx+68, gy+256, gz+52));
+        GOUT(297, _g3_4(gx+64, gy+264, gz+48));
+        GOUT(298, _g3_4(gx+64, gy+260, gz+52));
+        GOUT(299, _g3_4(gx+64, gy+256, gz+56));
+        GOUT(300, _g3_4(gx+72, gy+240, gz+64));
+        GOUT(301, _g3_4(gx+68, gy+244, gz+64));
+        GOUT(302, _g3_4(gx+68, gy+240, gz+68));
+        GOUT(303, _g3_4(gx+64, gy+248, gz+64));
+        GOUT(304, _g3_4(gx+64, gy+244, gz+68));
+        GOUT(305, _g3_4(gx+64, gy+240, gz+72));
+        GOUT(306, _g3_4(gx+56, gy+272, gz+48));
+        GOUT(307, _g3_4(gx+52, gy+276, gz+48));
+        GOUT(308, _g3_4(gx+52, gy+272, gz+52));
+        GOUT(309, _g3_4(gx+48, gy+280, gz+48));
+        GOUT(310, _g3_4(gx+48, gy+276, gz+52));
+        GOUT(311, _g3_4(gx+48, gy+272, gz+56));
+        GOUT(312, _g3_4(gx+56, gy+256, gz+64));
+        GOUT(313, _g3_4(gx+52, gy+260, gz+64));
+        GOUT(314, _g3_4(gx+52, gy+256, gz+68));
+        GOUT(315, _g3_4(gx+48, gy+264, gz+64));
+        GOUT(316, _g3_4(gx+48, gy+260, gz+68));
+        GOUT(317, _g3_4(gx+48, gy+256, gz+72));
+        GOUT(318, _g3_4(gx+56, gy+240, gz+80));
+        GOUT(319, _g3_4(gx+52, gy+244, gz+80));
+        GOUT(320, _g3_4(gx+52, gy+240, gz+84));
+        GOUT(321, _g3_4(gx+48, gy+248, gz+80));
+        GOUT(322, _g3_4(gx+48, gy+244, gz+84));
+        GOUT(323, _g3_4(gx+48, gy+240, gz+88));
+        GOUT(324, _g3_4(gx+40, gy+336, gz+0));
+        GOUT(325, _g3_4(gx+36, gy+340, gz+0));
+        GOUT(326, _g3_4(gx+36, gy+336, gz+4));
+        GOUT(327, _g3_4(gx+32, gy+344, gz+0));
+        GOUT(328, _g3_4(gx+32, gy+340, gz+4));
+        GOUT(329, _g3_4(gx+32, gy+336, gz+8));
+        GOUT(330, _g3_4(gx+24, gy+352, gz+0));
+        GOUT(331, _g3_4(gx+20, gy+356, gz+0));
+        GOUT(332, _g3_4(gx+20, gy+352, gz+4));
+        GOUT(333, _g3_4(gx+16, gy+360, gz+0));
+        GOUT(334, _g3_4(gx+16, gy+356, gz+4));
+        GOUT(335, _g3_4(gx+16, gy+352, gz+8));
+        GOUT(336, _g3_4(gx+24, gy+336, gz+16));
+        GOUT(337, _g3_4(gx+20, gy+340, gz+16));
+        GOUT(338, _g3_4(gx+20, gy+336, gz+20));
+        GOUT(339, _g3_4(gx+16, gy+344, gz+16));
+        GOUT(340, _g3_4(gx+16, gy+340, gz+20));
+        GOUT(341, _g3_4(gx+16, gy+336, gz+24));
+        GOUT(342, _g3_4(gx+8, gy+368, gz+0));
+        GOUT(343, _g3_4(gx+4, gy+372, gz+0));
+        GOUT(344, _g3_4(gx+4, gy+368, gz+4));
+        GOUT(345, _g2_4(gy+376, gz+0));
+        GOUT(346, _g2_4(gy+372, gz+4));
+        GOUT(347, _g2_4(gy+368, gz+8));
+        GOUT(348, _g3_4(gx+8, gy+352, gz+16));
+        GOUT(349, _g3_4(gx+4, gy+356, gz+16));
+        GOUT(350, _g3_4(gx+4, gy+352, gz+20));
+        GOUT(351, _g2_4(gy+360, gz+16));
+        GOUT(352, _g2_4(gy+356, gz+20));
+        GOUT(353, _g2_4(gy+352, gz+24));
+        GOUT(354, _g3_4(gx+8, gy+336, gz+32));
+        GOUT(355, _g3_4(gx+4, gy+340, gz+32));
+        GOUT(356, _g3_4(gx+4, gy+336, gz+36));
+        GOUT(357, _g2_4(gy+344, gz+32));
+        GOUT(358, _g2_4(gy+340, gz+36));
+        GOUT(359, _g2_4(gy+336, gz+40));
+        GOUT(360, _g3_4(gx+40, gy+288, gz+48));
+        GOUT(361, _g3_4(gx+36, gy+292, gz+48));
+        GOUT(362, _g3_4(gx+36, gy+288, gz+52));
+        GOUT(363, _g3_4(gx+32, gy+296, gz+48));
+        GOUT(364, _g3_4(gx+32, gy+292, gz+52));
+        GOUT(365, _g3_4(gx+32, gy+288, gz+56));
+        GOUT(366, _g3_4(gx+24, gy+304, gz+48));
+        GOUT(367, _g3_4(gx+20, gy+308, gz+48));
+        GOUT(368, _g3_4(gx+20, gy+304, gz+52));
+        GOUT(369, _g3_4(gx+16, gy+312, gz+48));
+        GOUT(370, _g3_4(gx+16, gy+308, gz+52));
+        GOUT(371, _g3_4(gx+16, gy+304, gz+56));
+        GOUT(372, _g3_4(gx+24, gy+288, gz+64));
+        GOUT(373, _g3_4(gx+20, gy+292, gz+64));
+        GOUT(374, _g3_4(gx+20, gy+288, gz+68));
+        GOUT(375, _g3_4(gx+16, gy+296, gz+64));
+        GOUT(376, _g3_4(gx+16, gy+292, gz+68));
+        GOUT(377, _g3_4(gx+16, gy+288, gz+72));
+        GOUT(378, _g3_4(gx+8, gy+320, gz+48));
+        GOUT(379, _g3_4(gx+4, gy+324, gz+48));
+        GOUT(380, _g3_4(gx+4, gy+320, gz+52));
+        GOUT(381, _g2_4(gy+328, gz+48));
+        GOUT(382, _g2_4(gy+324, gz+52));
+        GOUT(383, _g2_4(gy+320, gz+56));
+        GOUT(384, _g3_4(gx+8, gy+304, gz+64));
+        GOUT(385, _g3_4(gx+4, gy+308, gz+64));
+        GOUT(386, _g3_4(gx+4, gy+304, gz+68));
+        GOUT(387, _g2_4(gy+312, gz+64));
+        GOUT(388, _g2_4(gy+308, gz+68));
+        GOUT(389, _g2_4(gy+304, gz+72));
+        GOUT(390, _g3_4(gx+8, gy+288, gz+80));
+        GOUT(391, _g3_4(gx+4, gy+292, gz+80));
+        GOUT(392, _g3_4(gx+4, gy+288, gz+84));
+        GOUT(393, _g2_4(gy+296, gz+80));
+        GOUT(394, _g2_4(gy+292, gz+84));
+        GOUT(395, _g2_4(gy+288, gz+88));
+        GOUT(396, _g3_4(gx+40, gy+240, gz+96));
+        GOUT(397, _g3_4(gx+36, gy+244, gz+96));
+        GOUT(398, _g3_4(gx+36, gy+240, gz+100));
+        GOUT(399, _g3_4(gx+32, gy+248, gz+96));
+        GOUT(400, _g3_4(gx+32, gy+244, gz+100));
+        GOUT(401, _g3_4(gx+32, gy+240, gz+104));
+        GOUT(402, _g3_4(gx+24, gy+256, gz+96));
+        GOUT(403, _g3_4(gx+20, gy+260, gz+96));
+        GOUT(404, _g3_4(gx+20, gy+256, gz+100));
+        GOUT(405, _g3_4(gx+16, gy+264, gz+96));
+        GOUT(406, _g3_4(gx+16, gy+260, gz+100));
+        GOUT(407, _g3_4(gx+16, gy+256, gz+104));
+        GOUT(408, _g3_4(gx+24, gy+240, gz+112));
+        GOUT(409, _g3_4(gx+20, gy+244, gz+112));
+        GOUT(410, _g3_4(gx+20, gy+240, gz+116));
+        GOUT(411, _g3_4(gx+16, gy+248, gz+112));
+        GOUT(412, _g3_4(gx+16, gy+244, gz+116));
+        GOUT(413, _g3_4(gx+16, gy+240, gz+120));
+        GOUT(414, _g3_4(gx+8, gy+272, gz+96));
+        GOUT(415, _g3_4(gx+4, gy+276, gz+96));
+        GOUT(416, _g3_4(gx+4, gy+272, gz+100));
+        GOUT(417, _g2_4(gy+280, gz+96));
+        GOUT(418, _g2_4(gy+276, gz+100));
+        GOUT(419, _g2_4(gy+272, gz+104));
+        GOUT(420, _g3_4(gx+8, gy+256, gz+112));
+        GOUT(421, _g3_4(gx+4, gy+260, gz+112));
+        GOUT(422, _g3_4(gx+4, gy+256, gz+116));
+        GOUT(423, _g2_4(gy+264, gz+112));
+        GOUT(424, _g2_4(gy+260, gz+116));
+        GOUT(425, _g2_4(gy+256, gz+120));
+        GOUT(426, _g3_4(gx+8, gy+240, gz+128));
+        GOUT(427, _g3_4(gx+4, gy+244, gz+128));
+        GOUT(428, _g3_4(gx+4, gy+240, gz+132));
+        GOUT(429, _g2_4(gy+248, gz+128));
+        GOUT(430, _g2_4(gy+244, gz+132));
+        GOUT(431, _g2_4(gy+240, gz+136));
+        GOUT(432, _g2_4(gx+136, gz+240));
+        GOUT(433, _g3_4(gx+132, gy+4, gz+240));
+        GOUT(434, _g2_4(gx+132, gz+244));
+        GOUT(435, _g3_4(gx+128, gy+8, gz+240));
+        GOUT(436, _g3_4(gx+128, gy+4, gz+244));
+        GOUT(437, _g2_4(gx+128, gz+248));
+        GOUT(438, _g3_4(gx+120, gy+16, gz+240));
+        GOUT(439, _g3_4(gx+116, gy+20, gz+240));
+        GOUT(440, _g3_4(gx+116, gy+16, gz+244));
+        GOUT(441, _g3_4(gx+112, gy+24, gz+240));
+        GOUT(442, _g3_4(gx+112, gy+20, gz+244));
+        GOUT(443, _g3_4(gx+112, gy+16, gz+248));
+        GOUT(444, _g2_4(gx+120, gz+256));
+        GOUT(445, _g3_4(gx+116, gy+4, gz+256));
+        GOUT(446, _g2_4(gx+116, gz+260));
+        GOUT(447, _g3_4(gx+112, gy+8, gz+256));
+        GOUT(448, _g3_4(gx+112, gy+4, gz+260));
+        GOUT(449, _g2_4(gx+112, gz+264));
+        GOUT(450, _g3_4(gx+104, gy+32, gz+240));
+        GOUT(451, _g3_4(gx+100, gy+36, gz+240));
+        GOUT(452, _g3_4(gx+100, gy+32, gz+244));
+        GOUT(453, _g3_4(gx+96, gy+40, gz+240));
+        GOUT(454, _g3_4(gx+96, gy+36, gz+244));
+        GOUT(455, _g3_4(gx+96, gy+32, gz+248));
+        GOUT(456, _g3_4(gx+104, gy+16, gz+256));
+        GOUT(457, _g3_4(gx+100, gy+20, gz+256));
+        GOUT(458, _g3_4(gx+100, gy+16, gz+260));
+        GOUT(459, _g3_4(gx+96, gy+24, gz+256));
+        GOUT(460, _g3_4(gx+96, gy+20, gz+260));
+        GOUT(461, _g3_4(gx+96, gy+16, gz+264));
+        GOUT(462, _g2_4(gx+104, gz+272));
+        GOUT(463, _g3_4(gx+100, gy+4, gz+272));
+        GOUT(464, _g2_4(gx+100, gz+276));
+        GOUT(465, _g3_4(gx+96, gy+8, gz+272));
+        GOUT(466, _g3_4(gx+96, gy+4, gz+276));
+        GOUT(467, _g2_4(gx+96, gz+280));
+        GOUT(468, _g3_4(gx+88, gy+48, gz+240));
+        GOUT(469, _g3_4(gx+84, gy+52, gz+240));
+        GOUT(470, _g3_4(gx+84, gy+48, gz+244));
+        GOUT(471, _g3_4(gx+80, gy+56, gz+240));
+        GOUT(472, _g3_4(gx+80, gy+52, gz+244));
+        GOUT(473, _g3_4(gx+80, gy+48, gz+248));
+        GOUT(474, _g3_4(gx+72, gy+64, gz+240));
+        GOUT(475, _g3_4(gx+68, gy+68, gz+240));
+        GOUT(476, _g3_4(gx+68, gy+64, gz+244));
+        GOUT(477, _g3_4(gx+64, gy+72, gz+240));
+        GOUT(478, _g3_4(gx+64, gy+68, gz+244));
+        GOUT(479, _g3_4(gx+64, gy+64, gz+248));
+        GOUT(480, _g3_4(gx+72, gy+48, gz+256));
+        GOUT(481, _g3_4(gx+68, gy+52, gz+256));
+        GOUT(482, _g3_4(gx+68, gy+48, gz+260));
+        GOUT(483, _g3_4(gx+64, gy+56, gz+256));
+        GOUT(484, _g3_4(gx+64, gy+52, gz+260));
+        GOUT(485, _g3_4(gx+64, gy+48, gz+264));
+        GOUT(486, _g3_4(gx+56, gy+80, gz+240));
+        GOUT(487, _g3_4(gx+52, gy+84, gz+240));
+        GOUT(488, _g3_4(gx+52, gy+80, gz+244));
+        GOUT(489, _g3_4(gx+48, gy+88, gz+240));
+        GOUT(490, _g3_4(gx+48, gy+84, gz+244));
+        GOUT(491, _g3_4(gx+48, gy+80, gz+248));
+        GOUT(492, _g3_4(gx+56, gy+64, gz+256));
+        GOUT(493, _g3_4(gx+52, gy+68, gz+256));
+        GOUT(494, _g3_4(gx+52, gy+64, gz+260));
+        GOUT(495, _g3_4(gx+48, gy+72, gz+256));
+        GOUT(496, _g3_4(gx+48, gy+68, gz+260));
+        GOUT(497, _g3_4(gx+48, gy+64, gz+264));
+        GOUT(498, _g3_4(gx+56, gy+48, gz+272));
+        GOUT(499, _g3_4(gx+52, gy+52, gz+272));
+        GOUT(500, _g3_4(gx+52, gy+48, gz+276));
+        GOUT(501, _g3_4(gx+48, gy+56, gz+272));
+        GOUT(502, _g3_4(gx+48, gy+52, gz+276));
+        GOUT(503, _g3_4(gx+48, gy+48, gz+280));
+        GOUT(504, _g2_4(gx+88, gz+288));
+        GOUT(505, _g3_4(gx+84, gy+4, gz+288));
+        GOUT(506, _g2_4(gx+84, gz+292));
+        GOUT(507, _g3_4(gx+80, gy+8, gz+288));
+        GOUT(508, _g3_4(gx+80, gy+4, gz+292));
+        GOUT(509, _g2_4(gx+80, gz+296));
+        GOUT(510, _g3_4(gx+72, gy+16, gz+288));
+        GOUT(511, _g3_4(gx+68, gy+20, gz+288));
+        GOUT(512, _g3_4(gx+68, gy+16, gz+292));
+        GOUT(513, _g3_4(gx+64, gy+24, gz+288));
+        GOUT(514, _g3_4(gx+64, gy+20, gz+292));
+        GOUT(515, _g3_4(gx+64, gy+16, gz+296));
+        GOUT(516, _g2_4(gx+72, gz+304));
+        GOUT(517, _g3_4(gx+68, gy+4, gz+304));
+        GOUT(518, _g2_4(gx+68, gz+308));
+        GOUT(519, _g3_4(gx+64, gy+8, gz+304));
+        GOUT(520, _g3_4(gx+64, gy+4, gz+308));
+        GOUT(521, _g2_4(gx+64, gz+312));
+        GOUT(522, _g3_4(gx+56, gy+32, gz+288));
+        GOUT(523, _g3_4(gx+52, gy+36, gz+288));
+        GOUT(524, _g3_4(gx+52, gy+32, gz+292));
+        GOUT(525, _g3_4(gx+48, gy+40, gz+288));
+        GOUT(526, _g3_4(gx+48, gy+36, gz+292));
+        GOUT(527, _g3_4(gx+48, gy+32, gz+296));
+        GOUT(528, _g3_4(gx+56, gy+16, gz+304));
+        GOUT(529, _g3_4(gx+52, gy+20, gz+304));
+        GOUT(530, _g3_4(gx+52, gy+16, gz+308));
+        GOUT(531, _g3_4(gx+48, gy+24, gz+304));
+        GOUT(532, _g3_4(gx+48, gy+20, gz+308));
+        GOUT(533, _g3_4(gx+48, gy+16, gz+312));
+        GOUT(534, _g2_4(gx+56, gz+320));
+        GOUT(535, _g3_4(gx+52, gy+4, gz+320));
+        GOUT(536, _g2_4(gx+52, gz+324));
+        GOUT(537, _g3_4(gx+48, gy+8, gz+320));
+        GOUT(538, _g3_4(gx+48, gy+4, gz+324));
+        GOUT(539, _g2_4(gx+48, gz+328));
+        GOUT(540, _g3_4(gx+40, gy+96, gz+240));
+        GOUT(541, _g3_4(gx+36, gy+100, gz+240));
+        GOUT(542, _g3_4(gx+36, gy+96, gz+244));
+        GOUT(543, _g3_4(gx+32, gy+104, gz+240));
+        GOUT(544, _g3_4(gx+32, gy+100, gz+244));
+        GOUT(545, _g3_4(gx+32, gy+96, gz+248));
+        GOUT(546, _g3_4(gx+24, gy+112, gz+240));
+        GOUT(547, _g3_4(gx+20, gy+116, gz+240));
+        GOUT(548, _g3_4(gx+20, gy+112, gz+244));
+        GOUT(549, _g3_4(gx+16, gy+120, gz+240));
+        GOUT(550, _g3_4(gx+16, gy+116, gz+244));
+        GOUT(551, _g3_4(gx+16, gy+112, gz+248));
+        GOUT(552, _g3_4(gx+24, gy+96, gz+256));
+        GOUT(553, _g3_4(gx+20, gy+100, gz+256));
+        GOUT(554, _g3_4(gx+20, gy+96, gz+260));
+        GOUT(555, _g3_4(gx+16, gy+104, gz+256));
+        GOUT(556, _g3_4(gx+16, gy+100, gz+260));
+        GOUT(557, _g3_4(gx+16, gy+96, gz+264));
+        GOUT(558, _g3_4(gx+8, gy+128, gz+240));
+        GOUT(559, _g3_4(gx+4, gy+132, gz+240));
+        GOUT(560, _g3_4(gx+4, gy+128, gz+244));
+        GOUT(561, _g2_4(gy+136, gz+240));
+        GOUT(562, _g2_4(gy+132, gz+244));
+        GOUT(563, _g2_4(gy+128, gz+248));
+        GOUT(564, _g3_4(gx+8, gy+112, gz+256));
+        GOUT(565, _g3_4(gx+4, gy+116, gz+256));
+        GOUT(566, _g3_4(gx+4, gy+112, gz+260));
+        GOUT(567, _g2_4(gy+120, gz+256));
+        GOUT(568, _g2_4(gy+116, gz+260));
+        GOUT(569, _g2_4(gy+112, gz+264));
+        GOUT(570, _g3_4(gx+8, gy+96, gz+272));
+        GOUT(571, _g3_4(gx+4, gy+100, gz+272));
+        GOUT(572, _g3_4(gx+4, gy+96, gz+276));
+        GOUT(573, _g2_4(gy+104, gz+272));
+        GOUT(574, _g2_4(gy+100, gz+276));
+        GOUT(575, _g2_4(gy+96, gz+280));
+        GOUT(576, _g3_4(gx+40, gy+48, gz+288));
+        GOUT(577, _g3_4(gx+36, gy+52, gz+288));
+        GOUT(578, _g3_4(gx+36, gy+48, gz+292));
+        GOUT(579, _g3_4(gx+32, gy+56, gz+288));
+        GOUT(580, _g3_4(gx+32, gy+52, gz+292));
+        GOUT(581, _g3_4(gx+32, gy+48, gz+296));
+        GOUT(582, _g3_4(gx+24, gy+64, gz+288));
+        GOUT(583, _g3_4(gx+20, gy+68, gz+288));
+        GOUT(584, _g3_4(gx+20, gy+64, gz+292));
+        GOUT(585, _g3_4(gx+16, gy+72, gz+288));
+        GOUT(586, _g3_4(gx+16, gy+68, gz+292));
+        GOUT(587, _g3_4(gx+16, gy+64, gz+296));
+        GOUT(588, _g3_4(gx+24, gy+48, gz+304));
+        GOUT(589, _g3_4(gx+20, gy+52, gz+304));
+        GOUT(590, _g3_4(gx+20, gy+48, gz+308));
+        GOUT(591, _g3_4(gx+16, gy+56, gz+304));
+        GOUT(592, _g3_4(gx+16, gy+52, gz+308));
+        GOUT(593, _g3_4(gx+16, gy+48, gz+312));
+        GOUT(594, _g3_4(gx+8, gy+80, gz+288));
+        GOUT(595, _g3_4(gx+4, gy+84, gz+288));
+        GOUT(596, _g3_4(gx+4, gy+80, gz+292));
+        GOUT(597, _g2_4(gy+88, gz+288));
+        GOUT(598, _g2_4(gy+84, gz+292));
+        GOUT(599, _g2_4(gy+80, gz+296));
+        GOUT(600, _g3_4(gx+8, gy+64, gz+304));
+        GOUT(601, _g3_4(gx+4, gy+68, gz+304));
+        GOUT(602, _g3_4(gx+4, gy+64, gz+308));
+        GOUT(603, _g2_4(gy+72, gz+304));
+        GOUT(604, _g2_4(gy+68, gz+308));
+        GOUT(605, _g2_4(gy+64, gz+312));
+        GOUT(606, _g3_4(gx+8, gy+48, gz+320));
+        GOUT(607, _g3_4(gx+4, gy+52, gz+320));
+        GOUT(608, _g3_4(gx+4, gy+48, gz+324));
+        GOUT(609, _g2_4(gy+56, gz+320));
+        GOUT(610, _g2_4(gy+52, gz+324));
+        GOUT(611, _g2_4(gy+48, gz+328));
+        GOUT(612, _g2_4(gx+40, gz+336));
+        GOUT(613, _g3_4(gx+36, gy+4, gz+336));
+        GOUT(614, _g2_4(gx+36, gz+340));
+        GOUT(615, _g3_4(gx+32, gy+8, gz+336));
+        GOUT(616, _g3_4(gx+32, gy+4, gz+340));
+        GOUT(617, _g2_4(gx+32, gz+344));
+        GOUT(618, _g3_4(gx+24, gy+16, gz+336));
+        GOUT(619, _g3_4(gx+20, gy+20, gz+336));
+        GOUT(620, _g3_4(gx+20, gy+16, gz+340));
+        GOUT(621, _g3_4(gx+16, gy+24, gz+336));
+        GOUT(622, _g3_4(gx+16, gy+20, gz+340));
+        GOUT(623, _g3_4(gx+16, gy+16, gz+344));
+        GOUT(624, _g2_4(gx+24, gz+352));
+        GOUT(625, _g3_4(gx+20, gy+4, gz+352));
+        GOUT(626, _g2_4(gx+20, gz+356));
+        GOUT(627, _g3_4(gx+16, gy+8, gz+352));
+        GOUT(628, _g3_4(gx+16, gy+4, gz+356));
+        GOUT(629, _g2_4(gx+16, gz+360));
+        GOUT(630, _g3_4(gx+8, gy+32, gz+336));
+        GOUT(631, _g3_4(gx+4, gy+36, gz+336));
+        GOUT(632, _g3_4(gx+4, gy+32, gz+340));
+        GOUT(633, _g2_4(gy+40, gz+336));
+        GOUT(634, _g2_4(gy+36, gz+340));
+        GOUT(635, _g2_4(gy+32, gz+344));
+        GOUT(636, _g3_4(gx+8, gy+16, gz+352));
+        GOUT(637, _g3_4(gx+4, gy+20, gz+352));
+        GOUT(638, _g3_4(gx+4, gy+16, gz+356));
+        GOUT(639, _g2_4(gy+24, gz+352));
+        GOUT(640, _g2_4(gy+20, gz+356));
+        GOUT(641, _g2_4(gy+16, gz+360));
+        GOUT(642, _g2_4(gx+8, gz+368));
+        GOUT(643, _g3_4(gx+4, gy+4, gz+368));
+        GOUT(644, _g2_4(gx+4, gz+372));
+        GOUT(645, _g2_4(gy+8, gz+368));
+        GOUT(646, _g2_4(gy+4, gz+372));
+        GOUT(647, _g1_4(gz+376));
+}
+
+static void _g0_2d4d_2200(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 45;
+        double *gz = g + 90;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double b10 = bc->b10[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+9] = c00x;
+                gx[n+3] = rx + gx[n+9];
+                gx[n+18] = c00x * gx[n+9] + b10;
+                gx[n+12] = rx * gx[n+9] + gx[n+18];
+                gx[n+6] = rx * gx[n+3] + gx[n+12];
+                gx[n+27] = c00x * gx[n+18] + 2 * b10 * gx[n+9];
+                gx[n+21] = rx * gx[n+18] + gx[n+27];
+                gx[n+15] = rx * gx[n+12] + gx[n+21];
+                gx[n+36] = c00x * gx[n+27] + 3 * b10 * gx[n+18];
+                gx[n+30] = rx * gx[n+27] + gx[n+36];
+                gx[n+24] = rx * gx[n+21] + gx[n+30];
+                gy[n+9] = c00y;
+                gy[n+3] = ry + gy[n+9];
+                gy[n+18] = c00y * gy[n+9] + b10;
+                gy[n+12] = ry * gy[n+9] + gy[n+18];
+                gy[n+6] = ry * gy[n+3] + gy[n+12];
+                gy[n+27] = c00y * gy[n+18] + 2 * b10 * gy[n+9];
+                gy[n+21] = ry * gy[n+18] + gy[n+27];
+                gy[n+15] = ry * gy[n+12] + gy[n+21];
+                gy[n+36] = c00y * gy[n+27] + 3 * b10 * gy[n+18];
+                gy[n+30] = ry * gy[n+27] + gy[n+36];
+                gy[n+24] = ry * gy[n+21] + gy[n+30];
+                gz[n+9] = c00z * gz[n+0];
+                gz[n+3] = rz * gz[n+0] + gz[n+9];
+                gz[n+18] = c00z * gz[n+9] + b10 * gz[n+0];
+                gz[n+12] = rz * gz[n+9] + gz[n+18];
+                gz[n+6] = rz * gz[n+3] + gz[n+12];
+                gz[n+27] = c00z * gz[n+18] + 2 * b10 * gz[n+9];
+                gz[n+21] = rz * gz[n+18] + gz[n+27];
+                gz[n+15] = rz * gz[n+12] + gz[n+21];
+                gz[n+36] = c00z * gz[n+27] + 3 * b10 * gz[n+18];
+                gz[n+30] = rz * gz[n+27] + gz[n+36];
+                gz[n+24] = rz * gz[n+21] + gz[n+30];
+        }
+}
+static void _gout_2200(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 45;
+        double *gz = g + 90;
+        GOUT(0, _g2_3(gx+24, gz+0));
+        GOUT(1, _g3_3(gx+21, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+21, gz+3));
+        GOUT(3, _g3_3(gx+18, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+18, gy+3, gz+3));
+        GOUT(5, _g2_3(gx+18, gz+6));
+        GOUT(6, _g3_3(gx+15, gy+9, gz+0));
+        GOUT(7, _g3_3(gx+12, gy+12, gz+0));
+        GOUT(8, _g3_3(gx+12, gy+9, gz+3));
+        GOUT(9, _g3_3(gx+9, gy+15, gz+0));
+        GOUT(10, _g3_3(gx+9, gy+12, gz+3));
+        GOUT(11, _g3_3(gx+9, gy+9, gz+6));
+        GOUT(12, _g2_3(gx+15, gz+9));
+        GOUT(13, _g3_3(gx+12, gy+3, gz+9));
+        GOUT(14, _g2_3(gx+12, gz+12));
+        GOUT(15, _g3_3(gx+9, gy+6, gz+9));
+        GOUT(16, _g3_3(gx+9, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+9, gz+15));
+        GOUT(18, _g3_3(gx+6, gy+18, gz+0));
+        GOUT(19, _g3_3(gx+3, gy+21, gz+0));
+        GOUT(20, _g3_3(gx+3, gy+18, gz+3));
+        GOUT(21, _g2_3(gy+24, gz+0));
+        GOUT(22, _g2_3(gy+21, gz+3));
+        GOUT(23, _g2_3(gy+18, gz+6));
+        GOUT(24, _g3_3(gx+6, gy+9, gz+9));
+        GOUT(25, _g3_3(gx+3, gy+12, gz+9));
+        GOUT(26, _g3_3(gx+3, gy+9, gz+12));
+        GOUT(27, _g2_3(gy+15, gz+9));
+        GOUT(28, _g2_3(gy+12, gz+12));
+        GOUT(29, _g2_3(gy+9, gz+15));
+        GOUT(30, _g2_3(gx+6, gz+18));
+        GOUT(31, _g3_3(gx+3, gy+3, gz+18));
+        GOUT(32, _g2_3(gx+3, gz+21));
+        GOUT(33, _g2_3(gy+6, gz+18));
+        GOUT(34, _g2_3(gy+3, gz+21));
+        GOUT(35, _g1_3(gz+24));
+}
+
+static void _g0_2d4d_2201(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 90;
+        double *gz = g + 180;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+18] = c00x;
+                gx[n+3] = rx + gx[n+18];
+                gx[n+36] = c00x * gx[n+18] + b10;
+                gx[n+21] = rx * gx[n+18] + gx[n+36];
+                gx[n+6] = rx * gx[n+3] + gx[n+21];
+                gx[n+9] = c0px;
+                gx[n+27] = c00x * gx[n+9] + b00;
+                gx[n+12] = rx * gx[n+9] + gx[n+27];
+                gx[n+45] = c00x * gx[n+27] + b10 * gx[n+9] + b00 * gx[n+18];
+                gx[n+30] = rx * gx[n+27] + gx[n+45];
+                gx[n+15] = rx * gx[n+12] + gx[n+30];
+                gx[n+54] = c00x * gx[n+36] + 2 * b10 * gx[n+18];
+                gx[n+39] = rx * gx[n+36] + gx[n+54];
+                gx[n+24] = rx * gx[n+21] + gx[n+39];
+                gx[n+63] = c00x * gx[n+45] + 2 * b10 * gx[n+27] + b00 * gx[n+36];
+                gx[n+48] = rx * gx[n+45] + gx[n+63];
+                gx[n+33] = rx * gx[n+30] + gx[n+48];
+                gx[n+72] = c00x * gx[n+54] + 3 * b10 * gx[n+36];
+                gx[n+57] = rx * gx[n+54] + gx[n+72];
+                gx[n+42] = rx * gx[n+39] + gx[n+57];
+                gx[n+81] = c00x * gx[n+63] + 3 * b10 * gx[n+45] + b00 * gx[n+54];
+                gx[n+66] = rx * gx[n+63] + gx[n+81];
+                gx[n+51] = rx * gx[n+48] + gx[n+66];
+                gy[n+18] = c00y;
+                gy[n+3] = ry + gy[n+18];
+                gy[n+36] = c00y * gy[n+18] + b10;
+                gy[n+21] = ry * gy[n+18] + gy[n+36];
+                gy[n+6] = ry * gy[n+3] + gy[n+21];
+                gy[n+9] = c0py;
+                gy[n+27] = c00y * gy[n+9] + b00;
+                gy[n+12] = ry * gy[n+9] + gy[n+27];
+                gy[n+45] = c00y * gy[n+27] + b10 * gy[n+9] + b00 * gy[n+18];
+                gy[n+30] = ry * gy[n+27] + gy[n+45];
+                gy[n+15] = ry * gy[n+12] + gy[n+30];
+                gy[n+54] = c00y * gy[n+36] + 2 * b10 * gy[n+18];
+                gy[n+39] = ry * gy[n+36] + gy[n+54];
+                gy[n+24] = ry * gy[n+21] + gy[n+39];
+                gy[n+63] = c00y * gy[n+45] + 2 * b10 * gy[n+27] + b00 * gy[n+36];
+                gy[n+48] = ry * gy[n+45] + gy[n+63];
+                gy[n+33] = ry * gy[n+30] + gy[n+48];
+                gy[n+72] = c00y * gy[n+54] + 3 * b10 * gy[n+36];
+                gy[n+57] = ry * gy[n+54] + gy[n+72];
+                gy[n+42] = ry * gy[n+39] + gy[n+57];
+                gy[n+81] = c00y * gy[n+63] + 3 * b10 * gy[n+45] + b00 * gy[n+54];
+                gy[n+66] = ry * gy[n+63] + gy[n+81];
+                gy[n+51] = ry * gy[n+48] + gy[n+66];
+                gz[n+18] = c00z * gz[n+0];
+                gz[n+3] = rz * gz[n+0] + gz[n+18];
+                gz[n+36] = c00z * gz[n+18] + b10 * gz[n+0];
+                gz[n+21] = rz * gz[n+18] + gz[n+36];
+                gz[n+6] = rz * gz[n+3] + gz[n+21];
+                gz[n+9] = c0pz * gz[n+0];
+                gz[n+27] = c00z * gz[n+9] + b00 * gz[n+0];
+                gz[n+12] = rz * gz[n+9] + gz[n+27];
+                gz[n+45] = c00z * gz[n+27] + b10 * gz[n+9] + b00 * gz[n+18];
+                gz[n+30] = rz * gz[n+27] + gz[n+45];
+                gz[n+15] = rz * gz[n+12] + gz[n+30];
+                gz[n+54] = c00z * gz[n+36] + 2 * b10 * gz[n+18];
+                gz[n+39] = rz * gz[n+36] + gz[n+54];
+                gz[n+24] = rz * gz[n+21] + gz[n+39];
+                gz[n+63] = c00z * gz[n+45] + 2 * b10 * gz[n+27] + b00 * gz[n+36];
+                gz[n+48] = rz * gz[n+45] + gz[n+63];
+                gz[n+33] = rz * gz[n+30] + gz[n+48];
+                gz[n+72] = c00z * gz[n+54] + 3 * b10 * gz[n+36];
+                gz[n+57] = rz * gz[n+54] + gz[n+72];
+                gz[n+42] = rz * gz[n+39] + gz[n+57];
+                gz[n+81] = c00z * gz[n+63] + 3 * b10 * gz[n+45] + b00 * gz[n+54];
+                gz[n+66] = rz * gz[n+63] + gz[n+81];
+                gz[n+51] = rz * gz[n+48] + gz[n+66];
+        }
+}
+static void _gout_2201(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 90;
+        double *gz = g + 180;
+        GOUT(0, _g2_3(gx+51, gz+0));
+        GOUT(1, _g3_3(gx+48, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+48, gz+3));
+        GOUT(3, _g3_3(gx+45, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+45, gy+3, gz+3));
+        GOUT(5, _g2_3(gx+45, gz+6));
+        GOUT(6, _g3_3(gx+42, gy+9, gz+0));
+        GOUT(7, _g3_3(gx+39, gy+12, gz+0));
+        GOUT(8, _g3_3(gx+39, gy+9, gz+3));
+        GOUT(9, _g3_3(gx+36, gy+15, gz+0));
+        GOUT(10, _g3_3(gx+36, gy+12, gz+3));
+        GOUT(11, _g3_3(gx+36, gy+9, gz+6));
+        GOUT(12, _g2_3(gx+42, gz+9));
+        GOUT(13, _g3_3(gx+39, gy+3, gz+9));
+        GOUT(14, _g2_3(gx+39, gz+12));
+        GOUT(15, _g3_3(gx+36, gy+6, gz+9));
+        GOUT(16, _g3_3(gx+36, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+36, gz+15));
+        GOUT(18, _g3_3(gx+33, gy+18, gz+0));
+        GOUT(19, _g3_3(gx+30, gy+21, gz+0));
+        GOUT(20, _g3_3(gx+30, gy+18, gz+3));
+        GOUT(21, _g3_3(gx+27, gy+24, gz+0));
+        GOUT(22, _g3_3(gx+27, gy+21, gz+3));
+        GOUT(23, _g3_3(gx+27, gy+18, gz+6));
+        GOUT(24, _g3_3(gx+24, gy+27, gz+0));
+        GOUT(25, _g3_3(gx+21, gy+30, gz+0));
+        GOUT(26, _g3_3(gx+21, gy+27, gz+3));
+        GOUT(27, _g3_3(gx+18, gy+33, gz+0));
+        GOUT(28, _g3_3(gx+18, gy+30, gz+3));
+        GOUT(29, _g3_3(gx+18, gy+27, gz+6));
+        GOUT(30, _g3_3(gx+24, gy+18, gz+9));
+        GOUT(31, _g3_3(gx+21, gy+21, gz+9));
+        GOUT(32, _g3_3(gx+21, gy+18, gz+12));
+        GOUT(33, _g3_3(gx+18, gy+24, gz+9));
+        GOUT(34, _g3_3(gx+18, gy+21, gz+12));
+        GOUT(35, _g3_3(gx+18, gy+18, gz+15));
+        GOUT(36, _g2_3(gx+33, gz+18));
+        GOUT(37, _g3_3(gx+30, gy+3, gz+18));
+        GOUT(38, _g2_3(gx+30, gz+21));
+        GOUT(39, _g3_3(gx+27, gy+6, gz+18));
+        GOUT(40, _g3_3(gx+27, gy+3, gz+21));
+        GOUT(41, _g2_3(gx+27, gz+24));
+        GOUT(42, _g3_3(gx+24, gy+9, gz+18));
+        GOUT(43, _g3_3(gx+21, gy+12, gz+18));
+        GOUT(44, _g3_3(gx+21, gy+9, gz+21));
+        GOUT(45, _g3_3(gx+18, gy+15, gz+18));
+        GOUT(46, _g3_3(gx+18, gy+12, gz+21));
+        GOUT(47, _g3_3(gx+18, gy+9, gz+24));
+        GOUT(48, _g2_3(gx+24, gz+27));
+        GOUT(49, _g3_3(gx+21, gy+3, gz+27));
+        GOUT(50, _g2_3(gx+21, gz+30));
+        GOUT(51, _g3_3(gx+18, gy+6, gz+27));
+        GOUT(52, _g3_3(gx+18, gy+3, gz+30));
+        GOUT(53, _g2_3(gx+18, gz+33));
+        GOUT(54, _g3_3(gx+15, gy+36, gz+0));
+        GOUT(55, _g3_3(gx+12, gy+39, gz+0));
+        GOUT(56, _g3_3(gx+12, gy+36, gz+3));
+        GOUT(57, _g3_3(gx+9, gy+42, gz+0));
+        GOUT(58, _g3_3(gx+9, gy+39, gz+3));
+        GOUT(59, _g3_3(gx+9, gy+36, gz+6));
+        GOUT(60, _g3_3(gx+6, gy+45, gz+0));
+        GOUT(61, _g3_3(gx+3, gy+48, gz+0));
+        GOUT(62, _g3_3(gx+3, gy+45, gz+3));
+        GOUT(63, _g2_3(gy+51, gz+0));
+        GOUT(64, _g2_3(gy+48, gz+3));
+        GOUT(65, _g2_3(gy+45, gz+6));
+        GOUT(66, _g3_3(gx+6, gy+36, gz+9));
+        GOUT(67, _g3_3(gx+3, gy+39, gz+9));
+        GOUT(68, _g3_3(gx+3, gy+36, gz+12));
+        GOUT(69, _g2_3(gy+42, gz+9));
+        GOUT(70, _g2_3(gy+39, gz+12));
+        GOUT(71, _g2_3(gy+36, gz+15));
+        GOUT(72, _g3_3(gx+15, gy+18, gz+18));
+        GOUT(73, _g3_3(gx+12, gy+21, gz+18));
+        GOUT(74, _g3_3(gx+12, gy+18, gz+21));
+        GOUT(75, _g3_3(gx+9, gy+24, gz+18));
+        GOUT(76, _g3_3(gx+9, gy+21, gz+21));
+        GOUT(77, _g3_3(gx+9, gy+18, gz+24));
+        GOUT(78, _g3_3(gx+6, gy+27, gz+18));
+        GOUT(79, _g3_3(gx+3, gy+30, gz+18));
+        GOUT(80, _g3_3(gx+3, gy+27, gz+21));
+        GOUT(81, _g2_3(gy+33, gz+18));
+        GOUT(82, _g2_3(gy+30, gz+21));
+        GOUT(83, _g2_3(gy+27, gz+24));
+        GOUT(84, _g3_3(gx+6, gy+18, gz+27));
+        GOUT(85, _g3_3(gx+3, gy+21, gz+27));
+        GOUT(86, _g3_3(gx+3, gy+18, gz+30));
+        GOUT(87, _g2_3(gy+24, gz+27));
+        GOUT(88, _g2_3(gy+21, gz+30));
+        GOUT(89, _g2_3(gy+18, gz+33));
+        GOUT(90, _g2_3(gx+15, gz+36));
+        GOUT(91, _g3_3(gx+12, gy+3, gz+36));
+        GOUT(92, _g2_3(gx+12, gz+39));
+        GOUT(93, _g3_3(gx+9, gy+6, gz+36));
+        GOUT(94, _g3_3(gx+9, gy+3, gz+39));
+        GOUT(95, _g2_3(gx+9, gz+42));
+        GOUT(96, _g3_3(gx+6, gy+9, gz+36));
+        GOUT(97, _g3_3(gx+3, gy+12, gz+36));
+        GOUT(98, _g3_3(gx+3, gy+9, gz+39));
+        GOUT(99, _g2_3(gy+15, gz+36));
+        GOUT(100, _g2_3(gy+12, gz+39));
+        GOUT(101, _g2_3(gy+9, gz+42));
+        GOUT(102, _g2_3(gx+6, gz+45));
+        GOUT(103, _g3_3(gx+3, gy+3, gz+45));
+        GOUT(104, _g2_3(gx+3, gz+48));
+        GOUT(105, _g2_3(gy+6, gz+45));
+        GOUT(106, _g2_3(gy+3, gz+48));
+        GOUT(107, _g1_3(gz+51));
+}
+
+static void _g0_2d4d_2202(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 180;
+        double *gz = g + 360;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        FINT n;
+        for (n = 0; n < 4; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+36] = c00x;
+                gx[n+4] = rx + gx[n+36];
+                gx[n+72] = c00x * gx[n+36] + b10;
+                gx[n+40] = rx * gx[n+36] + gx[n+72];
+                gx[n+8] = rx * gx[n+4] + gx[n+40];
+                gx[n+12] = c0px;
+                gx[n+48] = c00x * gx[n+12] + b00;
+                gx[n+16] = rx * gx[n+12] + gx[n+48];
+                gx[n+84] = c00x * gx[n+48] + b10 * gx[n+12] + b00 * gx[n+36];
+                gx[n+52] = rx * gx[n+48] + gx[n+84];
+                gx[n+20] = rx * gx[n+16] + gx[n+52];
+                gx[n+24] = c0px * gx[n+12] + b01;
+                gx[n+60] = c00x * gx[n+24] + 2 * b00 * gx[n+12];
+                gx[n+28] = rx * gx[n+24] + gx[n+60];
+                gx[n+96] = c00x * gx[n+60] + b10 * gx[n+24] + 2 * b00 * gx[n+48];
+                gx[n+64] = rx * gx[n+60] + gx[n+96];
+                gx[n+32] = rx * gx[n+28] + gx[n+64];
+                gx[n+108] = c00x * gx[n+72] + 2 * b10 * gx[n+36];
+                gx[n+76] = rx * gx[n+72] + gx[n+108];
+                gx[n+44] = rx * gx[n+40] + gx[n+76];
+                gx[n+120] = c00x * gx[n+84] + 2 * b10 * gx[n+48] + b00 * gx[n+72];
+                gx[n+88] = rx * gx[n+84] + gx[n+120];
+                gx[n+56] = rx * gx[n+52] + gx[n+88];
+                gx[n+132] = c00x * gx[n+96] + 2 * b10 * gx[n+60] + 2 * b00 * gx[n+84];
+                gx[n+100] = rx * gx[n+96] + gx[n+132];
+                gx[n+68] = rx * gx[n+64] + gx[n+100];
+                gx[n+144] = c00x * gx[n+108] + 3 * b10 * gx[n+72];
+                gx[n+112] = rx * gx[n+108] + gx[n+144];
+                gx[n+80] = rx * gx[n+76] + gx[n+112];
+                gx[n+156] = c00x * gx[n+120] + 3 * b10 * gx[n+84] + b00 * gx[n+108];
+                gx[n+124] = rx * gx[n+120] + gx[n+156];
+                gx[n+92] = rx * gx[n+88] + gx[n+124];
+                gx[n+168] = c00x * gx[n+132] + 3 * b10 * gx[n+96] + 2 * b00 * gx[n+120];
+                gx[n+136] = rx * gx[n+132] + gx[n+168];
+                gx[n+104] = rx * gx[n+100] + gx[n+136];
+                gy[n+36] = c00y;
+                gy[n+4] = ry + gy[n+36];
+                gy[n+72] = c00y * gy[n+36] + b10;
+                gy[n+40] = ry * gy[n+36] + gy[n+72];
+                gy[n+8] = ry * gy[n+4] + gy[n+40];
+                gy[n+12] = c0py;
+                gy[n+48] = c00y * gy[n+12] + b00;
+                gy[n+16] = ry * gy[n+12] + gy[n+48];
+                gy[n+84] = c00y * gy[n+48] + b10 * gy[n+12] + b00 * gy[n+36];
+                gy[n+52] = ry * gy[n+48] + gy[n+84];
+                gy[n+20] = ry * gy[n+16] + gy[n+52];
+                gy[n+24] = c0py * gy[n+12] + b01;
+                gy[n+60] = c00y * gy[n+24] + 2 * b00 * gy[n+12];
+                gy[n+28] = ry * gy[n+24] + gy[n+60];
+                gy[n+96] = c00y * gy[n+60] + b10 * gy[n+24] + 2 * b00 * gy[n+48];
+                gy[n+64] = ry * gy[n+60] + gy[n+96];
+                gy[n+32] = ry * gy[n+28] + gy[n+64];
+                gy[n+108] = c00y * gy[n+72] + 2 * b10 * gy[n+36];
+                gy[n+76] = ry * gy[n+72] + gy[n+108];
+                gy[n+44] = ry * gy[n+40] + gy[n+76];
+                gy[n+120] = c00y * gy[n+84] + 2 * b10 * gy[n+48] + b00 * gy[n+72];
+                gy[n+88] = ry * gy[n+84] + gy[n+120];
+                gy[n+56] = ry * gy[n+52] + gy[n+88];
+                gy[n+132] = c00y * gy[n+96] + 2 * b10 * gy[n+60] + 2 * b00 * gy[n+84];
+                gy[n+100] = ry * gy[n+96] + gy[n+132];
+                gy[n+68] = ry * gy[n+64] + gy[n+100];
+                gy[n+144] = c00y * gy[n+108] + 3 * b10 * gy[n+72];
+                gy[n+112] = ry * gy[n+108] + gy[n+144];
+                gy[n+80] = ry * gy[n+76] + gy[n+112];
+                gy[n+156] = c00y * gy[n+120] + 3 * b10 * gy[n+84] + b00 * gy[n+108];
+                gy[n+124] = ry * gy[n+120] + gy[n+156];
+                gy[n+92] = ry * gy[n+88] + gy[n+124];
+                gy[n+168] = c00y * gy[n+132] + 3 * b10 * gy[n+96] + 2 * b00 * gy[n+120];
+                gy[n+136] = ry * gy[n+132] + gy[n+168];
+                gy[n+104] = ry * gy[n+100] + gy[n+136];
+                gz[n+36] = c00z * gz[n+0];
+                gz[n+4] = rz * gz[n+0] + gz[n+36];
+                gz[n+72] = c00z * gz[n+36] + b10 * gz[n+0];
+                gz[n+40] = rz * gz[n+36] + gz[n+72];
+                gz[n+8] = rz * gz[n+4] + gz[n+40];
+                gz[n+12] = c0pz * gz[n+0];
+                gz[n+48] = c00z * gz[n+12] + b00 * gz[n+0];
+                gz[n+16] = rz * gz[n+12] + gz[n+48];
+                gz[n+84] = c00z * gz[n+48] + b10 * gz[n+12] + b00 * gz[n+36];
+                gz[n+52] = rz * gz[n+48] + gz[n+84];
+                gz[n+20] = rz * gz[n+16] + gz[n+52];
+                gz[n+24] = c0pz * gz[n+12] + b01 * gz[n+0];
+                gz[n+60] = c00z * gz[n+24] + 2 * b00 * gz[n+12];
+                gz[n+28] = rz * gz[n+24] + gz[n+60];
+                gz[n+96] = c00z * gz[n+60] + b10 * gz[n+24] + 2 * b00 * gz[n+48];
+                gz[n+64] = rz * gz[n+60] + gz[n+96];
+                gz[n+32] = rz * gz[n+28] + gz[n+64];
+                gz[n+108] = c00z * gz[n+72] + 2 * b10 * gz[n+36];
+                gz[n+76] = rz * gz[n+72] + gz[n+108];
+                gz[n+44] = rz * gz[n+40] + gz[n+76];
+                gz[n+120] = c00z * gz[n+84] + 2 * b10 * gz[n+48] + b00 * gz[n+72];
+                gz[n+88] = rz * gz[n+84] + gz[n+120];
+                gz[n+56] = rz * gz[n+52] + gz[n+88];
+                gz[n+132] = c00z * gz[n+96] + 2 * b10 * gz[n+60] + 2 * b00 * gz[n+84];
+                gz[n+100] = rz * gz[n+96] + gz[n+132];
+                gz[n+68] = rz * gz[n+64] + gz[n+100];
+                gz[n+144] = c00z * gz[n+108] + 3 * b10 * gz[n+72];
+                gz[n+112] = rz * gz[n+108] + gz[n+144];
+                gz[n+80] = rz * gz[n+76] + gz[n+112];
+                gz[n+156] = c00z * gz[n+120] + 3 * b10 * gz[n+84] + b00 * gz[n+108];
+                gz[n+124] = rz * gz[n+120] + gz[n+156];
+                gz[n+92] = rz * gz[n+88] + gz[n+124];
+                gz[n+168] = c00z * gz[n+132] + 3 * b10 * gz[n+96] + 2 * b00 * gz[n+120];
+                gz[n+136] = rz * gz[n+132] + gz[n+168];
+                gz[n+104] = rz * gz[n+100] + gz[n+136];
+        }
+}
+static void _gout_2202(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 180;
+        double *gz = g + 360;
+        GOUT(0, _g2_4(gx+104, gz+0));
+        GOUT(1, _g3_4(gx+100, gy+4, gz+0));
+        GOUT(2, _g2_4(gx+100, gz+4));
+        GOUT(3, _g3_4(gx+96, gy+8, gz+0));
+        GOUT(4, _g3_4(gx+96, gy+4, gz+4));
+        GOUT(5, _g2_4(gx+96, gz+8));
+        GOUT(6, _g3_4(gx+92, gy+12, gz+0));
+        GOUT(7, _g3_4(gx+88, gy+16, gz+0));
+        GOUT(8, _g3_4(gx+88, gy+12, gz+4));
+        GOUT(9, _g3_4(gx+84, gy+20, gz+0));
+        GOUT(10, _g3_4(gx+84, gy+16, gz+4));
+        GOUT(11, _g3_4(gx+84, gy+12, gz+8));
+        GOUT(12, _g2_4(gx+92, gz+12));
+        GOUT(13, _g3_4(gx+88, gy+4, gz+12));
+        GOUT(14, _g2_4(gx+88, gz+16));
+        GOUT(15, _g3_4(gx+84, gy+8, gz+12));
+        GOUT(16, _g3_4(gx+84, gy+4, gz+16));
+        GOUT(17, _g2_4(gx+84, gz+20));
+        GOUT(18, _g3_4(gx+80, gy+24, gz+0));
+        GOUT(19, _g3_4(gx+76, gy+28, gz+0));
+        GOUT(20, _g3_4(gx+76, gy+24, gz+4));
+        GOUT(21, _g3_4(gx+72, gy+32, gz+0));
+        GOUT(22, _g3_4(gx+72, gy+28, gz+4));
+        GOUT(23, _g3_4(gx+72, gy+24, gz+8));
+        GOUT(24, _g3_4(gx+80, gy+12, gz+12));
+        GOUT(25, _g3_4(gx+76, gy+16, gz+12));
+        GOUT(26, _g3_4(gx+76, gy+12, gz+16));
+        GOUT(27, _g3_4(gx+72, gy+20, gz+12));
+        GOUT(28, _g3_4(gx+72, gy+16, gz+16));
+        GOUT(29, _g3_4(gx+72, gy+12, gz+20));
+        GOUT(30, _g2_4(gx+80, gz+24));
+        GOUT(31, _g3_4(gx+76, gy+4, gz+24));
+        GOUT(32, _g2_4(gx+76, gz+28));
+        GOUT(33, _g3_4(gx+72, gy+8, gz+24));
+        GOUT(34, _g3_4(gx+72, gy+4, gz+28));
+        GOUT(35, _g2_4(gx+72, gz+32));
+        GOUT(36, _g3_4(gx+68, gy+36, gz+0));
+        GOUT(37, _g3_4(gx+64, gy+40, gz+0));
+        GOUT(38, _g3_4(gx+64, gy+36, gz+4));
+        GOUT(39, _g3_4(gx+60, gy+44, gz+0));
+        GOUT(40, _g3_4(gx+60, gy+40, gz+4));
+        GOUT(41, _g3_4(gx+60, gy+36, gz+8));
+        GOUT(42, _g3_4(gx+56, gy+48, gz+0));
+        GOUT(43, _g3_4(gx+52, gy+52, gz+0));
+        GOUT(44, _g3_4(gx+52, gy+48, gz+4));
+        GOUT(45, _g3_4(gx+48, gy+56, gz+0));
+        GOUT(46, _g3_4(gx+48, gy+52, gz+4));
+        GOUT(47, _g3_4(gx+48, gy+48, gz+8));
+        GOUT(48, _g3_4(gx+56, gy+36, gz+12));
+        GOUT(49, _g3_4(gx+52, gy+40, gz+12));
+        GOUT(50, _g3_4(gx+52, gy+36, gz+16));
+        GOUT(51, _g3_4(gx+48, gy+44, gz+12));
+        GOUT(52, _g3_4(gx+48, gy+40, gz+16));
+        GOUT(53, _g3_4(gx+48, gy+36, gz+20));
+        GOUT(54, _g3_4(gx+44, gy+60, gz+0));
+        GOUT(55, _g3_4(gx+40, gy+64, gz+0));
+        GOUT(56, _g3_4(gx+40, gy+60, gz+4));
+        GOUT(57, _g3_4(gx+36, gy+68, gz+0));
+        GOUT(58, _g3_4(gx+36, gy+64, gz+4));
+        GOUT(59, _g3_4(gx+36, gy+60, gz+8));
+        GOUT(60, _g3_4(gx+44, gy+48, gz+12));
+        GOUT(61, _g3_4(gx+40, gy+52, gz+12));
+        GOUT(62, _g3_4(gx+40, gy+48, gz+16));
+        GOUT(63, _g3_4(gx+36, gy+56, gz+12));
+        GOUT(64, _g3_4(gx+36, gy+52, gz+16));
+        GOUT(65, _g3_4(gx+36, gy+48, gz+20));
+        GOUT(66, _g3_4(gx+44, gy+36, gz+24));
+        GOUT(67, _g3_4(gx+40, gy+40, gz+24));
+        GOUT(68, _g3_4(gx+40, gy+36, gz+28));
+        GOUT(69, _g3_4(gx+36, gy+44, gz+24));
+        GOUT(70, _g3_4(gx+36, gy+40, gz+28));
+        GOUT(71, _g3_4(gx+36, gy+36, gz+32));
+        GOUT(72, _g2_4(gx+68, gz+36));
+        GOUT(73, _g3_4(gx+64, gy+4, gz+36));
+        GOUT(74, _g2_4(gx+64, gz+40));
+        GOUT(75, _g3_4(gx+60, gy+8, gz+36));
+        GOUT(76, _g3_4(gx+60, gy+4, gz+40));
+        GOUT(77, _g2_4(gx+60, gz+44));
+        GOUT(78, _g3_4(gx+56, gy+12, gz+36));
+        GOUT(79, _g3_4(gx+52, gy+16, gz+36));
+        GOUT(80, _g3_4(gx+52, gy+12, gz+40));
+        GOUT(81, _g3_4(gx+48, gy+20, gz+36));
+        GOUT(82, _g3_4(gx+48, gy+16, gz+40));
+        GOUT(83, _g3_4(gx+48, gy+12, gz+44));
+        GOUT(84, _g2_4(gx+56, gz+48));
+        GOUT(85, _g3_4(gx+52, gy+4, gz+48));
+        GOUT(86, _g2_4(gx+52, gz+52));
+        GOUT(87, _g3_4(gx+48, gy+8, gz+48));
+        GOUT(88, _g3_4(gx+48, gy+4, gz+52));
+        GOUT(89, _g2_4(gx+48, gz+56));
+        GOUT(90, _g3_4(gx+44, gy+24, gz+36));
+        GOUT(91, _g3_4(gx+40, gy+28, gz+36));
+        GOUT(92, _g3_4(gx+40, gy+24, gz+40));
+        GOUT(93, _g3_4(gx+36, gy+32, gz+36));
+        GOUT(94, _g3_4(gx+36, gy+28, gz+40));
+        GOUT(95, _g3_4(gx+36, gy+24, gz+44));
+        GOUT(96, _g3_4(gx+44, gy+12, gz+48));
+        GOUT(97, _g3_4(gx+40, gy+16, gz+48));
+        GOUT(98, _g3_4(gx+40, gy+12, gz+52));
+        GOUT(99, _g3_4(gx+36, gy+20, gz+48));
+        GOUT(100, _g3_4(gx+36, gy+16, gz+52));
+        GOUT(101, _g3_4(gx+36, gy+12, gz+56));
+        GOUT(102, _g2_4(gx+44, gz+60));
+        GOUT(103, _g3_4(gx+40, gy+4, gz+60));
+        GOUT(104, _g2_4(gx+40, gz+64));
+        GOUT(105, _g3_4(gx+36, gy+8, gz+60));
+        GOUT(106, _g3_4(gx+36, gy+4, gz+64));
+        GOUT(107, _g2_4(gx+36, gz+68));
+        GOUT(108, _g3_4(gx+32, gy+72, gz+0));
+        GOUT(109, _g3_4(gx+28, gy+76, gz+0));
+        GOUT(110, _g3_4(gx+28, gy+72, gz+4));
+        GOUT(111, _g3_4(gx+24, gy+80, gz+0));
+        GOUT(112, _g3_4(gx+24, gy+76, gz+4));
+        GOUT(113, _g3_4(gx+24, gy+72, gz+8));
+        GOUT(114, _g3_4(gx+20, gy+84, gz+0));
+        GOUT(115, _g3_4(gx+16, gy+88, gz+0));
+        GOUT(116, _g3_4(gx+16, gy+84, gz+4));
+        GOUT(117, _g3_4(gx+12, gy+92, gz+0));
+        GOUT(118, _g3_4(gx+12, gy+88, gz+4));
+        GOUT(119, _g3_4(gx+12, gy+84, gz+8));
+        GOUT(120, _g3_4(gx+20, gy+72, gz+12));
+        GOUT(121, _g3_4(gx+16, gy+76, gz+12));
+        GOUT(122, _g3_4(gx+16, gy+72, gz+16));
+        GOUT(123, _g3_4(gx+12, gy+80, gz+12));
+        GOUT(124, _g3_4(gx+12, gy+76, gz+16));
+        GOUT(125, _g3_4(gx+12, gy+72, gz+20));
+        GOUT(126, _g3_4(gx+8, gy+96, gz+0));
+        GOUT(127, _g3_4(gx+4, gy+100, gz+0));
+        GOUT(128, _g3_4(gx+4, gy+96, gz+4));
+        GOUT(129, _g2_4(gy+104, gz+0));
+        GOUT(130, _g2_4(gy+100, gz+4));
+        GOUT(131, _g2_4(gy+96, gz+8));
+        GOUT(132, _g3_4(gx+8, gy+84, gz+12));
+        GOUT(133, _g3_4(gx+4, gy+88, gz+12));
+        GOUT(134, _g3_4(gx+4, gy+84, gz+16));
+        GOUT(135, _g2_4(gy+92, gz+12));
+        GOUT(136, _g2_4(gy+88, gz+16));
+        GOUT(137, _g2_4(gy+84, gz+20));
+        GOUT(138, _g3_4(gx+8, gy+72, gz+24));
+        GOUT(139, _g3_4(gx+4, gy+76, gz+24));
+        GOUT(140, _g3_4(gx+4, gy+72, gz+28));
+        GOUT(141, _g2_4(gy+80, gz+24));
+        GOUT(142, _g2_4(gy+76, gz+28));
+        GOUT(143, _g2_4(gy+72, gz+32));
+        GOUT(144, _g3_4(gx+32, gy+36, gz+36));
+        GOUT(145, _g3_4(gx+28, gy+40, gz+36));
+        GOUT(146, _g3_4(gx+28, gy+36, gz+40));
+        GOUT(147, _g3_4(gx+24, gy+44, gz+36));
+        GOUT(148, _g3_4(gx+24, gy+40, gz+40));
+        GOUT(149, _g3_4(gx+24, gy+36, gz+44));
+        GOUT(150, _g3_4(gx+20, gy+48, gz+36));
+        GOUT(151, _g3_4(gx+16, gy+52, gz+36));
+        GOUT(152, _g3_4(gx+16, gy+48, gz+40));
+        GOUT(153, _g3_4(gx+12, gy+56, gz+36));
+        GOUT(154, _g3_4(gx+12, gy+52, gz+40));
+        GOUT(155, _g3_4(gx+12, gy+48, gz+44));
+        GOUT(156, _g3_4(gx+20, gy+36, gz+48));
+        GOUT(157, _g3_4(gx+16, gy+40, gz+48));
+        GOUT(158, _g3_4(gx+16, gy+36, gz+52));
+        GOUT(159, _g3_4(gx+12, gy+44, gz+48));
+        GOUT(160, _g3_4(gx+12, gy+40, gz+52));
+        GOUT(161, _g3_4(gx+12, gy+36, gz+56));
+        GOUT(162, _g3_4(gx+8, gy+60, gz+36));
+        GOUT(163, _g3_4(gx+4, gy+64, gz+36));
+        GOUT(164, _g3_4(gx+4, gy+60, gz+40));
+        GOUT(165, _g2_4(gy+68, gz+36));
+        GOUT(166, _g2_4(gy+64, gz+40));
+        GOUT(167, _g2_4(gy+60, gz+44));
+        GOUT(168, _g3_4(gx+8, gy+48, gz+48));
+        GOUT(169, _g3_4(gx+4, gy+52, gz+48));
+        GOUT(170, _g3_4(gx+4, gy+48, gz+52));
+        GOUT(171, _g2_4(gy+56, gz+48));
+        GOUT(172, _g2_4(gy+52, gz+52));
+        GOUT(173, _g2_4(gy+48, gz+56));
+        GOUT(174, _g3_4(gx+8, gy+36, gz+60));
+        GOUT(175, _g3_4(gx+4, gy+40, gz+60));
+        GOUT(176, _g3_4(gx+4, gy+36, gz+64));
+        GOUT(177, _g2_4(gy+44, gz+60));
+        GOUT(178, _g2_4(gy+40, gz+64));
+        GOUT(179, _g2_4(gy+36, gz+68));
+        GOUT(180, _g2_4(gx+32, gz+72));
+        GOUT(181, _g3_4(gx+28, gy+4, gz+72));
+        GOUT(182, _g2_4(gx+28, gz+76));
+        GOUT(183, _g3_4(gx+24, gy+8, gz+72));
+        GOUT(184, _g3_4(gx+24, gy+4, gz+76));
+        GOUT(185, _g2_4(gx+24, gz+80));
+        GOUT(186, _g3_4(gx+20, gy+12, gz+72));
+        GOUT(187, _g3_4(gx+16, gy+16, gz+72));
+        GOUT(188, _g3_4(gx+16, gy+12, gz+76));
+        GOUT(189, _g3_4(gx+12, gy+20, gz+72));
+        GOUT(190, _g3_4(gx+12, gy+16, gz+76));
+        GOUT(191, _g3_4(gx+12, gy+12, gz+80));
+        GOUT(192, _g2_4(gx+20, gz+84));
+        GOUT(193, _g3_4(gx+16, gy+4, gz+84));
+        GOUT(194, _g2_4(gx+16, gz+88));
+        GOUT(195, _g3_4(gx+12, gy+8, gz+84));
+        GOUT(196, _g3_4(gx+12, gy+4, gz+88));
+        GOUT(197, _g2_4(gx+12, gz+92));
+        GOUT(198, _g3_4(gx+8, gy+24, gz+72));
+        GOUT(199, _g3_4(gx+4, gy+28, gz+72));
+        GOUT(200, _g3_4(gx+4, gy+24, gz+76));
+        GOUT(201, _g2_4(gy+32, gz+72));
+        GOUT(202, _g2_4(gy+28, gz+76));
+        GOUT(203, _g2_4(gy+24, gz+80));
+        GOUT(204, _g3_4(gx+8, gy+12, gz+84));
+        GOUT(205, _g3_4(gx+4, gy+16, gz+84));
+        GOUT(206, _g3_4(gx+4, gy+12, gz+88));
+        GOUT(207, _g2_4(gy+20, gz+84));
+        GOUT(208, _g2_4(gy+16, gz+88));
+        GOUT(209, _g2_4(gy+12, gz+92));
+        GOUT(210, _g2_4(gx+8, gz+96));
+        GOUT(211, _g3_4(gx+4, gy+4, gz+96));
+        GOUT(212, _g2_4(gx+4, gz+100));
+        GOUT(213, _g2_4(gy+8, gz+96));
+        GOUT(214, _g2_4(gy+4, gz+100));
+        GOUT(215, _g1_4(gz+104));
+}
+
+static void _g0_2d4d_2210(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 90;
+        double *gz = g + 180;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        FINT n;
+        for (n = 0; n < 3; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+18] = c00x;
+                gx[n+3] = rx + gx[n+18];
+                gx[n+36] = c00x * gx[n+18] + b10;
+                gx[n+21] = rx * gx[n+18] + gx[n+36];
+                gx[n+6] = rx * gx[n+3] + gx[n+21];
+                gx[n+9] = c0px;
+                gx[n+27] = c00x * gx[n+9] + b00;
+                gx[n+12] = rx * gx[n+9] + gx[n+27];
+                gx[n+45] = c00x * gx[n+27] + b10 * gx[n+9] + b00 * gx[n+18];
+                gx[n+30] = rx * gx[n+27] + gx[n+45];
+                gx[n+15] = rx * gx[n+12] + gx[n+30];
+                gx[n+54] = c00x * gx[n+36] + 2 * b10 * gx[n+18];
+                gx[n+39] = rx * gx[n+36] + gx[n+54];
+                gx[n+24] = rx * gx[n+21] + gx[n+39];
+                gx[n+63] = c00x * gx[n+45] + 2 * b10 * gx[n+27] + b00 * gx[n+36];
+                gx[n+48] = rx * gx[n+45] + gx[n+63];
+                gx[n+33] = rx * gx[n+30] + gx[n+48];
+                gx[n+72] = c00x * gx[n+54] + 3 * b10 * gx[n+36];
+                gx[n+57] = rx * gx[n+54] + gx[n+72];
+                gx[n+42] = rx * gx[n+39] + gx[n+57];
+                gx[n+81] = c00x * gx[n+63] + 3 * b10 * gx[n+45] + b00 * gx[n+54];
+                gx[n+66] = rx * gx[n+63] + gx[n+81];
+                gx[n+51] = rx * gx[n+48] + gx[n+66];
+                gy[n+18] = c00y;
+                gy[n+3] = ry + gy[n+18];
+                gy[n+36] = c00y * gy[n+18] + b10;
+                gy[n+21] = ry * gy[n+18] + gy[n+36];
+                gy[n+6] = ry * gy[n+3] + gy[n+21];
+                gy[n+9] = c0py;
+                gy[n+27] = c00y * gy[n+9] + b00;
+                gy[n+12] = ry * gy[n+9] + gy[n+27];
+                gy[n+45] = c00y * gy[n+27] + b10 * gy[n+9] + b00 * gy[n+18];
+                gy[n+30] = ry * gy[n+27] + gy[n+45];
+                gy[n+15] = ry * gy[n+12] + gy[n+30];
+                gy[n+54] = c00y * gy[n+36] + 2 * b10 * gy[n+18];
+                gy[n+39] = ry * gy[n+36] + gy[n+54];
+                gy[n+24] = ry * gy[n+21] + gy[n+39];
+                gy[n+63] = c00y * gy[n+45] + 2 * b10 * gy[n+27] + b00 * gy[n+36];
+                gy[n+48] = ry * gy[n+45] + gy[n+63];
+                gy[n+33] = ry * gy[n+30] + gy[n+48];
+                gy[n+72] = c00y * gy[n+54] + 3 * b10 * gy[n+36];
+                gy[n+57] = ry * gy[n+54] + gy[n+72];
+                gy[n+42] = ry * gy[n+39] + gy[n+57];
+                gy[n+81] = c00y * gy[n+63] + 3 * b10 * gy[n+45] + b00 * gy[n+54];
+                gy[n+66] = ry * gy[n+63] + gy[n+81];
+                gy[n+51] = ry * gy[n+48] + gy[n+66];
+                gz[n+18] = c00z * gz[n+0];
+                gz[n+3] = rz * gz[n+0] + gz[n+18];
+                gz[n+36] = c00z * gz[n+18] + b10 * gz[n+0];
+                gz[n+21] = rz * gz[n+18] + gz[n+36];
+                gz[n+6] = rz * gz[n+3] + gz[n+21];
+                gz[n+9] = c0pz * gz[n+0];
+                gz[n+27] = c00z * gz[n+9] + b00 * gz[n+0];
+                gz[n+12] = rz * gz[n+9] + gz[n+27];
+                gz[n+45] = c00z * gz[n+27] + b10 * gz[n+9] + b00 * gz[n+18];
+                gz[n+30] = rz * gz[n+27] + gz[n+45];
+                gz[n+15] = rz * gz[n+12] + gz[n+30];
+                gz[n+54] = c00z * gz[n+36] + 2 * b10 * gz[n+18];
+                gz[n+39] = rz * gz[n+36] + gz[n+54];
+                gz[n+24] = rz * gz[n+21] + gz[n+39];
+                gz[n+63] = c00z * gz[n+45] + 2 * b10 * gz[n+27] + b00 * gz[n+36];
+                gz[n+48] = rz * gz[n+45] + gz[n+63];
+                gz[n+33] = rz * gz[n+30] + gz[n+48];
+                gz[n+72] = c00z * gz[n+54] + 3 * b10 * gz[n+36];
+                gz[n+57] = rz * gz[n+54] + gz[n+72];
+                gz[n+42] = rz * gz[n+39] + gz[n+57];
+                gz[n+81] = c00z * gz[n+63] + 3 * b10 * gz[n+45] + b00 * gz[n+54];
+                gz[n+66] = rz * gz[n+63] + gz[n+81];
+                gz[n+51] = rz * gz[n+48] + gz[n+66];
+        }
+}
+static void _gout_2210(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 90;
+        double *gz = g + 180;
+        GOUT(0, _g2_3(gx+51, gz+0));
+        GOUT(1, _g3_3(gx+48, gy+3, gz+0));
+        GOUT(2, _g2_3(gx+48, gz+3));
+        GOUT(3, _g3_3(gx+45, gy+6, gz+0));
+        GOUT(4, _g3_3(gx+45, gy+3, gz+3));
+        GOUT(5, _g2_3(gx+45, gz+6));
+        GOUT(6, _g3_3(gx+42, gy+9, gz+0));
+        GOUT(7, _g3_3(gx+39, gy+12, gz+0));
+        GOUT(8, _g3_3(gx+39, gy+9, gz+3));
+        GOUT(9, _g3_3(gx+36, gy+15, gz+0));
+        GOUT(10, _g3_3(gx+36, gy+12, gz+3));
+        GOUT(11, _g3_3(gx+36, gy+9, gz+6));
+        GOUT(12, _g2_3(gx+42, gz+9));
+        GOUT(13, _g3_3(gx+39, gy+3, gz+9));
+        GOUT(14, _g2_3(gx+39, gz+12));
+        GOUT(15, _g3_3(gx+36, gy+6, gz+9));
+        GOUT(16, _g3_3(gx+36, gy+3, gz+12));
+        GOUT(17, _g2_3(gx+36, gz+15));
+        GOUT(18, _g3_3(gx+33, gy+18, gz+0));
+        GOUT(19, _g3_3(gx+30, gy+21, gz+0));
+        GOUT(20, _g3_3(gx+30, gy+18, gz+3));
+        GOUT(21, _g3_3(gx+27, gy+24, gz+0));
+        GOUT(22, _g3_3(gx+27, gy+21, gz+3));
+        GOUT(23, _g3_3(gx+27, gy+18, gz+6));
+        GOUT(24, _g3_3(gx+24, gy+27, gz+0));
+        GOUT(25, _g3_3(gx+21, gy+30, gz+0));
+        GOUT(26, _g3_3(gx+21, gy+27, gz+3));
+        GOUT(27, _g3_3(gx+18, gy+33, gz+0));
+        GOUT(28, _g3_3(gx+18, gy+30, gz+3));
+        GOUT(29, _g3_3(gx+18, gy+27, gz+6));
+        GOUT(30, _g3_3(gx+24, gy+18, gz+9));
+        GOUT(31, _g3_3(gx+21, gy+21, gz+9));
+        GOUT(32, _g3_3(gx+21, gy+18, gz+12));
+        GOUT(33, _g3_3(gx+18, gy+24, gz+9));
+        GOUT(34, _g3_3(gx+18, gy+21, gz+12));
+        GOUT(35, _g3_3(gx+18, gy+18, gz+15));
+        GOUT(36, _g2_3(gx+33, gz+18));
+        GOUT(37, _g3_3(gx+30, gy+3, gz+18));
+        GOUT(38, _g2_3(gx+30, gz+21));
+        GOUT(39, _g3_3(gx+27, gy+6, gz+18));
+        GOUT(40, _g3_3(gx+27, gy+3, gz+21));
+        GOUT(41, _g2_3(gx+27, gz+24));
+        GOUT(42, _g3_3(gx+24, gy+9, gz+18));
+        GOUT(43, _g3_3(gx+21, gy+12, gz+18));
+        GOUT(44, _g3_3(gx+21, gy+9, gz+21));
+        GOUT(45, _g3_3(gx+18, gy+15, gz+18));
+        GOUT(46, _g3_3(gx+18, gy+12, gz+21));
+        GOUT(47, _g3_3(gx+18, gy+9, gz+24));
+        GOUT(48, _g2_3(gx+24, gz+27));
+        GOUT(49, _g3_3(gx+21, gy+3, gz+27));
+        GOUT(50, _g2_3(gx+21, gz+30));
+        GOUT(51, _g3_3(gx+18, gy+6, gz+27));
+        GOUT(52, _g3_3(gx+18, gy+3, gz+30));
+        GOUT(53, _g2_3(gx+18, gz+33));
+        GOUT(54, _g3_3(gx+15, gy+36, gz+0));
+        GOUT(55, _g3_3(gx+12, gy+39, gz+0));
+        GOUT(56, _g3_3(gx+12, gy+36, gz+3));
+        GOUT(57, _g3_3(gx+9, gy+42, gz+0));
+        GOUT(58, _g3_3(gx+9, gy+39, gz+3));
+        GOUT(59, _g3_3(gx+9, gy+36, gz+6));
+        GOUT(60, _g3_3(gx+6, gy+45, gz+0));
+        GOUT(61, _g3_3(gx+3, gy+48, gz+0));
+        GOUT(62, _g3_3(gx+3, gy+45, gz+3));
+        GOUT(63, _g2_3(gy+51, gz+0));
+        GOUT(64, _g2_3(gy+48, gz+3));
+        GOUT(65, _g2_3(gy+45, gz+6));
+        GOUT(66, _g3_3(gx+6, gy+36, gz+9));
+        GOUT(67, _g3_3(gx+3, gy+39, gz+9));
+        GOUT(68, _g3_3(gx+3, gy+36, gz+12));
+        GOUT(69, _g2_3(gy+42, gz+9));
+        GOUT(70, _g2_3(gy+39, gz+12));
+        GOUT(71, _g2_3(gy+36, gz+15));
+        GOUT(72, _g3_3(gx+15, gy+18, gz+18));
+        GOUT(73, _g3_3(gx+12, gy+21, gz+18));
+        GOUT(74, _g3_3(gx+12, gy+18, gz+21));
+        GOUT(75, _g3_3(gx+9, gy+24, gz+18));
+        GOUT(76, _g3_3(gx+9, gy+21, gz+21));
+        GOUT(77, _g3_3(gx+9, gy+18, gz+24));
+        GOUT(78, _g3_3(gx+6, gy+27, gz+18));
+        GOUT(79, _g3_3(gx+3, gy+30, gz+18));
+        GOUT(80, _g3_3(gx+3, gy+27, gz+21));
+        GOUT(81, _g2_3(gy+33, gz+18));
+        GOUT(82, _g2_3(gy+30, gz+21));
+        GOUT(83, _g2_3(gy+27, gz+24));
+        GOUT(84, _g3_3(gx+6, gy+18, gz+27));
+        GOUT(85, _g3_3(gx+3, gy+21, gz+27));
+        GOUT(86, _g3_3(gx+3, gy+18, gz+30));
+        GOUT(87, _g2_3(gy+24, gz+27));
+        GOUT(88, _g2_3(gy+21, gz+30));
+        GOUT(89, _g2_3(gy+18, gz+33));
+        GOUT(90, _g2_3(gx+15, gz+36));
+        GOUT(91, _g3_3(gx+12, gy+3, gz+36));
+        GOUT(92, _g2_3(gx+12, gz+39));
+        GOUT(93, _g3_3(gx+9, gy+6, gz+36));
+        GOUT(94, _g3_3(gx+9, gy+3, gz+39));
+        GOUT(95, _g2_3(gx+9, gz+42));
+        GOUT(96, _g3_3(gx+6, gy+9, gz+36));
+        GOUT(97, _g3_3(gx+3, gy+12, gz+36));
+        GOUT(98, _g3_3(gx+3, gy+9, gz+39));
+        GOUT(99, _g2_3(gy+15, gz+36));
+        GOUT(100, _g2_3(gy+12, gz+39));
+        GOUT(101, _g2_3(gy+9, gz+42));
+        GOUT(102, _g2_3(gx+6, gz+45));
+        GOUT(103, _g3_3(gx+3, gy+3, gz+45));
+        GOUT(104, _g2_3(gx+3, gz+48));
+        GOUT(105, _g2_3(gy+6, gz+45));
+        GOUT(106, _g2_3(gy+3, gz+48));
+        GOUT(107, _g1_3(gz+51));
+}
+
+static void _g0_2d4d_2211(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 360;
+        double *gz = g + 720;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 4; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+72] = c00x;
+                gx[n+4] = rx + gx[n+72];
+                gx[n+144] = c00x * gx[n+72] + b10;
+                gx[n+76] = rx * gx[n+72] + gx[n+144];
+                gx[n+8] = rx * gx[n+4] + gx[n+76];
+                gx[n+24] = c0px;
+                gx[n+12] = sx + gx[n+24];
+                gx[n+96] = c00x * gx[n+24] + b00;
+                gx[n+84] = sx * gx[n+72] + gx[n+96];
+                gx[n+16] = rx * gx[n+12] + gx[n+84];
+                gx[n+168] = c00x * gx[n+96] + b10 * gx[n+24] + b00 * gx[n+72];
+                gx[n+156] = sx * gx[n+144] + gx[n+168];
+                gx[n+88] = rx * gx[n+84] + gx[n+156];
+                gx[n+20] = rx * gx[n+16] + gx[n+88];
+                gx[n+28] = rx * gx[n+24] + gx[n+96];
+                gx[n+100] = rx * gx[n+96] + gx[n+168];
+                gx[n+32] = rx * gx[n+28] + gx[n+100];
+                gx[n+48] = c0px * gx[n+24] + b01;
+                gx[n+36] = sx * gx[n+24] + gx[n+48];
+                gx[n+120] = c00x * gx[n+48] + 2 * b00 * gx[n+24];
+                gx[n+108] = sx * gx[n+96] + gx[n+120];
+                gx[n+40] = rx * gx[n+36] + gx[n+108];
+                gx[n+192] = c00x * gx[n+120] + b10 * gx[n+48] + 2 * b00 * gx[n+96];
+                gx[n+180] = sx * gx[n+168] + gx[n+192];
+                gx[n+112] = rx * gx[n+108] + gx[n+180];
+                gx[n+44] = rx * gx[n+40] + gx[n+112];
+                gx[n+216] = c00x * gx[n+144] + 2 * b10 * gx[n+72];
+                gx[n+148] = rx * gx[n+144] + gx[n+216];
+                gx[n+80] = rx * gx[n+76] + gx[n+148];
+                gx[n+240] = c00x * gx[n+168] + 2 * b10 * gx[n+96] + b00 * gx[n+144];
+                gx[n+228] = sx * gx[n+216] + gx[n+240];
+                gx[n+160] = rx * gx[n+156] + gx[n+228];
+                gx[n+92] = rx * gx[n+88] + gx[n+160];
+                gx[n+172] = rx * gx[n+168] + gx[n+240];
+                gx[n+104] = rx * gx[n+100] + gx[n+172];
+                gx[n+264] = c00x * gx[n+192] + 2 * b10 * gx[n+120] + 2 * b00 * gx[n+168];
+                gx[n+252] = sx * gx[n+240] + gx[n+264];
+                gx[n+184] = rx * gx[n+180] + gx[n+252];
+                gx[n+116] = rx * gx[n+112] + gx[n+184];
+                gx[n+288] = c00x * gx[n+216] + 3 * b10 * gx[n+144];
+                gx[n+220] = rx * gx[n+216] + gx[n+288];
+                gx[n+152] = rx * gx[n+148] + gx[n+220];
+                gx[n+312] = c00x * gx[n+240] + 3 * b10 * gx[n+168] + b00 * gx[n+216];
+                gx[n+300] = sx * gx[n+288] + gx[n+312];
+                gx[n+232] = rx * gx[n+228] + gx[n+300];
+                gx[n+164] = rx * gx[n+160] + gx[n+232];
+                gx[n+244] = rx * gx[n+240] + gx[n+312];
+                gx[n+176] = rx * gx[n+172] + gx[n+244];
+                gx[n+336] = c00x * gx[n+264] + 3 * b10 * gx[n+192] + 2 * b00 * gx[n+240];
+                gx[n+324] = sx * gx[n+312] + gx[n+336];
+                gx[n+256] = rx * gx[n+252] + gx[n+324];
+                gx[n+188] = rx * gx[n+184] + gx[n+256];
+                gy[n+72] = c00y;
+                gy[n+4] = ry + gy[n+72];
+                gy[n+144] = c00y * gy[n+72] + b10;
+                gy[n+76] = ry * gy[n+72] + gy[n+144];
+                gy[n+8] = ry * gy[n+4] + gy[n+76];
+                gy[n+24] = c0py;
+                gy[n+12] = sy + gy[n+24];
+                gy[n+96] = c00y * gy[n+24] + b00;
+                gy[n+84] = sy * gy[n+72] + gy[n+96];
+                gy[n+16] = ry * gy[n+12] + gy[n+84];
+                gy[n+168] = c00y * gy[n+96] + b10 * gy[n+24] + b00 * gy[n+72];
+                gy[n+156] = sy * gy[n+144] + gy[n+168];
+                gy[n+88] = ry * gy[n+84] + gy[n+156];
+                gy[n+20] = ry * gy[n+16] + gy[n+88];
+                gy[n+28] = ry * gy[n+24] + gy[n+96];
+                gy[n+100] = ry * gy[n+96] + gy[n+168];
+                gy[n+32] = ry * gy[n+28] + gy[n+100];
+                gy[n+48] = c0py * gy[n+24] + b01;
+                gy[n+36] = sy * gy[n+24] + gy[n+48];
+                gy[n+120] = c00y * gy[n+48] + 2 * b00 * gy[n+24];
+                gy[n+108] = sy * gy[n+96] + gy[n+120];
+                gy[n+40] = ry * gy[n+36] + gy[n+108];
+                gy[n+192] = c00y * gy[n+120] + b10 * gy[n+48] + 2 * b00 * gy[n+96];
+                gy[n+180] = sy * gy[n+168] + gy[n+192];
+                gy[n+112] = ry * gy[n+108] + gy[n+180];
+                gy[n+44] = ry * gy[n+40] + gy[n+112];
+                gy[n+216] = c00y * gy[n+144] + 2 * b10 * gy[n+72];
+                gy[n+148] = ry * gy[n+144] + gy[n+216];
+                gy[n+80] = ry * gy[n+76] + gy[n+148];
+                gy[n+240] = c00y * gy[n+168] + 2 * b10 * gy[n+96] + b00 * gy[n+144];
+                gy[n+228] = sy * gy[n+216] + gy[n+240];
+                gy[n+160] = ry * gy[n+156] + gy[n+228];
+                gy[n+92] = ry * gy[n+88] + gy[n+160];
+                gy[n+172] = ry * gy[n+168] + gy[n+240];
+                gy[n+104] = ry * gy[n+100] + gy[n+172];
+                gy[n+264] = c00y * gy[n+192] + 2 * b10 * gy[n+120] + 2 * b00 * gy[n+168];
+                gy[n+252] = sy * gy[n+240] + gy[n+264];
+                gy[n+184] = ry * gy[n+180] + gy[n+252];
+                gy[n+116] = ry * gy[n+112] + gy[n+184];
+                gy[n+288] = c00y * gy[n+216] + 3 * b10 * gy[n+144];
+                gy[n+220] = ry * gy[n+216] + gy[n+288];
+                gy[n+152] = ry * gy[n+148] + gy[n+220];
+                gy[n+312] = c00y * gy[n+240] + 3 * b10 * gy[n+168] + b00 * gy[n+216];
+                gy[n+300] = sy * gy[n+288] + gy[n+312];
+                gy[n+232] = ry * gy[n+228] + gy[n+300];
+                gy[n+164] = ry * gy[n+160] + gy[n+232];
+                gy[n+244] = ry * gy[n+240] + gy[n+312];
+                gy[n+176] = ry * gy[n+172] + gy[n+244];
+                gy[n+336] = c00y * gy[n+264] + 3 * b10 * gy[n+192] + 2 * b00 * gy[n+240];
+                gy[n+324] = sy * gy[n+312] + gy[n+336];
+                gy[n+256] = ry * gy[n+252] + gy[n+324];
+                gy[n+188] = ry * gy[n+184] + gy[n+256];
+                gz[n+72] = c00z * gz[n+0];
+                gz[n+4] = rz * gz[n+0] + gz[n+72];
+                gz[n+144] = c00z * gz[n+72] + b10 * gz[n+0];
+                gz[n+76] = rz * gz[n+72] + gz[n+144];
+                gz[n+8] = rz * gz[n+4] + gz[n+76];
+                gz[n+24] = c0pz * gz[n+0];
+                gz[n+12] = sz * gz[n+0] + gz[n+24];
+                gz[n+96] = c00z * gz[n+24] + b00 * gz[n+0];
+                gz[n+84] = sz * gz[n+72] + gz[n+96];
+                gz[n+16] = rz * gz[n+12] + gz[n+84];
+                gz[n+168] = c00z * gz[n+96] + b10 * gz[n+24] + b00 * gz[n+72];
+                gz[n+156] = sz * gz[n+144] + gz[n+168];
+                gz[n+88] = rz * gz[n+84] + gz[n+156];
+                gz[n+20] = rz * gz[n+16] + gz[n+88];
+                gz[n+28] = rz * gz[n+24] + gz[n+96];
+                gz[n+100] = rz * gz[n+96] + gz[n+168];
+                gz[n+32] = rz * gz[n+28] + gz[n+100];
+                gz[n+48] = c0pz * gz[n+24] + b01 * gz[n+0];
+                gz[n+36] = sz * gz[n+24] + gz[n+48];
+                gz[n+120] = c00z * gz[n+48] + 2 * b00 * gz[n+24];
+                gz[n+108] = sz * gz[n+96] + gz[n+120];
+                gz[n+40] = rz * gz[n+36] + gz[n+108];
+                gz[n+192] = c00z * gz[n+120] + b10 * gz[n+48] + 2 * b00 * gz[n+96];
+                gz[n+180] = sz * gz[n+168] + gz[n+192];
+                gz[n+112] = rz * gz[n+108] + gz[n+180];
+                gz[n+44] = rz * gz[n+40] + gz[n+112];
+                gz[n+216] = c00z * gz[n+144] + 2 * b10 * gz[n+72];
+                gz[n+148] = rz * gz[n+144] + gz[n+216];
+                gz[n+80] = rz * gz[n+76] + gz[n+148];
+                gz[n+240] = c00z * gz[n+168] + 2 * b10 * gz[n+96] + b00 * gz[n+144];
+                gz[n+228] = sz * gz[n+216] + gz[n+240];
+                gz[n+160] = rz * gz[n+156] + gz[n+228];
+                gz[n+92] = rz * gz[n+88] + gz[n+160];
+                gz[n+172] = rz * gz[n+168] + gz[n+240];
+                gz[n+104] = rz * gz[n+100] + gz[n+172];
+                gz[n+264] = c00z * gz[n+192] + 2 * b10 * gz[n+120] + 2 * b00 * gz[n+168];
+                gz[n+252] = sz * gz[n+240] + gz[n+264];
+                gz[n+184] = rz * gz[n+180] + gz[n+252];
+                gz[n+116] = rz * gz[n+112] + gz[n+184];
+                gz[n+288] = c00z * gz[n+216] + 3 * b10 * gz[n+144];
+                gz[n+220] = rz * gz[n+216] + gz[n+288];
+                gz[n+152] = rz * gz[n+148] + gz[n+220];
+                gz[n+312] = c00z * gz[n+240] + 3 * b10 * gz[n+168] + b00 * gz[n+216];
+                gz[n+300] = sz * gz[n+288] + gz[n+312];
+                gz[n+232] = rz * gz[n+228] + gz[n+300];
+                gz[n+164] = rz * gz[n+160] + gz[n+232];
+                gz[n+244] = rz * gz[n+240] + gz[n+312];
+                gz[n+176] = rz * gz[n+172] + gz[n+244];
+                gz[n+336] = c00z * gz[n+264] + 3 * b10 * gz[n+192] + 2 * b00 * gz[n+240];
+                gz[n+324] = sz * gz[n+312] + gz[n+336];
+                gz[n+256] = rz * gz[n+252] + gz[n+324];
+                gz[n+188] = rz * gz[n+184] + gz[n+256];
+        }
+}
+static void _gout_2211(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 360;
+        double *gz = g + 720;
+        GOUT(0, _g2_4(gx+188, gz+0));
+        GOUT(1, _g3_4(gx+184, gy+4, gz+0));
+        GOUT(2, _g2_4(gx+184, gz+4));
+        GOUT(3, _g3_4(gx+180, gy+8, gz+0));
+        GOUT(4, _g3_4(gx+180, gy+4, gz+4));
+        GOUT(5, _g2_4(gx+180, gz+8));
+        GOUT(6, _g3_4(gx+176, gy+12, gz+0));
+        GOUT(7, _g3_4(gx+172, gy+16, gz+0));
+        GOUT(8, _g3_4(gx+172, gy+12, gz+4));
+        GOUT(9, _g3_4(gx+168, gy+20, gz+0));
+        GOUT(10, _g3_4(gx+168, gy+16, gz+4));
+        GOUT(11, _g3_4(gx+168, gy+12, gz+8));
+        GOUT(12, _g2_4(gx+176, gz+12));
+        GOUT(13, _g3_4(gx+172, gy+4, gz+12));
+        GOUT(14, _g2_4(gx+172, gz+16));
+        GOUT(15, _g3_4(gx+168, gy+8, gz+12));
+        GOUT(16, _g3_4(gx+168, gy+4, gz+16));
+        GOUT(17, _g2_4(gx+168, gz+20));
+        GOUT(18, _g3_4(gx+164, gy+24, gz+0));
+        GOUT(19, _g3_4(gx+160, gy+28, gz+0));
+        GOUT(20, _g3_4(gx+160, gy+24, gz+4));
+        GOUT(21, _g3_4(gx+156, gy+32, gz+0));
+        GOUT(22, _g3_4(gx+156, gy+28, gz+4));
+        GOUT(23, _g3_4(gx+156, gy+24, gz+8));
+        GOUT(24, _g3_4(gx+152, gy+36, gz+0));
+        GOUT(25, _g3_4(gx+148, gy+40, gz+0));
+        GOUT(26, _g3_4(gx+148, gy+36, gz+4));
+        GOUT(27, _g3_4(gx+144, gy+44, gz+0));
+        GOUT(28, _g3_4(gx+144, gy+40, gz+4));
+        GOUT(29, _g3_4(gx+144, gy+36, gz+8));
+        GOUT(30, _g3_4(gx+152, gy+24, gz+12));
+        GOUT(31, _g3_4(gx+148, gy+28, gz+12));
+        GOUT(32, _g3_4(gx+148, gy+24, gz+16));
+        GOUT(33, _g3_4(gx+144, gy+32, gz+12));
+        GOUT(34, _g3_4(gx+144, gy+28, gz+16));
+        GOUT(35, _g3_4(gx+144, gy+24, gz+20));
+        GOUT(36, _g2_4(gx+164, gz+24));
+        GOUT(37, _g3_4(gx+160, gy+4, gz+24));
+        GOUT(38, _g2_4(gx+160, gz+28));
+        GOUT(39, _g3_4(gx+156, gy+8, gz+24));
+        GOUT(40, _g3_4(gx+156, gy+4, gz+28));
+        GOUT(41, _g2_4(gx+156, gz+32));
+        GOUT(42, _g3_4(gx+152, gy+12, gz+24));
+        GOUT(43, _g3_4(gx+148, gy+16, gz+24));
+        GOUT(44, _g3_4(gx+148, gy+12, gz+28));
+        GOUT(45, _g3_4(gx+144, gy+20, gz+24));
+        GOUT(46, _g3_4(gx+144, gy+16, gz+28));
+        GOUT(47, _g3_4(gx+144, gy+12, gz+32));
+        GOUT(48, _g2_4(gx+152, gz+36));
+        GOUT(49, _g3_4(gx+148, gy+4, gz+36));
+        GOUT(50, _g2_4(gx+148, gz+40));
+        GOUT(51, _g3_4(gx+144, gy+8, gz+36));
+        GOUT(52, _g3_4(gx+144, gy+4, gz+40));
+        GOUT(53, _g2_4(gx+144, gz+44));
+        GOUT(54, _g3_4(gx+116, gy+72, gz+0));
+        GOUT(55, _g3_4(gx+112, gy+76, gz+0));
+        GOUT(56, _g3_4(gx+112, gy+72, gz+4));
+        GOUT(57, _g3_4(gx+108, gy+80, gz+0));
+        GOUT(58, _g3_4(gx+108, gy+76, gz+4));
+        GOUT(59, _g3_4(gx+108, gy+72, gz+8));
+        GOUT(60, _g3_4(gx+104, gy+84, gz+0));
+        GOUT(61, _g3_4(gx+100, gy+88, gz+0));
+        GOUT(62, _g3_4(gx+100, gy+84, gz+4));
+        GOUT(63, _g3_4(gx+96, gy+92, gz+0));
+        GOUT(64, _g3_4(gx+96, gy+88, gz+4));
+        GOUT(65, _g3_4(gx+96, gy+84, gz+8));
+        GOUT(66, _g3_4(gx+104, gy+72, gz+12));
+        GOUT(67, _g3_4(gx+100, gy+76, gz+12));
+        GOUT(68, _g3_4(gx+100, gy+72, gz+16));
+        GOUT(69, _g3_4(gx+96, gy+80, gz+12));
+        GOUT(70, _g3_4(gx+96, gy+76, gz+16));
+        GOUT(71, _g3_4(gx+96, gy+72, gz+20));
+        GOUT(72, _g3_4(gx+92, gy+96, gz+0));
+        GOUT(73, _g3_4(gx+88, gy+100, gz+0));
+        GOUT(74, _g3_4(gx+88, gy+96, gz+4));
+        GOUT(75, _g3_4(gx+84, gy+104, gz+0));
+        GOUT(76, _g3_4(gx+84, gy+100, gz+4));
+        GOUT(77, _g3_4(gx+84, gy+96, gz+8));
+        GOUT(78, _g3_4(gx+80, gy+108, gz+0));
+        GOUT(79, _g3_4(gx+76, gy+112, gz+0));
+        GOUT(80, _g3_4(gx+76, gy+108, gz+4));
+        GOUT(81, _g3_4(gx+72, gy+116, gz+0));
+        GOUT(82, _g3_4(gx+72, gy+112, gz+4));
+        GOUT(83, _g3_4(gx+72, gy+108, gz+8));
+        GOUT(84, _g3_4(gx+80, gy+96, gz+12));
+        GOUT(85, _g3_4(gx+76, gy+100, gz+12));
+        GOUT(86, _g3_4(gx+76, gy+96, gz+16));
+        GOUT(87, _g3_4(gx+72, gy+104, gz+12));
+        GOUT(88, _g3_4(gx+72, gy+100, gz+16));
+        GOUT(89, _g3_4(gx+72, gy+96, gz+20));
+        GOUT(90, _g3_4(gx+92, gy+72, gz+24));
+        GOUT(91, _g3_4(gx+88, gy+76, gz+24));
+        GOUT(92, _g3_4(gx+88, gy+72, gz+28));
+        GOUT(93, _g3_4(gx+84, gy+80, gz+24));
+        GOUT(94, _g3_4(gx+84, gy+76, gz+28));
+        GOUT(95, _g3_4(gx+84, gy+72, gz+32));
+        GOUT(96, _g3_4(gx+80, gy+84, gz+24));
+        GOUT(97, _g3_4(gx+76, gy+88, gz+24));
+        GOUT(98, _g3_4(gx+76, gy+84, gz+28));
+        GOUT(99, _g3_4(gx+72, gy+92, gz+24));
+        GOUT(100, _g3_4(gx+72, gy+88, gz+28));
+        GOUT(101, _g3_4(gx+72, gy+84, gz+32));
+        GOUT(102, _g3_4(gx+80, gy+72, gz+36));
+        GOUT(103, _g3_4(gx+76, gy+76, gz+36));
+        GOUT(104, _g3_4(gx+76, gy+72, gz+40));
+        GOUT(105, _g3_4(gx+72, gy+80, gz+36));
+        GOUT(106, _g3_4(gx+72, gy+76, gz+40));
+        GOUT(107, _g3_4(gx+72, gy+72, gz+44));
+        GOUT(108, _g2_4(gx+116, gz+72));
+        GOUT(109, _g3_4(gx+112, gy+4, gz+72));
+        GOUT(110, _g2_4(gx+112, gz+76));
+        GOUT(111, _g3_4(gx+108, gy+8, gz+72));
+        GOUT(112, _g3_4(gx+108, gy+4, gz+76));
+        GOUT(113, _g2_4(gx+108, gz+80));
+        GOUT(114, _g3_4(gx+104, gy+12, gz+72));
+        GOUT(115, _g3_4(gx+100, gy+16, gz+72));
+        GOUT(116, _g3_4(gx+100, gy+12, gz+76));
+        GOUT(117, _g3_4(gx+96, gy+20, gz+72));
+        GOUT(118, _g3_4(gx+96, gy+16, gz+76));
+        GOUT(119, _g3_4(gx+96, gy+12, gz+80));
+        GOUT(120, _g2_4(gx+104, gz+84));
+        GOUT(121, _g3_4(gx+100, gy+4, gz+84));
+        GOUT(122, _g2_4(gx+100, gz+88));
+        GOUT(123, _g3_4(gx+96, gy+8, gz+84));
+        GOUT(124, _g3_4(gx+96, gy+4, gz+88));
+        GOUT(125, _g2_4(gx+96, gz+92));
+        GOUT(126, _g3_4(gx+92, gy+24, gz+72));
+        GOUT(127, _g3_4(gx+88, gy+28, gz+72));
+        GOUT(128, _g3_4(gx+88, gy+24, gz+76));
+        GOUT(129, _g3_4(gx+84, gy+32, gz+72));
+        GOUT(130, _g3_4(gx+84, gy+28, gz+76));
+        GOUT(131, _g3_4(gx+84, gy+24, gz+80));
+        GOUT(132, _g3_4(gx+80, gy+36, gz+72));
+        GOUT(133, _g3_4(gx+76, gy+40, gz+72));
+        GOUT(134, _g3_4(gx+76, gy+36, gz+76));
+        GOUT(135, _g3_4(gx+72, gy+44, gz+72));
+        GOUT(136, _g3_4(gx+72, gy+40, gz+76));
+        GOUT(137, _g3_4(gx+72, gy+36, gz+80));
+        GOUT(138, _g3_4(gx+80, gy+24, gz+84));
+        GOUT(139, _g3_4(gx+76, gy+28, gz+84));
+        GOUT(140, _g3_4(gx+76, gy+24, gz+88));
+        GOUT(141, _g3_4(gx+72, gy+32, gz+84));
+        GOUT(142, _g3_4(gx+72, gy+28, gz+88));
+        GOUT(143, _g3_4(gx+72, gy+24, gz+92));
+        GOUT(144, _g2_4(gx+92, gz+96));
+        GOUT(145, _g3_4(gx+88, gy+4, gz+96));
+        GOUT(146, _g2_4(gx+88, gz+100));
+        GOUT(147, _g3_4(gx+84, gy+8, gz+96));
+        GOUT(148, _g3_4(gx+84, gy+4, gz+100));
+        GOUT(149, _g2_4(gx+84, gz+104));
+        GOUT(150, _g3_4(gx+80, gy+12, gz+96));
+        GOUT(151, _g3_4(gx+76, gy+16, gz+96));
+        GOUT(152, _g3_4(gx+76, gy+12, gz+100));
+        GOUT(153, _g3_4(gx+72, gy+20, gz+96));
+        GOUT(154, _g3_4(gx+72, gy+16, gz+100));
+        GOUT(155, _g3_4(gx+72, gy+12, gz+104));
+        GOUT(156, _g2_4(gx+80, gz+108));
+        GOUT(157, _g3_4(gx+76, gy+4, gz+108));
+        GOUT(158, _g2_4(gx+76, gz+112));
+        GOUT(159, _g3_4(gx+72, gy+8, gz+108));
+        GOUT(160, _g3_4(gx+72, gy+4, gz+112));
+        GOUT(161, _g2_4(gx+72, gz+116));
+        GOUT(162, _g3_4(gx+44, gy+144, gz+0));
+        GOUT(163, _g3_4(gx+40, gy+148, gz+0));
+        GOUT(164, _g3_4(gx+40, gy+144, gz+4));
+        GOUT(165, _g3_4(gx+36, gy+152, gz+0));
+        GOUT(166, _g3_4(gx+36, gy+148, gz+4));
+        GOUT(167, _g3_4(gx+36, gy+144, gz+8));
+        GOUT(168, _g3_4(gx+32, gy+156, gz+0));
+        GOUT(169, _g3_4(gx+28, gy+160, gz+0));
+        GOUT(170, _g3_4(gx+28, gy+156, gz+4));
+        GOUT(171, _g3_4(gx+24, gy+164, gz+0));
+        GOUT(172, _g3_4(gx+24, gy+160, gz+4));
+        GOUT(173, _g3_4(gx+24, gy+156, gz+8));
+        GOUT(174, _g3_4(gx+32, gy+144, gz+12));
+        GOUT(175, _g3_4(gx+28, gy+148, gz+12));
+        GOUT(176, _g3_4(gx+28, gy+144, gz+16));
+        GOUT(177, _g3_4(gx+24, gy+152, gz+12));
+        GOUT(178, _g3_4(gx+24, gy+148, gz+16));
+        GOUT(179, _g3_4(gx+24, gy+144, gz+20));
+        GOUT(180, _g3_4(gx+20, gy+168, gz+0));
+        GOUT(181, _g3_4(gx+16, gy+172, gz+0));
+        GOUT(182, _g3_4(gx+16, gy+168, gz+4));
+        GOUT(183, _g3_4(gx+12, gy+176, gz+0));
+        GOUT(184, _g3_4(gx+12, gy+172, gz+4));
+        GOUT(185, _g3_4(gx+12, gy+168, gz+8));
+        GOUT(186, _g3_4(gx+8, gy+180, gz+0));
+        GOUT(187, _g3_4(gx+4, gy+184, gz+0));
+        GOUT(188, _g3_4(gx+4, gy+180, gz+4));
+        GOUT(189, _g2_4(gy+188, gz+0));
+        GOUT(190, _g2_4(gy+184, gz+4));
+        GOUT(191, _g2_4(gy+180, gz+8));
+        GOUT(192, _g3_4(gx+8, gy+168, gz+12));
+        GOUT(193, _g3_4(gx+4, gy+172, gz+12));
+        GOUT(194, _g3_4(gx+4, gy+168, gz+16));
+        GOUT(195, _g2_4(gy+176, gz+12));
+        GOUT(196, _g2_4(gy+172, gz+16));
+        GOUT(197, _g2_4(gy+168, gz+20));
+        GOUT(198, _g3_4(gx+20, gy+144, gz+24));
+        GOUT(199, _g3_4(gx+16, gy+148, gz+24));
+        GOUT(200, _g3_4(gx+16, gy+144, gz+28));
+        GOUT(201, _g3_4(gx+12, gy+152, gz+24));
+        GOUT(202, _g3_4(gx+12, gy+148, gz+28));
+        GOUT(203, _g3_4(gx+12, gy+144, gz+32));
+        GOUT(204, _g3_4(gx+8, gy+156, gz+24));
+        GOUT(205, _g3_4(gx+4, gy+160, gz+24));
+        GOUT(206, _g3_4(gx+4, gy+156, gz+28));
+        GOUT(207, _g2_4(gy+164, gz+24));
+        GOUT(208, _g2_4(gy+160, gz+28));
+        GOUT(209, _g2_4(gy+156, gz+32));
+        GOUT(210, _g3_4(gx+8, gy+144, gz+36));
+        GOUT(211, _g3_4(gx+4, gy+148, gz+36));
+        GOUT(212, _g3_4(gx+4, gy+144, gz+40));
+        GOUT(213, _g2_4(gy+152, gz+36));
+        GOUT(214, _g2_4(gy+148, gz+40));
+        GOUT(215, _g2_4(gy+144, gz+44));
+        GOUT(216, _g3_4(gx+44, gy+72, gz+72));
+        GOUT(217, _g3_4(gx+40, gy+76, gz+72));
+        GOUT(218, _g3_4(gx+40, gy+72, gz+76));
+        GOUT(219, _g3_4(gx+36, gy+80, gz+72));
+        GOUT(220, _g3_4(gx+36, gy+76, gz+76));
+        GOUT(221, _g3_4(gx+36, gy+72, gz+80));
+        GOUT(222, _g3_4(gx+32, gy+84, gz+72));
+        GOUT(223, _g3_4(gx+28, gy+88, gz+72));
+        GOUT(224, _g3_4(gx+28, gy+84, gz+76));
+        GOUT(225, _g3_4(gx+24, gy+92, gz+72));
+        GOUT(226, _g3_4(gx+24, gy+88, gz+76));
+        GOUT(227, _g3_4(gx+24, gy+84, gz+80));
+        GOUT(228, _g3_4(gx+32, gy+72, gz+84));
+        GOUT(229, _g3_4(gx+28, gy+76, gz+84));
+        GOUT(230, _g3_4(gx+28, gy+72, gz+88));
+        GOUT(231, _g3_4(gx+24, gy+80, gz+84));
+        GOUT(232, _g3_4(gx+24, gy+76, gz+88));
+        GOUT(233, _g3_4(gx+24, gy+72, gz+92));
+        GOUT(234, _g3_4(gx+20, gy+96, gz+72));
+        GOUT(235, _g3_4(gx+16, gy+100, gz+72));
+        GOUT(236, _g3_4(gx+16, gy+96, gz+76));
+        GOUT(237, _g3_4(gx+12, gy+104, gz+72));
+        GOUT(238, _g3_4(gx+12, gy+100, gz+76));
+        GOUT(239, _g3_4(gx+12, gy+96, gz+80));
+        GOUT(240, _g3_4(gx+8, gy+108, gz+72));
+        GOUT(241, _g3_4(gx+4, gy+112, gz+72));
+        GOUT(242, _g3_4(gx+4, gy+108, gz+76));
+        GOUT(243, _g2_4(gy+116, gz+72));
+        GOUT(244, _g2_4(gy+112, gz+76));
+        GOUT(245, _g2_4(gy+108, gz+80));
+        GOUT(246, _g3_4(gx+8, gy+96, gz+84));
+        GOUT(247, _g3_4(gx+4, gy+100, gz+84));
+        GOUT(248, _g3_4(gx+4, gy+96, gz+88));
+        GOUT(249, _g2_4(gy+104, gz+84));
+        GOUT(250, _g2_4(gy+100, gz+88));
+        GOUT(251, _g2_4(gy+96, gz+92));
+        GOUT(252, _g3_4(gx+20, gy+72, gz+96));
+        GOUT(253, _g3_4(gx+16, gy+76, gz+96));
+        GOUT(254, _g3_4(gx+16, gy+72, gz+100));
+        GOUT(255, _g3_4(gx+12, gy+80, gz+96));
+        GOUT(256, _g3_4(gx+12, gy+76, gz+100));
+        GOUT(257, _g3_4(gx+12, gy+72, gz+104));
+        GOUT(258, _g3_4(gx+8, gy+84, gz+96));
+        GOUT(259, _g3_4(gx+4, gy+88, gz+96));
+        GOUT(260, _g3_4(gx+4, gy+84, gz+100));
+        GOUT(261, _g2_4(gy+92, gz+96));
+        GOUT(262, _g2_4(gy+88, gz+100));
+        GOUT(263, _g2_4(gy+84, gz+104));
+        GOUT(264, _g3_4(gx+8, gy+72, gz+108));
+        GOUT(265, _g3_4(gx+4, gy+76, gz+108));
+        GOUT(266, _g3_4(gx+4, gy+72, gz+112));
+        GOUT(267, _g2_4(gy+80, gz+108));
+        GOUT(268, _g2_4(gy+76, gz+112));
+        GOUT(269, _g2_4(gy+72, gz+116));
+        GOUT(270, _g2_4(gx+44, gz+144));
+        GOUT(271, _g3_4(gx+40, gy+4, gz+144));
+        GOUT(272, _g2_4(gx+40, gz+148));
+        GOUT(273, _g3_4(gx+36, gy+8, gz+144));
+        GOUT(274, _g3_4(gx+36, gy+4, gz+148));
+        GOUT(275, _g2_4(gx+36, gz+152));
+        GOUT(276, _g3_4(gx+32, gy+12, gz+144));
+        GOUT(277, _g3_4(gx+28, gy+16, gz+144));
+        GOUT(278, _g3_4(gx+28, gy+12, gz+148));
+        GOUT(279, _g3_4(gx+24, gy+20, gz+144));
+        GOUT(280, _g3_4(gx+24, gy+16, gz+148));
+        GOUT(281, _g3_4(gx+24, gy+12, gz+152));
+        GOUT(282, _g2_4(gx+32, gz+156));
+        GOUT(283, _g3_4(gx+28, gy+4, gz+156));
+        GOUT(284, _g2_4(gx+28, gz+160));
+        GOUT(285, _g3_4(gx+24, gy+8, gz+156));
+        GOUT(286, _g3_4(gx+24, gy+4, gz+160));
+        GOUT(287, _g2_4(gx+24, gz+164));
+        GOUT(288, _g3_4(gx+20, gy+24, gz+144));
+        GOUT(289, _g3_4(gx+16, gy+28, gz+144));
+        GOUT(290, _g3_4(gx+16, gy+24, gz+148));
+        GOUT(291, _g3_4(gx+12, gy+32, gz+144));
+        GOUT(292, _g3_4(gx+12, gy+28, gz+148));
+        GOUT(293, _g3_4(gx+12, gy+24, gz+152));
+        GOUT(294, _g3_4(gx+8, gy+36, gz+144));
+        GOUT(295, _g3_4(gx+4, gy+40, gz+144));
+        GOUT(296, _g3_4(gx+4, gy+36, gz+148));
+        GOUT(297, _g2_4(gy+44, gz+144));
+        GOUT(298, _g2_4(gy+40, gz+148));
+        GOUT(299, _g2_4(gy+36, gz+152));
+        GOUT(300, _g3_4(gx+8, gy+24, gz+156));
+        GOUT(301, _g3_4(gx+4, gy+28, gz+156));
+        GOUT(302, _g3_4(gx+4, gy+24, gz+160));
+        GOUT(303, _g2_4(gy+32, gz+156));
+        GOUT(304, _g2_4(gy+28, gz+160));
+        GOUT(305, _g2_4(gy+24, gz+164));
+        GOUT(306, _g2_4(gx+20, gz+168));
+        GOUT(307, _g3_4(gx+16, gy+4, gz+168));
+        GOUT(308, _g2_4(gx+16, gz+172));
+        GOUT(309, _g3_4(gx+12, gy+8, gz+168));
+        GOUT(310, _g3_4(gx+12, gy+4, gz+172));
+        GOUT(311, _g2_4(gx+12, gz+176));
+        GOUT(312, _g3_4(gx+8, gy+12, gz+168));
+        GOUT(313, _g3_4(gx+4, gy+16, gz+168));
+        GOUT(314, _g3_4(gx+4, gy+12, gz+172));
+        GOUT(315, _g2_4(gy+20, gz+168));
+        GOUT(316, _g2_4(gy+16, gz+172));
+        GOUT(317, _g2_4(gy+12, gz+176));
+        GOUT(318, _g2_4(gx+8, gz+180));
+        GOUT(319, _g3_4(gx+4, gy+4, gz+180));
+        GOUT(320, _g2_4(gx+4, gz+184));
+        GOUT(321, _g2_4(gy+8, gz+180));
+        GOUT(322, _g2_4(gy+4, gz+184));
+        GOUT(323, _g1_4(gz+188));
+}
+
+static void _g0_2d4d_2212(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 480;
+        double *gz = g + 960;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 4; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+96] = c00x;
+                gx[n+4] = rx + gx[n+96];
+                gx[n+192] = c00x * gx[n+96] + b10;
+                gx[n+100] = rx * gx[n+96] + gx[n+192];
+                gx[n+8] = rx * gx[n+4] + gx[n+100];
+                gx[n+24] = c0px;
+                gx[n+12] = sx + gx[n+24];
+                gx[n+120] = c00x * gx[n+24] + b00;
+                gx[n+108] = sx * gx[n+96] + gx[n+120];
+                gx[n+16] = rx * gx[n+12] + gx[n+108];
+                gx[n+216] = c00x * gx[n+120] + b10 * gx[n+24] + b00 * gx[n+96];
+                gx[n+204] = sx * gx[n+192] + gx[n+216];
+                gx[n+112] = rx * gx[n+108] + gx[n+204];
+                gx[n+20] = rx * gx[n+16] + gx[n+112];
+                gx[n+28] = rx * gx[n+24] + gx[n+120];
+                gx[n+124] = rx * gx[n+120] + gx[n+216];
+                gx[n+32] = rx * gx[n+28] + gx[n+124];
+                gx[n+48] = c0px * gx[n+24] + b01;
+                gx[n+36] = sx * gx[n+24] + gx[n+48];
+                gx[n+144] = c00x * gx[n+48] + 2 * b00 * gx[n+24];
+                gx[n+132] = sx * gx[n+120] + gx[n+144];
+                gx[n+40] = rx * gx[n+36] + gx[n+132];
+                gx[n+240] = c00x * gx[n+144] + b10 * gx[n+48] + 2 * b00 * gx[n+120];
+                gx[n+228] = sx * gx[n+216] + gx[n+240];
+                gx[n+136] = rx * gx[n+132] + gx[n+228];
+                gx[n+44] = rx * gx[n+40] + gx[n+136];
+                gx[n+52] = rx * gx[n+48] + gx[n+144];
+                gx[n+148] = rx * gx[n+144] + gx[n+240];
+                gx[n+56] = rx * gx[n+52] + gx[n+148];
+                gx[n+72] = c0px * gx[n+48] + 2 * b01 * gx[n+24];
+                gx[n+60] = sx * gx[n+48] + gx[n+72];
+                gx[n+168] = c00x * gx[n+72] + 3 * b00 * gx[n+48];
+                gx[n+156] = sx * gx[n+144] + gx[n+168];
+                gx[n+64] = rx * gx[n+60] + gx[n+156];
+                gx[n+264] = c00x * gx[n+168] + b10 * gx[n+72] + 3 * b00 * gx[n+144];
+                gx[n+252] = sx * gx[n+240] + gx[n+264];
+                gx[n+160] = rx * gx[n+156] + gx[n+252];
+                gx[n+68] = rx * gx[n+64] + gx[n+160];
+                gx[n+288] = c00x * gx[n+192] + 2 * b10 * gx[n+96];
+                gx[n+196] = rx * gx[n+192] + gx[n+288];
+                gx[n+104] = rx * gx[n+100] + gx[n+196];
+                gx[n+312] = c00x * gx[n+216] + 2 * b10 * gx[n+120] + b00 * gx[n+192];
+                gx[n+300] = sx * gx[n+288] + gx[n+312];
+                gx[n+208] = rx * gx[n+204] + gx[n+300];
+                gx[n+116] = rx * gx[n+112] + gx[n+208];
+                gx[n+220] = rx * gx[n+216] + gx[n+312];
+                gx[n+128] = rx * gx[n+124] + gx[n+220];
+                gx[n+336] = c00x * gx[n+240] + 2 * b10 * gx[n+144] + 2 * b00 * gx[n+216];
+                gx[n+324] = sx * gx[n+312] + gx[n+336];
+                gx[n+232] = rx * gx[n+228] + gx[n+324];
+                gx[n+140] = rx * gx[n+136] + gx[n+232];
+                gx[n+244] = rx * gx[n+240] + gx[n+336];
+                gx[n+152] = rx * gx[n+148] + gx[n+244];
+                gx[n+360] = c00x * gx[n+264] + 2 * b10 * gx[n+168] + 3 * b00 * gx[n+240];
+                gx[n+348] = sx * gx[n+336] + gx[n+360];
+                gx[n+256] = rx * gx[n+252] + gx[n+348];
+                gx[n+164] = rx * gx[n+160] + gx[n+256];
+                gx[n+384] = c00x * gx[n+288] + 3 * b10 * gx[n+192];
+                gx[n+292] = rx * gx[n+288] + gx[n+384];
+                gx[n+200] = rx * gx[n+196] + gx[n+292];
+                gx[n+408] = c00x * gx[n+312] + 3 * b10 * gx[n+216] + b00 * gx[n+288];
+                gx[n+396] = sx * gx[n+384] + gx[n+408];
+                gx[n+304] = rx * gx[n+300] + gx[n+396];
+                gx[n+212] = rx * gx[n+208] + gx[n+304];
+                gx[n+316] = rx * gx[n+312] + gx[n+408];
+                gx[n+224] = rx * gx[n+220] + gx[n+316];
+                gx[n+432] = c00x * gx[n+336] + 3 * b10 * gx[n+240] + 2 * b00 * gx[n+312];
+                gx[n+420] = sx * gx[n+408] + gx[n+432];
+                gx[n+328] = rx * gx[n+324] + gx[n+420];
+                gx[n+236] = rx * gx[n+232] + gx[n+328];
+                gx[n+340] = rx * gx[n+336] + gx[n+432];
+                gx[n+248] = rx * gx[n+244] + gx[n+340];
+                gx[n+456] = c00x * gx[n+360] + 3 * b10 * gx[n+264] + 3 * b00 * gx[n+336];
+                gx[n+444] = sx * gx[n+432] + gx[n+456];
+                gx[n+352] = rx * gx[n+348] + gx[n+444];
+                gx[n+260] = rx * gx[n+256] + gx[n+352];
+                gy[n+96] = c00y;
+                gy[n+4] = ry + gy[n+96];
+                gy[n+192] = c00y * gy[n+96] + b10;
+                gy[n+100] = ry * gy[n+96] + gy[n+192];
+                gy[n+8] = ry * gy[n+4] + gy[n+100];
+                gy[n+24] = c0py;
+                gy[n+12] = sy + gy[n+24];
+                gy[n+120] = c00y * gy[n+24] + b00;
+                gy[n+108] = sy * gy[n+96] + gy[n+120];
+                gy[n+16] = ry * gy[n+12] + gy[n+108];
+                gy[n+216] = c00y * gy[n+120] + b10 * gy[n+24] + b00 * gy[n+96];
+                gy[n+204] = sy * gy[n+192] + gy[n+216];
+                gy[n+112] = ry * gy[n+108] + gy[n+204];
+                gy[n+20] = ry * gy[n+16] + gy[n+112];
+                gy[n+28] = ry * gy[n+24] + gy[n+120];
+                gy[n+124] = ry * gy[n+120] + gy[n+216];
+                gy[n+32] = ry * gy[n+28] + gy[n+124];
+                gy[n+48] = c0py * gy[n+24] + b01;
+                gy[n+36] = sy * gy[n+24] + gy[n+48];
+                gy[n+144] = c00y * gy[n+48] + 2 * b00 * gy[n+24];
+                gy[n+132] = sy * gy[n+120] + gy[n+144];
+                gy[n+40] = ry * gy[n+36] + gy[n+132];
+                gy[n+240] = c00y * gy[n+144] + b10 * gy[n+48] + 2 * b00 * gy[n+120];
+                gy[n+228] = sy * gy[n+216] + gy[n+240];
+                gy[n+136] = ry * gy[n+132] + gy[n+228];
+                gy[n+44] = ry * gy[n+40] + gy[n+136];
+                gy[n+52] = ry * gy[n+48] + gy[n+144];
+                gy[n+148] = ry * gy[n+144] + gy[n+240];
+                gy[n+56] = ry * gy[n+52] + gy[n+148];
+                gy[n+72] = c0py * gy[n+48] + 2 * b01 * gy[n+24];
+                gy[n+60] = sy * gy[n+48] + gy[n+72];
+                gy[n+168] = c00y * gy[n+72] + 3 * b00 * gy[n+48];
+                gy[n+156] = sy * gy[n+144] + gy[n+168];
+                gy[n+64] = ry * gy[n+60] + gy[n+156];
+                gy[n+264] = c00y * gy[n+168] + b10 * gy[n+72] + 3 * b00 * gy[n+144];
+                gy[n+252] = sy * gy[n+240] + gy[n+264];
+                gy[n+160] = ry * gy[n+156] + gy[n+252];
+                gy[n+68] = ry * gy[n+64] + gy[n+160];
+                gy[n+288] = c00y * gy[n+192] + 2 * b10 * gy[n+96];
+                gy[n+196] = ry * gy[n+192] + gy[n+288];
+                gy[n+104] = ry * gy[n+100] + gy[n+196];
+                gy[n+312] = c00y * gy[n+216] + 2 * b10 * gy[n+120] + b00 * gy[n+192];
+                gy[n+300] = sy * gy[n+288] + gy[n+312];
+                gy[n+208] = ry * gy[n+204] + gy[n+300];
+                gy[n+116] = ry * gy[n+112] + gy[n+208];
+                gy[n+220] = ry * gy[n+216] + gy[n+312];
+                gy[n+128] = ry * gy[n+124] + gy[n+220];
+                gy[n+336] = c00y * gy[n+240] + 2 * b10 * gy[n+144] + 2 * b00 * gy[n+216];
+                gy[n+324] = sy * gy[n+312] + gy[n+336];
+                gy[n+232] = ry * gy[n+228] + gy[n+324];
+                gy[n+140] = ry * gy[n+136] + gy[n+232];
+                gy[n+244] = ry * gy[n+240] + gy[n+336];
+                gy[n+152] = ry * gy[n+148] + gy[n+244];
+                gy[n+360] = c00y * gy[n+264] + 2 * b10 * gy[n+168] + 3 * b00 * gy[n+240];
+                gy[n+348] = sy * gy[n+336] + gy[n+360];
+                gy[n+256] = ry * gy[n+252] + gy[n+348];
+                gy[n+164] = ry * gy[n+160] + gy[n+256];
+                gy[n+384] = c00y * gy[n+288] + 3 * b10 * gy[n+192];
+                gy[n+292] = ry * gy[n+288] + gy[n+384];
+                gy[n+200] = ry * gy[n+196] + gy[n+292];
+                gy[n+408] = c00y * gy[n+312] + 3 * b10 * gy[n+216] + b00 * gy[n+288];
+                gy[n+396] = sy * gy[n+384] + gy[n+408];
+                gy[n+304] = ry * gy[n+300] + gy[n+396];
+                gy[n+212] = ry * gy[n+208] + gy[n+304];
+                gy[n+316] = ry * gy[n+312] + gy[n+408];
+                gy[n+224] = ry * gy[n+220] + gy[n+316];
+                gy[n+432] = c00y * gy[n+336] + 3 * b10 * gy[n+240] + 2 * b00 * gy[n+312];
+                gy[n+420] = sy * gy[n+408] + gy[n+432];
+                gy[n+328] = ry * gy[n+324] + gy[n+420];
+                gy[n+236] = ry * gy[n+232] + gy[n+328];
+                gy[n+340] = ry * gy[n+336] + gy[n+432];
+                gy[n+248] = ry * gy[n+244] + gy[n+340];
+                gy[n+456] = c00y * gy[n+360] + 3 * b10 * gy[n+264] + 3 * b00 * gy[n+336];
+                gy[n+444] = sy * gy[n+432] + gy[n+456];
+                gy[n+352] = ry * gy[n+348] + gy[n+444];
+                gy[n+260] = ry * gy[n+256] + gy[n+352];
+                gz[n+96] = c00z * gz[n+0];
+                gz[n+4] = rz * gz[n+0] + gz[n+96];
+                gz[n+192] = c00z * gz[n+96] + b10 * gz[n+0];
+                gz[n+100] = rz * gz[n+96] + gz[n+192];
+                gz[n+8] = rz * gz[n+4] + gz[n+100];
+                gz[n+24] = c0pz * gz[n+0];
+                gz[n+12] = sz * gz[n+0] + gz[n+24];
+                gz[n+120] = c00z * gz[n+24] + b00 * gz[n+0];
+                gz[n+108] = sz * gz[n+96] + gz[n+120];
+                gz[n+16] = rz * gz[n+12] + gz[n+108];
+                gz[n+216] = c00z * gz[n+120] + b10 * gz[n+24] + b00 * gz[n+96];
+                gz[n+204] = sz * gz[n+192] + gz[n+216];
+                gz[n+112] = rz * gz[n+108] + gz[n+204];
+                gz[n+20] = rz * gz[n+16] + gz[n+112];
+                gz[n+28] = rz * gz[n+24] + gz[n+120];
+                gz[n+124] = rz * gz[n+120] + gz[n+216];
+                gz[n+32] = rz * gz[n+28] + gz[n+124];
+                gz[n+48] = c0pz * gz[n+24] + b01 * gz[n+0];
+                gz[n+36] = sz * gz[n+24] + gz[n+48];
+                gz[n+144] = c00z * gz[n+48] + 2 * b00 * gz[n+24];
+                gz[n+132] = sz * gz[n+120] + gz[n+144];
+                gz[n+40] = rz * gz[n+36] + gz[n+132];
+                gz[n+240] = c00z * gz[n+144] + b10 * gz[n+48] + 2 * b00 * gz[n+120];
+                gz[n+228] = sz * gz[n+216] + gz[n+240];
+                gz[n+136] = rz * gz[n+132] + gz[n+228];
+                gz[n+44] = rz * gz[n+40] + gz[n+136];
+                gz[n+52] = rz * gz[n+48] + gz[n+144];
+                gz[n+148] = rz * gz[n+144] + gz[n+240];
+                gz[n+56] = rz * gz[n+52] + gz[n+148];
+                gz[n+72] = c0pz * gz[n+48] + 2 * b01 * gz[n+24];
+                gz[n+60] = sz * gz[n+48] + gz[n+72];
+                gz[n+168] = c00z * gz[n+72] + 3 * b00 * gz[n+48];
+                gz[n+156] = sz * gz[n+144] + gz[n+168];
+                gz[n+64] = rz * gz[n+60] + gz[n+156];
+                gz[n+264] = c00z * gz[n+168] + b10 * gz[n+72] + 3 * b00 * gz[n+144];
+                gz[n+252] = sz * gz[n+240] + gz[n+264];
+                gz[n+160] = rz * gz[n+156] + gz[n+252];
+                gz[n+68] = rz * gz[n+64] + gz[n+160];
+                gz[n+288] = c00z * gz[n+192] + 2 * b10 * gz[n+96];
+                gz[n+196] = rz * gz[n+192] + gz[n+288];
+                gz[n+104] = rz * gz[n+100] + gz[n+196];
+                gz[n+312] = c00z * gz[n+216] + 2 * b10 * gz[n+120] + b00 * gz[n+192];
+                gz[n+300] = sz * gz[n+288] + gz[n+312];
+                gz[n+208] = rz * gz[n+204] + gz[n+300];
+                gz[n+116] = rz * gz[n+112] + gz[n+208];
+                gz[n+220] = rz * gz[n+216] + gz[n+312];
+                gz[n+128] = rz * gz[n+124] + gz[n+220];
+                gz[n+336] = c00z * gz[n+240] + 2 * b10 * gz[n+144] + 2 * b00 * gz[n+216];
+                gz[n+324] = sz * gz[n+312] + gz[n+336];
+                gz[n+232] = rz * gz[n+228] + gz[n+324];
+                gz[n+140] = rz * gz[n+136] + gz[n+232];
+                gz[n+244] = rz * gz[n+240] + gz[n+336];
+                gz[n+152] = rz * gz[n+148] + gz[n+244];
+                gz[n+360] = c00z * gz[n+264] + 2 * b10 * gz[n+168] + 3 * b00 * gz[n+240];
+                gz[n+348] = sz * gz[n+336] + gz[n+360];
+                gz[n+256] = rz * gz[n+252] + gz[n+348];
+                gz[n+164] = rz * gz[n+160] + gz[n+256];
+                gz[n+384] = c00z * gz[n+288] + 3 * b10 * gz[n+192];
+                gz[n+292] = rz * gz[n+288] + gz[n+384];
+                gz[n+200] = rz * gz[n+196] + gz[n+292];
+                gz[n+408] = c00z * gz[n+312] + 3 * b10 * gz[n+216] + b00 * gz[n+288];
+                gz[n+396] = sz * gz[n+384] + gz[n+408];
+                gz[n+304] = rz * gz[n+300] + gz[n+396];
+                gz[n+212] = rz * gz[n+208] + gz[n+304];
+                gz[n+316] = rz * gz[n+312] + gz[n+408];
+                gz[n+224] = rz * gz[n+220] + gz[n+316];
+                gz[n+432] = c00z * gz[n+336] + 3 * b10 * gz[n+240] + 2 * b00 * gz[n+312];
+                gz[n+420] = sz * gz[n+408] + gz[n+432];
+                gz[n+328] = rz * gz[n+324] + gz[n+420];
+                gz[n+236] = rz * gz[n+232] + gz[n+328];
+                gz[n+340] = rz * gz[n+336] + gz[n+432];
+                gz[n+248] = rz * gz[n+244] + gz[n+340];
+                gz[n+456] = c00z * gz[n+360] + 3 * b10 * gz[n+264] + 3 * b00 * gz[n+336];
+                gz[n+444] = sz * gz[n+432] + gz[n+456];
+                gz[n+352] = rz * gz[n+348] + gz[n+444];
+                gz[n+260] = rz * gz[n+256] + gz[n+352];
+        }
+}
+static void _gout_2212(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 480;
+        double *gz = g + 960;
+        GOUT(0, _g2_4(gx+260, gz+0));
+        GOUT(1, _g3_4(gx+256, gy+4, gz+0));
+        GOUT(2, _g2_4(gx+256, gz+4));
+        GOUT(3, _g3_4(gx+252, gy+8, gz+0));
+        GOUT(4, _g3_4(gx+252, gy+4, gz+4));
+        GOUT(5, _g2_4(gx+252, gz+8));
+        GOUT(6, _g3_4(gx+248, gy+12, gz+0));
+        GOUT(7, _g3_4(gx+244, gy+16, gz+0));
+        GOUT(8, _g3_4(gx+244, gy+12, gz+4));
+        GOUT(9, _g3_4(gx+240, gy+20, gz+0));
+        GOUT(10, _g3_4(gx+240, gy+16, gz+4));
+        GOUT(11, _g3_4(gx+240, gy+12, gz+8));
+        GOUT(12, _g2_4(gx+248, gz+12));
+        GOUT(13, _g3_4(gx+244, gy+4, gz+12));
+        GOUT(14, _g2_4(gx+244, gz+16));
+        GOUT(15, _g3_4(gx+240, gy+8, gz+12));
+        GOUT(16, _g3_4(gx+240, gy+4, gz+16));
+        GOUT(17, _g2_4(gx+240, gz+20));
+        GOUT(18, _g3_4(gx+236, gy+24, gz+0));
+        GOUT(19, _g3_4(gx+232, gy+28, gz+0));
+        GOUT(20, _g3_4(gx+232, gy+24, gz+4));
+        GOUT(21, _g3_4(gx+228, gy+32, gz+0));
+        GOUT(22, _g3_4(gx+228, gy+28, gz+4));
+        GOUT(23, _g3_4(gx+228, gy+24, gz+8));
+        GOUT(24, _g3_4(gx+224, gy+36, gz+0));
+        GOUT(25, _g3_4(gx+220, gy+40, gz+0));
+        GOUT(26, _g3_4(gx+220, gy+36, gz+4));
+        GOUT(27, _g3_4(gx+216, gy+44, gz+0));
+        GOUT(28, _g3_4(gx+216, gy+40, gz+4));
+        GOUT(29, _g3_4(gx+216, gy+36, gz+8));
+        GOUT(30, _g3_4(gx+224, gy+24, gz+12));
+        GOUT(31, _g3_4(gx+220, gy+28, gz+12));
+        GOUT(32, _g3_4(gx+220, gy+24, gz+16));
+        GOUT(33, _g3_4(gx+216, gy+32, gz+12));
+        GOUT(34, _g3_4(gx+216, gy+28, gz+16));
+        GOUT(35, _g3_4(gx+216, gy+24, gz+20));
+        GOUT(36, _g2_4(gx+236, gz+24));
+        GOUT(37, _g3_4(gx+232, gy+4, gz+24));
+        GOUT(38, _g2_4(gx+232, gz+28));
+        GOUT(39, _g3_4(gx+228, gy+8, gz+24));
+        GOUT(40, _g3_4(gx+228, gy+4, gz+28));
+        GOUT(41, _g2_4(gx+228, gz+32));
+        GOUT(42, _g3_4(gx+224, gy+12, gz+24));
+        GOUT(43, _g3_4(gx+220, gy+16, gz+24));
+        GOUT(44, _g3_4(gx+220, gy+12, gz+28));
+        GOUT(45, _g3_4(gx+216, gy+20, gz+24));
+        GOUT(46, _g3_4(gx+216, gy+16, gz+28));
+        GOUT(47, _g3_4(gx+216, gy+12, gz+32));
+        GOUT(48, _g2_4(gx+224, gz+36));
+        GOUT(49, _g3_4(gx+220, gy+4, gz+36));
+        GOUT(50, _g2_4(gx+220, gz+40));
+        GOUT(51, _g3_4(gx+216, gy+8, gz+36));
+        GOUT(52, _g3_4(gx+216, gy+4, gz+40));
+        GOUT(53, _g2_4(gx+216, gz+44));
+        GOUT(54, _g3_4(gx+212, gy+48, gz+0));
+        GOUT(55, _g3_4(gx+208, gy+52, gz+0));
+        GOUT(56, _g3_4(gx+208, gy+48, gz+4));
+        GOUT(57, _g3_4(gx+204, gy+56, gz+0));
+        GOUT(58, _g3_4(gx+204, gy+52, gz+4));
+        GOUT(59, _g3_4(gx+204, gy+48, gz+8));
+        GOUT(60, _g3_4(gx+200, gy+60, gz+0));
+        GOUT(61, _g3_4(gx+196, gy+64, gz+0));
+        GOUT(62, _g3_4(gx+196, gy+60, gz+4));
+        GOUT(63, _g3_4(gx+192, gy+68, gz+0));
+        GOUT(64, _g3_4(gx+192, gy+64, gz+4));
+        GOUT(65, _g3_4(gx+192, gy+60, gz+8));
+        GOUT(66, _g3_4(gx+200, gy+48, gz+12));
+        GOUT(67, _g3_4(gx+196, gy+52, gz+12));
+        GOUT(68, _g3_4(gx+196, gy+48, gz+16));
+        GOUT(69, _g3_4(gx+192, gy+56, gz+12));
+        GOUT(70, _g3_4(gx+192, gy+52, gz+16));
+        GOUT(71, _g3_4(gx+192, gy+48, gz+20));
+        GOUT(72, _g3_4(gx+212, gy+24, gz+24));
+        GOUT(73, _g3_4(gx+208, gy+28, gz+24));
+        GOUT(74, _g3_4(gx+208, gy+24, gz+28));
+        GOUT(75, _g3_4(gx+204, gy+32, gz+24));
+        GOUT(76, _g3_4(gx+204, gy+28, gz+28));
+        GOUT(77, _g3_4(gx+204, gy+24, gz+32));
+        GOUT(78, _g3_4(gx+200, gy+36, gz+24));
+        GOUT(79, _g3_4(gx+196, gy+40, gz+24));
+        GOUT(80, _g3_4(gx+196, gy+36, gz+28));
+        GOUT(81, _g3_4(gx+192, gy+44, gz+24));
+        GOUT(82, _g3_4(gx+192, gy+40, gz+28));
+        GOUT(83, _g3_4(gx+192, gy+36, gz+32));
+        GOUT(84, _g3_4(gx+200, gy+24, gz+36));
+        GOUT(85, _g3_4(gx+196, gy+28, gz+36));
+        GOUT(86, _g3_4(gx+196, gy+24, gz+40));
+        GOUT(87, _g3_4(gx+192, gy+32, gz+36));
+        GOUT(88, _g3_4(gx+192, gy+28, gz+40));
+        GOUT(89, _g3_4(gx+192, gy+24, gz+44));
+        GOUT(90, _g2_4(gx+212, gz+48));
+        GOUT(91, _g3_4(gx+208, gy+4, gz+48));
+        GOUT(92, _g2_4(gx+208, gz+52));
+        GOUT(93, _g3_4(gx+204, gy+8, gz+48));
+        GOUT(94, _g3_4(gx+204, gy+4, gz+52));
+        GOUT(95, _g2_4(gx+204, gz+56));
+        GOUT(96, _g3_4(gx+200, gy+12, gz+48));
+        GOUT(97, _g3_4(gx+196, gy+16, gz+48));
+        GOUT(98, _g3_4(gx+196, gy+12, gz+52));
+        GOUT(99, _g3_4(gx+192, gy+20, gz+48));
+        GOUT(100, _g3_4(gx+192, gy+16, gz+52));
+        GOUT(101, _g3_4(gx+192, gy+12, gz+56));
+        GOUT(102, _g2_4(gx+200, gz+60));
+        GOUT(103, _g3_4(gx+196, gy+4, gz+60));
+        GOUT(104, _g2_4(gx+196, gz+64));
+        GOUT(105, _g3_4(gx+192, gy+8, gz+60));
+        GOUT(106, _g3_4(gx+192, gy+4, gz+64));
+        GOUT(107, _g2_4(gx+192, gz+68));
+        GOUT(108, _g3_4(gx+164, gy+96, gz+0));
+        GOUT(109, _g3_4(gx+160, gy+100, gz+0));
+        GOUT(110, _g3_4(gx+160, gy+96, gz+4));
+        GOUT(111, _g3_4(gx+156, gy+104, gz+0));
+        GOUT(112, _g3_4(gx+156, gy+100, gz+4));
+        GOUT(113, _g3_4(gx+156, gy+96, gz+8));
+        GOUT(114, _g3_4(gx+152, gy+108, gz+0));
+        GOUT(115, _g3_4(gx+148, gy+112, gz+0));
+        GOUT(116, _g3_4(gx+148, gy+108, gz+4));
+        GOUT(117, _g3_4(gx+144, gy+116, gz+0));
+        GOUT(118, _g3_4(gx+144, gy+112, gz+4));
+        GOUT(119, _g3_4(gx+144, gy+108, gz+8));
+        GOUT(120, _g3_4(gx+152, gy+96, gz+12));
+        GOUT(121, _g3_4(gx+148, gy+100, gz+12));
+        GOUT(122, _g3_4(gx+148, gy+96, gz+16));
+        GOUT(123, _g3_4(gx+144, gy+104, gz+12));
+        GOUT(124, _g3_4(gx+144, gy+100, gz+16));
+        GOUT(125, _g3_4(gx+144, gy+96, gz+20));
+        GOUT(126, _g3_4(gx+140, gy+120, gz+0));
+        GOUT(127, _g3_4(gx+136, gy+124, gz+0));
+        GOUT(128, _g3_4(gx+136, gy+120, gz+4));
+        GOUT(129, _g3_4(gx+132, gy+128, gz+0));
+        GOUT(130, _g3_4(gx+132, gy+124, gz+4));
+        GOUT(131, _g3_4(gx+132, gy+120, gz+8));
+        GOUT(132, _g3_4(gx+128, gy+132, gz+0));
+        GOUT(133, _g3_4(gx+124, gy+136, gz+0));
+        GOUT(134, _g3_4(gx+124, gy+132, gz+4));
+        GOUT(135, _g3_4(gx+120, gy+140, gz+0));
+        GOUT(136, _g3_4(gx+120, gy+136, gz+4));
+        GOUT(137, _g3_4(gx+120, gy+132, gz+8));
+        GOUT(138, _g3_4(gx+128, gy+120, gz+12));
+        GOUT(139, _g3_4(gx+124, gy+124, gz+12));
+        GOUT(140, _g3_4(gx+124, gy+120, gz+16));
+        GOUT(141, _g3_4(gx+120, gy+128, gz+12));
+        GOUT(142, _g3_4(gx+120, gy+124, gz+16));
+        GOUT(143, _g3_4(gx+120, gy+120, gz+20));
+        GOUT(144, _g3_4(gx+140, gy+96, gz+24));
+        GOUT(145, _g3_4(gx+136, gy+100, gz+24));
+        GOUT(146, _g3_4(gx+136, gy+96, gz+28));
+        GOUT(147, _g3_4(gx+132, gy+104, gz+24));
+        GOUT(148, _g3_4(gx+132, gy+100, gz+28));
+        GOUT(149, _g3_4(gx+132, gy+96, gz+32));
+        GOUT(150, _g3_4(gx+128, gy+108, gz+24));
+        GOUT(151, _g3_4(gx+124, gy+112, gz+24));
+        GOUT(152, _g3_4(gx+124, gy+108, gz+28));
+        GOUT(153, _g3_4(gx+120, gy+116, gz+24));
+        GOUT(154, _g3_4(gx+120, gy+112, gz+28));
+        GOUT(155, _g3_4(gx+120, gy+108, gz+32));
+        GOUT(156, _g3_4(gx+128, gy+96, gz+36));
+        GOUT(157, _g3_4(gx+124, gy+100, gz+36));
+        GOUT(158, _g3_4(gx+124, gy+96, gz+40));
+        GOUT(159, _g3_4(gx+120, gy+104, gz+36));
+        GOUT(160, _g3_4(gx+120, gy+100, gz+40));
+        GOUT(161, _g3_4(gx+120, gy+96, gz+44));
+        GOUT(162, _g3_4(gx+116, gy+144, gz+0));
+        GOUT(163, _g3_4(gx+112, gy+148, gz+0));
+        GOUT(164, _g3_4(gx+112, gy+144, gz+4));
+        GOUT(165, _g3_4(gx+108, gy+152, gz+0));
+        GOUT(166, _g3_4(gx+108, gy+148, gz+4));
+        GOUT(167, _g3_4(gx+108, gy+144, gz+8));
+        GOUT(168, _g3_4(gx+104, gy+156, gz+0));
+        GOUT(169, _g3_4(gx+100, gy+160, gz+0));
+        GOUT(170, _g3_4(gx+100, gy+156, gz+4));
+        GOUT(171, _g3_4(gx+96, gy+164, gz+0));
+        GOUT(172, _g3_4(gx+96, gy+160, gz+4));
+        GOUT(173, _g3_4(gx+96, gy+156, gz+8));
+        GOUT(174, _g3_4(gx+104, gy+144, gz+12));
+        GOUT(175, _g3_4(gx+100, gy+148, gz+12));
+        GOUT(176, _g3_4(gx+100, gy+144, gz+16));
+        GOUT(177, _g3_4(gx+96, gy+152, gz+12));
+        GOUT(178, _g3_4(gx+96, gy+148, gz+16));
+        GOUT(179, _g3_4(gx+96, gy+144, gz+20));
+        GOUT(180, _g3_4(gx+116, gy+120, gz+24));
+        GOUT(181, _g3_4(gx+112, gy+124, gz+24));
+        GOUT(182, _g3_4(gx+112, gy+120, gz+28));
+        GOUT(183, _g3_4(gx+108, gy+128, gz+24));
+        GOUT(184, _g3_4(gx+108, gy+124, gz+28));
+        GOUT(185, _g3_4(gx+108, gy+120, gz+32));
+        GOUT(186, _g3_4(gx+104, gy+132, gz+24));
+        GOUT(187, _g3_4(gx+100, gy+136, gz+24));
+        GOUT(188, _g3_4(gx+100, gy+132, gz+28));
+        GOUT(189, _g3_4(gx+96, gy+140, gz+24));
+        GOUT(190, _g3_4(gx+96, gy+136, gz+28));
+        GOUT(191, _g3_4(gx+96, gy+132, gz+32));
+        GOUT(192, _g3_4(gx+104, gy+120, gz+36));
+        GOUT(193, _g3_4(gx+100, gy+124, gz+36));
+        GOUT(194, _g3_4(gx+100, gy+120, gz+40));
+        GOUT(195, _g3_4(gx+96, gy+128, gz+36));
+        GOUT(196, _g3_4(gx+96, gy+124, gz+40));
+        GOUT(197, _g3_4(gx+96, gy+120, gz+44));
+        GOUT(198, _g3_4(gx+116, gy+96, gz+48));
+        GOUT(199, _g3_4(gx+112, gy+100, gz+48));
+        GOUT(200, _g3_4(gx+112, gy+96, gz+52));
+        GOUT(201, _g3_4(gx+108, gy+104, gz+48));
+        GOUT(202, _g3_4(gx+108, gy+100, gz+52));
+        GOUT(203, _g3_4(gx+108, gy+96, gz+56));
+        GOUT(204, _g3_4(gx+104, gy+108, gz+48));
+        GOUT(205, _g3_4(gx+100, gy+112, gz+48));
+        GOUT(206, _g3_4(gx+100, gy+108, gz+52));
+        GOUT(207, _g3_4(gx+96, gy+116, gz+48));
+        GOUT(208, _g3_4(gx+96, gy+112, gz+52));
+        GOUT(209, _g3_4(gx+96, gy+108, gz+56));
+        GOUT(210, _g3_4(gx+104, gy+96, gz+60));
+        GOUT(211, _g3_4(gx+100, gy+100, gz+60));
+        GOUT(212, _g3_4(gx+100, gy+96, gz+64));
+        GOUT(213, _g3_4(gx+96, gy+104, gz+60));
+        GOUT(214, _g3_4(gx+96, gy+100, gz+64));
+        GOUT(215, _g3_4(gx+96, gy+96, gz+68));
+        GOUT(216, _g2_4(gx+164, gz+96));
+        GOUT(217, _g3_4(gx+160, gy+4, gz+96));
+        GOUT(218, _g2_4(gx+160, gz+100));
+        GOUT(219, _g3_4(gx+156, gy+8, gz+96));
+        GOUT(220, _g3_4(gx+156, gy+4, gz+100));
+        GOUT(221, _g2_4(gx+156, gz+104));
+        GOUT(222, _g3_4(gx+152, gy+12, gz+96));
+        GOUT(223, _g3_4(gx+148, gy+16, gz+96));
+        GOUT(224, _g3_4(gx+148, gy+12, gz+100));
+        GOUT(225, _g3_4(gx+144, gy+20, gz+96));
+        GOUT(226, _g3_4(gx+144, gy+16, gz+100));
+        GOUT(227, _g3_4(gx+144, gy+12, gz+104));
+        GOUT(228, _g2_4(gx+152, gz+108));
+        GOUT(229, _g3_4(gx+148, gy+4, gz+108));
+        GOUT(230, _g2_4(gx+148, gz+112));
+        GOUT(231, _g3_4(gx+144, gy+8, gz+108));
+        GOUT(232, _g3_4(gx+144, gy+4, gz+112));
+        GOUT(233, _g2_4(gx+144, gz+116));
+        GOUT(234, _g3_4(gx+140, gy+24, gz+96));
+        GOUT(235, _g3_4(gx+136, gy+28, gz+96));
+        GOUT(236, _g3_4(gx+136, gy+24, gz+100));
+        GOUT(237, _g3_4(gx+132, gy+32, gz+96));
+        GOUT(238, _g3_4(gx+132, gy+28, gz+100));
+        GOUT(239, _g3_4(gx+132, gy+24, gz+104));
+        GOUT(240, _g3_4(gx+128, gy+36, gz+96));
+        GOUT(241, _g3_4(gx+124, gy+40, gz+96));
+        GOUT(242, _g3_4(gx+124, gy+36, gz+100));
+        GOUT(243, _g3_4(gx+120, gy+44, gz+96));
+        GOUT(244, _g3_4(gx+120, gy+40, gz+100));
+        GOUT(245, _g3_4(gx+120, gy+36, gz+104));
+        GOUT(246, _g3_4(gx+128, gy+24, gz+108));
+        GOUT(247, _g3_4(gx+124, gy+28, gz+108));
+        GOUT(248, _g3_4(gx+124, gy+24, gz+112));
+        GOUT(249, _g3_4(gx+120, gy+32, gz+108));
+        GOUT(250, _g3_4(gx+120, gy+28, gz+112));
+        GOUT(251, _g3_4(gx+120, gy+24, gz+116));
+        GOUT(252, _g2_4(gx+140, gz+120));
+        GOUT(253, _g3_4(gx+136, gy+4, gz+120));
+        GOUT(254, _g2_4(gx+136, gz+124));
+        GOUT(255, _g3_4(gx+132, gy+8, gz+120));
+        GOUT(256, _g3_4(gx+132, gy+4, gz+124));
+        GOUT(257, _g2_4(gx+132, gz+128));
+        GOUT(258, _g3_4(gx+128, gy+12, gz+120));
+        GOUT(259, _g3_4(gx+124, gy+16, gz+120));
+        GOUT(260, _g3_4(gx+124, gy+12, gz+124));
+        GOUT(261, _g3_4(gx+120, gy+20, gz+120));
+        GOUT(262, _g3_4(gx+120, gy+16, gz+124));
+        GOUT(263, _g3_4(gx+120, gy+12, gz+128));
+        GOUT(264, _g2_4(gx+128, gz+132));
+        GOUT(265, _g3_4(gx+124, gy+4, gz+132));
+        GOUT(266, _g2_4(gx+124, gz+136));
+        GOUT(267, _g3_4(gx+120, gy+8, gz+132));
+        GOUT(268, _g3_4(gx+120, gy+4, gz+136));
+        GOUT(269, _g2_4(gx+120, gz+140));
+        GOUT(270, _g3_4(gx+116, gy+48, gz+96));
+        GOUT(271, _g3_4(gx+112, gy+52, gz+96));
+        GOUT(272, _g3_4(gx+112, gy+48, gz+100));
+        GOUT(273, _g3_4(gx+108, gy+56, gz+96));
+        GOUT(274, _g3_4(gx+108, gy+52, gz+100));
+        GOUT(275, _g3_4(gx+108, gy+48, gz+104));
+        GOUT(276, _g3_4(gx+104, gy+60, gz+96));
+        GOUT(277, _g3_4(gx+100, gy+64, gz+96));
+        GOUT(278, _g3_4(gx+100, gy+60, gz+100));
+        GOUT(279, _g3_4(gx+96, gy+68, gz+96));
+        GOUT(280, _g3_4(gx+96, gy+64, gz+100));
+        GOUT(281, _g3_4(gx+96, gy+60, gz+104));
+        GOUT(282, _g3_4(gx+104, gy+48, gz+108));
+        GOUT(283, _g3_4(gx+100, gy+52, gz+108));
+        GOUT(284, _g3_4(gx+100, gy+48, gz+112));
+        GOUT(285, _g3_4(gx+96, gy+56, gz+108));
+        GOUT(286, _g3_4(gx+96, gy+52, gz+112));
+        GOUT(287, _g3_4(gx+96, gy+48, gz+116));
+        GOUT(288, _g3_4(gx+116, gy+24, gz+120));
+        GOUT(289, _g3_4(gx+112, gy+28, gz+120));
+        GOUT(290, _g3_4(gx+112, gy+24, gz+124));
+        GOUT(291, _g3_4(gx+108, gy+32, gz+120));
+        GOUT(292, _g3_4(gx+108, gy+28, gz+124));
+        GOUT(293, _g3_4(gx+108, gy+24, gz+128));
+        GOUT(294, _g3_4(gx+104, gy+36, gz+120));
+        GOUT(295, _g3_4(gx+100, gy+40, gz+120));
+        GOUT(296, _g3_4(gx+100, gy+36, gz+124));
+        GOUT(297, _g3_4(gx+96, gy+44, gz+120));
+        GOUT(298, _g3_4(gx+96, gy+40, gz+124));
+        GOUT(299, _g3_4(gx+96, gy+36, gz+128));
+        GOUT(300, _g3_4(gx+104, gy+24, gz+132));
+        GOUT(301, _g3_4(gx+100, gy+28, gz+132));
+        GOUT(302, _g3_4(gx+100, gy+24, gz+136));
+        GOUT(303, _g3_4(gx+96, gy+32, gz+132));
+        GOUT(304, _g3_4(gx+96, gy+28, gz+136));
+        GOUT(305, _g3_4(gx+96, gy+24, gz+140));
+        GOUT(306, _g2_4(gx+116, gz+144));
+        GOUT(307, _g3_4(gx+112, gy+4, gz+144));
+        GOUT(308, _g2_4(gx+112, gz+148));
+        GOUT(309, _g3_4(gx+108, gy+8, gz+144));
+        GOUT(310, _g3_4(gx+108, gy+4, gz+148));
+        GOUT(311, _g2_4(gx+108, gz+152));
+        GOUT(312, _g3_4(gx+104, gy+12, gz+144));
+        GOUT(313, _g3_4(gx+100, gy+16, gz+144));
+        GOUT(314, _g3_4(gx+100, gy+12, gz+148));
+        GOUT(315, _g3_4(gx+96, gy+20, gz+144));
+        GOUT(316, _g3_4(gx+96, gy+16, gz+148));
+        GOUT(317, _g3_4(gx+96, gy+12, gz+152));
+        GOUT(318, _g2_4(gx+104, gz+156));
+        GOUT(319, _g3_4(gx+100, gy+4, gz+156));
+        GOUT(320, _g2_4(gx+100, gz+160));
+        GOUT(321, _g3_4(gx+96, gy+8, gz+156));
+        GOUT(322, _g3_4(gx+96, gy+4, gz+160));
+        GOUT(323, _g2_4(gx+96, gz+164));
+        GOUT(324, _g3_4(gx+68, gy+192, gz+0));
+        GOUT(325, _g3_4(gx+64, gy+196, gz+0));
+        GOUT(326, _g3_4(gx+64, gy+192, gz+4));
+        GOUT(327, _g3_4(gx+60, gy+200, gz+0));
+        GOUT(328, _g3_4(gx+60, gy+196, gz+4));
+        GOUT(329, _g3_4(gx+60, gy+192, gz+8));
+        GOUT(330, _g3_4(gx+56, gy+204, gz+0));
+        GOUT(331, _g3_4(gx+52, gy+208, gz+0));
+        GOUT(332, _g3_4(gx+52, gy+204, gz+4));
+        GOUT(333, _g3_4(gx+48, gy+212, gz+0));
+        GOUT(334, _g3_4(gx+48, gy+208, gz+4));
+        GOUT(335, _g3_4(gx+48, gy+204, gz+8));
+        GOUT(336, _g3_4(gx+56, gy+192, gz+12));
+        GOUT(337, _g3_4(gx+52, gy+196, gz+12));
+        GOUT(338, _g3_4(gx+52, gy+192, gz+16));
+        GOUT(339, _g3_4(gx+48, gy+200, gz+12));
+        GOUT(340, _g3_4(gx+48, gy+196, gz+16));
+        GOUT(341, _g3_4(gx+48, gy+192, gz+20));
+        GOUT(342, _g3_4(gx+44, gy+216, gz+0));
+        GOUT(343, _g3_4(gx+40, gy+220, gz+0));
+        GOUT(344, _g3_4(gx+40, gy+216, gz+4));
+        GOUT(345, _g3_4(gx+36, gy+224, gz+0));
+        GOUT(346, _g3_4(gx+36, gy+220, gz+4));
+        GOUT(347, _g3_4(gx+36, gy+216, gz+8));
+        GOUT(348, _g3_4(gx+32, gy+228, gz+0));
+        GOUT(349, _g3_4(gx+28, gy+232, gz+0));
+        GOUT(350, _g3_4(gx+28, gy+228, gz+4));
+        GOUT(351, _g3_4(gx+24, gy+236, gz+0));
+        GOUT(352, _g3_4(gx+24, gy+232, gz+4));
+        GOUT(353, _g3_4(gx+24, gy+228, gz+8));
+        GOUT(354, _g3_4(gx+32, gy+216, gz+12));
+        GOUT(355, _g3_4(gx+28, gy+220, gz+12));
+        GOUT(356, _g3_4(gx+28, gy+216, gz+16));
+        GOUT(357, _g3_4(gx+24, gy+224, gz+12));
+        GOUT(358, _g3_4(gx+24, gy+220, gz+16));
+        GOUT(359, _g3_4(gx+24, gy+216, gz+20));
+        GOUT(360, _g3_4(gx+44, gy+192, gz+24));
+        GOUT(361, _g3_4(gx+40, gy+196, gz+24));
+        GOUT(362, _g3_4(gx+40, gy+192, gz+28));
+        GOUT(363, _g3_4(gx+36, gy+200, gz+24));
+        GOUT(364, _g3_4(gx+36, gy+196, gz+28));
+        GOUT(365, _g3_4(gx+36, gy+192, gz+32));
+        GOUT(366, _g3_4(gx+32, gy+204, gz+24));
+        GOUT(367, _g3_4(gx+28, gy+208, gz+24));
+        GOUT(368, _g3_4(gx+28, gy+204, gz+28));
+        GOUT(369, _g3_4(gx+24, gy+212, gz+24));
+        GOUT(370, _g3_4(gx+24, gy+208, gz+28));
+        GOUT(371, _g3_4(gx+24, gy+204, gz+32));
+        GOUT(372, _g3_4(gx+32, gy+192, gz+36));
+        GOUT(373, _g3_4(gx+28, gy+196, gz+36));
+        GOUT(374, _g3_4(gx+28, gy+192, gz+40));
+        GOUT(375, _g3_4(gx+24, gy+200, gz+36));
+        GOUT(376, _g3_4(gx+24, gy+196, gz+40));
+        GOUT(377, _g3_4(gx+24, gy+192, gz+44));
+        GOUT(378, _g3_4(gx+20, gy+240, gz+0));
+        GOUT(379, _g3_4(gx+16, gy+244, gz+0));
+        GOUT(380, _g3_4(gx+16, gy+240, gz+4));
+        GOUT(381, _g3_4(gx+12, gy+248, gz+0));
+        GOUT(382, _g3_4(gx+12, gy+244, gz+4));
+        GOUT(383, _g3_4(gx+12, gy+240, gz+8));
+        GOUT(384, _g3_4(gx+8, gy+252, gz+0));
+        GOUT(385, _g3_4(gx+4, gy+256, gz+0));
+        GOUT(386, _g3_4(gx+4, gy+252, gz+4));
+        GOUT(387, _g2_4(gy+260, gz+0));
+        GOUT(388, _g2_4(gy+256, gz+4));
+        GOUT(389, _g2_4(gy+252, gz+8));
+        GOUT(390, _g3_4(gx+8, gy+240, gz+12));
+        GOUT(391, _g3_4(gx+4, gy+244, gz+12));
+        GOUT(392, _g3_4(gx+4, gy+240, gz+16));
+        GOUT(393, _g2_4(gy+248, gz+12));
+        GOUT(394, _g2_4(gy+244, gz+16));
+        GOUT(395, _g2_4(gy+240, gz+20));
+        GOUT(396, _g3_4(gx+20, gy+216, gz+24));
+        GOUT(397, _g3_4(gx+16, gy+220, gz+24));
+        GOUT(398, _g3_4(gx+16, gy+216, gz+28));
+        GOUT(399, _g3_4(gx+12, gy+224, gz+24));
+        GOUT(400, _g3_4(gx+12, gy+220, gz+28));
+        GOUT(401, _g3_4(gx+12, gy+216, gz+32));
+        GOUT(402, _g3_4(gx+8, gy+228, gz+24));
+        GOUT(403, _g3_4(gx+4, gy+232, gz+24));
+        GOUT(404, _g3_4(gx+4, gy+228, gz+28));
+        GOUT(405, _g2_4(gy+236, gz+24));
+        GOUT(406, _g2_4(gy+232, gz+28));
+        GOUT(407, _g2_4(gy+228, gz+32));
+        GOUT(408, _g3_4(gx+8, gy+216, gz+36));
+        GOUT(409, _g3_4(gx+4, gy+220, gz+36));
+        GOUT(410, _g3_4(gx+4, gy+216, gz+40));
+        GOUT(411, _g2_4(gy+224, gz+36));
+        GOUT(412, _g2_4(gy+220, gz+40));
+        GOUT(413, _g2_4(gy+216, gz+44));
+        GOUT(414, _g3_4(gx+20, gy+192, gz+48));
+        GOUT(415, _g3_4(gx+16, gy+196, gz+48));
+        GOUT(416, _g3_4(gx+16, gy+192, gz+52));
+        GOUT(417, _g3_4(gx+12, gy+200, gz+48));
+        GOUT(418, _g3_4(gx+12, gy+196, gz+52));
+        GOUT(419, _g3_4(gx+12, gy+192, gz+56));
+        GOUT(420, _g3_4(gx+8, gy+204, gz+48));
+        GOUT(421, _g3_4(gx+4, gy+208, gz+48));
+        GOUT(422, _g3_4(gx+4, gy+204, gz+52));
+        GOUT(423, _g2_4(gy+212, gz+48));
+        GOUT(424, _g2_4(gy+208, gz+52));
+        GOUT(425, _g2_4(gy+204, gz+56));
+        GOUT(426, _g3_4(gx+8, gy+192, gz+60));
+        GOUT(427, _g3_4(gx+4, gy+196, gz+60));
+        GOUT(428, _g3_4(gx+4, gy+192, gz+64));
+        GOUT(429, _g2_4(gy+200, gz+60));
+        GOUT(430, _g2_4(gy+196, gz+64));
+        GOUT(431, _g2_4(gy+192, gz+68));
+        GOUT(432, _g3_4(gx+68, gy+96, gz+96));
+        GOUT(433, _g3_4(gx+64, gy+100, gz+96));
+        GOUT(434, _g3_4(gx+64, gy+96, gz+100));
+        GOUT(435, _g3_4(gx+60, gy+104, gz+96));
+        GOUT(436, _g3_4(gx+60, gy+100, gz+100));
+        GOUT(437, _g3_4(gx+60, gy+96, gz+104));
+        GOUT(438, _g3_4(gx+56, gy+108, gz+96));
+        GOUT(439, _g3_4(gx+52, gy+112, gz+96));
+        GOUT(440, _g3_4(gx+52, gy+108, gz+100));
+        GOUT(441, _g3_4(gx+48, gy+116, gz+96));
+        GOUT(442, _g3_4(gx+48, gy+112, gz+100));
+        GOUT(443, _g3_4(gx+48, gy+108, gz+104));
+        GOUT(444, _g3_4(gx+56, gy+96, gz+108));
+        GOUT(445, _g3_4(gx+52, gy+100, gz+108));
+        GOUT(446, _g3_4(gx+52, gy+96, gz+112));
+        GOUT(447, _g3_4(gx+48, gy+104, gz+108));
+        GOUT(448, _g3_4(gx+48, gy+100, gz+112));
+        GOUT(449, _g3_4(gx+48, gy+96, gz+116));
+        GOUT(450, _g3_4(gx+44, gy+120, gz+96));
+        GOUT(451, _g3_4(gx+40, gy+124, gz+96));
+        GOUT(452, _g3_4(gx+40, gy+120, gz+100));
+        GOUT(453, _g3_4(gx+36, gy+128, gz+96));
+        GOUT(454, _g3_4(gx+36, gy+124, gz+100));
+        GOUT(455, _g3_4(gx+36, gy+120, gz+104));
+        GOUT(456, _g3_4(gx+32, gy+132, gz+96));
+        GOUT(457, _g3_4(gx+28, gy+136, gz+96));
+        GOUT(458, _g3_4(gx+28, gy+132, gz+100));
+        GOUT(459, _g3_4(gx+24, gy+140, gz+96));
+        GOUT(460, _g3_4(gx+24, gy+136, gz+100));
+        GOUT(461, _g3_4(gx+24, gy+132, gz+104));
+        GOUT(462, _g3_4(gx+32, gy+120, gz+108));
+        GOUT(463, _g3_4(gx+28, gy+124, gz+108));
+        GOUT(464, _g3_4(gx+28, gy+120, gz+112));
+        GOUT(465, _g3_4(gx+24, gy+128, gz+108));
+        GOUT(466, _g3_4(gx+24, gy+124, gz+112));
+        GOUT(467, _g3_4(gx+24, gy+120, gz+116));
+        GOUT(468, _g3_4(gx+44, gy+96, gz+120));
+        GOUT(469, _g3_4(gx+40, gy+100, gz+120));
+        GOUT(470, _g3_4(gx+40, gy+96, gz+124));
+        GOUT(471, _g3_4(gx+36, gy+104, gz+120));
+        GOUT(472, _g3_4(gx+36, gy+100, gz+124));
+        GOUT(473, _g3_4(gx+36, gy+96, gz+128));
+        GOUT(474, _g3_4(gx+32, gy+108, gz+120));
+        GOUT(475, _g3_4(gx+28, gy+112, gz+120));
+        GOUT(476, _g3_4(gx+28, gy+108, gz+124));
+        GOUT(477, _g3_4(gx+24, gy+116, gz+120));
+        GOUT(478, _g3_4(gx+24, gy+112, gz+124));
+        GOUT(479, _g3_4(gx+24, gy+108, gz+128));
+        GOUT(480, _g3_4(gx+32, gy+96, gz+132));
+        GOUT(481, _g3_4(gx+28, gy+100, gz+132));
+        GOUT(482, _g3_4(gx+28, gy+96, gz+136));
+        GOUT(483, _g3_4(gx+24, gy+104, gz+132));
+        GOUT(484, _g3_4(gx+24, gy+100, gz+136));
+        GOUT(485, _g3_4(gx+24, gy+96, gz+140));
+        GOUT(486, _g3_4(gx+20, gy+144, gz+96));
+        GOUT(487, _g3_4(gx+16, gy+148, gz+96));
+        GOUT(488, _g3_4(gx+16, gy+144, gz+100));
+        GOUT(489, _g3_4(gx+12, gy+152, gz+96));
+        GOUT(490, _g3_4(gx+12, gy+148, gz+100));
+        GOUT(491, _g3_4(gx+12, gy+144, gz+104));
+        GOUT(492, _g3_4(gx+8, gy+156, gz+96));
+        GOUT(493, _g3_4(gx+4, gy+160, gz+96));
+        GOUT(494, _g3_4(gx+4, gy+156, gz+100));
+        GOUT(495, _g2_4(gy+164, gz+96));
+        GOUT(496, _g2_4(gy+160, gz+100));
+        GOUT(497, _g2_4(gy+156, gz+104));
+        GOUT(498, _g3_4(gx+8, gy+144, gz+108));
+        GOUT(499, _g3_4(gx+4, gy+148, gz+108));
+        GOUT(500, _g3_4(gx+4, gy+144, gz+112));
+        GOUT(501, _g2_4(gy+152, gz+108));
+        GOUT(502, _g2_4(gy+148, gz+112));
+        GOUT(503, _g2_4(gy+144, gz+116));
+        GOUT(504, _g3_4(gx+20, gy+120, gz+120));
+        GOUT(505, _g3_4(gx+16, gy+124, gz+120));
+        GOUT(506, _g3_4(gx+16, gy+120, gz+124));
+        GOUT(507, _g3_4(gx+12, gy+128, gz+120));
+        GOUT(508, _g3_4(gx+12, gy+124, gz+124));
+        GOUT(509, _g3_4(gx+12, gy+120, gz+128));
+        GOUT(510, _g3_4(gx+8, gy+132, gz+120));
+        GOUT(511, _g3_4(gx+4, gy+136, gz+120));
+        GOUT(512, _g3_4(gx+4, gy+132, gz+124));
+        GOUT(513, _g2_4(gy+140, gz+120));
+        GOUT(514, _g2_4(gy+136, gz+124));
+        GOUT(515, _g2_4(gy+132, gz+128));
+        GOUT(516, _g3_4(gx+8, gy+120, gz+132));
+        GOUT(517, _g3_4(gx+4, gy+124, gz+132));
+        GOUT(518, _g3_4(gx+4, gy+120, gz+136));
+        GOUT(519, _g2_4(gy+128, gz+132));
+        GOUT(520, _g2_4(gy+124, gz+136));
+        GOUT(521, _g2_4(gy+120, gz+140));
+        GOUT(522, _g3_4(gx+20, gy+96, gz+144));
+        GOUT(523, _g3_4(gx+16, gy+100, gz+144));
+        GOUT(524, _g3_4(gx+16, gy+96, gz+148));
+        GOUT(525, _g3_4(gx+12, gy+104, gz+144));
+        GOUT(526, _g3_4(gx+12, gy+100, gz+148));
+        GOUT(527, _g3_4(gx+12, gy+96, gz+152));
+        GOUT(528, _g3_4(gx+8, gy+108, gz+144));
+        GOUT(529, _g3_4(gx+4, gy+112, gz+144));
+        GOUT(530, _g3_4(gx+4, gy+108, gz+148));
+        GOUT(531, _g2_4(gy+116, gz+144));
+        GOUT(532, _g2_4(gy+112, gz+148));
+        GOUT(533, _g2_4(gy+108, gz+152));
+        GOUT(534, _g3_4(gx+8, gy+96, gz+156));
+        GOUT(535, _g3_4(gx+4, gy+100, gz+156));
+        GOUT(536, _g3_4(gx+4, gy+96, gz+160));
+        GOUT(537, _g2_4(gy+104, gz+156));
+        GOUT(538, _g2_4(gy+100, gz+160));
+        GOUT(539, _g2_4(gy+96, gz+164));
+        GOUT(540, _g2_4(gx+68, gz+192));
+        GOUT(541, _g3_4(gx+64, gy+4, gz+192));
+        GOUT(542, _g2_4(gx+64, gz+196));
+        GOUT(543, _g3_4(gx+60, gy+8, gz+192));
+        GOUT(544, _g3_4(gx+60, gy+4, gz+196));
+        GOUT(545, _g2_4(gx+60, gz+200));
+        GOUT(546, _g3_4(gx+56, gy+12, gz+192));
+        GOUT(547, _g3_4(gx+52, gy+16, gz+192));
+        GOUT(548, _g3_4(gx+52, gy+12, gz+196));
+        GOUT(549, _g3_4(gx+48, gy+20, gz+192));
+        GOUT(550, _g3_4(gx+48, gy+16, gz+196));
+        GOUT(551, _g3_4(gx+48, gy+12, gz+200));
+        GOUT(552, _g2_4(gx+56, gz+204));
+        GOUT(553, _g3_4(gx+52, gy+4, gz+204));
+        GOUT(554, _g2_4(gx+52, gz+208));
+        GOUT(555, _g3_4(gx+48, gy+8, gz+204));
+        GOUT(556, _g3_4(gx+48, gy+4, gz+208));
+        GOUT(557, _g2_4(gx+48, gz+212));
+        GOUT(558, _g3_4(gx+44, gy+24, gz+192));
+        GOUT(559, _g3_4(gx+40, gy+28, gz+192));
+        GOUT(560, _g3_4(gx+40, gy+24, gz+196));
+        GOUT(561, _g3_4(gx+36, gy+32, gz+192));
+        GOUT(562, _g3_4(gx+36, gy+28, gz+196));
+        GOUT(563, _g3_4(gx+36, gy+24, gz+200));
+        GOUT(564, _g3_4(gx+32, gy+36, gz+192));
+        GOUT(565, _g3_4(gx+28, gy+40, gz+192));
+        GOUT(566, _g3_4(gx+28, gy+36, gz+196));
+        GOUT(567, _g3_4(gx+24, gy+44, gz+192));
+        GOUT(568, _g3_4(gx+24, gy+40, gz+196));
+        GOUT(569, _g3_4(gx+24, gy+36, gz+200));
+        GOUT(570, _g3_4(gx+32, gy+24, gz+204));
+        GOUT(571, _g3_4(gx+28, gy+28, gz+204));
+        GOUT(572, _g3_4(gx+28, gy+24, gz+208));
+        GOUT(573, _g3_4(gx+24, gy+32, gz+204));
+        GOUT(574, _g3_4(gx+24, gy+28, gz+208));
+        GOUT(575, _g3_4(gx+24, gy+24, gz+212));
+        GOUT(576, _g2_4(gx+44, gz+216));
+        GOUT(577, _g3_4(gx+40, gy+4, gz+216));
+        GOUT(578, _g2_4(gx+40, gz+220));
+        GOUT(579, _g3_4(gx+36, gy+8, gz+216));
+        GOUT(580, _g3_4(gx+36, gy+4, gz+220));
+        GOUT(581, _g2_4(gx+36, gz+224));
+        GOUT(582, _g3_4(gx+32, gy+12, gz+216));
+        GOUT(583, _g3_4(gx+28, gy+16, gz+216));
+        GOUT(584, _g3_4(gx+28, gy+12, gz+220));
+        GOUT(585, _g3_4(gx+24, gy+20, gz+216));
+        GOUT(586, _g3_4(gx+24, gy+16, gz+220));
+        GOUT(587, _g3_4(gx+24, gy+12, gz+224));
+        GOUT(588, _g2_4(gx+32, gz+228));
+        GOUT(589, _g3_4(gx+28, gy+4, gz+228));
+        GOUT(590, _g2_4(gx+28, gz+232));
+        GOUT(591, _g3_4(gx+24, gy+8, gz+228));
+        GOUT(592, _g3_4(gx+24, gy+4, gz+232));
+        GOUT(593, _g2_4(gx+24, gz+236));
+        GOUT(594, _g3_4(gx+20, gy+48, gz+192));
+        GOUT(595, _g3_4(gx+16, gy+52, gz+192));
+        GOUT(596, _g3_4(gx+16, gy+48, gz+196));
+        GOUT(597, _g3_4(gx+12, gy+56, gz+192));
+        GOUT(598, _g3_4(gx+12, gy+52, gz+196));
+        GOUT(599, _g3_4(gx+12, gy+48, gz+200));
+        GOUT(600, _g3_4(gx+8, gy+60, gz+192));
+        GOUT(601, _g3_4(gx+4, gy+64, gz+192));
+        GOUT(602, _g3_4(gx+4, gy+60, gz+196));
+        GOUT(603, _g2_4(gy+68, gz+192));
+        GOUT(604, _g2_4(gy+64, gz+196));
+        GOUT(605, _g2_4(gy+60, gz+200));
+        GOUT(606, _g3_4(gx+8, gy+48, gz+204));
+        GOUT(607, _g3_4(gx+4, gy+52, gz+204));
+        GOUT(608, _g3_4(gx+4, gy+48, gz+208));
+        GOUT(609, _g2_4(gy+56, gz+204));
+        GOUT(610, _g2_4(gy+52, gz+208));
+        GOUT(611, _g2_4(gy+48, gz+212));
+        GOUT(612, _g3_4(gx+20, gy+24, gz+216));
+        GOUT(613, _g3_4(gx+16, gy+28, gz+216));
+        GOUT(614, _g3_4(gx+16, gy+24, gz+220));
+        GOUT(615, _g3_4(gx+12, gy+32, gz+216));
+        GOUT(616, _g3_4(gx+12, gy+28, gz+220));
+        GOUT(617, _g3_4(gx+12, gy+24, gz+224));
+        GOUT(618, _g3_4(gx+8, gy+36, gz+216));
+        GOUT(619, _g3_4(gx+4, gy+40, gz+216));
+        GOUT(620, _g3_4(gx+4, gy+36, gz+220));
+        GOUT(621, _g2_4(gy+44, gz+216));
+        GOUT(622, _g2_4(gy+40, gz+220));
+        GOUT(623, _g2_4(gy+36, gz+224));
+        GOUT(624, _g3_4(gx+8, gy+24, gz+228));
+        GOUT(625, _g3_4(gx+4, gy+28, gz+228));
+        GOUT(626, _g3_4(gx+4, gy+24, gz+232));
+        GOUT(627, _g2_4(gy+32, gz+228));
+        GOUT(628, _g2_4(gy+28, gz+232));
+        GOUT(629, _g2_4(gy+24, gz+236));
+        GOUT(630, _g2_4(gx+20, gz+240));
+        GOUT(631, _g3_4(gx+16, gy+4, gz+240));
+        GOUT(632, _g2_4(gx+16, gz+244));
+        GOUT(633, _g3_4(gx+12, gy+8, gz+240));
+        GOUT(634, _g3_4(gx+12, gy+4, gz+244));
+        GOUT(635, _g2_4(gx+12, gz+248));
+        GOUT(636, _g3_4(gx+8, gy+12, gz+240));
+        GOUT(637, _g3_4(gx+4, gy+16, gz+240));
+        GOUT(638, _g3_4(gx+4, gy+12, gz+244));
+        GOUT(639, _g2_4(gy+20, gz+240));
+        GOUT(640, _g2_4(gy+16, gz+244));
+        GOUT(641, _g2_4(gy+12, gz+248));
+        GOUT(642, _g2_4(gx+8, gz+252));
+        GOUT(643, _g3_4(gx+4, gy+4, gz+252));
+        GOUT(644, _g2_4(gx+4, gz+256));
+        GOUT(645, _g2_4(gy+8, gz+252));
+        GOUT(646, _g2_4(gy+4, gz+256));
+        GOUT(647, _g1_4(gz+260));
+}
+
+static void _g0_2d4d_2220(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 180;
+        double *gz = g + 360;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        FINT n;
+        for (n = 0; n < 4; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+36] = c00x;
+                gx[n+4] = rx + gx[n+36];
+                gx[n+72] = c00x * gx[n+36] + b10;
+                gx[n+40] = rx * gx[n+36] + gx[n+72];
+                gx[n+8] = rx * gx[n+4] + gx[n+40];
+                gx[n+12] = c0px;
+                gx[n+48] = c00x * gx[n+12] + b00;
+                gx[n+16] = rx * gx[n+12] + gx[n+48];
+                gx[n+84] = c00x * gx[n+48] + b10 * gx[n+12] + b00 * gx[n+36];
+                gx[n+52] = rx * gx[n+48] + gx[n+84];
+                gx[n+20] = rx * gx[n+16] + gx[n+52];
+                gx[n+24] = c0px * gx[n+12] + b01;
+                gx[n+60] = c00x * gx[n+24] + 2 * b00 * gx[n+12];
+                gx[n+28] = rx * gx[n+24] + gx[n+60];
+                gx[n+96] = c00x * gx[n+60] + b10 * gx[n+24] + 2 * b00 * gx[n+48];
+                gx[n+64] = rx * gx[n+60] + gx[n+96];
+                gx[n+32] = rx * gx[n+28] + gx[n+64];
+                gx[n+108] = c00x * gx[n+72] + 2 * b10 * gx[n+36];
+                gx[n+76] = rx * gx[n+72] + gx[n+108];
+                gx[n+44] = rx * gx[n+40] + gx[n+76];
+                gx[n+120] = c00x * gx[n+84] + 2 * b10 * gx[n+48] + b00 * gx[n+72];
+                gx[n+88] = rx * gx[n+84] + gx[n+120];
+                gx[n+56] = rx * gx[n+52] + gx[n+88];
+                gx[n+132] = c00x * gx[n+96] + 2 * b10 * gx[n+60] + 2 * b00 * gx[n+84];
+                gx[n+100] = rx * gx[n+96] + gx[n+132];
+                gx[n+68] = rx * gx[n+64] + gx[n+100];
+                gx[n+144] = c00x * gx[n+108] + 3 * b10 * gx[n+72];
+                gx[n+112] = rx * gx[n+108] + gx[n+144];
+                gx[n+80] = rx * gx[n+76] + gx[n+112];
+                gx[n+156] = c00x * gx[n+120] + 3 * b10 * gx[n+84] + b00 * gx[n+108];
+                gx[n+124] = rx * gx[n+120] + gx[n+156];
+                gx[n+92] = rx * gx[n+88] + gx[n+124];
+                gx[n+168] = c00x * gx[n+132] + 3 * b10 * gx[n+96] + 2 * b00 * gx[n+120];
+                gx[n+136] = rx * gx[n+132] + gx[n+168];
+                gx[n+104] = rx * gx[n+100] + gx[n+136];
+                gy[n+36] = c00y;
+                gy[n+4] = ry + gy[n+36];
+                gy[n+72] = c00y * gy[n+36] + b10;
+                gy[n+40] = ry * gy[n+36] + gy[n+72];
+                gy[n+8] = ry * gy[n+4] + gy[n+40];
+                gy[n+12] = c0py;
+                gy[n+48] = c00y * gy[n+12] + b00;
+                gy[n+16] = ry * gy[n+12] + gy[n+48];
+                gy[n+84] = c00y * gy[n+48] + b10 * gy[n+12] + b00 * gy[n+36];
+                gy[n+52] = ry * gy[n+48] + gy[n+84];
+                gy[n+20] = ry * gy[n+16] + gy[n+52];
+                gy[n+24] = c0py * gy[n+12] + b01;
+                gy[n+60] = c00y * gy[n+24] + 2 * b00 * gy[n+12];
+                gy[n+28] = ry * gy[n+24] + gy[n+60];
+                gy[n+96] = c00y * gy[n+60] + b10 * gy[n+24] + 2 * b00 * gy[n+48];
+                gy[n+64] = ry * gy[n+60] + gy[n+96];
+                gy[n+32] = ry * gy[n+28] + gy[n+64];
+                gy[n+108] = c00y * gy[n+72] + 2 * b10 * gy[n+36];
+                gy[n+76] = ry * gy[n+72] + gy[n+108];
+                gy[n+44] = ry * gy[n+40] + gy[n+76];
+                gy[n+120] = c00y * gy[n+84] + 2 * b10 * gy[n+48] + b00 * gy[n+72];
+                gy[n+88] = ry * gy[n+84] + gy[n+120];
+                gy[n+56] = ry * gy[n+52] + gy[n+88];
+                gy[n+132] = c00y * gy[n+96] + 2 * b10 * gy[n+60] + 2 * b00 * gy[n+84];
+                gy[n+100] = ry * gy[n+96] + gy[n+132];
+                gy[n+68] = ry * gy[n+64] + gy[n+100];
+                gy[n+144] = c00y * gy[n+108] + 3 * b10 * gy[n+72];
+                gy[n+112] = ry * gy[n+108] + gy[n+144];
+                gy[n+80] = ry * gy[n+76] + gy[n+112];
+                gy[n+156] = c00y * gy[n+120] + 3 * b10 * gy[n+84] + b00 * gy[n+108];
+                gy[n+124] = ry * gy[n+120] + gy[n+156];
+                gy[n+92] = ry * gy[n+88] + gy[n+124];
+                gy[n+168] = c00y * gy[n+132] + 3 * b10 * gy[n+96] + 2 * b00 * gy[n+120];
+                gy[n+136] = ry * gy[n+132] + gy[n+168];
+                gy[n+104] = ry * gy[n+100] + gy[n+136];
+                gz[n+36] = c00z * gz[n+0];
+                gz[n+4] = rz * gz[n+0] + gz[n+36];
+                gz[n+72] = c00z * gz[n+36] + b10 * gz[n+0];
+                gz[n+40] = rz * gz[n+36] + gz[n+72];
+                gz[n+8] = rz * gz[n+4] + gz[n+40];
+                gz[n+12] = c0pz * gz[n+0];
+                gz[n+48] = c00z * gz[n+12] + b00 * gz[n+0];
+                gz[n+16] = rz * gz[n+12] + gz[n+48];
+                gz[n+84] = c00z * gz[n+48] + b10 * gz[n+12] + b00 * gz[n+36];
+                gz[n+52] = rz * gz[n+48] + gz[n+84];
+                gz[n+20] = rz * gz[n+16] + gz[n+52];
+                gz[n+24] = c0pz * gz[n+12] + b01 * gz[n+0];
+                gz[n+60] = c00z * gz[n+24] + 2 * b00 * gz[n+12];
+                gz[n+28] = rz * gz[n+24] + gz[n+60];
+                gz[n+96] = c00z * gz[n+60] + b10 * gz[n+24] + 2 * b00 * gz[n+48];
+                gz[n+64] = rz * gz[n+60] + gz[n+96];
+                gz[n+32] = rz * gz[n+28] + gz[n+64];
+                gz[n+108] = c00z * gz[n+72] + 2 * b10 * gz[n+36];
+                gz[n+76] = rz * gz[n+72] + gz[n+108];
+                gz[n+44] = rz * gz[n+40] + gz[n+76];
+                gz[n+120] = c00z * gz[n+84] + 2 * b10 * gz[n+48] + b00 * gz[n+72];
+                gz[n+88] = rz * gz[n+84] + gz[n+120];
+                gz[n+56] = rz * gz[n+52] + gz[n+88];
+                gz[n+132] = c00z * gz[n+96] + 2 * b10 * gz[n+60] + 2 * b00 * gz[n+84];
+                gz[n+100] = rz * gz[n+96] + gz[n+132];
+                gz[n+68] = rz * gz[n+64] + gz[n+100];
+                gz[n+144] = c00z * gz[n+108] + 3 * b10 * gz[n+72];
+                gz[n+112] = rz * gz[n+108] + gz[n+144];
+                gz[n+80] = rz * gz[n+76] + gz[n+112];
+                gz[n+156] = c00z * gz[n+120] + 3 * b10 * gz[n+84] + b00 * gz[n+108];
+                gz[n+124] = rz * gz[n+120] + gz[n+156];
+                gz[n+92] = rz * gz[n+88] + gz[n+124];
+                gz[n+168] = c00z * gz[n+132] + 3 * b10 * gz[n+96] + 2 * b00 * gz[n+120];
+                gz[n+136] = rz * gz[n+132] + gz[n+168];
+                gz[n+104] = rz * gz[n+100] + gz[n+136];
+        }
+}
+static void _gout_2220(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 180;
+        double *gz = g + 360;
+        GOUT(0, _g2_4(gx+104, gz+0));
+        GOUT(1, _g3_4(gx+100, gy+4, gz+0));
+        GOUT(2, _g2_4(gx+100, gz+4));
+        GOUT(3, _g3_4(gx+96, gy+8, gz+0));
+        GOUT(4, _g3_4(gx+96, gy+4, gz+4));
+        GOUT(5, _g2_4(gx+96, gz+8));
+        GOUT(6, _g3_4(gx+92, gy+12, gz+0));
+        GOUT(7, _g3_4(gx+88, gy+16, gz+0));
+        GOUT(8, _g3_4(gx+88, gy+12, gz+4));
+        GOUT(9, _g3_4(gx+84, gy+20, gz+0));
+        GOUT(10, _g3_4(gx+84, gy+16, gz+4));
+        GOUT(11, _g3_4(gx+84, gy+12, gz+8));
+        GOUT(12, _g2_4(gx+92, gz+12));
+        GOUT(13, _g3_4(gx+88, gy+4, gz+12));
+        GOUT(14, _g2_4(gx+88, gz+16));
+        GOUT(15, _g3_4(gx+84, gy+8, gz+12));
+        GOUT(16, _g3_4(gx+84, gy+4, gz+16));
+        GOUT(17, _g2_4(gx+84, gz+20));
+        GOUT(18, _g3_4(gx+80, gy+24, gz+0));
+        GOUT(19, _g3_4(gx+76, gy+28, gz+0));
+        GOUT(20, _g3_4(gx+76, gy+24, gz+4));
+        GOUT(21, _g3_4(gx+72, gy+32, gz+0));
+        GOUT(22, _g3_4(gx+72, gy+28, gz+4));
+        GOUT(23, _g3_4(gx+72, gy+24, gz+8));
+        GOUT(24, _g3_4(gx+80, gy+12, gz+12));
+        GOUT(25, _g3_4(gx+76, gy+16, gz+12));
+        GOUT(26, _g3_4(gx+76, gy+12, gz+16));
+        GOUT(27, _g3_4(gx+72, gy+20, gz+12));
+        GOUT(28, _g3_4(gx+72, gy+16, gz+16));
+        GOUT(29, _g3_4(gx+72, gy+12, gz+20));
+        GOUT(30, _g2_4(gx+80, gz+24));
+        GOUT(31, _g3_4(gx+76, gy+4, gz+24));
+        GOUT(32, _g2_4(gx+76, gz+28));
+        GOUT(33, _g3_4(gx+72, gy+8, gz+24));
+        GOUT(34, _g3_4(gx+72, gy+4, gz+28));
+        GOUT(35, _g2_4(gx+72, gz+32));
+        GOUT(36, _g3_4(gx+68, gy+36, gz+0));
+        GOUT(37, _g3_4(gx+64, gy+40, gz+0));
+        GOUT(38, _g3_4(gx+64, gy+36, gz+4));
+        GOUT(39, _g3_4(gx+60, gy+44, gz+0));
+        GOUT(40, _g3_4(gx+60, gy+40, gz+4));
+        GOUT(41, _g3_4(gx+60, gy+36, gz+8));
+        GOUT(42, _g3_4(gx+56, gy+48, gz+0));
+        GOUT(43, _g3_4(gx+52, gy+52, gz+0));
+        GOUT(44, _g3_4(gx+52, gy+48, gz+4));
+        GOUT(45, _g3_4(gx+48, gy+56, gz+0));
+        GOUT(46, _g3_4(gx+48, gy+52, gz+4));
+        GOUT(47, _g3_4(gx+48, gy+48, gz+8));
+        GOUT(48, _g3_4(gx+56, gy+36, gz+12));
+        GOUT(49, _g3_4(gx+52, gy+40, gz+12));
+        GOUT(50, _g3_4(gx+52, gy+36, gz+16));
+        GOUT(51, _g3_4(gx+48, gy+44, gz+12));
+        GOUT(52, _g3_4(gx+48, gy+40, gz+16));
+        GOUT(53, _g3_4(gx+48, gy+36, gz+20));
+        GOUT(54, _g3_4(gx+44, gy+60, gz+0));
+        GOUT(55, _g3_4(gx+40, gy+64, gz+0));
+        GOUT(56, _g3_4(gx+40, gy+60, gz+4));
+        GOUT(57, _g3_4(gx+36, gy+68, gz+0));
+        GOUT(58, _g3_4(gx+36, gy+64, gz+4));
+        GOUT(59, _g3_4(gx+36, gy+60, gz+8));
+        GOUT(60, _g3_4(gx+44, gy+48, gz+12));
+        GOUT(61, _g3_4(gx+40, gy+52, gz+12));
+        GOUT(62, _g3_4(gx+40, gy+48, gz+16));
+        GOUT(63, _g3_4(gx+36, gy+56, gz+12));
+        GOUT(64, _g3_4(gx+36, gy+52, gz+16));
+        GOUT(65, _g3_4(gx+36, gy+48, gz+20));
+        GOUT(66, _g3_4(gx+44, gy+36, gz+24));
+        GOUT(67, _g3_4(gx+40, gy+40, gz+24));
+        GOUT(68, _g3_4(gx+40, gy+36, gz+28));
+        GOUT(69, _g3_4(gx+36, gy+44, gz+24));
+        GOUT(70, _g3_4(gx+36, gy+40, gz+28));
+        GOUT(71, _g3_4(gx+36, gy+36, gz+32));
+        GOUT(72, _g2_4(gx+68, gz+36));
+        GOUT(73, _g3_4(gx+64, gy+4, gz+36));
+        GOUT(74, _g2_4(gx+64, gz+40));
+        GOUT(75, _g3_4(gx+60, gy+8, gz+36));
+        GOUT(76, _g3_4(gx+60, gy+4, gz+40));
+        GOUT(77, _g2_4(gx+60, gz+44));
+        GOUT(78, _g3_4(gx+56, gy+12, gz+36));
+        GOUT(79, _g3_4(gx+52, gy+16, gz+36));
+        GOUT(80, _g3_4(gx+52, gy+12, gz+40));
+        GOUT(81, _g3_4(gx+48, gy+20, gz+36));
+        GOUT(82, _g3_4(gx+48, gy+16, gz+40));
+        GOUT(83, _g3_4(gx+48, gy+12, gz+44));
+        GOUT(84, _g2_4(gx+56, gz+48));
+        GOUT(85, _g3_4(gx+52, gy+4, gz+48));
+        GOUT(86, _g2_4(gx+52, gz+52));
+        GOUT(87, _g3_4(gx+48, gy+8, gz+48));
+        GOUT(88, _g3_4(gx+48, gy+4, gz+52));
+        GOUT(89, _g2_4(gx+48, gz+56));
+        GOUT(90, _g3_4(gx+44, gy+24, gz+36));
+        GOUT(91, _g3_4(gx+40, gy+28, gz+36));
+        GOUT(92, _g3_4(gx+40, gy+24, gz+40));
+        GOUT(93, _g3_4(gx+36, gy+32, gz+36));
+        GOUT(94, _g3_4(gx+36, gy+28, gz+40));
+        GOUT(95, _g3_4(gx+36, gy+24, gz+44));
+        GOUT(96, _g3_4(gx+44, gy+12, gz+48));
+        GOUT(97, _g3_4(gx+40, gy+16, gz+48));
+        GOUT(98, _g3_4(gx+40, gy+12, gz+52));
+        GOUT(99, _g3_4(gx+36, gy+20, gz+48));
+        GOUT(100, _g3_4(gx+36, gy+16, gz+52));
+        GOUT(101, _g3_4(gx+36, gy+12, gz+56));
+        GOUT(102, _g2_4(gx+44, gz+60));
+        GOUT(103, _g3_4(gx+40, gy+4, gz+60));
+        GOUT(104, _g2_4(gx+40, gz+64));
+        GOUT(105, _g3_4(gx+36, gy+8, gz+60));
+        GOUT(106, _g3_4(gx+36, gy+4, gz+64));
+        GOUT(107, _g2_4(gx+36, gz+68));
+        GOUT(108, _g3_4(gx+32, gy+72, gz+0));
+        GOUT(109, _g3_4(gx+28, gy+76, gz+0));
+        GOUT(110, _g3_4(gx+28, gy+72, gz+4));
+        GOUT(111, _g3_4(gx+24, gy+80, gz+0));
+        GOUT(112, _g3_4(gx+24, gy+76, gz+4));
+        GOUT(113, _g3_4(gx+24, gy+72, gz+8));
+        GOUT(114, _g3_4(gx+20, gy+84, gz+0));
+        GOUT(115, _g3_4(gx+16, gy+88, gz+0));
+        GOUT(116, _g3_4(gx+16, gy+84, gz+4));
+        GOUT(117, _g3_4(gx+12, gy+92, gz+0));
+        GOUT(118, _g3_4(gx+12, gy+88, gz+4));
+        GOUT(119, _g3_4(gx+12, gy+84, gz+8));
+        GOUT(120, _g3_4(gx+20, gy+72, gz+12));
+        GOUT(121, _g3_4(gx+16, gy+76, gz+12));
+        GOUT(122, _g3_4(gx+16, gy+72, gz+16));
+        GOUT(123, _g3_4(gx+12, gy+80, gz+12));
+        GOUT(124, _g3_4(gx+12, gy+76, gz+16));
+        GOUT(125, _g3_4(gx+12, gy+72, gz+20));
+        GOUT(126, _g3_4(gx+8, gy+96, gz+0));
+        GOUT(127, _g3_4(gx+4, gy+100, gz+0));
+        GOUT(128, _g3_4(gx+4, gy+96, gz+4));
+        GOUT(129, _g2_4(gy+104, gz+0));
+        GOUT(130, _g2_4(gy+100, gz+4));
+        GOUT(131, _g2_4(gy+96, gz+8));
+        GOUT(132, _g3_4(gx+8, gy+84, gz+12));
+        GOUT(133, _g3_4(gx+4, gy+88, gz+12));
+        GOUT(134, _g3_4(gx+4, gy+84, gz+16));
+        GOUT(135, _g2_4(gy+92, gz+12));
+        GOUT(136, _g2_4(gy+88, gz+16));
+        GOUT(137, _g2_4(gy+84, gz+20));
+        GOUT(138, _g3_4(gx+8, gy+72, gz+24));
+        GOUT(139, _g3_4(gx+4, gy+76, gz+24));
+        GOUT(140, _g3_4(gx+4, gy+72, gz+28));
+        GOUT(141, _g2_4(gy+80, gz+24));
+        GOUT(142, _g2_4(gy+76, gz+28));
+        GOUT(143, _g2_4(gy+72, gz+32));
+        GOUT(144, _g3_4(gx+32, gy+36, gz+36));
+        GOUT(145, _g3_4(gx+28, gy+40, gz+36));
+        GOUT(146, _g3_4(gx+28, gy+36, gz+40));
+        GOUT(147, _g3_4(gx+24, gy+44, gz+36));
+        GOUT(148, _g3_4(gx+24, gy+40, gz+40));
+        GOUT(149, _g3_4(gx+24, gy+36, gz+44));
+        GOUT(150, _g3_4(gx+20, gy+48, gz+36));
+        GOUT(151, _g3_4(gx+16, gy+52, gz+36));
+        GOUT(152, _g3_4(gx+16, gy+48, gz+40));
+        GOUT(153, _g3_4(gx+12, gy+56, gz+36));
+        GOUT(154, _g3_4(gx+12, gy+52, gz+40));
+        GOUT(155, _g3_4(gx+12, gy+48, gz+44));
+        GOUT(156, _g3_4(gx+20, gy+36, gz+48));
+        GOUT(157, _g3_4(gx+16, gy+40, gz+48));
+        GOUT(158, _g3_4(gx+16, gy+36, gz+52));
+        GOUT(159, _g3_4(gx+12, gy+44, gz+48));
+        GOUT(160, _g3_4(gx+12, gy+40, gz+52));
+        GOUT(161, _g3_4(gx+12, gy+36, gz+56));
+        GOUT(162, _g3_4(gx+8, gy+60, gz+36));
+        GOUT(163, _g3_4(gx+4, gy+64, gz+36));
+        GOUT(164, _g3_4(gx+4, gy+60, gz+40));
+        GOUT(165, _g2_4(gy+68, gz+36));
+        GOUT(166, _g2_4(gy+64, gz+40));
+        GOUT(167, _g2_4(gy+60, gz+44));
+        GOUT(168, _g3_4(gx+8, gy+48, gz+48));
+        GOUT(169, _g3_4(gx+4, gy+52, gz+48));
+        GOUT(170, _g3_4(gx+4, gy+48, gz+52));
+        GOUT(171, _g2_4(gy+56, gz+48));
+        GOUT(172, _g2_4(gy+52, gz+52));
+        GOUT(173, _g2_4(gy+48, gz+56));
+        GOUT(174, _g3_4(gx+8, gy+36, gz+60));
+        GOUT(175, _g3_4(gx+4, gy+40, gz+60));
+        GOUT(176, _g3_4(gx+4, gy+36, gz+64));
+        GOUT(177, _g2_4(gy+44, gz+60));
+        GOUT(178, _g2_4(gy+40, gz+64));
+        GOUT(179, _g2_4(gy+36, gz+68));
+        GOUT(180, _g2_4(gx+32, gz+72));
+        GOUT(181, _g3_4(gx+28, gy+4, gz+72));
+        GOUT(182, _g2_4(gx+28, gz+76));
+        GOUT(183, _g3_4(gx+24, gy+8, gz+72));
+        GOUT(184, _g3_4(gx+24, gy+4, gz+76));
+        GOUT(185, _g2_4(gx+24, gz+80));
+        GOUT(186, _g3_4(gx+20, gy+12, gz+72));
+        GOUT(187, _g3_4(gx+16, gy+16, gz+72));
+        GOUT(188, _g3_4(gx+16, gy+12, gz+76));
+        GOUT(189, _g3_4(gx+12, gy+20, gz+72));
+        GOUT(190, _g3_4(gx+12, gy+16, gz+76));
+        GOUT(191, _g3_4(gx+12, gy+12, gz+80));
+        GOUT(192, _g2_4(gx+20, gz+84));
+        GOUT(193, _g3_4(gx+16, gy+4, gz+84));
+        GOUT(194, _g2_4(gx+16, gz+88));
+        GOUT(195, _g3_4(gx+12, gy+8, gz+84));
+        GOUT(196, _g3_4(gx+12, gy+4, gz+88));
+        GOUT(197, _g2_4(gx+12, gz+92));
+        GOUT(198, _g3_4(gx+8, gy+24, gz+72));
+        GOUT(199, _g3_4(gx+4, gy+28, gz+72));
+        GOUT(200, _g3_4(gx+4, gy+24, gz+76));
+        GOUT(201, _g2_4(gy+32, gz+72));
+        GOUT(202, _g2_4(gy+28, gz+76));
+        GOUT(203, _g2_4(gy+24, gz+80));
+        GOUT(204, _g3_4(gx+8, gy+12, gz+84));
+        GOUT(205, _g3_4(gx+4, gy+16, gz+84));
+        GOUT(206, _g3_4(gx+4, gy+12, gz+88));
+        GOUT(207, _g2_4(gy+20, gz+84));
+        GOUT(208, _g2_4(gy+16, gz+88));
+        GOUT(209, _g2_4(gy+12, gz+92));
+        GOUT(210, _g2_4(gx+8, gz+96));
+        GOUT(211, _g3_4(gx+4, gy+4, gz+96));
+        GOUT(212, _g2_4(gx+4, gz+100));
+        GOUT(213, _g2_4(gy+8, gz+96));
+        GOUT(214, _g2_4(gy+4, gz+100));
+        GOUT(215, _g1_4(gz+104));
+}
+
+static void _g0_2d4d_2221(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 480;
+        double *gz = g + 960;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 4; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+96] = c00x;
+                gx[n+4] = rx + gx[n+96];
+                gx[n+192] = c00x * gx[n+96] + b10;
+                gx[n+100] = rx * gx[n+96] + gx[n+192];
+                gx[n+8] = rx * gx[n+4] + gx[n+100];
+                gx[n+12] = c0px;
+                gx[n+108] = c00x * gx[n+12] + b00;
+                gx[n+16] = rx * gx[n+12] + gx[n+108];
+                gx[n+204] = c00x * gx[n+108] + b10 * gx[n+12] + b00 * gx[n+96];
+                gx[n+112] = rx * gx[n+108] + gx[n+204];
+                gx[n+20] = rx * gx[n+16] + gx[n+112];
+                gx[n+24] = c0px * gx[n+12] + b01;
+                gx[n+120] = c00x * gx[n+24] + 2 * b00 * gx[n+12];
+                gx[n+28] = rx * gx[n+24] + gx[n+120];
+                gx[n+216] = c00x * gx[n+120] + b10 * gx[n+24] + 2 * b00 * gx[n+108];
+                gx[n+124] = rx * gx[n+120] + gx[n+216];
+                gx[n+32] = rx * gx[n+28] + gx[n+124];
+                gx[n+48] = sx + gx[n+12];
+                gx[n+144] = sx * gx[n+96] + gx[n+108];
+                gx[n+52] = rx * gx[n+48] + gx[n+144];
+                gx[n+240] = sx * gx[n+192] + gx[n+204];
+                gx[n+148] = rx * gx[n+144] + gx[n+240];
+                gx[n+56] = rx * gx[n+52] + gx[n+148];
+                gx[n+60] = sx * gx[n+12] + gx[n+24];
+                gx[n+156] = sx * gx[n+108] + gx[n+120];
+                gx[n+64] = rx * gx[n+60] + gx[n+156];
+                gx[n+252] = sx * gx[n+204] + gx[n+216];
+                gx[n+160] = rx * gx[n+156] + gx[n+252];
+                gx[n+68] = rx * gx[n+64] + gx[n+160];
+                gx[n+36] = c0px * gx[n+24] + 2 * b01 * gx[n+12];
+                gx[n+72] = sx * gx[n+24] + gx[n+36];
+                gx[n+132] = c00x * gx[n+36] + 3 * b00 * gx[n+24];
+                gx[n+168] = sx * gx[n+120] + gx[n+132];
+                gx[n+76] = rx * gx[n+72] + gx[n+168];
+                gx[n+228] = c00x * gx[n+132] + b10 * gx[n+36] + 3 * b00 * gx[n+120];
+                gx[n+264] = sx * gx[n+216] + gx[n+228];
+                gx[n+172] = rx * gx[n+168] + gx[n+264];
+                gx[n+80] = rx * gx[n+76] + gx[n+172];
+                gx[n+288] = c00x * gx[n+192] + 2 * b10 * gx[n+96];
+                gx[n+196] = rx * gx[n+192] + gx[n+288];
+                gx[n+104] = rx * gx[n+100] + gx[n+196];
+                gx[n+300] = c00x * gx[n+204] + 2 * b10 * gx[n+108] + b00 * gx[n+192];
+                gx[n+208] = rx * gx[n+204] + gx[n+300];
+                gx[n+116] = rx * gx[n+112] + gx[n+208];
+                gx[n+312] = c00x * gx[n+216] + 2 * b10 * gx[n+120] + 2 * b00 * gx[n+204];
+                gx[n+220] = rx * gx[n+216] + gx[n+312];
+                gx[n+128] = rx * gx[n+124] + gx[n+220];
+                gx[n+336] = sx * gx[n+288] + gx[n+300];
+                gx[n+244] = rx * gx[n+240] + gx[n+336];
+                gx[n+152] = rx * gx[n+148] + gx[n+244];
+                gx[n+348] = sx * gx[n+300] + gx[n+312];
+                gx[n+256] = rx * gx[n+252] + gx[n+348];
+                gx[n+164] = rx * gx[n+160] + gx[n+256];
+                gx[n+324] = c00x * gx[n+228] + 2 * b10 * gx[n+132] + 3 * b00 * gx[n+216];
+                gx[n+360] = sx * gx[n+312] + gx[n+324];
+                gx[n+268] = rx * gx[n+264] + gx[n+360];
+                gx[n+176] = rx * gx[n+172] + gx[n+268];
+                gx[n+384] = c00x * gx[n+288] + 3 * b10 * gx[n+192];
+                gx[n+292] = rx * gx[n+288] + gx[n+384];
+                gx[n+200] = rx * gx[n+196] + gx[n+292];
+                gx[n+396] = c00x * gx[n+300] + 3 * b10 * gx[n+204] + b00 * gx[n+288];
+                gx[n+304] = rx * gx[n+300] + gx[n+396];
+                gx[n+212] = rx * gx[n+208] + gx[n+304];
+                gx[n+408] = c00x * gx[n+312] + 3 * b10 * gx[n+216] + 2 * b00 * gx[n+300];
+                gx[n+316] = rx * gx[n+312] + gx[n+408];
+                gx[n+224] = rx * gx[n+220] + gx[n+316];
+                gx[n+432] = sx * gx[n+384] + gx[n+396];
+                gx[n+340] = rx * gx[n+336] + gx[n+432];
+                gx[n+248] = rx * gx[n+244] + gx[n+340];
+                gx[n+444] = sx * gx[n+396] + gx[n+408];
+                gx[n+352] = rx * gx[n+348] + gx[n+444];
+                gx[n+260] = rx * gx[n+256] + gx[n+352];
+                gx[n+420] = c00x * gx[n+324] + 3 * b10 * gx[n+228] + 3 * b00 * gx[n+312];
+                gx[n+456] = sx * gx[n+408] + gx[n+420];
+                gx[n+364] = rx * gx[n+360] + gx[n+456];
+                gx[n+272] = rx * gx[n+268] + gx[n+364];
+                gy[n+96] = c00y;
+                gy[n+4] = ry + gy[n+96];
+                gy[n+192] = c00y * gy[n+96] + b10;
+                gy[n+100] = ry * gy[n+96] + gy[n+192];
+                gy[n+8] = ry * gy[n+4] + gy[n+100];
+                gy[n+12] = c0py;
+                gy[n+108] = c00y * gy[n+12] + b00;
+                gy[n+16] = ry * gy[n+12] + gy[n+108];
+                gy[n+204] = c00y * gy[n+108] + b10 * gy[n+12] + b00 * gy[n+96];
+                gy[n+112] = ry * gy[n+108] + gy[n+204];
+                gy[n+20] = ry * gy[n+16] + gy[n+112];
+                gy[n+24] = c0py * gy[n+12] + b01;
+                gy[n+120] = c00y * gy[n+24] + 2 * b00 * gy[n+12];
+                gy[n+28] = ry * gy[n+24] + gy[n+120];
+                gy[n+216] = c00y * gy[n+120] + b10 * gy[n+24] + 2 * b00 * gy[n+108];
+                gy[n+124] = ry * gy[n+120] + gy[n+216];
+                gy[n+32] = ry * gy[n+28] + gy[n+124];
+                gy[n+48] = sy + gy[n+12];
+                gy[n+144] = sy * gy[n+96] + gy[n+108];
+                gy[n+52] = ry * gy[n+48] + gy[n+144];
+                gy[n+240] = sy * gy[n+192] + gy[n+204];
+                gy[n+148] = ry * gy[n+144] + gy[n+240];
+                gy[n+56] = ry * gy[n+52] + gy[n+148];
+                gy[n+60] = sy * gy[n+12] + gy[n+24];
+                gy[n+156] = sy * gy[n+108] + gy[n+120];
+                gy[n+64] = ry * gy[n+60] + gy[n+156];
+                gy[n+252] = sy * gy[n+204] + gy[n+216];
+                gy[n+160] = ry * gy[n+156] + gy[n+252];
+                gy[n+68] = ry * gy[n+64] + gy[n+160];
+                gy[n+36] = c0py * gy[n+24] + 2 * b01 * gy[n+12];
+                gy[n+72] = sy * gy[n+24] + gy[n+36];
+                gy[n+132] = c00y * gy[n+36] + 3 * b00 * gy[n+24];
+                gy[n+168] = sy * gy[n+120] + gy[n+132];
+                gy[n+76] = ry * gy[n+72] + gy[n+168];
+                gy[n+228] = c00y * gy[n+132] + b10 * gy[n+36] + 3 * b00 * gy[n+120];
+                gy[n+264] = sy * gy[n+216] + gy[n+228];
+                gy[n+172] = ry * gy[n+168] + gy[n+264];
+                gy[n+80] = ry * gy[n+76] + gy[n+172];
+                gy[n+288] = c00y * gy[n+192] + 2 * b10 * gy[n+96];
+                gy[n+196] = ry * gy[n+192] + gy[n+288];
+                gy[n+104] = ry * gy[n+100] + gy[n+196];
+                gy[n+300] = c00y * gy[n+204] + 2 * b10 * gy[n+108] + b00 * gy[n+192];
+                gy[n+208] = ry * gy[n+204] + gy[n+300];
+                gy[n+116] = ry * gy[n+112] + gy[n+208];
+                gy[n+312] = c00y * gy[n+216] + 2 * b10 * gy[n+120] + 2 * b00 * gy[n+204];
+                gy[n+220] = ry * gy[n+216] + gy[n+312];
+                gy[n+128] = ry * gy[n+124] + gy[n+220];
+                gy[n+336] = sy * gy[n+288] + gy[n+300];
+                gy[n+244] = ry * gy[n+240] + gy[n+336];
+                gy[n+152] = ry * gy[n+148] + gy[n+244];
+                gy[n+348] = sy * gy[n+300] + gy[n+312];
+                gy[n+256] = ry * gy[n+252] + gy[n+348];
+                gy[n+164] = ry * gy[n+160] + gy[n+256];
+                gy[n+324] = c00y * gy[n+228] + 2 * b10 * gy[n+132] + 3 * b00 * gy[n+216];
+                gy[n+360] = sy * gy[n+312] + gy[n+324];
+                gy[n+268] = ry * gy[n+264] + gy[n+360];
+                gy[n+176] = ry * gy[n+172] + gy[n+268];
+                gy[n+384] = c00y * gy[n+288] + 3 * b10 * gy[n+192];
+                gy[n+292] = ry * gy[n+288] + gy[n+384];
+                gy[n+200] = ry * gy[n+196] + gy[n+292];
+                gy[n+396] = c00y * gy[n+300] + 3 * b10 * gy[n+204] + b00 * gy[n+288];
+                gy[n+304] = ry * gy[n+300] + gy[n+396];
+                gy[n+212] = ry * gy[n+208] + gy[n+304];
+                gy[n+408] = c00y * gy[n+312] + 3 * b10 * gy[n+216] + 2 * b00 * gy[n+300];
+                gy[n+316] = ry * gy[n+312] + gy[n+408];
+                gy[n+224] = ry * gy[n+220] + gy[n+316];
+                gy[n+432] = sy * gy[n+384] + gy[n+396];
+                gy[n+340] = ry * gy[n+336] + gy[n+432];
+                gy[n+248] = ry * gy[n+244] + gy[n+340];
+                gy[n+444] = sy * gy[n+396] + gy[n+408];
+                gy[n+352] = ry * gy[n+348] + gy[n+444];
+                gy[n+260] = ry * gy[n+256] + gy[n+352];
+                gy[n+420] = c00y * gy[n+324] + 3 * b10 * gy[n+228] + 3 * b00 * gy[n+312];
+                gy[n+456] = sy * gy[n+408] + gy[n+420];
+                gy[n+364] = ry * gy[n+360] + gy[n+456];
+                gy[n+272] = ry * gy[n+268] + gy[n+364];
+                gz[n+96] = c00z * gz[n+0];
+                gz[n+4] = rz * gz[n+0] + gz[n+96];
+                gz[n+192] = c00z * gz[n+96] + b10 * gz[n+0];
+                gz[n+100] = rz * gz[n+96] + gz[n+192];
+                gz[n+8] = rz * gz[n+4] + gz[n+100];
+                gz[n+12] = c0pz * gz[n+0];
+                gz[n+108] = c00z * gz[n+12] + b00 * gz[n+0];
+                gz[n+16] = rz * gz[n+12] + gz[n+108];
+                gz[n+204] = c00z * gz[n+108] + b10 * gz[n+12] + b00 * gz[n+96];
+                gz[n+112] = rz * gz[n+108] + gz[n+204];
+                gz[n+20] = rz * gz[n+16] + gz[n+112];
+                gz[n+24] = c0pz * gz[n+12] + b01 * gz[n+0];
+                gz[n+120] = c00z * gz[n+24] + 2 * b00 * gz[n+12];
+                gz[n+28] = rz * gz[n+24] + gz[n+120];
+                gz[n+216] = c00z * gz[n+120] + b10 * gz[n+24] + 2 * b00 * gz[n+108];
+                gz[n+124] = rz * gz[n+120] + gz[n+216];
+                gz[n+32] = rz * gz[n+28] + gz[n+124];
+                gz[n+48] = sz * gz[n+0] + gz[n+12];
+                gz[n+144] = sz * gz[n+96] + gz[n+108];
+                gz[n+52] = rz * gz[n+48] + gz[n+144];
+                gz[n+240] = sz * gz[n+192] + gz[n+204];
+                gz[n+148] = rz * gz[n+144] + gz[n+240];
+                gz[n+56] = rz * gz[n+52] + gz[n+148];
+                gz[n+60] = sz * gz[n+12] + gz[n+24];
+                gz[n+156] = sz * gz[n+108] + gz[n+120];
+                gz[n+64] = rz * gz[n+60] + gz[n+156];
+                gz[n+252] = sz * gz[n+204] + gz[n+216];
+                gz[n+160] = rz * gz[n+156] + gz[n+252];
+                gz[n+68] = rz * gz[n+64] + gz[n+160];
+                gz[n+36] = c0pz * gz[n+24] + 2 * b01 * gz[n+12];
+                gz[n+72] = sz * gz[n+24] + gz[n+36];
+                gz[n+132] = c00z * gz[n+36] + 3 * b00 * gz[n+24];
+                gz[n+168] = sz * gz[n+120] + gz[n+132];
+                gz[n+76] = rz * gz[n+72] + gz[n+168];
+                gz[n+228] = c00z * gz[n+132] + b10 * gz[n+36] + 3 * b00 * gz[n+120];
+                gz[n+264] = sz * gz[n+216] + gz[n+228];
+                gz[n+172] = rz * gz[n+168] + gz[n+264];
+                gz[n+80] = rz * gz[n+76] + gz[n+172];
+                gz[n+288] = c00z * gz[n+192] + 2 * b10 * gz[n+96];
+                gz[n+196] = rz * gz[n+192] + gz[n+288];
+                gz[n+104] = rz * gz[n+100] + gz[n+196];
+                gz[n+300] = c00z * gz[n+204] + 2 * b10 * gz[n+108] + b00 * gz[n+192];
+                gz[n+208] = rz * gz[n+204] + gz[n+300];
+                gz[n+116] = rz * gz[n+112] + gz[n+208];
+                gz[n+312] = c00z * gz[n+216] + 2 * b10 * gz[n+120] + 2 * b00 * gz[n+204];
+                gz[n+220] = rz * gz[n+216] + gz[n+312];
+                gz[n+128] = rz * gz[n+124] + gz[n+220];
+                gz[n+336] = sz * gz[n+288] + gz[n+300];
+                gz[n+244] = rz * gz[n+240] + gz[n+336];
+                gz[n+152] = rz * gz[n+148] + gz[n+244];
+                gz[n+348] = sz * gz[n+300] + gz[n+312];
+                gz[n+256] = rz * gz[n+252] + gz[n+348];
+                gz[n+164] = rz * gz[n+160] + gz[n+256];
+                gz[n+324] = c00z * gz[n+228] + 2 * b10 * gz[n+132] + 3 * b00 * gz[n+216];
+                gz[n+360] = sz * gz[n+312] + gz[n+324];
+                gz[n+268] = rz * gz[n+264] + gz[n+360];
+                gz[n+176] = rz * gz[n+172] + gz[n+268];
+                gz[n+384] = c00z * gz[n+288] + 3 * b10 * gz[n+192];
+                gz[n+292] = rz * gz[n+288] + gz[n+384];
+                gz[n+200] = rz * gz[n+196] + gz[n+292];
+                gz[n+396] = c00z * gz[n+300] + 3 * b10 * gz[n+204] + b00 * gz[n+288];
+                gz[n+304] = rz * gz[n+300] + gz[n+396];
+                gz[n+212] = rz * gz[n+208] + gz[n+304];
+                gz[n+408] = c00z * gz[n+312] + 3 * b10 * gz[n+216] + 2 * b00 * gz[n+300];
+                gz[n+316] = rz * gz[n+312] + gz[n+408];
+                gz[n+224] = rz * gz[n+220] + gz[n+316];
+                gz[n+432] = sz * gz[n+384] + gz[n+396];
+                gz[n+340] = rz * gz[n+336] + gz[n+432];
+                gz[n+248] = rz * gz[n+244] + gz[n+340];
+                gz[n+444] = sz * gz[n+396] + gz[n+408];
+                gz[n+352] = rz * gz[n+348] + gz[n+444];
+                gz[n+260] = rz * gz[n+256] + gz[n+352];
+                gz[n+420] = c00z * gz[n+324] + 3 * b10 * gz[n+228] + 3 * b00 * gz[n+312];
+                gz[n+456] = sz * gz[n+408] + gz[n+420];
+                gz[n+364] = rz * gz[n+360] + gz[n+456];
+                gz[n+272] = rz * gz[n+268] + gz[n+364];
+        }
+}
+static void _gout_2221(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 480;
+        double *gz = g + 960;
+        GOUT(0, _g2_4(gx+272, gz+0));
+        GOUT(1, _g3_4(gx+268, gy+4, gz+0));
+        GOUT(2, _g2_4(gx+268, gz+4));
+        GOUT(3, _g3_4(gx+264, gy+8, gz+0));
+        GOUT(4, _g3_4(gx+264, gy+4, gz+4));
+        GOUT(5, _g2_4(gx+264, gz+8));
+        GOUT(6, _g3_4(gx+260, gy+12, gz+0));
+        GOUT(7, _g3_4(gx+256, gy+16, gz+0));
+        GOUT(8, _g3_4(gx+256, gy+12, gz+4));
+        GOUT(9, _g3_4(gx+252, gy+20, gz+0));
+        GOUT(10, _g3_4(gx+252, gy+16, gz+4));
+        GOUT(11, _g3_4(gx+252, gy+12, gz+8));
+        GOUT(12, _g2_4(gx+260, gz+12));
+        GOUT(13, _g3_4(gx+256, gy+4, gz+12));
+        GOUT(14, _g2_4(gx+256, gz+16));
+        GOUT(15, _g3_4(gx+252, gy+8, gz+12));
+        GOUT(16, _g3_4(gx+252, gy+4, gz+16));
+        GOUT(17, _g2_4(gx+252, gz+20));
+        GOUT(18, _g3_4(gx+248, gy+24, gz+0));
+        GOUT(19, _g3_4(gx+244, gy+28, gz+0));
+        GOUT(20, _g3_4(gx+244, gy+24, gz+4));
+        GOUT(21, _g3_4(gx+240, gy+32, gz+0));
+        GOUT(22, _g3_4(gx+240, gy+28, gz+4));
+        GOUT(23, _g3_4(gx+240, gy+24, gz+8));
+        GOUT(24, _g3_4(gx+248, gy+12, gz+12));
+        GOUT(25, _g3_4(gx+244, gy+16, gz+12));
+        GOUT(26, _g3_4(gx+244, gy+12, gz+16));
+        GOUT(27, _g3_4(gx+240, gy+20, gz+12));
+        GOUT(28, _g3_4(gx+240, gy+16, gz+16));
+        GOUT(29, _g3_4(gx+240, gy+12, gz+20));
+        GOUT(30, _g2_4(gx+248, gz+24));
+        GOUT(31, _g3_4(gx+244, gy+4, gz+24));
+        GOUT(32, _g2_4(gx+244, gz+28));
+        GOUT(33, _g3_4(gx+240, gy+8, gz+24));
+        GOUT(34, _g3_4(gx+240, gy+4, gz+28));
+        GOUT(35, _g2_4(gx+240, gz+32));
+        GOUT(36, _g3_4(gx+224, gy+48, gz+0));
+        GOUT(37, _g3_4(gx+220, gy+52, gz+0));
+        GOUT(38, _g3_4(gx+220, gy+48, gz+4));
+        GOUT(39, _g3_4(gx+216, gy+56, gz+0));
+        GOUT(40, _g3_4(gx+216, gy+52, gz+4));
+        GOUT(41, _g3_4(gx+216, gy+48, gz+8));
+        GOUT(42, _g3_4(gx+212, gy+60, gz+0));
+        GOUT(43, _g3_4(gx+208, gy+64, gz+0));
+        GOUT(44, _g3_4(gx+208, gy+60, gz+4));
+        GOUT(45, _g3_4(gx+204, gy+68, gz+0));
+        GOUT(46, _g3_4(gx+204, gy+64, gz+4));
+        GOUT(47, _g3_4(gx+204, gy+60, gz+8));
+        GOUT(48, _g3_4(gx+212, gy+48, gz+12));
+        GOUT(49, _g3_4(gx+208, gy+52, gz+12));
+        GOUT(50, _g3_4(gx+208, gy+48, gz+16));
+        GOUT(51, _g3_4(gx+204, gy+56, gz+12));
+        GOUT(52, _g3_4(gx+204, gy+52, gz+16));
+        GOUT(53, _g3_4(gx+204, gy+48, gz+20));
+        GOUT(54, _g3_4(gx+200, gy+72, gz+0));
+        GOUT(55, _g3_4(gx+196, gy+76, gz+0));
+        GOUT(56, _g3_4(gx+196, gy+72, gz+4));
+        GOUT(57, _g3_4(gx+192, gy+80, gz+0));
+        GOUT(58, _g3_4(gx+192, gy+76, gz+4));
+        GOUT(59, _g3_4(gx+192, gy+72, gz+8));
+        GOUT(60, _g3_4(gx+200, gy+60, gz+12));
+        GOUT(61, _g3_4(gx+196, gy+64, gz+12));
+        GOUT(62, _g3_4(gx+196, gy+60, gz+16));
+        GOUT(63, _g3_4(gx+192, gy+68, gz+12));
+        GOUT(64, _g3_4(gx+192, gy+64, gz+16));
+        GOUT(65, _g3_4(gx+192, gy+60, gz+20));
+        GOUT(66, _g3_4(gx+200, gy+48, gz+24));
+        GOUT(67, _g3_4(gx+196, gy+52, gz+24));
+        GOUT(68, _g3_4(gx+196, gy+48, gz+28));
+        GOUT(69, _g3_4(gx+192, gy+56, gz+24));
+        GOUT(70, _g3_4(gx+192, gy+52, gz+28));
+        GOUT(71, _g3_4(gx+192, gy+48, gz+32));
+        GOUT(72, _g2_4(gx+224, gz+48));
+        GOUT(73, _g3_4(gx+220, gy+4, gz+48));
+        GOUT(74, _g2_4(gx+220, gz+52));
+        GOUT(75, _g3_4(gx+216, gy+8, gz+48));
+        GOUT(76, _g3_4(gx+216, gy+4, gz+52));
+        GOUT(77, _g2_4(gx+216, gz+56));
+        GOUT(78, _g3_4(gx+212, gy+12, gz+48));
+        GOUT(79, _g3_4(gx+208, gy+16, gz+48));
+        GOUT(80, _g3_4(gx+208, gy+12, gz+52));
+        GOUT(81, _g3_4(gx+204, gy+20, gz+48));
+        GOUT(82, _g3_4(gx+204, gy+16, gz+52));
+        GOUT(83, _g3_4(gx+204, gy+12, gz+56));
+        GOUT(84, _g2_4(gx+212, gz+60));
+        GOUT(85, _g3_4(gx+208, gy+4, gz+60));
+        GOUT(86, _g2_4(gx+208, gz+64));
+        GOUT(87, _g3_4(gx+204, gy+8, gz+60));
+        GOUT(88, _g3_4(gx+204, gy+4, gz+64));
+        GOUT(89, _g2_4(gx+204, gz+68));
+        GOUT(90, _g3_4(gx+200, gy+24, gz+48));
+        GOUT(91, _g3_4(gx+196, gy+28, gz+48));
+        GOUT(92, _g3_4(gx+196, gy+24, gz+52));
+        GOUT(93, _g3_4(gx+192, gy+32, gz+48));
+        GOUT(94, _g3_4(gx+192, gy+28, gz+52));
+        GOUT(95, _g3_4(gx+192, gy+24, gz+56));
+        GOUT(96, _g3_4(gx+200, gy+12, gz+60));
+        GOUT(97, _g3_4(gx+196, gy+16, gz+60));
+        GOUT(98, _g3_4(gx+196, gy+12, gz+64));
+        GOUT(99, _g3_4(gx+192, gy+20, gz+60));
+        GOUT(100, _g3_4(gx+192, gy+16, gz+64));
+        GOUT(101, _g3_4(gx+192, gy+12, gz+68));
+        GOUT(102, _g2_4(gx+200, gz+72));
+        GOUT(103, _g3_4(gx+196, gy+4, gz+72));
+        GOUT(104, _g2_4(gx+196, gz+76));
+        GOUT(105, _g3_4(gx+192, gy+8, gz+72));
+        GOUT(106, _g3_4(gx+192, gy+4, gz+76));
+        GOUT(107, _g2_4(gx+192, gz+80));
+        GOUT(108, _g3_4(gx+176, gy+96, gz+0));
+        GOUT(109, _g3_4(gx+172, gy+100, gz+0));
+        GOUT(110, _g3_4(gx+172, gy+96, gz+4));
+        GOUT(111, _g3_4(gx+168, gy+104, gz+0));
+        GOUT(112, _g3_4(gx+168, gy+100, gz+4));
+        GOUT(113, _g3_4(gx+168, gy+96, gz+8));
+        GOUT(114, _g3_4(gx+164, gy+108, gz+0));
+        GOUT(115, _g3_4(gx+160, gy+112, gz+0));
+        GOUT(116, _g3_4(gx+160, gy+108, gz+4));
+        GOUT(117, _g3_4(gx+156, gy+116, gz+0));
+        GOUT(118, _g3_4(gx+156, gy+112, gz+4));
+        GOUT(119, _g3_4(gx+156, gy+108, gz+8));
+        GOUT(120, _g3_4(gx+164, gy+96, gz+12));
+        GOUT(121, _g3_4(gx+160, gy+100, gz+12));
+        GOUT(122, _g3_4(gx+160, gy+96, gz+16));
+        GOUT(123, _g3_4(gx+156, gy+104, gz+12));
+        GOUT(124, _g3_4(gx+156, gy+100, gz+16));
+        GOUT(125, _g3_4(gx+156, gy+96, gz+20));
+        GOUT(126, _g3_4(gx+152, gy+120, gz+0));
+        GOUT(127, _g3_4(gx+148, gy+124, gz+0));
+        GOUT(128, _g3_4(gx+148, gy+120, gz+4));
+        GOUT(129, _g3_4(gx+144, gy+128, gz+0));
+        GOUT(130, _g3_4(gx+144, gy+124, gz+4));
+        GOUT(131, _g3_4(gx+144, gy+120, gz+8));
+        GOUT(132, _g3_4(gx+152, gy+108, gz+12));
+        GOUT(133, _g3_4(gx+148, gy+112, gz+12));
+        GOUT(134, _g3_4(gx+148, gy+108, gz+16));
+        GOUT(135, _g3_4(gx+144, gy+116, gz+12));
+        GOUT(136, _g3_4(gx+144, gy+112, gz+16));
+        GOUT(137, _g3_4(gx+144, gy+108, gz+20));
+        GOUT(138, _g3_4(gx+152, gy+96, gz+24));
+        GOUT(139, _g3_4(gx+148, gy+100, gz+24));
+        GOUT(140, _g3_4(gx+148, gy+96, gz+28));
+        GOUT(141, _g3_4(gx+144, gy+104, gz+24));
+        GOUT(142, _g3_4(gx+144, gy+100, gz+28));
+        GOUT(143, _g3_4(gx+144, gy+96, gz+32));
+        GOUT(144, _g3_4(gx+128, gy+144, gz+0));
+        GOUT(145, _g3_4(gx+124, gy+148, gz+0));
+        GOUT(146, _g3_4(gx+124, gy+144, gz+4));
+        GOUT(147, _g3_4(gx+120, gy+152, gz+0));
+        GOUT(148, _g3_4(gx+120, gy+148, gz+4));
+        GOUT(149, _g3_4(gx+120, gy+144, gz+8));
+        GOUT(150, _g3_4(gx+116, gy+156, gz+0));
+        GOUT(151, _g3_4(gx+112, gy+160, gz+0));
+        GOUT(152, _g3_4(gx+112, gy+156, gz+4));
+        GOUT(153, _g3_4(gx+108, gy+164, gz+0));
+        GOUT(154, _g3_4(gx+108, gy+160, gz+4));
+        GOUT(155, _g3_4(gx+108, gy+156, gz+8));
+        GOUT(156, _g3_4(gx+116, gy+144, gz+12));
+        GOUT(157, _g3_4(gx+112, gy+148, gz+12));
+        GOUT(158, _g3_4(gx+112, gy+144, gz+16));
+        GOUT(159, _g3_4(gx+108, gy+152, gz+12));
+        GOUT(160, _g3_4(gx+108, gy+148, gz+16));
+        GOUT(161, _g3_4(gx+108, gy+144, gz+20));
+        GOUT(162, _g3_4(gx+104, gy+168, gz+0));
+        GOUT(163, _g3_4(gx+100, gy+172, gz+0));
+        GOUT(164, _g3_4(gx+100, gy+168, gz+4));
+        GOUT(165, _g3_4(gx+96, gy+176, gz+0));
+        GOUT(166, _g3_4(gx+96, gy+172, gz+4));
+        GOUT(167, _g3_4(gx+96, gy+168, gz+8));
+        GOUT(168, _g3_4(gx+104, gy+156, gz+12));
+        GOUT(169, _g3_4(gx+100, gy+160, gz+12));
+        GOUT(170, _g3_4(gx+100, gy+156, gz+16));
+        GOUT(171, _g3_4(gx+96, gy+164, gz+12));
+        GOUT(172, _g3_4(gx+96, gy+160, gz+16));
+        GOUT(173, _g3_4(gx+96, gy+156, gz+20));
+        GOUT(174, _g3_4(gx+104, gy+144, gz+24));
+        GOUT(175, _g3_4(gx+100, gy+148, gz+24));
+        GOUT(176, _g3_4(gx+100, gy+144, gz+28));
+        GOUT(177, _g3_4(gx+96, gy+152, gz+24));
+        GOUT(178, _g3_4(gx+96, gy+148, gz+28));
+        GOUT(179, _g3_4(gx+96, gy+144, gz+32));
+        GOUT(180, _g3_4(gx+128, gy+96, gz+48));
+        GOUT(181, _g3_4(gx+124, gy+100, gz+48));
+        GOUT(182, _g3_4(gx+124, gy+96, gz+52));
+        GOUT(183, _g3_4(gx+120, gy+104, gz+48));
+        GOUT(184, _g3_4(gx+120, gy+100, gz+52));
+        GOUT(185, _g3_4(gx+120, gy+96, gz+56));
+        GOUT(186, _g3_4(gx+116, gy+108, gz+48));
+        GOUT(187, _g3_4(gx+112, gy+112, gz+48));
+        GOUT(188, _g3_4(gx+112, gy+108, gz+52));
+        GOUT(189, _g3_4(gx+108, gy+116, gz+48));
+        GOUT(190, _g3_4(gx+108, gy+112, gz+52));
+        GOUT(191, _g3_4(gx+108, gy+108, gz+56));
+        GOUT(192, _g3_4(gx+116, gy+96, gz+60));
+        GOUT(193, _g3_4(gx+112, gy+100, gz+60));
+        GOUT(194, _g3_4(gx+112, gy+96, gz+64));
+        GOUT(195, _g3_4(gx+108, gy+104, gz+60));
+        GOUT(196, _g3_4(gx+108, gy+100, gz+64));
+        GOUT(197, _g3_4(gx+108, gy+96, gz+68));
+        GOUT(198, _g3_4(gx+104, gy+120, gz+48));
+        GOUT(199, _g3_4(gx+100, gy+124, gz+48));
+        GOUT(200, _g3_4(gx+100, gy+120, gz+52));
+        GOUT(201, _g3_4(gx+96, gy+128, gz+48));
+        GOUT(202, _g3_4(gx+96, gy+124, gz+52));
+        GOUT(203, _g3_4(gx+96, gy+120, gz+56));
+        GOUT(204, _g3_4(gx+104, gy+108, gz+60));
+        GOUT(205, _g3_4(gx+100, gy+112, gz+60));
+        GOUT(206, _g3_4(gx+100, gy+108, gz+64));
+        GOUT(207, _g3_4(gx+96, gy+116, gz+60));
+        GOUT(208, _g3_4(gx+96, gy+112, gz+64));
+        GOUT(209, _g3_4(gx+96, gy+108, gz+68));
+        GOUT(210, _g3_4(gx+104, gy+96, gz+72));
+        GOUT(211, _g3_4(gx+100, gy+100, gz+72));
+        GOUT(212, _g3_4(gx+100, gy+96, gz+76));
+        GOUT(213, _g3_4(gx+96, gy+104, gz+72));
+        GOUT(214, _g3_4(gx+96, gy+100, gz+76));
+        GOUT(215, _g3_4(gx+96, gy+96, gz+80));
+        GOUT(216, _g2_4(gx+176, gz+96));
+        GOUT(217, _g3_4(gx+172, gy+4, gz+96));
+        GOUT(218, _g2_4(gx+172, gz+100));
+        GOUT(219, _g3_4(gx+168, gy+8, gz+96));
+        GOUT(220, _g3_4(gx+168, gy+4, gz+100));
+        GOUT(221, _g2_4(gx+168, gz+104));
+        GOUT(222, _g3_4(gx+164, gy+12, gz+96));
+        GOUT(223, _g3_4(gx+160, gy+16, gz+96));
+        GOUT(224, _g3_4(gx+160, gy+12, gz+100));
+        GOUT(225, _g3_4(gx+156, gy+20, gz+96));
+        GOUT(226, _g3_4(gx+156, gy+16, gz+100));
+        GOUT(227, _g3_4(gx+156, gy+12, gz+104));
+        GOUT(228, _g2_4(gx+164, gz+108));
+        GOUT(229, _g3_4(gx+160, gy+4, gz+108));
+        GOUT(230, _g2_4(gx+160, gz+112));
+        GOUT(231, _g3_4(gx+156, gy+8, gz+108));
+        GOUT(232, _g3_4(gx+156, gy+4, gz+112));
+        GOUT(233, _g2_4(gx+156, gz+116));
+        GOUT(234, _g3_4(gx+152, gy+24, gz+96));
+        GOUT(235, _g3_4(gx+148, gy+28, gz+96));
+        GOUT(236, _g3_4(gx+148, gy+24, gz+100));
+        GOUT(237, _g3_4(gx+144, gy+32, gz+96));
+        GOUT(238, _g3_4(gx+144, gy+28, gz+100));
+        GOUT(239, _g3_4(gx+144, gy+24, gz+104));
+        GOUT(240, _g3_4(gx+152, gy+12, gz+108));
+        GOUT(241, _g3_4(gx+148, gy+16, gz+108));
+        GOUT(242, _g3_4(gx+148, gy+12, gz+112));
+        GOUT(243, _g3_4(gx+144, gy+20, gz+108));
+        GOUT(244, _g3_4(gx+144, gy+16, gz+112));
+        GOUT(245, _g3_4(gx+144, gy+12, gz+116));
+        GOUT(246, _g2_4(gx+152, gz+120));
+        GOUT(247, _g3_4(gx+148, gy+4, gz+120));
+        GOUT(248, _g2_4(gx+148, gz+124));
+        GOUT(249, _g3_4(gx+144, gy+8, gz+120));
+        GOUT(250, _g3_4(gx+144, gy+4, gz+124));
+        GOUT(251, _g2_4(gx+144, gz+128));
+        GOUT(252, _g3_4(gx+128, gy+48, gz+96));
+        GOUT(253, _g3_4(gx+124, gy+52, gz+96));
+        GOUT(254, _g3_4(gx+124, gy+48, gz+100));
+        GOUT(255, _g3_4(gx+120, gy+56, gz+96));
+        GOUT(256, _g3_4(gx+120, gy+52, gz+100));
+        GOUT(257, _g3_4(gx+120, gy+48, gz+104));
+        GOUT(258, _g3_4(gx+116, gy+60, gz+96));
+        GOUT(259, _g3_4(gx+112, gy+64, gz+96));
+        GOUT(260, _g3_4(gx+112, gy+60, gz+100));
+        GOUT(261, _g3_4(gx+108, gy+68, gz+96));
+        GOUT(262, _g3_4(gx+108, gy+64, gz+100));
+        GOUT(263, _g3_4(gx+108, gy+60, gz+104));
+        GOUT(264, _g3_4(gx+116, gy+48, gz+108));
+        GOUT(265, _g3_4(gx+112, gy+52, gz+108));
+        GOUT(266, _g3_4(gx+112, gy+48, gz+112));
+        GOUT(267, _g3_4(gx+108, gy+56, gz+108));
+        GOUT(268, _g3_4(gx+108, gy+52, gz+112));
+        GOUT(269, _g3_4(gx+108, gy+48, gz+116));
+        GOUT(270, _g3_4(gx+104, gy+72, gz+96));
+        GOUT(271, _g3_4(gx+100, gy+76, gz+96));
+        GOUT(272, _g3_4(gx+100, gy+72, gz+100));
+        GOUT(273, _g3_4(gx+96, gy+80, gz+96));
+        GOUT(274, _g3_4(gx+96, gy+76, gz+100));
+        GOUT(275, _g3_4(gx+96, gy+72, gz+104));
+        GOUT(276, _g3_4(gx+104, gy+60, gz+108));
+        GOUT(277, _g3_4(gx+100, gy+64, gz+108));
+        GOUT(278, _g3_4(gx+100, gy+60, gz+112));
+        GOUT(279, _g3_4(gx+96, gy+68, gz+108));
+        GOUT(280, _g3_4(gx+96, gy+64, gz+112));
+        GOUT(281, _g3_4(gx+96, gy+60, gz+116));
+        GOUT(282, _g3_4(gx+104, gy+48, gz+120));
+        GOUT(283, _g3_4(gx+100, gy+52, gz+120));
+        GOUT(284, _g3_4(gx+100, gy+48, gz+124));
+        GOUT(285, _g3_4(gx+96, gy+56, gz+120));
+        GOUT(286, _g3_4(gx+96, gy+52, gz+124));
+        GOUT(287, _g3_4(gx+96, gy+48, gz+128));
+        GOUT(288, _g2_4(gx+128, gz+144));
+        GOUT(289, _g3_4(gx+124, gy+4, gz+144));
+        GOUT(290, _g2_4(gx+124, gz+148));
+        GOUT(291, _g3_4(gx+120, gy+8, gz+144));
+        GOUT(292, _g3_4(gx+120, gy+4, gz+148));
+        GOUT(293, _g2_4(gx+120, gz+152));
+        GOUT(294, _g3_4(gx+116, gy+12, gz+144));
+        GOUT(295, _g3_4(gx+112, gy+16, gz+144));
+        GOUT(296, _g3_4(gx+112, gy+12, gz+148));
+        GOUT(297, _g3_4(gx+108, gy+20, gz+144));
+        GOUT(298, _g3_4(gx+108, gy+16, gz+148));
+        GOUT(299, _g3_4(gx+108, gy+12, gz+152));
+        GOUT(300, _g2_4(gx+116, gz+156));
+        GOUT(301, _g3_4(gx+112, gy+4, gz+156));
+        GOUT(302, _g2_4(gx+112, gz+160));
+        GOUT(303, _g3_4(gx+108, gy+8, gz+156));
+        GOUT(304, _g3_4(gx+108, gy+4, gz+160));
+        GOUT(305, _g2_4(gx+108, gz+164));
+        GOUT(306, _g3_4(gx+104, gy+24, gz+144));
+        GOUT(307, _g3_4(gx+100, gy+28, gz+144));
+        GOUT(308, _g3_4(gx+100, gy+24, gz+148));
+        GOUT(309, _g3_4(gx+96, gy+32, gz+144));
+        GOUT(310, _g3_4(gx+96, gy+28, gz+148));
+        GOUT(311, _g3_4(gx+96, gy+24, gz+152));
+        GOUT(312, _g3_4(gx+104, gy+12, gz+156));
+        GOUT(313, _g3_4(gx+100, gy+16, gz+156));
+        GOUT(314, _g3_4(gx+100, gy+12, gz+160));
+        GOUT(315, _g3_4(gx+96, gy+20, gz+156));
+        GOUT(316, _g3_4(gx+96, gy+16, gz+160));
+        GOUT(317, _g3_4(gx+96, gy+12, gz+164));
+        GOUT(318, _g2_4(gx+104, gz+168));
+        GOUT(319, _g3_4(gx+100, gy+4, gz+168));
+        GOUT(320, _g2_4(gx+100, gz+172));
+        GOUT(321, _g3_4(gx+96, gy+8, gz+168));
+        GOUT(322, _g3_4(gx+96, gy+4, gz+172));
+        GOUT(323, _g2_4(gx+96, gz+176));
+        GOUT(324, _g3_4(gx+80, gy+192, gz+0));
+        GOUT(325, _g3_4(gx+76, gy+196, gz+0));
+        GOUT(326, _g3_4(gx+76, gy+192, gz+4));
+        GOUT(327, _g3_4(gx+72, gy+200, gz+0));
+        GOUT(328, _g3_4(gx+72, gy+196, gz+4));
+        GOUT(329, _g3_4(gx+72, gy+192, gz+8));
+        GOUT(330, _g3_4(gx+68, gy+204, gz+0));
+        GOUT(331, _g3_4(gx+64, gy+208, gz+0));
+        GOUT(332, _g3_4(gx+64, gy+204, gz+4));
+        GOUT(333, _g3_4(gx+60, gy+212, gz+0));
+        GOUT(334, _g3_4(gx+60, gy+208, gz+4));
+        GOUT(335, _g3_4(gx+60, gy+204, gz+8));
+        GOUT(336, _g3_4(gx+68, gy+192, gz+12));
+        GOUT(337, _g3_4(gx+64, gy+196, gz+12));
+        GOUT(338, _g3_4(gx+64, gy+192, gz+16));
+        GOUT(339, _g3_4(gx+60, gy+200, gz+12));
+        GOUT(340, _g3_4(gx+60, gy+196, gz+16));
+        GOUT(341, _g3_4(gx+60, gy+192, gz+20));
+        GOUT(342, _g3_4(gx+56, gy+216, gz+0));
+        GOUT(343, _g3_4(gx+52, gy+220, gz+0));
+        GOUT(344, _g3_4(gx+52, gy+216, gz+4));
+        GOUT(345, _g3_4(gx+48, gy+224, gz+0));
+        GOUT(346, _g3_4(gx+48, gy+220, gz+4));
+        GOUT(347, _g3_4(gx+48, gy+216, gz+8));
+        GOUT(348, _g3_4(gx+56, gy+204, gz+12));
+        GOUT(349, _g3_4(gx+52, gy+208, gz+12));
+        GOUT(350, _g3_4(gx+52, gy+204, gz+16));
+        GOUT(351, _g3_4(gx+48, gy+212, gz+12));
+        GOUT(352, _g3_4(gx+48, gy+208, gz+16));
+        GOUT(353, _g3_4(gx+48, gy+204, gz+20));
+        GOUT(354, _g3_4(gx+56, gy+192, gz+24));
+        GOUT(355, _g3_4(gx+52, gy+196, gz+24));
+        GOUT(356, _g3_4(gx+52, gy+192, gz+28));
+        GOUT(357, _g3_4(gx+48, gy+200, gz+24));
+        GOUT(358, _g3_4(gx+48, gy+196, gz+28));
+        GOUT(359, _g3_4(gx+48, gy+192, gz+32));
+        GOUT(360, _g3_4(gx+32, gy+240, gz+0));
+        GOUT(361, _g3_4(gx+28, gy+244, gz+0));
+        GOUT(362, _g3_4(gx+28, gy+240, gz+4));
+        GOUT(363, _g3_4(gx+24, gy+248, gz+0));
+        GOUT(364, _g3_4(gx+24, gy+244, gz+4));
+        GOUT(365, _g3_4(gx+24, gy+240, gz+8));
+        GOUT(366, _g3_4(gx+20, gy+252, gz+0));
+        GOUT(367, _g3_4(gx+16, gy+256, gz+0));
+        GOUT(368, _g3_4(gx+16, gy+252, gz+4));
+        GOUT(369, _g3_4(gx+12, gy+260, gz+0));
+        GOUT(370, _g3_4(gx+12, gy+256, gz+4));
+        GOUT(371, _g3_4(gx+12, gy+252, gz+8));
+        GOUT(372, _g3_4(gx+20, gy+240, gz+12));
+        GOUT(373, _g3_4(gx+16, gy+244, gz+12));
+        GOUT(374, _g3_4(gx+16, gy+240, gz+16));
+        GOUT(375, _g3_4(gx+12, gy+248, gz+12));
+        GOUT(376, _g3_4(gx+12, gy+244, gz+16));
+        GOUT(377, _g3_4(gx+12, gy+240, gz+20));
+        GOUT(378, _g3_4(gx+8, gy+264, gz+0));
+        GOUT(379, _g3_4(gx+4, gy+268, gz+0));
+        GOUT(380, _g3_4(gx+4, gy+264, gz+4));
+        GOUT(381, _g2_4(gy+272, gz+0));
+        GOUT(382, _g2_4(gy+268, gz+4));
+        GOUT(383, _g2_4(gy+264, gz+8));
+        GOUT(384, _g3_4(gx+8, gy+252, gz+12));
+        GOUT(385, _g3_4(gx+4, gy+256, gz+12));
+        GOUT(386, _g3_4(gx+4, gy+252, gz+16));
+        GOUT(387, _g2_4(gy+260, gz+12));
+        GOUT(388, _g2_4(gy+256, gz+16));
+        GOUT(389, _g2_4(gy+252, gz+20));
+        GOUT(390, _g3_4(gx+8, gy+240, gz+24));
+        GOUT(391, _g3_4(gx+4, gy+244, gz+24));
+        GOUT(392, _g3_4(gx+4, gy+240, gz+28));
+        GOUT(393, _g2_4(gy+248, gz+24));
+        GOUT(394, _g2_4(gy+244, gz+28));
+        GOUT(395, _g2_4(gy+240, gz+32));
+        GOUT(396, _g3_4(gx+32, gy+192, gz+48));
+        GOUT(397, _g3_4(gx+28, gy+196, gz+48));
+        GOUT(398, _g3_4(gx+28, gy+192, gz+52));
+        GOUT(399, _g3_4(gx+24, gy+200, gz+48));
+        GOUT(400, _g3_4(gx+24, gy+196, gz+52));
+        GOUT(401, _g3_4(gx+24, gy+192, gz+56));
+        GOUT(402, _g3_4(gx+20, gy+204, gz+48));
+        GOUT(403, _g3_4(gx+16, gy+208, gz+48));
+        GOUT(404, _g3_4(gx+16, gy+204, gz+52));
+        GOUT(405, _g3_4(gx+12, gy+212, gz+48));
+        GOUT(406, _g3_4(gx+12, gy+208, gz+52));
+        GOUT(407, _g3_4(gx+12, gy+204, gz+56));
+        GOUT(408, _g3_4(gx+20, gy+192, gz+60));
+        GOUT(409, _g3_4(gx+16, gy+196, gz+60));
+        GOUT(410, _g3_4(gx+16, gy+192, gz+64));
+        GOUT(411, _g3_4(gx+12, gy+200, gz+60));
+        GOUT(412, _g3_4(gx+12, gy+196, gz+64));
+        GOUT(413, _g3_4(gx+12, gy+192, gz+68));
+        GOUT(414, _g3_4(gx+8, gy+216, gz+48));
+        GOUT(415, _g3_4(gx+4, gy+220, gz+48));
+        GOUT(416, _g3_4(gx+4, gy+216, gz+52));
+        GOUT(417, _g2_4(gy+224, gz+48));
+        GOUT(418, _g2_4(gy+220, gz+52));
+        GOUT(419, _g2_4(gy+216, gz+56));
+        GOUT(420, _g3_4(gx+8, gy+204, gz+60));
+        GOUT(421, _g3_4(gx+4, gy+208, gz+60));
+        GOUT(422, _g3_4(gx+4, gy+204, gz+64));
+        GOUT(423, _g2_4(gy+212, gz+60));
+        GOUT(424, _g2_4(gy+208, gz+64));
+        GOUT(425, _g2_4(gy+204, gz+68));
+        GOUT(426, _g3_4(gx+8, gy+192, gz+72));
+        GOUT(427, _g3_4(gx+4, gy+196, gz+72));
+        GOUT(428, _g3_4(gx+4, gy+192, gz+76));
+        GOUT(429, _g2_4(gy+200, gz+72));
+        GOUT(430, _g2_4(gy+196, gz+76));
+        GOUT(431, _g2_4(gy+192, gz+80));
+        GOUT(432, _g3_4(gx+80, gy+96, gz+96));
+        GOUT(433, _g3_4(gx+76, gy+100, gz+96));
+        GOUT(434, _g3_4(gx+76, gy+96, gz+100));
+        GOUT(435, _g3_4(gx+72, gy+104, gz+96));
+        GOUT(436, _g3_4(gx+72, gy+100, gz+100));
+        GOUT(437, _g3_4(gx+72, gy+96, gz+104));
+        GOUT(438, _g3_4(gx+68, gy+108, gz+96));
+        GOUT(439, _g3_4(gx+64, gy+112, gz+96));
+        GOUT(440, _g3_4(gx+64, gy+108, gz+100));
+        GOUT(441, _g3_4(gx+60, gy+116, gz+96));
+        GOUT(442, _g3_4(gx+60, gy+112, gz+100));
+        GOUT(443, _g3_4(gx+60, gy+108, gz+104));
+        GOUT(444, _g3_4(gx+68, gy+96, gz+108));
+        GOUT(445, _g3_4(gx+64, gy+100, gz+108));
+        GOUT(446, _g3_4(gx+64, gy+96, gz+112));
+        GOUT(447, _g3_4(gx+60, gy+104, gz+108));
+        GOUT(448, _g3_4(gx+60, gy+100, gz+112));
+        GOUT(449, _g3_4(gx+60, gy+96, gz+116));
+        GOUT(450, _g3_4(gx+56, gy+120, gz+96));
+        GOUT(451, _g3_4(gx+52, gy+124, gz+96));
+        GOUT(452, _g3_4(gx+52, gy+120, gz+100));
+        GOUT(453, _g3_4(gx+48, gy+128, gz+96));
+        GOUT(454, _g3_4(gx+48, gy+124, gz+100));
+        GOUT(455, _g3_4(gx+48, gy+120, gz+104));
+        GOUT(456, _g3_4(gx+56, gy+108, gz+108));
+        GOUT(457, _g3_4(gx+52, gy+112, gz+108));
+        GOUT(458, _g3_4(gx+52, gy+108, gz+112));
+        GOUT(459, _g3_4(gx+48, gy+116, gz+108));
+        GOUT(460, _g3_4(gx+48, gy+112, gz+112));
+        GOUT(461, _g3_4(gx+48, gy+108, gz+116));
+        GOUT(462, _g3_4(gx+56, gy+96, gz+120));
+        GOUT(463, _g3_4(gx+52, gy+100, gz+120));
+        GOUT(464, _g3_4(gx+52, gy+96, gz+124));
+        GOUT(465, _g3_4(gx+48, gy+104, gz+120));
+        GOUT(466, _g3_4(gx+48, gy+100, gz+124));
+        GOUT(467, _g3_4(gx+48, gy+96, gz+128));
+        GOUT(468, _g3_4(gx+32, gy+144, gz+96));
+        GOUT(469, _g3_4(gx+28, gy+148, gz+96));
+        GOUT(470, _g3_4(gx+28, gy+144, gz+100));
+        GOUT(471, _g3_4(gx+24, gy+152, gz+96));
+        GOUT(472, _g3_4(gx+24, gy+148, gz+100));
+        GOUT(473, _g3_4(gx+24, gy+144, gz+104));
+        GOUT(474, _g3_4(gx+20, gy+156, gz+96));
+        GOUT(475, _g3_4(gx+16, gy+160, gz+96));
+        GOUT(476, _g3_4(gx+16, gy+156, gz+100));
+        GOUT(477, _g3_4(gx+12, gy+164, gz+96));
+        GOUT(478, _g3_4(gx+12, gy+160, gz+100));
+        GOUT(479, _g3_4(gx+12, gy+156, gz+104));
+        GOUT(480, _g3_4(gx+20, gy+144, gz+108));
+        GOUT(481, _g3_4(gx+16, gy+148, gz+108));
+        GOUT(482, _g3_4(gx+16, gy+144, gz+112));
+        GOUT(483, _g3_4(gx+12, gy+152, gz+108));
+        GOUT(484, _g3_4(gx+12, gy+148, gz+112));
+        GOUT(485, _g3_4(gx+12, gy+144, gz+116));
+        GOUT(486, _g3_4(gx+8, gy+168, gz+96));
+        GOUT(487, _g3_4(gx+4, gy+172, gz+96));
+        GOUT(488, _g3_4(gx+4, gy+168, gz+100));
+        GOUT(489, _g2_4(gy+176, gz+96));
+        GOUT(490, _g2_4(gy+172, gz+100));
+        GOUT(491, _g2_4(gy+168, gz+104));
+        GOUT(492, _g3_4(gx+8, gy+156, gz+108));
+        GOUT(493, _g3_4(gx+4, gy+160, gz+108));
+        GOUT(494, _g3_4(gx+4, gy+156, gz+112));
+        GOUT(495, _g2_4(gy+164, gz+108));
+        GOUT(496, _g2_4(gy+160, gz+112));
+        GOUT(497, _g2_4(gy+156, gz+116));
+        GOUT(498, _g3_4(gx+8, gy+144, gz+120));
+        GOUT(499, _g3_4(gx+4, gy+148, gz+120));
+        GOUT(500, _g3_4(gx+4, gy+144, gz+124));
+        GOUT(501, _g2_4(gy+152, gz+120));
+        GOUT(502, _g2_4(gy+148, gz+124));
+        GOUT(503, _g2_4(gy+144, gz+128));
+        GOUT(504, _g3_4(gx+32, gy+96, gz+144));
+        GOUT(505, _g3_4(gx+28, gy+100, gz+144));
+        GOUT(506, _g3_4(gx+28, gy+96, gz+148));
+        GOUT(507, _g3_4(gx+24, gy+104, gz+144));
+        GOUT(508, _g3_4(gx+24, gy+100, gz+148));
+        GOUT(509, _g3_4(gx+24, gy+96, gz+152));
+        GOUT(510, _g3_4(gx+20, gy+108, gz+144));
+        GOUT(511, _g3_4(gx+16, gy+112, gz+144));
+        GOUT(512, _g3_4(gx+16, gy+108, gz+148));
+        GOUT(513, _g3_4(gx+12, gy+116, gz+144));
+        GOUT(514, _g3_4(gx+12, gy+112, gz+148));
+        GOUT(515, _g3_4(gx+12, gy+108, gz+152));
+        GOUT(516, _g3_4(gx+20, gy+96, gz+156));
+        GOUT(517, _g3_4(gx+16, gy+100, gz+156));
+        GOUT(518, _g3_4(gx+16, gy+96, gz+160));
+        GOUT(519, _g3_4(gx+12, gy+104, gz+156));
+        GOUT(520, _g3_4(gx+12, gy+100, gz+160));
+        GOUT(521, _g3_4(gx+12, gy+96, gz+164));
+        GOUT(522, _g3_4(gx+8, gy+120, gz+144));
+        GOUT(523, _g3_4(gx+4, gy+124, gz+144));
+        GOUT(524, _g3_4(gx+4, gy+120, gz+148));
+        GOUT(525, _g2_4(gy+128, gz+144));
+        GOUT(526, _g2_4(gy+124, gz+148));
+        GOUT(527, _g2_4(gy+120, gz+152));
+        GOUT(528, _g3_4(gx+8, gy+108, gz+156));
+        GOUT(529, _g3_4(gx+4, gy+112, gz+156));
+        GOUT(530, _g3_4(gx+4, gy+108, gz+160));
+        GOUT(531, _g2_4(gy+116, gz+156));
+        GOUT(532, _g2_4(gy+112, gz+160));
+        GOUT(533, _g2_4(gy+108, gz+164));
+        GOUT(534, _g3_4(gx+8, gy+96, gz+168));
+        GOUT(535, _g3_4(gx+4, gy+100, gz+168));
+        GOUT(536, _g3_4(gx+4, gy+96, gz+172));
+        GOUT(537, _g2_4(gy+104, gz+168));
+        GOUT(538, _g2_4(gy+100, gz+172));
+        GOUT(539, _g2_4(gy+96, gz+176));
+        GOUT(540, _g2_4(gx+80, gz+192));
+        GOUT(541, _g3_4(gx+76, gy+4, gz+192));
+        GOUT(542, _g2_4(gx+76, gz+196));
+        GOUT(543, _g3_4(gx+72, gy+8, gz+192));
+        GOUT(544, _g3_4(gx+72, gy+4, gz+196));
+        GOUT(545, _g2_4(gx+72, gz+200));
+        GOUT(546, _g3_4(gx+68, gy+12, gz+192));
+        GOUT(547, _g3_4(gx+64, gy+16, gz+192));
+        GOUT(548, _g3_4(gx+64, gy+12, gz+196));
+        GOUT(549, _g3_4(gx+60, gy+20, gz+192));
+        GOUT(550, _g3_4(gx+60, gy+16, gz+196));
+        GOUT(551, _g3_4(gx+60, gy+12, gz+200));
+        GOUT(552, _g2_4(gx+68, gz+204));
+        GOUT(553, _g3_4(gx+64, gy+4, gz+204));
+        GOUT(554, _g2_4(gx+64, gz+208));
+        GOUT(555, _g3_4(gx+60, gy+8, gz+204));
+        GOUT(556, _g3_4(gx+60, gy+4, gz+208));
+        GOUT(557, _g2_4(gx+60, gz+212));
+        GOUT(558, _g3_4(gx+56, gy+24, gz+192));
+        GOUT(559, _g3_4(gx+52, gy+28, gz+192));
+        GOUT(560, _g3_4(gx+52, gy+24, gz+196));
+        GOUT(561, _g3_4(gx+48, gy+32, gz+192));
+        GOUT(562, _g3_4(gx+48, gy+28, gz+196));
+        GOUT(563, _g3_4(gx+48, gy+24, gz+200));
+        GOUT(564, _g3_4(gx+56, gy+12, gz+204));
+        GOUT(565, _g3_4(gx+52, gy+16, gz+204));
+        GOUT(566, _g3_4(gx+52, gy+12, gz+208));
+        GOUT(567, _g3_4(gx+48, gy+20, gz+204));
+        GOUT(568, _g3_4(gx+48, gy+16, gz+208));
+        GOUT(569, _g3_4(gx+48, gy+12, gz+212));
+        GOUT(570, _g2_4(gx+56, gz+216));
+        GOUT(571, _g3_4(gx+52, gy+4, gz+216));
+        GOUT(572, _g2_4(gx+52, gz+220));
+        GOUT(573, _g3_4(gx+48, gy+8, gz+216));
+        GOUT(574, _g3_4(gx+48, gy+4, gz+220));
+        GOUT(575, _g2_4(gx+48, gz+224));
+        GOUT(576, _g3_4(gx+32, gy+48, gz+192));
+        GOUT(577, _g3_4(gx+28, gy+52, gz+192));
+        GOUT(578, _g3_4(gx+28, gy+48, gz+196));
+        GOUT(579, _g3_4(gx+24, gy+56, gz+192));
+        GOUT(580, _g3_4(gx+24, gy+52, gz+196));
+        GOUT(581, _g3_4(gx+24, gy+48, gz+200));
+        GOUT(582, _g3_4(gx+20, gy+60, gz+192));
+        GOUT(583, _g3_4(gx+16, gy+64, gz+192));
+        GOUT(584, _g3_4(gx+16, gy+60, gz+196));
+        GOUT(585, _g3_4(gx+12, gy+68, gz+192));
+        GOUT(586, _g3_4(gx+12, gy+64, gz+196));
+        GOUT(587, _g3_4(gx+12, gy+60, gz+200));
+        GOUT(588, _g3_4(gx+20, gy+48, gz+204));
+        GOUT(589, _g3_4(gx+16, gy+52, gz+204));
+        GOUT(590, _g3_4(gx+16, gy+48, gz+208));
+        GOUT(591, _g3_4(gx+12, gy+56, gz+204));
+        GOUT(592, _g3_4(gx+12, gy+52, gz+208));
+        GOUT(593, _g3_4(gx+12, gy+48, gz+212));
+        GOUT(594, _g3_4(gx+8, gy+72, gz+192));
+        GOUT(595, _g3_4(gx+4, gy+76, gz+192));
+        GOUT(596, _g3_4(gx+4, gy+72, gz+196));
+        GOUT(597, _g2_4(gy+80, gz+192));
+        GOUT(598, _g2_4(gy+76, gz+196));
+        GOUT(599, _g2_4(gy+72, gz+200));
+        GOUT(600, _g3_4(gx+8, gy+60, gz+204));
+        GOUT(601, _g3_4(gx+4, gy+64, gz+204));
+        GOUT(602, _g3_4(gx+4, gy+60, gz+208));
+        GOUT(603, _g2_4(gy+68, gz+204));
+        GOUT(604, _g2_4(gy+64, gz+208));
+        GOUT(605, _g2_4(gy+60, gz+212));
+        GOUT(606, _g3_4(gx+8, gy+48, gz+216));
+        GOUT(607, _g3_4(gx+4, gy+52, gz+216));
+        GOUT(608, _g3_4(gx+4, gy+48, gz+220));
+        GOUT(609, _g2_4(gy+56, gz+216));
+        GOUT(610, _g2_4(gy+52, gz+220));
+        GOUT(611, _g2_4(gy+48, gz+224));
+        GOUT(612, _g2_4(gx+32, gz+240));
+        GOUT(613, _g3_4(gx+28, gy+4, gz+240));
+        GOUT(614, _g2_4(gx+28, gz+244));
+        GOUT(615, _g3_4(gx+24, gy+8, gz+240));
+        GOUT(616, _g3_4(gx+24, gy+4, gz+244));
+        GOUT(617, _g2_4(gx+24, gz+248));
+        GOUT(618, _g3_4(gx+20, gy+12, gz+240));
+        GOUT(619, _g3_4(gx+16, gy+16, gz+240));
+        GOUT(620, _g3_4(gx+16, gy+12, gz+244));
+        GOUT(621, _g3_4(gx+12, gy+20, gz+240));
+        GOUT(622, _g3_4(gx+12, gy+16, gz+244));
+        GOUT(623, _g3_4(gx+12, gy+12, gz+248));
+        GOUT(624, _g2_4(gx+20, gz+252));
+        GOUT(625, _g3_4(gx+16, gy+4, gz+252));
+        GOUT(626, _g2_4(gx+16, gz+256));
+        GOUT(627, _g3_4(gx+12, gy+8, gz+252));
+        GOUT(628, _g3_4(gx+12, gy+4, gz+256));
+        GOUT(629, _g2_4(gx+12, gz+260));
+        GOUT(630, _g3_4(gx+8, gy+24, gz+240));
+        GOUT(631, _g3_4(gx+4, gy+28, gz+240));
+        GOUT(632, _g3_4(gx+4, gy+24, gz+244));
+        GOUT(633, _g2_4(gy+32, gz+240));
+        GOUT(634, _g2_4(gy+28, gz+244));
+        GOUT(635, _g2_4(gy+24, gz+248));
+        GOUT(636, _g3_4(gx+8, gy+12, gz+252));
+        GOUT(637, _g3_4(gx+4, gy+16, gz+252));
+        GOUT(638, _g3_4(gx+4, gy+12, gz+256));
+        GOUT(639, _g2_4(gy+20, gz+252));
+        GOUT(640, _g2_4(gy+16, gz+256));
+        GOUT(641, _g2_4(gy+12, gz+260));
+        GOUT(642, _g2_4(gx+8, gz+264));
+        GOUT(643, _g3_4(gx+4, gy+4, gz+264));
+        GOUT(644, _g2_4(gx+4, gz+268));
+        GOUT(645, _g2_4(gy+8, gz+264));
+        GOUT(646, _g2_4(gy+4, gz+268));
+        GOUT(647, _g1_4(gz+272));
+}
+
+static void _g0_2d4d_2222(double *g, Rys2eT *bc, CINTEnvVars *envs)
+{
+        double *gx = g;
+        double *gy = g + 1125;
+        double *gz = g + 2250;
+        double rx = envs->rirj[0];
+        double ry = envs->rirj[1];
+        double rz = envs->rirj[2];
+        double sx = envs->rkrl[0];
+        double sy = envs->rkrl[1];
+        double sz = envs->rkrl[2];
+        FINT n;
+        for (n = 0; n < 5; n++) {
+                double c00x = bc->c00x[n];
+                double c00y = bc->c00y[n];
+                double c00z = bc->c00z[n];
+                double c0px = bc->c0px[n];
+                double c0py = bc->c0py[n];
+                double c0pz = bc->c0pz[n];
+                double b10 = bc->b10[n];
+                double b01 = bc->b01[n];
+                double b00 = bc->b00[n];
+                gx[n] = 1;
+                gy[n] = 1;
+                gx[n+225] = c00x;
+                gx[n+5] = rx + gx[n+225];
+                gx[n+450] = c00x * gx[n+225] + b10;
+                gx[n+230] = rx * gx[n+225] + gx[n+450];
+                gx[n+10] = rx * gx[n+5] + gx[n+230];
+                gx[n+45] = c0px;
+                gx[n+15] = sx + gx[n+45];
+                gx[n+270] = c00x * gx[n+45] + b00;
+                gx[n+240] = sx * gx[n+225] + gx[n+270];
+                gx[n+20] = rx * gx[n+15] + gx[n+240];
+                gx[n+495] = c00x * gx[n+270] + b10 * gx[n+45] + b00 * gx[n+225];
+                gx[n+465] = sx * gx[n+450] + gx[n+495];
+                gx[n+245] = rx * gx[n+240] + gx[n+465];
+                gx[n+25] = rx * gx[n+20] + gx[n+245];
+                gx[n+90] = c0px * gx[n+45] + b01;
+                gx[n+60] = sx * gx[n+45] + gx[n+90];
+                gx[n+30] = sx * gx[n+15] + gx[n+60];
+                gx[n+315] = c00x * gx[n+90] + 2 * b00 * gx[n+45];
+                gx[n+285] = sx * gx[n+270] + gx[n+315];
+                gx[n+255] = sx * gx[n+240] + gx[n+285];
+                gx[n+35] = rx * gx[n+30] + gx[n+255];
+                gx[n+540] = c00x * gx[n+315] + b10 * gx[n+90] + 2 * b00 * gx[n+270];
+                gx[n+510] = sx * gx[n+495] + gx[n+540];
+                gx[n+480] = sx * gx[n+465] + gx[n+510];
+                gx[n+260] = rx * gx[n+255] + gx[n+480];
+                gx[n+40] = rx * gx[n+35] + gx[n+260];
+                gx[n+50] = rx * gx[n+45] + gx[n+270];
+                gx[n+275] = rx * gx[n+270] + gx[n+495];
+                gx[n+55] = rx * gx[n+50] + gx[n+275];
+                gx[n+65] = rx * gx[n+60] + gx[n+285];
+                gx[n+290] = rx * gx[n+285] + gx[n+510];
+                gx[n+70] = rx * gx[n+65] + gx[n+290];
+                gx[n+135] = c0px * gx[n+90] + 2 * b01 * gx[n+45];
+                gx[n+105] = sx * gx[n+90] + gx[n+135];
+                gx[n+75] = sx * gx[n+60] + gx[n+105];
+                gx[n+360] = c00x * gx[n+135] + 3 * b00 * gx[n+90];
+                gx[n+330] = sx * gx[n+315] + gx[n+360];
+                gx[n+300] = sx * gx[n+285] + gx[n+330];
+                gx[n+80] = rx * gx[n+75] + gx[n+300];
+                gx[n+585] = c00x * gx[n+360] + b10 * gx[n+135] + 3 * b00 * gx[n+315];
+                gx[n+555] = sx * gx[n+540] + gx[n+585];
+                gx[n+525] = sx * gx[n+510] + gx[n+555];
+                gx[n+305] = rx * gx[n+300] + gx[n+525];
+                gx[n+85] = rx * gx[n+80] + gx[n+305];
+                gx[n+95] = rx * gx[n+90] + gx[n+315];
+                gx[n+320] = rx * gx[n+315] + gx[n+540];
+                gx[n+100] = rx * gx[n+95] + gx[n+320];
+                gx[n+110] = rx * gx[n+105] + gx[n+330];
+                gx[n+335] = rx * gx[n+330] + gx[n+555];
+                gx[n+115] = rx * gx[n+110] + gx[n+335];
+                gx[n+180] = c0px * gx[n+135] + 3 * b01 * gx[n+90];
+                gx[n+150] = sx * gx[n+135] + gx[n+180];
+                gx[n+120] = sx * gx[n+105] + gx[n+150];
+                gx[n+405] = c00x * gx[n+180] + 4 * b00 * gx[n+135];
+                gx[n+375] = sx * gx[n+360] + gx[n+405];
+                gx[n+345] = sx * gx[n+330] + gx[n+375];
+                gx[n+125] = rx * gx[n+120] + gx[n+345];
+                gx[n+630] = c00x * gx[n+405] + b10 * gx[n+180] + 4 * b00 * gx[n+360];
+                gx[n+600] = sx * gx[n+585] + gx[n+630];
+                gx[n+570] = sx * gx[n+555] + gx[n+600];
+                gx[n+350] = rx * gx[n+345] + gx[n+570];
+                gx[n+130] = rx * gx[n+125] + gx[n+350];
+                gx[n+675] = c00x * gx[n+450] + 2 * b10 * gx[n+225];
+                gx[n+455] = rx * gx[n+450] + gx[n+675];
+                gx[n+235] = rx * gx[n+230] + gx[n+455];
+                gx[n+720] = c00x * gx[n+495] + 2 * b10 * gx[n+270] + b00 * gx[n+450];
+                gx[n+690] = sx * gx[n+675] + gx[n+720];
+                gx[n+470] = rx * gx[n+465] + gx[n+690];
+                gx[n+250] = rx * gx[n+245] + gx[n+470];
+                gx[n+765] = c00x * gx[n+540] + 2 * b10 * gx[n+315] + 2 * b00 * gx[n+495];
+                gx[n+735] = sx * gx[n+720] + gx[n+765];
+                gx[n+705] = sx * gx[n+690] + gx[n+735];
+                gx[n+485] = rx * gx[n+480] + gx[n+705];
+                gx[n+265] = rx * gx[n+260] + gx[n+485];
+                gx[n+500] = rx * gx[n+495] + gx[n+720];
+                gx[n+280] = rx * gx[n+275] + gx[n+500];
+                gx[n+515] = rx * gx[n+510] + gx[n+735];
+                gx[n+295] = rx * gx[n+290] + gx[n+515];
+                gx[n+810] = c00x * gx[n+585] + 2 * b10 * gx[n+360] + 3 * b00 * gx[n+540];
+                gx[n+780] = sx * gx[n+765] + gx[n+810];
+                gx[n+750] = sx * gx[n+735] + gx[n+780];
+                gx[n+530] = rx * gx[n+525] + gx[n+750];
+                gx[n+310] = rx * gx[n+305] + gx[n+530];
+                gx[n+545] = rx * gx[n+540] + gx[n+765];
+                gx[n+325] = rx * gx[n+320] + gx[n+545];
+                gx[n+560] = rx * gx[n+555] + gx[n+780];
+                gx[n+340] = rx * gx[n+335] + gx[n+560];
+                gx[n+855] = c00x * gx[n+630] + 2 * b10 * gx[n+405] + 4 * b00 * gx[n+585];
+                gx[n+825] = sx * gx[n+810] + gx[n+855];
+                gx[n+795] = sx * gx[n+780] + gx[n+825];
+                gx[n+575] = rx * gx[n+570] + gx[n+795];
+                gx[n+355] = rx * gx[n+350] + gx[n+575];
+                gx[n+900] = c00x * gx[n+675] + 3 * b10 * gx[n+450];
+                gx[n+680] = rx * gx[n+675] + gx[n+900];
+                gx[n+460] = rx * gx[n+455] + gx[n+680];
+                gx[n+945] = c00x * gx[n+720] + 3 * b10 * gx[n+495] + b00 * gx[n+675];
+                gx[n+915] = sx * gx[n+900] + gx[n+945];
+                gx[n+695] = rx * gx[n+690] + gx[n+915];
+                gx[n+475] = rx * gx[n+470] + gx[n+695];
+                gx[n+990] = c00x * gx[n+765] + 3 * b10 * gx[n+540] + 2 * b00 * gx[n+720];
+                gx[n+960] = sx * gx[n+945] + gx[n+990];
+                gx[n+930] = sx * gx[n+915] + gx[n+960];
+                gx[n+710] = rx * gx[n+705] + gx[n+930];
+                gx[n+490] = rx * gx[n+485] + gx[n+710];
+                gx[n+725] = rx * gx[n+720] + gx[n+945];
+                gx[n+505] = rx * gx[n+500] + gx[n+725];
+                gx[n+740] = rx * gx[n+735] + gx[n+960];
+                gx[n+520] = rx * gx[n+515] + gx[n+740];
+                gx[n+1035] = c00x * gx[n+810] + 3 * b10 * gx[n+585] + 3 * b00 * gx[n+765];
+                gx[n+1005] = sx * gx[n+990] + gx[n+1035];
+                gx[n+975] = sx * gx[n+960] + gx[n+1005];
+                gx[n+755] = rx * gx[n+750] + gx[n+975];
+                gx[n+535] = rx * gx[n+530] + gx[n+755];
+                gx[n+770] = rx * gx[n+765] + gx[n+990];
+                gx[n+550] = rx * gx[n+545] + gx[n+770];
+                gx[n+785] = rx * gx[n+780] + gx[n+1005];
+                gx[n+565] = rx * gx[n+560] + gx[n+785];
+                gx[n+1080] = c00x * gx[n+855] + 3 * b10 * gx[n+630] + 4 * b00 * gx[n+810];
+                gx[n+1050] = sx * gx[n+1035] + gx[n+1080];
+                gx[n+1020] = sx * gx[n+1005] + gx[n+1050];
+                gx[n+800] = rx * gx[n+795] + gx[n+1020];
+                gx[n+580] = rx * gx[n+575] + gx[n+800];
+                gy[n+225] = c00y;
+                gy[n+5] = ry + gy[n+225];
+                gy[n+450] = c00y * gy[n+225] + b10;
+                gy[n+230] = ry * gy[n+225] + gy[n+450];
+                gy[n+10] = ry * gy[n+5] + gy[n+230];
+                gy[n+45] = c0py;
+                gy[n+15] = sy + gy[n+45];
+                gy[n+270] = c00y * gy[n+45] + b00;
+                gy[n+240] = sy * gy[n+225] + gy[n+270];
+                gy[n+20] = ry * gy[n+15] + gy[n+240];
+                gy[n+495] = c00y * gy[n+270] + b10 * gy[n+45] + b00 * gy[n+225];
+                gy[n+465] = sy * gy[n+450] + gy[n+495];
+                gy[n+245] = ry * gy[n+240] + gy[n+465];
+                gy[n+25] = ry * gy[n+20] + gy[n+245];
+                gy[n+90] = c0py * gy[n+45] + b01;
+                gy[n+60] = sy * gy[n+45] + gy[n+90];
+                gy[n+30] = sy * gy[n+15] + gy[n+60];
+                gy[n+315] = c00y * gy[n+90] + 2 * b00 * gy[n+45];
+                gy[n+285] = sy * gy[n+270] + gy[n+315];
+                gy[n+255] = sy * gy[n+240] + gy[n+285];
+                gy[n+35] = ry * gy[n+30] + gy[n+255];
+                gy[n+540] = c00y * gy[n+315] + b10 * gy[n+90] + 2 * b00 * gy[n+270];
+                gy[n+510] = sy * gy[n+495] + gy[n+540];
+                gy[n+480] = sy * gy[n+465] + gy[n+510];
+                gy[n+260] = ry * gy[n+255] + gy[n+480];
+                gy[n+40] = ry * gy[n+35] + gy[n+260];
+                gy[n+50] = ry * gy[n+45] + gy[n+270];
+                gy[n+275] = ry * gy[n+270] + gy[n+495];
+                gy[n+55] = ry * gy[n+50] + gy[n+275];
+                gy[n+65] = ry * gy[n+60] + gy[n+285];
+                gy[n+290] = ry * gy[n+285] + gy[n+510];
+                gy[n+70] = ry * gy[n+65] + gy[n+290];
+                gy[n+135] = c0py * gy[n+90] + 2 * b01 * gy[n+45];
+                gy[n+105] = sy * gy[n+90] + gy[n+135];
+                gy[n+75] = sy * gy[n+60] + gy[n+105];
+                gy[n+360] = c00y * gy[n+135] + 3 * b00 * gy[n+90];
+                gy[n+330] = sy * gy[n+315] + gy[n+360];
+                gy[n+300] = sy * gy[n+285] + gy[n+330];
+                gy[n+80] = ry * gy[n+75] + gy[n+300];
+                gy[n+585] = c00y * gy[n+360] + b10 * gy[n+135] + 3 * b00 * gy[n+315];
+                gy[n+555] = sy * gy[n+540] + gy[n+585];
+                gy[n+525] = sy * gy[n+510] + gy[n+555];
+                gy[n+305] = ry * gy[n+300] + gy[n+525];
+                gy[n+85] = ry * gy[n+80] + gy[n+305];
+                gy[n+95] = ry * gy[n+90] + gy[n+315];
+                gy[n+320] = ry * gy[n+315] + gy[n+540];
+                gy[n+100] = ry * gy[n+95] + gy[n+320];
+                gy[n+110] = ry * gy[n+105] + gy[n+330];
+                gy[n+335] = ry * gy[n+330] + gy[n+555];
+                gy[n+115] = ry * gy[n+110] + gy[n+335];
+                gy[n+180] = c0py * gy[n+135] + 3 * b01 * gy[n+90];
+                gy[n+150] = sy * gy[n+135] + gy[n+180];
+                gy[n+120] = sy * gy[n+105] + gy[n+150];
+                gy[n+405] = c00y * gy[n+180] + 4 * b00 * gy[n+135];
+                gy[n+375] = sy * gy[n+360] + gy[n+405];
+                gy[n+345] = sy * gy[n+330] + gy[n+375];
+                gy[n+125] = ry * gy[n+120] + gy[n+345];
+                gy[n+630] = c00y * gy[n+405] + b10 * gy[n+180] + 4 * b00 * gy[n+360];
+                gy[n+600] = sy * gy[n+585] + gy[n+630];
+                gy[n+570] = sy * gy[n+555] + gy[n+600];
+                gy[n+350] = ry * gy[n+345] + gy[n+570];
+                gy[n+130] = ry * gy[n+125] + gy[n+350];
+                gy[n+675] = c00y * gy[n+450] + 2 * b10 * gy[n+225];
+                gy[n+455] = ry * gy[n+450] + gy[n+675];
+                gy[n+235] = ry * gy[n+230] + gy[n+455];
+                gy[n+720] = c00y * gy[n+495] + 2 * b10 * gy[n+270] + b00 * gy[n+450];
+                gy[n+690] = sy * gy[n+675] + gy[n+720];
+                gy[n+470] = ry * gy[n+465] + gy[n+690];
+                gy[n+250] = ry * gy[n+245] + gy[n+470];
+                gy[n+765] = c00y * gy[n+540] + 2 * b10 * gy[n+315] + 2 * b00 * gy[n+495];
+                gy[n+735] = sy * gy[n+720] + gy[n+765];
+                gy[n+705] = sy * gy[n+690] + gy[n+735];
+                gy[n+485] = ry * gy[n+480] + gy[n+705];
+                gy[n+265] = ry * gy[n+260] + gy[n+485];
+                gy[n+500] = ry * gy[n+495] + gy[n+720];
+                gy[n+280] = ry * gy[n+275] + gy[n+500];
+                gy[n+515] = ry * gy[n+510] + gy[n+735];
+                gy[n+295] = ry * gy[n+290] + gy[n+515];
+                gy[n+810] = c00y * gy[n+585] + 2 * b10 * gy[n+360] + 3 * b00 * gy[n+540];
+                gy[n+780] = sy * gy[n+765] + gy[n+810];
+                gy[n+750] = sy * gy[n+735] + gy[n+780];
+                gy[n+530] = ry * gy[n+525] + gy[n+750];
+                gy[n+310] = ry * gy[n+305] + gy[n+530];
+                gy[n+545] = ry * gy[n+540] + gy[n+765];
+                gy[n+325] = ry * gy[n+320] + gy[n+545];
+                gy[n+560] = ry * gy[n+555] + gy[n+780];
+                gy[n+340] = ry * gy[n+335] + gy[n+560];
+                gy[n+855] = c00y * gy[n+630] + 2 * b10 * gy[n+405] + 4 * b00 * gy[n+585];
+                gy[n+825] = sy * gy[n+810] + gy[n+855];
+                gy[n+795] = sy * gy[n+780] + gy[n+825];
+                gy[n+575] = ry * gy[n+570] + gy[n+795];
+                gy[n+355] = ry * gy[n+350] + gy[n+575];
+                gy[n+900] = c00y * gy[n+675] + 3 * b10 * gy[n+450];
+                gy[n+680] = ry * gy[n+675] + gy[n+900];
+                gy[n+460] = ry * gy[n+455] + gy[n+680];
+                gy[n+945] = c00y * gy[n+720] + 3 * b10 * gy[n+495] + b00 * gy[n+675];
+                gy[n+915] = sy * gy[n+900] + gy[n+945];
+                gy[n+695] = ry * gy[n+690] + gy[n+915];
+                gy[n+475] = ry * gy[n+470] + gy[n+695];
+                gy[n+990] = c00y * gy[n+765] + 3 * b10 * gy[n+540] + 2 * b00 * gy[n+720];
+                gy[n+960] = sy * gy[n+945] + gy[n+990];
+                gy[n+930] = sy * gy[n+915] + gy[n+960];
+                gy[n+710] = ry * gy[n+705] + gy[n+930];
+                gy[n+490] = ry * gy[n+485] + gy[n+710];
+                gy[n+725] = ry * gy[n+720] + gy[n+945];
+                gy[n+505] = ry * gy[n+500] + gy[n+725];
+                gy[n+740] = ry * gy[n+735] + gy[n+960];
+                gy[n+520] = ry * gy[n+515] + gy[n+740];
+                gy[n+1035] = c00y * gy[n+810] + 3 * b10 * gy[n+585] + 3 * b00 * gy[n+765];
+                gy[n+1005] = sy * gy[n+990] + gy[n+1035];
+                gy[n+975] = sy * gy[n+960] + gy[n+1005];
+                gy[n+755] = ry * gy[n+750] + gy[n+975];
+                gy[n+535] = ry * gy[n+530] + gy[n+755];
+                gy[n+770] = ry * gy[n+765] + gy[n+990];
+                gy[n+550] = ry * gy[n+545] + gy[n+770];
+                gy[n+785] = ry * gy[n+780] + gy[n+1005];
+                gy[n+565] = ry * gy[n+560] + gy[n+785];
+                gy[n+1080] = c00y * gy[n+855] + 3 * b10 * gy[n+630] + 4 * b00 * gy[n+810];
+                gy[n+1050] = sy * gy[n+1035] + gy[n+1080];
+                gy[n+1020] = sy * gy[n+1005] + gy[n+1050];
+                gy[n+800] = ry * gy[n+795] + gy[n+1020];
+                gy[n+580] = ry * gy[n+575] + gy[n+800];
+                gz[n+225] = c00z * gz[n+0];
+                gz[n+5] = rz * gz[n+0] + gz[n+225];
+                gz[n+450] = c00z * gz[n+225] + b10 * gz[n+0];
+                gz[n+230] = rz * gz[n+225] + gz[n+450];
+                gz[n+10] = rz * gz[n+5] + gz[n+230];
+                gz[n+45] = c0pz * gz[n+0];
+                gz[n+15] = sz * gz[n+0] + gz[n+45];
+                gz[n+270] = c00z * gz[n+45] + b00 * gz[n+0];
+                gz[n+240] = sz * gz[n+225] + gz[n+270];
+                gz[n+20] = rz * gz[n+15] + gz[n+240];
+                gz[n+495] = c00z * gz[n+270] + b10 * gz[n+45] + b00 * gz[n+225];
+                gz[n+465] = sz * gz[n+450] + gz[n+495];
+                gz[n+245] = rz * gz[n+240] + gz[n+465];
+                gz[n+25] = rz * gz[n+20] + gz[n+245];
+                gz[n+90] = c0pz * gz[n+45] + b01 * gz[n+0];
+                gz[n+60] = sz * gz[n+45] + gz[n+90];
+                gz[n+30] = sz * gz[n+15] + gz[n+60];
+                gz[n+315] = c00z * gz[n+90] + 2 * b00 * gz[n+45];
+                gz[n+285] = sz * gz[n+270] + gz[n+315];
+                gz[n+255] = sz * gz[n+240] + gz[n+285];
+                gz[n+35] = rz * gz[n+30] + gz[n+255];
+                gz[n+540] = c00z * gz[n+315] + b10 * gz[n+90] + 2 * b00 * gz[n+270];
+                gz[n+510] = sz * gz[n+495] + gz[n+540];
+                gz[n+480] = sz * gz[n+465] + gz[n+510];
+                gz[n+260] = rz * gz[n+255] + gz[n+480];
+                gz[n+40] = rz * gz[n+35] + gz[n+260];
+                gz[n+50] = rz * gz[n+45] + gz[n+270];
+                gz[n+275] = rz * gz[n+270] + gz[n+495];
+                gz[n+55] = rz * gz[n+50] + gz[n+275];
+                gz[n+65] = rz * gz[n+60] + gz[n+285];
+                gz[n+290] = rz * gz[n+285] + gz[n+510];
+                gz[n+70] = rz * gz[n+65] + gz[n+290];
+                gz[n+135] = c0pz * gz[n+90] + 2 * b01 * gz[n+45];
+                gz[n+105] = sz * gz[n+90] + gz[n+135];
+                gz[n+75] = sz * gz[n+60] + gz[n+105];
+                gz[n+360] = c00z * gz[n+135] + 3 * b00 * gz[n+90];
+                gz[n+330] = sz * gz[n+315] + gz[n+360];
+                gz[n+300] = sz * gz[n+285] + gz[n+330];
+                gz[n+80] = rz * gz[n+75] + gz[n+300];
+                gz[n+585] = c00z * gz[n+360] + b10 * gz[n+135] + 3 * b00 * gz[n+315];
+                gz[n+555] = sz * gz[n+540] + gz[n+585];
+                gz[n+525] = sz * gz[n+510] + gz[n+555];
+                gz[n+305] = rz * gz[n+300] + gz[n+525];
+                gz[n+85] = rz * gz[n+80] + gz[n+305];
+                gz[n+95] = rz * gz[n+90] + gz[n+315];
+                gz[n+320] = rz * gz[n+315] + gz[n+540];
+                gz[n+100] = rz * gz[n+95] + gz[n+320];
+                gz[n+110] = rz * gz[n+105] + gz[n+330];
+                gz[n+335] = rz * gz[n+330] + gz[n+555];
+                gz[n+115] = rz * gz[n+110] + gz[n+335];
+                gz[n+180] = c0pz * gz[n+135] + 3 * b01 * gz[n+90];
+                gz[n+150] = sz * gz[n+135] + gz[n+180];
+                gz[n+120] = sz * gz[n+105] + gz[n+150];
+                gz[n+405] = c00z * gz[n+180] + 4 * b00 * gz[n+135];
+                gz[n+375] = sz * gz[n+360] + gz[n+405];
+                gz[n+345] = sz * gz[n+330] + gz[n+375];
+                gz[n+125] = rz * gz[n+120] + gz[n+345];
+                gz[n+630] = c00z * gz[n+405] + b10 * gz[n+180] + 4 * b00 * gz[n+360];
+                gz[n+600] = sz * gz[n+585] + gz[n+630];
+                gz[n+570] = sz * gz[n+555] + gz[n+600];
+                gz[n+350] = rz * gz[n+345] + gz[n+570];
+                gz[n+130] = rz * gz[n+125] + gz[n+350];
+                gz[n+675] = c00z * gz[n+450] + 2 * b10 * gz[n+225];
+                gz[n+455] = rz * gz[n+450] + gz[n+675];
+                gz[n+235] = rz * gz[n+230] + gz[n+455];
+                gz[n+720] = c00z * gz[n+495] + 2 * b10 * gz[n+270] + b00 * gz[n+450];
+                gz[n+690] = sz * gz[n+675] + gz[n+720];
+                gz[n+470] = rz * gz[n+465] + gz[n+690];
+                gz[n+250] = rz * gz[n+245] + gz[n+470];
+                gz[n+765] = c00z * gz[n+540] + 2 * b10 * gz[n+315] + 2 * b00 * gz[n+495];
+                gz[n+735] = sz * gz[n+720] + gz[n+765];
+                gz[n+705] = sz * gz[n+690] + gz[n+735];
+                gz[n+485] = rz * gz[n+480] + gz[n+705];
+                gz[n+265] = rz * gz[n+260] + gz[n+485];
+                gz[n+500] = rz * gz[n+495] + gz[n+720];
+                gz[n+280] = rz * gz[n+275] + gz[n+500];
+                gz[n+515] = rz * gz[n+510] + gz[n+735];
+                gz[n+295] = rz * gz[n+290] + gz[n+515];
+                gz[n+810] = c00z * gz[n+585] + 2 * b10 * gz[n+360] + 3 * b00 * gz[n+540];
+                gz[n+780] = sz * gz[n+765] + gz[n+810];
+                gz[n+750] = sz * gz[n+735] + gz[n+780];
+                gz[n+530] = rz * gz[n+525] + gz[n+750];
+                gz[n+310] = rz * gz[n+305] + gz[n+530];
+                gz[n+545] = rz * gz[n+540] + gz[n+765];
+                gz[n+325] = rz * gz[n+320] + gz[n+545];
+                gz[n+560] = rz * gz[n+555] + gz[n+780];
+                gz[n+340] = rz * gz[n+335] + gz[n+560];
+                gz[n+855] = c00z * gz[n+630] + 2 * b10 * gz[n+405] + 4 * b00 * gz[n+585];
+                gz[n+825] = sz * gz[n+810] + gz[n+855];
+                gz[n+795] = sz * gz[n+780] + gz[n+825];
+                gz[n+575] = rz * gz[n+570] + gz[n+795];
+                gz[n+355] = rz * gz[n+350] + gz[n+575];
+                gz[n+900] = c00z * gz[n+675] + 3 * b10 * gz[n+450];
+                gz[n+680] = rz * gz[n+675] + gz[n+900];
+                gz[n+460] = rz * gz[n+455] + gz[n+680];
+                gz[n+945] = c00z * gz[n+720] + 3 * b10 * gz[n+495] + b00 * gz[n+675];
+                gz[n+915] = sz * gz[n+900] + gz[n+945];
+                gz[n+695] = rz * gz[n+690] + gz[n+915];
+                gz[n+475] = rz * gz[n+470] + gz[n+695];
+                gz[n+990] = c00z * gz[n+765] + 3 * b10 * gz[n+540] + 2 * b00 * gz[n+720];
+                gz[n+960] = sz * gz[n+945] + gz[n+990];
+                gz[n+930] = sz * gz[n+915] + gz[n+960];
+                gz[n+710] = rz * gz[n+705] + gz[n+930];
+                gz[n+490] = rz * gz[n+485] + gz[n+710];
+                gz[n+725] = rz * gz[n+720] + gz[n+945];
+                gz[n+505] = rz * gz[n+500] + gz[n+725];
+                gz[n+740] = rz * gz[n+735] + gz[n+960];
+                gz[n+520] = rz * gz[n+515] + gz[n+740];
+                gz[n+1035] = c00z * gz[n+810] + 3 * b10 * gz[n+585] + 3 * b00 * gz[n+765];
+                gz[n+1005] = sz * gz[n+990] + gz[n+1035];
+                gz[n+975] = sz * gz[n+960] + gz[n+1005];
+                gz[n+755] = rz * gz[n+750] + gz[n+975];
+                gz[n+535] = rz * gz[n+530] + gz[n+755];
+                gz[n+770] = rz * gz[n+765] + gz[n+990];
+                gz[n+550] = rz * gz[n+545] + gz[n+770];
+                gz[n+785] = rz * gz[n+780] + gz[n+1005];
+                gz[n+565] = rz * gz[n+560] + gz[n+785];
+                gz[n+1080] = c00z * gz[n+855] + 3 * b10 * gz[n+630] + 4 * b00 * gz[n+810];
+                gz[n+1050] = sz * gz[n+1035] + gz[n+1080];
+                gz[n+1020] = sz * gz[n+1005] + gz[n+1050];
+                gz[n+800] = rz * gz[n+795] + gz[n+1020];
+                gz[n+580] = rz * gz[n+575] + gz[n+800];
+        }
+}
+static void _gout_2222(double *gout, double *g, FINT *idx,
+                       CINTEnvVars *envs, FINT empty)
+{
+        double *gx = g;
+        double *gy = g + 1125;
+        double *gz = g + 2250;
+        GOUT(0, _g2_5(gx+580, gz+0));
+        GOUT(1, _g3_5(gx+575, gy+5, gz+0));
+        GOUT(2, _g2_5(gx+575, gz+5));
+        GOUT(3, _g3_5(gx+570, gy+10, gz+0));
+        GOUT(4, _g3_5(gx+570, gy+5, gz+5));
+        GOUT(5, _g2_5(gx+570, gz+10));
+        GOUT(6, _g3_5(gx+565, gy+15, gz+0));
+        GOUT(7, _g3_5(gx+560, gy+20, gz+0));
+        GOUT(8, _g3_5(gx+560, gy+15, gz+5));
+        GOUT(9, _g3_5(gx+555, gy+25, gz+0));
+        GOUT(10, _g3_5(gx+555, gy+20, gz+5));
+        GOUT(11, _g3_5(gx+555, gy+15, gz+10));
+        GOUT(12, _g2_5(gx+565, gz+15));
+        GOUT(13, _g3_5(gx+560, gy+5, gz+15));
+        GOUT(14, _g2_5(gx+560, gz+20));
+        GOUT(15, _g3_5(gx+555, gy+10, gz+15));
+        GOUT(16, _g3_5(gx+555, gy+5, gz+20));
+        GOUT(17, _g2_5(gx+555, gz+25));
+        GOUT(18, _g3_5(gx+550, gy+30, gz+0));
+        GOUT(19, _g3_5(gx+545, gy+35, gz+0));
+        GOUT(20, _g3_5(gx+545, gy+30, gz+5));
+        GOUT(21, _g3_5(gx+540, gy+40, gz+0));
+        GOUT(22, _g3_5(gx+540, gy+35, gz+5));
+        GOUT(23, _g3_5(gx+540, gy+30, gz+10));
+        GOUT(24, _g3_5(gx+550, gy+15, gz+15));
+        GOUT(25, _g3_5(gx+545, gy+20, gz+15));
+        GOUT(26, _g3_5(gx+545, gy+15, gz+20));
+        GOUT(27, _g3_5(gx+540, gy+25, gz+15));
+        GOUT(28, _g3_5(gx+540, gy+20, gz+20));
+        GOUT(29, _g3_5(gx+540, gy+15, gz+25));
+        GOUT(30, _g2_5(gx+550, gz+30));
+        GOUT(31, _g3_5(gx+545, gy+5, gz+30));
+        GOUT(32, _g2_5(gx+545, gz+35));
+        GOUT(33, _g3_5(gx+540, gy+10, gz+30));
+        GOUT(34, _g3_5(gx+540, gy+5, gz+35));
+        GOUT(35, _g2_5(gx+540, gz+40));
+        GOUT(36, _g3_5(gx+535, gy+45, gz+0));
+        GOUT(37, _g3_5(gx+530, gy+50, gz+0));
+        GOUT(38, _g3_5(gx+530, gy+45, gz+5));
+        GOUT(39, _g3_5(gx+525, gy+55, gz+0));
+        GOUT(40, _g3_5(gx+525, gy+50, gz+5));
+        GOUT(41, _g3_5(gx+525, gy+45, gz+10));
+        GOUT(42, _g3_5(gx+520, gy+60, gz+0));
+        GOUT(43, _g3_5(gx+515, gy+65, gz+0));
+        GOUT(44, _g3_5(gx+515, gy+60, gz+5));
+        GOUT(45, _g3_5(gx+510, gy+70, gz+0));
+        GOUT(46, _g3_5(gx+510, gy+65, gz+5));
+        GOUT(47, _g3_5(gx+510, gy+60, gz+10));
+        GOUT(48, _g3_5(gx+520, gy+45, gz+15));
+        GOUT(49, _g3_5(gx+515, gy+50, gz+15));
+        GOUT(50, _g3_5(gx+515, gy+45, gz+20));
+        GOUT(51, _g3_5(gx+510, gy+55, gz+15));
+        GOUT(52, _g3_5(gx+510, gy+50, gz+20));
+        GOUT(53, _g3_5(gx+510, gy+45, gz+25));
+        GOUT(54, _g3_5(gx+505, gy+75, gz+0));
+        GOUT(55, _g3_5(gx+500, gy+80, gz+0));
+        GOUT(56, _g3_5(gx+500, gy+75, gz+5));
+        GOUT(57, _g3_5(gx+495, gy+85, gz+0));
+        GOUT(58, _g3_5(gx+495, gy+80, gz+5));
+        GOUT(59, _g3_5(gx+495, gy+75, gz+10));
+        GOUT(60, _g3_5(gx+505, gy+60, gz+15));
+        GOUT(61, _g3_5(gx+500, gy+65, gz+15));
+        GOUT(62, _g3_5(gx+500, gy+60, gz+20));
+        GOUT(63, _g3_5(gx+495, gy+70, gz+15));
+        GOUT(64, _g3_5(gx+495, gy+65, gz+20));
+        GOUT(65, _g3_5(gx+495, gy+60, gz+25));
+        GOUT(66, _g3_5(gx+505, gy+45, gz+30));
+        GOUT(67, _g3_5(gx+500, gy+50, gz+30));
+        GOUT(68, _g3_5(gx+500, gy+45, gz+35));
+        GOUT(69, _g3_5(gx+495, gy+55, gz+30));
+        GOUT(70, _g3_5(gx+495, gy+50, gz+35));
+        GOUT(71, _g3_5(gx+495, gy+45, gz+40));
+        GOUT(72, _g2_5(gx+535, gz+45));
+        GOUT(73, _g3_5(gx+530, gy+5, gz+45));
+        GOUT(74, _g2_5(gx+530, gz+50));
+        GOUT(75, _g3_5(gx+525, gy+10, gz+45));
+        GOUT(76, _g3_5(gx+525, gy+5, gz+50));
+        GOUT(77, _g2_5(gx+525, gz+55));
+        GOUT(78, _g3_5(gx+520, gy+15, gz+45));
+        GOUT(79, _g3_5(gx+515, gy+20, gz+45));
+        GOUT(80, _g3_5(gx+515, gy+15, gz+50));
+        GOUT(81, _g3_5(gx+510, gy+25, gz+45));
+        GOUT(82, _g3_5(gx+510, gy+20, gz+50));
+        GOUT(83, _g3_5(gx+510, gy+15, gz+55));
+        GOUT(84, _g2_5(gx+520, gz+60));
+        GOUT(85, _g3_5(gx+515, gy+5, gz+60));
+        GOUT(86, _g2_5(gx+515, gz+65));
+        GOUT(87, _g3_5(gx+510, gy+10, gz+60));
+        GOUT(88, _g3_5(gx+510, gy+5, gz+65));
+        GOUT(89, _g2_5(gx+510, gz+70));
+        GOUT(90, _g3_5(gx+505, gy+30, gz+45));
+        GOUT(91, _g3_5(gx+500, gy+35, gz+45));
+        GOUT(92, _g3_5(gx+500, gy+30, gz+50));
+        GOUT(93, _g3_5(gx+495, gy+40, gz+45));
+        GOUT(94, _g3_5(gx+495, gy+35, gz+50));
+        GOUT(95, _g3_5(gx+495, gy+30, gz+55));
+        GOUT(96, _g3_5(gx+505, gy+15, gz+60));
+        GOUT(97, _g3_5(gx+500, gy+20, gz+60));
+        GOUT(98, _g3_5(gx+500, gy+15, gz+65));
+        GOUT(99, _g3_5(gx+495, gy+25, gz+60));
+        GOUT(100, _g3_5(gx+495, gy+20, gz+65));
+        GOUT(101, _g3_5(gx+495, gy+15, gz+70));
+        GOUT(102, _g2_5(gx+505, gz+75));
+        GOUT(103, _g3_5(gx+500, gy+5, gz+75));
+        GOUT(104, _g2_5(gx+500, gz+80));
+        GOUT(105, _g3_5(gx+495, gy+10, gz+75));
+        GOUT(106, _g3_5(gx+495, gy+5, gz+80));
+        GOUT(107, _g2_5(gx+495, gz+85));
+        GOUT(108, _g3_5(gx+490, gy+90, gz+0));
+        GOUT(109, _g3_5(gx+485, gy+95, gz+0));
+        GOUT(110, _g3_5(gx+485, gy+90, gz+5));
+        GOUT(111, _g3_5(gx+480, gy+100, gz+0));
+        GOUT(112, _g3_5(gx+480, gy+95, gz+5));
+        GOUT(113, _g3_5(gx+480, gy+90, gz+10));
+        GOUT(114, _g3_5(gx+475, gy+105, gz+0));
+        GOUT(115, _g3_5(gx+470, gy+110, gz+0));
+        GOUT(116, _g3_5(gx+470, gy+105, gz+5));
+        GOUT(117, _g3_5(gx+465, gy+115, gz+0));
+        GOUT(118, _g3_5(gx+465, gy+110, gz+5));
+        GOUT(119, _g3_5(gx+465, gy+105, gz+10));
+        GOUT(120, _g3_5(gx+475, gy+90, gz+15));
+        GOUT(121, _g3_5(gx+470, gy+95, gz+15));
+        GOUT(122, _g3_5(gx+470, gy+90, gz+20));
+        GOUT(123, _g3_5(gx+465, gy+100, gz+15));
+        GOUT(124, _g3_5(gx+465, gy+95, gz+20));
+        GOUT(125, _g3_5(gx+465, gy+90, gz+25));
+        GOUT(126, _g3_5(gx+460, gy+120, gz+0));
+        GOUT(127, _g3_5(gx+455, gy+125, gz+0));
+        GOUT(128, _g3_5(gx+455, gy+120, gz+5));
+        GOUT(129, _g3_5(gx+450, gy+130, gz+0));
+        GOUT(130, _g3_5(gx+450, gy+125, gz+5));
+        GOUT(131, _g3_5(gx+450, gy+120, gz+10));
+        GOUT(132, _g3_5(gx+460, gy+105, gz+15));
+        GOUT(133, _g3_5(gx+455, gy+110, gz+15));
+        GOUT(134, _g3_5(gx+455, gy+105, gz+20));
+        GOUT(135, _g3_5(gx+450, gy+115, gz+15));
+        GOUT(136, _g3_5(gx+450, gy+110, gz+20));
+        GOUT(137, _g3_5(gx+450, gy+105, gz+25));
+        GOUT(138, _g3_5(gx+460, gy+90, gz+30));
+        GOUT(139, _g3_5(gx+455, gy+95, gz+30));
+        GOUT(140, _g3_5(gx+455, gy+90, gz+35));
+        GOUT(141, _g3_5(gx+450, gy+100, gz+30));
+        GOUT(142, _g3_5(gx+450, gy+95, gz+35));
+        GOUT(143, _g3_5(gx+450, gy+90, gz+40));
+        GOUT(144, _g3_5(gx+490, gy+45, gz+45));
+        GOUT(145, _g3_5(gx+485, gy+50, gz+45));
+        GOUT(146, _g3_5(gx+485, gy+45, gz+50));
+        GOUT(147, _g3_5(gx+480, gy+55, gz+45));
+        GOUT(148, _g3_5(gx+480, gy+50, gz+50));
+        GOUT(149, _g3_5(gx+480, gy+45, gz+55));
+        GOUT(150, _g3_5(gx+475, gy+60, gz+45));
+        GOUT(151, _g3_5(gx+470, gy+65, gz+45));
+        GOUT(152, _g3_5(gx+470, gy+60, gz+50));
+        GOUT(153, _g3_5(gx+465, gy+70, gz+45));
+        GOUT(154, _g3_5(gx+465, gy+65, gz+50));
+        GOUT(155, _g3_5(gx+465, gy+60, gz+55));
+        GOUT(156, _g3_5(gx+475, gy+45, gz+60));
+        GOUT(157, _g3_5(gx+470, gy+50, gz+60));
+        GOUT(158, _g3_5(gx+470, gy+45, gz+65));
+        GOUT(159, _g3_5(gx+465, gy+55, gz+60));
+        GOUT(160, _g3_5(gx+465, gy+50, gz+65));
+        GOUT(161, _g3_5(gx+465, gy+45, gz+70));
+        GOUT(162, _g3_5(gx+460, gy+75, gz+45));
+        GOUT(163, _g3_5(gx+455, gy+80, gz+45));
+        GOUT(164, _g3_5(gx+455, gy+75, gz+50));
+        GOUT(165, _g3_5(gx+450, gy+85, gz+45));
+        GOUT(166, _g3_5(gx+450, gy+80, gz+50));
+        GOUT(167, _g3_5(gx+450, gy+75, gz+55));
+        GOUT(168, _g3_5(gx+460, gy+60, gz+60));
+        GOUT(169, _g3_5(gx+455, gy+65, gz+60));
+        GOUT(170, _g3_5(gx+455, gy+60, gz+65));
+        GOUT(171, _g3_5(gx+450, gy+70, gz+60));
+        GOUT(172, _g3_5(gx+450, gy+65, gz+65));
+        GOUT(173, _g3_5(gx+450, gy+60, gz+70));
+        GOUT(174, _g3_5(gx+460, gy+45, gz+75));
+        GOUT(175, _g3_5(gx+455, gy+50, gz+75));
+        GOUT(176, _g3_5(gx+455, gy+45, gz+80));
+        GOUT(177, _g3_5(gx+450, gy+55, gz+75));
+        GOUT(178, _g3_5(gx+450, gy+50, gz+80));
+        GOUT(179, _g3_5(gx+450, gy+45, gz+85));
+        GOUT(180, _g2_5(gx+490, gz+90));
+        GOUT(181, _g3_5(gx+485, gy+5, gz+90));
+        GOUT(182, _g2_5(gx+485, gz+95));
+        GOUT(183, _g3_5(gx+480, gy+10, gz+90));
+        GOUT(184, _g3_5(gx+480, gy+5, gz+95));
+        GOUT(185, _g2_5(gx+480, gz+100));
+        GOUT(186, _g3_5(gx+475, gy+15, gz+90));
+        GOUT(187, _g3_5(gx+470, gy+20, gz+90));
+        GOUT(188, _g3_5(gx+470, gy+15, gz+95));
+        GOUT(189, _g3_5(gx+465, gy+25, gz+90));
+        GOUT(190, _g3_5(gx+465, gy+20, gz+95));
+        GOUT(191, _g3_5(gx+465, gy+15, gz+100));
+        GOUT(192, _g2_5(gx+475, gz+105));
+        GOUT(193, _g3_5(gx+470, gy+5, gz+105));
+        GOUT(194, _g2_5(gx+470, gz+110));
+        GOUT(195, _g3_5(gx+465, gy+10, gz+105));
+        GOUT(196, _g3_5(gx+465, gy+5, gz+110));
+        GOUT(197, _g2_5(gx+465, gz+115));
+        GOUT(198, _g3_5(gx+460, gy+30, gz+90));
+        GOUT(199, _g3_5(gx+455, gy+35, gz+90));
+        GOUT(200, _g3_5(gx+455, gy+30, gz+95));
+        GOUT(201, _g3_5(gx+450, gy+40, gz+90));
+        GOUT(202, _g3_5(gx+450, gy+35, gz+95));
+        GOUT(203, _g3_5(gx+450, gy+30, gz+100));
+        GOUT(204, _g3_5(gx+460, gy+15, gz+105));
+        GOUT(205, _g3_5(gx+455, gy+20, gz+105));
+        GOUT(206, _g3_5(gx+455, gy+15, gz+110));
+        GOUT(207, _g3_5(gx+450, gy+25, gz+105));
+        GOUT(208, _g3_5(gx+450, gy+20, gz+110));
+        GOUT(209, _g3_5(gx+450, gy+15, gz+115));
+        GOUT(210, _g2_5(gx+460, gz+120));
+        GOUT(211, _g3_5(gx+455, gy+5, gz+120));
+        GOUT(212, _g2_5(gx+455, gz+125));
+        GOUT(213, _g3_5(gx+450, gy+10, gz+120));
+        GOUT(214, _g3_5(gx+450, gy+5, gz+125));
+        GOUT(215, _g2_5(gx+450, gz+130));
+        GOUT(216, _g3_5(gx+355, gy+225, gz+0));
+        GOUT(217, _g3_5(gx+350, gy+230, gz+0));
+        GOUT(218, _g3_5(gx+350, gy+225, gz+5));
+        GOUT(219, _g3_5(gx+345, gy+235, gz+0));
+        GOUT(220, _g3_5(gx+345, gy+230, gz+5));
+        GOUT(221, _g3_5(gx+345, gy+225, gz+10));
+        GOUT(222, _g3_5(gx+340, gy+240, gz+0));
+        GOUT(223, _g3_5(gx+335, gy+245, gz+0));
+        GOUT(224, _g3_5(gx+335, gy+240, gz+5));
+        GOUT(225, _g3_5(gx+330, gy+250, gz+0));
+        GOUT(226, _g3_5(gx+330, gy+245, gz+5));
+        GOUT(227, _g3_5(gx+330, gy+240, gz+10));
+        GOUT(228, _g3_5(gx+340, gy+225, gz+15));
+        GOUT(229, _g3_5(gx+335, gy+230, gz+15));
+        GOUT(230, _g3_5(gx+335, gy+225, gz+20));
+        GOUT(231, _g3_5(gx+330, gy+235, gz+15));
+        GOUT(232, _g3_5(gx+330, gy+230, gz+20));
+        GOUT(233, _g3_5(gx+330, gy+225, gz+25));
+        GOUT(234, _g3_5(gx+325, gy+255, gz+0));
+        GOUT(235, _g3_5(gx+320, gy+260, gz+0));
+        GOUT(236, _g3_5(gx+320, gy+255, gz+5));
+        GOUT(237, _g3_5(gx+315, gy+265, gz+0));
+        GOUT(238, _g3_5(gx+315, gy+260, gz+5));
+        GOUT(239, _g3_5(gx+315, gy+255, gz+10));
+        GOUT(240, _g3_5(gx+325, gy+240, gz+15));
+        GOUT(241, _g3_5(gx+320, gy+245, gz+15));
+        GOUT(242, _g3_5(gx+320, gy+240, gz+20));
+        GOUT(243, _g3_5(gx+315, gy+250, gz+15));
+        GOUT(244, _g3_5(gx+315, gy+245, gz+20));
+        GOUT(245, _g3_5(gx+315, gy+240, gz+25));
+        GOUT(246, _g3_5(gx+325, gy+225, gz+30));
+        GOUT(247, _g3_5(gx+320, gy+230, gz+30));
+        GOUT(248, _g3_5(gx+320, gy+225, gz+35));
+        GOUT(249, _g3_5(gx+315, gy+235, gz+30));
+        GOUT(250, _g3_5(gx+315, gy+230, gz+35));
+        GOUT(251, _g3_5(gx+315, gy+225, gz+40));
+        GOUT(252, _g3_5(gx+310, gy+270, gz+0));
+        GOUT(253, _g3_5(gx+305, gy+275, gz+0));
+        GOUT(254, _g3_5(gx+305, gy+270, gz+5));
+        GOUT(255, _g3_5(gx+300, gy+280, gz+0));
+        GOUT(256, _g3_5(gx+300, gy+275, gz+5));
+        GOUT(257, _g3_5(gx+300, gy+270, gz+10));
+        GOUT(258, _g3_5(gx+295, gy+285, gz+0));
+        GOUT(259, _g3_5(gx+290, gy+290, gz+0));
+        GOUT(260, _g3_5(gx+290, gy+285, gz+5));
+        GOUT(261, _g3_5(gx+285, gy+295, gz+0));
+        GOUT(262, _g3_5(gx+285, gy+290, gz+5));
+        GOUT(263, _g3_5(gx+285, gy+285, gz+10));
+        GOUT(264, _g3_5(gx+295, gy+270, gz+15));
+        GOUT(265, _g3_5(gx+290, gy+275, gz+15));
+        GOUT(266, _g3_5(gx+290, gy+270, gz+20));
+        GOUT(267, _g3_5(gx+285, gy+280, gz+15));
+        GOUT(268, _g3_5(gx+285, gy+275, gz+20));
+        GOUT(269, _g3_5(gx+285, gy+270, gz+25));
+        GOUT(270, _g3_5(gx+280, gy+300, gz+0));
+        GOUT(271, _g3_5(gx+275, gy+305, gz+0));
+        GOUT(272, _g3_5(gx+275, gy+300, gz+5));
+        GOUT(273, _g3_5(gx+270, gy+310, gz+0));
+        GOUT(274, _g3_5(gx+270, gy+305, gz+5));
+        GOUT(275, _g3_5(gx+270, gy+300, gz+10));
+        GOUT(276, _g3_5(gx+280, gy+285, gz+15));
+        GOUT(277, _g3_5(gx+275, gy+290, gz+15));
+        GOUT(278, _g3_5(gx+275, gy+285, gz+20));
+        GOUT(279, _g3_5(gx+270, gy+295, gz+15));
+        GOUT(280, _g3_5(gx+270, gy+290, gz+20));
+        GOUT(281, _g3_5(gx+270, gy+285, gz+25));
+        GOUT(282, _g3_5(gx+280, gy+270, gz+30));
+        GOUT(283, _g3_5(gx+275, gy+275, gz+30));
+        GOUT(284, _g3_5(gx+275, gy+270, gz+35));
+        GOUT(285, _g3_5(gx+270, gy+280, gz+30));
+        GOUT(286, _g3_5(gx+270, gy+275, gz+35));
+        GOUT(287, _g3_5(gx+270, gy+270, gz+40));
+        GOUT(288, _g3_5(gx+310, gy+225, gz+45));
+        GOUT(289, _g3_5(gx+305, gy+230, gz+45));
+        GOUT(290, _g3_5(gx+305, gy+225, gz+50));
+        GOUT(291, _g3_5(gx+300, gy+235, gz+45));
+        GOUT(292, _g3_5(gx+300, gy+230, gz+50));
+        GOUT(293, _g3_5(gx+300, gy+225, gz+55));
+        GOUT(294, _g3_5(gx+295, gy+240, gz+45));
+        GOUT(295, _g3_5(gx+290, gy+245, gz+45));
+        GOUT(296, _g3_5(gx+290, gy+240, gz+50));
+        GOUT(297, _g3_5(gx+285, gy+250, gz+45));
+        GOUT(298, _g3_5(gx+285, gy+245, gz+50));
+        GOUT(299, _g3_5(gx+285, gy+240, gz+55));
+        GOUT(300, _g3_5(gx+295, gy+225, gz+60));
+        GOUT(301, _g3_5(gx+290, gy+230, gz+60));
+        GOUT(302, _g3_5(gx+290, gy+225, gz+65));
+        GOUT(303, _g3_5(gx+285, gy+235, gz+60));
+        GOUT(304, _g3_5(gx+285, gy+230, gz+65));
+        GOUT(305, _g3_5(gx+285, gy+225, gz+70));
+        GOUT(306, _g3_5(gx+280, gy+255, gz+45));
+        GOUT(307, _g3_5(gx+275, gy+260, gz+45));
+        GOUT(308, _g3_5(gx+275, gy+255, gz+50));
+        GOUT(309, _g3_5(gx+270, gy+265, gz+45));
+        GOUT(310, _g3_5(gx+270, gy+260, gz+50));
+        GOUT(311, _g3_5(gx+270, gy+255, gz+55));
+        GOUT(312, _g3_5(gx+280, gy+240, gz+60));
+        GOUT(313, _g3_5(gx+275, gy+245, gz+60));
+        GOUT(314, _g3_5(gx+275, gy+240, gz+65));
+        GOUT(315, _g3_5(gx+270, gy+250, gz+60));
+        GOUT(316, _g3_5(gx+270, gy+245, gz+65));
+        GOUT(317, _g3_5(gx+270, gy+240, gz+70));
+        GOUT(318, _g3_5(gx+280, gy+225, gz+75));
+        GOUT(319, _g3_5(gx+275, gy+230, gz+75));
+        GOUT(320, _g3_5(gx+275, gy+225, gz+80));
+        GOUT(321, _g3_5(gx+270, gy+235, gz+75));
+        GOUT(322, _g3_5(gx+270, gy+230, gz+80));
+        GOUT(323, _g3_5(gx+270, gy+225, gz+85));
+        GOUT(324, _g3_5(gx+265, gy+315, gz+0));
+        GOUT(325, _g3_5(gx+260, gy+320, gz+0));
+        GOUT(326, _g3_5(gx+260, gy+315, gz+5));
+        GOUT(327, _g3_5(gx+255, gy+325, gz+0));
+        GOUT(328, _g3_5(gx+255, gy+320, gz+5));
+        GOUT(329, _g3_5(gx+255, gy+315, gz+10));
+        GOUT(330, _g3_5(gx+250, gy+330, gz+0));
+        GOUT(331, _g3_5(gx+245, gy+335, gz+0));
+        GOUT(332, _g3_5(gx+245, gy+330, gz+5));
+        GOUT(333, _g3_5(gx+240, gy+340, gz+0));
+        GOUT(334, _g3_5(gx+240, gy+335, gz+5));
+        GOUT(335, _g3_5(gx+240, gy+330, gz+10));
+        GOUT(336, _g3_5(gx+250, gy+315, gz+15));
+        GOUT(337, _g3_5(gx+245, gy+320, gz+15));
+        GOUT(338, _g3_5(gx+245, gy+315, gz+20));
+        GOUT(339, _g3_5(gx+240, gy+325, gz+15));
+        GOUT(340, _g3_5(gx+240, gy+320, gz+20));
+        GOUT(341, _g3_5(gx+240, gy+315, gz+25));
+        GOUT(342, _g3_5(gx+235, gy+345, gz+0));
+        GOUT(343, _g3_5(gx+230, gy+350, gz+0));
+        GOUT(344, _g3_5(gx+230, gy+345, gz+5));
+        GOUT(345, _g3_5(gx+225, gy+355, gz+0));
+        GOUT(346, _g3_5(gx+225, gy+350, gz+5));
+        GOUT(347, _g3_5(gx+225, gy+345, gz+10));
+        GOUT(348, _g3_5(gx+235, gy+330, gz+15));
+        GOUT(349, _g3_5(gx+230, gy+335, gz+15));
+        GOUT(350, _g3_5(gx+230, gy+330, gz+20));
+        GOUT(351, _g3_5(gx+225, gy+340, gz+15));
+        GOUT(352, _g3_5(gx+225, gy+335, gz+20));
+        GOUT(353, _g3_5(gx+225, gy+330, gz+25));
+        GOUT(354, _g3_5(gx+235, gy+315, gz+30));
+        GOUT(355, _g3_5(gx+230, gy+320, gz+30));
+        GOUT(356, _g3_5(gx+230, gy+315, gz+35));
+        GOUT(357, _g3_5(gx+225, gy+325, gz+30));
+        GOUT(358, _g3_5(gx+225, gy+320, gz+35));
+        GOUT(359, _g3_5(gx+225, gy+315, gz+40));
+        GOUT(360, _g3_5(gx+265, gy+270, gz+45));
+        GOUT(361, _g3_5(gx+260, gy+275, gz+45));
+        GOUT(362, _g3_5(gx+260, gy+270, gz+50));
+        GOUT(363, _g3_5(gx+255, gy+280, gz+45));
+        GOUT(364, _g3_5(gx+255, gy+275, gz+50));
+        GOUT(365, _g3_5(gx+255, gy+270, gz+55));
+        GOUT(366, _g3_5(gx+250, gy+285, gz+45));
+        GOUT(367, _g3_5(gx+245, gy+290, gz+45));
+        GOUT(368, _g3_5(gx+245, gy+285, gz+50));
+        GOUT(369, _g3_5(gx+240, gy+295, gz+45));
+        GOUT(370, _g3_5(gx+240, gy+290, gz+50));
+        GOUT(371, _g3_5(gx+240, gy+285, gz+55));
+        GOUT(372, _g3_5(gx+250, gy+270, gz+60));
+        GOUT(373, _g3_5(gx+245, gy+275, gz+60));
+        GOUT(374, _g3_5(gx+245, gy+270, gz+65));
+        GOUT(375, _g3_5(gx+240, gy+280, gz+60));
+        GOUT(376, _g3_5(gx+240, gy+275, gz+65));
+        GOUT(377, _g3_5(gx+240, gy+270, gz+70));
+        GOUT(378, _g3_5(gx+235, gy+300, gz+45));
+        GOUT(379, _g3_5(gx+230, gy+305, gz+45));
+        GOUT(380, _g3_5(gx+230, gy+300, gz+50));
+        GOUT(381, _g3_5(gx+225, gy+310, gz+45));
+        GOUT(382, _g3_5(gx+225, gy+305, gz+50));
+        GOUT(383, _g3_5(gx+225, gy+300, gz+55));
+        GOUT(384, _g3_5(gx+235, gy+285, gz+60));
+        GOUT(385, _g3_5(gx+230, gy+290, gz+60));
+        GOUT(386, _g3_5(gx+230, gy+285, gz+65));
+        GOUT(387, _g3_5(gx+225, gy+295, gz+60));
+        GOUT(388, _g3_5(gx+225, gy+290, gz+65));
+        GOUT(389, _g3_5(gx+225, gy+285, gz+70));
+        GOUT(390, _g3_5(gx+235, gy+270, gz+75));
+        GOUT(391, _g3_5(gx+230, gy+275, gz+75));
+        GOUT(392, _g3_5(gx+230, gy+270, gz+80));
+        GOUT(393, _g3_5(gx+225, gy+280, gz+75));
+        GOUT(394, _g3_5(gx+225, gy+275, gz+80));
+        GOUT(395, _g3_5(gx+225, gy+270, gz+85));
+        GOUT(396, _g3_5(gx+265, gy+225, gz+90));
+        GOUT(397, _g3_5(gx+260, gy+230, gz+90));
+        GOUT(398, _g3_5(gx+260, gy+225, gz+95));
+        GOUT(399, _g3_5(gx+255, gy+235, gz+90));
+        GOUT(400, _g3_5(gx+255, gy+230, gz+95));
+        GOUT(401, _g3_5(gx+255, gy+225, gz+100));
+        GOUT(402, _g3_5(gx+250, gy+240, gz+90));
+        GOUT(403, _g3_5(gx+245, gy+245, gz+90));
+        GOUT(404, _g3_5(gx+245, gy+240, gz+95));
+        GOUT(405, _g3_5(gx+240, gy+250, gz+90));
+        GOUT(406, _g3_5(gx+240, gy+245, gz+95));
+        GOUT(407, _g3_5(gx+240, gy+240, gz+100));
+        GOUT(408, _g3_5(gx+250, gy+225, gz+105));
+        GOUT(409, _g3_5(gx+245, gy+230, gz+105));
+        GOUT(410, _g3_5(gx+245, gy+225, gz+110));
+        GOUT(411, _g3_5(gx+240, gy+235, gz+105));
+        GOUT(412, _g3_5(gx+240, gy+230, gz+110));
+        GOUT(413, _g3_5(gx+240, gy+225, gz+115));
+        GOUT(414, _g3_5(gx+235, gy+255, gz+90));
+        GOUT(415, _g3_5(gx+230, gy+260, gz+90));
+        GOUT(416, _g3_5(gx+230, gy+255, gz+95));
+        GOUT(417, _g3_5(gx+225, gy+265, gz+90));
+        GOUT(418, _g3_5(gx+225, gy+260, gz+95));
+        GOUT(419, _g3_5(gx+225, gy+255, gz+100));
+        GOUT(420, _g3_5(gx+235, gy+240, gz+105));
+        GOUT(421, _g3_5(gx+230, gy+245, gz+105));
+        GOUT(422, _g3_5(gx+230, gy+240, gz+110));
+        GOUT(423, _g3_5(gx+225, gy+250, gz+105));
+        GOUT(424, _g3_5(gx+225, gy+245, gz+110));
+        GOUT(425, _g3_5(gx+225, gy+240, gz+115));
+        GOUT(426, _g3_5(gx+235, gy+225, gz+120));
+        GOUT(427, _g3_5(gx+230, gy+230, gz+120));
+        GOUT(428, _g3_5(gx+230, gy+225, gz+125));
+        GOUT(429, _g3_5(gx+225, gy+235, gz+120));
+        GOUT(430, _g3_5(gx+225, gy+230, gz+125));
+        GOUT(431, _g3_5(gx+225, gy+225, gz+130));
+        GOUT(432, _g2_5(gx+355, gz+225));
+        GOUT(433, _g3_5(gx+350, gy+5, gz+225));
+        GOUT(434, _g2_5(gx+350, gz+230));
+        GOUT(435, _g3_5(gx+345, gy+10, gz+225));
+        GOUT(436, _g3_5(gx+345, gy+5, gz+230));
+        GOUT(437, _g2_5(gx+345, gz+235));
+        GOUT(438, _g3_5(gx+340, gy+15, gz+225));
+        GOUT(439, _g3_5(gx+335, gy+20, gz+225));
+        GOUT(440, _g3_5(gx+335, gy+15, gz+230));
+        GOUT(441, _g3_5(gx+330, gy+25, gz+225));
+        GOUT(442, _g3_5(gx+330, gy+20, gz+230));
+        GOUT(443, _g3_5(gx+330, gy+15, gz+235));
+        GOUT(444, _g2_5(gx+340, gz+240));
+        GOUT(445, _g3_5(gx+335, gy+5, gz+240));
+        GOUT(446, _g2_5(gx+335, gz+245));
+        GOUT(447, _g3_5(gx+330, gy+10, gz+240));
+        GOUT(448, _g3_5(gx+330, gy+5, gz+245));
+        GOUT(449, _g2_5(gx+330, gz+250));
+        GOUT(450, _g3_5(gx+325, gy+30, gz+225));
+        GOUT(451, _g3_5(gx+320, gy+35, gz+225));
+        GOUT(452, _g3_5(gx+320, gy+30, gz+230));
+        GOUT(453, _g3_5(gx+315, gy+40, gz+225));
+        GOUT(454, _g3_5(gx+315, gy+35, gz+230));
+        GOUT(455, _g3_5(gx+315, gy+30, gz+235));
+        GOUT(456, _g3_5(gx+325, gy+15, gz+240));
+        GOUT(457, _g3_5(gx+320, gy+20, gz+240));
+        GOUT(458, _g3_5(gx+320, gy+15, gz+245));
+        GOUT(459, _g3_5(gx+315, gy+25, gz+240));
+        GOUT(460, _g3_5(gx+315, gy+20, gz+245));
+        GOUT(461, _g3_5(gx+315, gy+15, gz+250));
+        GOUT(462, _g2_5(gx+325, gz+255));
+        GOUT(463, _g3_5(gx+320, gy+5, gz+255));
+        GOUT(464, _g2_5(gx+320, gz+260));
+        GOUT(465, _g3_5(gx+315, gy+10, gz+255));
+        GOUT(466, _g3_5(gx+315, gy+5, gz+260));
+        GOUT(467, _g2_5(gx+315, gz+265));
+        GOUT(468, _g3_5(gx+310, gy+45, gz+225));
+        GOUT(469, _g3_5(gx+305, gy+50, gz+225));
+        GOUT(470, _g3_5(gx+305, gy+45, gz+230));
+        GOUT(471, _g3_5(gx+300, gy+55, gz+225));
+        GOUT(472, _g3_5(gx+300, gy+50, gz+230));
+        GOUT(473, _g3_5(gx+300, gy+45, gz+235));
+        GOUT(474, _g3_5(gx+295, gy+60, gz+225));
+        GOUT(475, _g3_5(gx+290, gy+65, gz+225));
+        GOUT(476, _g3_5(gx+290, gy+60, gz+230));
+        GOUT(477, _g3_5(gx+285, gy+70, gz+225));
+        GOUT(478, _g3_5(gx+285, gy+65, gz+230));
+        GOUT(479, _g3_5(gx+285, gy+60, gz+235));
+        GOUT(480, _g3_5(gx+295, gy+45, gz+240));
+        GOUT(481, _g3_5(gx+290, gy+50, gz+240));
+        GOUT(482, _g3_5(gx+290, gy+45, gz+245));
+        GOUT(483, _g3_5(gx+285, gy+55, gz+240));
+        GOUT(484, _g3_5(gx+285, gy+50, gz+245));
+        GOUT(485, _g3_5(gx+285, gy+45, gz+250));
+        GOUT(486, _g3_5(gx+280, gy+75, gz+225));
+        GOUT(487, _g3_5(gx+275, gy+80, gz+225));
+        GOUT(488, _g3_5(gx+275, gy+75, gz+230));
+        GOUT(489, _g3_5(gx+270, gy+85, gz+225));
+        GOUT(490, _g3_5(gx+270, gy+80, gz+230));
+        GOUT(491, _g3_5(gx+270, gy+75, gz+235));
+        GOUT(492, _g3_5(gx+280, gy+60, gz+240));
+        GOUT(493, _g3_5(gx+275, gy+65, gz+240));
+        GOUT(494, _g3_5(gx+275, gy+60, gz+245));
+        GOUT(495, _g3_5(gx+270, gy+70, gz+240));
+        GOUT(496, _g3_5(gx+270, gy+65, gz+245));
+        GOUT(497, _g3_5(gx+270, gy+60, gz+250));
+        GOUT(498, _g3_5(gx+280, gy+45, gz+255));
+        GOUT(499, _g3_5(gx+275, gy+50, gz+255));
+        GOUT(500, _g3_5(gx+275, gy+45, gz+260));
+        GOUT(501, _g3_5(gx+270, gy+55, gz+255));
+        GOUT(502, _g3_5(gx+270, gy+50, gz+260));
+        GOUT(503, _g3_5(gx+270, gy+45, gz+265));
+        GOUT(504, _g2_5(gx+310, gz+270));
+        GOUT(505, _g3_5(gx+305, gy+5, gz+270));
+        GOUT(506, _g2_5(gx+305, gz+275));
+        GOUT(507, _g3_5(gx+300, gy+10, gz+270));
+        GOUT(508, _g3_5(gx+300, gy+5, gz+275));
+        GOUT(509, _g2_5(gx+300, gz+280));
+        GOUT(510, _g3_5(gx+295, gy+15, gz+270));
+        GOUT(511, _g3_5(gx+290, gy+20, gz+270));
+        GOUT(512, _g3_5(gx+290, gy+15, gz+275));
+        GOUT(513, _g3_5(gx+285, gy+25, gz+270));
+        GOUT(514, _g3_5(gx+285, gy+20, gz+275));
+        GOUT(515, _g3_5(gx+285, gy+15, gz+280));
+        GOUT(516, _g2_5(gx+295, gz+285));
+        GOUT(517, _g3_5(gx+290, gy+5, gz+285));
+        GOUT(518, _g2_5(gx+290, gz+290));
+        GOUT(519, _g3_5(gx+285, gy+10, gz+285));
+        GOUT(520, _g3_5(gx+285, gy+5, gz+290));
+        GOUT(521, _g2_5(gx+285, gz+295));
+        GOUT(522, _g3_5(gx+280, gy+30, gz+270));
+        GOUT(523, _g3_5(gx+275, gy+35, gz+270));
+        GOUT(524, _g3_5(gx+275, gy+30, gz+275));
+        GOUT(525, _g3_5(gx+270, gy+40, gz+270));
+        GOUT(526, _g3_5(gx+270, gy+35, gz+275));
+        GOUT(527, _g3_5(gx+270, gy+30, gz+280));
+        GOUT(528, _g3_5(gx+280, gy+15, gz+285));
+        GOUT(529, _g3_5(gx+275, gy+20, gz+285));
+        GOUT(530, _g3_5(gx+275, gy+15, gz+290));
+        GOUT(531, _g3_5(gx+270, gy+25, gz+285));
+        GOUT(532, _g3_5(gx+270, gy+20, gz+290));
+        GOUT(533, _g3_5(gx+270, gy+15, gz+295));
+        GOUT(534, _g2_5(gx+280, gz+300));
+        GOUT(535, _g3_5(gx+275, gy+5, gz+300));
+        GOUT(536, _g2_5(gx+275, gz+305));
+        GOUT(537, _g3_5(gx+270, gy+10, gz+300));
+        GOUT(538, _g3_5(gx+270, gy+5, gz+305));
+        GOUT(539, _g2_5(gx+270, gz+310));
+        GOUT(540, _g3_5(gx+265, gy+90, gz+225));
+        GOUT(541, _g3_5(gx+260, gy+95, gz+225));
+        GOUT(542, _g3_5(gx+260, gy+90, gz+230));
+        GOUT(543, _g3_5(gx+255, gy+100, gz+225));
+        GOUT(544, _g3_5(gx+255, gy+95, gz+230));
+        GOUT(545, _g3_5(gx+255, gy+90, gz+235));
+        GOUT(546, _g3_5(gx+250, gy+105, gz+225));
+        GOUT(547, _g3_5(gx+245, gy+110, gz+225));
+        GOUT(548, _g3_5(gx+245, gy+105, gz+230));
+        GOUT(549, _g3_5(gx+240, gy+115, gz+225));
+        GOUT(550, _g3_5(gx+240, gy+110, gz+230));
+        GOUT(551, _g3_5(gx+240, gy+105, gz+235));
+        GOUT(552, _g3_5(gx+250, gy+90, gz+240));
+        GOUT(553, _g3_5(gx+245, gy+95, gz+240));
+        GOUT(554, _g3_5(gx+245, gy+90, gz+245));
+        GOUT(555, _g3_5(gx+240, gy+100, gz+240));
+        GOUT(556, _g3_5(gx+240, gy+95, gz+245));
+        GOUT(557, _g3_5(gx+240, gy+90, gz+250));
+        GOUT(558, _g3_5(gx+235, gy+120, gz+225));
+        GOUT(559, _g3_5(gx+230, gy+125, gz+225));
+        GOUT(560, _g3_5(gx+230, gy+120, gz+230));
+        GOUT(561, _g3_5(gx+225, gy+130, gz+225));
+        GOUT(562, _g3_5(gx+225, gy+125, gz+230));
+        GOUT(563, _g3_5(gx+225, gy+120, gz+235));
+        GOUT(564, _g3_5(gx+235, gy+105, gz+240));
+        GOUT(565, _g3_5(gx+230, gy+110, gz+240));
+        GOUT(566, _g3_5(gx+230, gy+105, gz+245));
+        GOUT(567, _g3_5(gx+225, gy+115, gz+240));
+        GOUT(568, _g3_5(gx+225, gy+110, gz+245));
+        GOUT(569, _g3_5(gx+225, gy+105, gz+250));
+        GOUT(570, _g3_5(gx+235, gy+90, gz+255));
+        GOUT(571, _g3_5(gx+230, gy+95, gz+255));
+        GOUT(572, _g3_5(gx+230, gy+90, gz+260));
+        GOUT(573, _g3_5(gx+225, gy+100, gz+255));
+        GOUT(574, _g3_5(gx+225, gy+95, gz+260));
+        GOUT(575, _g3_5(gx+225, gy+90, gz+265));
+        GOUT(576, _g3_5(gx+265, gy+45, gz+270));
+        GOUT(577, _g3_5(gx+260, gy+50, gz+270));
+        GOUT(578, _g3_5(gx+260, gy+45, gz+275));
+        GOUT(579, _g3_5(gx+255, gy+55, gz+270));
+        GOUT(580, _g3_5(gx+255, gy+50, gz+275));
+        GOUT(581, _g3_5(gx+255, gy+45, gz+280));
+        GOUT(582, _g3_5(gx+250, gy+60, gz+270));
+        GOUT(583, _g3_5(gx+245, gy+65, gz+270));
+        GOUT(584, _g3_5(gx+245, gy+60, gz+275));
+        GOUT(585, _g3_5(gx+240, gy+70, gz+270));
+        GOUT(586, _g3_5(gx+240, gy+65, gz+275));
+        GOUT(587, _g3_5(gx+240, gy+60, gz+280));
+        GOUT(588, _g3_5(gx+250, gy+45, gz+285));
+        GOUT(589, _g3_5(gx+245, gy+50, gz+285));
+        GOUT(590, _g3_5(gx+245, gy+45, gz+290));
+        GOUT(591, _g3_5(gx+240, gy+55, gz+285));
+        GOUT(592, _g3_5(gx+240, gy+50, gz+290));
+        GOUT(593, _g3_5(gx+240, gy+45, gz+295));
+        GOUT(594, _g3_5(gx+235, gy+75, gz+270));
+        GOUT(595, _g3_5(gx+230, gy+80, gz+270));
+        GOUT(596, _g3_5(gx+230, gy+75, gz+275));
+        GOUT(597, _g3_5(gx+225, gy+85, gz+270));
+        GOUT(598, _g3_5(gx+225, gy+80, gz+275));
+        GOUT(599, _g3_5(gx+225, gy+75, gz+280));
+        GOUT(600, _g3_5(gx+235, gy+60, gz+285));
+        GOUT(601, _g3_5(gx+230, gy+65, gz+285));
+        GOUT(602, _g3_5(gx+230, gy+60, gz+290));
+        GOUT(603, _g3_5(gx+225, gy+70, gz+285));
+        GOUT(604, _g3_5(gx+225, gy+65, gz+290));
+        GOUT(605, _g3_5(gx+225, gy+60, gz+295));
+        GOUT(606, _g3_5(gx+235, gy+45, gz+300));
+        GOUT(607, _g3_5(gx+230, gy+50, gz+300));
+        GOUT(608, _g3_5(gx+230, gy+45, gz+305));
+        GOUT(609, _g3_5(gx+225, gy+55, gz+300));
+        GOUT(610, _g3_5(gx+225, gy+50, gz+305));
+        GOUT(611, _g3_5(gx+225, gy+45, gz+310));
+        GOUT(612, _g2_5(gx+265, gz+315));
+        GOUT(613, _g3_5(gx+260, gy+5, gz+315));
+        GOUT(614, _g2_5(gx+260, gz+320));
+        GOUT(615, _g3_5(gx+255, gy+10, gz+315));
+        GOUT(616, _g3_5(gx+255, gy+5, gz+320));
+        GOUT(617, _g2_5(gx+255, gz+325));
+        GOUT(618, _g3_5(gx+250, gy+15, gz+315));
+        GOUT(619, _g3_5(gx+245, gy+20, gz+315));
+        GOUT(620, _g3_5(gx+245, gy+15, gz+320));
+        GOUT(621, _g3_5(gx+240, gy+25, gz+315));
+        GOUT(622, _g3_5(gx+240, gy+20, gz+320));
+        GOUT(623, _g3_5(gx+240, gy+15, gz+325));
+        GOUT(624, _g2_5(gx+250, gz+330));
+        GOUT(625, _g3_5(gx+245, gy+5, gz+330));
+        GOUT(626, _g2_5(gx+245, gz+335));
+        GOUT(627, _g3_5(gx+240, gy+10, gz+330));
+        GOUT(628, _g3_5(gx+240, gy+5, gz+335));
+        GOUT(629, _g2_5(gx+240, gz+340));
+        GOUT(630, _g3_5(gx+235, gy+30, gz+315));
+        GOUT(631, _g3_5(gx+230, gy+35, gz+315));
+        GOUT(632, _g3_5(gx+230, gy+30, gz+320));
+        GOUT(633, _g3_5(gx+225, gy+40, gz+315));
+        GOUT(634, _g3_5(gx+225, gy+35, gz+320));
+        GOUT(635, _g3_5(gx+225, gy+30, gz+325));
+        GOUT(636, _g3_5(gx+235, gy+15, gz+330));
+        GOUT(637, _g3_5(gx+230, gy+20, gz+330));
+        GOUT(638, _g3_5(gx+230, gy+15, gz+335));
+        GOUT(639, _g3_5(gx+225, gy+25, gz+330));
+        GOUT(640, _g3_5(gx+225, gy+20, gz+335));
+        GOUT(641, _g3_5(gx+225, gy+15, gz+340));
+        GOUT(642, _g2_5(gx+235, gz+345));
+        GOUT(643, _g3_5(gx+230, gy+5, gz+345));
+        GOUT(644, _g2_5(gx+230, gz+350));
+        GOUT(645, _g3_5(gx+225, gy+10, gz+345));
+        GOUT(646, _g3_5(gx+225, gy+5, gz+350));
+        GOUT(647, _g2_5(gx+225, gz+355));
+        GOUT(648, _g3_5(gx+130, gy+450, gz+0));
+        GOUT(649, _g3_5(gx+125, gy+455, gz+0));
+        GOUT(650, _g3_5(gx+125, gy+450, gz+5));
+        GOUT(651, _g3_5(gx+120, gy+460, gz+0));
+        GOUT(652, _g3_5(gx+120, gy+455, gz+5));
+        GOUT(653, _g3_5(gx+120, gy+450, gz+10));
+        GOUT(654, _g3_5(gx+115, gy+465, gz+0));
+        GOUT(655, _g3_5(gx+110, gy+470, gz+0));
+        GOUT(656, _g3_5(gx+110, gy+465, gz+5));
+        GOUT(657, _g3_5(gx+105, gy+475, gz+0));
+        GOUT(658, _g3_5(gx+105, gy+470, gz+5));
+        GOUT(659, _g3_5(gx+105, gy+465, gz+10));
+        GOUT(660, _g3_5(gx+115, gy+450, gz+15));
+        GOUT(661, _g3_5(gx+110, gy+455, gz+15));
+        GOUT(662, _g3_5(gx+110, gy+450, gz+20));
+        GOUT(663, _g3_5(gx+105, gy+460, gz+15));
+        GOUT(664, _g3_5(gx+105, gy+455, gz+20));
+        GOUT(665, _g3_5(gx+105, gy+450, gz+25));
+        GOUT(666, _g3_5(gx+100, gy+480, gz+0));
+        GOUT(667, _g3_5(gx+95, gy+485, gz+0));
+        GOUT(668, _g3_5(gx+95, gy+480, gz+5));
+        GOUT(669, _g3_5(gx+90, gy+490, gz+0));
+        GOUT(670, _g3_5(gx+90, gy+485, gz+5));
+        GOUT(671, _g3_5(gx+90, gy+480, gz+10));
+        GOUT(672, _g3_5(gx+100, gy+465, gz+15));
+        GOUT(673, _g3_5(gx+95, gy+470, gz+15));
+        GOUT(674, _g3_5(gx+95, gy+465, gz+20));
+        GOUT(675, _g3_5(gx+90, gy+475, gz+15));
+        GOUT(676, _g3_5(gx+90, gy+470, gz+20));
+        GOUT(677, _g3_5(gx+90, gy+465, gz+25));
+        GOUT(678, _g3_5(gx+100, gy+450, gz+30));
+        GOUT(679, _g3_5(gx+95, gy+455, gz+30));
+        GOUT(680, _g3_5(gx+95, gy+450, gz+35));
+        GOUT(681, _g3_5(gx+90, gy+460, gz+30));
+        GOUT(682, _g3_5(gx+90, gy+455, gz+35));
+        GOUT(683, _g3_5(gx+90, gy+450, gz+40));
+        GOUT(684, _g3_5(gx+85, gy+495, gz+0));
+        GOUT(685, _g3_5(gx+80, gy+500, gz+0));
+        GOUT(686, _g3_5(gx+80, gy+495, gz+5));
+        GOUT(687, _g3_5(gx+75, gy+505, gz+0));
+        GOUT(688, _g3_5(gx+75, gy+500, gz+5));
+        GOUT(689, _g3_5(gx+75, gy+495, gz+10));
+        GOUT(690, _g3_5(gx+70, gy+510, gz+0));
+        GOUT(691, _g3_5(gx+65, gy+515, gz+0));
+        GOUT(692, _g3_5(gx+65, gy+510, gz+5));
+        GOUT(693, _g3_5(gx+60, gy+520, gz+0));
+        GOUT(694, _g3_5(gx+60, gy+515, gz+5));
+        GOUT(695, _g3_5(gx+60, gy+510, gz+10));
+        GOUT(696, _g3_5(gx+70, gy+495, gz+15));
+        GOUT(697, _g3_5(gx+65, gy+500, gz+15));
+        GOUT(698, _g3_5(gx+65, gy+495, gz+20));
+        GOUT(699, _g3_5(gx+60, gy+505, gz+15));
+        GOUT(700, _g3_5(gx+60, gy+500, gz+20));
+        GOUT(701, _g3_5(gx+60, gy+495, gz+25));
+        GOUT(702, _g3_5(gx+55, gy+525, gz+0));
+        GOUT(703, _g3_5(gx+50, gy+530, gz+0));
+        GOUT(704, _g3_5(gx+50, gy+525, gz+5));
+        GOUT(705, _g3_5(gx+45, gy+535, gz+0));
+        GOUT(706, _g3_5(gx+45, gy+530, gz+5));
+        GOUT(707, _g3_5(gx+45, gy+525, gz+10));
+        GOUT(708, _g3_5(gx+55, gy+510, gz+15));
+        GOUT(709, _g3_5(gx+50, gy+515, gz+15));
+        GOUT(710, _g3_5(gx+50, gy+510, gz+20));
+        GOUT(711, _g3_5(gx+45, gy+520, gz+15));
+        GOUT(712, _g3_5(gx+45, gy+515, gz+20));
+        GOUT(713, _g3_5(gx+45, gy+510, gz+25));
+        GOUT(714, _g3_5(gx+55, gy+495, gz+30));
+        GOUT(715, _g3_5(gx+50, gy+500, gz+30));
+        GOUT(716, _g3_5(gx+50, gy+495, gz+35));
+        GOUT(717, _g3_5(gx+45, gy+505, gz+30));
+        GOUT(718, _g3_5(gx+45, gy+500, gz+35));
+        GOUT(719, _g3_5(gx+45, gy+495, gz+40));
+        GOUT(720, _g3_5(gx+85, gy+450, gz+45));
+        GOUT(721, _g3_5(gx+80, gy+455, gz+45));
+        GOUT(722, _g3_5(gx+80, gy+450, gz+50));
+        GOUT(723, _g3_5(gx+75, gy+460, gz+45));
+        GOUT(724, _g3_5(gx+75, gy+455, gz+50));
+        GOUT(725, _g3_5(gx+75, gy+450, gz+55));
+        GOUT(726, _g3_5(gx+70, gy+465, gz+45));
+        GOUT(727, _g3_5(gx+65, gy+470, gz+45));
+        GOUT(728, _g3_5(gx+65, gy+465, gz+50));
+        GOUT(729, _g3_5(gx+60, gy+475, gz+45));
+        GOUT(730, _g3_5(gx+60, gy+470, gz+50));
+        GOUT(731, _g3_5(gx+60, gy+465, gz+55));
+        GOUT(732, _g3_5(gx+70, gy+450, gz+60));
+        GOUT(733, _g3_5(gx+65, gy+455, gz+60));
+        GOUT(734, _g3_5(gx+65, gy+450, gz+65));
+        GOUT(735, _g3_5(gx+60, gy+460, gz+60));
+        GOUT(736, _g3_5(gx+60, gy+455, gz+65));
+        GOUT(737, _g3_5(gx+60, gy+450, gz+70));
+        GOUT(738, _g3_5(gx+55, gy+480, gz+45));
+        GOUT(739, _g3_5(gx+50, gy+485, gz+45));
+        GOUT(740, _g3_5(gx+50, gy+480, gz+50));
+        GOUT(741, _g3_5(gx+45, gy+490, gz+45));
+        GOUT(742, _g3_5(gx+45, gy+485, gz+50));
+        GOUT(743, _g3_5(gx+45, gy+480, gz+55));
+        GOUT(744, _g3_5(gx+55, gy+465, gz+60));
+        GOUT(745, _g3_5(gx+50, gy+470, gz+60));
+        GOUT(746, _g3_5(gx+50, gy+465, gz+65));
+        GOUT(747, _g3_5(gx+45, gy+475, gz+60));
+        GOUT(748, _g3_5(gx+45, gy+470, gz+65));
+        GOUT(749, _g3_5(gx+45, gy+465, gz+70));
+        GOUT(750, _g3_5(gx+55, gy+450, gz+75));
+        GOUT(751, _g3_5(gx+50, gy+455, gz+75));
+        GOUT(752, _g3_5(gx+50, gy+450, gz+80));
+        GOUT(753, _g3_5(gx+45, gy+460, gz+75));
+        GOUT(754, _g3_5(gx+45, gy+455, gz+80));
+        GOUT(755, _g3_5(gx+45, gy+450, gz+85));
+        GOUT(756, _g3_5(gx+40, gy+540, gz+0));
+        GOUT(757, _g3_5(gx+35, gy+545, gz+0));
+        GOUT(758, _g3_5(gx+35, gy+540, gz+5));
+        GOUT(759, _g3_5(gx+30, gy+550, gz+0));
+        GOUT(760, _g3_5(gx+30, gy+545, gz+5));
+        GOUT(761, _g3_5(gx+30, gy+540, gz+10));
+        GOUT(762, _g3_5(gx+25, gy+555, gz+0));
+        GOUT(763, _g3_5(gx+20, gy+560, gz+0));
+        GOUT(764, _g3_5(gx+20, gy+555, gz+5));
+        GOUT(765, _g3_5(gx+15, gy+565, gz+0));
+        GOUT(766, _g3_5(gx+15, gy+560, gz+5));
+        GOUT(767, _g3_5(gx+15, gy+555, gz+10));
+        GOUT(768, _g3_5(gx+25, gy+540, gz+15));
+        GOUT(769, _g3_5(gx+20, gy+545, gz+15));
+        GOUT(770, _g3_5(gx+20, gy+540, gz+20));
+        GOUT(771, _g3_5(gx+15, gy+550, gz+15));
+        GOUT(772, _g3_5(gx+15, gy+545, gz+20));
+        GOUT(773, _g3_5(gx+15, gy+540, gz+25));
+        GOUT(774, _g3_5(gx+10, gy+570, gz+0));
+        GOUT(775, _g3_5(gx+5, gy+575, gz+0));
+        GOUT(776, _g3_5(gx+5, gy+570, gz+5));
+        GOUT(777, _g2_5(gy+580, gz+0));
+        GOUT(778, _g2_5(gy+575, gz+5));
+        GOUT(779, _g2_5(gy+570, gz+10));
+        GOUT(780, _g3_5(gx+10, gy+555, gz+15));
+        GOUT(781, _g3_5(gx+5, gy+560, gz+15));
+        GOUT(782, _g3_5(gx+5, gy+555, gz+20));
+        GOUT(783, _g2_5(gy+565, gz+15));
+        GOUT(784, _g2_5(gy+560, gz+20));
+        GOUT(785, _g2_5(gy+555, gz+25));
+        GOUT(786, _g3_5(gx+10, gy+540, gz+30));
+        GOUT(787, _g3_5(gx+5, gy+545, gz+30));
+        GOUT(788, _g3_5(gx+5, gy+540, gz+35));
+        GOUT(789, _g2_5(gy+550, gz+30));
+        GOUT(790, _g2_5(gy+545, gz+35));
+        GOUT(791, _g2_5(gy+540, gz+40));
+        GOUT(792, _g3_5(gx+40, gy+495, gz+45));
+        GOUT(793, _g3_5(gx+35, gy+500, gz+45));
+        GOUT(794, _g3_5(gx+35, gy+495, gz+50));
+        GOUT(795, _g3_5(gx+30, gy+505, gz+45));
+        GOUT(796, _g3_5(gx+30, gy+500, gz+50));
+        GOUT(797, _g3_5(gx+30, gy+495, gz+55));
+        GOUT(798, _g3_5(gx+25, gy+510, gz+45));
+        GOUT(799, _g3_5(gx+20, gy+515, gz+45));
+        GOUT(800, _g3_5(gx+20, gy+510, gz+50));
+        GOUT(801, _g3_5(gx+15, gy+520, gz+45));
+        GOUT(802, _g3_5(gx+15, gy+515, gz+50));
+        GOUT(803, _g3_5(gx+15, gy+510, gz+55));
+        GOUT(804, _g3_5(gx+25, gy+495, gz+60));
+        GOUT(805, _g3_5(gx+20, gy+500, gz+60));
+        GOUT(806, _g3_5(gx+20, gy+495, gz+65));
+        GOUT(807, _g3_5(gx+15, gy+505, gz+60));
+        GOUT(808, _g3_5(gx+15, gy+500, gz+65));
+        GOUT(809, _g3_5(gx+15, gy+495, gz+70));
+        GOUT(810, _g3_5(gx+10, gy+525, gz+45));
+        GOUT(811, _g3_5(gx+5, gy+530, gz+45));
+        GOUT(812, _g3_5(gx+5, gy+525, gz+50));
+        GOUT(813, _g2_5(gy+535, gz+45));
+        GOUT(814, _g2_5(gy+530, gz+50));
+        GOUT(815, _g2_5(gy+525, gz+55));
+        GOUT(816, _g3_5(gx+10, gy+510, gz+60));
+        GOUT(817, _g3_5(gx+5, gy+515, gz+60));
+        GOUT(818, _g3_5(gx+5, gy+510, gz+65));
+        GOUT(819, _g2_5(gy+520, gz+60));
+        GOUT(820, _g2_5(gy+515, gz+65));
+        GOUT(821, _g2_5(gy+510, gz+70));
+        GOUT(822, _g3_5(gx+10, gy+495, gz+75));
+        GOUT(823, _g3_5(gx+5, gy+500, gz+75));
+        GOUT(824, _g3_5(gx+5, gy+495, gz+80));
+        GOUT(825, _g2_5(gy+505, gz+75));
+        GOUT(826, _g2_5(gy+500, gz+80));
+        GOUT(827, _g2_5(gy+495, gz+85));
+        GOUT(828, _g3_5(gx+40, gy+450, gz+90));
+        GOUT(829, _g3_5(gx+35, gy+455, gz+90));
+        GOUT(830, _g3_5(gx+35, gy+450, gz+95));
+        GOUT(831, _g3_5(gx+30, gy+460, gz+90));
+        GOUT(832, _g3_5(gx+30, gy+455, gz+95));
+        GOUT(833, _g3_5(gx+30, gy+450, gz+100));
+        GOUT(834, _g3_5(gx+25, gy+465, gz+90));
+        GOUT(835, _g3_5(gx+20, gy+470, gz+90));
+        GOUT(836, _g3_5(gx+20, gy+465, gz+95));
+        GOUT(837, _g3_5(gx+15, gy+475, gz+90));
+        GOUT(838, _g3_5(gx+15, gy+470, gz+95));
+        GOUT(839, _g3_5(gx+15, gy+465, gz+100));
+        GOUT(840, _g3_5(gx+25, gy+450, gz+105));
+        GOUT(841, _g3_5(gx+20, gy+455, gz+105));
+        GOUT(842, _g3_5(gx+20, gy+450, gz+110));
+        GOUT(843, _g3_5(gx+15, gy+460, gz+105));
+        GOUT(844, _g3_5(gx+15, gy+455, gz+110));
+        GOUT(845, _g3_5(gx+15, gy+450, gz+115));
+        GOUT(846, _g3_5(gx+10, gy+480, gz+90));
+        GOUT(847, _g3_5(gx+5, gy+485, gz+90));
+        GOUT(848, _g3_5(gx+5, gy+480, gz+95));
+        GOUT(849, _g2_5(gy+490, gz+90));
+        GOUT(850, _g2_5(gy+485, gz+95));
+        GOUT(851, _g2_5(gy+480, gz+100));
+        GOUT(852, _g3_5(gx+10, gy+465, gz+105));
+        GOUT(853, _g3_5(gx+5, gy+470, gz+105));
+        GOUT(854, _g3_5(gx+5, gy+465, gz+110));
+        GOUT(855, _g2_5(gy+475, gz+105));
+        GOUT(856, _g2_5(gy+470, gz+110));
+        GOUT(857, _g2_5(gy+465, gz+115));
+        GOUT(858, _g3_5(gx+10, gy+450, gz+120));
+        GOUT(859, _g3_5(gx+5, gy+455, gz+120));
+        GOUT(860, _g3_5(gx+5, gy+450, gz+125));
+        GOUT(861, _g2_5(gy+460, gz+120));
+        GOUT(862, _g2_5(gy+455, gz+125));
+        GOUT(863, _g2_5(gy+450, gz+130));
+        GOUT(864, _g3_5(gx+130, gy+225, gz+225));
+        GOUT(865, _g3_5(gx+125, gy+230, gz+225));
+        GOUT(866, _g3_5(gx+125, gy+225, gz+230));
+        GOUT(867, _g3_5(gx+120, gy+235, gz+225));
+        GOUT(868, _g3_5(gx+120, gy+230, gz+230));
+        GOUT(869, _g3_5(gx+120, gy+225, gz+235));
+        GOUT(870, _g3_5(gx+115, gy+240, gz+225));
+        GOUT(871, _g3_5(gx+110, gy+245, gz+225));
+        GOUT(872, _g3_5(gx+110, gy+240, gz+230));
+        GOUT(873, _g3_5(gx+105, gy+250, gz+225));
+        GOUT(874, _g3_5(gx+105, gy+245, gz+230));
+        GOUT(875, _g3_5(gx+105, gy+240, gz+235));
+        GOUT(876, _g3_5(gx+115, gy+225, gz+240));
+        GOUT(877, _g3_5(gx+110, gy+230, gz+240));
+        GOUT(878, _g3_5(gx+110, gy+225, gz+245));
+        GOUT(879, _g3_5(gx+105, gy+235, gz+240));
+        GOUT(880, _g3_5(gx+105, gy+230, gz+245));
+        GOUT(881, _g3_5(gx+105, gy+225, gz+250));
+        GOUT(882, _g3_5(gx+100, gy+255, gz+225));
+        GOUT(883, _g3_5(gx+95, gy+260, gz+225));
+        GOUT(884, _g3_5(gx+95, gy+255, gz+230));
+        GOUT(885, _g3_5(gx+90, gy+265, gz+225));
+        GOUT(886, _g3_5(gx+90, gy+260, gz+230));
+        GOUT(887, _g3_5(gx+90, gy+255, gz+235));
+        GOUT(888, _g3_5(gx+100, gy+240, gz+240));
+        GOUT(889, _g3_5(gx+95, gy+245, gz+240));
+        GOUT(890, _g3_5(gx+95, gy+240, gz+245));
+        GOUT(891, _g3_5(gx+90, gy+250, gz+240));
+        GOUT(892, _g3_5(gx+90, gy+245, gz+245));
+        GOUT(893, _g3_5(gx+90, gy+240, gz+250));
+        GOUT(894, _g3_5(gx+100, gy+225, gz+255));
+        GOUT(895, _g3_5(gx+95, gy+230, gz+255));
+        GOUT(896, _g3_5(gx+95, gy+225, gz+260));
+        GOUT(897, _g3_5(gx+90, gy+235, gz+255));
+        GOUT(898, _g3_5(gx+90, gy+230, gz+260));
+        GOUT(899, _g3_5(gx+90, gy+225, gz+265));
+        GOUT(900, _g3_5(gx+85, gy+270, gz+225));
+        GOUT(901, _g3_5(gx+80, gy+275, gz+225));
+        GOUT(902, _g3_5(gx+80, gy+270, gz+230));
+        GOUT(903, _g3_5(gx+75, gy+280, gz+225));
+        GOUT(904, _g3_5(gx+75, gy+275, gz+230));
+        GOUT(905, _g3_5(gx+75, gy+270, gz+235));
+        GOUT(906, _g3_5(gx+70, gy+285, gz+225));
+        GOUT(907, _g3_5(gx+65, gy+290, gz+225));
+        GOUT(908, _g3_5(gx+65, gy+285, gz+230));
+        GOUT(909, _g3_5(gx+60, gy+295, gz+225));
+        GOUT(910, _g3_5(gx+60, gy+290, gz+230));
+        GOUT(911, _g3_5(gx+60, gy+285, gz+235));
+        GOUT(912, _g3_5(gx+70, gy+270, gz+240));
+        GOUT(913, _g3_5(gx+65, gy+275, gz+240));
+        GOUT(914, _g3_5(gx+65, gy+270, gz+245));
+        GOUT(915, _g3_5(gx+60, gy+280, gz+240));
+        GOUT(916, _g3_5(gx+60, gy+275, gz+245));
+        GOUT(917, _g3_5(gx+60, gy+270, gz+250));
+        GOUT(918, _g3_5(gx+55, gy+300, gz+225));
+        GOUT(919, _g3_5(gx+50, gy+305, gz+225));
+        GOUT(920, _g3_5(gx+50, gy+300, gz+230));
+        GOUT(921, _g3_5(gx+45, gy+310, gz+225));
+        GOUT(922, _g3_5(gx+45, gy+305, gz+230));
+        GOUT(923, _g3_5(gx+45, gy+300, gz+235));
+        GOUT(924, _g3_5(gx+55, gy+285, gz+240));
+        GOUT(925, _g3_5(gx+50, gy+290, gz+240));
+        GOUT(926, _g3_5(gx+50, gy+285, gz+245));
+        GOUT(927, _g3_5(gx+45, gy+295, gz+240));
+        GOUT(928, _g3_5(gx+45, gy+290, gz+245));
+        GOUT(929, _g3_5(gx+45, gy+285, gz+250));
+        GOUT(930, _g3_5(gx+55, gy+270, gz+255));
+        GOUT(931, _g3_5(gx+50, gy+275, gz+255));
+        GOUT(932, _g3_5(gx+50, gy+270, gz+260));
+        GOUT(933, _g3_5(gx+45, gy+280, gz+255));
+        GOUT(934, _g3_5(gx+45, gy+275, gz+260));
+        GOUT(935, _g3_5(gx+45, gy+270, gz+265));
+        GOUT(936, _g3_5(gx+85, gy+225, gz+270));
+        GOUT(937, _g3_5(gx+80, gy+230, gz+270));
+        GOUT(938, _g3_5(gx+80, gy+225, gz+275));
+        GOUT(939, _g3_5(gx+75, gy+235, gz+270));
+        GOUT(940, _g3_5(gx+75, gy+230, gz+275));
+        GOUT(941, _g3_5(gx+75, gy+225, gz+280));
+        GOUT(942, _g3_5(gx+70, gy+240, gz+270));
+        GOUT(943, _g3_5(gx+65, gy+245, gz+270));
+        GOUT(944, _g3_5(gx+65, gy+240, gz+275));
+        GOUT(945, _g3_5(gx+60, gy+250, gz+270));
+        GOUT(946, _g3_5(gx+60, gy+245, gz+275));
+        GOUT(947, _g3_5(gx+60, gy+240, gz+280));
+        GOUT(948, _g3_5(gx+70, gy+225, gz+285));
+        GOUT(949, _g3_5(gx+65, gy+230, gz+285));
+        GOUT(950, _g3_5(gx+65, gy+225, gz+290));
+        GOUT(951, _g3_5(gx+60, gy+235, gz+285));
+        GOUT(952, _g3_5(gx+60, gy+230, gz+290));
+        GOUT(953, _g3_5(gx+60, gy+225, gz+295));
+        GOUT(954, _g3_5(gx+55, gy+255, gz+270));
+        GOUT(955, _g3_5(gx+50, gy+260, gz+270));
+        GOUT(956, _g3_5(gx+50, gy+255, gz+275));
+        GOUT(957, _g3_5(gx+45, gy+265, gz+270));
+        GOUT(958, _g3_5(gx+45, gy+260, gz+275));
+        GOUT(959, _g3_5(gx+45, gy+255, gz+280));
+        GOUT(960, _g3_5(gx+55, gy+240, gz+285));
+        GOUT(961, _g3_5(gx+50, gy+245, gz+285));
+        GOUT(962, _g3_5(gx+50, gy+240, gz+290));
+        GOUT(963, _g3_5(gx+45, gy+250, gz+285));
+        GOUT(964, _g3_5(gx+45, gy+245, gz+290));
+        GOUT(965, _g3_5(gx+45, gy+240, gz+295));
+        GOUT(966, _g3_5(gx+55, gy+225, gz+300));
+        GOUT(967, _g3_5(gx+50, gy+230, gz+300));
+        GOUT(968, _g3_5(gx+50, gy+225, gz+305));
+        GOUT(969, _g3_5(gx+45, gy+235, gz+300));
+        GOUT(970, _g3_5(gx+45, gy+230, gz+305));
+        GOUT(971, _g3_5(gx+45, gy+225, gz+310));
+        GOUT(972, _g3_5(gx+40, gy+315, gz+225));
+        GOUT(973, _g3_5(gx+35, gy+320, gz+225));
+        GOUT(974, _g3_5(gx+35, gy+315, gz+230));
+        GOUT(975, _g3_5(gx+30, gy+325, gz+225));
+        GOUT(976, _g3_5(gx+30, gy+320, gz+230));
+        GOUT(977, _g3_5(gx+30, gy+315, gz+235));
+        GOUT(978, _g3_5(gx+25, gy+330, gz+225));
+        GOUT(979, _g3_5(gx+20, gy+335, gz+225));
+        GOUT(980, _g3_5(gx+20, gy+330, gz+230));
+        GOUT(981, _g3_5(gx+15, gy+340, gz+225));
+        GOUT(982, _g3_5(gx+15, gy+335, gz+230));
+        GOUT(983, _g3_5(gx+15, gy+330, gz+235));
+        GOUT(984, _g3_5(gx+25, gy+315, gz+240));
+        GOUT(985, _g3_5(gx+20, gy+320, gz+240));
+        GOUT(986, _g3_5(gx+20, gy+315, gz+245));
+        GOUT(987, _g3_5(gx+15, gy+325, gz+240));
+        GOUT(988, _g3_5(gx+15, gy+320, gz+245));
+        GOUT(989, _g3_5(gx+15, gy+315, gz+250));
+        GOUT(990, _g3_5(gx+10, gy+345, gz+225));
+        GOUT(991, _g3_5(gx+5, gy+350, gz+225));
+        GOUT(992, _g3_5(gx+5, gy+345, gz+230));
+        GOUT(993, _g2_5(gy+355, gz+225));
+        GOUT(994, _g2_5(gy+350, gz+230));
+        GOUT(995, _g2_5(gy+345, gz+235));
+        GOUT(996, _g3_5(gx+10, gy+330, gz+240));
+        GOUT(997, _g3_5(gx+5, gy+335, gz+240));
+        GOUT(998, _g3_5(gx+5, gy+330, gz+245));
+        GOUT(999, _g2_5(gy+340, gz+240));
+        GOUT(1000, _g2_5(gy+335, gz+245));
+        GOUT(1001, _g2_5(gy+330, gz+250));
+        GOUT(1002, _g3_5(gx+10, gy+315, gz+255));
+        GOUT(1003, _g3_5(gx+5, gy+320, gz+255));
+        GOUT(1004, _g3_5(gx+5, gy+315, gz+260));
+        GOUT(1005, _g2_5(gy+325, gz+255));
+        GOUT(1006, _g2_5(gy+320, gz+260));
+        GOUT(1007, _g2_5(gy+315, gz+265));
+        GOUT(1008, _g3_5(gx+40, gy+270, gz+270));
+        GOUT(1009, _g3_5(gx+35, gy+275, gz+270));
+        GOUT(1010, _g3_5(gx+35, gy+270, gz+275));
+        GOUT(1011, _g3_5(gx+30, gy+280, gz+270));
+        GOUT(1012, _g3_5(gx+30, gy+275, gz+275));
+        GOUT(1013, _g3_5(gx+30, gy+270, gz+280));
+        GOUT(1014, _g3_5(gx+25, gy+285, gz+270));
+        GOUT(1015, _g3_5(gx+20, gy+290, gz+270));
+        GOUT(1016, _g3_5(gx+20, gy+285, gz+275));
+        GOUT(1017, _g3_5(gx+15, gy+295, gz+270));
+        GOUT(1018, _g3_5(gx+15, gy+290, gz+275));
+        GOUT(1019, _g3_5(gx+15, gy+285, gz+280));
+        GOUT(1020, _g3_5(gx+25, gy+270, gz+285));
+        GOUT(1021, _g3_5(gx+20, gy+275, gz+285));
+        GOUT(1022, _g3_5(gx+20, gy+270, gz+290));
+        GOUT(1023, _g3_5(gx+15, gy+280, gz+285));
+        GOUT(1024, _g3_5(gx+15, gy+275, gz+290));
+        GOUT(1025, _g3_5(gx+15, gy+270, gz+295));
+        GOUT(1026, _g3_5(gx+10, gy+300, gz+270));
+        GOUT(1027, _g3_5(gx+5, gy+305, gz+270));
+        GOUT(1028, _g3_5(gx+5, gy+300, gz+275));
+        GOUT(1029, _g2_5(gy+310, gz+270));
+        GOUT(1030, _g2_5(gy+305, gz+275));
+        GOUT(1031, _g2_5(gy+300, gz+280));
+        GOUT(1032, _g3_5(gx+10, gy+285, gz+285));
+        GOUT(1033, _g3_5(gx+5, gy+290, gz+285));
+        GOUT(1034, _g3_5(gx+5, gy+285, gz+290));
+        GOUT(1035, _g2_5(gy+295, gz+285));
+        GOUT(1036, _g2_5(gy+290, gz+290));
+        GOUT(1037, _g2_5(gy+285, gz+295));
+        GOUT(1038, _g3_5(gx+10, gy+270, gz+300));
+        GOUT(1039, _g3_5(gx+5, gy+275, gz+300));
+        GOUT(1040, _g3_5(gx+5, gy+270, gz+305));
+        GOUT(1041, _g2_5(gy+280, gz+300));
+        GOUT(1042, _g2_5(gy+275, gz+305));
+        GOUT(1043, _g2_5(gy+270, gz+310));
+        GOUT(1044, _g3_5(gx+40, gy+225, gz+315));
+        GOUT(1045, _g3_5(gx+35, gy+230, gz+315));
+        GOUT(1046, _g3_5(gx+35, gy+225, gz+320));
+        GOUT(1047, _g3_5(gx+30, gy+235, gz+315));
+        GOUT(1048, _g3_5(gx+30, gy+230, gz+320));
+        GOUT(1049, _g3_5(gx+30, gy+225, gz+325));
+        GOUT(1050, _g3_5(gx+25, gy+240, gz+315));
+        GOUT(1051, _g3_5(gx+20, gy+245, gz+315));
+        GOUT(1052, _g3_5(gx+20, gy+240, gz+320));
+        GOUT(1053, _g3_5(gx+15, gy+250, gz+315));
+        GOUT(1054, _g3_5(gx+15, gy+245, gz+320));
+        GOUT(1055, _g3_5(gx+15, gy+240, gz+325));
+        GOUT(1056, _g3_5(gx+25, gy+225, gz+330));
+        GOUT(1057, _g3_5(gx+20, gy+230, gz+330));
+        GOUT(1058, _g3_5(gx+20, gy+225, gz+335));
+        GOUT(1059, _g3_5(gx+15, gy+235, gz+330));
+        GOUT(1060, _g3_5(gx+15, gy+230, gz+335));
+        GOUT(1061, _g3_5(gx+15, gy+225, gz+340));
+        GOUT(1062, _g3_5(gx+10, gy+255, gz+315));
+        GOUT(1063, _g3_5(gx+5, gy+260, gz+315));
+        GOUT(1064, _g3_5(gx+5, gy+255, gz+320));
+        GOUT(1065, _g2_5(gy+265, gz+315));
+        GOUT(1066, _g2_5(gy+260, gz+320));
+        GOUT(1067, _g2_5(gy+255, gz+325));
+        GOUT(1068, _g3_5(gx+10, gy+240, gz+330));
+        GOUT(1069, _g3_5(gx+5, gy+245, gz+330));
+        GOUT(1070, _g3_5(gx+5, gy+240, gz+335));
+        GOUT(1071, _g2_5(gy+250, gz+330));
+        GOUT(1072, _g2_5(gy+245, gz+335));
+        GOUT(1073, _g2_5(gy+240, gz+340));
+        GOUT(1074, _g3_5(gx+10, gy+225, gz+345));
+        GOUT(1075, _g3_5(gx+5, gy+230, gz+345));
+        GOUT(1076, _g3_5(gx+5, gy+225, gz+350));
+        GOUT(1077, _g2_5(gy+235, gz+345));
+        GOUT(1078, _g2_5(gy+230, gz+350));
+        GOUT(1079, _g2_5(gy+225, gz+355));
+        GOUT(1080, _g2_5(gx+130, gz+450));
+        GOUT(1081, _g3_5(gx+125, gy+5, gz+450));
+        GOUT(1082, _g2_5(gx+125, gz+455));
+        GOUT(1083, _g3_5(gx+120, gy+10, gz+450));
+        GOUT(1084, _g3_5(gx+120, gy+5, gz+455));
+        GOUT(1085, _g2_5(gx+120, gz+460));
+        GOUT(1086, _g3_5(gx+115, gy+15, gz+450));
+        GOUT(1087, _g3_5(gx+110, gy+20, gz+450));
+        GOUT(1088, _g3_5(gx+110, gy+15, gz+455));
+        GOUT(1089, _g3_5(gx+105, gy+25, gz+450));
+        GOUT(1090, _g3_5(gx+105, gy+20, gz+455));
+        GOUT(1091, _g3_5(gx+105, gy+15, gz+460));
+        GOUT(1092, _g2_5(gx+115, gz+465));
+        GOUT(1093, _g3_5(gx+110, gy+5, gz+465));
+        GOUT(1094, _g2_5(gx+110, gz+470));
+        GOUT(1095, _g3_5(gx+105, gy+10, gz+465));
+        GOUT(1096, _g3_5(gx+105, gy+5, gz+470));
+        GOUT(1097, _g2_5(gx+105, gz+475));
+        GOUT(1098, _g3_5(gx+100, gy+30, gz+450));
+        GOUT(1099, _g3_5(gx+95, gy+35, gz+450));
+        GOUT(1100, _g3_5(gx+95, gy+30, gz+455));
+        GOUT(1101, _g3_5(gx+90, gy+40, gz+450));
+        GOUT(1102, _g3_5(gx+90, gy+35, gz+455));
+        GOUT(1103, _g3_5(gx+90, gy+30, gz+460));
+        GOUT(1104, _g3_5(gx+100, gy+15, gz+465));
+        GOUT(1105, _g3_5(gx+95, gy+20, gz+465));
+        GOUT(1106, _g3_5(gx+95, gy+15, gz+470));
+        GOUT(1107, _g3_5(gx+90, gy+25, gz+465));
+        GOUT(1108, _g3_5(gx+90, gy+20, gz+470));
+        GOUT(1109, _g3_5(gx+90, gy+15, gz+475));
+        GOUT(1110, _g2_5(gx+100, gz+480));
+        GOUT(1111, _g3_5(gx+95, gy+5, gz+480));
+        GOUT(1112, _g2_5(gx+95, gz+485));
+        GOUT(1113, _g3_5(gx+90, gy+10, gz+480));
+        GOUT(1114, _g3_5(gx+90, gy+5, gz+485));
+        GOUT(1115, _g2_5(gx+90, gz+490));
+        GOUT(1116, _g3_5(gx+85, gy+45, gz+450));
+        GOUT(1117, _g3_5(gx+80, gy+50, gz+450));
+        GOUT(1118, _g3_5(gx+80, gy+45, gz+455));
+        GOUT(1119, _g3_5(gx+75, gy+55, gz+450));
+        GOUT(1120, _g3_5(gx+75, gy+50, gz+455));
+        GOUT(1121, _g3_5(gx+75, gy+45, gz+460));
+        GOUT(1122, _g3_5(gx+70, gy+60, gz+450));
+        GOUT(1123, _g3_5(gx+65, gy+65, gz+450));
+        GOUT(1124, _g3_5(gx+65, gy+60, gz+455));
+        GOUT(1125, _g3_5(gx+60, gy+70, gz+450));
+        GOUT(1126, _g3_5(gx+60, gy+65, gz+455));
+        GOUT(1127, _g3_5(gx+60, gy+60, gz+460));
+        GOUT(1128, _g3_5(gx+70, gy+45, gz+465));
+        GOUT(1129, _g3_5(gx+65, gy+50, gz+465));
+        GOUT(1130, _g3_5(gx+65, gy+45, gz+470));
+        GOUT(1131, _g3_5(gx+60, gy+55, gz+465));
+        GOUT(1132, _g3_5(gx+60, gy+50, gz+470));
+        GOUT(1133, _g3_5(gx+60, gy+45, gz+475));
+        GOUT(1134, _g3_5(gx+55, gy+75, gz+450));
+        GOUT(1135, _g3_5(gx+50, gy+80, gz+450));
+        GOUT(1136, _g3_5(gx+50, gy+75, gz+455));
+        GOUT(1137, _g3_5(gx+45, gy+85, gz+450));
+        GOUT(1138, _g3_5(gx+45, gy+80, gz+455));
+        GOUT(1139, _g3_5(gx+45, gy+75, gz+460));
+        GOUT(1140, _g3_5(gx+55, gy+60, gz+465));
+        GOUT(1141, _g3_5(gx+50, gy+65, gz+465));
+        GOUT(1142, _g3_5(gx+50, gy+60, gz+470));
+        GOUT(1143, _g3_5(gx+45, gy+70, gz+465));
+        GOUT(1144, _g3_5(gx+45, gy+65, gz+470));
+        GOUT(1145, _g3_5(gx+45, gy+60, gz+475));
+        GOUT(1146, _g3_5(gx+55, gy+45, gz+480));
+        GOUT(1147, _g3_5(gx+50, gy+50, gz+480));
+        GOUT(1148, _g3_5(gx+50, gy+45, gz+485));
+        GOUT(1149, _g3_5(gx+45, gy+55, gz+480));
+        GOUT(1150, _g3_5(gx+45, gy+50, gz+485));
+        GOUT(1151, _g3_5(gx+45, gy+45, gz+490));
+        GOUT(1152, _g2_5(gx+85, gz+495));
+        GOUT(1153, _g3_5(gx+80, gy+5, gz+495));
+        GOUT(1154, _g2_5(gx+80, gz+500));
+        GOUT(1155, _g3_5(gx+75, gy+10, gz+495));
+        GOUT(1156, _g3_5(gx+75, gy+5, gz+500));
+        GOUT(1157, _g2_5(gx+75, gz+505));
+        GOUT(1158, _g3_5(gx+70, gy+15, gz+495));
+        GOUT(1159, _g3_5(gx+65, gy+20, gz+495));
+        GOUT(1160, _g3_5(gx+65, gy+15, gz+500));
+        GOUT(1161, _g3_5(gx+60, gy+25, gz+495));
+        GOUT(1162, _g3_5(gx+60, gy+20, gz+500));
+        GOUT(1163, _g3_5(gx+60, gy+15, gz+505));
+        GOUT(1164, _g2_5(gx+70, gz+510));
+        GOUT(1165, _g3_5(gx+65, gy+5, gz+510));
+        GOUT(1166, _g2_5(gx+65, gz+515));
+        GOUT(1167, _g3_5(gx+60, gy+10, gz+510));
+        GOUT(1168, _g3_5(gx+60, gy+5, gz+515));
+        GOUT(1169, _g2_5(gx+60, gz+520));
+        GOUT(1170, _g3_5(gx+55, gy+30, gz+495));
+        GOUT(1171, _g3_5(gx+50, gy+35, gz+495));
+        GOUT(1172, _g3_5(gx+50, gy+30, gz+500));
+        GOUT(1173, _g3_5(gx+45, gy+40, gz+495));
+        GOUT(1174, _g3_5(gx+45, gy+35, gz+500));
+        GOUT(1175, _g3_5(gx+45, gy+30, gz+505));
+        GOUT(1176, _g3_5(gx+55, gy+15, gz+510));
+        GOUT(1177, _g3_5(gx+50, gy+20, gz+510));
+        GOUT(1178, _g3_5(gx+50, gy+15, gz+515));
+        GOUT(1179, _g3_5(gx+45, gy+25, gz+510));
+        GOUT(1180, _g3_5(gx+45, gy+20, gz+515));
+        GOUT(1181, _g3_5(gx+45, gy+15, gz+520));
+        GOUT(1182, _g2_5(gx+55, gz+525));
+        GOUT(1183, _g3_5(gx+50, gy+5, gz+525));
+        GOUT(1184, _g2_5(gx+50, gz+530));
+        GOUT(1185, _g3_5(gx+45, gy+10, gz+525));
+        GOUT(1186, _g3_5(gx+45, gy+5, gz+530));
+        GOUT(1187, _g2_5(gx+45, gz+535));
+        GOUT(1188, _g3_5(gx+40, gy+90, gz+450));
+        GOUT(1189, _g3_5(gx+35, gy+95, gz+450));
+        GOUT(1190, _g3_5(gx+35, gy+90, gz+455));
+        GOUT(1191, _g3_5(gx+30, gy+100, gz+450));
+        GOUT(1192, _g3_5(gx+30, gy+95, gz+455));
+        GOUT(1193, _g3_5(gx+30, gy+90, gz+460));
+        GOUT(1194, _g3_5(gx+25, gy+105, gz+450));
+        GOUT(1195, _g3_5(gx+20, gy+110, gz+450));
+        GOUT(1196, _g3_5(gx+20, gy+105, gz+455));
+        GOUT(1197, _g3_5(gx+15, gy+115, gz+450));
+        GOUT(1198, _g3_5(gx+15, gy+110, gz+455));
+        GOUT(1199, _g3_5(gx+15, gy+105, gz+460));
+        GOUT(1200, _g3_5(gx+25, gy+90, gz+465));
+        GOUT(1201, _g3_5(gx+20, gy+95, gz+465));
+        GOUT(1202, _g3_5(gx+20, gy+90, gz+470));
+        GOUT(1203, _g3_5(gx+15, gy+100, gz+465));
+        GOUT(1204, _g3_5(gx+15, gy+95, gz+470));
+        GOUT(1205, _g3_5(gx+15, gy+90, gz+475));
+        GOUT(1206, _g3_5(gx+10, gy+120, gz+450));
+        GOUT(1207, _g3_5(gx+5, gy+125, gz+450));
+        GOUT(1208, _g3_5(gx+5, gy+120, gz+455));
+        GOUT(1209, _g2_5(gy+130, gz+450));
+        GOUT(1210, _g2_5(gy+125, gz+455));
+        GOUT(1211, _g2_5(gy+120, gz+460));
+        GOUT(1212, _g3_5(gx+10, gy+105, gz+465));
+        GOUT(1213, _g3_5(gx+5, gy+110, gz+465));
+        GOUT(1214, _g3_5(gx+5, gy+105, gz+470));
+        GOUT(1215, _g2_5(gy+115, gz+465));
+        GOUT(1216, _g2_5(gy+110, gz+470));
+        GOUT(1217, _g2_5(gy+105, gz+475));
+        GOUT(1218, _g3_5(gx+10, gy+90, gz+480));
+        GOUT(1219, _g3_5(gx+5, gy+95, gz+480));
+        GOUT(1220, _g3_5(gx+5, gy+90, gz+485));
+        GOUT(1221, _g2_5(gy+100, gz+480));
+        GOUT(1222, _g2_5(gy+95, gz+485));
+        GOUT(1223, _g2_5(gy+90, gz+490));
+        GOUT(1224, _g3_5(gx+40, gy+45, gz+495));
+        GOUT(1225, _g3_5(gx+35, gy+50, gz+495));
+        GOUT(1226, _g3_5(gx+35, gy+45, gz+500));
+        GOUT(1227, _g3_5(gx+30, gy+55, gz+495));
+        GOUT(1228, _g3_5(gx+30, gy+50, gz+500));
+        GOUT(1229, _g3_5(gx+30, gy+45, gz+505));
+        GOUT(1230, _g3_5(gx+25, gy+60, gz+495));
+        GOUT(1231, _g3_5(gx+20, gy+65, gz+495));
+        GOUT(1232, _g3_5(gx+20, gy+60, gz+500));
+        GOUT(1233, _g3_5(gx+15, gy+70, gz+495));
+        GOUT(1234, _g3_5(gx+15, gy+65, gz+500));
+        GOUT(1235, _g3_5(gx+15, gy+60, gz+505));
+        GOUT(1236, _g3_5(gx+25, gy+45, gz+510));
+        GOUT(1237, _g3_5(gx+20, gy+50, gz+510));
+        GOUT(1238, _g3_5(gx+20, gy+45, gz+515));
+        GOUT(1239, _g3_5(gx+15, gy+55, gz+510));
+        GOUT(1240, _g3_5(gx+15, gy+50, gz+515));
+        GOUT(1241, _g3_5(gx+15, gy+45, gz+520));
+        GOUT(1242, _g3_5(gx+10, gy+75, gz+495));
+        GOUT(1243, _g3_5(gx+5, gy+80, gz+495));
+        GOUT(1244, _g3_5(gx+5, gy+75, gz+500));
+        GOUT(1245, _g2_5(gy+85, gz+495));
+        GOUT(1246, _g2_5(gy+80, gz+500));
+        GOUT(1247, _g2_5(gy+75, gz+505));
+        GOUT(1248, _g3_5(gx+10, gy+60, gz+510));
+        GOUT(1249, _g3_5(gx+5, gy+65, gz+510));
+        GOUT(1250, _g3_5(gx+5, gy+60, gz+515));
+        GOUT(1251, _g2_5(gy+70, gz+510));
+        GOUT(1252, _g2_5(gy+65, gz+515));
+        GOUT(1253, _g2_5(gy+60, gz+520));
+        GOUT(1254, _g3_5(gx+10, gy+45, gz+525));
+        GOUT(1255, _g3_5(gx+5, gy+50, gz+525));
+        GOUT(1256, _g3_5(gx+5, gy+45, gz+530));
+        GOUT(1257, _g2_5(gy+55, gz+525));
+        GOUT(1258, _g2_5(gy+50, gz+530));
+        GOUT(1259, _g2_5(gy+45, gz+535));
+        GOUT(1260, _g2_5(gx+40, gz+540));
+        GOUT(1261, _g3_5(gx+35, gy+5, gz+540));
+        GOUT(1262, _g2_5(gx+35, gz+545));
+        GOUT(1263, _g3_5(gx+30, gy+10, gz+540));
+        GOUT(1264, _g3_5(gx+30, gy+5, gz+545));
+        GOUT(1265, _g2_5(gx+30, gz+550));
+        GOUT(1266, _g3_5(gx+25, gy+15, gz+540));
+        GOUT(1267, _g3_5(gx+20, gy+20, gz+540));
+        GOUT(1268, _g3_5(gx+20, gy+15, gz+545));
+        GOUT(1269, _g3_5(gx+15, gy+25, gz+540));
+        GOUT(1270, _g3_5(gx+15, gy+20, gz+545));
+        GOUT(1271, _g3_5(gx+15, gy+15, gz+550));
+        GOUT(1272, _g2_5(gx+25, gz+555));
+        GOUT(1273, _g3_5(gx+20, gy+5, gz+555));
+        GOUT(1274, _g2_5(gx+20, gz+560));
+        GOUT(1275, _g3_5(gx+15, gy+10, gz+555));
+        GOUT(1276, _g3_5(gx+15, gy+5, gz+560));
+        GOUT(1277, _g2_5(gx+15, gz+565));
+        GOUT(1278, _g3_5(gx+10, gy+30, gz+540));
+        GOUT(1279, _g3_5(gx+5, gy+35, gz+540));
+        GOUT(1280, _g3_5(gx+5, gy+30, gz+545));
+        GOUT(1281, _g2_5(gy+40, gz+540));
+        GOUT(1282, _g2_5(gy+35, gz+545));
+        GOUT(1283, _g2_5(gy+30, gz+550));
+        GOUT(1284, _g3_5(gx+10, gy+15, gz+555));
+        GOUT(1285, _g3_5(gx+5, gy+20, gz+555));
+        GOUT(1286, _g3_5(gx+5, gy+15, gz+560));
+        GOUT(1287, _g2_5(gy+25, gz+555));
+        GOUT(1288, _g2_5(gy+20, gz+560));
+        GOUT(1289, _g2_5(gy+15, gz+565));
+        GOUT(1290, _g2_5(gx+10, gz+570));
+        GOUT(1291, _g3_5(gx+5, gy+5, gz+570));
+        GOUT(1292, _g2_5(gx+5, gz+575));
+        GOUT(1293, _g2_5(gy+10, gz+570));
+        GOUT(1294, _g2_5(gy+5, gz+575));
+        GOUT(1295, _g1_5(gz+580));
+}
+
+static void (*_f_g0_2d4d[])(double *, Rys2eT *, CINTEnvVars *) = {
+        &CINTg0_2e_2d4d_unrolled,
+        &CINTg0_2e_2d4d_unrolled,
+        &CINTg0_2e_2d4d_unrolled,
+        &CINTg0_2e_2d4d_unrolled,
+        &CINTg0_2e_2d4d_unrolled,
+        &CINTg0_2e_2d4d_unrolled,
+        &CINTg0_2e_2d4d_unrolled,
+        &CINTg0_2e_2d4d_unrolled,
+        &_g0_2d4d_0022,
+        &CINTg0_2e_2d4d_unrolled,
+        &CINTg0_2e_2d4d_unrolled,
+        &CINTg0_2e_2d4d_unrolled,
+        &CINTg0_2e_2d4d_unrolled,
+        &CINTg0_2e_2d4d_unrolled,
+        &_g0_2d4d_0112,
+        &CINTg0_2e_2d4d_unrolled,
+        &_g0_2d4d_0121,
+        &_g0_2d4d_0122,
+        &CINTg0_2e_2d4d_unrolled,
+        &CINTg0_2e_2d4d_unrolled,
+        &_g0_2d4d_0202,
+        &CINTg0_2e_2d4d_unrolled,
+        &_g0_2d4d_0211,
+        &_g0_2d4d_0212,
+        &_g0_2d4d_0220,
+        &_g0_2d4d_0221,
+        &_g0_2d4d_0222,
+        &CINTg0_2e_2d4d_unrolled,
+        &CINTg0_2e_2d4d_unrolled,
+        &CINTg0_2e_2d4d_unrolled,
+        &CINTg0_2e_2d4d_unrolled,
+        &CINTg0_2e_2d4d_unrolled,
+        &_g0_2d4d_1012,
+        &CINTg0_2e_2d4d_unrolled,
+        &_g0_2d4d_1021,
+        &_g0_2d4d_1022,
+        &CINTg0_2e_2d4d_unrolled,
+        &CINTg0_2e_2d4d_unrolled,
+        &_g0_2d4d_1102,
+        &CINTg0_2e_2d4d_unrolled,
+        &_g0_2d4d_1111,
+        &_g0_2d4d_1112,
+        &_g0_2d4d_1120,
+        &_g0_2d4d_1121,
+        &_g0_2d4d_1122,
+        &CINTg0_2e_2d4d_unrolled,
+        &_g0_2d4d_1201,
+        &_g0_2d4d_1202,
+        &_g0_2d4d_1210,
+        &_g0_2d4d_1211,
+        &_g0_2d4d_1212,
+        &_g0_2d4d_1220,
+        &_g0_2d4d_1221,
+        &_g0_2d4d_1222,
+        &CINTg0_2e_2d4d_unrolled,
+        &CINTg0_2e_2d4d_unrolled,
+        &_g0_2d4d_2002,
+        &CINTg0_2e_2d4d_unrolled,
+        &_g0_2d4d_2011,
+        &_g0_2d4d_2012,
+        &_g0_2d4d_2020,
+        &_g0_2d4d_2021,
+        &_g0_2d4d_2022,
+        &CINTg0_2e_2d4d_unrolled,
+        &_g0_2d4d_2101,
+        &_g0_2d4d_2102,
+        &_g0_2d4d_2110,
+        &_g0_2d4d_2111,
+        &_g0_2d4d_2112,
+        &_g0_2d4d_2120,
+        &_g0_2d4d_2121,
+        &_g0_2d4d_2122,
+        &_g0_2d4d_2200,
+        &_g0_2d4d_2201,
+        &_g0_2d4d_2202,
+        &_g0_2d4d_2210,
+        &_g0_2d4d_2211,
+        &_g0_2d4d_2212,
+        &_g0_2d4d_2220,
+        &_g0_2d4d_2221,
+        &_g0_2d4d_2222,
+};
+
+static void (*_f_gout[])(double *, double *, FINT *, CINTEnvVars *, FINT) = {
+        &_gout_0000,
+        &_gout_0001,
+        &_gout_0002,
+        &_gout_0010,
+        &_gout_0011,
+        &_gout_0012,
+        &_gout_0020,
+        &_gout_0021,
+        &_gout_0022,
+        &_gout_0100,
+        &_gout_0101,
+        &_gout_0102,
+        &_gout_0110,
+        &_gout_0111,
+        &_gout_0112,
+        &_gout_0120,
+        &_gout_0121,
+        &_gout_0122,
+        &_gout_0200,
+        &_gout_0201,
+        &_gout_0202,
+        &_gout_0210,
+        &_gout_0211,
+        &_gout_0212,
+        &_gout_0220,
+        &_gout_0221,
+        &_gout_0222,
+        &_gout_1000,
+        &_gout_1001,
+        &_gout_1002,
+        &_gout_1010,
+        &_gout_1011,
+        &_gout_1012,
+        &_gout_1020,
+        &_gout_1021,
+        &_gout_1022,
+        &_gout_1100,
+        &_gout_1101,
+        &_gout_1102,
+        &_gout_1110,
+        &_gout_1111,
+        &_gout_1112,
+        &_gout_1120,
+        &_gout_1121,
+        &_gout_1122,
+        &_gout_1200,
+        &_gout_1201,
+        &_gout_1202,
+        &_gout_1210,
+        &_gout_1211,
+        &_gout_1212,
+        &_gout_1220,
+        &_gout_1221,
+        &_gout_1222,
+        &_gout_2000,
+        &_gout_2001,
+        &_gout_2002,
+        &_gout_2010,
+        &_gout_2011,
+        &_gout_2012,
+        &_gout_2020,
+        &_gout_2021,
+        &_gout_2022,
+        &_gout_2100,
+        &_gout_2101,
+        &_gout_2102,
+        &_gout_2110,
+        &_gout_2111,
+        &_gout_2112,
+        &_gout_2120,
+        &_gout_2121,
+        &_gout_2122,
+        &_gout_2200,
+        &_gout_2201,
+        &_gout_2202,
+        &_gout_2210,
+        &_gout_2211,
+        &_gout_2212,
+        &_gout_2220,
+        &_gout_2221,
+        &_gout_2222,
+};
+
+/*
+ * Replace the generic f_g0_2d4d and f_gout of the plain (ij|kl) by the
+ * kernels of its angular momentum class. The caller ensures that f_gout
+ * is CINTgout2e. The kernels are unrolled for the number of roots of the
+ * Coulomb ERIs. The SR ERIs and the F12 integrals of odd li+lj+lk+ll
+ * take more roots and keep the generic functions.
+ */
+void CINTg2e_class_kernels(CINTEnvVars *envs)
+{
+        FINT li = envs->i_l;
+        FINT lj = envs->j_l;
+        FINT lk = envs->k_l;
+        FINT ll = envs->l_l;
+        if (li > G2E_KERNEL_LMAX || lj > G2E_KERNEL_LMAX ||
+            lk > G2E_KERNEL_LMAX || ll > G2E_KERNEL_LMAX ||
+            envs->li_ceil != li || envs->lj_ceil != lj ||
+            envs->lk_ceil != lk || envs->ll_ceil != ll ||
+            envs->nrys_roots != (li + lj + lk + ll) / 2 + 1) {
+                return;
+        }
+        FINT n = ((li * 3 + lj) * 3 + lk) * 3 + ll;
+        envs->f_g0_2d4d = _f_g0_2d4d[n];
+        envs->f_gout = _f_gout[n];
+}
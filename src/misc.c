@@ -4,9 +4,11 @@
  * basic functions
  */
 
+#include <stdlib.h>
 #include <math.h>
 #include <complex.h>
 #include "config.h"
+#include "misc.h"
 
 void CINTdcmplx_re(const FINT n, double complex *z, const double *re)
 {
@@ -69,6 +71,65 @@ double CINTsquare_dist(const double *r1, const double *r2)
         return r12[0] * r12[0] + r12[1] * r12[1] + r12[2] * r12[2];
 }
 
+/*
+ * Translations L = n0*a[0] + n1*a[1] + n2*a[2] of the lattice vectors a[3][3]
+ * (one vector per row) which satisfy |r0 + L| <= rmax. The translations are
+ * written in Ls[nimgs,3] and the number of them is returned. When Ls is NULL,
+ * an upper bound of the number of translations is returned for any r0.
+ */
+FINT CINTlattice_translations(double *Ls, double *a, double *r0, double rmax)
+{
+        double b[3][3];
+        double bnorm[3];
+        double vol = a[0] * (a[4]*a[8] - a[5]*a[7])
+                   + a[1] * (a[5]*a[6] - a[3]*a[8])
+                   + a[2] * (a[3]*a[7] - a[4]*a[6]);
+        FINT i, j;
+        // b[i] = a[j] x a[k] / vol, b[i].a[j] = delta_ij
+        for (i = 0; i < 3; i++) {
+                double *aj = a + ((i+1)%3) * 3;
+                double *ak = a + ((i+2)%3) * 3;
+                b[i][0] = (aj[1]*ak[2] - aj[2]*ak[1]) / vol;
+                b[i][1] = (aj[2]*ak[0] - aj[0]*ak[2]) / vol;
+                b[i][2] = (aj[0]*ak[1] - aj[1]*ak[0]) / vol;
+                bnorm[i] = sqrt(SQUARE(b[i]));
+        }
+        if (Ls == NULL) {
+                FINT count = 1;
+                for (i = 0; i < 3; i++) {
+                        count *= (FINT)(2 * rmax * bnorm[i]) + 2;
+                }
+                return count;
+        }
+
+        FINT n0, n1, n2;
+        FINT nmin[3], nmax[3];
+        for (i = 0; i < 3; i++) {
+                // n_i = b[i].L, L within the sphere of radius rmax around -r0
+                double c = -(b[i][0]*r0[0] + b[i][1]*r0[1] + b[i][2]*r0[2]);
+                nmin[i] = (FINT)ceil(c - rmax * bnorm[i]);
+                nmax[i] = (FINT)floor(c + rmax * bnorm[i]);
+        }
+        double rr_max = rmax * rmax;
+        double L[3];
+        FINT nimgs = 0;
+        for (n0 = nmin[0]; n0 <= nmax[0]; n0++) {
+        for (n1 = nmin[1]; n1 <= nmax[1]; n1++) {
+        for (n2 = nmin[2]; n2 <= nmax[2]; n2++) {
+                for (j = 0; j < 3; j++) {
+                        L[j] = n0 * a[j] + n1 * a[3+j] + n2 * a[6+j];
+                }
+                if ((r0[0]+L[0])*(r0[0]+L[0]) + (r0[1]+L[1])*(r0[1]+L[1])
+                    + (r0[2]+L[2])*(r0[2]+L[2]) <= rr_max) {
+                        Ls[nimgs*3+0] = L[0];
+                        Ls[nimgs*3+1] = L[1];
+                        Ls[nimgs*3+2] = L[2];
+                        nimgs++;
+                }
+        } } }
+        return nimgs;
+}
+
 static double _gaussian_int(FINT n, double alpha)
 {
         double n1 = (n + 1) * .5;
@@ -23,6 +23,8 @@ double CINTsquare_dist(const double *r1, const double *r2);
 
 double CINTgto_norm(FINT n, double a);
 
+FINT CINTlattice_translations(double *Ls, double *a, double *r0, double rmax);
+
 #define MALLOC_INSTACK(var, n) \
         var = (void *)(((uintptr_t)cache + 7) & (-(uintptr_t)8)); \
         cache = (double *)(var + (n));
@@ -75,9 +77,22 @@ FINT c##NAME(double *out, FINT *shls, FINT *atm, FINT natm, \
                              atm, natm, bas, nbas, env, NULL, NULL); \
 }
 
+// for the integrals which only have the spinor form
+#define ALL_CINT_SPINOR(NAME) \
+FINT c##NAME(double *out, FINT *shls, FINT *atm, FINT natm, \
+            FINT *bas, FINT nbas, double *env, CINTOpt *opt) { \
+        return NAME##_spinor((double complex *)out, NULL, shls, \
+                             atm, natm, bas, nbas, env, opt, NULL); \
+} \
+void c##NAME##_optimizer(CINTOpt **opt, FINT *atm, FINT natm, \
+                         FINT *bas, FINT nbas, double *env) { \
+        NAME##_optimizer(opt, atm, natm, bas, nbas, env); \
+}
+
 #else
 
 #define ALL_CINT(NAME)
 #define ALL_CINT1E(NAME)
+#define ALL_CINT_SPINOR(NAME)
 
 #endif  // WITH_CINT2_INTERFACE
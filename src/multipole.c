@@ -0,0 +1,688 @@
+/*
+ * Multipole expansion of the shell pair distributions.
+ *
+ * For two charge distributions rho_ij around P and rho_kl around Q which do
+ * not overlap,
+ *      (ij|kl) = sum_{a,b} M_ij[a] (-1)^|b| T[a+b](P-Q) M_kl[b] / (a! b!)
+ * The ERIs keep the terms |a|+|b| <= order of the expansion.
+ * M are the cartesian moments int rho (r-P)^a, T[a] = d^a/dR^a 1/|R|.
+ * The moments of the shell pairs are computed by the 1e overlap loop with
+ * the polynomials (r-Ri)^a, as int1e_r, int1e_rr, ... do, and translated
+ * to the pair centers.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include "cint_bas.h"
+#include "optimizer.h"
+#include "g1e.h"
+#include "g2e.h"
+#include "cint1e.h"
+#include "cint2e.h"
+#include "multipole.h"
+#include "misc.h"
+#include "fblas.h"
+
+#define TENSOR_CUBE     ((MULTIPOLE_MAX_ORDER*2+1) * (MULTIPOLE_MAX_ORDER*2+1) \
+                         * (MULTIPOLE_MAX_ORDER*2+1))
+
+/*
+ * Powers (mx,my,mz) of the cartesian moments of order 0, 1, ..., order.
+ * Each order follows the ordering of the cartesian GTOs.
+ */
+void CINTmultipole_index(FINT *mx, FINT *my, FINT *mz, FINT order)
+{
+        FINT l, n;
+        for (n = 0, l = 0; l <= order; l++) {
+                CINTcart_comp(mx+n, my+n, mz+n, l);
+                n += (l+1)*(l+2)/2;
+        }
+}
+
+/*
+ * tensor[t,u,v] = d^t/dx^t d^u/dy^u d^v/dz^v 1/|r| for t+u+v <= nmax,
+ * tensor has the shape [nmax+1,nmax+1,nmax+1]. The derivatives are generated
+ * by the McMurchie-Davidson recursion of the auxiliary integrals R_{tuv}^(n)
+ * of a point charge, R_{000}^(n) = (-1)^n (2n-1)!! / |r|^{2n+1}
+ */
+void CINTmultipole_coulomb_tensor(double *tensor, double *r, FINT nmax)
+{
+        const FINT d1 = nmax + 1;
+        const FINT d2 = d1 * d1;
+        double buf[TENSOR_CUBE];
+        double fn[MULTIPOLE_MAX_ORDER*2+1];
+        double rinv2 = 1. / SQUARE(r);
+        double *cur, *prev, val;
+        FINT n, t, u, v, off;
+
+        fn[0] = sqrt(rinv2);
+        for (n = 1; n <= nmax; n++) {
+                fn[n] = -(2*n-1) * rinv2 * fn[n-1];
+        }
+
+        // R^(n) is built from R^(n+1). The even n are stored in tensor so
+        // that R^(0) ends up in tensor
+        for (n = nmax; n >= 0; n--) {
+                if (n & 1) {
+                        cur = buf;
+                        prev = tensor;
+                } else {
+                        cur = tensor;
+                        prev = buf;
+                }
+                for (t = 0; t <= nmax-n; t++) {
+                for (u = 0; u <= nmax-n-t; u++) {
+                for (v = 0; v <= nmax-n-t-u; v++) {
+                        off = t * d2 + u * d1 + v;
+                        if (t > 0) {
+                                val = r[0] * prev[off-d2];
+                                if (t > 1) {
+                                        val += (t-1) * prev[off-d2*2];
+                                }
+                        } else if (u > 0) {
+                                val = r[1] * prev[off-d1];
+                                if (u > 1) {
+                                        val += (u-1) * prev[off-d1*2];
+                                }
+                        } else if (v > 0) {
+                                val = r[2] * prev[off-1];
+                                if (v > 1) {
+                                        val += (v-1) * prev[off-2];
+                                }
+                        } else {
+                                val = fn[n];
+                        }
+                        cur[off] = val;
+                } } }
+        }
+}
+
+/*
+ * Interaction matrix w[b,a] = (-1)^|b| T[a+b](r) / (a! b!) between the
+ * moments of two distributions separated by r = P - Q
+ */
+void CINTmultipole_interaction(double *w, double *r, FINT order)
+{
+        const FINT nmom = MULTIPOLE_NMOMENTS(order);
+        const FINT nmax = order * 2;
+        const FINT d1 = nmax + 1;
+        FINT mx[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER)];
+        FINT my[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER)];
+        FINT mz[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER)];
+        double fac[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER)];
+        double ifac[MULTIPOLE_MAX_ORDER+1];
+        double tensor[TENSOR_CUBE];
+        double facb;
+        FINT a, b, n;
+
+        CINTmultipole_index(mx, my, mz, order);
+        ifac[0] = 1;
+        for (n = 1; n <= order; n++) {
+                ifac[n] = ifac[n-1] / n;
+        }
+        for (a = 0; a < nmom; a++) {
+                fac[a] = ifac[mx[a]] * ifac[my[a]] * ifac[mz[a]];
+        }
+
+        CINTmultipole_coulomb_tensor(tensor, r, nmax);
+        for (b = 0; b < nmom; b++) {
+                facb = fac[b];
+                if ((mx[b] + my[b] + mz[b]) & 1) {
+                        facb = -facb;
+                }
+                for (a = 0; a < nmom; a++) {
+                        w[b*nmom+a] = facb * fac[a] *
+                                tensor[((mx[a]+mx[b])*d1 + my[a]+my[b])*d1 + mz[a]+mz[b]];
+                }
+        }
+}
+
+/*
+ * Local expansion local[b,k] = sum_a (-1)^|b| T[a+b](r) M[a,k] / (a! b!) of
+ * the moments M[nmoments,nao] of a distribution at r = P - Q, truncated at
+ * |a|+|b| <= order
+ */
+void CINTmultipole_local(double *local, double *moments, double *r,
+                         FINT order, size_t nao)
+{
+        const FINT nmom = MULTIPOLE_NMOMENTS(order);
+        const FINT d1 = order + 1;
+        FINT mx[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER)];
+        FINT my[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER)];
+        FINT mz[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER)];
+        double fac[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER)];
+        double ifac[MULTIPOLE_MAX_ORDER+1];
+        double tensor[TENSOR_CUBE];
+        double facb, t;
+        double *pl, *pm;
+        FINT a, b, n, na;
+        size_t k;
+
+        CINTmultipole_index(mx, my, mz, order);
+        ifac[0] = 1;
+        for (n = 1; n <= order; n++) {
+                ifac[n] = ifac[n-1] / n;
+        }
+        for (a = 0; a < nmom; a++) {
+                fac[a] = ifac[mx[a]] * ifac[my[a]] * ifac[mz[a]];
+        }
+
+        CINTmultipole_coulomb_tensor(tensor, r, order);
+        for (b = 0; b < nmom; b++) {
+                facb = fac[b];
+                n = mx[b] + my[b] + mz[b];
+                if (n & 1) {
+                        facb = -facb;
+                }
+                na = MULTIPOLE_NMOMENTS(order - n);
+                pl = local + b * nao;
+                for (k = 0; k < nao; k++) {
+                        pl[k] = 0;
+                }
+                for (a = 0; a < na; a++) {
+                        t = facb * fac[a] *
+                                tensor[((mx[a]+mx[b])*d1 + my[a]+my[b])*d1 + mz[a]+mz[b]];
+                        pm = moments + a * nao;
+                        for (k = 0; k < nao; k++) {
+                                pl[k] += t * pm[k];
+                        }
+                }
+        }
+}
+
+/*
+ * Whether the extents of the two distributions are separated and the
+ * expansion |a|+|b| <= order converges to precision. The truncation error
+ * is estimated by the leading dropped terms M_ij[a] T[a+b] M_kl[b] with
+ * |a|+|b| = order+1 .. order+MULTIPOLE_NORM_ORDERS, using
+ * |T[a+b]| <= |a+b|!/R^(|a+b|+1)
+ */
+FINT CINTmultipole_far(PairMultipole *mij, PairMultipole *mkl,
+                       FINT order, double precision)
+{
+        double rr = CINTsquare_dist(mij->center, mkl->center);
+        double ext = mij->extent + mkl->extent;
+        if (rr <= ext * ext) {
+                return 0;
+        }
+        const FINT nmax = order + MULTIPOLE_NORM_ORDERS;
+        double rinv = 1. / sqrt(rr);
+        double tmax[MULTIPOLE_MAX_ORDER+MULTIPOLE_NORM_ORDERS+1];
+        double err = 0;
+        FINT n, m;
+        tmax[0] = rinv;
+        for (n = 1; n <= nmax; n++) {
+                tmax[n] = tmax[n-1] * n * rinv;
+        }
+        for (n = 0; n <= nmax; n++) {
+                for (m = MAX(order + 1 - n, 0); m <= nmax - n; m++) {
+                        err += mij->norms[n] * mkl->norms[m] * tmax[n+m];
+                }
+        }
+        return err < precision;
+}
+
+/*
+ * The lowest expansion order <= max_order which converges to precision for
+ * the two distributions, -1 if the expansion does not apply
+ */
+FINT CINTmultipole_far_order(PairMultipole *mij, PairMultipole *mkl,
+                             FINT max_order, double precision)
+{
+        FINT order;
+        for (order = 0; order <= max_order; order++) {
+                if (CINTmultipole_far(mij, mkl, order, precision)) {
+                        return order;
+                }
+        }
+        return -1;
+}
+
+/*
+ * gout[nf,nmoments] of the moments (r-Ri)^a of the primitive pair
+ */
+static void _gout_moments(double *gout, double *g, FINT *idx,
+                          CINTEnvVars *envs, FINT empty)
+{
+        const FINT nf = envs->nf;
+        const FINT nmom = envs->ncomp_tensor;
+        const FINT order = envs->li_ceil - envs->i_l;
+        const FINT di = envs->g_stride_i;
+        FINT mx[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER+MULTIPOLE_NORM_ORDERS)];
+        FINT my[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER+MULTIPOLE_NORM_ORDERS)];
+        FINT mz[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER+MULTIPOLE_NORM_ORDERS)];
+        double *gx, *gy, *gz;
+        double s;
+        FINT n, m;
+
+        CINTmultipole_index(mx, my, mz, order);
+        for (n = 0; n < nf; n++, gout += nmom) {
+                gx = g + idx[n*3+0];
+                gy = g + idx[n*3+1];
+                gz = g + idx[n*3+2];
+                for (m = 0; m < nmom; m++) {
+                        s = gx[mx[m]*di] * gy[my[m]*di] * gz[mz[m]*di];
+                        if (empty) {
+                                gout[m] = s;
+                        } else {
+                                gout[m] += s;
+                        }
+                }
+        }
+}
+
+/*
+ * s[a,c] = binom(a,c) d^(a-c) for c <= a, the translation of the polynomials
+ * (r-O)^a = sum_c s[a,c] (r-O-d)^c
+ */
+static void _shift_matrix(double *s, double *d, FINT order)
+{
+        const FINT nmom = MULTIPOLE_NMOMENTS(order);
+        FINT mx[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER)];
+        FINT my[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER)];
+        FINT mz[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER)];
+        double binom[MULTIPOLE_MAX_ORDER+1][MULTIPOLE_MAX_ORDER+1];
+        double dpow[3][MULTIPOLE_MAX_ORDER+1];
+        FINT a, c, i, j;
+
+        CINTmultipole_index(mx, my, mz, order);
+        for (i = 0; i <= order; i++) {
+                binom[i][0] = 1;
+                binom[i][i] = 1;
+                for (j = 1; j < i; j++) {
+                        binom[i][j] = binom[i-1][j-1] + binom[i-1][j];
+                }
+        }
+        for (i = 0; i < 3; i++) {
+                dpow[i][0] = 1;
+                for (j = 1; j <= order; j++) {
+                        dpow[i][j] = dpow[i][j-1] * d[i];
+                }
+        }
+
+        for (a = 0; a < nmom; a++) {
+                for (c = 0; c < nmom; c++) {
+                        if (mx[c] > mx[a] || my[c] > my[a] || mz[c] > mz[a]) {
+                                s[a*nmom+c] = 0;
+                        } else {
+                                s[a*nmom+c] = binom[mx[a]][mx[c]] * dpow[0][mx[a]-mx[c]]
+                                            * binom[my[a]][my[c]] * dpow[1][my[a]-my[c]]
+                                            * binom[mz[a]][mz[c]] * dpow[2][mz[a]-mz[c]];
+                        }
+                }
+        }
+}
+
+/*
+ * Translate the moments of nao distributions from the origin O to O - d,
+ *      out[a] += sum_{c<=a} binom(a,c) d^(a-c) moments[c]
+ * order <= MULTIPOLE_MAX_ORDER + MULTIPOLE_NORM_ORDERS
+ */
+void CINTmultipole_shift(double *out, double *moments, double *d,
+                         FINT order, size_t nao)
+{
+        const FINT nmom = MULTIPOLE_NMOMENTS(order);
+        const FINT d1 = order + 1;
+        FINT mx[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER+MULTIPOLE_NORM_ORDERS)];
+        FINT my[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER+MULTIPOLE_NORM_ORDERS)];
+        FINT mz[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER+MULTIPOLE_NORM_ORDERS)];
+        FINT offset[LMAX1*LMAX1*LMAX1];
+        double binom[LMAX1][LMAX1];
+        double dpow[3][LMAX1];
+        double fac, *pout, *pin;
+        FINT a, t, u, v, i, j;
+        size_t n;
+
+        CINTmultipole_index(mx, my, mz, order);
+        for (a = 0; a < nmom; a++) {
+                offset[(mx[a]*d1+my[a])*d1+mz[a]] = a;
+        }
+        for (i = 0; i <= order; i++) {
+                binom[i][0] = 1;
+                binom[i][i] = 1;
+                for (j = 1; j < i; j++) {
+                        binom[i][j] = binom[i-1][j-1] + binom[i-1][j];
+                }
+        }
+        for (i = 0; i < 3; i++) {
+                dpow[i][0] = 1;
+                for (j = 1; j <= order; j++) {
+                        dpow[i][j] = dpow[i][j-1] * d[i];
+                }
+        }
+
+        for (a = 0; a < nmom; a++) {
+                pout = out + a * nao;
+                for (t = 0; t <= mx[a]; t++) {
+                for (u = 0; u <= my[a]; u++) {
+                for (v = 0; v <= mz[a]; v++) {
+                        fac = binom[mx[a]][t] * dpow[0][mx[a]-t]
+                            * binom[my[a]][u] * dpow[1][my[a]-u]
+                            * binom[mz[a]][v] * dpow[2][mz[a]-v];
+                        pin = moments + offset[(t*d1+u)*d1+v] * nao;
+                        for (n = 0; n < nao; n++) {
+                                pout[n] += fac * pin[n];
+                        }
+                } } }
+        }
+}
+
+/*
+ * Translate the coefficients of a local expansion from the origin O to
+ * O + d. The local expansion is contracted with the moments about its
+ * origin, sum_a moments[a] local[a]
+ *      out[c] += sum_{a>=c} binom(a,c) d^(a-c) local[a]
+ */
+void CINTmultipole_shift_local(double *out, double *local, double *d, FINT order)
+{
+        const FINT nmom = MULTIPOLE_NMOMENTS(order);
+        double s[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER)*MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER)];
+        FINT a, c;
+
+        _shift_matrix(s, d, order);
+        for (a = 0; a < nmom; a++) {
+                for (c = 0; c <= a; c++) {
+                        out[c] += s[a*nmom+c] * local[a];
+                }
+        }
+}
+
+/*
+ * The center, the extent and the moments of shell pair (i,j). NULL if the
+ * pair densities are negligible.
+ */
+static PairMultipole *_pair_multipole(FINT *shls, FINT order, double precision,
+                                      FINT *atm, FINT natm, FINT *bas, FINT nbas,
+                                      double *env)
+{
+        const FINT i_sh = shls[0];
+        const FINT j_sh = shls[1];
+        const FINT nmom = MULTIPOLE_NMOMENTS(order);
+        // the moments of the two orders above are evaluated for the norms
+        const FINT nmax = order + MULTIPOLE_NORM_ORDERS;
+        const FINT nmom_ext = MULTIPOLE_NMOMENTS(nmax);
+        FINT ng[] = {nmax, 0, 0, 0, 0, 1, 1, nmom_ext};
+        CINTEnvVars envs;
+        CINTinit_int1e_EnvVars(&envs, ng, shls, atm, natm, bas, nbas, env);
+        envs.f_gout = &_gout_moments;
+
+        FINT i_prim = bas(NPRIM_OF, i_sh);
+        FINT j_prim = bas(NPRIM_OF, j_sh);
+        FINT i_ctr = envs.x_ctr[0];
+        FINT j_ctr = envs.x_ctr[1];
+        double *ai = env + bas(PTR_EXP, i_sh);
+        double *aj = env + bas(PTR_EXP, j_sh);
+        double *ci = env + bas(PTR_COEFF, i_sh);
+        double *cj = env + bas(PTR_COEFF, j_sh);
+        double *ri = envs.ri;
+        double *rj = envs.rj;
+        double log_prec = -log(precision);
+        FINT lij = envs.i_l + envs.j_l;
+        FINT ip, jp, n;
+
+        double *log_maxci = malloc(sizeof(double) * (i_prim+j_prim));
+        double *log_maxcj = log_maxci + i_prim;
+        PairData *pdata = malloc(sizeof(PairData) * i_prim*j_prim);
+        CINTOpt_log_max_pgto_coeff(log_maxci, ci, i_prim, i_ctr);
+        CINTOpt_log_max_pgto_coeff(log_maxcj, cj, j_prim, j_ctr);
+        FINT empty = CINTset_pairdata(pdata, ai, aj, ri, rj, log_maxci, log_maxcj,
+                                      envs.i_l, envs.j_l, i_prim, j_prim,
+                                      CINTsquare_dist(ri, rj), log_prec, env);
+        if (empty) {
+                free(pdata);
+                free(log_maxci);
+                return NULL;
+        }
+
+        // the center is placed on the product of the most diffuse primitives
+        double ai_min = ai[0];
+        double aj_min = aj[0];
+        for (ip = 1; ip < i_prim; ip++) {
+                ai_min = MIN(ai_min, ai[ip]);
+        }
+        for (jp = 1; jp < j_prim; jp++) {
+                aj_min = MIN(aj_min, aj[jp]);
+        }
+        double center[3];
+        double wj = aj_min / (ai_min + aj_min);
+        center[0] = ri[0] + wj * (rj[0] - ri[0]);
+        center[1] = ri[1] + wj * (rj[1] - ri[1]);
+        center[2] = ri[2] + wj * (rj[2] - ri[2]);
+
+        // A primitive pair density decays as exp(-cceij - aij s^2) s^lij
+        // around its center rij
+        double extent = 0;
+        double aij, s, s2;
+        for (n = 0, jp = 0; jp < j_prim; jp++) {
+                for (ip = 0; ip < i_prim; ip++, n++) {
+                        if (pdata[n].cceij > log_prec) {
+                                continue;
+                        }
+                        aij = ai[ip] + aj[jp];
+                        s2 = (log_prec - pdata[n].cceij) / aij;
+                        s = sqrt(s2);
+                        if (lij > 0) {
+                                s = sqrt(s2 + lij * log(s + 1) / aij);
+                        }
+                        s += sqrt(CINTsquare_dist(pdata[n].rij, center));
+                        extent = MAX(extent, s);
+                }
+        }
+        free(pdata);
+        free(log_maxci);
+
+        size_t nao = envs.nf * i_ctr * j_ctr;
+        PairMultipole *pm = malloc(sizeof(PairMultipole) + sizeof(double) * nmom*nao);
+        pm->center[0] = center[0];
+        pm->center[1] = center[1];
+        pm->center[2] = center[2];
+        pm->extent = extent;
+        pm->moments = (double *)(pm + 1);
+
+        double *cache = malloc(sizeof(double) * (int1e_cache_size(&envs) +
+                                                 nmom_ext*nao*2));
+        double *moments = cache;
+        double *shifted = moments + nmom_ext*nao;
+        CINTdset0(nmom_ext*nao, shifted);
+        if (CINT1e_loop(moments, &envs, shifted + nmom_ext*nao, INT1E_TYPE_OVLP)) {
+                double d[3];
+                d[0] = ri[0] - center[0];
+                d[1] = ri[1] - center[1];
+                d[2] = ri[2] - center[2];
+                CINTmultipole_shift(shifted, moments, d, nmax, nao);
+        }
+        size_t k;
+        for (k = 0; k < nmom*nao; k++) {
+                pm->moments[k] = shifted[k];
+        }
+
+        FINT mx[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER+MULTIPOLE_NORM_ORDERS)];
+        FINT my[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER+MULTIPOLE_NORM_ORDERS)];
+        FINT mz[MULTIPOLE_NMOMENTS(MULTIPOLE_MAX_ORDER+MULTIPOLE_NORM_ORDERS)];
+        double ifac[MULTIPOLE_MAX_ORDER+MULTIPOLE_NORM_ORDERS+1];
+        double fac, norm;
+        FINT l, m, m0;
+        CINTmultipole_index(mx, my, mz, nmax);
+        ifac[0] = 1;
+        for (n = 1; n <= nmax; n++) {
+                ifac[n] = ifac[n-1] / n;
+        }
+        for (l = 0; l <= MULTIPOLE_MAX_ORDER+MULTIPOLE_NORM_ORDERS; l++) {
+                pm->norms[l] = 0;
+        }
+        for (m0 = 0, l = 0; l <= nmax; l++) {
+                for (k = 0; k < nao; k++) {
+                        norm = 0;
+                        for (m = m0; m < m0 + (l+1)*(l+2)/2; m++) {
+                                fac = ifac[mx[m]] * ifac[my[m]] * ifac[mz[m]];
+                                norm += fabs(shifted[m*nao+k]) * fac;
+                        }
+                        pm->norms[l] = MAX(pm->norms[l], norm);
+                }
+                m0 += (l+1)*(l+2)/2;
+        }
+        free(cache);
+        return pm;
+}
+
+void CINTOpt_set_multipole(CINTOpt *opt, FINT order, double precision,
+                           FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env)
+{
+        if (opt == NULL) {
+                return;
+        }
+        CINTdel_multipole_optimizer(opt);
+        if (order < 0) {
+                return;
+        }
+        // the moments are indexed by the shell pairs of the optimizer
+        if (nbas != opt->nbas) {
+                fprintf(stderr, "CINTOpt_set_multipole: nbas %d != %d of the optimizer\n",
+                        (int)nbas, (int)opt->nbas);
+                return;
+        }
+        if (order > MULTIPOLE_MAX_ORDER) {
+                fprintf(stderr, "CINTOpt_set_multipole: order %d > %d\n",
+                        (int)order, MULTIPOLE_MAX_ORDER);
+                order = MULTIPOLE_MAX_ORDER;
+        }
+
+        FINT shls[2];
+        FINT i, j;
+        opt->multipole_order = order;
+        opt->multipole_precision = precision;
+        opt->multipoles = malloc(sizeof(PairMultipole *) * nbas*nbas);
+        for (i = 0; i < nbas; i++) {
+                for (j = 0; j < nbas; j++) {
+                        shls[0] = i;
+                        shls[1] = j;
+                        opt->multipoles[i*nbas+j] = _pair_multipole(
+                                shls, order, precision, atm, natm, bas, nbas, env);
+                }
+        }
+}
+
+void CINTdel_multipole_optimizer(CINTOpt *opt)
+{
+        if (opt != NULL && opt->multipoles != NULL) {
+                size_t n, npair = opt->nbas * opt->nbas;
+                for (n = 0; n < npair; n++) {
+                        if (opt->multipoles[n] != NULL) {
+                                free(opt->multipoles[n]);
+                        }
+                }
+                free(opt->multipoles);
+                opt->multipoles = NULL;
+                opt->multipole_order = -1;
+        }
+}
+
+CACHE_SIZE_T CINTmultipole_2e_cache_size(CINTEnvVars *envs, CINTOpt *opt)
+{
+        if (opt == NULL || opt->multipoles == NULL) {
+                return 0;
+        }
+        FINT *x_ctr = envs->x_ctr;
+        size_t nmom = MULTIPOLE_NMOMENTS(opt->multipole_order);
+        size_t nij = envs->nfi * envs->nfj * x_ctr[0] * x_ctr[1];
+        size_t nkl = envs->nfk * envs->nfl * x_ctr[2] * x_ctr[3];
+        return nmom * MIN(nij, nkl) + nij * nkl;
+}
+
+/*
+ * Evaluate gctr of a plain Coulomb ERI by the multipole interaction of the
+ * shell pairs. Returns 0 if the quartet is not covered by the multipole
+ * expansion.
+ */
+FINT CINTmultipole_2e(double *gctr, CINTEnvVars *envs, CINTOpt *opt, double *cache)
+{
+        FINT *shls = envs->shls;
+        FINT nbas = opt->nbas;
+        if (envs->f_gout != &CINTgout2e || envs->gbits != 0 ||
+            envs->ncomp_e1 * envs->ncomp_e2 * envs->ncomp_tensor != 1 ||
+            envs->li_ceil != envs->i_l || envs->lj_ceil != envs->j_l ||
+            envs->lk_ceil != envs->k_l || envs->ll_ceil != envs->l_l ||
+            envs->env[PTR_RANGE_OMEGA] != 0 ||
+            shls[0] >= nbas || shls[1] >= nbas ||
+            shls[2] >= nbas || shls[3] >= nbas) {
+                return 0;
+        }
+        PairMultipole *mij = opt->multipoles[shls[0]*nbas+shls[1]];
+        PairMultipole *mkl = opt->multipoles[shls[2]*nbas+shls[3]];
+        if (mij == NULL || mkl == NULL) {
+                return 0;
+        }
+        // Each quartet takes the lowest order which meets the precision.
+        // The moments of the lower orders are the leading rows of the
+        // stored moments.
+        FINT order = CINTmultipole_far_order(mij, mkl, opt->multipole_order,
+                                             opt->multipole_precision);
+        if (order < 0) {
+                return 0;
+        }
+
+        FINT *x_ctr = envs->x_ctr;
+        FINT nmom = MULTIPOLE_NMOMENTS(order);
+        FINT nfi = envs->nfi;
+        FINT nfj = envs->nfj;
+        FINT nfk = envs->nfk;
+        FINT nfl = envs->nfl;
+        FINT nfij = nfi * nfj;
+        FINT nfkl = nfk * nfl;
+        FINT nijb = x_ctr[0] * x_ctr[1];
+        FINT nklb = x_ctr[2] * x_ctr[3];
+        FINT nij = nfij * nijb;
+        FINT nkl = nfkl * nklb;
+        // The Rys quadrature is cheaper for the quartets of few primitives
+        // and low angular momenta
+        FINT *bas = envs->bas;
+        size_t nprim = envs->nf;
+        nprim *= bas(NPRIM_OF, shls[0]) * bas(NPRIM_OF, shls[1])
+               * bas(NPRIM_OF, shls[2]) * bas(NPRIM_OF, shls[3]);
+        size_t nterms = (size_t)MULTIPOLE_NTERMS(order) * MIN(nij, nkl)
+                      + (size_t)nmom * nij * nkl;
+        if (nterms > MULTIPOLE_RYS_COST * nprim) {
+                return 0;
+        }
+        double r[3];
+        r[0] = mij->center[0] - mkl->center[0];
+        r[1] = mij->center[1] - mkl->center[1];
+        r[2] = mij->center[2] - mkl->center[2];
+
+        double *local, *prod;
+        MALLOC_INSTACK(local, nmom * MIN(nij, nkl));
+        MALLOC_INSTACK(prod, nij * nkl);
+        // prod[kl,ij] = sum_b M_kl[b,kl] local[b,ij], the local expansion
+        // is built on the pair with fewer components
+        if (nij <= nkl) {
+                CINTmultipole_local(local, mij->moments, r, order, nij);
+                CINTdgemm_NT(nij, nkl, nmom, local, mkl->moments, prod);
+        } else {
+                // T[a+b](-r) = (-1)^|a+b| T[a+b](r)
+                r[0] = -r[0];
+                r[1] = -r[1];
+                r[2] = -r[2];
+                CINTmultipole_local(local, mkl->moments, r, order, nkl);
+                CINTdgemm_NT(nij, nkl, nmom, mij->moments, local, prod);
+        }
+
+        // each contraction block of gctr is ordered as <ik|lj>
+        FINT ijb, klb, i, j, k, l;
+        double *pgctr = gctr;
+        double *pprod;
+        for (klb = 0; klb < nklb; klb++) {
+        for (ijb = 0; ijb < nijb; ijb++) {
+                for (j = 0; j < nfj; j++) {
+                for (l = 0; l < nfl; l++) {
+                for (k = 0; k < nfk; k++) {
+                        pprod = prod + (klb * nfkl + l * nfk + k) * nij
+                              + ijb * nfij + j * nfi;
+                        for (i = 0; i < nfi; i++) {
+                                pgctr[i] = pprod[i];
+                        }
+                        pgctr += nfi;
+                } } }
+        } }
+        return 1;
+}
@@ -0,0 +1,37 @@
+/*
+ * Multipole expansion of the shell pair distributions for far-field ERIs
+ */
+
+#include <stddef.h>
+#include "cint.h"
+
+#define MULTIPOLE_MAX_ORDER     6
+// orders above the expansion order used to estimate the truncation error
+#define MULTIPOLE_NORM_ORDERS   2
+// number of cartesian moments x^t y^u z^v with t+u+v <= order
+#define MULTIPOLE_NMOMENTS(order)       (((order)+1)*((order)+2)*((order)+3)/6)
+// number of the terms |a|+|b| <= order of the interaction of two moments
+#define MULTIPOLE_NTERMS(order)         (MULTIPOLE_NMOMENTS(order)*((order)+4)*((order)+5)*((order)+6)/120)
+// the multiply-adds of the multipole interaction per primitive quartet and
+// cartesian component of the Rys quadrature at which both cost the same
+#define MULTIPOLE_RYS_COST      4
+
+void CINTOpt_set_multipole(CINTOpt *opt, FINT order, double precision,
+                           FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env);
+void CINTdel_multipole_optimizer(CINTOpt *opt);
+
+void CINTmultipole_index(FINT *mx, FINT *my, FINT *mz, FINT order);
+void CINTmultipole_coulomb_tensor(double *tensor, double *r, FINT nmax);
+void CINTmultipole_interaction(double *w, double *r, FINT order);
+void CINTmultipole_local(double *local, double *moments, double *r,
+                         FINT order, size_t nao);
+void CINTmultipole_shift(double *out, double *moments, double *d,
+                         FINT order, size_t nao);
+void CINTmultipole_shift_local(double *out, double *local, double *d, FINT order);
+FINT CINTmultipole_far(PairMultipole *mij, PairMultipole *mkl,
+                       FINT order, double precision);
+FINT CINTmultipole_far_order(PairMultipole *mij, PairMultipole *mkl,
+                             FINT max_order, double precision);
+
+CACHE_SIZE_T CINTmultipole_2e_cache_size(CINTEnvVars *envs, CINTOpt *opt);
+FINT CINTmultipole_2e(double *gctr, CINTEnvVars *envs, CINTOpt *opt, double *cache);
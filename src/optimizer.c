@@ -16,7 +16,9 @@
 #include "g2e.h"
 #include "g3c1e.h"
 #include "optimizer.h"
+#include "rys_roots.h"
 #include "misc.h"
+#include "multipole.h"
 
 // generate caller to CINTinit_2e_optimizer for each type of function
 void CINTinit_2e_optimizer(CINTOpt **opt, FINT *atm, FINT natm,
@@ -29,6 +31,12 @@ void CINTinit_2e_optimizer(CINTOpt **opt, FINT *atm, FINT natm,
         opt0->nbas = nbas;
         opt0->log_max_coeff = NULL;
         opt0->pairdata = NULL;
+        opt0->pair_bounds = NULL;
+        opt0->lazy_pairdata_inc = -1;
+        opt0->mixed_precision = 0;
+        opt0->multipoles = NULL;
+        opt0->multipole_order = -1;
+        opt0->multipole_precision = 0;
         *opt = opt0;
 }
 void CINTinit_optimizer(CINTOpt **opt, FINT *atm, FINT natm,
@@ -45,7 +53,7 @@ void CINTdel_2e_optimizer(CINTOpt **opt)
         }
 
         if (opt0->index_xyz_array != NULL) {
-                free(opt0->index_xyz_array[0]);
+                // the tables are owned by the cache of gen_idx
                 free(opt0->index_xyz_array);
         }
 
@@ -62,6 +70,7 @@ void CINTdel_2e_optimizer(CINTOpt **opt)
         }
 
         CINTdel_pairdata_optimizer(opt0);
+        CINTdel_multipole_optimizer(opt0);
 
         free(opt0);
         *opt = NULL;
@@ -71,6 +80,23 @@ void CINTdel_optimizer(CINTOpt **opt)
         CINTdel_2e_optimizer(opt);
 }
 
+/*
+ * on != 0: int2e, int3c2e and int2c2e without operators compute the 2D, 4D
+ * integrals and gout in single precision. See g2e_f32.c
+ */
+void CINTOpt_set_mixed_precision(CINTOpt *opt, FINT on)
+{
+        if (opt != NULL) {
+                opt->mixed_precision = on;
+        }
+}
+
+static FINT _lazy_pairdata = 0;
+void CINTset_lazy_pairdata(FINT lazy)
+{
+        __atomic_store_n(&_lazy_pairdata, lazy, __ATOMIC_RELAXED);
+}
+
 void CINTno_optimizer(CINTOpt **opt, FINT *atm, FINT natm,
                       FINT *bas, FINT nbas, double *env)
 {
@@ -96,25 +122,68 @@ static FINT _make_fakebas(FINT *fakebas, FINT *bas, FINT nbas, double *env)
         }
         return max_l;
 }
-static FINT *_allocate_index_xyz(CINTOpt *opt, FINT max_l, FINT l_allow, FINT order)
+/*
+ * The index_xyz tables only depend on the angular momenta and the layout
+ * of the g array. They are shared by all optimizers through a process-wide
+ * cache, populated on demand and never released. New entries are pushed to
+ * the bucket lists with compare-and-swap, so that the cache can be used by
+ * multiple threads without locks. Two threads may add the same table
+ * concurrently; the duplicate is harmless.
+ */
+#define INDEX_XYZ_KEY_SIZE      10
+#define INDEX_XYZ_BUCKETS       1024
+typedef struct _IndexXYZ {
+        struct _IndexXYZ *next;
+        void (*findex_xyz)();
+        FINT key[INDEX_XYZ_KEY_SIZE];
+        FINT idx[];
+} IndexXYZ;
+static IndexXYZ *_index_xyz_cache[INDEX_XYZ_BUCKETS];
+
+static IndexXYZ *_index_xyz_find(IndexXYZ *p, void (*findex_xyz)(), FINT *key)
+{
+        for (; p != NULL; p = p->next) {
+                if (p->findex_xyz == findex_xyz &&
+                    memcmp(p->key, key, sizeof(FINT) * INDEX_XYZ_KEY_SIZE) == 0) {
+                        return p;
+                }
+        }
+        return NULL;
+}
+
+static FINT *_index_xyz_lookup(void (*findex_xyz)(), FINT order, CINTEnvVars *envs)
 {
+        FINT key[INDEX_XYZ_KEY_SIZE] = {
+                order, envs->i_l, envs->j_l,
+                order > 2 ? envs->k_l : 0,
+                order > 3 ? envs->l_l : 0,
+                envs->g_stride_i, envs->g_stride_j,
+                order > 2 ? envs->g_stride_k : 0,
+                order > 3 ? envs->g_stride_l : 0,
+                envs->g_size};
+        size_t hash = (size_t)findex_xyz;
         FINT i;
-        FINT cumcart = (l_allow+1) * (l_allow+2) * (l_allow+3) / 6;
-        size_t ll = max_l + 1;
-        size_t cc = cumcart;
-        for (i = 1; i < order; i++) {
-                ll *= LMAX1;
-                cc *= cumcart;
+        for (i = 0; i < INDEX_XYZ_KEY_SIZE; i++) {
+                hash = hash * 31 + key[i];
         }
-        FINT *buf = malloc(sizeof(FINT) * cc * 3);
-        FINT **ppbuf = malloc(sizeof(FINT*) * ll);
-        ppbuf[0] = buf;
-        for (i = 1; i < ll; i++) {
-                ppbuf[i] = NULL;
+        IndexXYZ **bucket = _index_xyz_cache + hash % INDEX_XYZ_BUCKETS;
+        IndexXYZ *head = __atomic_load_n(bucket, __ATOMIC_ACQUIRE);
+        IndexXYZ *p = _index_xyz_find(head, findex_xyz, key);
+        if (p != NULL) {
+                return p->idx;
         }
-        opt->index_xyz_array = ppbuf;
-        return buf;
+
+        p = malloc(sizeof(IndexXYZ) + sizeof(FINT) * envs->nf * 3);
+        p->findex_xyz = findex_xyz;
+        memcpy(p->key, key, sizeof(FINT) * INDEX_XYZ_KEY_SIZE);
+        (*findex_xyz)(p->idx, envs);
+        do {
+                p->next = head;
+        } while (!__atomic_compare_exchange_n(bucket, &head, p, 0,
+                                              __ATOMIC_RELEASE, __ATOMIC_ACQUIRE));
+        return p->idx;
 }
+
 static void gen_idx(CINTOpt *opt, void (*finit)(), void (*findex_xyz)(),
                     FINT order, FINT l_allow, FINT *ng,
                     FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env)
@@ -123,11 +192,16 @@ static void gen_idx(CINTOpt *opt, void (*finit)(), void (*findex_xyz)(),
         FINT fakebas[BAS_SLOTS*LMAX1];
         FINT max_l = _make_fakebas(fakebas, bas, nbas, env);
         FINT fakenbas = max_l+1;
-        // index_xyz bufsize may blow up for large max_l
         l_allow = MIN(max_l, l_allow);
-        FINT *buf = _allocate_index_xyz(opt, max_l, l_allow, order);
+        size_t nptr = max_l + 1;
+        for (i = 1; i < order; i++) {
+                nptr *= LMAX1;
+        }
+        opt->index_xyz_array = calloc(nptr, sizeof(FINT *));
 
         CINTEnvVars envs;
+        // fields not set by finit must not leak into the cache key
+        memset(&envs, 0, sizeof(CINTEnvVars));
         FINT shls[4] = {0,};
         if (order == 2) {
                 for (i = 0; i <= l_allow; i++) {
@@ -135,9 +209,7 @@ static void gen_idx(CINTOpt *opt, void (*finit)(), void (*findex_xyz)(),
                         shls[0] = i; shls[1] = j;
                         (*finit)(&envs, ng, shls, atm, natm, fakebas, fakenbas, env);
                         ptr = i*LMAX1 + j;
-                        opt->index_xyz_array[ptr] = buf;
-                        (*findex_xyz)(buf, &envs);
-                        buf += envs.nf * 3;
+                        opt->index_xyz_array[ptr] = _index_xyz_lookup(findex_xyz, order, &envs);
                 } }
 
         } else if (order == 3) {
@@ -147,9 +219,7 @@ static void gen_idx(CINTOpt *opt, void (*finit)(), void (*findex_xyz)(),
                         shls[0] = i; shls[1] = j; shls[2] = k;
                         (*finit)(&envs, ng, shls, atm, natm, fakebas, fakenbas, env);
                         ptr = i*LMAX1*LMAX1 + j*LMAX1 + k;
-                        opt->index_xyz_array[ptr] = buf;
-                        (*findex_xyz)(buf, &envs);
-                        buf += envs.nf * 3;
+                        opt->index_xyz_array[ptr] = _index_xyz_lookup(findex_xyz, order, &envs);
                 } } }
 
         } else {
@@ -163,9 +233,7 @@ static void gen_idx(CINTOpt *opt, void (*finit)(), void (*findex_xyz)(),
                             + j*LMAX1*LMAX1
                             + k*LMAX1
                             + l;
-                        opt->index_xyz_array[ptr] = buf;
-                        (*findex_xyz)(buf, &envs);
-                        buf += envs.nf * 3;
+                        opt->index_xyz_array[ptr] = _index_xyz_lookup(findex_xyz, order, &envs);
                 } } } }
         }
 }
@@ -243,6 +311,21 @@ void CINTall_2e_stg_optimizer(CINTOpt **opt, FINT *ng,
         gen_idx(*opt, &CINTinit_int2e_stg_EnvVars, &CINTg2e_index_xyz,
                 4, 6, ng, atm, natm, bas, nbas, env);
 }
+
+void CINTinit_int2e_stg_geminals_EnvVars(CINTEnvVars *envs, FINT *ng, FINT *shls,
+                           FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env);
+// index_xyz depends on the number of geminals in env[NF12_GEMINALS]. The
+// optimizer must be rebuilt when the geminals are changed.
+void CINTall_2e_stg_geminals_optimizer(CINTOpt **opt, FINT *ng,
+                                       FINT *atm, FINT natm, FINT *bas, FINT nbas,
+                                       double *env)
+{
+        CINTinit_2e_optimizer(opt, atm, natm, bas, nbas, env);
+        CINTOpt_setij(*opt, ng, atm, natm, bas, nbas, env);
+        CINTOpt_set_non0coeff(*opt, atm, natm, bas, nbas, env);
+        gen_idx(*opt, &CINTinit_int2e_stg_geminals_EnvVars, &CINTg2e_index_xyz,
+                4, 6, ng, atm, natm, bas, nbas, env);
+}
 #endif
 
 void CINTOpt_log_max_pgto_coeff(double *log_maxc, double *coeff, FINT nprim, FINT nctr)
@@ -360,24 +443,37 @@ void CINTOpt_setij(CINTOpt *opt, FINT *ng,
         double **log_max_coeff = opt->log_max_coeff;
         double *log_maxci, *log_maxcj;
 
+        FINT ijkl_inc;
+        if ((ng[IINC]+ng[JINC]) > (ng[KINC]+ng[LINC])) {
+                ijkl_inc = ng[IINC] + ng[JINC];
+        } else {
+                ijkl_inc = ng[KINC] + ng[LINC];
+        }
+
         size_t tot_prim = 0;
         for (i = 0; i < nbas; i++) {
                 tot_prim += bas(NPRIM_OF, i);
         }
-        if (tot_prim == 0 || tot_prim > MAX_PGTO_FOR_PAIRDATA) {
+        if (tot_prim == 0) {
+                return;
+        }
+        if (__atomic_load_n(&_lazy_pairdata, __ATOMIC_RELAXED)) {
+                // only the touched pairs take memory, MAX_PGTO_FOR_PAIRDATA
+                // does not apply
+                opt->pairdata = calloc(MAX(nbas * nbas, 1), sizeof(PairData *));
+                opt->lazy_pairdata_inc = ijkl_inc;
+                return;
+        }
+        if (env[PTR_RANGE_OMEGA] < 0) {
+                CINTOpt_set_pair_bounds(opt, ijkl_inc, atm, natm, bas, nbas, env);
+        }
+        if (tot_prim > MAX_PGTO_FOR_PAIRDATA) {
                 return;
         }
         opt->pairdata = malloc(sizeof(PairData *) * MAX(nbas * nbas, 1));
         PairData *pdata = malloc(sizeof(PairData) * tot_prim * tot_prim);
         opt->pairdata[0] = pdata;
 
-        FINT ijkl_inc;
-        if ((ng[IINC]+ng[JINC]) > (ng[KINC]+ng[LINC])) {
-                ijkl_inc = ng[IINC] + ng[JINC];
-        } else {
-                ijkl_inc = ng[KINC] + ng[LINC];
-        }
-
         FINT empty;
         double rr;
         PairData *pdata0;
@@ -427,10 +523,265 @@ void CINTOpt_setij(CINTOpt *opt, FINT *ng,
 void CINTdel_pairdata_optimizer(CINTOpt *cintopt)
 {
         if (cintopt != NULL && cintopt->pairdata != NULL) {
-                free(cintopt->pairdata[0]);
+                if (cintopt->lazy_pairdata_inc >= 0) {
+                        size_t n, npair = cintopt->nbas * cintopt->nbas;
+                        PairData *pdata;
+                        for (n = 0; n < npair; n++) {
+                                pdata = cintopt->pairdata[n];
+                                if (pdata != NULL && pdata != NOVALUE) {
+                                        // the bounds are stored in front of pdata
+                                        free((double *)pdata - PAIR_BOUND_SIZE);
+                                }
+                        }
+                } else {
+                        free(cintopt->pairdata[0]);
+                }
                 free(cintopt->pairdata);
                 cintopt->pairdata = NULL;
         }
+        if (cintopt != NULL && cintopt->pair_bounds != NULL) {
+                free(cintopt->pair_bounds);
+                cintopt->pair_bounds = NULL;
+        }
+}
+
+static void _set_pair_bound(double *pb, PairData *pdata, double *ai, double *aj,
+                            FINT iprim, FINT jprim)
+{
+        FINT ip, jp, n;
+        double *rij;
+        double xmin, ymin, zmin, xmax, ymax, zmax, cx, cy, cz, dx, dy, dz;
+        double aij_min, cceij_min, r2, r2max;
+        // rij = 1e18 for NOVALUE pairs, any test on them fails
+        pb[PAIR_BOUND_CENTER+0] = 1e18;
+        pb[PAIR_BOUND_CENTER+1] = 1e18;
+        pb[PAIR_BOUND_CENTER+2] = 1e18;
+        pb[PAIR_BOUND_RADIUS] = 0;
+        pb[PAIR_BOUND_AIJ] = 0;
+        pb[PAIR_BOUND_CCEIJ] = 0;
+        if (pdata == NOVALUE) {
+                return;
+        }
+
+        xmin = ymin = zmin = 1e18;
+        xmax = ymax = zmax = -1e18;
+        aij_min = 1e18;
+        cceij_min = 1e18;
+        for (n = 0, jp = 0; jp < jprim; jp++) {
+        for (ip = 0; ip < iprim; ip++, n++) {
+                if (pdata[n].eij == 0) { // screened in CINTset_pairdata
+                        continue;
+                }
+                rij = pdata[n].rij;
+                xmin = MIN(xmin, rij[0]);
+                ymin = MIN(ymin, rij[1]);
+                zmin = MIN(zmin, rij[2]);
+                xmax = MAX(xmax, rij[0]);
+                ymax = MAX(ymax, rij[1]);
+                zmax = MAX(zmax, rij[2]);
+                aij_min = MIN(aij_min, ai[ip] + aj[jp]);
+                cceij_min = MIN(cceij_min, pdata[n].cceij);
+        } }
+        if (aij_min == 1e18) {
+                return;
+        }
+
+        cx = (xmin + xmax) * .5;
+        cy = (ymin + ymax) * .5;
+        cz = (zmin + zmax) * .5;
+        r2max = 0;
+        for (n = 0, jp = 0; jp < jprim; jp++) {
+        for (ip = 0; ip < iprim; ip++, n++) {
+                if (pdata[n].eij == 0) { // screened in CINTset_pairdata
+                        continue;
+                }
+                rij = pdata[n].rij;
+                dx = rij[0] - cx;
+                dy = rij[1] - cy;
+                dz = rij[2] - cz;
+                r2 = dx * dx + dy * dy + dz * dz;
+                r2max = MAX(r2max, r2);
+        } }
+        pb[PAIR_BOUND_CENTER+0] = cx;
+        pb[PAIR_BOUND_CENTER+1] = cy;
+        pb[PAIR_BOUND_CENTER+2] = cz;
+        pb[PAIR_BOUND_RADIUS] = sqrt(r2max);
+        pb[PAIR_BOUND_AIJ] = aij_min;
+        pb[PAIR_BOUND_CCEIJ] = cceij_min;
+}
+
+/*
+ * For each shell pair, the region where the Gaussian product centers rij of
+ * the unscreened primitive pairs are located, and the most diffuse aij.
+ * The bounds do not depend on omega. They are used by CINTOpt_sr_screened to
+ * skip the short-range ERIs of well separated shell pairs. The primitive
+ * pairs are generated here with the same cutoff as CINTOpt_setij, so the
+ * bounds are available when the pairdata are not (tot_prim is larger than
+ * MAX_PGTO_FOR_PAIRDATA).
+ */
+void CINTOpt_set_pair_bounds(CINTOpt *opt, FINT ijkl_inc, FINT *atm, FINT natm,
+                             FINT *bas, FINT nbas, double *env)
+{
+        double expcutoff;
+        if (env[PTR_EXPCUTOFF] == 0) {
+                expcutoff = EXPCUTOFF;
+        } else {
+                expcutoff = MAX(MIN_EXPCUTOFF, env[PTR_EXPCUTOFF]);
+        }
+        if (opt->log_max_coeff == NULL) {
+                CINTOpt_set_log_maxc(opt, atm, natm, bas, nbas, env);
+        }
+        FINT i, j, iprim, jprim;
+        FINT max_prim = 0;
+        for (i = 0; i < nbas; i++) {
+                max_prim = MAX(max_prim, bas(NPRIM_OF,i));
+        }
+        double *bounds = malloc(sizeof(double) * PAIR_BOUND_SIZE * MAX(nbas * nbas, 1));
+        PairData *pdata = malloc(sizeof(PairData) * MAX(max_prim * max_prim, 1));
+        opt->pair_bounds = bounds;
+
+        double *ri, *rj, *ai, *aj, *pbij;
+        double rr;
+        for (i = 0; i < nbas; i++) {
+                ri = env + atm(PTR_COORD,bas(ATOM_OF,i));
+                ai = env + bas(PTR_EXP,i);
+                iprim = bas(NPRIM_OF,i);
+                for (j = 0; j <= i; j++) {
+                        rj = env + atm(PTR_COORD,bas(ATOM_OF,j));
+                        aj = env + bas(PTR_EXP,j);
+                        jprim = bas(NPRIM_OF,j);
+                        rr = (ri[0]-rj[0])*(ri[0]-rj[0])
+                           + (ri[1]-rj[1])*(ri[1]-rj[1])
+                           + (ri[2]-rj[2])*(ri[2]-rj[2]);
+                        CINTset_pairdata(pdata, ai, aj, ri, rj,
+                                         opt->log_max_coeff[i], opt->log_max_coeff[j],
+                                         bas(ANG_OF,i)+ijkl_inc, bas(ANG_OF,j),
+                                         iprim, jprim, rr, expcutoff, env);
+                        pbij = bounds + (i * nbas + j) * PAIR_BOUND_SIZE;
+                        _set_pair_bound(pbij, pdata, ai, aj, iprim, jprim);
+                        // the bounds are symmetric in i and j
+                        memcpy(bounds + (j * nbas + i) * PAIR_BOUND_SIZE, pbij,
+                               sizeof(double) * PAIR_BOUND_SIZE);
+                }
+        }
+        free(pdata);
+}
+
+/*
+ * Computes and publishes the pairdata of the shell pair (i,j) for the
+ * optimizers created by CINTset_lazy_pairdata. The results are identical to
+ * those of CINTOpt_setij. The bounds of CINTOpt_sr_screened are stored in
+ * front of the pairdata. If two threads build the same pair concurrently,
+ * the one losing the compare-and-swap discards its copy.
+ */
+PairData *CINTOpt_build_pairdata(CINTOpt *opt, FINT i, FINT j,
+                                 FINT *atm, FINT *bas, double *env)
+{
+        double expcutoff;
+        if (env[PTR_EXPCUTOFF] == 0) {
+                expcutoff = EXPCUTOFF;
+        } else {
+                expcutoff = MAX(MIN_EXPCUTOFF, env[PTR_EXPCUTOFF]);
+        }
+        // CINTOpt_setij computes the pairs with i >= j and transposes them
+        FINT transpose = i < j;
+        FINT ish = MAX(i, j);
+        FINT jsh = MIN(i, j);
+        double *ri = env + atm(PTR_COORD,bas(ATOM_OF,ish));
+        double *rj = env + atm(PTR_COORD,bas(ATOM_OF,jsh));
+        double *ai = env + bas(PTR_EXP,ish);
+        double *aj = env + bas(PTR_EXP,jsh);
+        FINT iprim = bas(NPRIM_OF,ish);
+        FINT jprim = bas(NPRIM_OF,jsh);
+        FINT li = bas(ANG_OF,ish);
+        FINT lj = bas(ANG_OF,jsh);
+        double rr = (ri[0]-rj[0])*(ri[0]-rj[0])
+                  + (ri[1]-rj[1])*(ri[1]-rj[1])
+                  + (ri[2]-rj[2])*(ri[2]-rj[2]);
+        size_t nprim = iprim * jprim;
+        double *buf = malloc(sizeof(double) * PAIR_BOUND_SIZE + sizeof(PairData) * nprim);
+        PairData *pdata = (PairData *)(buf + PAIR_BOUND_SIZE);
+        PairData *pdata0 = pdata;
+        if (transpose) {
+                pdata0 = malloc(sizeof(PairData) * nprim);
+        }
+        FINT empty = CINTset_pairdata(pdata0, ai, aj, ri, rj,
+                                      opt->log_max_coeff[ish], opt->log_max_coeff[jsh],
+                                      li+opt->lazy_pairdata_inc, lj,
+                                      iprim, jprim, rr, expcutoff, env);
+        if (empty) {
+                free(buf);
+                pdata = NOVALUE;
+        } else {
+                if (transpose) {
+                        FINT ip, jp, n;
+                        for (n = 0, ip = 0; ip < iprim; ip++) {
+                        for (jp = 0; jp < jprim; jp++, n++) {
+                                pdata[n] = pdata0[jp*iprim+ip];
+                        } }
+                        _set_pair_bound(buf, pdata, aj, ai, jprim, iprim);
+                } else {
+                        _set_pair_bound(buf, pdata, ai, aj, iprim, jprim);
+                }
+        }
+        if (transpose) {
+                free(pdata0);
+        }
+
+        PairData *expected = NULL;
+        if (!__atomic_compare_exchange_n(opt->pairdata + i * opt->nbas + j,
+                                         &expected, pdata, 0,
+                                         __ATOMIC_RELEASE, __ATOMIC_ACQUIRE)) {
+                if (pdata != NOVALUE) {
+                        free(buf);
+                }
+                pdata = expected;
+        }
+        return pdata;
+}
+
+/*
+ * Whether all primitive quartets of the SR-ERI (ij|kl) are screened in
+ * CINTg0_2e. The exponent theta*a0*|rij-rkl|^2 of each primitive quartet is
+ * bounded from below using the smallest aij, akl (theta*a0 increases with
+ * aij and akl) and the distance between the bounding spheres of rij and rkl.
+ */
+FINT CINTOpt_sr_screened(CINTOpt *opt, FINT *shls, double omega, double expcutoff)
+{
+        FINT nbas = opt->nbas;
+        double *pbij, *pbkl;
+        if (opt->pair_bounds != NULL) {
+                pbij = opt->pair_bounds + (shls[0] * nbas + shls[1]) * PAIR_BOUND_SIZE;
+                pbkl = opt->pair_bounds + (shls[2] * nbas + shls[3]) * PAIR_BOUND_SIZE;
+        } else if (opt->lazy_pairdata_inc >= 0) {
+                // the pairs were built by the caller, see CINTOpt_pairdata
+                PairData *pdata_ij = opt->pairdata[shls[0] * nbas + shls[1]];
+                PairData *pdata_kl = opt->pairdata[shls[2] * nbas + shls[3]];
+                if (pdata_ij == NULL || pdata_ij == NOVALUE ||
+                    pdata_kl == NULL || pdata_kl == NOVALUE) {
+                        return 0;
+                }
+                pbij = (double *)pdata_ij - PAIR_BOUND_SIZE;
+                pbkl = (double *)pdata_kl - PAIR_BOUND_SIZE;
+        } else {
+                return 0;
+        }
+        double dx = pbij[PAIR_BOUND_CENTER+0] - pbkl[PAIR_BOUND_CENTER+0];
+        double dy = pbij[PAIR_BOUND_CENTER+1] - pbkl[PAIR_BOUND_CENTER+1];
+        double dz = pbij[PAIR_BOUND_CENTER+2] - pbkl[PAIR_BOUND_CENTER+2];
+        double dist = sqrt(dx * dx + dy * dy + dz * dz)
+                - pbij[PAIR_BOUND_RADIUS] - pbkl[PAIR_BOUND_RADIUS];
+        if (dist <= 0) {
+                return 0;
+        }
+        double aij = pbij[PAIR_BOUND_AIJ];
+        double akl = pbkl[PAIR_BOUND_AIJ];
+        double a0 = aij * akl / (aij + akl);
+        double omega2 = omega * omega;
+        double theta = omega2 / (omega2 + a0);
+        double cutoff = expcutoff - pbij[PAIR_BOUND_CCEIJ] - pbkl[PAIR_BOUND_CCEIJ];
+        cutoff = MIN(cutoff, EXPCUTOFF_SR);
+        return theta * a0 * dist * dist > cutoff;
 }
 
 void CINTOpt_non0coeff_byshell(FINT *sortedidx, FINT *non0ctr, double *ci,
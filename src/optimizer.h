@@ -7,18 +7,31 @@
 #define NOVALUE                 ((void *)0xffffffffffffffffuL)
 #define MAX_PGTO_FOR_PAIRDATA   2048
 
+// Layout of opt->pair_bounds for each shell pair:
+// bounding sphere (center, radius) of the primitive pair centers rij,
+// the smallest aij and the smallest cceij of the unscreened primitive pairs
+#define PAIR_BOUND_CENTER       0
+#define PAIR_BOUND_RADIUS       3
+#define PAIR_BOUND_AIJ          4
+#define PAIR_BOUND_CCEIJ        5
+#define PAIR_BOUND_SIZE         6
+
 void CINTinit_2e_optimizer(CINTOpt **opt, FINT *atm, FINT natm,
                            FINT *bas, FINT nbas, double *env);
 void CINTinit_optimizer(CINTOpt **opt, FINT *atm, FINT natm,
                         FINT *bas, FINT nbas, double *env);
 void CINTdel_2e_optimizer(CINTOpt **opt);
 void CINTdel_optimizer(CINTOpt **opt);
+void CINTOpt_set_mixed_precision(CINTOpt *opt, FINT on);
 void CINTdel_pairdata_optimizer(CINTOpt *cintopt);
 void CINTOpt_log_max_pgto_coeff(double *log_maxc, double *coeff, FINT nprim, FINT nctr);
 void CINTOpt_set_log_maxc(CINTOpt *opt, FINT *atm, FINT natm,
                           FINT *bas, FINT nbas, double *env);
 void CINTOpt_setij(CINTOpt *opt, FINT *ng,
                    FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env);
+void CINTOpt_set_pair_bounds(CINTOpt *opt, FINT ijkl_inc, FINT *atm, FINT natm,
+                             FINT *bas, FINT nbas, double *env);
+FINT CINTOpt_sr_screened(CINTOpt *opt, FINT *shls, double omega, double expcutoff);
 void CINTOpt_non0coeff_byshell(FINT *sortedidx, FINT *non0ctr, double *ci,
                                FINT iprim, FINT ictr);
 void CINTOpt_set_non0coeff(CINTOpt *opt, FINT *atm, FINT natm,
@@ -27,6 +40,21 @@ FINT CINTset_pairdata(PairData *pairdata, double *ai, double *aj, double *ri, do
                       double *log_maxci, double *log_maxcj,
                       FINT li_ceil, FINT lj_ceil, FINT iprim, FINT jprim,
                       double rr_ij, double expcutoff, double *env);
+PairData *CINTOpt_build_pairdata(CINTOpt *opt, FINT i, FINT j,
+                                 FINT *atm, FINT *bas, double *env);
+
+// pairdata of the shell pair (i,j), built on first use for the optimizers
+// created by CINTset_lazy_pairdata. opt->pairdata must not be NULL
+static inline PairData *CINTOpt_pairdata(CINTOpt *opt, FINT i, FINT j,
+                                         FINT *atm, FINT *bas, double *env)
+{
+        PairData *pdata = __atomic_load_n(opt->pairdata + i * opt->nbas + j,
+                                          __ATOMIC_ACQUIRE);
+        if (pdata == NULL) {
+                pdata = CINTOpt_build_pairdata(opt, i, j, atm, bas, env);
+        }
+        return pdata;
+}
 
 void CINTOpt_4cindex_xyz(CINTOpt *opt, FINT *ng,
                          FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env);
@@ -56,6 +84,9 @@ void CINTall_1e_grids_optimizer(CINTOpt **opt, FINT *ng,
 #ifdef WITH_F12
 void CINTall_2e_stg_optimizer(CINTOpt **opt, FINT *ng,
                               FINT *atm, FINT natm, FINT *bas, FINT nbas, double *env);
+void CINTall_2e_stg_geminals_optimizer(CINTOpt **opt, FINT *ng,
+                                       FINT *atm, FINT natm, FINT *bas, FINT nbas,
+                                       double *env);
 #endif
 
 #ifndef HAVE_DEFINED_APPROX_LOG
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2013-  Qiming Sun <osirpt.sun@gmail.com>
+ *
+ * Performance counters of the screening and the integral kernels.
+ *
+ * Every thread updates its own block of counters without synchronization.
+ * The blocks are chained in a global list when a thread updates a counter
+ * the first time and are never released, so the counts of finished threads
+ * are kept. CINTperf_read sums the blocks of all threads.
+ *
+ * CINTperf_reset is not synchronized with the threads which are updating
+ * the counters. Call it outside of parallel regions.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "config.h"
+#include "perf_counters.h"
+
+typedef struct _PerfBlock {
+        unsigned long long counters[CINT_PERF_COUNTERS];
+        struct _PerfBlock *next;
+} PerfBlock;
+
+static PerfBlock *_perf_blocks = NULL;
+// sink of the counts when the block cannot be allocated
+static unsigned long long _perf_dummy[CINT_PERF_COUNTERS];
+
+__thread unsigned long long *CINTperf_local = NULL;
+
+unsigned long long *CINTperf_thread_counters()
+{
+        PerfBlock *blk = calloc(1, sizeof(PerfBlock));
+        if (blk == NULL) {
+                fprintf(stderr, "CINTperf: failed to allocate the counters\n");
+                CINTperf_local = _perf_dummy;
+                return _perf_dummy;
+        }
+        PerfBlock *head = __atomic_load_n(&_perf_blocks, __ATOMIC_RELAXED);
+        do {
+                blk->next = head;
+        } while (!__atomic_compare_exchange_n(&_perf_blocks, &head, blk, 1,
+                                              __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+        CINTperf_local = blk->counters;
+        return blk->counters;
+}
+
+void CINTperf_read(unsigned long long *counters)
+{
+        FINT i;
+        PerfBlock *blk;
+        for (i = 0; i < CINT_PERF_COUNTERS; i++) {
+                counters[i] = 0;
+        }
+        for (blk = __atomic_load_n(&_perf_blocks, __ATOMIC_ACQUIRE);
+             blk != NULL; blk = blk->next) {
+                for (i = 0; i < CINT_PERF_COUNTERS; i++) {
+                        counters[i] += __atomic_load_n(blk->counters + i,
+                                                       __ATOMIC_RELAXED);
+                }
+        }
+}
+
+void CINTperf_reset()
+{
+        FINT i;
+        PerfBlock *blk;
+        for (blk = __atomic_load_n(&_perf_blocks, __ATOMIC_ACQUIRE);
+             blk != NULL; blk = blk->next) {
+                for (i = 0; i < CINT_PERF_COUNTERS; i++) {
+                        __atomic_store_n(blk->counters + i, 0, __ATOMIC_RELAXED);
+                }
+        }
+}
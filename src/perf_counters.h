@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2013-  Qiming Sun <osirpt.sun@gmail.com>
+ *
+ * Instrumentation macros of the performance counters. They expand to
+ * nothing unless the library is built with -DWITH_PERF_COUNTERS=1.
+ */
+
+#include "cint.h"
+
+#ifdef WITH_PERF_COUNTERS
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// counters of the calling thread, NULL until the first update
+extern __thread unsigned long long *CINTperf_local;
+unsigned long long *CINTperf_thread_counters();
+
+static inline void CINTperf_add(int id, unsigned long long n)
+{
+        unsigned long long *counters = CINTperf_local;
+        if (counters == NULL) {
+                counters = CINTperf_thread_counters();
+        }
+        // only the owner thread writes the counters. The relaxed store keeps
+        // the concurrent reads in CINTperf_read well defined
+        __atomic_store_n(counters + id, counters[id] + n, __ATOMIC_RELAXED);
+}
+
+// TSC cycles on x86, nanoseconds elsewhere
+static inline unsigned long long CINTperf_ticks()
+{
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        struct timespec t;
+        clock_gettime(CLOCK_MONOTONIC, &t);
+        return t.tv_sec * 1000000000ULL + t.tv_nsec;
+#endif
+}
+
+#define PERF_COUNT(id, n)       CINTperf_add(id, n)
+#define PERF_TICK(t)            unsigned long long t = CINTperf_ticks()
+#define PERF_TOCK(id, t)        CINTperf_add(id, CINTperf_ticks() - (t))
+
+#else
+
+#define PERF_COUNT(id, n)
+#define PERF_TICK(t)
+#define PERF_TOCK(id, t)
+
+#endif
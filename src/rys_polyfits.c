@@ -0,0 +1,40 @@
+/*
+ * Chebyshev interpolation of the Rys roots and weights for 6 <= nroots <=
+ * MXRYSROOTS.
+ *
+ * The tables rys_roots_x.dat and rys_roots_w.dat are generated by
+ * scripts/rys_tabulate.py. For every nroots, x in [0, 35+5*nroots) is split
+ * into the intervals of DATA_TBASE (2.5 wide below 40, 4 wide above) and each
+ * interval holds 14 Chebyshev coefficients of every root and weight. Beyond
+ * 35+5*nroots, CINTrys_roots uses the large-x limits.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include "rys_roots.h"
+#include "rys_roots_x.dat"
+#include "rys_roots_w.dat"
+
+void _CINT_clenshaw_d1(double *rr, const double *x, double u, FINT nroot);
+
+int CINTrys_polyfits(int nroots, double x, double *u, double *w)
+{
+        if (nroots < 6 || nroots > MXRYSROOTS || x < 0 || x >= 35+nroots*5) {
+                return 1;
+        }
+
+        int it;
+        if (x < 40) {
+                it = (int)(x * .4);
+        } else {
+                it = (int)(x * .25) + 6;
+        }
+        double t0 = DATA_TBASE[it];
+        double t1 = DATA_TBASE[it+1];
+        double tt = (x - t0) * 2 / (t1 - t0) - 1;
+        size_t offset = DATA_OFFSETS[nroots] + (size_t)it * nroots * 14;
+        _CINT_clenshaw_d1(u, DATA_X + offset, tt, nroots);
+        _CINT_clenshaw_d1(w, DATA_W + offset, tt, nroots);
+        return 0;
+}
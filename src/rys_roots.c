@@ -16,6 +16,7 @@
 #include <math.h>
 #include "config.h"
 #include "rys_roots.h"
+#include "perf_counters.h"
 #include "roots_for_x0.dat"
 
 #ifdef HAVE_QUADMATH_H
@@ -49,6 +50,7 @@ static int segment_solve(int n, double x, double lower, double *u, double *w,
                 error = fn2(n, x, lower, u, w);
         }
         if (error) {
+                PERF_COUNT(CINT_PERF_RYS_FALLBACK, 1);
                 error = CINTqrys_schmidt(n, x, lower, u, w);
         }
         return error;
@@ -56,6 +58,7 @@ static int segment_solve(int n, double x, double lower, double *u, double *w,
 
 void CINTrys_roots(int nroots, double x, double *u, double *w)
 {
+        PERF_COUNT(CINT_PERF_RYS_CALLS, 1);
         if (x <= SMALLX_LIMIT) {
                 int off = nroots * (nroots - 1) / 2;
                 int i;
@@ -94,23 +97,8 @@ void CINTrys_roots(int nroots, double x, double *u, double *w)
         case 5:
                 err = rys_root5(x, u, w);
                 break;
-        case 6: case 7:
-                err = segment_solve(nroots, x, 0., u, w, 11, CINTrys_jacobi, CINTrys_schmidt);
-                break;
-        case 8:
-                err = segment_solve(nroots, x, 0., u, w, 11, CINTrys_jacobi, CINTlrys_schmidt);
-                break;
-        case 9:
-                err = segment_solve(nroots, x, 0., u, w, 10, CINTlrys_jacobi, CINTlrys_laguerre);
-                break;
-        case 10: case 11:
-                err = segment_solve(nroots, x, 0., u, w, 18, CINTlrys_jacobi, CINTlrys_laguerre);
-                break;
-        case 12:
-                err = segment_solve(nroots, x, 0., u, w, 22, CINTlrys_jacobi, CINTlrys_laguerre);
-                break;
         default:
-                err = segment_solve(nroots, x, 0., u, w, 50, CINTqrys_jacobi, CINTqrys_laguerre);
+                err = CINTrys_polyfits(nroots, x, u, w);
         }
         if (err) {
                 fprintf(stderr, "rys_roots fails: nroots=%d x=%g\n",
@@ -141,6 +129,7 @@ static int segment_solve1(int n, double x, double lower, double *u, double *w,
                 return 1;
         }
         if (error) {
+                PERF_COUNT(CINT_PERF_RYS_FALLBACK, 1);
                 error = CINTqrys_schmidt(n, x, lower, u, w);
         }
         return error;
@@ -149,6 +138,12 @@ static int segment_solve1(int n, double x, double lower, double *u, double *w,
 void CINTsr_rys_roots(int nroots, double x, double lower, double *u, double *w)
 {
         int err = 1;
+        PERF_COUNT(CINT_PERF_RYS_CALLS, 1);
+        // The tables are less accurate than the Schmidt solver for nroots < 3
+        if (nroots >= 3 && lower < 0.6 &&
+            CINTsr_rys_polyfits(nroots, x, lower, u, w) == 0) {
+                return;
+        }
         switch (nroots) {
         case 1:
                 err = CINTrys_schmidt(nroots, x, lower, u, w);
@@ -161,14 +156,6 @@ void CINTsr_rys_roots(int nroots, double x, double lower, double *u, double *w)
                 }
                 break;
         case 3:
-#ifdef WITH_POLYNOMIAL_FIT
-                if (lower < 0.6) {
-                        err = CINTsr_rys_polyfits(nroots, x, lower, u, w);
-                        if (err == 0) {
-                                break;;
-                        }
-                }
-#endif
                 if (lower < 0.93) {
                         err = CINTrys_schmidt(nroots, x, lower, u, w);
                 } else if (lower < 0.97) {
@@ -178,14 +165,6 @@ void CINTsr_rys_roots(int nroots, double x, double lower, double *u, double *w)
                 }
                 break;
         case 4:
-#ifdef WITH_POLYNOMIAL_FIT
-                if (lower < 0.6) {
-                        err = CINTsr_rys_polyfits(nroots, x, lower, u, w);
-                        if (err == 0) {
-                                break;;
-                        }
-                }
-#endif
                 if (lower < 0.8) {
                         err = CINTrys_schmidt(nroots, x, lower, u, w);
                 } else if (lower < 0.9) {
@@ -195,14 +174,6 @@ void CINTsr_rys_roots(int nroots, double x, double lower, double *u, double *w)
                 }
                 break;
         case 5:
-#ifdef WITH_POLYNOMIAL_FIT
-                if (lower < 0.6) {
-                        err = CINTsr_rys_polyfits(nroots, x, lower, u, w);
-                        if (err == 0) {
-                                break;;
-                        }
-                }
-#endif
                 if (lower < 0.4) {
                         err = segment_solve(nroots, x, lower, u, w, 50, CINTrys_schmidt, CINTlrys_laguerre);
                 } else if (lower < 0.8) {
@@ -266,6 +237,18 @@ void CINTsr_rys_roots(int nroots, double x, double lower, double *u, double *w)
         }
 }
 
+/*
+ * Roots and weights of n pairs of (x, lower). u and w are [n,nroots] arrays
+ */
+void CINTsr_rys_roots_batch(int nroots, int n, double *x, double *lower,
+                            double *u, double *w)
+{
+        int i;
+        for (i = 0; i < n; i++) {
+                CINTsr_rys_roots(nroots, x[i], lower[i], u+i*nroots, w+i*nroots);
+        }
+}
+
 static int rys_root1(double X, double *roots, double *weights)
 {
         double Y, F1;
@@ -1760,6 +1743,7 @@ static int _rdk_rys_roots(int nroots, double *fmt_ints,
 int CINTrys_schmidt(int nroots, double x, double lower, double *roots, double *weights)
 {
         double fmt_ints[MXRYSROOTS*2];
+        PERF_COUNT(CINT_PERF_RYS_DOUBLE, 1);
         if (lower == 0) {
                 gamma_inc_like(fmt_ints, x, nroots*2);
         } else {
@@ -1860,6 +1844,7 @@ int CINTlrys_schmidt(int nroots, double x, double lower, double *roots, double *
         double *cs = rt + nroots;
         double *a;
         double root, poly, dum, dum0;
+        PERF_COUNT(CINT_PERF_RYS_LDOUBLE, 1);
 
         if (lower == 0) {
                 lgamma_inc_like(fmt_ints, x, nroots*2);
@@ -1980,6 +1965,7 @@ int CINTqrys_schmidt(int nroots, double x, double lower, double *roots, double *
         double *cs = rt + nroots;
         double *a;
         double root, poly, dum, dum0;
+        PERF_COUNT(CINT_PERF_RYS_QUAD, 1);
 
         if (lower == 0) {
                 qgamma_inc_like(fmt_ints, x, nroots*2);
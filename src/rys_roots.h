@@ -2,7 +2,17 @@
 
 void CINTrys_roots(int nroots, double x, double *u, double *w);
 void CINTsr_rys_roots(int nroots, double x, double lower, double *u, double *w);
+void CINTsr_rys_roots_batch(int nroots, int n, double *x, double *lower,
+                            double *u, double *w);
 void CINTstg_roots(int nroots, double ta, double ua, double* rr, double* ww);
+void CINTstg_roots_batch(int nroots, int n, double *ta, double *ua,
+                         double *rr, double *ww);
+int CINTrys_polyfits(int nroots, double x, double *u, double *w);
+// max nroots of the tables in sr_rys_polyfits.c
+#define SR_POLYFIT_NROOTS       8
+// The relative error of the tabulated roots grows from ~1e-10 at
+// x*lower^2 = 10 to 1e-3 at 25. Beyond this bound the solvers are used.
+#define SR_POLYFIT_XLL_MAX      10.
 int CINTsr_rys_polyfits(int nroots, double x, double lower, double *u, double *w);
 
 int CINTrys_schmidt(int nroots, double x, double lower, double *roots, double *weights);
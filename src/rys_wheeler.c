@@ -11,6 +11,7 @@
 #include <math.h>
 #include "config.h"
 #include "rys_roots.h"
+#include "perf_counters.h"
 
 #define SQRTPIE4      .8862269254527580136490837416705725913987747280611935641069038949264
 #define SQRTPIE4l     .8862269254527580136490837416705725913987747280611935641069038949264l
@@ -3669,6 +3670,7 @@ int CINTrys_laguerre(int n, double x, double lower, double *roots, double *weigh
         double moments[MXRYSROOTS * 6];
         double *alpha = moments + n * 2;
         double *beta = alpha + n * 2;
+        PERF_COUNT(CINT_PERF_RYS_DOUBLE, 1);
 
         laguerre_moments(n * 2, x, lower, alpha, beta, moments);
 
@@ -3680,6 +3682,7 @@ int CINTrys_jacobi(int n, double x, double lower, double *roots, double *weights
         double moments[MXRYSROOTS * 2];
         double *alpha = JACOBI_ALPHA;
         double *beta = JACOBI_BETA;
+        PERF_COUNT(CINT_PERF_RYS_DOUBLE, 1);
 
         if (lower == 0) {
                 flocke_jacobi_moments(n * 2, x, moments);
@@ -3694,6 +3697,7 @@ int CINTlrys_laguerre(int n, double x, double lower, double *roots, double *weig
         long double moments[MXRYSROOTS * 6];
         long double *alpha = moments + n * 2;
         long double *beta = alpha + n * 2;
+        PERF_COUNT(CINT_PERF_RYS_LDOUBLE, 1);
 
         llaguerre_moments(n * 2, x, lower, alpha, beta, moments);
 
@@ -3705,6 +3709,7 @@ int CINTlrys_jacobi(int n, double x, double lower, double *roots, double *weight
         long double moments[MXRYSROOTS*2];
         long double *alpha = lJACOBI_ALPHA;
         long double *beta = lJACOBI_BETA;
+        PERF_COUNT(CINT_PERF_RYS_LDOUBLE, 1);
 
         if (lower == 0) {
                 lflocke_jacobi_moments(n * 2, x, moments);
@@ -6325,6 +6330,7 @@ int CINTqrys_laguerre(int n, double x, double lower, double *roots, double *weig
         __float128 moments[MXRYSROOTS * 6];
         __float128 *alpha = moments + n * 2;
         __float128 *beta = alpha + n * 2;
+        PERF_COUNT(CINT_PERF_RYS_QUAD, 1);
 
         qlaguerre_moments(n * 2, x, lower, alpha, beta, moments);
 
@@ -6336,6 +6342,7 @@ int CINTqrys_jacobi(int n, double x, double lower, double *roots, double *weight
         __float128 moments[MXRYSROOTS*2];
         __float128 *alpha = qJACOBI_ALPHA;
         __float128 *beta = qJACOBI_BETA;
+        PERF_COUNT(CINT_PERF_RYS_QUAD, 1);
 
         if (lower == 0) {
                 qflocke_jacobi_moments(n * 2, x, moments);
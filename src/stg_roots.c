@@ -290,161 +290,101 @@ static void _clenshaw_dc(double *rr, const double *x, double u, int nroot)
     }
 }
 
-static void _clenshaw_d1(double *rr, const double *x, double u, int nroot)
-{
-    int i;
-    double d0, d1, g0, g1;
-    double u2 = u * 2.;
-
-    for (i = 0; i < nroot-1; i+=2) {
-        d0 = 0;
-        d1 = 0;
-        g0 = x[13+   14*i];
-        g1 = x[13+14+14*i];
-        d0 = u2 * g0 - d0 + x[12+   14*i];
-        d1 = u2 * g1 - d1 + x[12+14+14*i];
-        g0 = u2 * d0 - g0 + x[11+   14*i];
-        g1 = u2 * d1 - g1 + x[11+14+14*i];
-        d0 = u2 * g0 - d0 + x[10+   14*i];
-        d1 = u2 * g1 - d1 + x[10+14+14*i];
-        g0 = u2 * d0 - g0 + x[9 +   14*i];
-        g1 = u2 * d1 - g1 + x[9 +14+14*i];
-        d0 = u2 * g0 - d0 + x[8 +   14*i];
-        d1 = u2 * g1 - d1 + x[8 +14+14*i];
-        g0 = u2 * d0 - g0 + x[7 +   14*i];
-        g1 = u2 * d1 - g1 + x[7 +14+14*i];
-        d0 = u2 * g0 - d0 + x[6 +   14*i];
-        d1 = u2 * g1 - d1 + x[6 +14+14*i];
-        g0 = u2 * d0 - g0 + x[5 +   14*i];
-        g1 = u2 * d1 - g1 + x[5 +14+14*i];
-        d0 = u2 * g0 - d0 + x[4 +   14*i];
-        d1 = u2 * g1 - d1 + x[4 +14+14*i];
-        g0 = u2 * d0 - g0 + x[3 +   14*i];
-        g1 = u2 * d1 - g1 + x[3 +14+14*i];
-        d0 = u2 * g0 - d0 + x[2 +   14*i];
-        d1 = u2 * g1 - d1 + x[2 +14+14*i];
-        g0 = u2 * d0 - g0 + x[1 +   14*i];
-        g1 = u2 * d1 - g1 + x[1 +14+14*i];
-        rr[i]   = u * g0 - d0 + x[14*i   ] * 0.5;
-        rr[i+1] = u * g1 - d1 + x[14*i+14] * 0.5;
-    }
-    if (i < nroot) {
-        d0 = 0;
-        g0 = x[13+14*i];
-        d0 = u2 * g0 - d0 + x[12+14*i];
-        g0 = u2 * d0 - g0 + x[11+14*i];
-        d0 = u2 * g0 - d0 + x[10+14*i];
-        g0 = u2 * d0 - g0 + x[9 +14*i];
-        d0 = u2 * g0 - d0 + x[8 +14*i];
-        g0 = u2 * d0 - g0 + x[7 +14*i];
-        d0 = u2 * g0 - d0 + x[6 +14*i];
-        g0 = u2 * d0 - g0 + x[5 +14*i];
-        d0 = u2 * g0 - d0 + x[4 +14*i];
-        g0 = u2 * d0 - g0 + x[3 +14*i];
-        d0 = u2 * g0 - d0 + x[2 +14*i];
-        g0 = u2 * d0 - g0 + x[1 +14*i];
-        rr[i] = u * g0 - d0 + x[14*i] * 0.5;
-    }
-}
-
-static void _matmul_14_14(double *imc, double *im, int nroot)
+/*
+ * The Chebyshev expansion in tt of the cosine transformed coefficients is
+ * linear in the coefficients im. The Chebyshev polynomials of tt and the
+ * cosine transformation are contracted first
+ *      v[m] = 1/7 sum_j COS_14_14[m,j] T_j(tt)
+ * then rr[i] = sum_m im[i,m] v[m] for the roots and weights of all nroots
+ */
+static void _chebyshev_cos_14(double *v, double t)
 {
     double o7 = 0.14285714285714285714;
+    double c[14];
     double s;
-    double d0[14];
-    int i, j;
-    for (i = 0; i < nroot; i++) {
-        d0[0 ] = 0;
-        d0[1 ] = 0;
-        d0[2 ] = 0;
-        d0[3 ] = 0;
-        d0[4 ] = 0;
-        d0[5 ] = 0;
-        d0[6 ] = 0;
-        d0[7 ] = 0;
-        d0[8 ] = 0;
-        d0[9 ] = 0;
-        d0[10] = 0;
-        d0[11] = 0;
-        d0[12] = 0;
-        d0[13] = 0;
+    int j, m;
+    c[0] = 1.;
+    c[1] = t;
+    for (j = 2; j < 14; j++) {
+        c[j] = 2. * t * c[j-1] - c[j-2];
+    }
+    c[0] = 0.5;
+    for (m = 0; m < 14; m++) {
+        s = 0;
+#pragma GCC ivdep
         for (j = 0; j < 14; j++) {
-            s = im[j+14*i];
-            d0[0 ] += s * COS_14_14[j*14+0 ];
-            d0[1 ] += s * COS_14_14[j*14+1 ];
-            d0[2 ] += s * COS_14_14[j*14+2 ];
-            d0[3 ] += s * COS_14_14[j*14+3 ];
-            d0[4 ] += s * COS_14_14[j*14+4 ];
-            d0[5 ] += s * COS_14_14[j*14+5 ];
-            d0[6 ] += s * COS_14_14[j*14+6 ];
-            d0[7 ] += s * COS_14_14[j*14+7 ];
-            d0[8 ] += s * COS_14_14[j*14+8 ];
-            d0[9 ] += s * COS_14_14[j*14+9 ];
-            d0[10] += s * COS_14_14[j*14+10];
-            d0[11] += s * COS_14_14[j*14+11];
-            d0[12] += s * COS_14_14[j*14+12];
-            d0[13] += s * COS_14_14[j*14+13];
+            s += COS_14_14[m*14+j] * c[j];
         }
-        imc[0 +14*i] = o7 * d0[0 ];
-        imc[1 +14*i] = o7 * d0[1 ];
-        imc[2 +14*i] = o7 * d0[2 ];
-        imc[3 +14*i] = o7 * d0[3 ];
-        imc[4 +14*i] = o7 * d0[4 ];
-        imc[5 +14*i] = o7 * d0[5 ];
-        imc[6 +14*i] = o7 * d0[6 ];
-        imc[7 +14*i] = o7 * d0[7 ];
-        imc[8 +14*i] = o7 * d0[8 ];
-        imc[9 +14*i] = o7 * d0[9 ];
-        imc[10+14*i] = o7 * d0[10];
-        imc[11+14*i] = o7 * d0[11];
-        imc[12+14*i] = o7 * d0[12];
-        imc[13+14*i] = o7 * d0[13];
+        v[m] = o7 * s;
     }
 }
 
-void CINTstg_roots(int nroots, double ta, double ua, double* rr, double* ww)
+/*
+ * Evaluate the STG roots and weights for n pairs of (ta, ua).
+ * rr and ww are stored as rr[n][nroots].
+ *
+ * The pairs are evaluated one after another. Each pair reads the table block
+ * of its own (iu, it) interval, so the Clenshaw recurrences of different
+ * pairs do not share loads and are not vectorized across the batch. Only the
+ * sums over the 14 Chebyshev terms of a pair are vectorized.
+ */
+void CINTstg_roots_batch(int nroots, int n, double *ta, double *ua,
+                         double *rr, double *ww)
 {
   const double* x = DATA_X + (nroots-1)*nroots/2 * 19600;
   const double* w = DATA_W + (nroots-1)*nroots/2 * 19600;
-  double u, uu, t, tt;
-  int k, iu, it;
+  double u, uu, t, tt, sr, sw;
+  int i, k, iu, it, p;
   int offset;
-  double im [14*nroots];
-  double imc[14*nroots];
+  double im [14*MXRYSROOTS*2];
+  double v[14];
 
-  t = ta;
-  if (t > 19682.99) t = 19682.99;
-  u = ua;
-  if (t > 1.0) {
-      tt = log(t) * 0.9102392266268373 + 1.0; // log(3)+1 
-  } else {
-      tt = sqrt(t);
-  }
-  uu = log10(u);
+  for (p = 0; p < n; p++) {
+      t = ta[p];
+      if (t > 19682.99) t = 19682.99;
+      u = ua[p];
+      if (t > 1.0) {
+          tt = log(t) * 0.9102392266268373 + 1.0; // log(3)+1
+      } else {
+          tt = sqrt(t);
+      }
+      uu = log10(u);
 
-  it = (int)tt;
-  tt = tt - it;
-  tt = 2.0 * tt - 1.0;
+      it = (int)tt;
+      tt = tt - it;
+      tt = 2.0 * tt - 1.0;
 
-  iu = (uu + 7); // 0 <= iu <= 9
-  if (iu < 0 || iu > 10) {
-      fprintf(stderr, "current implementation assumes 1.0e-7 < U < 1.0e3");
-      exit(1);
-  } else {
-      uu = uu - (iu - 7);
-      uu = 2.0 * uu - 1.0;
-  }
+      iu = (uu + 7); // 0 <= iu <= 9
+      if (iu < 0 || iu > 10) {
+          fprintf(stderr, "current implementation assumes 1.0e-7 < U < 1.0e3");
+          exit(1);
+      } else {
+          uu = uu - (iu - 7);
+          uu = 2.0 * uu - 1.0;
+      }
 
-  offset = nroots * 196 * (iu + it * 10);
-  _clenshaw_dc(im, x+offset, uu, nroots);
-  _matmul_14_14(imc, im, nroots);
-  _clenshaw_d1(rr, imc, tt, nroots);
-  _clenshaw_dc(im, w+offset, uu, nroots);
-  _matmul_14_14(imc, im, nroots);
-  _clenshaw_d1(ww, imc, tt, nroots);
-  uu = 1./sqrt(ua);
-  for (k = 0; k < nroots; k++) {
-      ww[k] *= uu;
+      offset = nroots * 196 * (iu + it * 10);
+      _clenshaw_dc(im, x+offset, uu, nroots);
+      _clenshaw_dc(im+14*nroots, w+offset, uu, nroots);
+      _chebyshev_cos_14(v, tt);
+      uu = 1./sqrt(u);
+      for (i = 0; i < nroots; i++) {
+          sr = 0;
+          sw = 0;
+#pragma GCC ivdep
+          for (k = 0; k < 14; k++) {
+              sr += im[k+14*i] * v[k];
+              sw += im[k+14*(i+nroots)] * v[k];
+          }
+          rr[i] = sr;
+          ww[i] = sw * uu;
+      }
+      rr += nroots;
+      ww += nroots;
   }
 }
 
+void CINTstg_roots(int nroots, double ta, double ua, double* rr, double* ww)
+{
+  CINTstg_roots_batch(nroots, 1, &ta, &ua, rr, ww);
+}
@@ -11,6 +11,7 @@ __author__ = "Qiming Sun <osirpt.sun@gmail.com>"
 import sys
 import os
 import ctypes
+import itertools
 import numpy
 
 _cint = ctypes.CDLL(os.path.abspath(os.path.join(__file__, '../../build/libcint.so')))
@@ -415,6 +416,837 @@ def test_comp2e_spinor(name1, name_ref, shift, dim, place):
                         return
     print("pass: ", name1, "/", name_ref)
 
+def test_c2s_2e_spinor(place):
+    # the cartesian to spinor coefficients of each shell from the 1e transform
+    coeff = []
+    for i in range(nbas.value*2):
+        l = bas[i,ANG_OF]
+        nf = (l + 1) * (l + 2) // 2
+        nd = _cint.CINTlen_spinor(i, c_bas, nbas)
+        ca = numpy.empty((nd,nf), dtype=numpy.complex128)
+        cb = numpy.empty((nd,nf), dtype=numpy.complex128)
+        _cint.CINTc2s_ket_spinor_sf1(ca.ctypes.data_as(ctypes.c_void_p),
+                                     cb.ctypes.data_as(ctypes.c_void_p),
+                                     numpy.eye(nf).ctypes.data_as(ctypes.c_void_p),
+                                     ctypes.c_int(nf), ctypes.c_int(nf), ctypes.c_int(1),
+                                     ctypes.c_int(bas[i,KAPPA_OF]), ctypes.c_int(l))
+        eye = numpy.eye(bas[i,NCTR_OF])
+        coeff.append((numpy.kron(eye, ca), numpy.kron(eye, cb)))
+    for i, j, k, l in numpy.ndindex(nbas.value*2, nbas.value*2, nbas.value*2, nbas.value*2):
+        if i > j or k > l:
+            continue
+        dims = [coeff[x][0].shape for x in (i, j, k, l)]
+        shls = (ctypes.c_int * 4)(i, j, k, l)
+        cart = numpy.empty([d[1] for d in dims][::-1])
+        _cint.int2e_cart(cart.ctypes.data_as(ctypes.c_void_p), None, shls,
+                         c_atm, natm, c_bas, nbas, c_env, None, None)
+        ref = 0
+        for ci, cj in zip(coeff[i], coeff[j]):
+            for ck, cl in zip(coeff[k], coeff[l]):
+                ref = ref + numpy.einsum('dcba,ia,jb,kc,ld->lkji', cart, ci.conj(),
+                                         cj, ck.conj(), cl, optimize=True)
+        buf = numpy.empty([d[0] for d in dims][::-1], dtype=numpy.complex128)
+        _cint.int2e_spinor(buf.ctypes.data_as(ctypes.c_void_p), None, shls,
+                           c_atm, natm, c_bas, nbas, c_env, None, None)
+        dd = abs(buf - ref)
+        if numpy.round(dd, place).sum():
+            print("* FAIL: int2e_spinor fused c2s. shell:", i, j, k, l, "err:", dd.max())
+            return
+    print("pass: int2e_spinor fused c2s")
+
+def test_kramers_2e_spinor(name_kr, name_ref, place):
+    intor     = getattr(_cint, name_kr)
+    intor_ref = getattr(_cint, name_ref)
+    for l in range(nbas.value*2):
+        for k in range(l+1):
+            for j in range(nbas.value*2):
+                for i in range(j+1):
+                    di = _cint.CINTlen_spinor(i, c_bas, nbas) * bas[i,NCTR_OF]
+                    dj = _cint.CINTlen_spinor(j, c_bas, nbas) * bas[j,NCTR_OF]
+                    dk = _cint.CINTlen_spinor(k, c_bas, nbas) * bas[k,NCTR_OF]
+                    dl = _cint.CINTlen_spinor(l, c_bas, nbas) * bas[l,NCTR_OF]
+                    shls = (ctypes.c_int * 4)(i, j, k, l)
+                    kr = numpy.empty(di*dj*dk*dl//2, dtype=numpy.complex128)
+                    op = numpy.empty(di*dj*dk*dl, dtype=numpy.complex128)
+                    ref = numpy.empty(di*dj*dk*dl, dtype=numpy.complex128)
+                    intor(kr.ctypes.data_as(ctypes.c_void_p), None, shls,
+                          c_atm, natm, c_bas, nbas, c_env, None, None)
+                    _cint.CINTc2s_kramers_2e(op.ctypes.data_as(ctypes.c_void_p),
+                                             kr.ctypes.data_as(ctypes.c_void_p),
+                                             shls, c_bas)
+                    intor_ref(ref.ctypes.data_as(ctypes.c_void_p), None, shls,
+                              c_atm, natm, c_bas, nbas, c_env, None, None)
+                    dd = abs(op - ref)
+                    if numpy.round(dd, place).sum():
+                        print("* FAIL: ", name_kr, ". shell:", i, j, k, l,
+                              "err:", dd.max())
+                        return
+    print("pass: ", name_kr)
+
+def test_spinor_opt(name, place):
+    intor = getattr(_cint, name + '_spinor')
+    opt = ctypes.c_void_p()
+    getattr(_cint, name + '_optimizer')(ctypes.byref(opt), c_atm, natm, c_bas, nbas, c_env)
+    for l in range(nbas.value):
+        for k in range(l+1):
+            for j in range(nbas.value):
+                for i in range(j+1):
+                    di = _cint.CINTlen_spinor(i, c_bas, nbas) * bas[i,NCTR_OF]
+                    dj = _cint.CINTlen_spinor(j, c_bas, nbas) * bas[j,NCTR_OF]
+                    dk = _cint.CINTlen_spinor(k, c_bas, nbas) * bas[k,NCTR_OF]
+                    dl = _cint.CINTlen_spinor(l, c_bas, nbas) * bas[l,NCTR_OF]
+                    shls = (ctypes.c_int * 4)(i, j, k, l)
+                    # zeros for the Kramers integrals which fill half of the buffer
+                    buf = numpy.zeros(di*dj*dk*dl, dtype=numpy.complex128)
+                    ref = numpy.zeros(di*dj*dk*dl, dtype=numpy.complex128)
+                    intor(buf.ctypes.data_as(ctypes.c_void_p), None, shls,
+                          c_atm, natm, c_bas, nbas, c_env, opt, None)
+                    intor(ref.ctypes.data_as(ctypes.c_void_p), None, shls,
+                          c_atm, natm, c_bas, nbas, c_env, None, None)
+                    dd = abs(buf - ref)
+                    if numpy.round(dd, place).sum():
+                        print("* FAIL: ", name, "with optimizer. shell:", i, j, k, l,
+                              "err:", dd.max())
+                        _cint.CINTdel_optimizer(ctypes.byref(opt))
+                        return
+    _cint.CINTdel_optimizer(ctypes.byref(opt))
+    print("pass: ", name, "with optimizer")
+
+def test_int2e_hrr(place):
+    # 16 primitive quartets and l >= 6 take the HRR after the contraction
+    natm1 = 4
+    nbas1 = 4
+    atm1 = numpy.zeros((natm1,ATM_SLOTS), dtype=numpy.int32)
+    bas1 = numpy.zeros((nbas1,BAS_SLOTS), dtype=numpy.int32)
+    env1 = numpy.zeros(PTR_ENV_START + 12 + 6)
+    atm1[:,PTR_COORD] = PTR_ENV_START + numpy.arange(natm1) * 3
+    env1[PTR_ENV_START:PTR_ENV_START+12] = numpy.random.random(12) * 2
+    env1[PTR_ENV_START+12:PTR_ENV_START+14] = (1.5, .4)
+    env1[PTR_ENV_START+14:] = (.8, .3, .2, .9)
+    bas1[:,ATOM_OF] = numpy.arange(nbas1)
+    bas1[:,ANG_OF] = (1, 2, 2, 1)
+    bas1[:,NPRIM_OF] = 2
+    bas1[:,NCTR_OF] = 2
+    bas1[:,PTR_EXP] = PTR_ENV_START + 12
+    bas1[:,PTR_COEFF] = PTR_ENV_START + 14
+    c_atm1 = atm1.ctypes.data_as(ctypes.c_void_p)
+    c_bas1 = bas1.ctypes.data_as(ctypes.c_void_p)
+    c_env1 = env1.ctypes.data_as(ctypes.c_void_p)
+    opt = ctypes.c_void_p()
+    _cint.int2e_optimizer(ctypes.byref(opt), c_atm1, ctypes.c_int(natm1),
+                          c_bas1, ctypes.c_int(nbas1), c_env1)
+    for shls in ((0, 1, 2, 3), (1, 2, 2, 1), (2, 1, 0, 3)):
+        dims = [(bas1[i,ANG_OF] * 2 + 1) * 2 for i in shls]
+        shls = (ctypes.c_int * 4)(*shls)
+        buf = numpy.empty(numpy.prod(dims))
+        ref = numpy.empty(numpy.prod(dims))
+        _cint.int2e_sph(buf.ctypes.data_as(ctypes.c_void_p), None, shls,
+                        c_atm1, ctypes.c_int(natm1), c_bas1, ctypes.c_int(nbas1),
+                        c_env1, opt, None)
+        _cint.int2e_sph(ref.ctypes.data_as(ctypes.c_void_p), None, shls,
+                        c_atm1, ctypes.c_int(natm1), c_bas1, ctypes.c_int(nbas1),
+                        c_env1, None, None)
+        dd = abs(buf - ref)
+        if numpy.round(dd, place).sum():
+            print("* FAIL: int2e_sph HRR after contraction. shell:", list(shls),
+                  "err:", dd.max())
+            _cint.CINTdel_optimizer(ctypes.byref(opt))
+            return
+    _cint.CINTdel_optimizer(ctypes.byref(opt))
+    print("pass: int2e_sph HRR after contraction")
+
+def test_int2e_opt(place):
+    opt = ctypes.c_void_p()
+    _cint.int2e_optimizer(ctypes.byref(opt), c_atm, natm, c_bas, nbas, c_env)
+    for l in range(nbas.value):
+        for k in range(l+1):
+            for j in range(nbas.value):
+                for i in range(j+1):
+                    di = (bas[i,ANG_OF] * 2 + 1) * bas[i,NCTR_OF]
+                    dj = (bas[j,ANG_OF] * 2 + 1) * bas[j,NCTR_OF]
+                    dk = (bas[k,ANG_OF] * 2 + 1) * bas[k,NCTR_OF]
+                    dl = (bas[l,ANG_OF] * 2 + 1) * bas[l,NCTR_OF]
+                    shls = (ctypes.c_int * 4)(i, j, k, l)
+                    buf = numpy.empty(di*dj*dk*dl)
+                    ref = numpy.empty(di*dj*dk*dl)
+                    _cint.int2e_sph(buf.ctypes.data_as(ctypes.c_void_p), None, shls,
+                                    c_atm, natm, c_bas, nbas, c_env, opt, None)
+                    _cint.int2e_sph(ref.ctypes.data_as(ctypes.c_void_p), None, shls,
+                                    c_atm, natm, c_bas, nbas, c_env, None, None)
+                    dd = abs(buf - ref)
+                    if numpy.round(dd, place).sum():
+                        print("* FAIL: int2e_sph with optimizer. shell:", i, j, k, l,
+                              "err:", dd.max())
+                        _cint.CINTdel_optimizer(ctypes.byref(opt))
+                        return
+    _cint.CINTdel_optimizer(ctypes.byref(opt))
+    print("pass: int2e_sph with optimizer")
+
+def test_int2e_lazy_pairdata():
+    opt = ctypes.c_void_p()
+    lazy = ctypes.c_void_p()
+    _cint.int2e_optimizer(ctypes.byref(opt), c_atm, natm, c_bas, nbas, c_env)
+    _cint.CINTset_lazy_pairdata(1)
+    _cint.int2e_optimizer(ctypes.byref(lazy), c_atm, natm, c_bas, nbas, c_env)
+    _cint.CINTset_lazy_pairdata(0)
+    # touch the pairs in both orders
+    for l in range(nbas.value):
+        for k in range(nbas.value):
+            i, j = nbas.value - 1 - l, k
+            di = (bas[i,ANG_OF] * 2 + 1) * bas[i,NCTR_OF]
+            dj = (bas[j,ANG_OF] * 2 + 1) * bas[j,NCTR_OF]
+            dk = (bas[k,ANG_OF] * 2 + 1) * bas[k,NCTR_OF]
+            dl = (bas[l,ANG_OF] * 2 + 1) * bas[l,NCTR_OF]
+            shls = (ctypes.c_int * 4)(i, j, k, l)
+            buf = numpy.empty(di*dj*dk*dl)
+            ref = numpy.empty(di*dj*dk*dl)
+            _cint.int2e_sph(buf.ctypes.data_as(ctypes.c_void_p), None, shls,
+                            c_atm, natm, c_bas, nbas, c_env, lazy, None)
+            _cint.int2e_sph(ref.ctypes.data_as(ctypes.c_void_p), None, shls,
+                            c_atm, natm, c_bas, nbas, c_env, opt, None)
+            if abs(buf - ref).max() != 0:
+                print("* FAIL: int2e_sph with lazy pairdata. shell:", i, j, k, l,
+                      "err:", abs(buf - ref).max())
+                _cint.CINTdel_optimizer(ctypes.byref(opt))
+                _cint.CINTdel_optimizer(ctypes.byref(lazy))
+                return
+    _cint.CINTdel_optimizer(ctypes.byref(opt))
+    _cint.CINTdel_optimizer(ctypes.byref(lazy))
+    print("pass: int2e_sph with lazy pairdata")
+
+
+def test_int2e_mixed_precision():
+    opt = ctypes.c_void_p()
+    _cint.int2e_optimizer(ctypes.byref(opt), c_atm, natm, c_bas, nbas, c_env)
+    _cint.CINTOpt_set_mixed_precision(opt, 1)
+    for l in range(0, nbas.value, 3):
+        for k in range(0, nbas.value, 2):
+            i, j = nbas.value - 1 - l, k
+            di = (bas[i,ANG_OF] * 2 + 1) * bas[i,NCTR_OF]
+            dj = (bas[j,ANG_OF] * 2 + 1) * bas[j,NCTR_OF]
+            dk = (bas[k,ANG_OF] * 2 + 1) * bas[k,NCTR_OF]
+            dl = (bas[l,ANG_OF] * 2 + 1) * bas[l,NCTR_OF]
+            shls = (ctypes.c_int * 4)(i, j, k, l)
+            ref = numpy.empty(di*dj*dk*dl)
+            buf = numpy.empty(di*dj*dk*dl)
+            buf32 = numpy.empty(di*dj*dk*dl, dtype=numpy.float32)
+            _cint.int2e_sph(ref.ctypes.data_as(ctypes.c_void_p), None, shls,
+                            c_atm, natm, c_bas, nbas, c_env, None, None)
+            _cint.int2e_sph(buf.ctypes.data_as(ctypes.c_void_p), None, shls,
+                            c_atm, natm, c_bas, nbas, c_env, opt, None)
+            _cint.int2e_sph_f32(buf32.ctypes.data_as(ctypes.c_void_p), None, shls,
+                                c_atm, natm, c_bas, nbas, c_env, None, None)
+            scale = max(abs(ref).max(), 1.)
+            err = max(abs(buf - ref).max(), abs(buf32 - ref).max()) / scale
+            # the single precision kernels of CINT2e_drv round off the
+            # double precision results
+            if err > 1e-5 or (abs(buf - ref).max() == 0 and abs(ref).max() > 0):
+                print("* FAIL: int2e_sph in mixed precision. shell:", i, j, k, l,
+                      "err:", err)
+                _cint.CINTdel_optimizer(ctypes.byref(opt))
+                return
+    _cint.CINTdel_optimizer(ctypes.byref(opt))
+    print("pass: int2e_sph in mixed precision")
+
+
+def test_int3c2e_mixed_precision():
+    for name, nc in (('int3c2e', 3), ('int2c2e', 2)):
+        intor = getattr(_cint, name + '_sph')
+        intor_f32 = getattr(_cint, name + '_sph_f32')
+        opt = ctypes.c_void_p()
+        getattr(_cint, name + '_optimizer')(ctypes.byref(opt), c_atm, natm,
+                                              c_bas, nbas, c_env)
+        _cint.CINTOpt_set_mixed_precision(opt, 1)
+        for shls in numpy.ndindex(*([nbas.value] * nc)):
+            dims = [(bas[i,ANG_OF] * 2 + 1) * bas[i,NCTR_OF] for i in shls]
+            shls = (ctypes.c_int * nc)(*shls)
+            ref = numpy.empty(numpy.prod(dims))
+            buf = numpy.empty(numpy.prod(dims))
+            buf32 = numpy.empty(numpy.prod(dims), dtype=numpy.float32)
+            intor(ref.ctypes.data_as(ctypes.c_void_p), None, shls,
+                  c_atm, natm, c_bas, nbas, c_env, None, None)
+            intor(buf.ctypes.data_as(ctypes.c_void_p), None, shls,
+                  c_atm, natm, c_bas, nbas, c_env, opt, None)
+            intor_f32(buf32.ctypes.data_as(ctypes.c_void_p), None, shls,
+                      c_atm, natm, c_bas, nbas, c_env, None, None)
+            scale = max(abs(ref).max(), 1.)
+            err = max(abs(buf - ref).max(), abs(buf32 - ref).max()) / scale
+            # the single precision round-off reaches 1.4e-5 for (gg|g)
+            if err > 5e-5 or (abs(buf - ref).max() == 0 and abs(ref).max() > 0):
+                print("* FAIL: %s_sph in mixed precision. shell:" % name,
+                      list(shls), "err:", err)
+                _cint.CINTdel_optimizer(ctypes.byref(opt))
+                return
+        _cint.CINTdel_optimizer(ctypes.byref(opt))
+    print("pass: int3c2e_sph, int2c2e_sph in mixed precision")
+
+
+def test_int2e_multipole():
+    # atoms well separated so that the one-center pairs interact in far field.
+    # The far-field path is taken for the contracted shells, for which it is
+    # cheaper than the Rys quadrature
+    natm1 = 3
+    nbas1 = natm1 * 4
+    atm1 = numpy.zeros((natm1,ATM_SLOTS), dtype=numpy.int32)
+    bas1 = numpy.zeros((nbas1,BAS_SLOTS), dtype=numpy.int32)
+    env1 = numpy.zeros(PTR_ENV_START + natm1*3 + 5 + 10)
+    atm1[:,CHARGE_OF] = 1
+    atm1[:,PTR_COORD] = PTR_ENV_START + numpy.arange(natm1) * 3
+    for i in range(natm1):
+        env1[PTR_ENV_START+i*3:PTR_ENV_START+i*3+3] = (60.*i, 1.5*i, -.5*i)
+    ptr_exp = PTR_ENV_START + natm1 * 3
+    env1[ptr_exp:ptr_exp+5] = (12., 4., 1.5, .6, .3)
+    env1[ptr_exp+5:] = numpy.sin(numpy.arange(10)) + 1.5
+    bas1[:,ATOM_OF] = numpy.arange(nbas1) // 4
+    bas1[:,ANG_OF] = numpy.arange(nbas1) % 4
+    bas1[:,NPRIM_OF] = 5
+    bas1[:,NCTR_OF] = 1
+    bas1[0::4,NCTR_OF] = 2
+    bas1[:,PTR_EXP] = ptr_exp
+    bas1[:,PTR_COEFF] = ptr_exp + 5
+    c_atm1 = atm1.ctypes.data_as(ctypes.c_void_p)
+    c_bas1 = bas1.ctypes.data_as(ctypes.c_void_p)
+    c_env1 = env1.ctypes.data_as(ctypes.c_void_p)
+    natm1 = ctypes.c_int(natm1)
+    nbas1 = ctypes.c_int(nbas1)
+    opt = ctypes.c_void_p()
+    _cint.int2e_optimizer(ctypes.byref(opt), c_atm1, natm1, c_bas1, nbas1, c_env1)
+    # the quartets in near field are identical to those of opt0
+    opt0 = ctypes.c_void_p()
+    _cint.int2e_optimizer(ctypes.byref(opt0), c_atm1, natm1, c_bas1, nbas1, c_env1)
+    # one-center pairs
+    pairs = [(i, j) for i in range(nbas1.value) for j in range(nbas1.value)
+             if bas1[i,ATOM_OF] == bas1[j,ATOM_OF]]
+    # the monopole approximation (order 0) is not accurate for p, d, ... shells
+    # but is accepted by a loose precision. The moments are not set up for
+    # an nbas other than the one of the optimizer
+    for order, prec, nbas2, truncated in ((6, 1e-10, nbas1, False),
+                                          (0, 1e-2, nbas1, True),
+                                          (6, 1e-10, ctypes.c_int(nbas1.value*2), None)):
+        _cint.CINTOpt_set_multipole(opt, order, ctypes.c_double(prec),
+                                    c_atm1, natm1, c_bas1, nbas2, c_env1)
+        err = 0
+        nfar = 0
+        for (i, j), (k, l) in itertools.product(pairs, pairs):
+            di, dj, dk, dl = [(bas1[n,ANG_OF] * 2 + 1) * bas1[n,NCTR_OF]
+                              for n in (i, j, k, l)]
+            shls = (ctypes.c_int * 4)(i, j, k, l)
+            ref = numpy.empty(di*dj*dk*dl)
+            buf = numpy.empty(di*dj*dk*dl)
+            _cint.int2e_sph(ref.ctypes.data_as(ctypes.c_void_p), None, shls,
+                            c_atm1, natm1, c_bas1, nbas1, c_env1, opt0, None)
+            _cint.int2e_sph(buf.ctypes.data_as(ctypes.c_void_p), None, shls,
+                            c_atm1, natm1, c_bas1, nbas1, c_env1, opt, None)
+            err = max(err, abs(buf - ref).max())
+            nfar += abs(buf - ref).max() != 0
+        if truncated is None:
+            failed = nfar != 0
+        else:
+            failed = (err > 1e-8) != truncated or nfar == 0
+        if failed:
+            print("* FAIL: int2e_sph with multipoles. order:", order, "err:", err,
+                  "far-field quartets:", nfar)
+            _cint.CINTdel_optimizer(ctypes.byref(opt))
+            _cint.CINTdel_optimizer(ctypes.byref(opt0))
+            return
+    _cint.CINTdel_optimizer(ctypes.byref(opt))
+    _cint.CINTdel_optimizer(ctypes.byref(opt0))
+    print("pass: int2e_sph with multipoles")
+
+
+def test_fmm_vj():
+    # a chain of 40 atoms, each with a copy of the p shell 0, long enough for
+    # the boxes to interact through the multipole-to-local translations
+    natm1 = 40
+    atm1 = numpy.zeros((natm1,ATM_SLOTS), dtype=numpy.int32)
+    env1 = env.copy()
+    for ia in range(natm1):
+        atm1[ia,CHARGE_OF] = 1
+        atm1[ia,PTR_COORD] = off + 100 + ia * 3
+        env1[off+100+ia*3:][:3] = (4.*ia, .3*(ia%2), 0)
+    bas1 = numpy.vstack([bas[:1]] * natm1)
+    bas1[:,ATOM_OF] = numpy.arange(natm1)
+    nbas1 = len(bas1)
+    c_atm1 = atm1.ctypes.data_as(ctypes.c_void_p)
+    c_bas1 = bas1.ctypes.data_as(ctypes.c_void_p)
+    c_env1 = env1.ctypes.data_as(ctypes.c_void_p)
+    args = (c_atm1, ctypes.c_int(natm1), c_bas1, ctypes.c_int(nbas1), c_env1)
+
+    dims = (bas1[:,ANG_OF] * 2 + 1) * bas1[:,NCTR_OF]
+    ao_loc = numpy.append(0, numpy.cumsum(dims))
+    nao = ao_loc[-1]
+    numpy.random.seed(2)
+    dm = numpy.random.random((nao,nao)) - .5
+    dm = dm + dm.T
+    diag = {}
+    for i, j in numpy.ndindex(nbas1, nbas1):
+        shls = (ctypes.c_int * 4)(i, j, i, j)
+        buf = numpy.empty((dims[j],dims[i],dims[j],dims[i]))
+        _cint.int2e_sph(buf.ctypes.data_as(ctypes.c_void_p), None, shls, *args, None, None)
+        diag[i,j] = numpy.sqrt(abs(buf).max())
+    pairs = [ij for ij in diag if diag[ij] > 1e-13]
+    vjref = numpy.zeros((nao,nao))
+    for i, j in pairs:
+        for k, l in pairs:
+            if diag[i,j] * diag[k,l] < 1e-13:
+                continue
+            shls = (ctypes.c_int * 4)(i, j, k, l)
+            buf = numpy.empty((dims[l],dims[k],dims[j],dims[i]))
+            _cint.int2e_sph(buf.ctypes.data_as(ctypes.c_void_p), None, shls, *args, None, None)
+            vjref[ao_loc[i]:ao_loc[i+1],ao_loc[j]:ao_loc[j+1]] += numpy.einsum(
+                'lkji,kl->ij', buf, dm[ao_loc[k]:ao_loc[k+1],ao_loc[l]:ao_loc[l+1]])
+
+    opt = ctypes.c_void_p()
+    _cint.int2e_optimizer(ctypes.byref(opt), *args)
+    vj = numpy.empty((nao,nao))
+    # the box-box interactions of low orders are not accurate
+    for order, truncated in ((6, False), (1, True)):
+        _cint.CINTOpt_set_multipole(opt, order, ctypes.c_double(1e-12), *args)
+        _cint.CINTfmm_vj_sph(vj.ctypes.data_as(ctypes.c_void_p),
+                             dm.ctypes.data_as(ctypes.c_void_p),
+                             ctypes.c_double(.5), *args, opt)
+        err = abs(vj - vjref).max()
+        if (err > 1e-7) != truncated:
+            print("* FAIL: CINTfmm_vj_sph. order:", order, "err:", err)
+            _cint.CINTdel_optimizer(ctypes.byref(opt))
+            return
+    _cint.CINTdel_optimizer(ctypes.byref(opt))
+    print("pass: CINTfmm_vj_sph")
+
+
+def test_cholesky_eri():
+    dims = (bas[:nbas.value,ANG_OF] * 2 + 1) * bas[:nbas.value,NCTR_OF]
+    ao_loc = numpy.append(0, numpy.cumsum(dims))
+    nao = ao_loc[-1]
+    eri = numpy.empty((nao,nao,nao,nao))
+    for i, j, k, l in numpy.ndindex(nbas.value, nbas.value, nbas.value, nbas.value):
+        shls = (ctypes.c_int * 4)(i, j, k, l)
+        buf = numpy.empty((dims[l],dims[k],dims[j],dims[i]))
+        _cint.int2e_sph(buf.ctypes.data_as(ctypes.c_void_p), None, shls,
+                        c_atm, natm, c_bas, nbas, c_env, None, None)
+        eri[ao_loc[i]:ao_loc[i+1],ao_loc[j]:ao_loc[j+1],
+            ao_loc[k]:ao_loc[k+1],ao_loc[l]:ao_loc[l+1]] = buf.transpose(3,2,1,0)
+    idx = numpy.tril_indices(nao)
+    eri = eri[idx][:,idx[0],idx[1]]
+
+    npair = nao * (nao + 1) // 2
+    cderi = numpy.empty((npair,npair))
+    _cint.CINTcholesky_eri_sph.restype = ctypes.c_int
+    nvec = _cint.CINTcholesky_eri_sph(cderi.ctypes.data_as(ctypes.c_void_p),
+                                      ctypes.c_int(npair), ctypes.c_double(1e-9),
+                                      c_atm, natm, c_bas, nbas, c_env, None)
+    err = abs(cderi[:nvec].T.dot(cderi[:nvec]) - eri).max()
+    if err > 1e-9 or nvec >= npair:
+        print("* FAIL: CINTcholesky_eri_sph. nvec:", nvec, "err:", err)
+    else:
+        print("pass: CINTcholesky_eri_sph")
+
+
+def test_stg_roots():
+    # roots u=t^2 and weights w of the weight function
+    #   exp(-ta t^2 - ua (1/t^2-1)) / t^2 on [0, 1].
+    # The moments sum_i w_i u_i^k/sum_i w_i are checked for k < 2*nroots
+    if not hasattr(_cint, 'CINTstg_roots'):
+        print("skip: CINTstg_roots requires WITH_F12")
+        return
+    t, wt = numpy.polynomial.legendre.leggauss(400)
+    t = (t + 1) * .5
+    wt *= .5
+    for nroots in range(1, 5):
+        for ta in (.5, 5., 30.):
+            for ua in (.01, 1., 10.):
+                rr = numpy.empty(nroots)
+                ww = numpy.empty(nroots)
+                _cint.CINTstg_roots(ctypes.c_int(nroots), ctypes.c_double(ta),
+                                    ctypes.c_double(ua),
+                                    rr.ctypes.data_as(ctypes.c_void_p),
+                                    ww.ctypes.data_as(ctypes.c_void_p))
+                f = wt * numpy.exp(-ta * t**2 - ua * (1/t**2 - 1)) / t**2
+                k = numpy.arange(2*nroots)
+                ref = (t[:,None]**(2*k) * f[:,None]).sum(axis=0) / f.sum()
+                mom = (rr[:,None]**k * ww[:,None]).sum(axis=0) / ww.sum()
+                if not abs(mom - ref).max() < 1e-9:  # fails on nan
+                    print("* FAIL: CINTstg_roots. nroots:", nroots, "ta:", ta,
+                          "ua:", ua, "err:", abs(mom - ref).max())
+                    return
+    print("pass: CINTstg_roots")
+
+
+def test_stg_geminals():
+    if not hasattr(_cint, 'int2e_stg_geminals_sph'):
+        print("skip: int2e_stg_geminals requires WITH_F12")
+        return
+    PTR_F12_ZETA = 9
+    NF12_GEMINALS = 13
+    PTR_F12_GEMINALS = 14
+    # ua = zeta^2/(4*a0) of the small zeta falls below 1e-6 for the tight
+    # primitives
+    zetas = (1.2, .002, 0.)
+    coeffs = (.3, -.7, .2)
+    ngem = len(zetas)
+    ptr = 9000
+    env1 = env.copy()
+    env1[NF12_GEMINALS] = ngem
+    env1[PTR_F12_GEMINALS] = ptr
+    env1[ptr:ptr+ngem] = zetas
+    env1[ptr+ngem:ptr+ngem*2] = coeffs
+    c_env1 = env1.ctypes.data_as(ctypes.c_void_p)
+    def ovlp(i, j):
+        di = (bas[i,ANG_OF] * 2 + 1) * bas[i,NCTR_OF]
+        dj = (bas[j,ANG_OF] * 2 + 1) * bas[j,NCTR_OF]
+        buf = numpy.empty(di*dj)
+        _cint.int1e_ovlp_sph(buf.ctypes.data_as(ctypes.c_void_p), None,
+                             (ctypes.c_int * 2)(i, j),
+                             c_atm, natm, c_bas, nbas, c_env1, None, None)
+        return buf.reshape(dj,di)
+    for l in range(nbas.value):
+        for k in range(l+1):
+            for j in range(nbas.value):
+                for i in range(j+1):
+                    di = (bas[i,ANG_OF] * 2 + 1) * bas[i,NCTR_OF]
+                    dj = (bas[j,ANG_OF] * 2 + 1) * bas[j,NCTR_OF]
+                    dk = (bas[k,ANG_OF] * 2 + 1) * bas[k,NCTR_OF]
+                    dl = (bas[l,ANG_OF] * 2 + 1) * bas[l,NCTR_OF]
+                    shls = (ctypes.c_int * 4)(i, j, k, l)
+                    buf = numpy.empty((ngem,dl,dk,dj,di))
+                    tot = numpy.empty((dl,dk,dj,di))
+                    ref = numpy.empty((dl,dk,dj,di))
+                    _cint.int2e_stg_geminals_sph(buf.ctypes.data_as(ctypes.c_void_p), None, shls,
+                                                 c_atm, natm, c_bas, nbas, c_env1, None, None)
+                    _cint.int2e_stg_sum_sph(tot.ctypes.data_as(ctypes.c_void_p), None, shls,
+                                            c_atm, natm, c_bas, nbas, c_env1, None, None)
+                    err = abs(tot - buf.sum(axis=0)).max()
+                    for n in range(ngem):
+                        if zetas[n] == 0:
+                            ref = numpy.einsum('lk,ji->lkji', ovlp(k, l), ovlp(i, j))
+                        else:
+                            env1[PTR_F12_ZETA] = zetas[n]
+                            _cint.int2e_stg_sph(ref.ctypes.data_as(ctypes.c_void_p), None, shls,
+                                                c_atm, natm, c_bas, nbas, c_env1, None, None)
+                        err = max(err, abs(buf[n] - coeffs[n] * ref).max())
+                    if err > 1e-11 * max(1, abs(buf).max()):
+                        print("* FAIL: int2e_stg_geminals. shell:", i, j, k, l, "err:", err)
+                        return
+    # 11 geminals of 3 roots each exceed MXRYSROOTS
+    env1[NF12_GEMINALS] = 11
+    env1[ptr:ptr+22] = .5
+    shls = (ctypes.c_int * 4)(0, 0, 0, 0)
+    buf = numpy.zeros(81*11)
+    if _cint.int2e_stg_geminals_sph(buf.ctypes.data_as(ctypes.c_void_p), None, shls,
+                                    c_atm, natm, c_bas, nbas, c_env1, None, None) != 0 \
+       or abs(buf).max() != 0:
+        print("* FAIL: int2e_stg_geminals MXRYSROOTS overflow")
+        return
+    print("pass: int2e_stg_geminals")
+
+
+def test_sr_pair_bounds():
+    # more than MAX_PGTO_FOR_PAIRDATA primitives, the optimizer has no pairdata
+    natm1 = 2
+    nbas1 = 200
+    atm1 = numpy.zeros((natm1,ATM_SLOTS), dtype=numpy.int32)
+    bas1 = numpy.zeros((nbas1,BAS_SLOTS), dtype=numpy.int32)
+    env1 = numpy.zeros(PTR_ENV_START + 6 + 22)
+    atm1[:,PTR_COORD] = (PTR_ENV_START, PTR_ENV_START + 3)
+    env1[PTR_ENV_START+3:PTR_ENV_START+6] = (0, 0, 20.)
+    env1[PTR_ENV_START+6:PTR_ENV_START+17] = .5 * 1.8**numpy.arange(11)
+    env1[PTR_ENV_START+17:] = 1.
+    bas1[:,ATOM_OF] = numpy.arange(nbas1) % 2
+    bas1[:,ANG_OF] = 1
+    bas1[:,NPRIM_OF] = 11
+    bas1[:,NCTR_OF] = 1
+    bas1[:,PTR_EXP] = PTR_ENV_START + 6
+    bas1[:,PTR_COEFF] = PTR_ENV_START + 17
+    c_atm1 = atm1.ctypes.data_as(ctypes.c_void_p)
+    c_bas1 = bas1.ctypes.data_as(ctypes.c_void_p)
+    c_env1 = env1.ctypes.data_as(ctypes.c_void_p)
+    _cint.CINTOpt_sr_screened.argtypes = (ctypes.c_void_p, ctypes.c_void_p,
+                                          ctypes.c_double, ctypes.c_double)
+    for omega, far_screened in ((0, 0), (-.5, 1)):
+        env1[PTR_RANGE_OMEGA] = omega
+        opt = ctypes.c_void_p()
+        _cint.int2e_optimizer(ctypes.byref(opt), c_atm1, ctypes.c_int(natm1),
+                              c_bas1, ctypes.c_int(nbas1), c_env1)
+        # shells 0, 2 on atom 0, shells 1, 3 on atom 1
+        for shls, screened in (((0, 2, 1, 3), far_screened), ((0, 1, 2, 3), 0)):
+            shls = (ctypes.c_int * 4)(*shls)
+            if _cint.CINTOpt_sr_screened(opt, shls, omega, 60.) != screened:
+                print("* FAIL: SR pair bounds. omega:", omega, "shell:", list(shls))
+                _cint.CINTdel_optimizer(ctypes.byref(opt))
+                return
+            buf = numpy.empty(81)
+            ref = numpy.empty(81)
+            _cint.int2e_sph(buf.ctypes.data_as(ctypes.c_void_p), None, shls,
+                            c_atm1, ctypes.c_int(natm1), c_bas1, ctypes.c_int(nbas1),
+                            c_env1, opt, None)
+            _cint.int2e_sph(ref.ctypes.data_as(ctypes.c_void_p), None, shls,
+                            c_atm1, ctypes.c_int(natm1), c_bas1, ctypes.c_int(nbas1),
+                            c_env1, None, None)
+            if abs(buf - ref).max() > 1e-13 or (screened and abs(buf).max() != 0):
+                print("* FAIL: SR pair bounds. omega:", omega, "shell:", list(shls),
+                      "err:", abs(buf - ref).max())
+                _cint.CINTdel_optimizer(ctypes.byref(opt))
+                return
+        _cint.CINTdel_optimizer(ctypes.byref(opt))
+    print("pass: SR pair bounds")
+
+
+def test_sr_rys_roots():
+    # moments sum_i w_i t_i^2k of the roots t^2 = u/(1+u) of the weight
+    # function exp(-x t^2) on [lower, 1], for the tabulated region
+    # x*lower^2 < 10 and the solvers up to EXPCUTOFF_SR
+    s, ws = numpy.polynomial.legendre.leggauss(400)
+    s = (s + 1) * .5
+    ws = ws * .5
+    xs = []
+    lowers = []
+    for lower in (.05, .2, .32, .47, .55):
+        for xll in (.5, 2., 5., 9.9, 12., 15., 20., 25., 30., 35., 38.):
+            xs.append(xll / lower**2)
+            lowers.append(lower)
+    xs = numpy.array(xs)
+    lowers = numpy.array(lowers)
+    for nroots in range(1, 9):
+        u = numpy.zeros((len(xs),nroots))
+        w = numpy.zeros((len(xs),nroots))
+        _cint.CINTsr_rys_roots_batch(ctypes.c_int(nroots), ctypes.c_int(len(xs)),
+                                     xs.ctypes.data_as(ctypes.c_void_p),
+                                     lowers.ctypes.data_as(ctypes.c_void_p),
+                                     u.ctypes.data_as(ctypes.c_void_p),
+                                     w.ctypes.data_as(ctypes.c_void_p))
+        for n, (x, lower) in enumerate(zip(xs, lowers)):
+            u1 = numpy.zeros(nroots)
+            w1 = numpy.zeros(nroots)
+            _cint.CINTsr_rys_roots(ctypes.c_int(nroots), ctypes.c_double(x),
+                                   ctypes.c_double(lower),
+                                   u1.ctypes.data_as(ctypes.c_void_p),
+                                   w1.ctypes.data_as(ctypes.c_void_p))
+            # the integrand is negligible beyond exp(-40)
+            width = min(1 - lower, 20. / (x * lower))
+            t = lower + s * width
+            wt = ws * width * numpy.exp(-x * t**2)
+            t2 = u1 / (1 + u1)
+            mom = numpy.array([(w1 * t2**k).sum() for k in range(2*nroots)])
+            ref = numpy.array([(wt * t**(2*k)).sum() for k in range(2*nroots)])
+            err = abs(mom - ref).max() / ref[0]
+            if (not err < 1e-7 or
+                abs(u[n] - u1).max() != 0 or abs(w[n] - w1).max() != 0):
+                print("* FAIL: CINTsr_rys_roots. nroots:", nroots, "x:", x,
+                      "lower:", lower, "err:", err)
+                return
+    print("pass: CINTsr_rys_roots")
+
+
+def test_int3c2e_lattice():
+    lattice = numpy.array([[3.0, 0.0, 0.0],
+                           [0.5, 3.5, 0.0],
+                           [0.0, 0.3, 4.0]])
+    rcut = 9.
+    env1 = env.copy()
+    c_env1 = env1.ctypes.data_as(ctypes.c_void_p)
+    env1[PTR_RANGE_OMEGA] = -0.5
+    ptr = atm[3,PTR_COORD]
+    rk = env[ptr:ptr+3].copy()
+    n = numpy.arange(-6, 7)
+    Ls = numpy.einsum('i,j,k->ijk', n, n*0+1, n*0+1)[...,None] * lattice[0]
+    Ls = Ls + numpy.einsum('i,j,k->ijk', n*0+1, n, n*0+1)[...,None] * lattice[1]
+    Ls = Ls + numpy.einsum('i,j,k->ijk', n*0+1, n*0+1, n)[...,None] * lattice[2]
+    Ls = Ls.reshape(-1,3)
+    c_lattice = lattice.ctypes.data_as(ctypes.c_void_p)
+    # shells of atom 3 are used as k only
+    for k in (3, 7):
+        for j in (0, 1, 2, 5):
+            for i in (0, 1, 4, 6):
+                di = (bas[i,ANG_OF] * 2 + 1) * bas[i,NCTR_OF]
+                dj = (bas[j,ANG_OF] * 2 + 1) * bas[j,NCTR_OF]
+                dk = (bas[k,ANG_OF] * 2 + 1) * bas[k,NCTR_OF]
+                shls = (ctypes.c_int * 3)(i, j, k)
+                ri = env[atm[bas[i,ATOM_OF],PTR_COORD]:][:3]
+                rj = env[atm[bas[j,ATOM_OF],PTR_COORD]:][:3]
+                rij = rj - ri
+                buf = numpy.empty(di*dj*dk)
+                ref = numpy.zeros(di*dj*dk)
+                for L in Ls:
+                    t = 0
+                    if rij.dot(rij) > 0:
+                        t = min(max((rk+L-ri).dot(rij) / rij.dot(rij), 0), 1)
+                    if numpy.linalg.norm(rk+L-ri-t*rij) > rcut:
+                        continue
+                    env1[ptr:ptr+3] = rk + L
+                    _cint.int3c2e_sph(buf.ctypes.data_as(ctypes.c_void_p), None, shls,
+                                      c_atm, natm, c_bas, nbas, c_env1, None, None)
+                    ref += buf
+                env1[ptr:ptr+3] = rk
+                _cint.int3c2e_sph_lattice(buf.ctypes.data_as(ctypes.c_void_p), None, shls,
+                                          c_atm, natm, c_bas, nbas, c_env1, None, None,
+                                          c_lattice, ctypes.c_double(rcut))
+                if abs(buf - ref).max() > 1e-10:
+                    print("* FAIL: int3c2e_sph_lattice. shell:", i, j, k,
+                          "err:", abs(buf - ref).max())
+                    return
+    print("pass: int3c2e_sph_lattice")
+
+
+def test_int1e_lattice():
+    lattice = numpy.array([[2.5, 0.0, 0.0],
+                           [0.5, 3.0, 0.0],
+                           [0.0, 0.3, 3.5]])
+    rcut = 12.
+    kpts = numpy.array([[0., 0., 0.], [.3, -.2, .1], [.5, .7, -.4]])
+    n = numpy.arange(-6, 7)
+    Ls = (n[:,None,None,None] * lattice[0] + n[None,:,None,None] * lattice[1]
+          + n[None,None,:,None] * lattice[2]).reshape(-1,3)
+    # a copy of shell j on a charge-free atom gives the images in the reference
+    atm1 = numpy.vstack((atm[:natm.value], atm[:1]))
+    atm1[-1,CHARGE_OF] = 0
+    atm1[-1,PTR_COORD] = off + 100
+    env1 = env.copy()
+    bas1 = bas.copy()
+    c_atm1 = atm1.ctypes.data_as(ctypes.c_void_p)
+    c_bas1 = bas1.ctypes.data_as(ctypes.c_void_p)
+    c_env1 = env1.ctypes.data_as(ctypes.c_void_p)
+    natm1 = ctypes.c_int(natm.value + 1)
+    c_lattice = lattice.ctypes.data_as(ctypes.c_void_p)
+    for name in ('int1e_ovlp', 'int1e_kin', 'int1e_nuc'):
+        intor = getattr(_cint, name + '_sph')
+        for j in range(nbas.value*2):
+            for i in range(nbas.value*2):
+                di = (bas[i,ANG_OF] * 2 + 1) * bas[i,NCTR_OF]
+                dj = (bas[j,ANG_OF] * 2 + 1) * bas[j,NCTR_OF]
+                shls = (ctypes.c_int * 2)(i, j)
+                shls1 = (ctypes.c_int * 2)(i, 100)
+                ri = env[atm[bas[i,ATOM_OF],PTR_COORD]:][:3]
+                rj = env[atm[bas[j,ATOM_OF],PTR_COORD]:][:3]
+                bas1[100] = bas[j]
+                bas1[100,ATOM_OF] = natm.value
+                buf = numpy.empty(di*dj)
+                ref = numpy.zeros((len(kpts),di*dj), dtype=numpy.complex128)
+                for L in Ls:
+                    if numpy.linalg.norm(rj+L-ri) > rcut:
+                        continue
+                    env1[off+100:off+103] = rj + L
+                    intor(buf.ctypes.data_as(ctypes.c_void_p), None, shls1,
+                          c_atm1, natm1, c_bas1, nbas, c_env1, None, None)
+                    ref += numpy.exp(1j*kpts.dot(L))[:,None] * buf
+                out = numpy.empty((len(kpts),di*dj), dtype=numpy.complex128)
+                getattr(_cint, name + '_sph_lattice')(
+                    buf.ctypes.data_as(ctypes.c_void_p), None, shls, c_atm, natm,
+                    c_bas, nbas, c_env, None, None, c_lattice, ctypes.c_double(rcut))
+                getattr(_cint, name + '_sph_kpts')(
+                    out.ctypes.data_as(ctypes.c_void_p), None, shls, c_atm, natm,
+                    c_bas, nbas, c_env, None, None, c_lattice, ctypes.c_double(rcut),
+                    kpts.ctypes.data_as(ctypes.c_void_p), ctypes.c_int(len(kpts)))
+                err = max(abs(buf - ref[0]).max(), abs(out - ref).max())
+                if err > 1e-11:
+                    print("* FAIL: %s_sph_lattice. shell:" % name, i, j, "err:", err)
+                    return
+    print("pass: int1e_sph_lattice")
+
+
+def test_jit():
+    if not hasattr(_cint, 'CINTjit_intor'):
+        print("skip: CINTjit_intor requires WITH_JIT")
+        return
+    import shutil
+    import tempfile
+    _cint.CINTjit_intor.restype = ctypes.c_void_p
+    _cint.CINTjit_optimizer.restype = ctypes.c_void_p
+    cache = tempfile.mkdtemp()
+    os.environ['LIBCINT_JIT_CACHE'] = cache
+    # the scripts and headers are not installed in the build tree
+    build = os.path.dirname(_cint._name)
+    src = os.path.abspath(os.path.join(__file__, '../../src'))
+    os.environ['LIBCINT_JIT_SCRIPTS'] = os.path.abspath(os.path.join(__file__, '../../scripts'))
+    os.environ['LIBCINT_JIT_CFLAGS'] = '-I%s/include -I%s -I%s/src' % (build, src, build)
+    expr = b'( \\| )'
+    if (_cint.CINTjit_intor(b'jit ovlp', expr, b'sph') or
+        _cint.CINTjit_intor(b'jit_ovlp', expr, b'optimizer')):
+        print("* FAIL: CINTjit_intor accepts an invalid name")
+        shutil.rmtree(cache)
+        return
+    for bad in (b'( \\| ")) (run-shell-command "true")', b'( \\| #.(ext:shell "true") )',
+                b'( \\| \n)', b'( \\| ) )', b'( \\| nuc'):
+        if _cint.CINTjit_intor(b'jit_ovlp', bad, b'sph'):
+            print("* FAIL: CINTjit_intor accepts the expression", bad)
+            shutil.rmtree(cache)
+            return
+    if shutil.which(os.environ.get('LIBCINT_JIT_CLISP', 'clisp')) is None:
+        print("skip: CINTjit_intor code generation requires clisp")
+        shutil.rmtree(cache)
+        return
+    fn = _cint.CINTjit_intor(b'jit_ovlp', expr, b'sph')
+    fopt = _cint.CINTjit_optimizer(b'jit_ovlp', expr)
+    # only the shared object is left in the cache
+    leftover = [f for f in os.listdir(cache) if not f.endswith('.so')]
+    if not fn or not fopt or leftover:
+        print("* FAIL: CINTjit_intor", leftover)
+        shutil.rmtree(cache)
+        return
+    fn = ctypes.CFUNCTYPE(ctypes.c_int, ctypes.c_void_p, ctypes.c_void_p,
+                          ctypes.c_void_p, ctypes.c_void_p, ctypes.c_int,
+                          ctypes.c_void_p, ctypes.c_int, ctypes.c_void_p,
+                          ctypes.c_void_p, ctypes.c_void_p)(fn)
+    fopt = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_int,
+                            ctypes.c_void_p, ctypes.c_int, ctypes.c_void_p)(fopt)
+    opt = ctypes.c_void_p()
+    fopt(ctypes.byref(opt), c_atm, natm, c_bas, nbas, c_env)
+    for j in range(nbas.value):
+        for i in range(nbas.value):
+            di = (bas[i,ANG_OF] * 2 + 1) * bas[i,NCTR_OF]
+            dj = (bas[j,ANG_OF] * 2 + 1) * bas[j,NCTR_OF]
+            shls = (ctypes.c_int * 2)(i, j)
+            buf = numpy.empty(di*dj)
+            ref = numpy.empty(di*dj)
+            fn(buf.ctypes.data_as(ctypes.c_void_p), None, shls,
+               c_atm, natm, c_bas, nbas, c_env, opt, None)
+            _cint.int1e_ovlp_sph(ref.ctypes.data_as(ctypes.c_void_p), None, shls,
+                                 c_atm, natm, c_bas, nbas, c_env, None, None)
+            if abs(buf - ref).max() > 1e-14:
+                print("* FAIL: CINTjit_intor jit_ovlp_sph. shell:", i, j,
+                      "err:", abs(buf - ref).max())
+                _cint.CINTdel_optimizer(ctypes.byref(opt))
+                shutil.rmtree(cache)
+                return
+    _cint.CINTdel_optimizer(ctypes.byref(opt))
+    shutil.rmtree(cache)
+    print("pass: CINTjit_intor")
+
+
+def test_perf_counters():
+    if not hasattr(_cint, 'CINTperf_read'):
+        print("skip: CINTperf_read requires WITH_PERF_COUNTERS")
+        return
+    PRIM_QUARTETS = 0
+    PRIM_QUARTETS_EVAL = 1
+    RYS_CALLS = 2
+    ncounters = 11
+    counters = numpy.empty(ncounters, dtype=numpy.uint64)
+    _cint.CINTperf_reset()
+    nbas2 = nbas.value * 2
+    for l in range(nbas2):
+        for k in range(nbas2):
+            for j in range(nbas2):
+                for i in range(nbas2):
+                    di = (bas[i,ANG_OF] * 2 + 1) * bas[i,NCTR_OF]
+                    dj = (bas[j,ANG_OF] * 2 + 1) * bas[j,NCTR_OF]
+                    dk = (bas[k,ANG_OF] * 2 + 1) * bas[k,NCTR_OF]
+                    dl = (bas[l,ANG_OF] * 2 + 1) * bas[l,NCTR_OF]
+                    shls = (ctypes.c_int * 4)(i, j, k, l)
+                    buf = numpy.empty(di*dj*dk*dl)
+                    _cint.int2e_sph(buf.ctypes.data_as(ctypes.c_void_p), None, shls,
+                                    c_atm, natm, c_bas, nbas, c_env, None, None)
+    _cint.CINTperf_read(counters.ctypes.data_as(ctypes.c_void_p))
+    if not (counters[PRIM_QUARTETS] >= counters[PRIM_QUARTETS_EVAL] > 0 and
+            counters[RYS_CALLS] > 0):
+        print("* FAIL: CINTperf_read", counters)
+        return
+    _cint.CINTperf_reset()
+    _cint.CINTperf_read(counters.ctypes.data_as(ctypes.c_void_p))
+    if counters.any():
+        print("* FAIL: CINTperf_reset", counters)
+        return
+    print("pass: CINTperf_read")
+
 
 if __name__ == "__main__":
     if "--high-prec" in sys.argv:
@@ -528,6 +1360,29 @@ if __name__ == "__main__":
     test_comp2e_spinor('cint2e_ipspsp1', 'cint2e_ip1', (4,4,0,0), 3, 11)
     test_comp2e_spinor('cint2e_ip1spsp2', 'cint2e_ip1', (0,0,4,4), 3, 11)
     test_comp2e_spinor('cint2e_ipspsp1spsp2', 'cint2e_ip1', (4,4,4,4), 3, 11)
+    test_c2s_2e_spinor(11)
+    test_kramers_2e_spinor('int2e_kr_spinor', 'int2e_spinor', 11)
+    test_kramers_2e_spinor('int2e_spsp1_kr_spinor', 'int2e_spsp1_spinor', 11)
+    test_spinor_opt('int2e_kr', 11)
+    test_spinor_opt('int2e_spsp1_kr', 11)
+    test_spinor_opt('int2e_breit_ssp1ssp2', 11)
+    test_spinor_opt('int2e_breit_sps1sps2', 11)
+    test_int2e_hrr(12)
+    test_int2e_opt(12)
+    test_int2e_lazy_pairdata()
+    test_int2e_mixed_precision()
+    test_int3c2e_mixed_precision()
+    test_int2e_multipole()
+    test_fmm_vj()
+    test_cholesky_eri()
+    test_stg_roots()
+    test_stg_geminals()
+    test_sr_pair_bounds()
+    test_sr_rys_roots()
+    test_int3c2e_lattice()
+    test_int1e_lattice()
+    test_jit()
+    test_perf_counters()
 
     fz  = getattr(_cint, 'cint1e_z_sph')
     fzz = getattr(_cint, 'cint1e_zz_sph')
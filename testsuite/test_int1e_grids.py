@@ -208,6 +208,43 @@ def test_int1e_grids_sph(name, vref, dim, place):
     else:
         print('failed')
 
+def test_int1e_grids_omp(name, ncomp=1, comp_size=1):
+    intor = getattr(_cint, name)
+    if comp_size == 1:
+        drv = _cint.CINT1e_grids_omp_drv
+        ao_loc = [(bas[i,ANG_OF] * 2 + 1) * bas[i,NCTR_OF] for i in range(nbas.value*2)]
+    else:
+        drv = _cint.CINT1e_grids_spinor_omp_drv
+        ao_loc = [_cint.CINTlen_spinor(i, c_bas) * bas[i,NCTR_OF]
+                  for i in range(nbas.value*2)]
+    ngrids = 1301
+    numpy.random.seed(12)
+    grids = numpy.random.random((ngrids, 3)) - 5.2
+    env_g = numpy.append(env, grids.ravel())
+    env_g[NGRIDS] = ngrids
+    env_g[PTR_GRIDS] = env.size
+    c_env_g = env_g.ctypes.data_as(ctypes.c_void_p)
+    failed = False
+    for j in range(nbas.value*2):
+        for i in range(j+1):
+            di = ao_loc[i]
+            dj = ao_loc[j]
+            dims = (ctypes.c_int * 3)(di, dj, ngrids)
+            shls = (ctypes.c_int * 4)(i, j, 0, ngrids)
+            ref = numpy.zeros(di*dj*ngrids*ncomp*comp_size)
+            out = numpy.zeros(di*dj*ngrids*ncomp*comp_size)
+            intor(ref.ctypes.data_as(ctypes.c_void_p), dims, shls,
+                  c_atm, natm, c_bas, nbas, c_env_g, opt, None)
+            drv(intor, out.ctypes.data_as(ctypes.c_void_p), dims, shls,
+                c_atm, natm, c_bas, nbas, c_env_g, opt, None)
+            if abs(out - ref).max() > 1e-14:
+                print(i, j, abs(out - ref).max())
+                failed = True
+    if failed:
+        print('failed')
+    else:
+        print('pass')
+
 def test_mol1():
     import time
     import pyscf
@@ -262,6 +299,9 @@ H         -1.49009        3.01810       -0.87995
 
 test_int1e_grids_sph1('cint1e_grids_sph', 36.81452996003706, 1, 9)
 test_int1e_grids_sph('cint1e_grids_ip_sph', 3279.92861109671, 1, 9)
+test_int1e_grids_omp('int1e_grids_sph')
+test_int1e_grids_omp('int1e_grids_ip_sph', 3)
+test_int1e_grids_omp('int1e_grids_spinor', 1, 2)
 try:
     test_mol1()
 except ImportError:
@@ -120,6 +120,34 @@ def test_rys_roots_weights():
     assert max_w_error < 1e-7
     print('test_rys_roots_weights .. pass')
 
+def test_rys_roots_tabulated():
+    print('test tabulated rys_roots_weights')
+    # relative errors against mpmath are ~1e-15 up to nroots = 30 and
+    # reach ~5e-14 for nroots = 31 and ~4e-12 for nroots = 32 at x < 1
+    def tol(nroots):
+        if nroots <= 24:
+            return 1e-14
+        elif nroots <= 30:
+            return 1e-13
+        else:
+            return 1e-11
+    es = 2**numpy.arange(-3, 8, 1.)
+    for i in range(12, 33):
+        max_r_error = 0
+        max_w_error = 0
+        for x in es:
+            r_ref, w_ref = rys_roots.rys_roots_weights(i, x)
+            r_ref = numpy.array(r_ref, dtype=float)
+            w_ref = numpy.array(w_ref, dtype=float)
+            r, w = cint_call('CINTrys_roots', i, x)
+            max_r_error = max(max_r_error, (abs(r-r_ref)/r_ref).max())
+            max_w_error = max(max_w_error, abs(w-w_ref).max()/w_ref.max())
+        if max_r_error > tol(i) or max_w_error > tol(i):
+            print('Errors for root', i, max_r_error, max_w_error)
+        assert max_r_error < tol(i)
+        assert max_w_error < tol(i)
+    print('test_rys_roots_tabulated .. pass')
+
 
 def test_rys_roots_weights_erfc():
     print('test sr-rys_roots_weights')
@@ -247,4 +275,5 @@ if __name__ == '__main__':
     #test_rys_roots_weights()
     test_stg_roots()
     test_rys_roots_weights()
+    test_rys_roots_tabulated()
     test_rys_roots_weights_erfc()